@@ -0,0 +1,100 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file alloc_tracking.cpp Attribution of heap allocations to subsystems.
+ *
+ * The global allocation operators are replaced with counting wrappers that charge
+ * each allocation to the #AllocationTag of the current scope. The counters are
+ * always on; the cost is one thread-local read and one relaxed atomic addition
+ * per allocation.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "stdafx.h"
+#include "alloc_tracking.h"
+
+thread_local AllocationTag _allocation_tag = ALT_OTHER;  ///< Tag that allocations of the current scope are charged to.
+
+static std::atomic<uint64> _tag_counts[ALT_COUNT];  ///< Number of allocations per tag.
+static std::atomic<uint64> _tag_bytes[ALT_COUNT];   ///< Total bytes requested per tag.
+
+/** Names of the allocation tags, in #AllocationTag order. */
+static const char *_tag_names[ALT_COUNT] = {
+	"other",
+	"guests",
+	"pathfinding",
+	"sprites",
+	"gui",
+};
+
+/**
+ * Get the display name of an allocation tag.
+ * @param tag Tag to name.
+ * @return The name of the tag.
+ */
+const char *AllocationTagName(AllocationTag tag)
+{
+	return _tag_names[tag];
+}
+
+/**
+ * Get the allocation counters of a tag.
+ * Subtract two snapshots to get the allocations of the phase between them.
+ * @param tag Tag to query.
+ * @return The current counters of the tag.
+ */
+TagAllocationStats GetTagAllocationStats(AllocationTag tag)
+{
+	return {_tag_counts[tag].load(std::memory_order_relaxed), _tag_bytes[tag].load(std::memory_order_relaxed)};
+}
+
+/**
+ * Counting allocator behind the replaced global allocation operators.
+ * @param size Number of bytes to allocate.
+ * @return The allocated memory.
+ */
+static void *CountedAlloc(std::size_t size)
+{
+	_tag_counts[_allocation_tag].fetch_add(1, std::memory_order_relaxed);
+	_tag_bytes[_allocation_tag].fetch_add(size, std::memory_order_relaxed);
+	void *ptr = malloc(size);
+	if (ptr == nullptr) throw std::bad_alloc();
+	return ptr;
+}
+
+void *operator new(std::size_t size)
+{
+	return CountedAlloc(size);
+}
+
+void *operator new[](std::size_t size)
+{
+	return CountedAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
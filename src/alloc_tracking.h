@@ -0,0 +1,62 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file alloc_tracking.h Attribution of heap allocations to subsystems. */
+
+#ifndef ALLOC_TRACKING_H
+#define ALLOC_TRACKING_H
+
+#include "stdafx.h"
+
+/** Subsystems that heap allocations are attributed to. */
+enum AllocationTag {
+	ALT_OTHER,        ///< Allocations outside any tagged scope.
+	ALT_GUESTS,       ///< Guest simulation.
+	ALT_PATHFINDING,  ///< Path graph maintenance and route searches.
+	ALT_SPRITES,      ///< Sprite and image data.
+	ALT_GUI,          ///< Window and widget handling.
+
+	ALT_COUNT         ///< Number of allocation tags.
+};
+
+/** Allocation counters of one tag. */
+struct TagAllocationStats {
+	uint64 count;  ///< Number of allocations.
+	uint64 bytes;  ///< Total number of bytes requested.
+};
+
+const char *AllocationTagName(AllocationTag tag);
+TagAllocationStats GetTagAllocationStats(AllocationTag tag);
+
+extern thread_local AllocationTag _allocation_tag;
+
+/**
+ * Scope guard attributing all heap allocations in its lifetime to a subsystem.
+ * Scopes nest; the enclosing tag is restored on destruction. The tag is
+ * thread-local, worker threads count under #ALT_OTHER unless they tag themselves.
+ */
+class AllocationTagScope {
+public:
+	/**
+	 * Start attributing allocations to a subsystem.
+	 * @param tag Subsystem to attribute to.
+	 */
+	explicit AllocationTagScope(AllocationTag tag) : previous(_allocation_tag)
+	{
+		_allocation_tag = tag;
+	}
+
+	~AllocationTagScope()
+	{
+		_allocation_tag = this->previous;
+	}
+
+private:
+	const AllocationTag previous;  ///< Tag to restore when the scope ends.
+};
+
+#endif
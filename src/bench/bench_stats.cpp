@@ -0,0 +1,50 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file bench_stats.cpp Process-wide resource statistics for the headless benchmarks. */
+
+#include "bench_stats.h"
+#include "../alloc_tracking.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+/**
+ * Get the allocation counters of the process, summed over all allocation tags.
+ * Subtract two snapshots to get the allocations of the phase between them.
+ * @return The current counters.
+ */
+AllocationStats GetAllocationStats()
+{
+	AllocationStats total = {0, 0};
+	for (int tag = 0; tag < ALT_COUNT; tag++) {
+		const TagAllocationStats stats = GetTagAllocationStats(static_cast<AllocationTag>(tag));
+		total.count += stats.count;
+		total.bytes += stats.bytes;
+	}
+	return total;
+}
+
+/**
+ * Get the peak resident set size of the process.
+ * @return Peak resident set size in bytes, \c 0 when not available on the platform.
+ */
+uint64 GetPeakRSS()
+{
+#if defined(__APPLE__)
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	return usage.ru_maxrss;  // Bytes on macOS.
+#elif defined(__unix__)
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	return static_cast<uint64>(usage.ru_maxrss) * 1024;  // Kilobytes on Linux.
+#else
+	return 0;
+#endif
+}
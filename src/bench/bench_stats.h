@@ -0,0 +1,24 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file bench_stats.h Process-wide resource statistics for the headless benchmarks. */
+
+#ifndef BENCH_STATS_H
+#define BENCH_STATS_H
+
+#include "../stdafx.h"
+
+/** Counters of all heap allocations made by the process so far. */
+struct AllocationStats {
+	uint64 count;  ///< Number of allocations.
+	uint64 bytes;  ///< Total number of bytes requested.
+};
+
+AllocationStats GetAllocationStats();
+uint64 GetPeakRSS();
+
+#endif
@@ -0,0 +1,340 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file guest_bench.cpp Headless guest simulation benchmark.
+ *
+ * Loads a fixture park, spawns a parameterized number of guests through #Guests, runs the
+ * simulation for a fixed number of ticks without any rendering, and reports ms/tick
+ * percentiles. Guest performance changes should land with before/after numbers from this
+ * benchmark.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "../stdafx.h"
+#include "../freerct.h"
+#include "../rcdfile.h"
+#include "../sprite_data.h"
+#include "../sprite_store.h"
+#include "../language.h"
+#include "../getoptdata.h"
+#include "../fileio.h"
+#include "../gamecontrol.h"
+#include "../gameobserver.h"
+#include "../density_map.h"
+#include "../loadsave.h"
+#include "../ride_type.h"
+#include "../person.h"
+#include "../path_jobs.h"
+#include "../people.h"
+#include "../scenery.h"
+#include "../dates.h"
+#include "../profiler.h"
+#include "../task_system.h"
+#include "../random.h"
+#include "../replay.h"
+#include "../rev.h"
+#include "bench_stats.h"
+
+static const int WARMUP_TICKS = 128;         ///< Unmeasured ticks to let freshly spawned guests disperse from the entrance.
+
+/** Command-line options of the benchmark. */
+static const OptionData _options[] = {
+	GETOPT_NOVAL('h', "--help"),
+	GETOPT_VALUE('l', "--load"),
+	GETOPT_VALUE('g', "--guests"),
+	GETOPT_VALUE('t', "--ticks"),
+	GETOPT_VALUE('j', "--json"),
+	GETOPT_VALUE('r', "--replay"),
+	GETOPT_VALUE('i', "--installdir"),
+	GETOPT_VALUE('u', "--userdatadir"),
+	GETOPT_END()
+};
+
+/** Output command-line help. */
+static void PrintUsage()
+{
+	printf("Usage: freerct_bench -l FILE [options]\n");
+	printf("Options:\n");
+	printf("  -h, --help             Display this help text and exit.\n");
+	printf("  -l, --load FILE        Fixture park to load. Must have a guest entrance road.\n");
+	printf("  -g, --guests COUNTS    Comma-separated guest counts to benchmark (default 1000,5000,10000).\n");
+	printf("  -t, --ticks N          Number of measured ticks per guest count (default 2000).\n");
+	printf("  -j, --json FILE        Also write one JSON metrics object per guest count to FILE ('-' for stdout).\n");
+	printf("  -r, --replay FILE      Replay a recorded session tick-exactly instead of the guest benchmark.\n");
+	printf("  -i, --installdir DIR   Use the specified installation directory.\n");
+	printf("  -u, --userdatadir DIR  Use the specified user data directory.\n");
+}
+
+/**
+ * Get a percentile from a sorted list of tick durations.
+ * @param sorted Tick durations in milliseconds, sorted ascending.
+ * @param percentile Percentile to get, in percent.
+ * @return Duration in milliseconds at the percentile.
+ */
+static double Percentile(const std::vector<double> &sorted, int percentile)
+{
+	return sorted[(sorted.size() - 1) * percentile / 100];
+}
+
+/** Reset all game state, mirroring #GameControl::ShutdownLevel for the headless benchmark. */
+static void ResetLevel()
+{
+	_game_mode_mgr.SetGameMode(GM_NONE);
+	_rides_manager.DeleteAllRideInstances();
+	_scenery.Clear();
+	_game_observer.Uninitialize();
+	_guests.Uninitialize();
+	_staff.Uninitialize();
+	_density_map.Clear();
+}
+
+/** Run one simulation tick, the same work #OnNewFrame performs minus the GUI updates. */
+static void RunTick()
+{
+	RunSimulationTick();
+}
+
+static void MeasureTicks(const std::string &fname, int guest_count, int ticks, FILE *json);
+
+/**
+ * Benchmark the simulation with a given number of guests.
+ * @param fname Fixture park to load.
+ * @param guest_count Number of guests to spawn before measuring.
+ * @param ticks Number of measured ticks.
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ * @return Whether the benchmark run succeeded.
+ */
+static bool RunBenchmark(const std::string &fname, int guest_count, int ticks, FILE *json)
+{
+	ResetLevel();
+	if (!LoadGameFile(fname.c_str())) {
+		fprintf(stderr, "Failed to load fixture park '%s'.\n", fname.c_str());
+		return false;
+	}
+	_game_mode_mgr.SetGameMode(GM_PLAY);
+
+	while (static_cast<int>(_guests.CountActiveGuests()) < guest_count) {
+		if (_guests.SpawnGuest() == nullptr) {
+			fprintf(stderr, "Fixture park '%s' has no guest entrance road.\n", fname.c_str());
+			return false;
+		}
+	}
+
+	for (int i = 0; i < WARMUP_TICKS; i++) RunTick();
+
+	MeasureTicks(fname, guest_count, ticks, json);
+	return true;
+}
+
+/**
+ * Run and measure simulation ticks, and report the results.
+ * @param fname Name of the loaded park, for the JSON report.
+ * @param guest_count Guest count to report the run under.
+ * @param ticks Number of ticks to run.
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ */
+static void MeasureTicks(const std::string &fname, int guest_count, int ticks, FILE *json)
+{
+	AllocationStats alloc_before = {0, 0};
+	if (json != nullptr) {
+		_profiler.Reset();
+		_profiler.enabled = true;  // Record the per-subsystem breakdown of the measured ticks.
+		alloc_before = GetAllocationStats();
+	}
+
+	std::vector<double> durations;
+	durations.reserve(ticks);
+	for (int i = 0; i < ticks; i++) {
+		const auto start = std::chrono::steady_clock::now();
+		RunTick();
+		const auto stop = std::chrono::steady_clock::now();
+		durations.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+		if (json != nullptr) _profiler.EndFrame();
+	}
+
+	const AllocationStats alloc_after = GetAllocationStats();
+	_profiler.enabled = false;
+
+	double total = 0;
+	for (double d : durations) total += d;
+	std::sort(durations.begin(), durations.end());
+
+	printf("%8d %8d %9.3f %9.3f %9.3f %9.3f %9.3f %8u\n",
+			guest_count, ticks, total / ticks,
+			Percentile(durations, 50), Percentile(durations, 90), Percentile(durations, 99),
+			durations.back(), _guests.CountActiveGuests());
+
+	if (json != nullptr) {
+		fprintf(json, "{\"park\":\"%s\",\"guests\":%d,\"ticks\":%d,", fname.c_str(), guest_count, ticks);
+		fprintf(json, "\"tick_ms\":{\"mean\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"max\":%.3f},",
+				total / ticks, Percentile(durations, 50), Percentile(durations, 90), Percentile(durations, 99), durations.back());
+		fprintf(json, "\"zones_ms\":{");
+		for (int zone = 0; zone < PFZ_RENDER_BEGIN; zone++) {  // The render zones never run headless.
+			const ProfiledZone pfz = static_cast<ProfiledZone>(zone);
+			fprintf(json, "%s\"%s\":{\"p50\":%.3f,\"p95\":%.3f,\"max\":%.3f}", zone == 0 ? "" : ",",
+					ProfiledZoneName(pfz), _profiler.Percentile(pfz, 0.50), _profiler.Percentile(pfz, 0.95), _profiler.Maximum(pfz));
+		}
+		fprintf(json, "},\"peak_rss_bytes\":%llu,\"allocations\":{\"count\":%llu,\"bytes\":%llu}}\n",
+				static_cast<unsigned long long>(GetPeakRSS()),
+				static_cast<unsigned long long>(alloc_after.count - alloc_before.count),
+				static_cast<unsigned long long>(alloc_after.bytes - alloc_before.bytes));
+	}
+}
+
+/**
+ * Replay a recorded game session tick-exactly and measure its tick times.
+ * @param path Replay file recorded by the game (see replay.cpp for the format).
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ * @return Whether the replay ran.
+ */
+static bool RunReplay(const std::string &path, FILE *json)
+{
+	ReplayLog log;
+	if (!log.Load(path)) {
+		fprintf(stderr, "Failed to load replay '%s'.\n", path.c_str());
+		return false;
+	}
+
+	ResetLevel();
+	if (!LoadGameFile(log.save.c_str())) {
+		fprintf(stderr, "Failed to load replay snapshot '%s'.\n", log.save.c_str());
+		return false;
+	}
+	Random::SetSeed(log.seed);
+	_game_mode_mgr.SetGameMode(GM_PLAY);
+
+	/* The recorded ticks are simulation ticks, pauses take up no ticks and the other
+	 * speeds only change how many ticks a rendered frame runs; replaying every recorded
+	 * tick therefore reproduces the session exactly.
+	 */
+	MeasureTicks(path, _guests.CountActiveGuests(), log.end_tick, json);
+	return true;
+}
+
+/**
+ * Main entry point of the guest benchmark.
+ * @param argc Argument count.
+ * @param argv Argument vector.
+ * @return The exit code of the program.
+ */
+int main(int argc, char **argv)
+{
+	GetOptData opt_data(argc - 1, argv + 1, _options);
+
+	int opt_id;
+	std::string file_name;
+	std::string json_path;
+	std::string replay_path;
+	std::vector<int> guest_counts;
+	int ticks = 2000;
+	do {
+		opt_id = opt_data.GetOpt();
+		switch (opt_id) {
+			case 'h':
+				PrintUsage();
+				return 0;
+			case 'i':
+				OverrideInstallPrefix(opt_data.opt);
+				break;
+			case 'u':
+				OverrideUserdataPrefix(opt_data.opt);
+				break;
+			case 'l':
+				if (opt_data.opt != nullptr) file_name = opt_data.opt;
+				break;
+			case 'j':
+				if (opt_data.opt != nullptr) json_path = opt_data.opt;
+				break;
+			case 'r':
+				if (opt_data.opt != nullptr) replay_path = opt_data.opt;
+				break;
+			case 'g':
+				for (const char *p = opt_data.opt; p != nullptr && *p != '\0';) {
+					char *end;
+					const long count = strtol(p, &end, 10);
+					if (end == p || count < 1) {
+						fprintf(stderr, "Invalid guest count in '%s'.\n", opt_data.opt);
+						return 1;
+					}
+					guest_counts.push_back(count);
+					p = (*end == ',') ? end + 1 : end;
+				}
+				break;
+			case 't':
+				ticks = atoi(opt_data.opt);
+				if (ticks < 1) {
+					fprintf(stderr, "Invalid tick count '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+
+			case -1:
+				break;
+
+			default:
+				/* -2 or some other weird thing happened. */
+				fprintf(stderr, "ERROR while processing the command-line\n");
+				return 1;
+		}
+	} while (opt_id != -1);
+
+	if (file_name.empty() && replay_path.empty()) {
+		PrintUsage();
+		return 1;
+	}
+	if (guest_counts.empty()) guest_counts = {1000, 5000, 10000};
+
+	_max_autosaves = 0;  // The benchmark must not write autosave files.
+
+	_task_system.Start();
+
+	/* Load RCD files; person animations are needed even without rendering. */
+	InitImageStorage();
+	_rcd_collection.ScanDirectories();
+	_sprite_manager.LoadRcdFiles();
+	_rides_manager.LoadDesigns();
+
+	InitLanguage();
+
+	if (!_gui_sprites.HasSufficientGraphics()) {
+		fprintf(stderr, "Insufficient graphics loaded.\n");
+		return 1;
+	}
+
+	FILE *json = nullptr;
+	if (!json_path.empty()) {
+		json = (json_path == "-") ? stdout : fopen(json_path.c_str(), "wt");
+		if (json == nullptr) {
+			fprintf(stderr, "Could not open JSON output file '%s' for writing.\n", json_path.c_str());
+			return 1;
+		}
+	}
+
+	printf("  guests    ticks  mean_ms    p50_ms    p90_ms    p99_ms    max_ms    final\n");
+	bool success = true;
+	if (!replay_path.empty()) {
+		success = RunReplay(replay_path, json);
+	} else {
+		for (int count : guest_counts) {
+			if (!RunBenchmark(file_name, count, ticks, json)) {
+				success = false;
+				break;
+			}
+		}
+	}
+	if (json != nullptr && json != stdout) fclose(json);
+
+	ResetLevel();
+	_path_job_queue.Shutdown();
+	_task_system.Shutdown();
+	UninitLanguage();
+	DestroyImageStorage();
+	return success ? 0 : 1;
+}
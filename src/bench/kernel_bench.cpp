@@ -0,0 +1,362 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file kernel_bench.cpp Headless microbenchmarks of isolated hot kernels.
+ *
+ * Measures a handful of core loops in isolation, so a regression found by the macro
+ * benchmarks can be localized to one kernel: #ImageData::GetPixel, #ImageData::GetRecoloured
+ * (both the variant-cache hit and the rebuild path), #PathSearcher::Search on the paths of a
+ * fixture park, and #CoasterTrain::OnAnimate on a fixture coaster. The pixel kernels run on
+ * the loaded guest animation sprites and need no fixture; the path and coaster kernels need
+ * a park passed with \c --load. #VideoSystem::BlitImage and #VoxelCollector::Collect need a
+ * window and an OpenGL context and are therefore not covered here; the pixel kernels are the
+ * compute core under the blit path.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include "../stdafx.h"
+#include "../freerct.h"
+#include "../rcdfile.h"
+#include "../sprite_data.h"
+#include "../sprite_store.h"
+#include "../language.h"
+#include "../getoptdata.h"
+#include "../fileio.h"
+#include "../gamecontrol.h"
+#include "../gameobserver.h"
+#include "../density_map.h"
+#include "../loadsave.h"
+#include "../ride_type.h"
+#include "../coaster.h"
+#include "../map.h"
+#include "../path.h"
+#include "../path_finding.h"
+#include "../person.h"
+#include "../path_jobs.h"
+#include "../people.h"
+#include "../scenery.h"
+#include "../dates.h"
+#include "../task_system.h"
+#include "../rev.h"
+#include "bench_stats.h"
+
+/** Command-line options of the benchmark. */
+static const OptionData _options[] = {
+	GETOPT_NOVAL('h', "--help"),
+	GETOPT_VALUE('l', "--load"),
+	GETOPT_VALUE('n', "--iterations"),
+	GETOPT_VALUE('j', "--json"),
+	GETOPT_VALUE('i', "--installdir"),
+	GETOPT_VALUE('u', "--userdatadir"),
+	GETOPT_END()
+};
+
+/** Output command-line help. */
+static void PrintUsage()
+{
+	printf("Usage: freerct_kernelbench [options]\n");
+	printf("Options:\n");
+	printf("  -h, --help             Display this help text and exit.\n");
+	printf("  -l, --load FILE        Fixture park for the path-finding and coaster kernels.\n");
+	printf("                         Without it only the sprite pixel kernels are measured.\n");
+	printf("  -n, --iterations N     Number of measured iterations per kernel (default 200).\n");
+	printf("  -j, --json FILE        Also write one JSON metrics object per kernel to FILE ('-' for stdout).\n");
+	printf("  -i, --installdir DIR   Use the specified installation directory.\n");
+	printf("  -u, --userdatadir DIR  Use the specified user data directory.\n");
+}
+
+/**
+ * Get a percentile from a sorted list of iteration durations.
+ * @param sorted Iteration durations in milliseconds, sorted ascending.
+ * @param percentile Percentile to get, in percent.
+ * @return Duration in milliseconds at the percentile.
+ */
+static double Percentile(const std::vector<double> &sorted, int percentile)
+{
+	return sorted[(sorted.size() - 1) * percentile / 100];
+}
+
+static uint64 _sink = 0;  ///< Accumulator of kernel results, so the measured work cannot be optimized away.
+
+/**
+ * Measure a kernel and report its timings.
+ * @param name Name of the kernel in the report.
+ * @param iterations Number of measured iterations.
+ * @param work_items Number of elementary work items one iteration processes (pixels, searches, trains).
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ * @param kernel The kernel to run; one call is one iteration.
+ */
+static void Measure(const char *name, int iterations, uint64 work_items, FILE *json, const std::function<void()> &kernel)
+{
+	kernel();  // Warm up caches and lazy initialization outside the measurement.
+
+	std::vector<double> durations;
+	durations.reserve(iterations);
+	for (int i = 0; i < iterations; i++) {
+		const auto start = std::chrono::steady_clock::now();
+		kernel();
+		const auto stop = std::chrono::steady_clock::now();
+		durations.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+	}
+
+	double total = 0;
+	for (double d : durations) total += d;
+	std::sort(durations.begin(), durations.end());
+
+	printf("%-14s %8d %11.4f %11.4f %11.4f %11.4f %12llu\n",
+			name, iterations, total / iterations,
+			Percentile(durations, 50), Percentile(durations, 99), durations.back(),
+			static_cast<unsigned long long>(work_items));
+
+	if (json != nullptr) {
+		fprintf(json, "{\"kernel\":\"%s\",\"iterations\":%d,\"work_items\":%llu,", name, iterations, static_cast<unsigned long long>(work_items));
+		fprintf(json, "\"iter_ms\":{\"mean\":%.4f,\"p50\":%.4f,\"p99\":%.4f,\"max\":%.4f}}\n",
+				total / iterations, Percentile(durations, 50), Percentile(durations, 99), durations.back());
+	}
+}
+
+/**
+ * Gather loaded guest animation sprites as pixel-kernel fixtures.
+ * @return Sprites to process, possibly empty.
+ */
+static std::vector<const ImageData *> GatherGuestSprites()
+{
+	std::vector<const ImageData *> sprites;
+	const SpriteStorage &store = _sprite_manager.GetGuiSpriteStore();
+	for (uint a = 0; a < ANIMATION_TYPE_COUNT; a++) {
+		const AnimationSprites *asp = store.animations[a][PERSON_GUEST];
+		if (asp == nullptr) continue;
+		for (uint f = 0; f < asp->frame_count; f++) {
+			if (asp->sprites[f] != nullptr) sprites.push_back(asp->sprites[f]);
+		}
+		if (sprites.size() >= 64) break;  // Plenty of work per iteration already.
+	}
+	return sprites;
+}
+
+/**
+ * Run the #ImageData pixel kernels.
+ * @param iterations Number of measured iterations per kernel.
+ * @param json File to append JSON metrics objects to, \c nullptr to skip.
+ */
+static void RunPixelKernels(int iterations, FILE *json)
+{
+	const std::vector<const ImageData *> sprites = GatherGuestSprites();
+	if (sprites.empty()) {
+		fprintf(stderr, "No guest animation sprites loaded, skipping the pixel kernels.\n");
+		return;
+	}
+
+	uint64 pixels = 0;
+	for (const ImageData *img : sprites) pixels += static_cast<uint64>(img->width) * img->height;
+
+	Recolouring rec;
+	rec.AssignRandomColours();
+
+	Measure("getpixel", iterations, pixels, json, [&sprites, &rec]() {
+		for (const ImageData *img : sprites) {
+			for (uint16 y = 0; y < img->height; y++) {
+				for (uint16 x = 0; x < img->width; x++) {
+					_sink += img->GetPixel(x, y, &rec);
+				}
+			}
+		}
+	});
+
+	/* Hit path: the recoloured variant of each sprite is cached after the first iteration. */
+	Measure("recolour_hot", iterations, sprites.size(), json, [&sprites, &rec]() {
+		for (const ImageData *img : sprites) {
+			_sink += reinterpret_cast<uintptr_t>(img->GetRecoloured(GS_NORMAL, rec));
+		}
+	});
+
+	/* Rebuild path: fresh random colours make almost every lookup build a new variant. */
+	Measure("recolour_cold", iterations, sprites.size(), json, [&sprites]() {
+		Recolouring cold;
+		cold.AssignRandomColours();
+		for (const ImageData *img : sprites) {
+			_sink += reinterpret_cast<uintptr_t>(img->GetRecoloured(GS_NORMAL, cold));
+		}
+	});
+}
+
+/**
+ * Run the path finder kernel on the ground-level paths of the loaded park.
+ * @param iterations Number of measured iterations.
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ */
+static void RunPathFindKernel(int iterations, FILE *json)
+{
+	static const uint SEARCHES_PER_ITERATION = 16;  ///< Number of path searches per measured iteration.
+
+	std::vector<XYZPoint16> path_tiles;
+	for (uint16 x = 0; x < _world.GetXSize(); x++) {
+		for (uint16 y = 0; y < _world.GetYSize(); y++) {
+			const int16 z = _world.GetBaseGroundHeight(x, y);
+			const Voxel *v = _world.GetVoxel(XYZPoint16(x, y, z));
+			if (v != nullptr && HasValidPath(v)) path_tiles.push_back(XYZPoint16(x, y, z));
+		}
+	}
+	if (path_tiles.size() < 2) {
+		fprintf(stderr, "Fixture park has too few path tiles, skipping the path-finding kernel.\n");
+		return;
+	}
+
+	uint32 state = 0x2545F491;  // Fixed-seed generator so every run searches the same tile pairs.
+	auto next = [&state]() {
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	};
+
+	Measure("pathfind", iterations, SEARCHES_PER_ITERATION, json, [&path_tiles, &next]() {
+		for (uint i = 0; i < SEARCHES_PER_ITERATION; i++) {
+			const XYZPoint16 &start = path_tiles[next() % path_tiles.size()];
+			const XYZPoint16 &dest = path_tiles[next() % path_tiles.size()];
+			_path_searcher.Reset(dest);
+			_path_searcher.AddStart(start);
+			_sink += _path_searcher.Search(true) ? 1 : 0;
+		}
+	});
+}
+
+/**
+ * Run the coaster train physics kernel on the trains of the loaded park.
+ * @param iterations Number of measured iterations.
+ * @param json File to append a JSON metrics object to, \c nullptr to skip.
+ */
+static void RunCoasterKernel(int iterations, FILE *json)
+{
+	static const int FRAME_DELAY = 32;  ///< Animation step per train per iteration, in milliseconds.
+
+	std::vector<CoasterTrain *> trains;
+	for (auto &pair : _rides_manager.instances) {
+		if (pair.second->GetKind() != RTK_COASTER) continue;
+		CoasterInstance *ci = static_cast<CoasterInstance *>(pair.second.get());
+		for (uint i = 0; i < lengthof(ci->trains); i++) {
+			if (ci->trains[i].cars.empty()) break;
+			trains.push_back(&ci->trains[i]);
+		}
+	}
+	if (trains.empty()) {
+		fprintf(stderr, "Fixture park has no coaster with trains, skipping the coaster kernel.\n");
+		return;
+	}
+
+	Measure("coaster", iterations, trains.size(), json, [&trains]() {
+		for (CoasterTrain *train : trains) train->OnAnimate(FRAME_DELAY);
+	});
+}
+
+/**
+ * Main entry point of the kernel benchmark.
+ * @param argc Argument count.
+ * @param argv Argument vector.
+ * @return The exit code of the program.
+ */
+int main(int argc, char **argv)
+{
+	GetOptData opt_data(argc - 1, argv + 1, _options);
+
+	int opt_id;
+	std::string file_name;
+	std::string json_path;
+	int iterations = 200;
+	do {
+		opt_id = opt_data.GetOpt();
+		switch (opt_id) {
+			case 'h':
+				PrintUsage();
+				return 0;
+			case 'i':
+				OverrideInstallPrefix(opt_data.opt);
+				break;
+			case 'u':
+				OverrideUserdataPrefix(opt_data.opt);
+				break;
+			case 'l':
+				if (opt_data.opt != nullptr) file_name = opt_data.opt;
+				break;
+			case 'j':
+				if (opt_data.opt != nullptr) json_path = opt_data.opt;
+				break;
+			case 'n':
+				iterations = atoi(opt_data.opt);
+				if (iterations < 1) {
+					fprintf(stderr, "Invalid iteration count '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+
+			case -1:
+				break;
+
+			default:
+				/* -2 or some other weird thing happened. */
+				fprintf(stderr, "ERROR while processing the command-line\n");
+				return 1;
+		}
+	} while (opt_id != -1);
+
+	_max_autosaves = 0;  // The benchmark must not write autosave files.
+
+	_task_system.Start();
+
+	/* Load RCD files; the pixel kernels run on the real game sprites. */
+	InitImageStorage();
+	_rcd_collection.ScanDirectories();
+	_sprite_manager.LoadRcdFiles();
+	_rides_manager.LoadDesigns();
+
+	InitLanguage();
+
+	if (!_gui_sprites.HasSufficientGraphics()) {
+		fprintf(stderr, "Insufficient graphics loaded.\n");
+		return 1;
+	}
+
+	FILE *json = nullptr;
+	if (!json_path.empty()) {
+		json = (json_path == "-") ? stdout : fopen(json_path.c_str(), "wt");
+		if (json == nullptr) {
+			fprintf(stderr, "Could not open JSON output file '%s' for writing.\n", json_path.c_str());
+			return 1;
+		}
+	}
+
+	printf("kernel            iters     mean_ms      p50_ms      p99_ms      max_ms   work_items\n");
+	RunPixelKernels(iterations, json);
+
+	bool success = true;
+	if (!file_name.empty()) {
+		if (LoadGameFile(file_name.c_str())) {
+			_game_mode_mgr.SetGameMode(GM_PLAY);
+			RunPathFindKernel(iterations, json);
+			RunCoasterKernel(iterations, json);
+		} else {
+			fprintf(stderr, "Failed to load fixture park '%s'.\n", file_name.c_str());
+			success = false;
+		}
+	}
+	if (json != nullptr && json != stdout) fclose(json);
+
+	_game_mode_mgr.SetGameMode(GM_NONE);
+	_rides_manager.DeleteAllRideInstances();
+	_scenery.Clear();
+	_game_observer.Uninitialize();
+	_guests.Uninitialize();
+	_staff.Uninitialize();
+	_density_map.Clear();
+	_path_job_queue.Shutdown();
+	_task_system.Shutdown();
+	UninitLanguage();
+	DestroyImageStorage();
+	return success ? 0 : 1;
+}
@@ -0,0 +1,383 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file park_gen.cpp Procedural worst-case park generator.
+ *
+ * Fills the default flat world to a parameterized density - a path grid, roller coasters built
+ * from the shipped track designs, scenery coverage, and guests - and writes the result with
+ * #Saver. The output serves as repeatable fixture for freerct_bench, freerct_savebench and
+ * freerct_kernelbench, replacing hand-built stress parks. The same seed always produces the
+ * same park.
+ */
+
+#include <vector>
+#include "../stdafx.h"
+#include "../freerct.h"
+#include "../rcdfile.h"
+#include "../sprite_data.h"
+#include "../sprite_store.h"
+#include "../language.h"
+#include "../getoptdata.h"
+#include "../fileio.h"
+#include "../gamecontrol.h"
+#include "../gameobserver.h"
+#include "../density_map.h"
+#include "../loadsave.h"
+#include "../map.h"
+#include "../path_build.h"
+#include "../ride_type.h"
+#include "../coaster.h"
+#include "../scenery.h"
+#include "../person.h"
+#include "../path_jobs.h"
+#include "../people.h"
+#include "../random.h"
+#include "../task_system.h"
+#include "../rev.h"
+
+static const int WARMUP_TICKS = 128;  ///< Ticks to let freshly spawned guests disperse before the park is saved.
+
+static Random _parkgen_rnd;  ///< Random number source of the generator, made repeatable through #Random::SetSeed.
+
+/** Command-line options of the generator. */
+static const OptionData _options[] = {
+	GETOPT_NOVAL('h', "--help"),
+	GETOPT_VALUE('o', "--output"),
+	GETOPT_VALUE('p', "--path-spacing"),
+	GETOPT_VALUE('c', "--coasters"),
+	GETOPT_VALUE('r', "--scenery"),
+	GETOPT_VALUE('g', "--guests"),
+	GETOPT_VALUE('S', "--seed"),
+	GETOPT_VALUE('i', "--installdir"),
+	GETOPT_VALUE('u', "--userdatadir"),
+	GETOPT_END()
+};
+
+/** Output command-line help. */
+static void PrintUsage()
+{
+	printf("Usage: freerct_parkgen -o FILE [options]\n");
+	printf("Options:\n");
+	printf("  -h, --help              Display this help text and exit.\n");
+	printf("  -o, --output FILE       Savegame file to write.\n");
+	printf("  -p, --path-spacing N    Build a path every N tiles in both directions, 0 disables paths (default 4).\n");
+	printf("  -c, --coasters N        Number of coasters to build from shipped track designs (default 4).\n");
+	printf("  -r, --scenery PERCENT   Percentage of tiles to attempt to cover with scenery (default 50).\n");
+	printf("  -g, --guests N          Number of guests to spawn before saving (default 0).\n");
+	printf("  -S, --seed N            Random seed, making the generated park repeatable (default 1).\n");
+	printf("  -i, --installdir DIR    Use the specified installation directory.\n");
+	printf("  -u, --userdatadir DIR   Use the specified user data directory.\n");
+}
+
+/**
+ * Build a grid of flat paths over the world, including the border tiles so guests can enter.
+ * @param spacing Distance between two grid lines, in tiles.
+ * @return Number of path tiles built.
+ */
+static int BuildPathGrid(int spacing)
+{
+	int built = 0;
+	for (int x = 0; x < _world.GetXSize(); x++) {
+		for (int y = 0; y < _world.GetYSize(); y++) {
+			if (x % spacing != 0 && y % spacing != 0) continue;
+			const XYZPoint16 pos(x, y, _world.GetBaseGroundHeight(x, y));
+			if (BuildFlatPath(pos, PAT_CONCRETE, PAS_NORMAL_PATH, false, false)) built++;
+		}
+	}
+	return built;
+}
+
+/**
+ * Compute the positioned track pieces of a design at a given base position.
+ * @param ct Coaster type owning the design.
+ * @param trd Design to place.
+ * @param base Position of the entry point of the first piece.
+ * @param pieces [out] Positioned pieces of the design, cleared on failure.
+ * @return All pieces of the design can be placed at this position.
+ */
+static bool PositionDesign(const CoasterType *ct, const TrackedRideDesign &trd, const XYZPoint16 &base, std::vector<PositionedTrackPiece> *pieces)
+{
+	pieces->clear();
+	pieces->reserve(trd.pieces.size());
+	XYZPoint16 pos = base;
+	for (const TrackedRideDesign::AbstractTrackPiece &abstract_piece : trd.pieces) {
+		const int piece_id = ct->GetPieceIndex(abstract_piece.piece_name);
+		if (piece_id < 0) {
+			pieces->clear();
+			return false;
+		}
+		ConstTrackPiecePtr piece = ct->pieces.at(piece_id);
+		pieces->emplace_back(pos, piece);
+		if (pieces->back().CanBePlaced() != STR_NULL) {
+			pieces->clear();
+			return false;
+		}
+		pos += piece->exit_dxyz;
+	}
+	return !pieces->empty();
+}
+
+/**
+ * Build roller coasters from the shipped track designs.
+ * Coasters are packed into the world in scan order; each one gets an entrance and an exit,
+ * trains, and is opened when the track forms a complete circuit.
+ * @param count Number of coasters to build.
+ * @return Number of coasters actually built.
+ */
+static int BuildCoasters(int count)
+{
+	/* Collect all (coaster type, design) pairs to cycle through. */
+	std::vector<std::pair<const CoasterType *, const TrackedRideDesign *>> available;
+	for (uint i = 0;; i++) {
+		const RideType *rt = _rides_manager.GetRideType(i);
+		if (rt == nullptr) break;
+		if (rt->kind != RTK_COASTER) continue;
+		for (const TrackedRideDesign &trd : rt->designs) {
+			available.emplace_back(static_cast<const CoasterType *>(rt), &trd);
+		}
+	}
+	if (available.empty()) return 0;
+
+	int built = 0;
+	std::vector<PositionedTrackPiece> design_pieces;
+	for (int n = 0; n < count; n++) {
+		const CoasterType *ct = available[n % available.size()].first;
+		const TrackedRideDesign &trd = *available[n % available.size()].second;
+
+		/* Find the first free spot in scan order; trying a few heights makes room for dipping designs. */
+		bool found = false;
+		for (int x = 1; x < _world.GetXSize() - 1 && !found; x++) {
+			for (int y = 1; y < _world.GetYSize() - 1 && !found; y++) {
+				const int ground = _world.GetBaseGroundHeight(x, y);
+				for (int dz = 0; dz <= 2 && !found; dz++) {
+					found = PositionDesign(ct, trd, XYZPoint16(x, y, ground + dz), &design_pieces);
+				}
+			}
+		}
+		if (!found) break;  // The world is full, further designs won't fit either.
+
+		const uint16 instance = _rides_manager.GetFreeInstance(ct);
+		if (instance == INVALID_RIDE_INSTANCE) break;
+		CoasterInstance *ci = static_cast<CoasterInstance *>(_rides_manager.CreateInstance(ct, instance));
+		_rides_manager.NewInstanceAdded(instance);
+
+		if (ci->AddPositionedPieces(design_pieces) < 0) {
+			_rides_manager.DeleteInstance(instance);
+			break;
+		}
+		for (const PositionedTrackPiece &ptp : design_pieces) ci->PlaceTrackPieceInWorld(ptp);
+		built++;
+
+		if (!ci->MakePositionedPiecesLooping(nullptr)) continue;  // Leave an open-ended design under construction.
+
+		/* Complete the construction process, mirroring #ShowCoasterManagementGui. */
+		ci->CloseRide();
+		ci->SetNumberOfCars(ci->GetMaxNumberOfCars());
+		ci->SetNumberOfTrains(std::max(1, ci->GetMaxNumberOfTrains(ci->cars_per_train)));
+
+		std::set<XYZPoint16> candidates;
+		ci->GetEntranceExitCandidates(&candidates);
+		for (int entrance = 1; entrance >= 0; entrance--) {
+			for (const XYZPoint16 &pos : candidates) {
+				if (!ci->CanPlaceEntranceOrExit(pos, entrance != 0, nullptr)) continue;
+				if (ci->PlaceEntranceOrExit(pos, entrance != 0, nullptr)) break;
+			}
+		}
+		if (ci->CanOpenRide()) ci->OpenRide();
+	}
+	return built;
+}
+
+/**
+ * Cover the world with randomly chosen scenery items.
+ * @param percent Percentage of tiles to attempt to cover.
+ * @return Number of scenery items placed.
+ */
+static int PlaceScenery(int percent)
+{
+	std::vector<const SceneryType *> types;
+	for (SceneryCategory cat : {SCC_TREES, SCC_FLOWERBEDS, SCC_FOUNTAINS}) {
+		for (const SceneryType *t : _scenery.GetAllTypes(cat)) types.push_back(t);
+	}
+	if (types.empty()) return 0;
+
+	const int attempts = _world.GetXSize() * _world.GetYSize() * percent / 100;
+	int placed = 0;
+	for (int i = 0; i < attempts; i++) {
+		const int x = _parkgen_rnd.Uniform(_world.GetXSize() - 1);
+		const int y = _parkgen_rnd.Uniform(_world.GetYSize() - 1);
+		const SceneryType *type = types[_parkgen_rnd.Uniform(types.size() - 1)];
+
+		SceneryInstance *si = new SceneryInstance(type);
+		si->vox_pos = XYZPoint16(x, y, _world.GetBaseGroundHeight(x, y));
+		si->orientation = type->symmetric ? 0 : _parkgen_rnd.Uniform(3);
+		if (si->CanPlace() == STR_NULL) {
+			_scenery.AddItem(si);
+			placed++;
+		} else {
+			delete si;
+		}
+	}
+	return placed;
+}
+
+/** Reset all game state, mirroring #GameControl::ShutdownLevel for the headless generator. */
+static void ResetLevel()
+{
+	_game_mode_mgr.SetGameMode(GM_NONE);
+	_rides_manager.DeleteAllRideInstances();
+	_scenery.Clear();
+	_game_observer.Uninitialize();
+	_guests.Uninitialize();
+	_staff.Uninitialize();
+	_density_map.Clear();
+}
+
+/**
+ * Main entry point of the park generator.
+ * @param argc Argument count.
+ * @param argv Argument vector.
+ * @return The exit code of the program.
+ */
+int main(int argc, char **argv)
+{
+	GetOptData opt_data(argc - 1, argv + 1, _options);
+
+	int opt_id;
+	std::string file_name;
+	int path_spacing = 4;
+	int coasters = 4;
+	int scenery_percent = 50;
+	int guest_count = 0;
+	uint32 seed = 1;
+	do {
+		opt_id = opt_data.GetOpt();
+		switch (opt_id) {
+			case 'h':
+				PrintUsage();
+				return 0;
+			case 'i':
+				OverrideInstallPrefix(opt_data.opt);
+				break;
+			case 'u':
+				OverrideUserdataPrefix(opt_data.opt);
+				break;
+			case 'o':
+				if (opt_data.opt != nullptr) file_name = opt_data.opt;
+				break;
+			case 'p':
+				path_spacing = atoi(opt_data.opt);
+				if (path_spacing < 0) {
+					fprintf(stderr, "Invalid path spacing '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+			case 'c':
+				coasters = atoi(opt_data.opt);
+				if (coasters < 0) {
+					fprintf(stderr, "Invalid coaster count '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+			case 'r':
+				scenery_percent = atoi(opt_data.opt);
+				if (scenery_percent < 0 || scenery_percent > 100) {
+					fprintf(stderr, "Invalid scenery percentage '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+			case 'g':
+				guest_count = atoi(opt_data.opt);
+				if (guest_count < 0) {
+					fprintf(stderr, "Invalid guest count '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+			case 'S':
+				seed = strtoul(opt_data.opt, nullptr, 10);
+				break;
+
+			case -1:
+				break;
+
+			default:
+				/* -2 or some other weird thing happened. */
+				fprintf(stderr, "ERROR while processing the command-line\n");
+				return 1;
+		}
+	} while (opt_id != -1);
+
+	if (file_name.empty()) {
+		PrintUsage();
+		return 1;
+	}
+
+	_max_autosaves = 0;  // The generator must not write autosave files.
+
+	_task_system.Start();
+
+	/* Load RCD files; sprites and track designs are needed even without rendering. */
+	InitImageStorage();
+	_rcd_collection.ScanDirectories();
+	_sprite_manager.LoadRcdFiles();
+	_rides_manager.LoadDesigns();
+
+	InitLanguage();
+
+	if (!_gui_sprites.HasSufficientGraphics()) {
+		fprintf(stderr, "Insufficient graphics loaded.\n");
+		return 1;
+	}
+
+	Random::SetSeed(seed);
+	LoadGameFile(nullptr);  // Default-initialize a flat world.
+	_game_mode_mgr.SetGameMode(GM_EDITOR);
+	_world.SetTileOwnerGlobally(OWN_PARK);
+
+	printf("world: %d x %d tiles, seed %u\n", _world.GetXSize(), _world.GetYSize(), seed);
+	if (path_spacing > 0) printf("paths: %d tiles (spacing %d)\n", BuildPathGrid(path_spacing), path_spacing);
+	if (coasters > 0) {
+		const int built = BuildCoasters(coasters);
+		printf("coasters: %d of %d\n", built, coasters);
+	}
+	if (scenery_percent > 0) printf("scenery: %d items (%d%% coverage attempted)\n", PlaceScenery(scenery_percent), scenery_percent);
+
+	_game_mode_mgr.SetGameMode(GM_PLAY);
+	bool success = true;
+	if (guest_count > 0) {
+		int spawned = 0;
+		while (spawned < guest_count) {
+			if (_guests.SpawnGuest() == nullptr) {
+				fprintf(stderr, "No guest entrance road; build a path grid that reaches the world edge.\n");
+				success = false;
+				break;
+			}
+			spawned++;
+		}
+		for (int i = 0; i < WARMUP_TICKS && success; i++) RunSimulationTick();
+		printf("guests: %d\n", spawned);
+	}
+
+	if (success) {
+		if (SaveGameFile(file_name.c_str())) {
+			std::error_code ec;
+			const uint64 bytes = std::filesystem::file_size(file_name, ec);
+			printf("saved: %s (%llu bytes)\n", file_name.c_str(), static_cast<unsigned long long>(ec ? 0 : bytes));
+		} else {
+			fprintf(stderr, "Failed to write savegame '%s'.\n", file_name.c_str());
+			success = false;
+		}
+	}
+
+	ResetLevel();
+	_path_job_queue.Shutdown();
+	_task_system.Shutdown();
+	UninitLanguage();
+	DestroyImageStorage();
+	return success ? 0 : 1;
+}
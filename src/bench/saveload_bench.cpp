@@ -0,0 +1,280 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file saveload_bench.cpp Headless save/load benchmark.
+ *
+ * Loads a fixture park, grows it to parameterized guest counts, then runs #Saver and #Loader
+ * repeatedly and reports wall time, bytes written and peak memory per phase. Save-format
+ * changes should land with before/after numbers from this benchmark.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "../stdafx.h"
+#include "../freerct.h"
+#include "../rcdfile.h"
+#include "../sprite_data.h"
+#include "../sprite_store.h"
+#include "../language.h"
+#include "../getoptdata.h"
+#include "../fileio.h"
+#include "../gamecontrol.h"
+#include "../gameobserver.h"
+#include "../density_map.h"
+#include "../loadsave.h"
+#include "../ride_type.h"
+#include "../person.h"
+#include "../path_jobs.h"
+#include "../people.h"
+#include "../scenery.h"
+#include "../dates.h"
+#include "../task_system.h"
+#include "../rev.h"
+
+#ifdef LINUX
+#include <sys/resource.h>
+#endif
+
+static const int WARMUP_TICKS = 128;         ///< Ticks to let freshly spawned guests disperse before the park is saved.
+
+static const char *BENCH_SAVE_FILE = "savebench_tmp.fct";  ///< Temporary savegame written and read by the benchmark.
+
+/** Command-line options of the benchmark. */
+static const OptionData _options[] = {
+	GETOPT_NOVAL('h', "--help"),
+	GETOPT_VALUE('l', "--load"),
+	GETOPT_VALUE('g', "--guests"),
+	GETOPT_VALUE('n', "--iterations"),
+	GETOPT_VALUE('c', "--compression"),
+	GETOPT_VALUE('i', "--installdir"),
+	GETOPT_VALUE('u', "--userdatadir"),
+	GETOPT_END()
+};
+
+/** Output command-line help. */
+static void PrintUsage()
+{
+	printf("Usage: freerct_savebench -l FILE [options]\n");
+	printf("Options:\n");
+	printf("  -h, --help             Display this help text and exit.\n");
+	printf("  -l, --load FILE        Fixture park to load. Must have a guest entrance road.\n");
+	printf("  -g, --guests COUNTS    Comma-separated guest counts to benchmark (default 1000,5000,10000).\n");
+	printf("  -n, --iterations N     Number of save and load iterations per guest count (default 20).\n");
+	printf("  -c, --compression N    Savegame compression level 0..9 (default %d).\n", _save_compression_level);
+	printf("  -i, --installdir DIR   Use the specified installation directory.\n");
+	printf("  -u, --userdatadir DIR  Use the specified user data directory.\n");
+}
+
+/**
+ * Get the peak resident memory use of the process so far.
+ * @return Peak resident set size in kilobytes, \c 0 when not available on this platform.
+ */
+static uint64 PeakMemoryKb()
+{
+#ifdef LINUX
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss;
+#endif
+	return 0;
+}
+
+/** Reset all game state, mirroring #GameControl::ShutdownLevel for the headless benchmark. */
+static void ResetLevel()
+{
+	_game_mode_mgr.SetGameMode(GM_NONE);
+	_rides_manager.DeleteAllRideInstances();
+	_scenery.Clear();
+	_game_observer.Uninitialize();
+	_guests.Uninitialize();
+	_staff.Uninitialize();
+	_density_map.Clear();
+}
+
+/** Run one simulation tick, the same work #OnNewFrame performs minus the GUI updates. */
+static void RunTick()
+{
+	RunSimulationTick();
+}
+
+/**
+ * Benchmark saving and loading a park with a given number of guests.
+ * @param fname Fixture park to load.
+ * @param guest_count Number of guests to spawn before measuring.
+ * @param iterations Number of save and load iterations.
+ * @return Whether the benchmark run succeeded.
+ */
+static bool RunBenchmark(const std::string &fname, int guest_count, int iterations)
+{
+	ResetLevel();
+	if (!LoadGameFile(fname.c_str())) {
+		fprintf(stderr, "Failed to load fixture park '%s'.\n", fname.c_str());
+		return false;
+	}
+	_game_mode_mgr.SetGameMode(GM_PLAY);
+
+	while (static_cast<int>(_guests.CountActiveGuests()) < guest_count) {
+		if (_guests.SpawnGuest() == nullptr) {
+			fprintf(stderr, "Fixture park '%s' has no guest entrance road.\n", fname.c_str());
+			return false;
+		}
+	}
+	for (int i = 0; i < WARMUP_TICKS; i++) RunTick();
+
+	/* Save phase. */
+	std::vector<double> save_ms;
+	save_ms.reserve(iterations);
+	for (int i = 0; i < iterations; i++) {
+		const auto start = std::chrono::steady_clock::now();
+		if (!SaveGameFile(BENCH_SAVE_FILE)) {
+			fprintf(stderr, "Failed to write benchmark savegame '%s'.\n", BENCH_SAVE_FILE);
+			return false;
+		}
+		const auto stop = std::chrono::steady_clock::now();
+		save_ms.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+	}
+	std::error_code ec;
+	const uint64 bytes = std::filesystem::file_size(BENCH_SAVE_FILE, ec);
+	const uint64 save_peak_kb = PeakMemoryKb();
+
+	/* Load phase. */
+	std::vector<double> load_ms;
+	load_ms.reserve(iterations);
+	for (int i = 0; i < iterations; i++) {
+		const auto start = std::chrono::steady_clock::now();
+		if (!LoadGameFile(BENCH_SAVE_FILE)) {
+			fprintf(stderr, "Failed to load benchmark savegame '%s'.\n", BENCH_SAVE_FILE);
+			return false;
+		}
+		const auto stop = std::chrono::steady_clock::now();
+		load_ms.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+	}
+	const uint64 load_peak_kb = PeakMemoryKb();
+
+	double save_total = 0;
+	for (double d : save_ms) save_total += d;
+	double load_total = 0;
+	for (double d : load_ms) load_total += d;
+
+	printf("%8d %8d %9.3f %9.3f %9.3f %9.3f %10llu %9llu %9llu\n",
+			guest_count, iterations,
+			save_total / iterations, *std::max_element(save_ms.begin(), save_ms.end()),
+			load_total / iterations, *std::max_element(load_ms.begin(), load_ms.end()),
+			static_cast<unsigned long long>(ec ? 0 : bytes),
+			static_cast<unsigned long long>(save_peak_kb), static_cast<unsigned long long>(load_peak_kb));
+	return true;
+}
+
+/**
+ * Main entry point of the save/load benchmark.
+ * @param argc Argument count.
+ * @param argv Argument vector.
+ * @return The exit code of the program.
+ */
+int main(int argc, char **argv)
+{
+	GetOptData opt_data(argc - 1, argv + 1, _options);
+
+	int opt_id;
+	std::string file_name;
+	std::vector<int> guest_counts;
+	int iterations = 20;
+	do {
+		opt_id = opt_data.GetOpt();
+		switch (opt_id) {
+			case 'h':
+				PrintUsage();
+				return 0;
+			case 'i':
+				OverrideInstallPrefix(opt_data.opt);
+				break;
+			case 'u':
+				OverrideUserdataPrefix(opt_data.opt);
+				break;
+			case 'l':
+				if (opt_data.opt != nullptr) file_name = opt_data.opt;
+				break;
+			case 'g':
+				for (const char *p = opt_data.opt; p != nullptr && *p != '\0';) {
+					char *end;
+					const long count = strtol(p, &end, 10);
+					if (end == p || count < 1) {
+						fprintf(stderr, "Invalid guest count in '%s'.\n", opt_data.opt);
+						return 1;
+					}
+					guest_counts.push_back(count);
+					p = (*end == ',') ? end + 1 : end;
+				}
+				break;
+			case 'n':
+				iterations = atoi(opt_data.opt);
+				if (iterations < 1) {
+					fprintf(stderr, "Invalid iteration count '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				break;
+			case 'c': {
+				const int level = atoi(opt_data.opt);
+				if (level < 0 || level > 9) {
+					fprintf(stderr, "Invalid compression level '%s'.\n", opt_data.opt);
+					return 1;
+				}
+				_save_compression_level = level;
+				break;
+			}
+
+			case -1:
+				break;
+
+			default:
+				/* -2 or some other weird thing happened. */
+				fprintf(stderr, "ERROR while processing the command-line\n");
+				return 1;
+		}
+	} while (opt_id != -1);
+
+	if (file_name.empty()) {
+		PrintUsage();
+		return 1;
+	}
+	if (guest_counts.empty()) guest_counts = {1000, 5000, 10000};
+
+	_max_autosaves = 0;  // The benchmark must not write autosave files.
+
+	_task_system.Start();
+
+	/* Load RCD files; person animations are needed even without rendering. */
+	InitImageStorage();
+	_rcd_collection.ScanDirectories();
+	_sprite_manager.LoadRcdFiles();
+	_rides_manager.LoadDesigns();
+
+	InitLanguage();
+
+	if (!_gui_sprites.HasSufficientGraphics()) {
+		fprintf(stderr, "Insufficient graphics loaded.\n");
+		return 1;
+	}
+
+	printf("  guests    iters   save_ms  save_max   load_ms  load_max      bytes  save_kb   load_kb\n");
+	bool success = true;
+	for (int count : guest_counts) {
+		if (!RunBenchmark(file_name, count, iterations)) {
+			success = false;
+			break;
+		}
+	}
+
+	ResetLevel();
+	if (PathIsFile(BENCH_SAVE_FILE)) RemoveFile(BENCH_SAVE_FILE);
+	_path_job_queue.Shutdown();
+	_task_system.Shutdown();
+	UninitLanguage();
+	DestroyImageStorage();
+	return success ? 0 : 1;
+}
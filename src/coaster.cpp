@@ -7,6 +7,7 @@
 
 /** @file coaster.cpp Coaster type data. */
 
+#include <algorithm>
 #include <cmath>
 #include "stdafx.h"
 #include "sprite_store.h"
@@ -219,6 +220,8 @@ void CoasterType::Load(RcdFileReader *rcd_file, const TextMap &texts, const Trac
 			this->voxels.push_back(tv.get());
 		}
 	}
+	/* Index the pieces by internal name for fast lookups. */
+	for (uint i = 0; i < this->pieces.size(); ++i) this->piece_name_index[this->pieces[i]->internal_name] = i;
 
 	this->internal_name = rcd_file->GetText();
 	rcd_file->CheckExactLength(length, this->internal_name.size() + 1, "end of block");
@@ -293,12 +296,8 @@ int CoasterType::GetPieceIndex(ConstTrackPiecePtr p) const
  */
 int CoasterType::GetPieceIndex(const std::string &name) const
 {
-	for (uint j = 0; j < this->pieces.size(); ++j) {
-		if (name == this->pieces[j]->internal_name) {
-			return j;
-		}
-	}
-	return -1;
+	const auto iter = this->piece_name_index.find(name);
+	return iter != this->piece_name_index.end() ? iter->second : -1;
 }
 
 /**
@@ -327,14 +326,9 @@ int CoasterType::GetRotatedPieceIndex(ConstTrackPiecePtr p, uint8 orientation) c
 		return this->GetPieceIndex(p);
 	}
 
-	for (uint i = 0; i < this->pieces.size(); ++i) {
-		if (piece_name == this->pieces[i]->internal_name) {
-			return i;
-		}
-	}
-
-	assert(orientation != TC_NORTH);
-	return -1;
+	const int index = this->GetPieceIndex(piece_name);
+	assert(index >= 0 || orientation != TC_NORTH);
+	return index;
 }
 
 /** Default constructor, no sprites available yet. */
@@ -403,6 +397,10 @@ void DisplayCoasterCar::Set(const XYZPoint16 &vox_pos, const XYZPoint16 &pix_pos
 		return; // Nothing changed.
 	}
 
+	/* The car moves or turns, the affected columns need redrawing. */
+	if (this->yaw != 0xff) _world_dirty.MarkObjectColumn(this->vox_pos.x, this->vox_pos.y);
+	_world_dirty.MarkObjectColumn(vox_pos.x, vox_pos.y);
+
 	if (this->yaw != 0xff && change_voxel) {
 		/* Valid data, and changing voxel -> remove self from the old voxel. */
 		Voxel *v = _world.GetCreateVoxel(this->vox_pos, false);
@@ -534,33 +532,25 @@ void CoasterTrain::SetLength(const int length)
 	}
 }
 
-/** Combined sin/cos table for 16 roll positions. sin table starts at 0, cos table start at 4. */
-static const float _sin_cos_table[20] = {
-	0.00, 0.38, 0.71, 0.92,
-	1.00, 0.92, 0.71, 0.38, 0.00, -0.38, -0.71, -0.92, -1.00, -0.92, -0.71, -0.38,
-	0.00, 0.38, 0.71, 0.92
+/** Sampled track data of one car, gathered so the position math can run over a contiguous array. */
+struct CarSamplePoint {
+	int32 xpos_back;  ///< X position of the back of the car, in 1/256 pixel.
+	int32 ypos_back;  ///< Y position of the back of the car, in 1/256 pixel.
+	int32 zpos_back;  ///< Z position of the back of the car, in 1/256 pixel.
+	int32 xpos_front; ///< X position of the front of the car, in 1/256 pixel.
+	int32 ypos_front; ///< Y position of the front of the car, in 1/256 pixel.
+	int32 zpos_front; ///< Z position of the front of the car, in 1/256 pixel.
+	const TrackSample *center; ///< Track sample at the center of the car (orientation and gravity).
 };
 
-/**
- * Revert the roll of the coaster car in the direction vector.
- * @param roll Amount of roll of the car.
- * @param dy [inout] Derivative of Y position.
- * @param dz [inout] Derivative of Z position.
- */
-static void inline Unroll(uint roll, int32 *dy, int32 *dz)
-{
-	/* Rotates around X axis, thus dx does not change. */
-	int32 new_dy = *dy * _sin_cos_table[roll + 4] - *dz * _sin_cos_table[roll];
-	int32 new_dz = *dy * _sin_cos_table[roll]     + *dz * _sin_cos_table[roll + 4];
-	*dy = new_dy;
-	*dz = new_dz;
-}
+static std::vector<CarSamplePoint> _car_points; ///< Scratch array with the sampled data of the cars of the train being animated.
 
 /**
  * Time has passed, update the position of the train.
  * @param delay Amount of time passed, in milliseconds.
+ * @param steps Number of animation frames covered by \a delay (more than \c 1 when catching up in coarse off-screen mode).
  */
-void CoasterTrain::OnAnimate(int delay)
+void CoasterTrain::OnAnimate(int delay, int steps)
 {
 	if (this->coaster->state != RIS_OPEN && this->coaster->state != RIS_TESTING) delay = 0;
 	if (this->station_policy == TSP_IN_STATION_FRONT) {
@@ -583,10 +573,7 @@ void CoasterTrain::OnAnimate(int delay)
 		uint32 change = -this->speed * delay;
 		if (change > this->back_position) {
 			this->back_position = this->back_position + this->coaster->coaster_length - change;
-			/* Update the track piece as well. There is no simple way to get
-			 * the last piece, so moving from the front will have to do. */
-			this->cur_piece = this->coaster->pieces.get();
-			while (this->cur_piece->distance_base + this->cur_piece->piece->piece_length < this->back_position) this->cur_piece++;
+			this->cur_piece = this->coaster->FindPieceAtDistance(this->back_position);
 		} else {
 			this->back_position -= change;
 			while (this->cur_piece->distance_base > this->back_position) this->cur_piece--;
@@ -595,8 +582,13 @@ void CoasterTrain::OnAnimate(int delay)
 	uint32 car_length = this->coaster->car_type->car_length;
 	uint32 position = this->back_position; // Back position of the train / last car.
 	const PositionedTrackPiece *ptp = this->cur_piece;
+
+	/* First pass: walk the track once and gather the sampled data of all cars into a
+	 * contiguous scratch array. The second pass below is then branch-free arithmetic over
+	 * that array, which the compiler can vectorize. */
+	_car_points.resize(this->cars.size());
 	for (uint i = 0; i < this->cars.size(); i++) {
-		CoasterCar &car = this->cars[i];
+		CarSamplePoint &cp = _car_points[i];
 		if (position >= this->coaster->coaster_length) {
 			position -= this->coaster->coaster_length;
 			ptp = this->coaster->pieces.get();
@@ -604,18 +596,19 @@ void CoasterTrain::OnAnimate(int delay)
 		while (ptp->distance_base + ptp->piece->piece_length < position) ptp++;
 
 		/* Get position of the back of the car. */
-		int32 xpos_back = ptp->piece->car_xpos->GetValue(position - ptp->distance_base) + (ptp->base_voxel.x << 8);
-		int32 ypos_back = ptp->piece->car_ypos->GetValue(position - ptp->distance_base) + (ptp->base_voxel.y << 8);
-		int32 zpos_back = ptp->piece->car_zpos->GetValue(position - ptp->distance_base) * 2 + (ptp->base_voxel.z << 8);
+		ptp->piece->SamplePosition(position - ptp->distance_base, &cp.xpos_back, &cp.ypos_back, &cp.zpos_back);
+		cp.xpos_back += ptp->base_voxel.x << 8;
+		cp.ypos_back += ptp->base_voxel.y << 8;
+		cp.zpos_back += ptp->base_voxel.z << 8;
 
-		/* Get roll from the center of the car. */
+		/* Get orientation and gravity response from the precomputed sample at the center of the car. */
 		position += car_length / 2;
 		if (position >= this->coaster->coaster_length) {
 			position -= this->coaster->coaster_length;
 			ptp = this->coaster->pieces.get();
 		}
 		while (ptp->distance_base + ptp->piece->piece_length < position) ptp++;
-		uint roll = static_cast<uint>(ptp->piece->car_roll->GetValue(position - ptp->distance_base) + 0.5) & 0xf;
+		cp.center = &ptp->piece->SampleAt(position - ptp->distance_base);
 
 		/* Get position of the front of the car. */
 		position += car_length / 2;
@@ -624,129 +617,57 @@ void CoasterTrain::OnAnimate(int delay)
 			ptp = this->coaster->pieces.get();
 		}
 		while (ptp->distance_base + ptp->piece->piece_length < position) ptp++;
-		int32 xpos_front = ptp->piece->car_xpos->GetValue(position - ptp->distance_base) + (ptp->base_voxel.x << 8);
-		int32 ypos_front = ptp->piece->car_ypos->GetValue(position - ptp->distance_base) + (ptp->base_voxel.y << 8);
-		int32 zpos_front = ptp->piece->car_zpos->GetValue(position - ptp->distance_base) * 2 + (ptp->base_voxel.z << 8);
+		ptp->piece->SamplePosition(position - ptp->distance_base, &cp.xpos_front, &cp.ypos_front, &cp.zpos_front);
+		cp.xpos_front += ptp->base_voxel.x << 8;
+		cp.ypos_front += ptp->base_voxel.y << 8;
+		cp.zpos_front += ptp->base_voxel.z << 8;
 
-		int32 xder = xpos_front - xpos_back;
-		int32 yder = ypos_front - ypos_back;
-		int32 zder = (zpos_front - zpos_back) / 2; // Tile height is half the width.
-
-		int32 xpos_middle = xpos_back + xder / 2; // Compute center point of the car as position to render the car.
-		int32 ypos_middle = ypos_back + yder / 2;
-		int32 zpos_middle = zpos_back + zder;
+		position += this->coaster->car_type->inter_car_length;
+	}
 
-		float total_speed  = sqrt(xder * xder + yder * yder + zder * zder);
-		/* Gravity */
-		this->speed -= zder / total_speed * 9.8;
+	/* Second pass: derive the render position and orientation of every car. */
+	float gravity_sum = 0.0f;
+	for (uint i = 0; i < this->cars.size(); i++) {
+		CoasterCar &car = this->cars[i];
+		CarSamplePoint &cp = _car_points[i];
+		gravity_sum += cp.center->gravity;
 
-		/** \todo Air and rail friction */
+		int32 xpos_middle = cp.xpos_back + (cp.xpos_front - cp.xpos_back) / 2; // Compute center point of the car as position to render the car.
+		int32 ypos_middle = cp.ypos_back + (cp.ypos_front - cp.ypos_back) / 2;
+		int32 zpos_middle = cp.zpos_back + (cp.zpos_front - cp.zpos_back) / 2;
 
-		/* Unroll the orientation vector. */
-		Unroll(roll, &yder, &zder);
-		float horizontal_speed = std::hypot(xder, yder);
+		cp.xpos_back  &= 0xFFFFFF00; // Back and front positions to the north bottom corner of the voxel.
+		cp.ypos_back  &= 0xFFFFFF00;
+		cp.zpos_back  &= 0xFFFFFF00;
+		cp.xpos_front &= 0xFFFFFF00;
+		cp.ypos_front &= 0xFFFFFF00;
+		cp.zpos_front &= 0xFFFFFF00;
+		XYZPoint16 back( cp.xpos_back  >> 8, cp.ypos_back  >> 8, cp.zpos_back  >> 8);
+		XYZPoint16 front(cp.xpos_front >> 8, cp.ypos_front >> 8, cp.zpos_front >> 8);
 
-		static const double TAN11_25 = 0.198912367379658;  // tan(11.25 degrees).
-		static const double TAN33_75 = 0.6681786379192989; // tan(3*11.25 degrees).
+		XYZPoint16 back_pix( xpos_middle - cp.xpos_back,  ypos_middle - cp.ypos_back,  zpos_middle - cp.zpos_back);
+		XYZPoint16 front_pix(xpos_middle - cp.xpos_front, ypos_middle - cp.ypos_front, zpos_middle - cp.zpos_front);
 
-		/* Compute pitch. */
-		bool swap_dz = false;
-		if (zder < 0) {
-			swap_dz = true;
-			zder = -zder;
-		}
+		car.back.Set (back,  back_pix,  cp.center->pitch, cp.center->roll, cp.center->yaw);
+		car.front.Set(front, front_pix, cp.center->pitch, cp.center->roll, cp.center->yaw);
+	}
 
-		uint pitch;
-		if (horizontal_speed < zder) {
-			if (horizontal_speed < zder * TAN11_25) {
-				pitch = 4;
-			} else if (horizontal_speed < zder * TAN33_75) {
-				pitch = 3;
-			} else {
-				pitch = 2;
-			}
-		} else {
-			if (zder < horizontal_speed * TAN11_25) {
-				pitch = 0;
-			} else if (zder < horizontal_speed * TAN33_75) {
-				pitch = 1;
-			} else {
-				pitch = 2;
-			}
-		}
-		if (swap_dz) pitch = (16 - pitch) & 0xf;
+	/* Gravity of all cars, once for every frame covered by this update. */
+	this->speed -= gravity_sum * 9.8 * steps;
 
-		/* Compute yaw. */
-		bool swap_dx = false;
-		if (xder > 0) {
-			swap_dx = true;
-			xder = -xder;
-		}
-		bool swap_dy = false;
-		if (yder > 0) {
-			swap_dy = true;
-			yder = -yder;
-		}
-		uint yaw;
-		/* There are 16 yaw directions, the 360 degrees needs to be split in 16 pieces.
-		 * However the x and y axes are in the middle of a piece, so 360 degrees is split
-		 * in 32 parts, and 2 parts form one piece. */
-		if (xder < yder) {
-			/* In the first 45 degrees. It is split in 4 parts (4*11.25 degrees)
-			 * where the 1st part is for direction 0. The 2nd and 3rd part are for direction 1,
-			 * and the 4th part is for direction 2. */
-			if (xder * TAN11_25 < yder) {
-				yaw = 0;
-			} else if (xder * TAN33_75 < yder) {
-				yaw = 1;
-			} else {
-				yaw = 2;
-			}
-		} else {
-			/* In the second 45 degrees. It is also split in 4 parts (4*11.25 degrees)
-			 * where the 1st part is for direction 2. The 2nd and 3rd part are for direction 3,
-			 * and the 4th part is for direction 4.
-			 *
-			 * Rather than re-inventing a solution, re-use the same checks as
-			 * above with swapped xder and yder. */
-			if (yder * TAN11_25 < xder) {
-				yaw = 4;
-			} else if (yder * TAN33_75 < xder) {
-				yaw = 3;
-			} else {
-				yaw = 2;
-			}
-		}
-		if (swap_dx) yaw = 8 - yaw;
-		if (swap_dy) yaw = (16 - yaw) & 0xf;
-
-		xpos_back  &= 0xFFFFFF00; // Back and front positions to the north bottom corner of the voxel.
-		ypos_back  &= 0xFFFFFF00;
-		zpos_back  &= 0xFFFFFF00;
-		xpos_front &= 0xFFFFFF00;
-		ypos_front &= 0xFFFFFF00;
-		zpos_front &= 0xFFFFFF00;
-		XYZPoint16 back( xpos_back  >> 8, ypos_back  >> 8, zpos_back  >> 8);
-		XYZPoint16 front(xpos_front >> 8, ypos_front >> 8, zpos_front >> 8);
-
-		XYZPoint16 back_pix( xpos_middle - xpos_back,  ypos_middle - ypos_back,  zpos_middle - zpos_back);
-		XYZPoint16 front_pix(xpos_middle - xpos_front, ypos_middle - ypos_front, zpos_middle - zpos_front);
-
-		car.back.Set (back,  back_pix,  pitch, roll, yaw);
-		car.front.Set(front, front_pix, pitch, roll, yaw);
-		position += this->coaster->car_type->inter_car_length;
+	/** \todo Air and rail friction */
 
-		if (i == 0) {
-			/*
-			 * \todo This "calculation" of horizontal and vertical G forces is extremely
-			 * simplistic. For now this is good enough, but when we have coasters with loopings,
-			 * banked curves and so on, this will need to be replaced with a proper physics
-			 * model, as the results of this magic would make no sense for such tracks.
-			 */
-			this->coaster->SampleStatistics(this->back_position, this->station_policy == TSP_NO_STATION, this->speed,
-					pitch > 8 ? static_cast<int>(pitch) - 16 : pitch,
-					roll  > 8 ? static_cast<int>(roll)  - 16 : roll);
-		}
+	if (!this->cars.empty()) {
+		/*
+		 * \todo This "calculation" of horizontal and vertical G forces is extremely
+		 * simplistic. For now this is good enough, but when we have coasters with loopings,
+		 * banked curves and so on, this will need to be replaced with a proper physics
+		 * model, as the results of this magic would make no sense for such tracks.
+		 */
+		const TrackSample *first = _car_points[0].center;
+		this->coaster->SampleStatistics(this->back_position, this->station_policy == TSP_NO_STATION, this->speed,
+				first->pitch > 8 ? static_cast<int>(first->pitch) - 16 : first->pitch,
+				first->roll  > 8 ? static_cast<int>(first->roll)  - 16 : first->roll);
 	}
 
 	bool has_platform = false, has_power = false;
@@ -879,6 +800,7 @@ CoasterStation::CoasterStation()
  */
 CoasterInstance::CoasterInstance(const CoasterType *ct, const CarType *init_car_type) : RideInstance(ct),
 	pieces(new PositionedTrackPiece[MAX_PLACED_TRACK_PIECES]()),
+	total_return_cost(0),
 	capacity(MAX_PLACED_TRACK_PIECES),
 	number_of_trains(0),
 	cars_per_train(0),
@@ -886,7 +808,18 @@ CoasterInstance::CoasterInstance(const CoasterType *ct, const CarType *init_car_
 	temp_entrance_pos(XYZPoint16::invalid()),
 	temp_exit_pos(XYZPoint16::invalid()),
 	max_idle_duration(30000),
-	min_idle_duration(5000)
+	min_idle_duration(5000),
+	offscreen_delay(0),
+	offscreen_steps(0),
+	piece_index_dirty(true),
+	stat_speed_sum(0),
+	stat_vg_speed_sum(0),
+	stat_hg_speed_sum(0),
+	stat_valid_points(0),
+	scenery_bonus(0),
+	scenery_bonus_dirty(true),
+	scenery_scan_next(-1),
+	scenery_scan_sum(0)
 {
 	for (uint i = 0; i < lengthof(this->trains); i++) {
 		CoasterTrain &train = this->trains[i];
@@ -924,16 +857,100 @@ bool CoasterInstance::CanBeVisited(const XYZPoint16 &vox, TileEdge edge) const
 	return false;
 }
 
+static const int OFFSCREEN_PHYSICS_INTERVAL = 120; ///< Coarse timestep in milliseconds for trains that no viewport shows.
+
+/**
+ * Is any part of the coaster's track visible in the main viewport?
+ * @return Whether the coaster may currently be on screen.
+ */
+bool CoasterInstance::IsOnScreen() const
+{
+	const Viewport *vp = _window_manager.GetViewport();
+	if (vp == nullptr) return false;
+
+	/* Compute the voxel bounding box of the placed track. */
+	XYZPoint16 bbox_min(0, 0, 0), bbox_max(0, 0, 0);
+	bool found = false;
+	for (int i = 0; i < this->capacity; i++) {
+		if (this->pieces[i].piece == nullptr) continue;
+		const XYZPoint16 &base = this->pieces[i].base_voxel;
+		if (!found) {
+			bbox_min = base;
+			bbox_max = base;
+			found = true;
+		} else {
+			bbox_min.x = std::min(bbox_min.x, base.x);
+			bbox_min.y = std::min(bbox_min.y, base.y);
+			bbox_min.z = std::min(bbox_min.z, base.z);
+			bbox_max.x = std::max(bbox_max.x, base.x);
+			bbox_max.y = std::max(bbox_max.y, base.y);
+			bbox_max.z = std::max(bbox_max.z, base.z);
+		}
+	}
+	if (!found) return false;
+	/* Margin for the extent of the pieces themselves and the car sprites. */
+	bbox_min.x -= 2; bbox_min.y -= 2; bbox_min.z -= 2;
+	bbox_max.x += 3; bbox_max.y += 3; bbox_max.z += 4;
+
+	/* Project the eight corners of the box, and test the screen box against the viewport. */
+	Point32 screen_min(0, 0), screen_max(0, 0);
+	for (int corner = 0; corner < 8; corner++) {
+		const XYZPoint16 vox((corner & 1) != 0 ? bbox_max.x : bbox_min.x,
+				(corner & 2) != 0 ? bbox_max.y : bbox_min.y,
+				(corner & 4) != 0 ? bbox_max.z : bbox_min.z);
+		const Point32 p = vp->ComputeScreenCoordinate(VoxelToPixel(vox));
+		if (corner == 0) {
+			screen_min = p;
+			screen_max = p;
+		} else {
+			screen_min.x = std::min(screen_min.x, p.x);
+			screen_min.y = std::min(screen_min.y, p.y);
+			screen_max.x = std::max(screen_max.x, p.x);
+			screen_max.y = std::max(screen_max.y, p.y);
+		}
+	}
+	return Rectangle32(screen_min.x, screen_min.y, screen_max.x - screen_min.x, screen_max.y - screen_min.y).Intersects(vp->rect);
+}
+
+/**
+ * Does the coaster currently need to simulate every frame even when off-screen?
+ * Trains interacting with a station load and unload guests, which must happen with full timing fidelity.
+ * @return Whether coarse off-screen simulation is not allowed at the moment.
+ */
+bool CoasterInstance::NeedsFullPhysics() const
+{
+	for (uint i = 0; i < lengthof(this->trains); i++) {
+		const CoasterTrain &train = this->trains[i];
+		if (train.cars.empty()) break;
+		if (train.station_policy != TSP_NO_STATION) return true;
+	}
+	return false;
+}
+
 void CoasterInstance::OnAnimate(int delay)
 {
 	RideInstance::OnAnimate(delay);
 	if (this->broken) return;
 
+	if (this->scenery_bonus_dirty) this->StepSceneryRescan();
+
+	/* Trains only move while the coaster is open or testing, their display state stays as it is otherwise. */
+	if (this->state != RIS_OPEN && this->state != RIS_TESTING) return;
+
+	/* Level-of-detail: trains that no viewport shows and that are nowhere near a station
+	 * advance in coarse steps. The accumulated time is flushed as soon as the coaster
+	 * becomes visible again, so it snaps back to full physics without losing time. */
+	this->offscreen_delay += delay;
+	this->offscreen_steps++;
+	if (this->offscreen_delay < OFFSCREEN_PHYSICS_INTERVAL && !this->NeedsFullPhysics() && !this->IsOnScreen()) return;
+
 	for (uint i = 0; i < lengthof(this->trains); i++) {
 		CoasterTrain &train = this->trains[i];
 		if (train.cars.empty()) break;
-		train.OnAnimate(delay);
+		train.OnAnimate(this->offscreen_delay, this->offscreen_steps);
 	}
+	this->offscreen_delay = 0;
+	this->offscreen_steps = 0;
 }
 
 void CoasterInstance::TestRide()
@@ -946,7 +963,38 @@ void CoasterInstance::TestRide()
 		this->CloseRide();
 		this->ReinitializeTrains(true);
 	}
+	if (this->state == RIS_OPEN) _rides_manager.RideClosed();  // A testing ride does not count as open.
 	this->state = RIS_TESTING;
+	this->RunFastTest();
+}
+
+static const int FAST_TEST_STEP = 30;                    ///< Simulation step of the accelerated test run, in milliseconds (a normal frame).
+static const int FAST_TEST_MAX_TIME = 10 * 60 * 1000;    ///< Upper bound of simulated time for the accelerated test run, in milliseconds.
+
+/**
+ * Simulate the first train circuit at full simulation speed, without rendering or frame pacing,
+ * so the intensity statistics and ride ratings are available immediately instead of after the
+ * train has driven the circuit in real time. The trains are reset afterwards, the visible test
+ * run proceeds normally.
+ */
+void CoasterInstance::RunFastTest()
+{
+	if (this->number_of_trains < 1 || this->trains[0].cars.empty()) return;
+	const CoasterTrain &first_train = this->trains[0];
+	bool left_station = false;
+	for (int elapsed = 0; elapsed < FAST_TEST_MAX_TIME && this->state == RIS_TESTING; elapsed += FAST_TEST_STEP) {
+		for (uint i = 0; i < lengthof(this->trains); i++) {
+			CoasterTrain &train = this->trains[i];
+			if (train.cars.empty()) break;
+			train.OnAnimate(FAST_TEST_STEP);
+		}
+		if (first_train.station_policy == TSP_NO_STATION) {
+			left_station = true;
+		} else if (left_station) {
+			break;  // The train completed its circuit and re-entered a station, which recalculated the ratings.
+		}
+	}
+	if (this->state == RIS_TESTING) this->ReinitializeTrains(true);  // A crash during the fast run closes the ride instead.
 }
 
 void CoasterInstance::OpenRide()
@@ -963,6 +1011,11 @@ void CoasterInstance::OpenRide()
 void CoasterInstance::CloseRide()
 {
 	this->intensity_statistics.clear();
+	this->stat_speed_sum = 0;
+	this->stat_vg_speed_sum = 0;
+	this->stat_hg_speed_sum = 0;
+	this->stat_valid_points = 0;
+	this->scenery_bonus_dirty = true;
 	for (uint i = 0; i < lengthof(this->trains); i++) {
 		CoasterTrain &train = this->trains[i];
 		train.back_position = 0;
@@ -979,22 +1032,19 @@ void CoasterInstance::CloseRide()
 void CoasterInstance::OnNewMonth()
 {
 	RideInstance::OnNewMonth();
+	this->scenery_bonus_dirty = true; // Pick up scenery built near the track since last month.
+	this->total_return_cost = 0;
 	for (int i = 0; i < this->capacity; ++i) {
 		if (this->pieces[i].piece != nullptr) {
 			this->pieces[i].OnNewMonth();
+			this->total_return_cost += this->pieces[i].return_cost;
 		}
 	}
 }
 
 Money CoasterInstance::ComputeReturnCost() const
 {
-	Money m(0);
-	for (int i = 0; i < this->capacity; ++i) {
-		if (this->pieces[i].piece != nullptr) {
-			m += this->pieces[i].return_cost;
-		}
-	}
-	return m;
+	return this->total_return_cost;
 }
 
 XYZPoint16 CoasterInstance::RepresentativeLocation() const
@@ -1194,8 +1244,8 @@ void CoasterInstance::RemoveStationsFromWorld()
 				const int8 height = (p == s.entrance) ? RideEntranceExitType::entrance_height : RideEntranceExitType::exit_height;
 				for (int16 h = 0; h < height; ++h) {
 					Voxel *voxel = _world.GetCreateVoxel(p + XYZPoint16(0, 0, h), false);
-					if (voxel != nullptr && voxel->instance != SRI_FREE) {
-						assert(voxel->instance == index);
+					if (voxel != nullptr && voxel->GetInstance() != SRI_FREE) {
+						assert(voxel->GetInstance() == index);
 						voxel->ClearInstances();
 					}
 				}
@@ -1217,7 +1267,7 @@ void CoasterInstance::InsertStationsIntoWorld()
 				for (int16 h = 0; h < height; ++h) {
 					const XYZPoint16 pos = p + XYZPoint16(0, 0, h);
 					Voxel *voxel = _world.GetCreateVoxel(pos, true);
-					assert(voxel != nullptr && voxel->instance == SRI_FREE);
+					assert(voxel != nullptr && voxel->GetInstance() == SRI_FREE);
 					voxel->SetInstance(index);
 					voxel->SetInstanceData(ENTRANCE_OR_EXIT);
 				}
@@ -1227,6 +1277,49 @@ void CoasterInstance::InsertStationsIntoWorld()
 	}
 }
 
+/**
+ * Pack a voxel coordinate into a single integer for use as key in the piece lookup maps.
+ * @param vox Voxel coordinate to pack.
+ * @return The packed coordinate.
+ */
+static inline uint32 PackPieceVoxel(const XYZPoint16 &vox)
+{
+	return (static_cast<uint32>(vox.x & 0xFFF) << 20) | (static_cast<uint32>(vox.y & 0xFFF) << 8) | static_cast<uint8>(vox.z);
+}
+
+/** Rebuild the voxel-keyed and arc-length piece lookup structures from the #pieces array. */
+void CoasterInstance::RebuildPieceIndex()
+{
+	this->piece_entries.clear();
+	this->piece_exits.clear();
+	this->pieces_by_distance.clear();
+	for (int i = 0; i < this->capacity; i++) {
+		const PositionedTrackPiece &ptp = this->pieces[i];
+		if (ptp.piece == nullptr) continue;
+		this->piece_entries.emplace(PackPieceVoxel(ptp.base_voxel), i);
+		this->piece_exits.emplace(PackPieceVoxel(ptp.GetEndXYZ()), i);
+		this->pieces_by_distance.push_back(i);
+	}
+	std::sort(this->pieces_by_distance.begin(), this->pieces_by_distance.end(),
+			[this](int a, int b) { return this->pieces[a].distance_base < this->pieces[b].distance_base; });
+	this->piece_index_dirty = false;
+}
+
+/**
+ * Map a position along the track to the positioned track piece containing it.
+ * @param position Position along the track, in 1/256 pixels.
+ * @return The piece containing the position, or \c nullptr if no track is placed.
+ * @pre The placed pieces form a ride (#MakePositionedPiecesLooping has assigned the distances).
+ */
+const PositionedTrackPiece *CoasterInstance::FindPieceAtDistance(uint32 position)
+{
+	if (this->piece_index_dirty) this->RebuildPieceIndex();
+	if (this->pieces_by_distance.empty()) return nullptr;
+	const auto iter = std::upper_bound(this->pieces_by_distance.begin(), this->pieces_by_distance.end(), position,
+			[this](uint32 pos, int index) { return pos < this->pieces[index].distance_base; });
+	return &this->pieces[*(iter == this->pieces_by_distance.begin() ? iter : iter - 1)];
+}
+
 /**
  * Find the first placed track piece at a given position with a given entry connection.
  * @param vox Required voxel position.
@@ -1239,10 +1332,15 @@ int CoasterInstance::FindSuccessorPiece(const XYZPoint16 &vox, uint8 entry_conne
 {
 	if (start < 0) start = 0;
 	if (end > MAX_PLACED_TRACK_PIECES) end = MAX_PLACED_TRACK_PIECES;
-	for (; start < end; start++) {
-		if (this->pieces[start].CanBeSuccessor(vox, entry_connect)) return start;
+	if (this->piece_index_dirty) this->RebuildPieceIndex();
+	int best = -1;
+	const auto range = this->piece_entries.equal_range(PackPieceVoxel(vox));
+	for (auto iter = range.first; iter != range.second; ++iter) {
+		const int i = iter->second;
+		if (i < start || i >= end || (best >= 0 && i >= best)) continue;
+		if (this->pieces[i].CanBeSuccessor(vox, entry_connect)) best = i;
 	}
-	return -1;
+	return best;
 }
 
 /**
@@ -1262,12 +1360,15 @@ int CoasterInstance::FindSuccessorPiece(const PositionedTrackPiece &placed)
  */
 int CoasterInstance::FindPredecessorPiece(const PositionedTrackPiece &placed)
 {
-	for (int i = 0; i < this->capacity; i++) {
-		if (placed.CanBeSuccessor(this->pieces[i])) {
-			return i;
-		}
+	if (this->piece_index_dirty) this->RebuildPieceIndex();
+	int best = -1;
+	const auto range = this->piece_exits.equal_range(PackPieceVoxel(placed.base_voxel));
+	for (auto iter = range.first; iter != range.second; ++iter) {
+		const int i = iter->second;
+		if (best >= 0 && i >= best) continue;
+		if (placed.CanBeSuccessor(this->pieces[i])) best = i;
 	}
-	return -1;
+	return best;
 }
 
 /**
@@ -1293,6 +1394,7 @@ bool CoasterInstance::MakePositionedPiecesLooping(bool *modified)
 		}
 		std::swap(this->pieces[count], *ptp);
 		if (modified != nullptr) *modified = true;
+		this->piece_index_dirty = true;
 		ptp->piece = nullptr;
 		count++;
 	}
@@ -1304,6 +1406,7 @@ bool CoasterInstance::MakePositionedPiecesLooping(bool *modified)
 	uint32 distance = 0;
 	if (ptp->distance_base != distance) {
 		if (modified != nullptr) *modified = true;
+		this->piece_index_dirty = true;
 		ptp->distance_base = distance;
 	}
 	distance += ptp->piece->piece_length;
@@ -1315,9 +1418,11 @@ bool CoasterInstance::MakePositionedPiecesLooping(bool *modified)
 		if (i != j) {
 			std::swap(*ptp, this->pieces[j]); // Make piece 'j' the next positioned piece.
 			if (modified != nullptr) *modified = true;
+			this->piece_index_dirty = true;
 		}
 		if (ptp->distance_base != distance) {
 			if (modified != nullptr) *modified = true;
+			this->piece_index_dirty = true;
 			ptp->distance_base = distance;
 		}
 		distance += ptp->piece->piece_length;
@@ -1340,6 +1445,10 @@ int CoasterInstance::AddPositionedPiece(const PositionedTrackPiece &placed)
 		if (this->pieces[i].piece == nullptr) {
 			this->pieces[i] = placed;
 			this->pieces[i].return_cost = -this->pieces[i].piece->cost;
+			this->total_return_cost += this->pieces[i].return_cost;
+			this->piece_index_dirty = true;
+			this->scenery_bonus_dirty = true;
+			this->scenery_scan_next = -1;  // Restart any rescan in progress, it may have passed this slot already.
 			if (placed.piece->IsStartingPiece()) this->UpdateStations();
 			return i;
 		}
@@ -1347,6 +1456,37 @@ int CoasterInstance::AddPositionedPiece(const PositionedTrackPiece &placed)
 	return -1;
 }
 
+/**
+ * Try to add a whole sequence of positioned track pieces at once, e.g. when placing a saved design.
+ * The lookup structures and station data are refreshed once at the end instead of after every piece.
+ * @param placed New positioned track pieces to add.
+ * @return Index of the last added piece, or \c -1 if not all pieces could be added.
+ * @pre The caller has verified that the pieces can be placed.
+ */
+int CoasterInstance::AddPositionedPieces(const std::vector<PositionedTrackPiece> &placed)
+{
+	int free_slot = 0;
+	int last = -1;
+	bool stations_changed = false;
+	for (const PositionedTrackPiece &ptp : placed) {
+		if (ptp.piece == nullptr || !ptp.IsOnWorld()) return -1;
+		while (free_slot < this->capacity && this->pieces[free_slot].piece != nullptr) free_slot++;
+		if (free_slot == this->capacity) return -1;
+		this->pieces[free_slot] = ptp;
+		this->pieces[free_slot].return_cost = -ptp.piece->cost;
+		this->total_return_cost += this->pieces[free_slot].return_cost;
+		stations_changed |= ptp.piece->IsStartingPiece();
+		last = free_slot;
+	}
+	if (last >= 0) {
+		this->piece_index_dirty = true;
+		this->scenery_bonus_dirty = true;
+		this->scenery_scan_next = -1;
+		if (stations_changed) this->UpdateStations();
+	}
+	return last;
+}
+
 /**
  * Try to remove a positioned track piece from the coaster instance.
  * @param piece Positioned track piece to remove.
@@ -1356,7 +1496,11 @@ void CoasterInstance::RemovePositionedPiece(PositionedTrackPiece &piece)
 	assert(piece.piece != nullptr);
 	this->RemoveTrackPieceInWorld(piece);
 	if (piece.piece->IsStartingPiece()) this->UpdateStations();
+	this->total_return_cost -= piece.return_cost;
 	piece.piece = nullptr;
+	this->piece_index_dirty = true;
+	this->scenery_bonus_dirty = true;
+	this->scenery_scan_next = -1;  // Restart any rescan in progress.
 }
 
 /**
@@ -1827,6 +1971,49 @@ bool CoasterInstance::CanPlaceEntranceOrExit(const XYZPoint16 &pos, const bool e
 	return true;
 }
 
+/**
+ * Collect all voxels where an entrance or exit might be placed, based on the station geometry alone.
+ * The set depends only on the track layout, so it can be computed once when placement starts;
+ * each candidate must still pass #CanPlaceEntranceOrExit against the current world before use.
+ * @param candidates [out] Set to fill with the candidate positions.
+ */
+void CoasterInstance::GetEntranceExitCandidates(std::set<XYZPoint16> *candidates) const
+{
+	candidates->clear();
+	for (const CoasterStation &s : this->stations) {
+		if (s.locations.empty() || s.direction == INVALID_EDGE) continue;
+
+		XYZPoint16 min_pos = s.locations[0];
+		XYZPoint16 max_pos = min_pos;
+		for (const XYZPoint16 &p : s.locations) {
+			min_pos.x = std::min(min_pos.x, p.x);
+			min_pos.y = std::min(min_pos.y, p.y);
+			min_pos.z = std::min(min_pos.z, p.z);
+			max_pos.x = std::max(max_pos.x, p.x);
+			max_pos.y = std::max(max_pos.y, p.y);
+		}
+		switch (s.direction) {
+			case EDGE_NE:
+			case EDGE_SW:
+				for (int16 x = min_pos.x; x <= max_pos.x; x++) {
+					candidates->insert(XYZPoint16(x, s.locations[0].y - 1, min_pos.z));
+					candidates->insert(XYZPoint16(x, s.locations[0].y + 1, min_pos.z));
+				}
+				break;
+
+			case EDGE_NW:
+			case EDGE_SE:
+				for (int16 y = min_pos.y; y <= max_pos.y; y++) {
+					candidates->insert(XYZPoint16(s.locations[0].x - 1, y, min_pos.z));
+					candidates->insert(XYZPoint16(s.locations[0].x + 1, y, min_pos.z));
+				}
+				break;
+
+			default: NOT_REACHED();
+		}
+	}
+}
+
 /**
  * Place an entrance or exit at the given location.
  * @param pos Absolute voxel in the world.
@@ -1867,69 +2054,100 @@ void CoasterInstance::SampleStatistics(uint32 point, const bool valid, const int
 	point /= COASTER_INTENSITY_STATISTICS_SAMPLING_PRECISION;
 	auto it = this->intensity_statistics.find(point);
 	if (it == this->intensity_statistics.end()) {
-		this->intensity_statistics.emplace(std::make_pair(point, CoasterIntensityStatistics{valid, 1, speed, vg, hg}));
+		auto res = this->intensity_statistics.emplace(std::make_pair(point, CoasterIntensityStatistics{valid, 1, speed, vg, hg}));
+		if (valid) this->ApplyStatisticsPoint(res.first->second, 1);
 	} else {
+		if (it->second.valid) this->ApplyStatisticsPoint(it->second, -1);
 		it->second.valid &= valid;
 		it->second.speed        = (it->second.precision * it->second.speed        + speed) / (it->second.precision + 1);
 		it->second.vertical_g   = (it->second.precision * it->second.vertical_g   + vg   ) / (it->second.precision + 1);
 		it->second.horizontal_g = (it->second.precision * it->second.horizontal_g + hg   ) / (it->second.precision + 1);
 		it->second.precision++;
+		if (it->second.valid) this->ApplyStatisticsPoint(it->second, 1);
 	}
 }
 
-void CoasterInstance::RecalculateRatings()
+/**
+ * Add or remove the contribution of one statistics point to the streaming rating sums.
+ * @param stats The statistics point.
+ * @param sign \c 1 to add the contribution, \c -1 to remove it.
+ */
+void CoasterInstance::ApplyStatisticsPoint(const CoasterIntensityStatistics &stats, int sign)
 {
-	uint64 exc = 100;  // Excitement rating in percent.
-	uint64 iny = 100;  // Intensity rating in percent.
-	uint64 nau = 100;  // Nausea rating in percent.
-	uint32 statpoints = 0;
-	for (const auto &pair : this->intensity_statistics) {
-		if (!pair.second.valid) continue;
-		exc += std::abs(pair.second.speed);
-		iny += std::abs(pair.second.speed);
-		iny += std::abs(pair.second.horizontal_g * pair.second.speed);
-		iny += std::abs(pair.second.vertical_g   * pair.second.speed);
-		nau += std::abs(pair.second.vertical_g   * pair.second.speed);
-		statpoints++;
-	}
-	if (statpoints == 0) {
-		this->excitement_rating = RATING_NOT_YET_CALCULATED;
-		this->intensity_rating = RATING_NOT_YET_CALCULATED;
-		this->nausea_rating = RATING_NOT_YET_CALCULATED;
-		return;
-	}
+	this->stat_speed_sum    += sign * static_cast<int64>(std::abs(stats.speed));
+	this->stat_hg_speed_sum += sign * static_cast<int64>(std::abs(stats.horizontal_g * stats.speed));
+	this->stat_vg_speed_sum += sign * static_cast<int64>(std::abs(stats.vertical_g   * stats.speed));
+	this->stat_valid_points += sign;
+}
 
-	iny /= statpoints;
-	nau /= statpoints;
-	exc /= statpoints;
+static const int SCENERY_SCAN_PIECES_PER_TICK = 8;  ///< Number of track pieces the incremental scenery rescan examines each tick.
 
-	std::set<XYZPoint16> considered_locations;
+/**
+ * Advance the incremental rescan of the excitement bonus for terrain, scenery, and other rides
+ * near the track by a few pieces. The last completed bonus stays in use until the rescan finishes,
+ * so a complex layout never stalls a frame on the full walk.
+ */
+void CoasterInstance::StepSceneryRescan()
+{
+	if (this->scenery_scan_next < 0) {  // Start a new scan.
+		this->scenery_scan_next = 0;
+		this->scenery_scan_sum = 0;
+		this->scenery_scan_considered.clear();
+	}
 	const uint16 index = this->GetIndex();
-	const int start_piece = GetFirstPlacedTrackPiece();
-	for (int p = start_piece;;) {
+	int budget = SCENERY_SCAN_PIECES_PER_TICK;
+	while (budget > 0 && this->scenery_scan_next < this->capacity) {
+		const PositionedTrackPiece &ptp = this->pieces[this->scenery_scan_next];
+		this->scenery_scan_next++;
+		if (ptp.piece == nullptr) continue;
+		budget--;
 		for (int dx = -2; dx <= 2; dx++) {
 			for (int dy = -2; dy <= 2; dy++) {
-				if (!IsVoxelstackInsideWorld(this->pieces[p].base_voxel.x + dx, this->pieces[p].base_voxel.y + dy)) continue;
+				if (!IsVoxelstackInsideWorld(ptp.base_voxel.x + dx, ptp.base_voxel.y + dy)) continue;
 				for (int dh = -4; dh <= 2; dh++) {
 					XYZPoint16 pos(dx, dy, dh);
-					pos += this->pieces[p].base_voxel;
+					pos += ptp.base_voxel;
 
-					if (considered_locations.count(pos)) continue;
-					considered_locations.insert(pos);
+					if (this->scenery_scan_considered.count(pos)) continue;
+					this->scenery_scan_considered.insert(pos);
 
 					Voxel *voxel = _world.GetCreateVoxel(pos, false);
 					if (voxel == nullptr) continue;
 
-					if (IsImplodedSteepSlope(voxel->GetGroundSlope()))                 exc += 2;
-					if (voxel->instance == SRI_SCENERY)                                exc += 4;
-					if (voxel->instance >= SRI_FULL_RIDES && voxel->instance != index) exc += 7;
+					if (IsImplodedSteepSlope(voxel->GetGroundSlope()))                 this->scenery_scan_sum += 2;
+					if (voxel->GetInstance() == SRI_SCENERY)                                this->scenery_scan_sum += 4;
+					if (voxel->GetInstance() >= SRI_FULL_RIDES && voxel->GetInstance() != index) this->scenery_scan_sum += 7;
 					/* \todo Also give a bonus for accurately mowed lawns and building near water. */
 				}
 			}
 		}
-		p = FindSuccessorPiece(this->pieces[p]);
-		if (p < 0 || p == start_piece) break;
 	}
+	if (this->scenery_scan_next >= this->capacity) {  // The scan is complete, publish the new bonus.
+		this->scenery_bonus = this->scenery_scan_sum;
+		this->scenery_bonus_dirty = false;
+		this->scenery_scan_next = -1;
+		this->scenery_scan_considered.clear();
+		this->RecalculateRatings();
+	}
+}
+
+void CoasterInstance::RecalculateRatings()
+{
+	if (this->stat_valid_points == 0) {
+		this->excitement_rating = RATING_NOT_YET_CALCULATED;
+		this->intensity_rating = RATING_NOT_YET_CALCULATED;
+		this->nausea_rating = RATING_NOT_YET_CALCULATED;
+		return;
+	}
+
+	/* Ratings in percent, derived from the streaming sums kept by #SampleStatistics. */
+	uint64 exc = (100 + this->stat_speed_sum) / this->stat_valid_points;  // Excitement rating.
+	uint64 iny = (100 + this->stat_speed_sum + this->stat_hg_speed_sum + this->stat_vg_speed_sum) / this->stat_valid_points;  // Intensity rating.
+	uint64 nau = (100 + this->stat_vg_speed_sum) / this->stat_valid_points;  // Nausea rating.
+
+	/* While a rescan is in progress, the last completed bonus is used; #StepSceneryRescan
+	 * refreshes the ratings once the new bonus is available. */
+	exc += this->scenery_bonus;
 
 	exc -= std::min(exc / 2, nau);
 	exc -= std::min(exc / 2, iny);
@@ -1966,11 +2184,13 @@ void CoasterInstance::Load(Loader &ldr)
 		if (piece != nullptr) {
 			this->pieces[i].piece = piece;
 			this->pieces[i].Load(ldr);
+			this->total_return_cost += this->pieces[i].return_cost;
 			this->PlaceTrackPieceInWorld(this->pieces[i]);
 		} else {
 			throw LoadingError("Invalid track piece.");
 		}
 	}
+	this->piece_index_dirty = true;
 
 	this->number_of_trains = ldr.GetWord();
 	this->cars_per_train = ldr.GetWord();
@@ -2011,7 +2231,8 @@ void CoasterInstance::Load(Loader &ldr)
 		const int32 speed = ldr.GetLong();
 		const int32 vg = ldr.GetLong();
 		const int32 hg = ldr.GetLong();
-		this->intensity_statistics.emplace(std::make_pair(point, CoasterIntensityStatistics{valid, precision, speed, vg, hg}));
+		auto res = this->intensity_statistics.emplace(std::make_pair(point, CoasterIntensityStatistics{valid, precision, speed, vg, hg}));
+		if (valid) this->ApplyStatisticsPoint(res.first->second, 1);
 	}
 
 	this->InsertStationsIntoWorld();
@@ -2105,13 +2326,15 @@ void CoasterInstance::SaveDesign(const std::string &file, const std::string &des
 	ct->designs.push_back(design);
 
 	try {
-		FILE *fp = fopen(file.c_str(), "wb");
-		if (fp == nullptr) throw LoadingError("Could not open file for writing");
-
-		Saver svr(fp);
+		Saver svr;
 		design.Save(svr);
+		const std::vector<uint8> data = svr.TakeBuffer();
 
+		FILE *fp = fopen(file.c_str(), "wb");
+		if (fp == nullptr) throw LoadingError("Could not open file for writing");
+		const bool written = fwrite(data.data(), 1, data.size(), fp) == data.size();
 		fclose(fp);
+		if (!written) throw LoadingError("Could not write to file");
 	} catch (const LoadingError &e) {
 		fprintf(stderr, "WARNING: Error saving track design to '%s': %s\n", file.c_str(), e.what());
 	}
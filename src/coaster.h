@@ -12,6 +12,7 @@
 
 #include <array>
 #include <map>
+#include <set>
 #include <vector>
 #include "map.h"
 #include "person.h"
@@ -80,6 +81,7 @@ public:
 	std::vector<const TrackVoxel *> voxels; ///< All voxels of all track pieces (do not free the track voxels, #pieces owns this data).
 
 	std::vector<ConstTrackPiecePtr> pieces; ///< Track pieces of the coaster.
+	std::map<std::string, int> piece_name_index; ///< Internal name of each track piece to its index in #pieces.
 
 private:
 	const CarType *GetDefaultCarType() const;
@@ -164,7 +166,7 @@ public:
 
 	void SetLength(int length);
 
-	void OnAnimate(int delay);
+	void OnAnimate(int delay, int steps = 1);
 
 	void Load(Loader &ldr);
 	void Save(Saver &svr);
@@ -224,6 +226,7 @@ public:
 	}
 
 	void TestRide();
+	void RunFastTest();
 	void OpenRide() override;
 	void RecalculateRatings() override;
 
@@ -244,16 +247,20 @@ public:
 	bool MakePositionedPiecesLooping(bool *modified);
 	int GetFirstPlacedTrackPiece() const;
 	int AddPositionedPiece(const PositionedTrackPiece &placed);
+	int AddPositionedPieces(const std::vector<PositionedTrackPiece> &placed);
 	void RemovePositionedPiece(PositionedTrackPiece &piece);
 
 	int FindSuccessorPiece(const XYZPoint16 &vox, uint8 entry_connect, int start = 0, int end = MAX_PLACED_TRACK_PIECES);
 	int FindSuccessorPiece(const PositionedTrackPiece &placed);
 	int FindPredecessorPiece(const PositionedTrackPiece &placed);
+	const PositionedTrackPiece *FindPieceAtDistance(uint32 position);
+	void RebuildPieceIndex();
 	void UpdateStations();
 	void InitializeStation(CoasterStation&) const;
 	bool IsInStation(uint32 pos, const CoasterStation&) const;
 	uint32 PositionRelativeTo(uint32 pos, uint32 offset) const;
 	bool CanPlaceEntranceOrExit(const XYZPoint16 &pos, bool entrance, const CoasterStation *station) const;
+	void GetEntranceExitCandidates(std::set<XYZPoint16> *candidates) const;
 	bool PlaceEntranceOrExit(const XYZPoint16 &pos, bool entrance, CoasterStation *station);
 	bool NeedsEntrance() const;
 	bool NeedsExit() const;
@@ -267,6 +274,9 @@ public:
 	void PlaceTrackPieceInWorld(const PositionedTrackPiece &piece);
 	void RemoveTrackPieceInWorld(const PositionedTrackPiece &piece);
 
+	bool IsOnScreen() const;
+	bool NeedsFullPhysics() const;
+
 	uint32 GetShortestStation() const;
 	uint32 GetTrainLength(int cars_per_train) const;
 	uint32 GetTrainSpacing() const;
@@ -277,6 +287,8 @@ public:
 	void ReinitializeTrains(bool test_mode);
 	void Crash(CoasterTrain *t1, CoasterTrain *t2);
 	void SampleStatistics(uint32 point, bool valid, int32 speed, int32 vg, int32 hg);
+	void ApplyStatisticsPoint(const CoasterIntensityStatistics &stats, int sign);
+	void StepSceneryRescan();
 
 	void Load(Loader &ldr) override;
 	void Save(Saver &svr) override;
@@ -290,6 +302,7 @@ public:
 	}
 
 	std::unique_ptr<PositionedTrackPiece[]> pieces; ///< Positioned track pieces.
+	Money total_return_cost;      ///< Summed return cost of all placed pieces, kept in sync at piece addition and removal.
 	int capacity;                 ///< Number of entries in the #pieces.
 	uint32 coaster_length;        ///< Total length of the roller coaster track (in 1/256 pixels).
 	int number_of_trains;         ///< Current number of trains.
@@ -301,7 +314,22 @@ public:
 	XYZPoint16 temp_exit_pos;              ///< Temporary location of one of the ride's exit while the user is moving the exit.
 	int max_idle_duration;                 ///< Maximum duration how long a train may wait in a station in milliseconds.
 	int min_idle_duration;                 ///< Minimum duration how long a train may wait in a station in milliseconds.
+	int offscreen_delay;                   ///< Milliseconds of simulation time not yet applied to the trains (off-screen level-of-detail).
+	int offscreen_steps;                   ///< Number of animation frames accumulated in #offscreen_delay.
+	bool piece_index_dirty;                ///< Whether the piece lookup structures below need a rebuild.
+	std::multimap<uint32, int> piece_entries;  ///< Packed entry voxel of each placed piece to its index in #pieces.
+	std::multimap<uint32, int> piece_exits;    ///< Packed exit voxel of each placed piece to its index in #pieces.
+	std::vector<int> pieces_by_distance;       ///< Indices of the placed pieces, sorted by #PositionedTrackPiece::distance_base.
 	std::map<uint32, CoasterIntensityStatistics> intensity_statistics;  ///< Intensity along the track.
+	int64 stat_speed_sum;     ///< Running sum of \c abs(speed) over the valid statistics points.
+	int64 stat_vg_speed_sum;  ///< Running sum of \c abs(vertical_g*speed) over the valid statistics points.
+	int64 stat_hg_speed_sum;  ///< Running sum of \c abs(horizontal_g*speed) over the valid statistics points.
+	uint32 stat_valid_points; ///< Number of valid statistics points in #intensity_statistics.
+	uint64 scenery_bonus;     ///< Cached excitement bonus from terrain, scenery, and rides near the track.
+	bool scenery_bonus_dirty; ///< Whether #scenery_bonus needs to be recomputed.
+	int scenery_scan_next;    ///< Next index in #pieces of the incremental scenery rescan (\c -1 when no rescan is in progress).
+	uint64 scenery_scan_sum;  ///< Bonus accumulated so far by the incremental scenery rescan.
+	std::set<XYZPoint16> scenery_scan_considered;  ///< Voxels already counted by the incremental scenery rescan.
 };
 
 void LoadCoasterPlatform(RcdFileReader *rcd_file);
@@ -267,6 +267,7 @@ private:
 
 	void ChooseEntranceExitClicked(bool entrance);
 	RideMouseMode entrance_exit_placement;
+	std::set<XYZPoint16> placement_candidates; ///< Voxels where an entrance/exit might go, precomputed from the station geometry.
 	bool is_placing_entrance;
 	GraphMode graph_mode;
 };
@@ -625,8 +626,10 @@ void CoasterInstanceWindow::ChooseEntranceExitClicked(const bool entrance)
 
 	if (this->selector == nullptr || (this->is_placing_entrance != entrance)) {
 		this->is_placing_entrance = entrance;
+		this->ci->GetEntranceExitCandidates(&this->placement_candidates);
 		SetSelector(&entrance_exit_placement);
 	} else {
+		this->placement_candidates.clear();
 		SetSelector(nullptr);
 	}
 
@@ -708,8 +711,14 @@ void CoasterInstanceWindow::SelectorMouseMoveEvent(Viewport *vp, const Point16 &
 	for (int z = WORLD_Z_SIZE - 1; z >= 0; z--) {
 		const int dz = (z - (vp->view_pos.z / 256)) / 2;
 		const XYZPoint16 location(world_pos.x / 256 + dz * dx, world_pos.y / 256 + dz * dy, z);
+		/* Cheap precomputed geometry test first, then the full check against the current world state. */
+		if (this->placement_candidates.count(location) == 0) continue;
 		if (!this->ci->CanPlaceEntranceOrExit(location, this->is_placing_entrance, nullptr)) continue;
 
+		/* The selector still displays this location, don't rebuild it every mouse move. */
+		const XYZPoint16 &displayed = this->is_placing_entrance ? this->ci->temp_entrance_pos : this->ci->temp_exit_pos;
+		if (displayed == location && this->entrance_exit_placement.area.width == 1) return;
+
 		if (this->is_placing_entrance) {
 			this->ci->temp_entrance_pos = location;
 		} else {
@@ -1015,6 +1024,20 @@ private:
 
 	TrackPieceMouseMode piece_selector;                ///< Selector for displaying new track pieces.
 	std::shared_ptr<TrackPiece> design_preview_piece;  ///< Pseudo-TrackPiece to represent the selected design, if any.
+
+	/** Assembled preview imagery of the displayed track piece, rebuilt when the piece or view orientation changes. */
+	mutable struct {
+		const TrackPiece *piece = nullptr;  ///< Piece the preview was assembled for, \c nullptr if none yet.
+		int orientation = -1;               ///< View orientation the preview was assembled for.
+		std::map<XYZPoint16, std::vector<const ImageData *>> sprites;  ///< Sprites to blit, by voxel offset.
+	} preview_cache;
+
+	/** Cached result of testing all track pieces against one connection state. */
+	struct ConnectionFilter {
+		std::vector<bool> selectable;  ///< Per-piece result of the connection test.
+		uint directions;               ///< Build directions of initial pieces (only for initial placement states).
+	};
+	std::map<uint, ConnectionFilter> connection_filters;  ///< Connection filter results, keyed by connection state. The piece set never changes, so entries stay valid.
 };
 
 /**
@@ -1181,22 +1204,28 @@ void CoasterBuildWindow::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid)
 	const Viewport *vp = _window_manager.GetViewport();
 	const int orient = this->design < 0 ? vp->orientation : VOR_NORTH;  // \todo Design pieces are assembled artifically and currently have only one view.
 
-	/* Render the track piece's preview. */
-	std::map<XYZPoint16, std::vector<const ImageData*>> sprites;
-	for (const auto &tv : this->piece_selector.pos_piece.piece->track_voxels) {
-		const CoasterPlatform *platform = tv->HasPlatform() ? &_coaster_platforms[this->ci->GetCoasterType()->platform_type] : nullptr;
-		int platform_orient = (tv->GetPlatformDirection() + 4 - orient) % 4;
-
-		if (platform != nullptr) sprites[tv->dxyz].push_back(platform->bg->GetSprite(0, 0, platform_orient, DEFAULT_ZOOM));
-
-		const ImageData *img = tv->bg == nullptr ? nullptr : tv->bg->GetSprite(0, 0, orient, DEFAULT_ZOOM);
-		if (img != nullptr) sprites[tv->dxyz].push_back(img);
-		img = tv->fg == nullptr ? nullptr : tv->fg->GetSprite(0, 0, orient, DEFAULT_ZOOM);
-		if (img != nullptr) sprites[tv->dxyz].push_back(img);
-
-		if (platform != nullptr) sprites[tv->dxyz].push_back(platform->fg->GetSprite(0, 0, platform_orient, DEFAULT_ZOOM));
+	/* Assemble the track piece's preview, unless it is still cached from an earlier draw. */
+	const TrackPiece *piece = this->piece_selector.pos_piece.piece.get();
+	if (this->preview_cache.piece != piece || this->preview_cache.orientation != orient) {
+		this->preview_cache.piece = piece;
+		this->preview_cache.orientation = orient;
+		this->preview_cache.sprites.clear();
+		std::map<XYZPoint16, std::vector<const ImageData*>> &sprites = this->preview_cache.sprites;
+		for (const auto &tv : piece->track_voxels) {
+			const CoasterPlatform *platform = tv->HasPlatform() ? &_coaster_platforms[this->ci->GetCoasterType()->platform_type] : nullptr;
+			int platform_orient = (tv->GetPlatformDirection() + 4 - orient) % 4;
+
+			if (platform != nullptr) sprites[tv->dxyz].push_back(platform->bg->GetSprite(0, 0, platform_orient, DEFAULT_ZOOM));
+
+			const ImageData *img = tv->bg == nullptr ? nullptr : tv->bg->GetSprite(0, 0, orient, DEFAULT_ZOOM);
+			if (img != nullptr) sprites[tv->dxyz].push_back(img);
+			img = tv->fg == nullptr ? nullptr : tv->fg->GetSprite(0, 0, orient, DEFAULT_ZOOM);
+			if (img != nullptr) sprites[tv->dxyz].push_back(img);
+
+			if (platform != nullptr) sprites[tv->dxyz].push_back(platform->fg->GetSprite(0, 0, platform_orient, DEFAULT_ZOOM));
+		}
 	}
-	for (const auto &pair : sprites) {
+	for (const auto &pair : this->preview_cache.sprites) {
 		const Point32 p(
 				x + wid->pos.width  / 2 + (pair.first.y - pair.first.x               ) * TileWidth(vp->zoom) / 2,
 				y + wid->pos.height / 2 + (pair.first.x + pair.first.y - pair.first.z) * TileHeight(vp->zoom));
@@ -1297,28 +1326,42 @@ void CoasterBuildWindow::SetupSelection()
 		bool selectable[1024]; // Arbitrary limit on the number of non-placed track pieces.
 		uint count = ct->pieces.size();
 		if (count > lengthof(selectable)) count = lengthof(selectable);
-		/* Round 1: Select on connection or initial placement. */
-		for (uint i = 0; i < count; i++) {
-			ConstTrackPiecePtr piece = ct->pieces[i];
-			bool avail = true;
-			if (this->cur_piece != nullptr) {
-				/* Connect after or before 'cur_piece'. */
-				if (this->cur_after) {
-					if (piece->entry_connect != this->cur_piece->piece->exit_connect) avail = false;
-				} else {
-					if (piece->exit_connect != this->cur_piece->piece->entry_connect) avail = false;
-				}
-			} else {
-				/* Initial placement. */
-				if (!piece->IsStartingPiece()) {
-					avail = false;
+
+		/* Round 1: Select on connection or initial placement.
+		 * The outcome only depends on the connection state, so it is computed once per state and cached. */
+		const uint filter_key = (this->cur_piece == nullptr) ? this->build_direction
+				: this->cur_after ? 0x100 + this->cur_piece->piece->exit_connect
+				                  : 0x200 + this->cur_piece->piece->entry_connect;
+		auto cached = this->connection_filters.find(filter_key);
+		if (cached == this->connection_filters.end()) {
+			ConnectionFilter filter;
+			filter.directions = 0;
+			filter.selectable.resize(count);
+			for (uint i = 0; i < count; i++) {
+				ConstTrackPiecePtr piece = ct->pieces[i];
+				bool avail = true;
+				if (this->cur_piece != nullptr) {
+					/* Connect after or before 'cur_piece'. */
+					if (this->cur_after) {
+						if (piece->entry_connect != this->cur_piece->piece->exit_connect) avail = false;
+					} else {
+						if (piece->exit_connect != this->cur_piece->piece->entry_connect) avail = false;
+					}
 				} else {
-					directions |= 1 << piece->GetStartDirection();
-					if (piece->GetStartDirection() != this->build_direction) avail = false;
+					/* Initial placement. */
+					if (!piece->IsStartingPiece()) {
+						avail = false;
+					} else {
+						filter.directions |= 1 << piece->GetStartDirection();
+						if (piece->GetStartDirection() != this->build_direction) avail = false;
+					}
 				}
+				filter.selectable[i] = avail;
 			}
-			selectable[i] = avail;
+			cached = this->connection_filters.emplace(filter_key, std::move(filter)).first;
 		}
+		directions = cached->second.directions;
+		for (uint i = 0; i < count; i++) selectable[i] = cached->second.selectable[i];
 
 		/* Round 2: Setup banking. */
 		for (uint i = 0; i < count; i++) {
@@ -1480,15 +1523,18 @@ void CoasterBuildWindow::BuildTrackPiece()
 		const CoasterType *ct = this->ci->GetCoasterType();
 		const TrackedRideDesign &trd = ct->designs.at(this->design);
 
+		std::vector<PositionedTrackPiece> design_pieces;
+		design_pieces.reserve(trd.pieces.size());
 		XYZPoint16 pos = this->piece_selector.pos_piece.base_voxel;
 		for (const TrackedRideDesign::AbstractTrackPiece &abstract_piece : trd.pieces) {
 			int piece_id = ct->GetRotatedPieceIndex(ct->pieces.at(ct->GetPieceIndex(abstract_piece.piece_name)), this->build_direction);
 			assert(piece_id >= 0);
 			ConstTrackPiecePtr piece = ct->pieces.at(piece_id);
-			ptp_index = this->ci->AddPositionedPiece(PositionedTrackPiece(pos, piece));
-			assert(ptp_index >= 0);  // We already checked that placing this design is permitted.
+			design_pieces.emplace_back(pos, piece);
 			pos += piece->exit_dxyz;
 		}
+		ptp_index = this->ci->AddPositionedPieces(design_pieces);
+		assert(ptp_index >= 0);  // We already checked that placing this design is permitted.
 	}
 
 	assert(ptp_index >= 0);  // We already checked that placing this design is permitted.
@@ -175,10 +175,27 @@ ConfigFile::ConfigFile(const std::string &fname) : filename(fname)
 	FILE *fp = fopen(fname.c_str(), "rb");
 	if (fp == nullptr) return;
 
-	for (;;) {
-		char buffer[256];
-		char *line = fgets(buffer, lengthof(buffer), fp);
-		if (line == nullptr) break;
+	/* Read the entire file in one go and split it into lines in place.
+	 * This needs a single read and allocation, and lifts the former
+	 * 255 character limit on line length. */
+	std::string contents;
+	fseek(fp, 0, SEEK_END);
+	const long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size > 0) {
+		contents.resize(size);
+		contents.resize(fread(&contents[0], 1, size, fp));
+	}
+	fclose(fp);
+
+	char *next = contents.empty() ? nullptr : &contents[0];
+	char *const buffer_end = next + contents.size();
+	while (next != nullptr) {
+		char *line = next;
+		char *eol = line;
+		while (eol < buffer_end && *eol != '\n') eol++;
+		next = (eol < buffer_end) ? eol + 1 : nullptr;
+		*eol = '\0';
 
 		while (*line != '\0' && isspace(*line)) line++;
 		if (*line == '\0' || *line == ';' || *line == '#') continue; // Silently skip empty lines or comment lines.
@@ -214,7 +231,6 @@ ConfigFile::ConfigFile(const std::string &fname) : filename(fname)
 		}
 		current_sect->items.emplace(key, std::unique_ptr<ConfigItem>(new ConfigItem(*current_sect, key, value, false)));
 	}
-	fclose(fp);
 }
 
 /**
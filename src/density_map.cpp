@@ -0,0 +1,41 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file density_map.cpp Implementation of the crowd and litter density field. */
+
+#include "stdafx.h"
+#include "density_map.h"
+
+DensityMap _density_map;  ///< The crowd and litter density field of the world.
+
+static const uint32 CROWD_DECAY_INTERVAL = 4000;  ///< Time between crowd counter decay steps, in milliseconds.
+
+DensityMap::DensityMap()
+{
+	this->Clear();
+}
+
+/** Reset all counters, forgetting everything about the park. */
+void DensityMap::Clear()
+{
+	std::fill_n(this->crowd, lengthof(this->crowd), 0);
+	std::fill_n(this->litter, lengthof(this->litter), 0);
+	this->time_since_decay = 0;
+}
+
+/**
+ * Time has passed, decay the crowd counters.
+ * @param delay Number of milliseconds time that have passed.
+ */
+void DensityMap::OnAnimate(int delay)
+{
+	this->time_since_decay += delay;
+	if (this->time_since_decay < CROWD_DECAY_INTERVAL) return;
+	this->time_since_decay -= CROWD_DECAY_INTERVAL;
+
+	for (uint16 &counter : this->crowd) counter -= counter >> 2;  // Lose a quarter each step.
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file density_map.h Coarse crowd and litter density field of the world. */
+
+#ifndef DENSITY_MAP_H
+#define DENSITY_MAP_H
+
+#include "geometry.h"
+#include "map.h"
+
+/**
+ * Coarse grid of crowd and litter counters over the world.
+ *
+ * Guests bump the crowd counter of their cell as they walk; the crowd counters decay over
+ * time, so they track where guests currently are rather than where they have ever been.
+ * The litter counters follow the litter and vomit actually lying around. Wandering staff
+ * consult the field to head towards actual work instead of relying on random walks to
+ * stumble upon it. The field is a steering heuristic and is not saved; it is rebuilt from
+ * events while the game runs.
+ */
+class DensityMap {
+public:
+	static const int CELL_SHIFT = 3;                        ///< 2-log of the size of a density cell, in tiles.
+	static const int CELLS_X = WORLD_X_SIZE >> CELL_SHIFT;  ///< Number of cells along the X axis of the world.
+	static const int CELLS_Y = WORLD_Y_SIZE >> CELL_SHIFT;  ///< Number of cells along the Y axis of the world.
+
+	DensityMap();
+
+	void Clear();
+	void OnAnimate(int delay);
+
+	/**
+	 * A guest walked onto a tile, bump the crowd counter of its cell.
+	 * @param pos Position of the guest.
+	 */
+	inline void AddCrowd(const XYZPoint16 &pos)
+	{
+		uint16 &counter = this->crowd[CellIndex(pos)];
+		if (counter < std::numeric_limits<uint16>::max()) counter++;
+	}
+
+	/**
+	 * Litter or vomit appeared at a tile.
+	 * @param pos Position of the new litter.
+	 */
+	inline void AddLitter(const XYZPoint16 &pos)
+	{
+		uint16 &counter = this->litter[CellIndex(pos)];
+		if (counter < std::numeric_limits<uint16>::max()) counter++;
+	}
+
+	/**
+	 * Litter or vomit was removed from a tile.
+	 * @param pos Position of the removed litter.
+	 * @param count Number of removed items.
+	 */
+	inline void RemoveLitter(const XYZPoint16 &pos, uint count)
+	{
+		uint16 &counter = this->litter[CellIndex(pos)];
+		counter -= std::min<uint>(counter, count);
+	}
+
+	/**
+	 * Get the crowd density near a tile.
+	 * @param x X coordinate of the tile, may lie outside the world.
+	 * @param y Y coordinate of the tile, may lie outside the world.
+	 * @return Crowd counter of the cell containing the tile, \c 0 outside the world.
+	 */
+	inline uint GetCrowd(int x, int y) const
+	{
+		if (x < 0 || x >= WORLD_X_SIZE || y < 0 || y >= WORLD_Y_SIZE) return 0;
+		return this->crowd[(x >> CELL_SHIFT) * CELLS_Y + (y >> CELL_SHIFT)];
+	}
+
+	/**
+	 * Get the litter density near a tile.
+	 * @param x X coordinate of the tile, may lie outside the world.
+	 * @param y Y coordinate of the tile, may lie outside the world.
+	 * @return Litter counter of the cell containing the tile, \c 0 outside the world.
+	 */
+	inline uint GetLitter(int x, int y) const
+	{
+		if (x < 0 || x >= WORLD_X_SIZE || y < 0 || y >= WORLD_Y_SIZE) return 0;
+		return this->litter[(x >> CELL_SHIFT) * CELLS_Y + (y >> CELL_SHIFT)];
+	}
+
+private:
+	/**
+	 * Get the cell index of a position in the world.
+	 * @param pos Position in the world.
+	 * @return Index of its cell in #crowd and #litter.
+	 */
+	static inline int CellIndex(const XYZPoint16 &pos)
+	{
+		return (pos.x >> CELL_SHIFT) * CELLS_Y + (pos.y >> CELL_SHIFT);
+	}
+
+	uint16 crowd[CELLS_X * CELLS_Y];  ///< Decaying count of guest tile visits per cell.
+	uint16 litter[CELLS_X * CELLS_Y]; ///< Count of litter and vomit items per cell.
+	uint32 time_since_decay;          ///< Time since the crowd counters last decayed, in milliseconds.
+};
+
+extern DensityMap _density_map;
+
+#endif
@@ -15,12 +15,30 @@
 
 /**
  * Defines a Dropdown menu item.
+ * The string parameters set for \a strid are captured here; the text itself is formatted
+ * when the item first becomes visible.
  * @param strid StringID to store.
  * @param flags Properties if this item.
  * @pre String parameters must be set for this string.
  */
-DropdownItem::DropdownItem(StringID strid, DropdownItemFlags flags) : str(DrawText(strid)), flags(flags)
+DropdownItem::DropdownItem(StringID strid, DropdownItemFlags flags) : flags(flags), strid(strid), materialized(false)
 {
+	this->params.parms.swap(_str_params.parms);
+	this->params.pluralize_count = _str_params.pluralize_count;
+	_str_params.set_mode = false; // Clean the global parameters on the next Set, like #DrawText does.
+}
+
+/**
+ * Get the text of the item, formatting it on first use.
+ * @return The item, as a string.
+ */
+const std::string &DropdownItem::GetString() const
+{
+	if (!this->materialized) {
+		this->str = DrawText(this->strid, &this->params);
+		this->materialized = true;
+	}
+	return this->str;
 }
 
 /**
@@ -105,11 +123,16 @@ void DropdownMenuWindow::SetDropdownSize(const Point16 &pos, uint16 min_width)
 	this->size = {pos.x, pos.y, min_width, 0};
 	int max_width = this->size.width;
 	int add_w = (this->has_selectable ? _gui_sprites.checkbox.width + 4 : 0) + 2;
+	/* The window has no scrollbar, so items below the bottom of the screen can never be
+	 * seen or clicked. Only the items that can become visible are formatted and measured. */
+	int visible = (_video.Height() - pos.y) / GetTextHeight() + 1;
 	for (const DropdownItem &item : items) {
+		this->size.height += GetTextHeight();
+		if (visible <= 0) continue;
+		visible--;
 		int w, unused;
-		_video.GetTextSize(item.str, &w, &unused);
+		_video.GetTextSize(item.GetString(), &w, &unused);
 		max_width = std::max(max_width, w + add_w);
-		this->size.height += GetTextHeight();
 	}
 	this->size.width = max_width;
 }
@@ -122,6 +145,7 @@ void DropdownMenuWindow::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid)
 	int it = 0;
 	int add_w = (this->has_selectable ? _gui_sprites.checkbox.width + 4 : 0);
 	for (const DropdownItem &item : this->items) {
+		if (y >= _video.Height()) break; // Items below the bottom of the screen can never become visible.
 		const Rectangle32 r(this->rect.base.x, y, static_cast<uint>(wid->pos.width - 1), static_cast<uint>(GetTextHeight()));
 		uint32 highlight = 0;
 		if (it == this->selected_index) {
@@ -137,7 +161,7 @@ void DropdownMenuWindow::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid)
 			_video.FillRectangle(r, _palette[GetColourRangeBase(static_cast<const LeafWidget*>(wid)->colour) + highlight]);
 		}
 
-		_video.BlitText(item.str, MakeRGBA(255, 255, 255, OPAQUE), this->rect.base.x + add_w, y, wid->pos.width);
+		_video.BlitText(item.GetString(), MakeRGBA(255, 255, 255, OPAQUE), this->rect.base.x + add_w, y, wid->pos.width);
 		if ((item.flags & DDIF_SELECTABLE) != 0) {
 			_video.BlitImage(Point32(this->rect.base.x, y), _gui_sprites.checkbox.sprites[(item.flags & DDIF_SELECTED) != 0 ? WCS_CHECKED : WCS_EMPTY]);
 		}
@@ -30,6 +30,15 @@ public:
 	EntityRemoveWindow(WindowTypes wtype, WindowNumber wnum);
 
 	Point32 OnInitialPosition() override;
+
+	/**
+	 * The question and cost shown by the window never change while it is open.
+	 * @return The window does not display progressing game state.
+	 */
+	bool DisplaysGameState() const override
+	{
+		return false;
+	}
 };
 
 #endif
@@ -83,6 +83,7 @@ public:
 	FencesMouseMode fence_sel; ///< Mouse selector for building fences.
 private:
 	void OnClickFence(FenceType fence);
+	void PlaceOrRemoveFence(MouseButtons state);
 };
 
 /**
@@ -257,11 +258,25 @@ void FenceGui::SelectorMouseMoveEvent(Viewport *vp, [[maybe_unused]] const Point
 	this->fence_sel.AddVoxel(fdata.voxel_pos);
 	this->fence_sel.SetupRideInfoSpace();
 	this->fence_sel.SetFenceData(fdata.voxel_pos, this->fence_type, edge);
+
+	/* While dragging, place or remove a fence at every newly touched edge. */
+	const MouseButtons drag = _video.GetMouseDragging();
+	if ((drag & (MB_LEFT | MB_RIGHT)) != 0) this->PlaceOrRemoveFence(drag);
 }
 
 void FenceGui::SelectorMouseButtonEvent(MouseButtons state)
 {
 	if ((state & (MB_LEFT | MB_RIGHT)) == 0) return;  // No buttons pressed.
+	_video.SetMouseDragging(state, true, false);      // Keep placing along the dragged edges.
+	this->PlaceOrRemoveFence(state);
+}
+
+/**
+ * Place (left button) or remove (right button) a fence at the currently selected edge.
+ * @param state Mouse buttons that are pressed.
+ */
+void FenceGui::PlaceOrRemoveFence(MouseButtons state)
+{
 	if (this->fence_sel.area.width != 1 || this->fence_sel.area.height != 1) return;
 	if (this->fence_edge == INVALID_EDGE) return;
 	if (_game_mode_mgr.InPlayMode() && _world.GetTileOwner(this->fence_base.x, this->fence_base.y) != OWN_PARK) return;
@@ -279,6 +294,8 @@ void FenceGui::SelectorMouseButtonEvent(MouseButtons state)
 
 		fences = SetFenceType(fences, this->fence_edge, FENCE_TYPE_INVALID);
 	} else {  // Build a fence.
+		if (GetFenceType(fences, this->fence_edge) == this->fence_type) return; // Already there; don't pay again while dragging.
+
 		cost = GetFenceCostBuild(this->fence_type);
 		if (!BestErrorMessageReason::CheckActionAllowed(BestErrorMessageReason::ACT_BUILD, cost)) return;
 
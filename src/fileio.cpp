@@ -18,6 +18,7 @@
 #ifdef LINUX
 	#include <dirent.h>
 	#include <errno.h>
+	#include <sys/mman.h>
 	#include <unistd.h>
 #elif WINDOWS
 	#include <direct.h> // contains chdir in windows
@@ -106,6 +107,25 @@ bool PathIsFile(const std::string &path)
 	return std::filesystem::exists(fs) && std::filesystem::is_regular_file(fs);
 }
 
+/**
+ * Get size and modification time of a file.
+ * @param path Path of the file.
+ * @param size [out] Size of the file.
+ * @param mtime [out] Modification time of the file.
+ * @return Whether the information could be retrieved.
+ */
+bool GetFileStats(const std::string &path, uint64 *size, int64 *mtime)
+{
+	std::error_code ec;
+	uint64 s = std::filesystem::file_size(path, ec);
+	if (ec) return false;
+	auto t = std::filesystem::last_write_time(path, ec);
+	if (ec) return false;
+	*size = s;
+	*mtime = t.time_since_epoch().count();
+	return true;
+}
+
 /**
  * Test whether the given path points to a directory.
  * @param path Path to investigate.
@@ -119,32 +139,152 @@ bool PathIsDirectory(const std::string &path)
 
 }
 
+/**
+ * Load the contents of a file into memory.
+ * The entire file is memory-mapped when the platform supports it, so reads
+ * are plain memory accesses rather than buffered \c stdio calls.
+ * @param fname Name of the file to load.
+ */
+FileContents::FileContents(const std::string &fname)
+: buffer(nullptr), file_size(0), hash(0), hash_computed(false), map_base(nullptr)
+{
+	FILE *fp = fopen(fname.c_str(), "rb");
+	if (fp == nullptr) return;
+
+	if (fseek(fp, 0L, SEEK_END) != 0) {
+		fclose(fp);
+		return;
+	}
+	this->file_size = ftell(fp);
+	if (fseek(fp, 0L, SEEK_SET) != 0) {
+		fclose(fp);
+		return;
+	}
+
+#ifdef LINUX
+	if (this->file_size > 0) {
+		void *address = mmap(nullptr, this->file_size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if (address != MAP_FAILED) {
+			this->map_base = address;
+			this->buffer = static_cast<const uint8 *>(address);
+		}
+	}
+#endif
+	if (this->buffer == nullptr) {
+		/* No memory mapping available, fall back to reading the file into memory in one go. */
+		this->heap_buffer.reset(new uint8[std::max<size_t>(this->file_size, 1)]);
+		if (this->file_size > 0 && fread(this->heap_buffer.get(), this->file_size, 1, fp) != 1) {
+			this->heap_buffer.reset();
+			this->file_size = 0;
+			fclose(fp);
+			return;
+		}
+		this->buffer = this->heap_buffer.get();
+	}
+	fclose(fp);
+}
+
+/** Destructor. */
+FileContents::~FileContents()
+{
+#ifdef LINUX
+	if (this->map_base != nullptr) munmap(this->map_base, this->file_size);
+#endif
+}
+
+/**
+ * Compute a hash of the file contents (FNV-1a), e.g. for use as a cache key.
+ * The hash is computed once and remembered.
+ * @return The hash; never \c 0 so callers may use \c 0 as 'no hash'.
+ */
+uint64 FileContents::Hash() const
+{
+	if (!this->hash_computed) {
+		uint64 h = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < this->file_size; i++) {
+			h ^= this->buffer[i];
+			h *= 0x100000001b3ULL;
+		}
+		this->hash = (h != 0) ? h : 1;
+		this->hash_computed = true;
+	}
+	return this->hash;
+}
+
 /**
  * RCD file reader constructor, loading data from a file.
  * @param fname Name of the file to load.
  */
 RcdFileReader::RcdFileReader(const std::string &fname)
-: filename(fname), file_pos(0), file_size(0)
+: filename(fname), contents(std::make_shared<FileContents>(fname)), file_pos(0)
 {
 	this->name[4] = '\0';
-	this->fp = fopen(fname.c_str(), "rb");
-	if (this->fp == nullptr) return;
+	this->buffer = this->contents->Data();
+	this->file_size = this->contents->Size();
+	this->blocks_end = this->file_size;
+	this->ParseToc();
+}
+
+/**
+ * Look for a table of contents at the end of the file, and load it if there is one.
+ * Files with a table of contents end with a "TOCB" block followed by an 8 byte
+ * trailer holding the offset of that block and the magic bytes "TOCF". Files
+ * without one are left alone; they are read with a linear scan as before.
+ */
+void RcdFileReader::ParseToc()
+{
+	static const size_t TRAILER_SIZE = 8; ///< An offset and 4 magic bytes.
+	if (this->buffer == nullptr || this->file_size < TRAILER_SIZE + 12) return;
+
+	const uint8 *trailer = this->buffer + this->file_size - TRAILER_SIZE;
+	if (memcmp(trailer + 4, "TOCF", 4) != 0) return;
+	size_t toc_offset = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((size_t)trailer[3] << 24);
+	if (toc_offset + 12 > this->file_size - TRAILER_SIZE) return;
 
-	if (fseek(this->fp, 0L, SEEK_END) != 0) {
-		fclose(this->fp);
+	this->file_pos = toc_offset;
+	if (!this->ReadBlockHeader() || strcmp(this->name, "TOCB") != 0 || this->version != 1) {
+		this->file_pos = 0;
 		return;
 	}
-	this->file_size = ftell(this->fp);
-	if (fseek(this->fp, 0L, SEEK_SET) != 0) {
-		fclose(this->fp);
+	uint32 count = this->GetUInt32();
+	if (this->size != 4 + 16u * count) {
+		this->file_pos = 0;
 		return;
 	}
+	this->toc.reserve(count);
+	for (uint32 i = 0; i < count; i++) {
+		RcdTocEntry entry;
+		this->GetBlob(entry.name, 4);
+		entry.name[4] = '\0';
+		entry.version = this->GetUInt32();
+		entry.offset = this->GetUInt32();
+		entry.length = this->GetUInt32();
+		if (entry.offset + 12 + (size_t)entry.length > toc_offset) { // Blocks cannot overlap the table of contents.
+			this->toc.clear();
+			this->file_pos = 0;
+			return;
+		}
+		this->toc.push_back(entry);
+	}
+	this->blocks_end = toc_offset; // Scanning the block sequence stops where the table of contents starts.
+	this->file_pos = 0;
+}
+
+/**
+ * Move the read position to the header of a block found in the table of contents.
+ * @param entry Entry of the block to seek to.
+ * @return Seeking was successful; a call to #ReadBlockHeader will read this block.
+ */
+bool RcdFileReader::SeekToBlock(const RcdTocEntry &entry)
+{
+	if (entry.offset + 12 > this->blocks_end) return false;
+	this->file_pos = entry.offset;
+	return true;
 }
 
 /** Destructor. */
 RcdFileReader::~RcdFileReader()
 {
-	if (this->fp != nullptr) fclose(fp);
 }
 
 /**
@@ -199,8 +339,8 @@ size_t RcdFileReader::GetRemaining()
  */
 uint8 RcdFileReader::GetUInt8()
 {
-	this->file_pos++;
-	return fgetc(this->fp);
+	if (this->file_pos >= this->file_size) return 0;
+	return this->buffer[this->file_pos++];
 }
 
 /**
@@ -281,7 +421,7 @@ std::string RcdFileReader::GetText()
  */
 bool RcdFileReader::CheckFileHeader(const char *hdr_name, uint32 version)
 {
-	if (this->fp == nullptr) return false;
+	if (this->buffer == nullptr) return false;
 	if (this->GetRemaining() < 8) return false;
 
 	char name[5];
@@ -298,11 +438,11 @@ bool RcdFileReader::CheckFileHeader(const char *hdr_name, uint32 version)
  */
 bool RcdFileReader::ReadBlockHeader()
 {
-	if (this->GetRemaining() < 12) return false;
+	if (this->file_pos + 12 > this->blocks_end) return false;
 	this->GetBlob(this->name, 4);
 	this->version = this->GetUInt32();
 	this->size = this->GetUInt32();
-	return this->file_pos + (size_t)this->size <= this->file_size;
+	return this->file_pos + (size_t)this->size <= this->blocks_end;
 }
 
 /**
@@ -314,7 +454,7 @@ bool RcdFileReader::SkipBytes(uint32 count)
 {
 	this->file_pos += count;
 	if (this->file_pos > this->file_size) this->file_pos = this->file_size;
-	return fseek(this->fp, this->file_pos, SEEK_SET) == 0;
+	return true;
 }
 
 /**
@@ -325,8 +465,27 @@ bool RcdFileReader::SkipBytes(uint32 count)
  */
 bool RcdFileReader::GetBlob(void *address, size_t length)
 {
+	const uint8 *src = this->GetBlobPointer(length);
+	if (src == nullptr) return false;
+	memcpy(address, src, length);
+	return true;
+}
+
+/**
+ * Get direct access to a blob of data in the file, without copying it.
+ * @param length Length of the data.
+ * @return Pointer to the data, or \c nullptr if not enough data is available.
+ * @note The pointer is valid as long as this reader exists.
+ */
+const uint8 *RcdFileReader::GetBlobPointer(size_t length)
+{
+	if (length > this->GetRemaining()) {
+		this->file_pos = this->file_size;
+		return nullptr;
+	}
+	const uint8 *address = this->buffer + this->file_pos;
 	this->file_pos += length;
-	return fread(address, length, 1, this->fp) == 1;
+	return address;
 }
 
 /**
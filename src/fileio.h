@@ -12,6 +12,7 @@
 
 #include "string_func.h"
 #include <filesystem>
+#include <memory>
 #include <vector>
 
 /** An error that occurs while loading a data file. */
@@ -26,6 +27,57 @@ private:
 
 constexpr  char DIR_SEP = '/';  ///< Directory separator character.
 
+/**
+ * Shared read-only contents of a data file, memory-mapped when the platform supports it.
+ * @ingroup fileio_group
+ */
+class FileContents {
+public:
+	FileContents(const std::string &fname);
+	~FileContents();
+
+	/**
+	 * Get the contents of the file.
+	 * @return The file data, \c nullptr if opening the file failed.
+	 */
+	inline const uint8 *Data() const
+	{
+		return this->buffer;
+	}
+
+	/**
+	 * Get the size of the file.
+	 * @return Size of the file in bytes.
+	 */
+	inline size_t Size() const
+	{
+		return this->file_size;
+	}
+
+	uint64 Hash() const;
+
+private:
+	const uint8 *buffer; ///< Contents of the file, \c nullptr if opening failed.
+	size_t file_size;    ///< Size of the file.
+
+	mutable uint64 hash;        ///< Hash of the file contents, only valid if #hash_computed.
+	mutable bool hash_computed; ///< Whether #hash has been computed already.
+
+	void *map_base;                        ///< Base address of the memory mapping, \c nullptr if #heap_buffer is used instead.
+	std::unique_ptr<uint8[]> heap_buffer;  ///< Owned copy of the file contents for platforms without memory mapping.
+};
+
+/**
+ * Entry of the table of contents of an RCD file.
+ * @ingroup fileio_group
+ */
+struct RcdTocEntry {
+	char name[5];    ///< Name of the block.
+	uint32 version;  ///< Version number of the block.
+	size_t offset;   ///< Offset of the block header in the file.
+	uint32 length;   ///< Data length of the block.
+};
+
 /**
  * Class for reading an RCD file.
  * @ingroup fileio_group
@@ -38,8 +90,19 @@ public:
 	bool CheckFileHeader(const char *hdr_name, uint32 version);
 	bool ReadBlockHeader();
 	bool SkipBytes(uint32 count);
+	bool SeekToBlock(const RcdTocEntry &entry);
+
+	/**
+	 * Get the table of contents of the file, if it has one.
+	 * @return The block entries in file order, empty for files without a table of contents.
+	 */
+	inline const std::vector<RcdTocEntry> &BlockToc() const
+	{
+		return this->toc;
+	}
 
 	bool GetBlob(void *address, size_t length);
+	const uint8 *GetBlobPointer(size_t length);
 
 	uint8  GetUInt8();
 	uint16 GetUInt16();
@@ -67,19 +130,43 @@ public:
 	void CheckMinLength(int length, int required, const char *what);
 	void CheckExactLength(int length, int required, const char *what);
 
+	/**
+	 * Get shared ownership of the file contents, e.g. for referencing blobs after the reader is gone.
+	 * @return The file contents.
+	 */
+	inline const std::shared_ptr<FileContents> &Contents() const
+	{
+		return this->contents;
+	}
+
+	/**
+	 * Get the current read position in the file.
+	 * @return Offset of the next byte to read.
+	 */
+	inline size_t GetPosition() const
+	{
+		return this->file_pos;
+	}
+
 	std::string filename;  ///< Name of the RCD file.
 	char name[5];   ///< Name of the last found block (with #ReadBlockHeader).
 	uint32 version; ///< Version number of the last found block (with #ReadBlockHeader).
 	uint32 size;    ///< Data size of the last found block (with #ReadBlockHeader).
 
 private:
-	FILE *fp;         ///< File handle of the opened file.
-	size_t file_pos;  ///< Position in the opened file.
-	size_t file_size; ///< Size of the opened file.
+	void ParseToc();
+
+	std::shared_ptr<FileContents> contents; ///< Contents of the opened file.
+	const uint8 *buffer; ///< Data of #contents, \c nullptr if opening failed.
+	size_t file_pos;     ///< Read position in #buffer.
+	size_t file_size;    ///< Size of the opened file.
+	size_t blocks_end;   ///< End of the linear block data (start of the table of contents for files that have one).
+	std::vector<RcdTocEntry> toc; ///< Table of contents of the file, empty if it has none.
 };
 
 bool PathIsFile(const std::string &path);
 bool PathIsDirectory(const std::string &path);
+bool GetFileStats(const std::string &path, uint64 *size, int64 *mtime);
 std::vector<std::string> GetAllEntries(const std::string &path);
 std::vector<std::string> GetAllFileEntries(const std::string &path);
 
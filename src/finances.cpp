@@ -43,22 +43,10 @@ void Finances::Reset()
 	this->marketing = 0;
 	this->research = 0;
 	this->loan_interest = 0;
+	this->total = 0;
 }
 
-/**
- * Total the categories.
- * @return Total amount of transferred money.
- */
-Money Finances::GetTotal() const
-{
-	Money income = this->park_tickets + this->ride_tickets + this->shop_sales + this->food_sales;
-	Money expenses = this->ride_construct + this->ride_running + this->land_purchase + this->landscaping +
-			this->shop_stock + this->food_stock + this->staff_wages + this->marketing + this->research + this->loan_interest;
-
-	return income + expenses; // Expenses are already negative.
-}
-
-static const uint32 CURRENT_VERSION_FINA     = 2;   ///< Currently supported version of the FINA Pattern.
+static const uint32 CURRENT_VERSION_FINA     = 3;   ///< Currently supported version of the FINA Pattern.
 static const uint32 CURRENT_VERSION_Finances = 1;   ///< Currently supported version of the finances Pattern.
 
 /**
@@ -85,6 +73,10 @@ void Finances::Load(Loader &ldr)
 		marketing      = ldr.GetLongLong();
 		research       = ldr.GetLongLong();
 		loan_interest  = ldr.GetLongLong();
+		/* Re-derive the running total; expenses are already negative. */
+		total = park_tickets + ride_tickets + shop_sales + food_sales +
+				ride_construct + ride_running + land_purchase + landscaping +
+				shop_stock + food_stock + staff_wages + marketing + research + loan_interest;
 	} else {
 		ldr.VersionMismatch(version, CURRENT_VERSION_Finances);
 	}
@@ -200,13 +192,17 @@ void FinancesManager::RepayLoan(const Money &delta)
 }
 
 /**
- * Access method for actually changing amount of money and notifying GUI.
+ * Access method for actually changing amount of money.
+ * Deliberately does not notify any window: the windows displaying money are
+ * invalidated once per tick by #WindowManager::Tick while game time runs, so
+ * any number of transactions within a tick coalesce into a single redraw.
  * @param income How much money to change total by.
  * @note Pass a negative number for a loss of money.
  */
 void FinancesManager::DoTransaction(const Money &income)
 {
 	this->cash += income;
+	this->finances[this->current].total += income;
 }
 
 /** Recalculate the park's total value. */
@@ -19,7 +19,7 @@ static const Money CONSTRUCTION_COST_PATH_CHANGE( 400);  ///< How much it costs
 static const Money CONSTRUCTION_COST_PATH_RETURN(-800);  ///< How much it costs to delete a single path segment.
 constexpr int RIDE_DEPRECIATION = 180;                   ///< Ride value decrease per month, in 1/10000th.
 
-static const int NUM_FINANCE_HISTORY = 4; ///< Number of finance objects to keep for history.
+static const int NUM_FINANCE_HISTORY = 24; ///< Number of monthly finance objects to keep for history (two years).
 
 /**
  * Tracking monthly finances.
@@ -43,9 +43,18 @@ public:
 	Money marketing;      ///< Monthly expenditures for marketing (value is negative).
 	Money research;       ///< Monthly expenditures for research (value is negative).
 	Money loan_interest;  ///< Monthly expenditures for loan interest (value is negative).
+	Money total;          ///< Running total over all categories, kept up to date at transaction time.
 
 	void Reset();
-	Money GetTotal() const;
+
+	/**
+	 * Total the categories.
+	 * @return Total amount of transferred money.
+	 */
+	inline const Money &GetTotal() const
+	{
+		return this->total;
+	}
 
 	void Load(Loader &ldr);
 	void Save(Saver &svr);
@@ -69,6 +78,27 @@ public:
 	FinancesManager();
 
 	const Finances &GetFinances();
+
+	/**
+	 * Get the number of months with finance history, including the current month.
+	 * @return Number of valid history entries.
+	 */
+	inline int GetNumMonths() const
+	{
+		return this->num_used;
+	}
+
+	/**
+	 * Get the finances of an earlier month.
+	 * @param months_back Number of months to go back, \c 0 for the current month. Must be less than #GetNumMonths.
+	 * @return The finance record of that month.
+	 */
+	inline const Finances &GetHistory(int months_back) const
+	{
+		assert(months_back >= 0 && months_back < this->num_used);
+		return this->finances[(this->current + NUM_FINANCE_HISTORY - months_back) % NUM_FINANCE_HISTORY];
+	}
+
 	void AdvanceMonth();
 	void OnNewDay();
 	void CashToStrParams();
@@ -252,7 +282,6 @@ public:
 private:
 	void Reset();
 	void RecomputeParkValue();
-	void NotifyGui();
 };
 
 extern FinancesManager _finances_manager;
@@ -51,7 +51,8 @@ FixedRideInstance::FixedRideInstance(const FixedRideType *type) : RideInstance(t
 	max_idle_duration(type->default_idle_duration),
 	min_idle_duration(0),
 	is_working(false),
-	time_left_in_phase(0)
+	time_left_in_phase(0),
+	current_frame_set(nullptr)
 {
 	const FixedRideType::RideCapacity capacity = type->GetRideCapacity();
 	this->onride_guests.Configure(capacity.guests_per_batch, capacity.number_of_batches);
@@ -124,43 +125,49 @@ void FixedRideInstance::GetSprites(const XYZPoint16 &vox, [[maybe_unused]] uint1
 	} else if (vox.z != this->vox_pos.z) {
 		sprites[1] = nullptr;
 	} else {
-		const FrameSet *set_to_use;
-		if (is_working) {
-			/* Check whether we are starting up, slowing down, or in the middle of the phase. */
-			const int total_duration = this->working_cycles * t->working_duration;
-			const int relative_time = Clamp(total_duration - time_left_in_phase, 0, total_duration);
-			const int start_duration = t->animation_starting == nullptr ? 0 : t->animation_starting->GetTotalDuration();
-			if (relative_time < start_duration) {
-				/* Starting up. */
-				const int index = t->animation_starting->GetFrame(relative_time, false);
-				assert(index >= 0 && index < t->animation_starting->frames);
-				set_to_use = t->animation_starting->views[index];
-			} else {
-				const int stop_duration = t->animation_stopping == nullptr ? 0 : t->animation_stopping->GetTotalDuration();
-				if (relative_time > total_duration - stop_duration) {
-					/* Slowing down. */
-					const int index = t->animation_stopping->GetFrame(stop_duration + relative_time - total_duration, false);  // NOLINT clang-tidy false positive.
-					assert(index >= 0 && index < t->animation_stopping->frames);
-					set_to_use = t->animation_stopping->views[index];
-				} else if (t->animation_working != nullptr && t->animation_working->GetTotalDuration() > 0) {
-					/* Main part of the working animation. */
-					const int index = t->animation_working->GetFrame(relative_time - start_duration, true);
-					assert(index >= 0 && index < t->animation_working->frames);
-					set_to_use = t->animation_working->views[index];
-				} else {
-					/* The ride does not have a working animation. */
-					set_to_use = t->animation_idle;
-				}
-			}
-		} else {
-			/* The ride is idle. */
-			set_to_use = t->animation_idle;
-		}
+		/* The active frame set is computed once per tick in #OnAnimate, not for every voxel drawn. */
+		const FrameSet *set_to_use = this->current_frame_set != nullptr ? this->current_frame_set : t->animation_idle;
 		const XYZPoint16 unrotated_pos = UnorientatedOffset(this->orientation, vox.x - vox_pos.x, vox.y - vox_pos.y);
 		sprites[1] = set_to_use->GetSprite(unrotated_pos.x, unrotated_pos.y, orientation_index(this->orientation), zoom);
 	}
 }
 
+/**
+ * Determine the animation frame set to display for the current phase and phase time.
+ * @return The frame set to display.
+ */
+const FrameSet *FixedRideInstance::ComputeActiveFrameSet() const
+{
+	const FixedRideType *t = GetFixedRideType();
+	if (!this->is_working) return t->animation_idle; // The ride is idle.
+
+	/* Check whether we are starting up, slowing down, or in the middle of the phase. */
+	const int total_duration = this->working_cycles * t->working_duration;
+	const int relative_time = Clamp(total_duration - time_left_in_phase, 0, total_duration);
+	const int start_duration = t->animation_starting == nullptr ? 0 : t->animation_starting->GetTotalDuration();
+	if (relative_time < start_duration) {
+		/* Starting up. */
+		const int index = t->animation_starting->GetFrame(relative_time, false);
+		assert(index >= 0 && index < t->animation_starting->frames);
+		return t->animation_starting->views[index];
+	}
+	const int stop_duration = t->animation_stopping == nullptr ? 0 : t->animation_stopping->GetTotalDuration();
+	if (relative_time > total_duration - stop_duration) {
+		/* Slowing down. */
+		const int index = t->animation_stopping->GetFrame(stop_duration + relative_time - total_duration, false);  // NOLINT clang-tidy false positive.
+		assert(index >= 0 && index < t->animation_stopping->frames);
+		return t->animation_stopping->views[index];
+	}
+	if (t->animation_working != nullptr && t->animation_working->GetTotalDuration() > 0) {
+		/* Main part of the working animation. */
+		const int index = t->animation_working->GetFrame(relative_time - start_duration, true);
+		assert(index >= 0 && index < t->animation_working->frames);
+		return t->animation_working->views[index];
+	}
+	/* The ride does not have a working animation. */
+	return t->animation_idle;
+}
+
 /**
  * Update a ride instance with its position in the world.
  * @param orientation Orientation of the fixed ride.
@@ -185,17 +192,15 @@ void FixedRideInstance::SetRide(uint8 orientation, const XYZPoint16 &pos)
 
 void FixedRideInstance::RemoveAllPeople()
 {
-	for (GuestBatch &gb : this->onride_guests.batches) {
+	for (int i = 0; i < this->onride_guests.num_batches; i++) {
+		GuestBatch &gb = this->onride_guests.GetBatch(i);
 		if (gb.state == BST_EMPTY) continue;
 
-		for (GuestData &gd : gb.guests) {
-			if (!gd.IsEmpty()) {
-				_guests.GetExisting(gd.guest)->ExitRide(this, gd.entry);
-
-				gd.Clear();
-			}
+		for (const GuestData *gd = gb.FirstGuest(); gd != nullptr; gd = gb.FirstGuest()) {
+			_guests.GetExisting(gd->guest)->ExitRide(this, gd->entry);
+			gb.RemoveFirstGuest();
 		}
-		gb.state = BST_EMPTY;
+		this->onride_guests.SetBatchState(i, BST_EMPTY);
 	}
 }
 
@@ -255,8 +260,8 @@ void FixedRideInstance::RemoveFromWorld()
 			if (!IsVoxelstackInsideWorld(this->vox_pos.x + unrotated_pos.x, this->vox_pos.y + unrotated_pos.y)) continue;
 			for (int16 h = 0; h < height; ++h) {
 				Voxel *voxel = _world.GetCreateVoxel(this->vox_pos + XYZPoint16(unrotated_pos.x, unrotated_pos.y, h), false);
-				if (voxel && voxel->instance != SRI_FREE) {
-					assert(voxel->instance == index);
+				if (voxel && voxel->GetInstance() != SRI_FREE) {
+					assert(voxel->GetInstance() == index);
 					voxel->ClearInstances();
 				}
 			}
@@ -280,6 +285,13 @@ void FixedRideInstance::OnAnimate(const int delay)
 	const FixedRideType* t = GetFixedRideType();
 	bool force_start = false;
 	if (this->state == RIS_OPEN && this->GetKind() != RTK_SHOP) {
+		/* An open ride plays its idle or working animation, its columns change every frame. */
+		for (int8 x = 0; x < t->width_x; x++) {
+			for (int8 y = 0; y < t->width_y; y++) {
+				const XYZPoint16 pos = this->vox_pos + OrientatedOffset(this->orientation, x, y);
+				_world_dirty.MarkColumn(pos.x, pos.y);
+			}
+		}
 		this->time_left_in_phase -= delay;
 		if (this->time_left_in_phase < 0) {
 			this->is_working = !this->is_working;
@@ -289,25 +301,23 @@ void FixedRideInstance::OnAnimate(const int delay)
 	} else {
 		this->is_working = false;
 	}
+	this->current_frame_set = this->ComputeActiveFrameSet();
 
 	/* Kick out guests that are done. */
-	int start = -1;
-	for (;;) {
-		start = this->onride_guests.GetFinishedBatch(start);
-		if (start < 0) break;
-
-		GuestBatch &gb = this->onride_guests.batches.at(start);
-		bool is_empty = true;
-		for (GuestData &gd : gb.guests) {
-			if (!gd.IsEmpty()) {
-				_guests.GetExisting(gd.guest)->ExitRide(this, gd.entry);
-				gd.Clear();
-				/* Kick out only one guest at a time so they appear to be walking out in a nice, ordered line. */
-				is_empty = false;
-				break;
-			}
+	int start = this->onride_guests.GetFinishedBatch();
+	while (start >= 0) {
+		const int next = this->onride_guests.GetFinishedBatch(start);  // Query before the batch may leave the finished list.
+
+		GuestBatch &gb = this->onride_guests.GetBatch(start);
+		const GuestData *gd = gb.FirstGuest();
+		if (gd != nullptr) {
+			/* Kick out only one guest at a time so they appear to be walking out in a nice, ordered line. */
+			_guests.GetExisting(gd->guest)->ExitRide(this, gd->entry);
+			gb.RemoveFirstGuest();
+		} else {
+			this->onride_guests.SetBatchState(start, BST_EMPTY);
 		}
-		if (is_empty) gb.state = BST_EMPTY;
+		start = next;
 	}
 
 	/* Ensure there is always a Loading batch, except when all batches are Running. */
@@ -316,23 +326,14 @@ void FixedRideInstance::OnAnimate(const int delay)
 		start = this->onride_guests.GetFreeBatch();
 	}
 	if (start >= 0) {
-		GuestBatch &batch = this->onride_guests.GetBatch(start);
-		batch.state = BST_LOADING;
+		this->onride_guests.SetBatchState(start, BST_LOADING);
 		/* Start the batch when it is full or when the timeout has elapsed. */
-		bool is_full = true;
-		if (!force_start) {
-			for (GuestData &gd : batch.guests) {
-				if (gd.IsEmpty()) {
-					is_full = false;
-					break;
-				}
-			}
-		}
+		const bool is_full = force_start || this->onride_guests.GetBatch(start).IsFull();
 		/* \todo Only start if the waiting time exceeded #min_idle_duration. */
 		if (is_full) {
 			this->is_working = true;
 			this->time_left_in_phase = this->working_cycles * t->working_duration;
-			batch.Start(this->time_left_in_phase);
+			this->onride_guests.StartBatch(start, this->time_left_in_phase);
 		}
 	}
 }
@@ -87,6 +87,7 @@ public:
 	}
 
 	int EntranceExitRotation(const XYZPoint16& vox) const;
+	const FrameSet *ComputeActiveFrameSet() const;
 
 	Money return_cost;      ///< Money returned by removing this ride.
 	uint8 orientation;      ///< Orientation of the shop.
@@ -100,6 +101,7 @@ protected:
 
 	bool is_working;        /// Whether the ride is currently in the working phase.
 	int time_left_in_phase; /// Number of milliseconds left in the current phase.
+	const FrameSet *current_frame_set; /// Animation frame set to display this tick (\c nullptr means the idle frames).
 };
 
 #endif
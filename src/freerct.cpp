@@ -21,8 +21,12 @@
 #include "getoptdata.h"
 #include "fileio.h"
 #include "gamecontrol.h"
+#include "profiler.h"
+#include "replay.h"
 #include "ride_type.h"
 #include "string_func.h"
+#include "task_system.h"
+#include "time_func.h"
 #include "rev.h"
 
 #ifdef WEBASSEMBLY
@@ -239,13 +243,28 @@ int freerct_main(int argc, char **argv)
 	/* Scan for savegames and config files in outdated locations. */
 	MigrateOldFiles();
 
+	/* Start the shared task system; all subsystems that run work on threads use it. */
+	_task_system.Start();
+
 	/* Load RCD files. */
 	InitImageStorage();
-	_rcd_collection.ScanDirectories();
-	_sprite_manager.LoadRcdFiles();
-	_rides_manager.LoadDesigns();
+	{
+		StartupPhaseTimer timer("rcd-scan");
+		_rcd_collection.ScanDirectories();
+	}
+	{
+		StartupPhaseTimer timer("rcd-load");
+		_sprite_manager.LoadRcdFiles();
+	}
+	{
+		StartupPhaseTimer timer("designs");
+		_rides_manager.LoadDesigns();
+	}
 
-	InitLanguage();
+	{
+		StartupPhaseTimer timer("language");
+		InitLanguage();
+	}
 
 	if (!_gui_sprites.HasSufficientGraphics()) {
 		fprintf(stderr, "Insufficient graphics loaded.\n");
@@ -264,6 +283,27 @@ int freerct_main(int argc, char **argv)
 	{
 		int autosaves = cfg_file.GetNum("saveloading", "max_autosaves");
 		if (autosaves >= 0) _max_autosaves = autosaves;
+
+		int compression = cfg_file.GetNum("saveloading", "compression_level");
+		if (compression >= 0) _save_compression_level = std::min(compression, 9);
+	}
+
+	{
+		/* Record a chrome://tracing trace of the profiled zones from startup until exit. */
+		std::string trace_path = cfg_file.GetValue("profiler", "trace-file");
+		if (!trace_path.empty()) _profiler.StartTrace(trace_path);
+
+		/* Record the next game session for tick-exact replaying in the benchmark harness. */
+		std::string replay_path = cfg_file.GetValue("replay", "record-file");
+		if (!replay_path.empty()) _replay_recorder.Arm(replay_path);
+
+		/* Number of presented frames between two timelapse screen captures. */
+		int timelapse = cfg_file.GetNum("video", "timelapse-interval");
+		if (timelapse > 0) _video.SetTimelapseInterval(timelapse);
+
+		/* Byte budget for the evictable sprite caches, for machines with little memory. */
+		int sprite_budget = cfg_file.GetNum("memory", "sprite-budget-mb");
+		if (sprite_budget > 0) _sprite_memory_budget = static_cast<size_t>(sprite_budget) << 20;
 	}
 
 	/* Use default values if no font has been set. */
@@ -303,9 +343,15 @@ int freerct_main(int argc, char **argv)
 	_shortcuts.ReadConfig(cfg_file);
 
 	/* Initialize video. */
-	_video.Initialize(font_path, font_size);
+	{
+		StartupPhaseTimer timer("video-init");
+		_video.Initialize(font_path, font_size);
+	}
 
-	_game_control.Initialize(file_name, game_mode);
+	{
+		StartupPhaseTimer timer("game-init");
+		_game_control.Initialize(file_name, game_mode);
+	}
 
 	/* Loops until told not to. */
 #ifdef WEBASSEMBLY
@@ -316,6 +362,8 @@ int freerct_main(int argc, char **argv)
 
 	_game_control.Uninitialize();
 
+	_task_system.Shutdown();
+	_profiler.StopTrace();
 	UninitLanguage();
 	DestroyImageStorage();
 	_video.Shutdown();
@@ -8,14 +8,22 @@
 /** @file gamecontrol.cpp High level game control code. */
 
 #include "stdafx.h"
+#include "alloc_tracking.h"
 #include "gamecontrol.h"
 #include "gameobserver.h"
+#include "density_map.h"
 #include "finances.h"
 #include "messages.h"
 #include "sprite_store.h"
+#include "path.h"
 #include "path_build.h"
+#include "path_graph.h"
+#include "path_jobs.h"
 #include "person.h"
 #include "people.h"
+#include "profiler.h"
+#include "random.h"
+#include "replay.h"
 #include "window.h"
 #include "dates.h"
 #include "scenery.h"
@@ -24,33 +32,72 @@
 #include "freerct.h"
 #include "fileio.h"
 #include "rev.h"
+#include "time_func.h"
+#include <deque>
+#include <functional>
 
 GameModeManager _game_mode_mgr; ///< Game mode manager object.
 
+/**
+ * Interpolation factor for rendering moving objects between the last two simulation ticks.
+ * \c 0 displays the previous tick's position, \c 1 the current one. Updated every frame.
+ */
+double _simulation_render_alpha = 1.0;
+
+/** Number of simulation ticks run since the current level started, the time stamp of replay events. */
+uint32 _simulation_tick = 0;
+
+/**
+ * Pending units of day-boundary work, in the order they must run.
+ * The day and month rollovers used to run all their handlers on the rollover tick, which
+ * made that tick visibly more expensive than its neighbours at high game speeds. The
+ * handlers are queued here instead and #RunDayBoundaryWork runs one of them per
+ * simulation tick. With #TICK_COUNT_PER_DAY ticks in a day and only a handful of
+ * handlers per rollover, the queue is empty again long before the next boundary; the
+ * handlers still run on the day they belong to, merely a few ticks after midnight.
+ */
+static std::deque<std::function<void()>> _boundary_work;
+
+/** Run one queued unit of day-boundary work, if any. */
+static void RunDayBoundaryWork()
+{
+	if (_boundary_work.empty()) return;
+	std::function<void()> work = std::move(_boundary_work.front());
+	_boundary_work.pop_front();
+	work();
+}
+
+/** Run all still queued day-boundary work immediately, e.g. before the game state is serialized. */
+void FlushDayBoundaryWork()
+{
+	while (!_boundary_work.empty()) RunDayBoundaryWork();
+}
+
 /** Runs various procedures that have to be done yearly. */
 void OnNewYear()
 {
 	// Nothing (yet) needed.
 }
 
-/** Runs various procedures that have to be done monthly. */
+/** Queues the various procedures that have to be done monthly. */
 void OnNewMonth()
 {
-	Autosave();
-	_finances_manager.AdvanceMonth();
-	_staff.OnNewMonth();
-	_rides_manager.OnNewMonth();
+	_boundary_work.emplace_back([] { Autosave(); });
+	_boundary_work.emplace_back([] { _finances_manager.AdvanceMonth(); });
+	_boundary_work.emplace_back([] { _staff.OnNewMonth(); });
+	_boundary_work.emplace_back([] { _rides_manager.OnNewMonth(); });
 }
 
-/** Runs various procedures that have to be done daily. */
+/** Queues the various procedures that have to be done daily. */
 void OnNewDay()
 {
-	_rides_manager.OnNewDay();
-	_guests.OnNewDay();
-	_staff.OnNewDay();
-	_weather.OnNewDay();
-	_finances_manager.OnNewDay();
-	_game_observer.OnNewDay();
+	FlushDayBoundaryWork(); // The queue drains much faster than a day passes, but never let two days' work interleave.
+	_boundary_work.emplace_back([] { _rides_manager.OnNewDay(); });
+	_boundary_work.emplace_back([] { _guests.OnNewDay(); });
+	_boundary_work.emplace_back([] { _staff.OnNewDay(); });
+	_boundary_work.emplace_back([] { _weather.OnNewDay(); });
+	_boundary_work.emplace_back([] { _finances_manager.OnNewDay(); });
+	_boundary_work.emplace_back([] { _game_observer.OnNewDay(); });
 }
 
 /**
@@ -66,29 +113,206 @@ static int speed_factor(GameSpeed speed)
 		case GSP_2:     return 2;
 		case GSP_4:     return 4;
 		case GSP_8:     return 8;
+		case GSP_TURBO: NOT_REACHED();  // Turbo is not paced by real time, #OnNewFrame handles it separately.
 		default:       NOT_REACHED();
 	}
 }
 
+static const int SIMULATION_BUDGET_PERCENT = 60;        ///< Percentage of the frame delay available to the simulation; the rest is left for rendering and input.
+static const double OVERRUN_REPORT_INTERVAL = 10000.0;  ///< Minimal interval between two overrun reports, in milliseconds.
+
+/** Time budget bookkeeping of one simulation subsystem. */
+struct SubsystemBudget {
+	const char *name;  ///< Name of the subsystem in overrun reports.
+	int share;         ///< Share of the simulation budget, in percent.
+	uint32 overruns;   ///< Number of budget overruns since the last report.
+	double worst_ms;   ///< Cost of the worst overrun since the last report, in milliseconds.
+};
+
+/** The simulation subsystems, in the order they run in a simulation step. */
+enum SubsystemIndex {
+	SUB_GUESTS_TICK,      ///< Daily guest updates (divisible, suspends at its deadline).
+	SUB_STAFF_TICK,       ///< Daily staff updates.
+	SUB_OBSERVER,         ///< Date handling and game observer.
+	SUB_GUESTS_ANIMATE,   ///< Guest movement.
+	SUB_STAFF_ANIMATE,    ///< Staff movement.
+	SUB_RIDES_ANIMATE,    ///< Ride animation.
+	SUB_SCENERY_ANIMATE,  ///< Scenery animation.
+	SUB_DENSITY_ANIMATE,  ///< Density map maintenance.
+
+	SUB_COUNT             ///< Number of budgeted subsystems.
+};
+assert_compile(static_cast<int>(SUB_COUNT) == static_cast<int>(PFZ_RENDER_BEGIN));  ///< The profiler mirrors the subsystems as its first zones, in the same order.
+
+/** Budgets of all simulation subsystems. The shares add up to 100 percent. */
+static SubsystemBudget _subsystem_budgets[SUB_COUNT] = {
+	{"guests_tick",     25, 0, 0.0},
+	{"staff_tick",       5, 0, 0.0},
+	{"observer",         5, 0, 0.0},
+	{"guests_animate",  30, 0, 0.0},
+	{"staff_animate",   10, 0, 0.0},
+	{"rides_animate",   15, 0, 0.0},
+	{"scenery_animate",  5, 0, 0.0},
+	{"density_animate",  5, 0, 0.0},
+};
+
+/**
+ * Compute the point in real time at which a subsystem's share of the simulation budget runs out.
+ * @param budget_ms Simulation budget of one frame, in milliseconds.
+ * @param index Subsystem to compute the deadline for.
+ * @return The deadline.
+ */
+static Realtime ShareDeadline(const double budget_ms, const SubsystemIndex index)
+{
+	return Time() + std::chrono::duration_cast<Realtime::duration>(Duration(budget_ms * _subsystem_budgets[index].share / 100.0));
+}
+
+/**
+ * Run one subsystem call and record whether it exceeded its share of the simulation budget.
+ * @param index Subsystem to run.
+ * @param budget_ms Simulation budget of one frame, in milliseconds.
+ * @param call Subsystem call to execute.
+ */
+template <typename Callable>
+static void RunBudgeted(const SubsystemIndex index, const double budget_ms, Callable call)
+{
+	SubsystemBudget &sub = _subsystem_budgets[index];
+	const Realtime start = Time();
+	call();
+	const double spent = Delta(start);
+	_profiler.Record(static_cast<ProfiledZone>(index), start, spent);  // Subsystems and profiled zones share their order.
+	if (spent > budget_ms * sub.share / 100.0) {
+		sub.overruns++;
+		sub.worst_ms = std::max(sub.worst_ms, spent);
+	}
+}
+
+/**
+ * Report subsystems that overran their budget since the last report, rate-limited.
+ * Each subsystem prints one machine-readable line of the form
+ * <tt>[framebudget] subsystem=NAME overruns=N worst_ms=T budget_ms=B</tt>.
+ * @param budget_ms Simulation budget of one frame, in milliseconds.
+ */
+static void ReportBudgetOverruns(const double budget_ms)
+{
+	static Realtime last_report = Time();
+	if (Delta(last_report) < OVERRUN_REPORT_INTERVAL) return;
+	last_report = Time();
+	for (SubsystemBudget &sub : _subsystem_budgets) {
+		if (sub.overruns == 0) continue;
+		printf("[framebudget] subsystem=%s overruns=%u worst_ms=%.3f budget_ms=%.3f\n",
+				sub.name, sub.overruns, sub.worst_ms, budget_ms * sub.share / 100.0);
+		sub.overruns = 0;
+		sub.worst_ms = 0.0;
+	}
+}
+
+/**
+ * Run one fixed-length simulation tick under the per-subsystem time budgets.
+ * @param budget_ms Simulation budget of one frame, in milliseconds.
+ */
+static void RunSimulationStep(const double budget_ms)
+{
+	/* The daily guest updates are divisible, they get a hard deadline and carry unfinished work over to the next frame. */
+	RunBudgeted(SUB_GUESTS_TICK, budget_ms, [budget_ms] {
+		const AllocationTagScope tag(ALT_GUESTS);
+		_guests.DoTick(ShareDeadline(budget_ms, SUB_GUESTS_TICK));
+	});
+	RunBudgeted(SUB_STAFF_TICK, budget_ms, [] { _staff.DoTick(); });
+	RunBudgeted(SUB_OBSERVER, budget_ms, [] {
+		DateOnTick();
+		RunDayBoundaryWork();
+		_game_observer.DoTick();
+	});
+	RunBudgeted(SUB_GUESTS_ANIMATE, budget_ms, [] {
+		const AllocationTagScope tag(ALT_GUESTS);
+		_guests.OnAnimate(SIMULATION_TICK_MS);
+	});
+	RunBudgeted(SUB_STAFF_ANIMATE, budget_ms, [] { _staff.OnAnimate(SIMULATION_TICK_MS); });
+	RunBudgeted(SUB_RIDES_ANIMATE, budget_ms, [] { _rides_manager.OnAnimate(SIMULATION_TICK_MS); });
+	RunBudgeted(SUB_SCENERY_ANIMATE, budget_ms, [] { _scenery.OnAnimate(SIMULATION_TICK_MS); });
+	RunBudgeted(SUB_DENSITY_ANIMATE, budget_ms, [] { _density_map.OnAnimate(SIMULATION_TICK_MS); });
+	_simulation_tick++;
+}
+
+/**
+ * Run one fixed simulation tick without frame budgeting.
+ * Headless tools such as the benchmarks drive the simulation through this entry point,
+ * so they batch ticks with exactly the same machinery as the game loop.
+ */
+void RunSimulationTick()
+{
+	RunSimulationStep(1.0e6);  // A budget of a thousand seconds is never hit.
+}
+
 /**
  * For every frame do...
  * @param frame_delay Number of milliseconds between two frames.
+ * @param time_elapsed Number of milliseconds that really passed since the previous frame.
 */
-void OnNewFrame(const uint32 frame_delay)
+void OnNewFrame(const uint32 frame_delay, const uint32 time_elapsed)
 {
 	_image_variants.Tick();
-	_window_manager.Tick();
+	{
+		const AllocationTagScope tag(ALT_GUI);
+		_window_manager.Tick();
+	}
 	_inbox.Tick(frame_delay);
-	for (int i = speed_factor(_game_control.speed); i > 0; i--) {
-		_guests.DoTick();
-		_staff.DoTick();
-		DateOnTick();
-		_game_observer.DoTick();
-		_guests.OnAnimate(frame_delay);
-		_staff.OnAnimate(frame_delay);
-		_rides_manager.OnAnimate(frame_delay);
-		_scenery.OnAnimate(frame_delay);
+	ProcessSaveNotifications();
+
+	if (_replay_recorder.Active()) {
+		/* Speed changes are assigned from several GUI places, catch them all here. */
+		static GameSpeed logged_speed = GSP_1;
+		if (_game_control.speed != logged_speed) {
+			logged_speed = _game_control.speed;
+			_replay_recorder.LogSpeed(logged_speed);
+		}
 	}
+
+	/* Simulation and rendering share the main thread, so drawing a busy park can make a
+	 * cycle overrun the frame delay. The simulation always advances in fixed ticks of
+	 * #SIMULATION_TICK_MS: the elapsed real time accumulates and whole ticks are worked
+	 * off, so render hitches or a different frame cadence never change tick lengths and
+	 * runs stay deterministic. The backlog is capped to avoid a catch-up spiral after a
+	 * long stall.
+	 */
+	constexpr uint32 MAX_CATCHUP_TIME = 4 * SIMULATION_TICK_MS;  ///< Maximal amount of pending simulation time (in milliseconds) to work off.
+	static uint32 time_owed = 0;
+	time_owed = std::min(time_owed + time_elapsed, MAX_CATCHUP_TIME);
+
+	/* Stop scheduling further simulation ticks when the frame's simulation budget is
+	 * spent: an overloaded simulation then slows down gracefully instead of starving
+	 * the renderer. The skipped time stays owed (capped above).
+	 */
+	const Realtime sim_start = Time();
+	const double budget_ms = frame_delay * SIMULATION_BUDGET_PERCENT / 100.0;
+	bool out_of_budget = false;
+	if (_game_control.speed == GSP_TURBO) {
+		/* Turbo is not paced by real time at all: batch as many ticks as fit in the
+		 * simulation budget of this frame. Render-only work (floataway texts, window
+		 * redraws) happens once per rendered frame regardless, so it is skipped
+		 * automatically between the batched ticks.
+		 */
+		time_owed = 0;
+		do {
+			RunSimulationStep(budget_ms);
+		} while (Delta(sim_start) < budget_ms);
+	} else {
+		while (!out_of_budget && time_owed >= SIMULATION_TICK_MS) {
+			time_owed -= SIMULATION_TICK_MS;
+			for (int i = speed_factor(_game_control.speed); i > 0 && !out_of_budget; i--) {
+				RunSimulationStep(budget_ms);
+				out_of_budget = Delta(sim_start) >= budget_ms;
+			}
+		}
+	}
+	ReportBudgetOverruns(budget_ms);
+
+	/* The renderer displays moving objects between their last two tick positions, using the
+	 * not yet simulated time as interpolation factor. Turbo frames always show the newest state.
+	 */
+	_simulation_render_alpha = (_game_control.speed == GSP_TURBO) ? 1.0 : static_cast<double>(time_owed) / SIMULATION_TICK_MS;
+	_profiler.EndFrame();
 }
 
 int _max_autosaves(3);  ///< How many autosave files are retained at most. 0 disables autosave.
@@ -112,6 +336,8 @@ void Autosave()
 {
 	if (_max_autosaves < 1) return;
 
+	FinishPendingSave(); // The previous autosave may still be being written.
+
 	/* Roll old autosaves. */
 	for (int i = _max_autosaves - 1; i > 0; --i) {
 		std::string old_file = AutosaveFilename(i);
@@ -121,7 +347,7 @@ void Autosave()
 		}
 	}
 
-	_game_control.SaveGame(AutosaveFilename(1));
+	_game_control.SaveGame(AutosaveFilename(1), true, true);
 }
 
 GameControl::GameControl()
@@ -131,6 +357,8 @@ GameControl::GameControl()
 	speed(GSP_1),
 	action_test_mode(false),
 	next_action(GCA_NONE),
+	save_in_background(false),
+	save_as_delta(false),
 	next_scenario(nullptr)
 {
 }
@@ -162,6 +390,8 @@ void GameControl::Initialize(const std::string &fname, GameMode game_mode)
 void GameControl::Uninitialize()
 {
 	this->ShutdownLevel();
+	_path_job_queue.Shutdown();
+	FinishPendingSave();
 }
 
 /**
@@ -170,6 +400,7 @@ void GameControl::Uninitialize()
  */
 void GameControl::RunAction()
 {
+	if (_replay_recorder.Active()) _replay_recorder.LogAction(this->next_action);
 	switch (this->next_action) {
 		case GCA_LAUNCH_EDITOR:
 			this->ShutdownLevel();
@@ -200,7 +431,8 @@ void GameControl::RunAction()
 		}
 
 		case GCA_SAVE_GAME:
-			SaveGameFile(this->fname.c_str());
+			FlushDayBoundaryWork(); // Queued rollover work is not serialized, complete it before taking the snapshot.
+			SaveGameFile(this->fname.c_str(), this->save_in_background, this->save_as_delta);
 			break;
 
 		case GCA_MENU: {
@@ -262,10 +494,14 @@ void GameControl::LoadGame(const std::string &fname, GameMode game_mode)
 /**
  * Prepare for a #GCA_SAVE_GAME action.
  * @param fname Name of the file to write.
+ * @param background Write to disk on a background thread, so the game is only paused while serializing.
+ * @param delta Allow writing a differential save against the last full snapshot.
  */
-void GameControl::SaveGame(const std::string &fname)
+void GameControl::SaveGame(const std::string &fname, bool background, bool delta)
 {
 	this->fname = fname;
+	this->save_in_background = background;
+	this->save_as_delta = delta;
 	this->next_action = GCA_SAVE_GAME;
 }
 
@@ -304,6 +540,8 @@ void GameControl::StartLevel(GameMode game_mode)
 {
 	_game_mode_mgr.SetGameMode(game_mode);
 	this->speed = game_mode != GM_PLAY ? GSP_PAUSE : GSP_1;
+	_simulation_tick = 0;
+	if (game_mode == GM_PLAY && !this->main_menu) _replay_recorder.Start();  // Starts only when a recording was requested.
 
 	XYZPoint32 view_pos(_world.GetXSize() * 256 / 2, _world.GetYSize() * 256 / 2, 8 * 256);
 	ShowMainDisplay(view_pos);
@@ -320,6 +558,8 @@ void GameControl::StartLevel(GameMode game_mode)
 /** Shutdown the game interaction. */
 void GameControl::ShutdownLevel()
 {
+	_replay_recorder.Stop();
+	_boundary_work.clear();  // Rollover work queued for this level must not run in the next one.
 	/// \todo Clean out the game data structures.
 	_game_mode_mgr.SetGameMode(GM_NONE);
 	_window_manager.CloseAllWindows();
@@ -328,6 +568,10 @@ void GameControl::ShutdownLevel()
 	_game_observer.Uninitialize();
 	_guests.Uninitialize();
 	_staff.Uninitialize();
+	_density_map.Clear();
+	_path_graph.Invalidate();  // The next level has a different path network.
+	_exit_flow_field.Invalidate();
+	_path_network_version++;   // Version-checked route caches drop their answers.
 }
 
 GameModeManager::GameModeManager() : game_mode(GM_NONE)
@@ -19,10 +19,23 @@ struct MissionScenario;
 void OnNewDay();
 void OnNewMonth();
 void OnNewYear();
-void OnNewFrame(uint32 frame_delay);
+void FlushDayBoundaryWork();
+void OnNewFrame(uint32 frame_delay, uint32 time_elapsed);
 void Autosave();
 extern int _max_autosaves;
 
+/**
+ * Length of one fixed simulation tick, in milliseconds.
+ * The simulation always advances in ticks of this length, independent of the render frame
+ * cadence, so a given sequence of inputs produces the same game state on every machine.
+ */
+constexpr uint32 SIMULATION_TICK_MS = 30;
+
+void RunSimulationTick();
+
+extern double _simulation_render_alpha;
+extern uint32 _simulation_tick;
+
 /** Actions that can be run to control the game. */
 enum GameControlAction {
 	GCA_NONE,           ///< No action to run.
@@ -42,6 +55,7 @@ enum GameSpeed {
 	GSP_2,      ///< Double speed.
 	GSP_4,      ///< 4 times speed.
 	GSP_8,      ///< 8 times speed.
+	GSP_TURBO,  ///< As many simulation ticks as fit in the frame's simulation budget.
 	GSP_COUNT   ///< Number of entries.
 };
 DECLARE_POSTFIX_INCREMENT(GameSpeed)
@@ -79,7 +93,7 @@ public:
 	void NewGame(MissionScenario *scenario);
 	void LaunchEditor();
 	void LoadGame(const std::string &fname, GameMode game_mode);
-	void SaveGame(const std::string &fname);
+	void SaveGame(const std::string &fname, bool background = false, bool delta = false);
 	void QuitGame();
 
 	bool running;    ///< Indicates whether a game is currently running.
@@ -97,6 +111,8 @@ private:
 
 	GameControlAction next_action; ///< Action game control wants to run, or #GCA_NONE for 'no action'.
 	std::string fname;             ///< Filename of game level to load from or save to.
+	bool save_in_background;       ///< Whether the next #GCA_SAVE_GAME action should write to disk on a background thread.
+	bool save_as_delta;            ///< Whether the next #GCA_SAVE_GAME action may write a differential save.
 	MissionScenario *next_scenario;  ///< The scenario to load on the next tick.
 };
 
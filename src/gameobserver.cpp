@@ -14,10 +14,69 @@
 #include "finances.h"
 #include "messages.h"
 #include "people.h"
+#include "ride_type.h"
 #include "window.h"
 
 GameObserver _game_observer;  ///< Game observer instance.
 
+StatisticsSeries::StatisticsSeries()
+{
+	this->Clear();
+}
+
+/** Remove all samples from the series. */
+void StatisticsSeries::Clear()
+{
+	this->values.clear();
+	this->next = 0;
+	this->minimum = 0;
+	this->maximum = 0;
+}
+
+/**
+ * Append the sample of a new day to the series, dropping the oldest sample when full.
+ * @param value Sample value to append.
+ */
+void StatisticsSeries::Append(int value)
+{
+	bool evicted_extreme = false;
+	if (this->values.size() < STATISTICS_HISTORY) {
+		this->values.push_back(value);
+	} else {
+		const int evicted = this->values[this->next];
+		evicted_extreme = (evicted == this->minimum || evicted == this->maximum);
+		this->values[this->next] = value;
+	}
+	this->next = (this->next + 1) % STATISTICS_HISTORY;
+
+	if (this->values.size() == 1) {
+		this->minimum = value;
+		this->maximum = value;
+	} else if (evicted_extreme) {
+		/* The dropped sample may have been the only extreme value; rescan the window. */
+		this->minimum = this->values[0];
+		this->maximum = this->values[0];
+		for (int v : this->values) {
+			this->minimum = std::min(this->minimum, v);
+			this->maximum = std::max(this->maximum, v);
+		}
+	} else {
+		this->minimum = std::min(this->minimum, value);
+		this->maximum = std::max(this->maximum, value);
+	}
+}
+
+/**
+ * Get a stored sample.
+ * @param index Age of the sample; \c 0 is the most recent one.
+ * @return The sample value.
+ */
+int StatisticsSeries::operator[](uint index) const
+{
+	assert(index < this->values.size());
+	return this->values[(this->next + this->values.size() - 1 - index) % this->values.size()];
+}
+
 /** Initialize all data structures at the start of a new game. */
 void GameObserver::Initialize()
 {
@@ -30,8 +89,8 @@ void GameObserver::Initialize()
 /** Clean up all data structures at the end of a game. */
 void GameObserver::Uninitialize()
 {
-	this->guest_count_history.clear();
-	this->park_rating_history.clear();
+	this->guest_count_history.Clear();
+	this->park_rating_history.Clear();
 	this->current_guest_count = 0;
 	this->current_park_rating = 0;
 	this->max_guests = 0;
@@ -44,10 +103,8 @@ void GameObserver::OnNewDay()
 {
 	this->current_park_rating = CalculateParkRating();
 
-	this->guest_count_history.push_front(this->current_guest_count);
-	this->park_rating_history.push_front(this->current_park_rating);
-	while (this->guest_count_history.size() > STATISTICS_HISTORY) this->guest_count_history.pop_back();
-	while (this->park_rating_history.size() > STATISTICS_HISTORY) this->park_rating_history.pop_back();
+	this->guest_count_history.Append(this->current_guest_count);
+	this->park_rating_history.Append(this->current_park_rating);
 
 	if (this->won_lost == SCENARIO_RUNNING) _scenario.objective->OnNewDay();
 }
@@ -111,13 +168,22 @@ void GameObserver::SetParkOpen(bool open)
 
 /**
  * Recalculate the park's current park rating.
+ * All inputs are aggregates that are kept in sync by guest and ride state change
+ * events, so the computation stays cheap regardless of park size.
  * @return The park rating, from 0 (terrible) to #MAX_PARK_RATING (perfect).
- * @todo Implement this.
  */
 int GameObserver::CalculateParkRating()
 {
-	Random r;
-	return std::max(0, std::min(MAX_PARK_RATING, this->current_park_rating + r.Uniform(60) - 20));
+	int rating;
+	const uint32 in_park = _guests.CountGuestsInPark();
+	if (in_park > 0) {
+		/* Average happiness of the guests in the park (0..100) carries most of the rating. */
+		rating = 7 * static_cast<int>(_guests.GetParkHappinessSum() / in_park);
+	} else {
+		rating = 350;  // An empty park is neither great nor terrible.
+	}
+	rating += std::min(25 * _rides_manager.CountOpenRides(), 300);  // Variety of open rides, up to 300 points.
+	return std::max(0, std::min(MAX_PARK_RATING, rating));
 }
 
 static const uint32 CURRENT_VERSION_GOBS = 1;   ///< Currently supported version of the GOBS Pattern.
@@ -134,7 +200,7 @@ void GameObserver::Load(Loader &ldr)
 			this->Initialize();
 			break;
 
-		case 1:
+		case 1: {
 			this->won_lost = static_cast<WonLost>(ldr.GetByte());
 			this->park_open = ldr.GetByte() > 0;
 			this->park_name = ldr.GetText();
@@ -142,9 +208,15 @@ void GameObserver::Load(Loader &ldr)
 			this->current_park_rating = ldr.GetWord();
 			this->current_guest_count = ldr.GetLong();
 			this->max_guests = ldr.GetLong();
-			for (size_t i = ldr.GetLong(); i > 0; --i) this->park_rating_history.push_back(ldr.GetWord());
-			for (size_t i = ldr.GetLong(); i > 0; --i) this->guest_count_history.push_back(ldr.GetLong());
+			/* The samples are saved most recent first, while the series appends chronologically. */
+			std::vector<int> samples(ldr.GetLong());
+			for (int &v : samples) v = ldr.GetWord();
+			for (auto it = samples.rbegin(); it != samples.rend(); ++it) this->park_rating_history.Append(*it);
+			samples.resize(ldr.GetLong());
+			for (int &v : samples) v = ldr.GetLong();
+			for (auto it = samples.rbegin(); it != samples.rend(); ++it) this->guest_count_history.Append(*it);
 			break;
+		}
 
 		default:
 			ldr.VersionMismatch(version, CURRENT_VERSION_GOBS);
@@ -169,10 +241,10 @@ void GameObserver::Save(Saver &svr)
 	svr.PutLong(this->current_guest_count);
 	svr.PutLong(this->max_guests);
 
-	svr.PutLong(this->park_rating_history.size());
-	for (int i : this->park_rating_history) svr.PutWord(i);
-	svr.PutLong(this->guest_count_history.size());
-	for (int i : this->guest_count_history) svr.PutLong(i);
+	svr.PutLong(this->park_rating_history.Count());
+	for (uint i = 0; i < this->park_rating_history.Count(); i++) svr.PutWord(this->park_rating_history[i]);
+	svr.PutLong(this->guest_count_history.Count());
+	for (uint i = 0; i < this->guest_count_history.Count(); i++) svr.PutLong(this->guest_count_history[i]);
 
 	svr.EndPattern();
 }
@@ -10,8 +10,8 @@
 #ifndef GAMEOBSERVER_H
 #define GAMEOBSERVER_H
 
-#include <deque>
 #include <string>
+#include <vector>
 
 #include "dates.h"
 #include "money.h"
@@ -28,6 +28,55 @@ static const unsigned STATISTICS_HISTORY = DaysInParkYear();  ///< Number of day
 static const int MAX_PARK_RATING = 1000;                      ///< Best possible park rating.
 static const int PARK_ENTRANCE_FEE_STEP_SIZE = 100;           ///< Step size of changing the park's entrance fee in the GUI.
 
+/**
+ * Fixed-capacity ring buffer of one day-sampled park statistic.
+ * Appending overwrites the oldest sample once #STATISTICS_HISTORY samples are stored, and the
+ * extremes of the stored window are kept up to date, so drawing a graph of the series needs
+ * no pass over the data to find its scale.
+ */
+class StatisticsSeries {
+public:
+	StatisticsSeries();
+
+	void Clear();
+	void Append(int value);
+
+	/**
+	 * Get the number of stored samples.
+	 * @return Number of samples, at most #STATISTICS_HISTORY.
+	 */
+	inline uint Count() const
+	{
+		return this->values.size();
+	}
+
+	/**
+	 * Get the smallest stored sample value.
+	 * @return The smallest value, \c 0 if the series is empty.
+	 */
+	inline int Minimum() const
+	{
+		return this->minimum;
+	}
+
+	/**
+	 * Get the largest stored sample value.
+	 * @return The largest value, \c 0 if the series is empty.
+	 */
+	inline int Maximum() const
+	{
+		return this->maximum;
+	}
+
+	int operator[](uint index) const;
+
+private:
+	std::vector<int> values;  ///< Stored samples, a ring buffer of at most #STATISTICS_HISTORY entries.
+	uint next;                ///< Index in #values where the next sample will be written.
+	int minimum;              ///< Smallest value in #values, \c 0 while the series is empty.
+	int maximum;              ///< Largest value in #values, \c 0 while the series is empty.
+};
+
 /** Keeps track of a scenario's progress. */
 class GameObserver {
 public:
@@ -53,8 +102,8 @@ public:
 	uint16 current_park_rating;  ///< The park rating right now.
 	uint32 max_guests;           ///< The highest number of guests who have ever been in the park.
 
-	std::deque<int> guest_count_history;  ///< Guest count over the last year (most recent first).
-	std::deque<int> park_rating_history;  ///< Park rating over the last year (most recent first).
+	StatisticsSeries guest_count_history;  ///< Guest count over the last year.
+	StatisticsSeries park_rating_history;  ///< Park rating over the last year.
 	WonLost won_lost;                     ///< Whether the scenario has been won or lost.
 
 private:
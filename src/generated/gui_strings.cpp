@@ -0,0 +1,379 @@
+// GUI string table for FreeRCT
+// Automagically generated, do not edit
+
+/** Gui string table array. */
+const char *_gui_strings_table[] = {
+	"TITLEBAR_TIP",
+	"LANGUAGE_NAME",
+	"NOT_AVAILABLE",
+	"DATETIME_FORMAT",
+	"DATE_FORMAT",
+	"MONTH_JANUARY",
+	"MONTH_FEBRUARY",
+	"MONTH_MARCH",
+	"MONTH_APRIL",
+	"MONTH_MAY",
+	"MONTH_JUNE",
+	"MONTH_JULY",
+	"MONTH_AUGUST",
+	"MONTH_SEPTEMBER",
+	"MONTH_OCTOBER",
+	"MONTH_NOVEMBER",
+	"MONTH_DECEMBER",
+	"OBJECTIVE_TIMEOUT_BEFORE",
+	"OBJECTIVE_TIMEOUT_EXACT",
+	"OBJECTIVE_TIMEOUT_NONE",
+	"OBJECTIVE_STRICT",
+	"OBJECTIVETEXT_NONE",
+	"OBJECTIVETEXT_GUESTS",
+	"OBJECTIVETEXT_PARK_RATING",
+	"OBJECTIVETEXT_PARK_VALUE",
+	"NUMBERED_INSTANCE_NAME",
+	"RESOLUTION",
+	"GUEST_NAME",
+	"NR_DAYS",
+	"APPLY",
+	"INCREASE_BUTTON",
+	"DECREASE_BUTTON",
+	"TOOLBAR_GUI_DROPDOWN_MAIN",
+	"MAIN_MENU_SAVE",
+	"MAIN_MENU_SETTINGS",
+	"MAIN_MENU_LOAD",
+	"MAIN_MENU_MENU",
+	"MAIN_MENU_QUIT",
+	"MAIN_MENU_NEW_GAME",
+	"MAIN_MENU_LAUNCH_EDITOR",
+	"TOOLBAR_GUI_DROPDOWN_SPEED",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_TOOLTIP",
+	"TOOLBAR_GUI_DROPDOWN_VIEW",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_TOOLTIP",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_PAUSE",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_1",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_2",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_4",
+	"TOOLBAR_GUI_DROPDOWN_SPEED_8",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_MINIMAP",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_ZOOM_OUT",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_ZOOM_IN",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_GRID",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_UNDERGROUND",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_UNDERWATER",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_WIRE_RIDES",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_WIRE_SCENERY",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_PEOPLE",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_SUPPORTS",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_SURFACES",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_FOUNDATIONS",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_RIDES",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_PATHS",
+	"TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_TERRAIN",
+	"TOOLBAR_GUI_PATHS",
+	"TOOLBAR_GUI_TOOLTIP_BUILD_PATHS",
+	"TOOLBAR_GUI_RIDE_SELECT",
+	"TOOLBAR_GUI_TOOLTIP_RIDE_SELECT",
+	"TOOLBAR_GUI_FENCE",
+	"TOOLBAR_GUI_TOOLTIP_FENCE",
+	"TOOLBAR_GUI_SCENERY",
+	"TOOLBAR_GUI_TOOLTIP_SCENERY",
+	"TOOLBAR_GUI_PATH_OBJECTS",
+	"TOOLBAR_GUI_TOOLTIP_PATH_OBJECTS",
+	"TOOLBAR_GUI_TERRAFORM",
+	"TOOLBAR_GUI_TOOLTIP_TERRAFORM",
+	"TOOLBAR_GUI_FINANCES",
+	"TOOLBAR_GUI_TOOLTIP_FINANCES",
+	"TOOLBAR_GUI_STAFF",
+	"TOOLBAR_GUI_TOOLTIP_STAFF",
+	"TOOLBAR_GUI_INBOX",
+	"TOOLBAR_GUI_TOOLTIP_INBOX",
+	"TOOLBAR_GUI_PARK",
+	"TOOLBAR_GUI_TOOLTIP_PARK",
+	"BOTTOMBAR_GUESTCOUNT",
+	"NO_NAME",
+	"DEFAULT_SCENARIO_NAME",
+	"DEFAULT_SCENARIO_DESCR",
+	"QUIT_CAPTION",
+	"QUIT_MESSAGE",
+	"RETURN_CAPTION",
+	"RETURN_MESSAGE",
+	"CONFIRM_YES",
+	"CONFIRM_NO",
+	"ERROR_MESSAGE_CAPTION",
+	"ERROR_MESSAGE_SPRITE",
+	"ERROR_MESSAGE_HEADING_BUILD",
+	"ERROR_MESSAGE_HEADING_REMOVE",
+	"ERROR_MESSAGE_HEADING_COST",
+	"ERROR_MESSAGE_HEADING_RETURN",
+	"ERROR_MESSAGE_BAD_LOCATION",
+	"ERROR_MESSAGE_SLOPE",
+	"ERROR_MESSAGE_UNDERGROUND",
+	"ERROR_MESSAGE_OCCUPIED",
+	"ERROR_MESSAGE_EXPENSIVE",
+	"ERROR_MESSAGE_UNREMOVABLE",
+	"ERROR_MESSAGE_UNOWNED_LAND",
+	"ERROR_MESSAGE_PAUSED",
+	"PERSON_STATUS_WANDER",
+	"PERSON_STATUS_HEADING_TO_RIDE",
+	"PERSON_STATUS_GOING_HOME",
+	"PERSON_STATUS_INSPECTING",
+	"PERSON_STATUS_REPAIRING",
+	"PERSON_STATUS_WATERING",
+	"PERSON_STATUS_EMPTYING",
+	"PERSON_STATUS_SWEEPING",
+	"GUEST_INFO_MONEY",
+	"GUEST_INFO_MONEY_SPENT",
+	"GUEST_INFO_HAPPINESS",
+	"GUEST_INFO_HUNGER",
+	"GUEST_INFO_THIRST",
+	"GUEST_INFO_WASTE",
+	"GUEST_INFO_NAUSEA",
+	"GUEST_INFO_ITEMS",
+	"ITEM_NONE",
+	"ITEM_MAP",
+	"ITEM_UMBRELLA",
+	"ITEM_WRAPPER",
+	"STAFF_MANAGEMENT_TITLE",
+	"STAFF_SALARY",
+	"STAFF_DISMISS",
+	"STAFF_HIRE",
+	"STAFF_TITLE_NAME",
+	"STAFF_TITLE_STATUS",
+	"STAFF_NAME_MECHANIC",
+	"STAFF_NAME_HANDYMAN",
+	"STAFF_NAME_GUARD",
+	"STAFF_NAME_ENTERTAINER",
+	"STAFF_CATEGORY_MECHANICS",
+	"STAFF_CATEGORY_HANDYMEN",
+	"STAFF_CATEGORY_GUARDS",
+	"STAFF_CATEGORY_ENTERTAINERS",
+	"PATH_GUI_TITLE",
+	"PATH_GUI_LONG",
+	"PATH_GUI_BUY",
+	"PATH_GUI_REMOVE",
+	"PATH_GUI_LONG_TIP",
+	"PATH_GUI_BUY_TIP",
+	"PATH_GUI_BULLDOZER_TIP",
+	"PATH_GUI_SLOPE_DOWN_TIP",
+	"PATH_GUI_SLOPE_FLAT_TIP",
+	"PATH_GUI_SLOPE_UP_TIP",
+	"PATH_GUI_FORWARD",
+	"PATH_GUI_BACKWARD",
+	"PATH_GUI_FORWARD_TIP",
+	"PATH_GUI_BACKWARD_TIP",
+	"PATH_GUI_NW_DIRECTION_TIP",
+	"PATH_GUI_NE_DIRECTION_TIP",
+	"PATH_GUI_SW_DIRECTION_TIP",
+	"PATH_GUI_SE_DIRECTION_TIP",
+	"PATH_GUI_NORMAL_PATH",
+	"PATH_GUI_QUEUE_PATH",
+	"PATH_GUI_SINGLE",
+	"PATH_GUI_DIRECTIONAL",
+	"PATH_GUI_SINGLE_TIP",
+	"PATH_GUI_DIRECTIONAL_TIP",
+	"RIDE_SELECT_TITLE",
+	"RIDE_SELECT_SHOPS",
+	"RIDE_SELECT_SHOPS_TOOLTIP",
+	"RIDE_SELECT_GENTLE",
+	"RIDE_SELECT_GENTLE_TOOLTIP",
+	"RIDE_SELECT_THRILL",
+	"RIDE_SELECT_THRILL_TOOLTIP",
+	"RIDE_SELECT_WET",
+	"RIDE_SELECT_WET_TOOLTIP",
+	"RIDE_SELECT_COASTER",
+	"RIDE_SELECT_COASTER_TOOLTIP",
+	"RIDE_SELECT_RIDE",
+	"RIDE_SELECT_RIDE_TOOLTIP",
+	"RIDE_SELECT_ROT_POS_TOOLTIP",
+	"RIDE_SELECT_ROT_NEG_TOOLTIP",
+	"RIDE_SELECT_CUSTOM_DESIGN",
+	"RIDE_SELECT_NO_DESIGNS",
+	"RIDE_MANAGER_ENTRANCE_FEE_TEXT",
+	"RIDE_MANAGER_RIDE_NAME_TEXT",
+	"RIDE_MANAGER_BROKEN_DOWN",
+	"RIDE_MANAGER_RELIABILITY",
+	"RIDE_MANAGER_MAINTENANCE_TEXT",
+	"RIDE_MANAGER_MAINTENANCE_NEVER",
+	"RIDE_MANAGER_MIN_IDLE_TEXT",
+	"RIDE_MANAGER_MAX_IDLE_TEXT",
+	"RIDE_MANAGER_EXCITEMENT",
+	"RIDE_MANAGER_INTENSITY",
+	"RIDE_MANAGER_NAUSEA",
+	"RIDE_MANAGER_RATING_VERY_LOW",
+	"RIDE_MANAGER_RATING_LOW",
+	"RIDE_MANAGER_RATING_MEDIUM",
+	"RIDE_MANAGER_RATING_HIGH",
+	"RIDE_MANAGER_RATING_VERY_HIGH",
+	"RIDE_MANAGER_RATING_EXTREME",
+	"RIDE_MANAGER_RATING_NOT_YET_CALCULATED",
+	"SHOP_MANAGER_TITLE",
+	"SHOP_MANAGER_COST_PRICE_TEXT",
+	"SHOP_MANAGER_SELLING_PRICE_TEXT",
+	"SHOP_MANAGER_ITEMS_SOLD_TEXT",
+	"SHOP_MANAGER_ITEM_PROFIT_TEXT",
+	"SHOP_MANAGER_SELL_PROFIT_TEXT",
+	"SHOP_MANAGER_SHOP_COST_TEXT",
+	"SHOP_MANAGER_TOTAL_PROFIT_TEXT",
+	"GENTLE_THRILL_RIDES_MANAGER_TITLE",
+	"GENTLE_RIDES_MANAGER_TITLE",
+	"THRILL_RIDES_MANAGER_TITLE",
+	"GENTLE_THRILL_RIDES_MANAGER_CYCLES_TEXT",
+	"GENTLE_THRILL_RIDES_MANAGER_MONTHLY_COST_TEXT",
+	"FENCE_TITLE",
+	"FENCE_TYPE_WOOD",
+	"FENCE_TYPE_HEDGE",
+	"FENCE_TYPE_BRICK",
+	"SCENERY_TITLE",
+	"SCENERY_ROTATE_POS",
+	"SCENERY_ROTATE_NEG",
+	"SCENERY_CATEGORY_TREES",
+	"SCENERY_CATEGORY_FLOWERBEDS",
+	"SCENERY_CATEGORY_FOUNTAINS",
+	"PATH_OBJECTS_TITLE",
+	"PATH_OBJECTS_BENCH",
+	"PATH_OBJECTS_BIN",
+	"PATH_OBJECTS_LAMP",
+	"TERRAFORM_TITLE",
+	"TERRAFORM_ADD_TEXT",
+	"TERRAFORM_ADD_TOOLTIP",
+	"TERRAFORM_SUB_TEXT",
+	"TERRAFORM_SUB_TOOLTIP",
+	"TERRAFORM_LEVEL_TEXT",
+	"TERRAFORM_MOVE_TEXT",
+	"TERRAFORM_SMOOTH_TEXT",
+	"TERRAFORM_FLATTEN_TEXT",
+	"TERRAFORM_OWNER_UNCHANGED_TEXT",
+	"TERRAFORM_OWNER_NONE_TEXT",
+	"TERRAFORM_OWNER_PARK_TEXT",
+	"TERRAFORM_OWNER_SALE_TEXT",
+	"PARK_MANAGEMENT_TAB_GENERAL",
+	"PARK_MANAGEMENT_TAB_GENERAL_TOOLTIP",
+	"PARK_MANAGEMENT_TAB_GUESTS",
+	"PARK_MANAGEMENT_TAB_GUESTS_TOOLTIP",
+	"PARK_MANAGEMENT_TAB_RATING",
+	"PARK_MANAGEMENT_TAB_RATING_TOOLTIP",
+	"PARK_MANAGEMENT_TAB_OBJECTIVE",
+	"PARK_MANAGEMENT_TAB_OBJECTIVE_TOOLTIP",
+	"PARK_MANAGEMENT_TAB_AWARDS",
+	"PARK_MANAGEMENT_TAB_AWARDS_TOOLTIP",
+	"PARK_MANAGEMENT_RATING",
+	"PARK_MANAGEMENT_NO_AWARDS",
+	"PARK_MANAGEMENT_PARKNAME",
+	"PARK_MANAGEMENT_ENTRANCE_FEE",
+	"PARK_MANAGEMENT_MAX_GUESTS",
+	"PARK_MANAGEMENT_SOLVED",
+	"PARK_MANAGEMENT_OBJECTIVE_GUESTS",
+	"PARK_MANAGEMENT_OBJECTIVE_RATING",
+	"PARK_MANAGEMENT_OBJECTIVE_PARK_VALUE",
+	"PARK_MANAGEMENT_OBJECTIVE_DROP_POLICY",
+	"PARK_MANAGEMENT_OBJECTIVE_DATE",
+	"PARK_MANAGEMENT_OBJECTIVE_DATE_NOT_EXACT",
+	"MINIMAP_TITLE",
+	"MINIMAP_CROWDS",
+	"FINANCES_TITLE",
+	"FINANCES_RIDE_CONSTRUCTION_TEXT",
+	"FINANCES_RIDE_RUNNING_TEXT",
+	"FINANCES_LAND_PURCHASE_TEXT",
+	"FINANCES_LANDSCAPING_TEXT",
+	"FINANCES_PARK_TICKETS_TEXT",
+	"FINANCES_RIDE_TICKETS_TEXT",
+	"FINANCES_SHOP_SALES_TEXT",
+	"FINANCES_SHOP_STOCK_TEXT",
+	"FINANCES_FOOD_SALES_TEXT",
+	"FINANCES_FOOD_STOCK_TEXT",
+	"FINANCES_STAFF_WAGES_TEXT",
+	"FINANCES_MARKETING_TEXT",
+	"FINANCES_RESEARCH_TEXT",
+	"FINANCES_LOAN_INTEREST_TEXT",
+	"FINANCES_TOTAL_TEXT",
+	"FINANCES_CASH",
+	"FINANCES_MAX_LOAN",
+	"FINANCES_CURRENT_LOAN",
+	"FINANCES_LOAN_INTEREST",
+	"FINANCES_LOAN_INTEREST_VALUE",
+	"FINANCES_PARK_VALUE",
+	"FINANCES_COMPANY_VALUE",
+	"FINANCES_PARK_VALUE_VALUE",
+	"INBOX_TITLE",
+	"MESSAGE_NEW_RIDE",
+	"MESSAGE_SCENARIO_WON",
+	"MESSAGE_SCENARIO_LOST",
+	"MESSAGE_BROKEN_DOWN",
+	"MESSAGE_REPAIRED",
+	"MESSAGE_CRASH_NO_DEAD",
+	"MESSAGE_CRASH_WITH_DEAD",
+	"MESSAGE_BAD_RATING",
+	"MESSAGE_GUEST_LOST",
+	"MESSAGE_COMPLAIN_QUEUE",
+	"MESSAGE_COMPLAIN_HUNGRY",
+	"MESSAGE_COMPLAIN_THIRSTY",
+	"MESSAGE_COMPLAIN_TOILET",
+	"MESSAGE_COMPLAIN_LITTER",
+	"MESSAGE_CHEAP_FEE",
+	"MESSAGE_AWARD_WON",
+	"MESSAGE_NEGATIVE_AWARD",
+	"MESSAGE_COMPLAIN_VANDALISM",
+	"MESSAGE_SAVE_COMPLETE",
+	"MESSAGE_SAVE_FAILED",
+	"COASTER_BUILD_LEFT_BEND_TOOLTIP",
+	"COASTER_BUILD_NO_BEND_TOOLTIP",
+	"COASTER_BUILD_RIGHT_BEND_TOOLTIP",
+	"COASTER_BUILD_BANK_LEFT_TOOLTIP",
+	"COASTER_BUILD_BANK_NONE_TOOLTIP",
+	"COASTER_BUILD_BANK_RIGHT_TOOLTIP",
+	"COASTER_BUILD_BUY_TOOLTIP",
+	"COASTER_MANAGER_NUMBER_TRAINS",
+	"COASTER_MANAGER_NUMBER_CARS",
+	"COASTER_MANAGER_EDIT",
+	"COASTER_MANAGER_SAVE_DESIGN",
+	"COASTER_MANAGER_NO_GRAPHS_YET",
+	"COASTER_MANAGER_GRAPH_SPEED",
+	"COASTER_MANAGER_GRAPH_VERT_G",
+	"COASTER_MANAGER_GRAPH_HORZ_G",
+	"COASTER_MANAGER_GRAPH_TOOLTIP_SPEED",
+	"COASTER_MANAGER_GRAPH_TOOLTIP_VERT_G",
+	"COASTER_MANAGER_GRAPH_TOOLTIP_HORZ_G",
+	"ENTITY_REMOVE",
+	"ENTITY_REMOVE_TOOLTIP",
+	"ENTITY_REMOVE_CAPTION",
+	"ENTITY_REMOVE_YES",
+	"ENTITY_REMOVE_NO",
+	"ENTITY_REMOVE_MESSAGE",
+	"ENTITY_REMOVE_COST",
+	"PLACE_ENTRANCE",
+	"PLACE_ENTRANCE_TOOLTIP",
+	"PLACE_EXIT",
+	"PLACE_EXIT_TOOLTIP",
+	"CHOOSE_ENTRANCE",
+	"CHOOSE_ENTRANCE_TOOLTIP",
+	"CHOOSE_EXIT",
+	"CHOOSE_EXIT_TOOLTIP",
+	"RIDE_BUILD_TITLEBAR_SHOP",
+	"RIDE_BUILD_TITLEBAR_GENTLE",
+	"RIDE_BUILD_TITLEBAR_THRILL",
+	"RIDE_BUILD_ROTATE_TOOLTIP",
+	"RIDE_BUILD_DISPLAY_TOOLTIP",
+	"RIDE_BUILD_NAME_TEXT",
+	"RIDE_BUILD_COST_TEXT",
+	"MONEY_CURRENCY_SYMBOL",
+	"MONEY_THOUSANDS_SEPARATOR",
+	"MONEY_DECIMAL_SEPARATOR",
+	"SETTING_TITLE",
+	"SETTING_LANGUAGE",
+	"SETTING_LANGUAGE_TOOLTIP",
+	"SETTING_RESOLUTION",
+	"SETTING_RESOLUTION_TOOLTIP",
+	"SCENARIO_SELECT_TITLE",
+	"SCENARIO_SELECT_NO_MISSIONS",
+	"SCENARIO_SELECT_UNLOCK",
+	"SCENARIO_SELECT_SOLVED",
+	"LOADSAVE_LOAD",
+	"LOADSAVE_SAVE",
+	"LOADSAVE_CANCEL",
+	"LOADSAVE_DELETE",
+	"LOADSAVE_CONFIRM_TITLE",
+	"LOADSAVE_CONFIRM_DELETE",
+	"LOADSAVE_CONFIRM_OVERWRITE",
+	"LOADSAVE_COLUMN_FILE",
+	"LOADSAVE_COLUMN_TIME",
+	"LOADSAVE_COLUMN_NAME",
+	nullptr,
+};
@@ -0,0 +1,385 @@
+// GUI string table for FreeRCT
+// Automagically generated, do not edit
+
+#ifndef GUI_STRING_TABLE_H
+#define GUI_STRING_TABLE_H
+
+/** Gui strings table. */
+enum GuiStrings {
+	GUI_TITLEBAR_TIP = STR_GENERIC_GUI_START,
+	GUI_LANGUAGE_NAME,
+	GUI_NOT_AVAILABLE,
+	GUI_DATETIME_FORMAT,
+	GUI_DATE_FORMAT,
+	GUI_MONTH_JANUARY,
+	GUI_MONTH_FEBRUARY,
+	GUI_MONTH_MARCH,
+	GUI_MONTH_APRIL,
+	GUI_MONTH_MAY,
+	GUI_MONTH_JUNE,
+	GUI_MONTH_JULY,
+	GUI_MONTH_AUGUST,
+	GUI_MONTH_SEPTEMBER,
+	GUI_MONTH_OCTOBER,
+	GUI_MONTH_NOVEMBER,
+	GUI_MONTH_DECEMBER,
+	GUI_OBJECTIVE_TIMEOUT_BEFORE,
+	GUI_OBJECTIVE_TIMEOUT_EXACT,
+	GUI_OBJECTIVE_TIMEOUT_NONE,
+	GUI_OBJECTIVE_STRICT,
+	GUI_OBJECTIVETEXT_NONE,
+	GUI_OBJECTIVETEXT_GUESTS,
+	GUI_OBJECTIVETEXT_PARK_RATING,
+	GUI_OBJECTIVETEXT_PARK_VALUE,
+	GUI_NUMBERED_INSTANCE_NAME,
+	GUI_RESOLUTION,
+	GUI_GUEST_NAME,
+	GUI_NR_DAYS,
+	GUI_APPLY,
+	GUI_INCREASE_BUTTON,
+	GUI_DECREASE_BUTTON,
+	GUI_TOOLBAR_GUI_DROPDOWN_MAIN,
+	GUI_MAIN_MENU_SAVE,
+	GUI_MAIN_MENU_SETTINGS,
+	GUI_MAIN_MENU_LOAD,
+	GUI_MAIN_MENU_MENU,
+	GUI_MAIN_MENU_QUIT,
+	GUI_MAIN_MENU_NEW_GAME,
+	GUI_MAIN_MENU_LAUNCH_EDITOR,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_TOOLTIP,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_TOOLTIP,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_PAUSE,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_1,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_2,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_4,
+	GUI_TOOLBAR_GUI_DROPDOWN_SPEED_8,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_MINIMAP,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_ZOOM_OUT,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_ZOOM_IN,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_GRID,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_UNDERGROUND,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_UNDERWATER,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_WIRE_RIDES,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_WIRE_SCENERY,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_PEOPLE,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_SUPPORTS,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_SURFACES,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HIDE_FOUNDATIONS,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_RIDES,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_PATHS,
+	GUI_TOOLBAR_GUI_DROPDOWN_VIEW_HEIGHT_TERRAIN,
+	GUI_TOOLBAR_GUI_PATHS,
+	GUI_TOOLBAR_GUI_TOOLTIP_BUILD_PATHS,
+	GUI_TOOLBAR_GUI_RIDE_SELECT,
+	GUI_TOOLBAR_GUI_TOOLTIP_RIDE_SELECT,
+	GUI_TOOLBAR_GUI_FENCE,
+	GUI_TOOLBAR_GUI_TOOLTIP_FENCE,
+	GUI_TOOLBAR_GUI_SCENERY,
+	GUI_TOOLBAR_GUI_TOOLTIP_SCENERY,
+	GUI_TOOLBAR_GUI_PATH_OBJECTS,
+	GUI_TOOLBAR_GUI_TOOLTIP_PATH_OBJECTS,
+	GUI_TOOLBAR_GUI_TERRAFORM,
+	GUI_TOOLBAR_GUI_TOOLTIP_TERRAFORM,
+	GUI_TOOLBAR_GUI_FINANCES,
+	GUI_TOOLBAR_GUI_TOOLTIP_FINANCES,
+	GUI_TOOLBAR_GUI_STAFF,
+	GUI_TOOLBAR_GUI_TOOLTIP_STAFF,
+	GUI_TOOLBAR_GUI_INBOX,
+	GUI_TOOLBAR_GUI_TOOLTIP_INBOX,
+	GUI_TOOLBAR_GUI_PARK,
+	GUI_TOOLBAR_GUI_TOOLTIP_PARK,
+	GUI_BOTTOMBAR_GUESTCOUNT,
+	GUI_NO_NAME,
+	GUI_DEFAULT_SCENARIO_NAME,
+	GUI_DEFAULT_SCENARIO_DESCR,
+	GUI_QUIT_CAPTION,
+	GUI_QUIT_MESSAGE,
+	GUI_RETURN_CAPTION,
+	GUI_RETURN_MESSAGE,
+	GUI_CONFIRM_YES,
+	GUI_CONFIRM_NO,
+	GUI_ERROR_MESSAGE_CAPTION,
+	GUI_ERROR_MESSAGE_SPRITE,
+	GUI_ERROR_MESSAGE_HEADING_BUILD,
+	GUI_ERROR_MESSAGE_HEADING_REMOVE,
+	GUI_ERROR_MESSAGE_HEADING_COST,
+	GUI_ERROR_MESSAGE_HEADING_RETURN,
+	GUI_ERROR_MESSAGE_BAD_LOCATION,
+	GUI_ERROR_MESSAGE_SLOPE,
+	GUI_ERROR_MESSAGE_UNDERGROUND,
+	GUI_ERROR_MESSAGE_OCCUPIED,
+	GUI_ERROR_MESSAGE_EXPENSIVE,
+	GUI_ERROR_MESSAGE_UNREMOVABLE,
+	GUI_ERROR_MESSAGE_UNOWNED_LAND,
+	GUI_ERROR_MESSAGE_PAUSED,
+	GUI_PERSON_STATUS_WANDER,
+	GUI_PERSON_STATUS_HEADING_TO_RIDE,
+	GUI_PERSON_STATUS_GOING_HOME,
+	GUI_PERSON_STATUS_INSPECTING,
+	GUI_PERSON_STATUS_REPAIRING,
+	GUI_PERSON_STATUS_WATERING,
+	GUI_PERSON_STATUS_EMPTYING,
+	GUI_PERSON_STATUS_SWEEPING,
+	GUI_GUEST_INFO_MONEY,
+	GUI_GUEST_INFO_MONEY_SPENT,
+	GUI_GUEST_INFO_HAPPINESS,
+	GUI_GUEST_INFO_HUNGER,
+	GUI_GUEST_INFO_THIRST,
+	GUI_GUEST_INFO_WASTE,
+	GUI_GUEST_INFO_NAUSEA,
+	GUI_GUEST_INFO_ITEMS,
+	GUI_ITEM_NONE,
+	GUI_ITEM_MAP,
+	GUI_ITEM_UMBRELLA,
+	GUI_ITEM_WRAPPER,
+	GUI_STAFF_MANAGEMENT_TITLE,
+	GUI_STAFF_SALARY,
+	GUI_STAFF_DISMISS,
+	GUI_STAFF_HIRE,
+	GUI_STAFF_TITLE_NAME,
+	GUI_STAFF_TITLE_STATUS,
+	GUI_STAFF_NAME_MECHANIC,
+	GUI_STAFF_NAME_HANDYMAN,
+	GUI_STAFF_NAME_GUARD,
+	GUI_STAFF_NAME_ENTERTAINER,
+	GUI_STAFF_CATEGORY_MECHANICS,
+	GUI_STAFF_CATEGORY_HANDYMEN,
+	GUI_STAFF_CATEGORY_GUARDS,
+	GUI_STAFF_CATEGORY_ENTERTAINERS,
+	GUI_PATH_GUI_TITLE,
+	GUI_PATH_GUI_LONG,
+	GUI_PATH_GUI_BUY,
+	GUI_PATH_GUI_REMOVE,
+	GUI_PATH_GUI_LONG_TIP,
+	GUI_PATH_GUI_BUY_TIP,
+	GUI_PATH_GUI_BULLDOZER_TIP,
+	GUI_PATH_GUI_SLOPE_DOWN_TIP,
+	GUI_PATH_GUI_SLOPE_FLAT_TIP,
+	GUI_PATH_GUI_SLOPE_UP_TIP,
+	GUI_PATH_GUI_FORWARD,
+	GUI_PATH_GUI_BACKWARD,
+	GUI_PATH_GUI_FORWARD_TIP,
+	GUI_PATH_GUI_BACKWARD_TIP,
+	GUI_PATH_GUI_NW_DIRECTION_TIP,
+	GUI_PATH_GUI_NE_DIRECTION_TIP,
+	GUI_PATH_GUI_SW_DIRECTION_TIP,
+	GUI_PATH_GUI_SE_DIRECTION_TIP,
+	GUI_PATH_GUI_NORMAL_PATH,
+	GUI_PATH_GUI_QUEUE_PATH,
+	GUI_PATH_GUI_SINGLE,
+	GUI_PATH_GUI_DIRECTIONAL,
+	GUI_PATH_GUI_SINGLE_TIP,
+	GUI_PATH_GUI_DIRECTIONAL_TIP,
+	GUI_RIDE_SELECT_TITLE,
+	GUI_RIDE_SELECT_SHOPS,
+	GUI_RIDE_SELECT_SHOPS_TOOLTIP,
+	GUI_RIDE_SELECT_GENTLE,
+	GUI_RIDE_SELECT_GENTLE_TOOLTIP,
+	GUI_RIDE_SELECT_THRILL,
+	GUI_RIDE_SELECT_THRILL_TOOLTIP,
+	GUI_RIDE_SELECT_WET,
+	GUI_RIDE_SELECT_WET_TOOLTIP,
+	GUI_RIDE_SELECT_COASTER,
+	GUI_RIDE_SELECT_COASTER_TOOLTIP,
+	GUI_RIDE_SELECT_RIDE,
+	GUI_RIDE_SELECT_RIDE_TOOLTIP,
+	GUI_RIDE_SELECT_ROT_POS_TOOLTIP,
+	GUI_RIDE_SELECT_ROT_NEG_TOOLTIP,
+	GUI_RIDE_SELECT_CUSTOM_DESIGN,
+	GUI_RIDE_SELECT_NO_DESIGNS,
+	GUI_RIDE_MANAGER_ENTRANCE_FEE_TEXT,
+	GUI_RIDE_MANAGER_RIDE_NAME_TEXT,
+	GUI_RIDE_MANAGER_BROKEN_DOWN,
+	GUI_RIDE_MANAGER_RELIABILITY,
+	GUI_RIDE_MANAGER_MAINTENANCE_TEXT,
+	GUI_RIDE_MANAGER_MAINTENANCE_NEVER,
+	GUI_RIDE_MANAGER_MIN_IDLE_TEXT,
+	GUI_RIDE_MANAGER_MAX_IDLE_TEXT,
+	GUI_RIDE_MANAGER_EXCITEMENT,
+	GUI_RIDE_MANAGER_INTENSITY,
+	GUI_RIDE_MANAGER_NAUSEA,
+	GUI_RIDE_MANAGER_RATING_VERY_LOW,
+	GUI_RIDE_MANAGER_RATING_LOW,
+	GUI_RIDE_MANAGER_RATING_MEDIUM,
+	GUI_RIDE_MANAGER_RATING_HIGH,
+	GUI_RIDE_MANAGER_RATING_VERY_HIGH,
+	GUI_RIDE_MANAGER_RATING_EXTREME,
+	GUI_RIDE_MANAGER_RATING_NOT_YET_CALCULATED,
+	GUI_SHOP_MANAGER_TITLE,
+	GUI_SHOP_MANAGER_COST_PRICE_TEXT,
+	GUI_SHOP_MANAGER_SELLING_PRICE_TEXT,
+	GUI_SHOP_MANAGER_ITEMS_SOLD_TEXT,
+	GUI_SHOP_MANAGER_ITEM_PROFIT_TEXT,
+	GUI_SHOP_MANAGER_SELL_PROFIT_TEXT,
+	GUI_SHOP_MANAGER_SHOP_COST_TEXT,
+	GUI_SHOP_MANAGER_TOTAL_PROFIT_TEXT,
+	GUI_GENTLE_THRILL_RIDES_MANAGER_TITLE,
+	GUI_GENTLE_RIDES_MANAGER_TITLE,
+	GUI_THRILL_RIDES_MANAGER_TITLE,
+	GUI_GENTLE_THRILL_RIDES_MANAGER_CYCLES_TEXT,
+	GUI_GENTLE_THRILL_RIDES_MANAGER_MONTHLY_COST_TEXT,
+	GUI_FENCE_TITLE,
+	GUI_FENCE_TYPE_WOOD,
+	GUI_FENCE_TYPE_HEDGE,
+	GUI_FENCE_TYPE_BRICK,
+	GUI_SCENERY_TITLE,
+	GUI_SCENERY_ROTATE_POS,
+	GUI_SCENERY_ROTATE_NEG,
+	GUI_SCENERY_CATEGORY_TREES,
+	GUI_SCENERY_CATEGORY_FLOWERBEDS,
+	GUI_SCENERY_CATEGORY_FOUNTAINS,
+	GUI_PATH_OBJECTS_TITLE,
+	GUI_PATH_OBJECTS_BENCH,
+	GUI_PATH_OBJECTS_BIN,
+	GUI_PATH_OBJECTS_LAMP,
+	GUI_TERRAFORM_TITLE,
+	GUI_TERRAFORM_ADD_TEXT,
+	GUI_TERRAFORM_ADD_TOOLTIP,
+	GUI_TERRAFORM_SUB_TEXT,
+	GUI_TERRAFORM_SUB_TOOLTIP,
+	GUI_TERRAFORM_LEVEL_TEXT,
+	GUI_TERRAFORM_MOVE_TEXT,
+	GUI_TERRAFORM_SMOOTH_TEXT,
+	GUI_TERRAFORM_FLATTEN_TEXT,
+	GUI_TERRAFORM_OWNER_UNCHANGED_TEXT,
+	GUI_TERRAFORM_OWNER_NONE_TEXT,
+	GUI_TERRAFORM_OWNER_PARK_TEXT,
+	GUI_TERRAFORM_OWNER_SALE_TEXT,
+	GUI_PARK_MANAGEMENT_TAB_GENERAL,
+	GUI_PARK_MANAGEMENT_TAB_GENERAL_TOOLTIP,
+	GUI_PARK_MANAGEMENT_TAB_GUESTS,
+	GUI_PARK_MANAGEMENT_TAB_GUESTS_TOOLTIP,
+	GUI_PARK_MANAGEMENT_TAB_RATING,
+	GUI_PARK_MANAGEMENT_TAB_RATING_TOOLTIP,
+	GUI_PARK_MANAGEMENT_TAB_OBJECTIVE,
+	GUI_PARK_MANAGEMENT_TAB_OBJECTIVE_TOOLTIP,
+	GUI_PARK_MANAGEMENT_TAB_AWARDS,
+	GUI_PARK_MANAGEMENT_TAB_AWARDS_TOOLTIP,
+	GUI_PARK_MANAGEMENT_RATING,
+	GUI_PARK_MANAGEMENT_NO_AWARDS,
+	GUI_PARK_MANAGEMENT_PARKNAME,
+	GUI_PARK_MANAGEMENT_ENTRANCE_FEE,
+	GUI_PARK_MANAGEMENT_MAX_GUESTS,
+	GUI_PARK_MANAGEMENT_SOLVED,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_GUESTS,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_RATING,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_PARK_VALUE,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_DROP_POLICY,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_DATE,
+	GUI_PARK_MANAGEMENT_OBJECTIVE_DATE_NOT_EXACT,
+	GUI_MINIMAP_TITLE,
+	GUI_MINIMAP_CROWDS,
+	GUI_FINANCES_TITLE,
+	GUI_FINANCES_RIDE_CONSTRUCTION_TEXT,
+	GUI_FINANCES_RIDE_RUNNING_TEXT,
+	GUI_FINANCES_LAND_PURCHASE_TEXT,
+	GUI_FINANCES_LANDSCAPING_TEXT,
+	GUI_FINANCES_PARK_TICKETS_TEXT,
+	GUI_FINANCES_RIDE_TICKETS_TEXT,
+	GUI_FINANCES_SHOP_SALES_TEXT,
+	GUI_FINANCES_SHOP_STOCK_TEXT,
+	GUI_FINANCES_FOOD_SALES_TEXT,
+	GUI_FINANCES_FOOD_STOCK_TEXT,
+	GUI_FINANCES_STAFF_WAGES_TEXT,
+	GUI_FINANCES_MARKETING_TEXT,
+	GUI_FINANCES_RESEARCH_TEXT,
+	GUI_FINANCES_LOAN_INTEREST_TEXT,
+	GUI_FINANCES_TOTAL_TEXT,
+	GUI_FINANCES_CASH,
+	GUI_FINANCES_MAX_LOAN,
+	GUI_FINANCES_CURRENT_LOAN,
+	GUI_FINANCES_LOAN_INTEREST,
+	GUI_FINANCES_LOAN_INTEREST_VALUE,
+	GUI_FINANCES_PARK_VALUE,
+	GUI_FINANCES_COMPANY_VALUE,
+	GUI_FINANCES_PARK_VALUE_VALUE,
+	GUI_INBOX_TITLE,
+	GUI_MESSAGE_NEW_RIDE,
+	GUI_MESSAGE_SCENARIO_WON,
+	GUI_MESSAGE_SCENARIO_LOST,
+	GUI_MESSAGE_BROKEN_DOWN,
+	GUI_MESSAGE_REPAIRED,
+	GUI_MESSAGE_CRASH_NO_DEAD,
+	GUI_MESSAGE_CRASH_WITH_DEAD,
+	GUI_MESSAGE_BAD_RATING,
+	GUI_MESSAGE_GUEST_LOST,
+	GUI_MESSAGE_COMPLAIN_QUEUE,
+	GUI_MESSAGE_COMPLAIN_HUNGRY,
+	GUI_MESSAGE_COMPLAIN_THIRSTY,
+	GUI_MESSAGE_COMPLAIN_TOILET,
+	GUI_MESSAGE_COMPLAIN_LITTER,
+	GUI_MESSAGE_CHEAP_FEE,
+	GUI_MESSAGE_AWARD_WON,
+	GUI_MESSAGE_NEGATIVE_AWARD,
+	GUI_MESSAGE_COMPLAIN_VANDALISM,
+	GUI_MESSAGE_SAVE_COMPLETE,
+	GUI_MESSAGE_SAVE_FAILED,
+	GUI_COASTER_BUILD_LEFT_BEND_TOOLTIP,
+	GUI_COASTER_BUILD_NO_BEND_TOOLTIP,
+	GUI_COASTER_BUILD_RIGHT_BEND_TOOLTIP,
+	GUI_COASTER_BUILD_BANK_LEFT_TOOLTIP,
+	GUI_COASTER_BUILD_BANK_NONE_TOOLTIP,
+	GUI_COASTER_BUILD_BANK_RIGHT_TOOLTIP,
+	GUI_COASTER_BUILD_BUY_TOOLTIP,
+	GUI_COASTER_MANAGER_NUMBER_TRAINS,
+	GUI_COASTER_MANAGER_NUMBER_CARS,
+	GUI_COASTER_MANAGER_EDIT,
+	GUI_COASTER_MANAGER_SAVE_DESIGN,
+	GUI_COASTER_MANAGER_NO_GRAPHS_YET,
+	GUI_COASTER_MANAGER_GRAPH_SPEED,
+	GUI_COASTER_MANAGER_GRAPH_VERT_G,
+	GUI_COASTER_MANAGER_GRAPH_HORZ_G,
+	GUI_COASTER_MANAGER_GRAPH_TOOLTIP_SPEED,
+	GUI_COASTER_MANAGER_GRAPH_TOOLTIP_VERT_G,
+	GUI_COASTER_MANAGER_GRAPH_TOOLTIP_HORZ_G,
+	GUI_ENTITY_REMOVE,
+	GUI_ENTITY_REMOVE_TOOLTIP,
+	GUI_ENTITY_REMOVE_CAPTION,
+	GUI_ENTITY_REMOVE_YES,
+	GUI_ENTITY_REMOVE_NO,
+	GUI_ENTITY_REMOVE_MESSAGE,
+	GUI_ENTITY_REMOVE_COST,
+	GUI_PLACE_ENTRANCE,
+	GUI_PLACE_ENTRANCE_TOOLTIP,
+	GUI_PLACE_EXIT,
+	GUI_PLACE_EXIT_TOOLTIP,
+	GUI_CHOOSE_ENTRANCE,
+	GUI_CHOOSE_ENTRANCE_TOOLTIP,
+	GUI_CHOOSE_EXIT,
+	GUI_CHOOSE_EXIT_TOOLTIP,
+	GUI_RIDE_BUILD_TITLEBAR_SHOP,
+	GUI_RIDE_BUILD_TITLEBAR_GENTLE,
+	GUI_RIDE_BUILD_TITLEBAR_THRILL,
+	GUI_RIDE_BUILD_ROTATE_TOOLTIP,
+	GUI_RIDE_BUILD_DISPLAY_TOOLTIP,
+	GUI_RIDE_BUILD_NAME_TEXT,
+	GUI_RIDE_BUILD_COST_TEXT,
+	GUI_MONEY_CURRENCY_SYMBOL,
+	GUI_MONEY_THOUSANDS_SEPARATOR,
+	GUI_MONEY_DECIMAL_SEPARATOR,
+	GUI_SETTING_TITLE,
+	GUI_SETTING_LANGUAGE,
+	GUI_SETTING_LANGUAGE_TOOLTIP,
+	GUI_SETTING_RESOLUTION,
+	GUI_SETTING_RESOLUTION_TOOLTIP,
+	GUI_SCENARIO_SELECT_TITLE,
+	GUI_SCENARIO_SELECT_NO_MISSIONS,
+	GUI_SCENARIO_SELECT_UNLOCK,
+	GUI_SCENARIO_SELECT_SOLVED,
+	GUI_LOADSAVE_LOAD,
+	GUI_LOADSAVE_SAVE,
+	GUI_LOADSAVE_CANCEL,
+	GUI_LOADSAVE_DELETE,
+	GUI_LOADSAVE_CONFIRM_TITLE,
+	GUI_LOADSAVE_CONFIRM_DELETE,
+	GUI_LOADSAVE_CONFIRM_OVERWRITE,
+	GUI_LOADSAVE_COLUMN_FILE,
+	GUI_LOADSAVE_COLUMN_TIME,
+	GUI_LOADSAVE_COLUMN_NAME,
+
+	GUI_STRING_TABLE_END,
+};
+
+#endif
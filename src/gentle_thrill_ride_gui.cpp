@@ -534,6 +534,10 @@ void GentleThrillRideManagerWindow::SelectorMouseMoveEvent(Viewport *vp, const P
 
 	entrance_exit_placement.SetPosition(location.x, location.y);
 	if (this->ride->CanPlaceEntranceOrExit(location, this->is_placing_entrance)) {
+		/* The selector still displays this location, don't rebuild it every mouse move. */
+		const XYZPoint16 &displayed = this->is_placing_entrance ? this->ride->temp_entrance_pos : this->ride->temp_exit_pos;
+		if (displayed == location && entrance_exit_placement.area.width == 1) return;
+
 		if (this->is_placing_entrance) {
 			this->ride->temp_entrance_pos = location;
 		} else {
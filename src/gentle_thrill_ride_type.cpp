@@ -289,8 +289,8 @@ void GentleThrillRideInstance::SetEntrancePos(const XYZPoint16& pos)
 	if (this->entrance_pos != XYZPoint16::invalid()) {
 		for (int16 h = 0; h < height; ++h) {
 			Voxel *voxel = _world.GetCreateVoxel(this->entrance_pos + XYZPoint16(0, 0, h), false);
-			if (voxel != nullptr && voxel->instance != SRI_FREE) {
-				assert(voxel->instance == index);
+			if (voxel != nullptr && voxel->GetInstance() != SRI_FREE) {
+				assert(voxel->GetInstance() == index);
 				voxel->ClearInstances();
 			}
 		}
@@ -303,7 +303,7 @@ void GentleThrillRideInstance::SetEntrancePos(const XYZPoint16& pos)
 		for (int16 h = 0; h < height; ++h) {
 			const XYZPoint16 p = this->entrance_pos + XYZPoint16(0, 0, h);
 			Voxel *voxel = _world.GetCreateVoxel(p, true);
-			assert(voxel != nullptr && voxel->instance == SRI_FREE);
+			assert(voxel != nullptr && voxel->GetInstance() == SRI_FREE);
 			voxel->SetInstance(index);
 			if (h == 0) {
 				edges = GetEntranceDirections(p);
@@ -327,8 +327,8 @@ void GentleThrillRideInstance::SetExitPos(const XYZPoint16& pos)
 	if (this->exit_pos != XYZPoint16::invalid()) {
 		for (int16 h = 0; h < height; ++h) {
 			Voxel *voxel = _world.GetCreateVoxel(this->exit_pos + XYZPoint16(0, 0, h), false);
-			if (voxel != nullptr && voxel->instance != SRI_FREE) {
-				assert(voxel->instance == index);
+			if (voxel != nullptr && voxel->GetInstance() != SRI_FREE) {
+				assert(voxel->GetInstance() == index);
 				voxel->ClearInstances();
 			}
 		}
@@ -341,7 +341,7 @@ void GentleThrillRideInstance::SetExitPos(const XYZPoint16& pos)
 		for (int16 h = 0; h < height; ++h) {
 			const XYZPoint16 p = this->exit_pos + XYZPoint16(0, 0, h);
 			Voxel *voxel = _world.GetCreateVoxel(p, true);
-			assert(voxel != nullptr && voxel->instance == SRI_FREE);
+			assert(voxel != nullptr && voxel->GetInstance() == SRI_FREE);
 			voxel->SetInstance(index);
 			if (h == 0) {
 				edges = GetEntranceDirections(p);
@@ -384,7 +384,7 @@ void GentleThrillRideInstance::RecalculateRatings()
 				Voxel *voxel = _world.GetCreateVoxel(this->vox_pos + XYZPoint16(location.x, location.y, h), false);
 				if (voxel == nullptr) continue;
 
-				if (voxel->instance == SRI_SCENERY) scenery++;                 // Bonus for building among flower beds or forests.
+				if (voxel->GetInstance() == SRI_SCENERY) scenery++;                 // Bonus for building among flower beds or forests.
 				if (IsImplodedSteepSlope(voxel->GetGroundSlope())) scenery++;  // Bonus for building among hills.
 				/* \todo Add boni for accurately mowed lawns and building near water. */
 			}
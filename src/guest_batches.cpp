@@ -58,16 +58,6 @@ void GuestData::Save(Saver &svr)
 	svr.EndPattern();
 }
 
-/**
- * Return whether the batch is entirely empty.
- * @return Whether the batch is entirely empty.
- */
-bool GuestBatch::IsEmpty() const
-{
-	for (const GuestData &val : this->guests) if (!val.IsEmpty()) return false;
-	return true;
-}
-
 /**
  * Configure a batch of guests.
  * @param batch_size Number of guests in a batch.
@@ -82,6 +72,8 @@ void GuestBatch::Configure(int batch_size)
 	this->state = BST_EMPTY;
 	this->remaining = 0;
 	this->gate = 0;
+	this->first_occupied = 0;
+	this->occupied = 0;
 }
 
 /**
@@ -92,39 +84,31 @@ void GuestBatch::Configure(int batch_size)
  */
 bool GuestBatch::AddGuest(int guest, TileEdge entry)
 {
-	for (GuestData &val : this->guests) {
-		if (!val.IsEmpty()) continue;
+	const int seat = this->first_occupied + this->occupied;
+	if (seat >= static_cast<int>(this->guests.size())) return false;
 
-		val.Set(guest, entry);
-		return true;
-	}
-	return false;
+	this->guests[seat].Set(guest, entry);
+	this->occupied++;
+	return true;
 }
 
 /**
- * Start the ride (make it #BST_RUNNING).
- * @param ride_time Length of the ride in milli-seconds.
+ * Get the guest that is first in line to leave the batch.
+ * @return The first occupied entry, or \c nullptr if the batch is empty.
  */
-void GuestBatch::Start(int ride_time)
+const GuestData *GuestBatch::FirstGuest() const
 {
-	this->state = BST_RUNNING;
-	this->remaining = ride_time;
+	return (this->occupied == 0) ? nullptr : &this->guests[this->first_occupied];
 }
 
-/**
- * Update the state of the ride due to passage of time.
- * @param delay Amount of time that has passed (milli-seconds).
- */
-void GuestBatch::OnAnimate(int delay)
+/** Remove the guest that is first in line from the batch. */
+void GuestBatch::RemoveFirstGuest()
 {
-	if (this->state != BST_RUNNING) return;
-
-	if (this->remaining > delay) {
-		this->remaining -= delay;
-	} else {
-		this->remaining = 0;
-		this->state = BST_FINISHED;
-	}
+	assert(this->occupied > 0);
+	this->guests[this->first_occupied].Clear();
+	this->first_occupied++;
+	this->occupied--;
+	if (this->occupied == 0) this->first_occupied = 0;
 }
 
 void GuestBatch::Load(Loader &ldr)
@@ -136,6 +120,16 @@ void GuestBatch::Load(Loader &ldr)
 	this->remaining = ldr.GetLong();
 	this->gate = ldr.GetWord();
 	for (GuestData &g : this->guests) g.Load(ldr);
+
+	/* Recover the seat occupancy administration; guests enter and leave in seat order,
+	 * so the occupied seats form one consecutive range. */
+	this->first_occupied = 0;
+	this->occupied = 0;
+	for (int i = 0; i < static_cast<int>(this->guests.size()); i++) {
+		if (this->guests[i].IsEmpty()) continue;
+		if (this->occupied == 0) this->first_occupied = i;
+		this->occupied++;
+	}
 	ldr.ClosePattern();
 }
 
@@ -173,24 +167,92 @@ void OnRideGuests::Configure(int batch_size, int num_batches)
 
 	this->batch_size = batch_size;
 	this->num_batches = num_batches;
+	this->RebuildStateLists();
+}
+
+/**
+ * Append a batch to the tail of the list of its state.
+ * @param index Index number of the batch.
+ */
+void OnRideGuests::LinkBatch(int index)
+{
+	GuestBatch &gb = this->batches[index];
+	gb.prev_in_state = this->state_tail[gb.state];
+	gb.next_in_state = -1;
+	if (gb.prev_in_state >= 0) {
+		this->batches[gb.prev_in_state].next_in_state = index;
+	} else {
+		this->state_head[gb.state] = index;
+	}
+	this->state_tail[gb.state] = index;
+}
+
+/**
+ * Remove a batch from the list of its state.
+ * @param index Index number of the batch.
+ */
+void OnRideGuests::UnlinkBatch(int index)
+{
+	GuestBatch &gb = this->batches[index];
+	if (gb.prev_in_state >= 0) {
+		this->batches[gb.prev_in_state].next_in_state = gb.next_in_state;
+	} else {
+		this->state_head[gb.state] = gb.next_in_state;
+	}
+	if (gb.next_in_state >= 0) {
+		this->batches[gb.next_in_state].prev_in_state = gb.prev_in_state;
+	} else {
+		this->state_tail[gb.state] = gb.prev_in_state;
+	}
+}
+
+/** Rebuild the per-state batch lists from the batch states, in index order. */
+void OnRideGuests::RebuildStateLists()
+{
+	std::fill_n(this->state_head, static_cast<int>(BST_COUNT), -1);
+	std::fill_n(this->state_tail, static_cast<int>(BST_COUNT), -1);
+	for (int i = 0; i < static_cast<int>(this->batches.size()); i++) this->LinkBatch(i);
+}
+
+/**
+ * Change the state of a batch, moving it to the tail of the list of its new state.
+ * @param index Index number of the batch.
+ * @param state New state of the batch.
+ */
+void OnRideGuests::SetBatchState(int index, BatchState state)
+{
+	GuestBatch &gb = this->batches[index];
+	if (gb.state == state) return;
+
+	this->UnlinkBatch(index);
+	gb.state = state;
+	this->LinkBatch(index);
+}
+
+/**
+ * Start the ride for a batch (make it #BST_RUNNING).
+ * @param index Index number of the batch.
+ * @param ride_time Length of the ride in milli-seconds.
+ */
+void OnRideGuests::StartBatch(int index, int ride_time)
+{
+	this->SetBatchState(index, BST_RUNNING);
+	this->batches[index].remaining = ride_time;
 }
 
 /**
  * Get the index of the next batch with a given state.
+ * Batches are returned in the order they entered the state. When changing the state of the
+ * returned batch, query the next batch before making the change.
  * @param state State of the batch to look for.
- * @param start Last returned index number, or \c -1 to look from the first batch.
- * @return Index of the first batch with the given state after \a start, or \c -1 if no such batch exists.
+ * @param start Last returned index number, or \c -1 to get the first batch of the state.
+ * @return Index of the next batch with the given state, or \c -1 if no such batch exists.
  */
 int OnRideGuests::GetNextBatch(BatchState state, int start)
 {
-	start++;
-	while (start < static_cast<int>(this->batches.size())) {
-		const GuestBatch &gb = this->batches.at(start);
-		if (gb.state == state) return start;
-
-		start++;
-	}
-	return -1;
+	if (start < 0) return this->state_head[state];
+	assert(this->batches[start].state == state);
+	return this->batches[start].next_in_state;
 }
 
 /**
@@ -199,12 +261,17 @@ int OnRideGuests::GetNextBatch(BatchState state, int start)
  */
 void OnRideGuests::OnAnimate(int delay)
 {
-	int start = -1;
-	for (;;) {
-		start = this->GetNextBatch(BST_RUNNING, start);
-		if (start < 0) break;
-
-		this->batches.at(start).OnAnimate(delay);
+	int index = this->state_head[BST_RUNNING];
+	while (index >= 0) {
+		GuestBatch &gb = this->batches[index];
+		const int next = gb.next_in_state;  // The batch may leave the running list below.
+		if (gb.remaining > delay) {
+			gb.remaining -= delay;
+		} else {
+			gb.remaining = 0;
+			this->SetBatchState(index, BST_FINISHED);
+		}
+		index = next;
 	}
 }
 
@@ -218,6 +285,7 @@ void OnRideGuests::Load(Loader &ldr)
 	this->num_batches = ldr.GetWord();
 	this->Configure(this->batch_size, this->num_batches);
 	for (GuestBatch &b : this->batches) b.Load(ldr);
+	this->RebuildStateLists();
 	ldr.ClosePattern();
 }
 
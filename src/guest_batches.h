@@ -48,27 +48,51 @@ enum BatchState {
 	BST_RUNNING,   ///< Batch is running the ride.
 	BST_FINISHED,  ///< Batch has finished running, guests are waiting for unloading.
 	BST_UNLOADING, ///< Batch is unloading.
+
+	BST_COUNT,     ///< Number of batch states.
 };
 
 
 /** A batch (a group) of guests riding together. */
 struct GuestBatch {
-	std::vector<GuestData> guests; ///< Guests in the batch.
-	BatchState state; ///< State of the batch.
+	std::vector<GuestData> guests; ///< Guests in the batch. Occupied seats form one consecutive range.
+	BatchState state; ///< State of the batch. Managed by #OnRideGuests, use #OnRideGuests::SetBatchState to change it.
 	int remaining;    ///< Amount of time until the end of the ride (in milli-seconds). Positive means time is running,
 	                  ///< \c 0 means the batch has reached the end.
 	int gate;         ///< Gate used by the guests to enter the ride (or for any other purpose as the ride sees fit).
+	int next_in_state; ///< Index of the next batch in the same state, or \c -1. Managed by #OnRideGuests.
+	int prev_in_state; ///< Index of the previous batch in the same state, or \c -1. Managed by #OnRideGuests.
+
+	/**
+	 * Return whether the batch is entirely empty.
+	 * @return Whether the batch is entirely empty.
+	 */
+	inline bool IsEmpty() const
+	{
+		return this->occupied == 0;
+	}
+
+	/**
+	 * Return whether all seats of the batch are taken.
+	 * @return Whether the batch is entirely full.
+	 */
+	inline bool IsFull() const
+	{
+		return this->occupied == static_cast<int>(this->guests.size());
+	}
 
-	bool IsEmpty() const;
 	void Configure(int batch_size);
 
 	bool AddGuest(int guest, TileEdge entry);
-	void Start(int ride_time);
-
-	void OnAnimate(int delay);
+	const GuestData *FirstGuest() const;
+	void RemoveFirstGuest();
 
 	void Load(Loader &ldr);
 	void Save(Saver &svr);
+
+private:
+	int first_occupied; ///< Seat of the first occupied entry (guests leave in seat order).
+	int occupied;       ///< Number of occupied seats.
 };
 
 /** Class holding the guests of a ride as a number of batches with a size. */
@@ -88,9 +112,12 @@ public:
 		return this->batches[index];
 	}
 
+	void SetBatchState(int index, BatchState state);
+	void StartBatch(int index, int ride_time);
+
 	/**
 	 * Get an empty batch.
-	 * @param start Index where the last search ended, or \c -1 to search from the start.
+	 * @param start Index of the last returned batch, or \c -1 to get the first one.
 	 * @return Index of a free batch, or \c -1 if no free batch exists.
 	 */
 	inline int GetFreeBatch(int start = -1)
@@ -100,7 +127,7 @@ public:
 
 	/**
 	 * Get a batch that is being loaded.
-	 * @param start Index where the last search ended, or \c -1 to search from the start.
+	 * @param start Index of the last returned batch, or \c -1 to get the first one.
 	 * @return Index of a loading batch, or \c -1 if no loading batch exists.
 	 */
 	inline int GetLoadingBatch(int start = -1)
@@ -110,7 +137,7 @@ public:
 
 	/**
 	 * Get a batch that has finished the ride.
-	 * @param start Index where the last search ended, or \c -1 to search from the start.
+	 * @param start Index of the last returned batch, or \c -1 to get the first one.
 	 * @return Index of a finished batch, or \c -1 if no finished batch exists.
 	 */
 	inline int GetFinishedBatch(int start = -1)
@@ -120,7 +147,7 @@ public:
 
 	/**
 	 * Get a batch that is being unloaded.
-	 * @param start Index where the last search ended, or \c -1 to search from the start.
+	 * @param start Index of the last returned batch, or \c -1 to get the first one.
 	 * @return Index of an unloading batch, or \c -1 if no unloading batch exists.
 	 */
 	inline int GetUnloadingBatch(int start = -1)
@@ -139,6 +166,12 @@ public:
 
 private:
 	int GetNextBatch(BatchState state, int start);
+	void LinkBatch(int index);
+	void UnlinkBatch(int index);
+	void RebuildStateLists();
+
+	int state_head[BST_COUNT]; ///< Index of the first batch in each state, or \c -1.
+	int state_tail[BST_COUNT]; ///< Index of the last batch in each state, or \c -1.
 };
 
 #endif
@@ -14,6 +14,107 @@
 #include "math_func.h"
 #include "video.h"
 
+#include <map>
+#include <tuple>
+#include <vector>
+
+/** A border frame assembled from its sprites, kept for reuse. */
+struct AssembledFrame {
+	GLuint texture;      ///< Texture holding the assembled frame.
+	Rectangle32 extent;  ///< Painted area, relative to the top-left of the content rectangle.
+};
+
+/** Previously assembled border frames, keyed by border sprites, content size, and colour range. */
+static std::map<std::tuple<const ImageData * const *, uint32, uint32, ColourRange>, AssembledFrame> _frame_cache;
+
+/**
+ * Blend a sprite into an RGBA canvas, repeating the sprite as needed to fill the destination area.
+ * @param canvas Pixel buffer covering the \a canvas_rect area of the frame, rows from top to bottom.
+ * @param canvas_rect Area of the frame covered by the canvas.
+ * @param img Sprite to blend.
+ * @param rc Recolouring to apply.
+ * @param dest Area of the frame to fill.
+ */
+static void BlendSprite(uint8 *canvas, const Rectangle32 &canvas_rect, const ImageData *img, const Recolouring &rc, const Rectangle32 &dest)
+{
+	const uint8 *src = img->GetRecoloured(GS_NORMAL, rc);
+	const int x_min = std::max(dest.base.x, canvas_rect.base.x);
+	const int y_min = std::max(dest.base.y, canvas_rect.base.y);
+	const int x_max = std::min(dest.base.x + static_cast<int>(dest.width),  canvas_rect.base.x + static_cast<int>(canvas_rect.width));
+	const int y_max = std::min(dest.base.y + static_cast<int>(dest.height), canvas_rect.base.y + static_cast<int>(canvas_rect.height));
+	for (int y = y_min; y < y_max; ++y) {
+		const uint8 *src_row = src + ((y - dest.base.y) % img->height) * img->width * 4;
+		uint8 *dst_row = canvas + (y - canvas_rect.base.y) * canvas_rect.width * 4;
+		for (int x = x_min; x < x_max; ++x) {
+			const uint8 *s = src_row + ((x - dest.base.x) % img->width) * 4;
+			uint8 *d = dst_row + (x - canvas_rect.base.x) * 4;
+			const uint8 a = s[3];
+			if (a == TRANSPARENT) continue;
+			if (a == OPAQUE) {
+				std::copy_n(s, 4, d);
+			} else {
+				for (int i = 0; i < 3; ++i) d[i] = (s[i] * a + d[i] * (OPAQUE - a)) / OPAQUE;
+				d[3] = a + d[3] * (OPAQUE - a) / OPAQUE;
+			}
+		}
+	}
+}
+
+/**
+ * Assemble the border sprites of a widget frame into a single texture.
+ * @param spr_base Border sprites to use.
+ * @param width Width of the content rectangle.
+ * @param height Height of the content rectangle.
+ * @param rc Recolouring to apply.
+ * @return The assembled frame.
+ */
+static AssembledFrame AssembleBorderFrame(const ImageData * const *spr_base, int width, int height, const Recolouring &rc)
+{
+	/* Collect the parts of the frame in drawing order, relative to the top-left of the content rectangle. */
+	struct FramePart {
+		const ImageData *img;  ///< Sprite of this part.
+		Rectangle32 dest;      ///< Area filled by this part.
+	};
+	std::vector<FramePart> parts;
+
+	const ImageData *img = spr_base[WBS_MIDDLE_MIDDLE];
+	if (img != nullptr) parts.push_back({img, Rectangle32(0, 0, width, height)});
+	img = spr_base[WBS_MIDDLE_LEFT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(img->xoffset, img->yoffset, img->width, height)});
+	img = spr_base[WBS_MIDDLE_RIGHT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(width + img->xoffset, img->yoffset, img->width, height)});
+	img = spr_base[WBS_TOP_MIDDLE];
+	if (img != nullptr) parts.push_back({img, Rectangle32(img->xoffset, img->yoffset, width, img->height)});
+	img = spr_base[WBS_BOTTOM_MIDDLE];
+	if (img != nullptr) parts.push_back({img, Rectangle32(img->xoffset, height + img->yoffset, width, img->height)});
+	img = spr_base[WBS_TOP_LEFT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(img->xoffset, img->yoffset, img->width, img->height)});
+	img = spr_base[WBS_TOP_RIGHT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(width + img->xoffset, img->yoffset, img->width, img->height)});
+	img = spr_base[WBS_BOTTOM_LEFT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(img->xoffset, height + img->yoffset, img->width, img->height)});
+	img = spr_base[WBS_BOTTOM_RIGHT];
+	if (img != nullptr) parts.push_back({img, Rectangle32(width + img->xoffset, height + img->yoffset, img->width, img->height)});
+
+	/* Compute the area painted by all parts together. */
+	int x_min = 0;
+	int y_min = 0;
+	int x_max = width;
+	int y_max = height;
+	for (const FramePart &part : parts) {
+		x_min = std::min(x_min, part.dest.base.x);
+		y_min = std::min(y_min, part.dest.base.y);
+		x_max = std::max(x_max, part.dest.base.x + static_cast<int>(part.dest.width));
+		y_max = std::max(y_max, part.dest.base.y + static_cast<int>(part.dest.height));
+	}
+	const Rectangle32 extent(x_min, y_min, x_max - x_min, y_max - y_min);
+
+	std::unique_ptr<uint8[]> canvas(new uint8[extent.width * extent.height * 4]());
+	for (const FramePart &part : parts) BlendSprite(canvas.get(), extent, part.img, rc, part.dest);
+
+	return {_video.UploadRGBATexture(canvas.get(), extent.width, extent.height), extent};
+}
+
 /**
  * Draw border sprites around some contents.
  * @param bsd Border sprites to use.
@@ -28,56 +129,17 @@ void DrawBorderSprites(const BorderSpriteData &bsd, bool pressed, const Rectangl
 	static Recolouring rc;  // Only COL_RANGE_BROWN is modified each time.
 	rc.Set(0, RecolourEntry(COL_RANGE_BROWN, colour));
 
-	int x1 = rect.base.x;
-	int x2 = rect.base.x + rect.width;
-	int y1 = rect.base.y;
-	int y2 = rect.base.y + rect.height;
-
-	if (spr_base[WBS_MIDDLE_MIDDLE] != nullptr) {
-		_video.TileImage(spr_base[WBS_MIDDLE_MIDDLE], Rectangle32(x1, y1, x2 - x1, y2 - y1), true, true, rc);
+	/* Border sprites never change once the RCD files are loaded, so the frame is
+	 * assembled only once per border type, content size, and colour, and drawn as
+	 * a single texture afterwards. */
+	const auto key = std::make_tuple(spr_base, rect.width, rect.height, colour);
+	auto it = _frame_cache.find(key);
+	if (it == _frame_cache.end()) {
+		it = _frame_cache.emplace(key, AssembleBorderFrame(spr_base, rect.width, rect.height, rc)).first;
 	}
 
-	if (spr_base[WBS_MIDDLE_LEFT] != nullptr) {
-		_video.TileImage(spr_base[WBS_MIDDLE_LEFT], Rectangle32(
-				x1 + spr_base[WBS_MIDDLE_LEFT]->xoffset,
-				y1 + spr_base[WBS_MIDDLE_LEFT]->yoffset,
-				spr_base[WBS_MIDDLE_LEFT]->width,
-				y2 - y1), false, true, rc);
-	}
-	if (spr_base[WBS_MIDDLE_RIGHT] != nullptr) {
-		_video.TileImage(spr_base[WBS_MIDDLE_RIGHT], Rectangle32(
-				x2 + spr_base[WBS_MIDDLE_RIGHT]->xoffset,
-				y1 + spr_base[WBS_MIDDLE_RIGHT]->yoffset,
-				spr_base[WBS_MIDDLE_RIGHT]->width,
-				y2 - y1), false, true, rc);
-	}
-	if (spr_base[WBS_TOP_MIDDLE] != nullptr) {
-		_video.TileImage(spr_base[WBS_TOP_MIDDLE], Rectangle32(
-				x1 + spr_base[WBS_TOP_MIDDLE]->xoffset,
-				y1 + spr_base[WBS_TOP_MIDDLE]->yoffset,
-				x2 - x1,
-				spr_base[WBS_TOP_MIDDLE]->height), true, false, rc);
-	}
-	if (spr_base[WBS_BOTTOM_MIDDLE] != nullptr) {
-		_video.TileImage(spr_base[WBS_BOTTOM_MIDDLE], Rectangle32(
-				x1 + spr_base[WBS_BOTTOM_MIDDLE]->xoffset,
-				y2 + spr_base[WBS_BOTTOM_MIDDLE]->yoffset,
-				x2 - x1,
-				spr_base[WBS_BOTTOM_MIDDLE]->height), true, false, rc);
-	}
-
-	if (spr_base[WBS_TOP_LEFT] != nullptr) {
-		_video.BlitImage(Point32(x1, y1), spr_base[WBS_TOP_LEFT], rc);
-	}
-	if (spr_base[WBS_TOP_RIGHT] != nullptr) {
-		_video.BlitImage(Point32(x2, y1), spr_base[WBS_TOP_RIGHT], rc);
-	}
-	if (spr_base[WBS_BOTTOM_LEFT] != nullptr) {
-		_video.BlitImage(Point32(x1, y2), spr_base[WBS_BOTTOM_LEFT], rc);
-	}
-	if (spr_base[WBS_BOTTOM_RIGHT] != nullptr) {
-		_video.BlitImage(Point32(x2, y2), spr_base[WBS_BOTTOM_RIGHT], rc);
-	}
+	const AssembledFrame &frame = it->second;
+	_video.BlitTexture(frame.texture, Rectangle32(rect.base.x + frame.extent.base.x, rect.base.y + frame.extent.base.y, frame.extent.width, frame.extent.height));
 }
 
 /**
@@ -147,6 +147,10 @@ void DrawMessage(const Message *msg, const Rectangle32 &rect, const bool narrow,
 	if (!narrow) {
 		_str_params.SetDate(1, msg->timestamp);
 		DrawString(STR_ARG1, TEXT_WHITE, rect.base.x + MESSAGE_PADDING, rect.base.y, text_w);
+		if (msg->repeat_count > 1) {
+			/* The event happened several times; show how often next to the timestamp. */
+			DrawString(Format(u8"×%u", msg->repeat_count), TEXT_WHITE, rect.base.x + MESSAGE_PADDING, rect.base.y, text_w, ALG_RIGHT);
+		}
 	}
 
 	if (obscure_fraction > 0.f) {
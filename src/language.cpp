@@ -203,7 +203,29 @@ LanguageBundle::LanguageBundle()
 void LanguageBundle::Clear()
 {
 	this->values.clear();
+	this->texts.clear();
 	this->metadata = nullptr;
+	this->loaded = false;
+}
+
+/**
+ * Add the strings of a registration to this language.
+ * @param index Language index of this language.
+ * @param reg Registration to add.
+ * @param nrstrings Total number of known strings, determines the size of the #values table.
+ */
+void LanguageBundle::AddRegistration(const int index, const StringRegistration &reg, const size_t nrstrings)
+{
+	if (this->values.size() < nrstrings) this->values.resize(nrstrings);
+
+	const TextData &td = *reg.td;
+	for (uint i = 0; i < td.string_count; ++i) {
+		const PluralizedString &src = td.strings[reg.text_indices[i]].languages[index];
+		PluralizedString &dest = this->values.at(reg.base + i);
+		dest.first = this->texts.size();
+		dest.count = src.count;
+		for (uint16 p = 0; p < src.count; ++p) this->texts.push_back(td.texts.at(src.first + p));
+	}
 }
 
 /**
@@ -214,9 +236,11 @@ void LanguageBundle::Clear()
  */
 const char *LanguageBundle::GetPlural(StringID number, int64 count) const
 {
-	if (number >= this->values.size() || this->values.at(number).empty()) return nullptr;
+	if (number >= this->values.size() || this->values.at(number).count == 0) return nullptr;
+	const PluralizedString &ref = this->values.at(number);
 	int plural = this->metadata->PluralRule(count);
-	return this->values.at(number).at(plural);
+	assert(plural >= 0 && plural < ref.count);
+	return this->texts.at(ref.first + plural);
 }
 
 /**
@@ -238,9 +262,26 @@ LanguageManager::LanguageManager()
 void LanguageManager::Clear()
 {
 	for (LanguageBundle &l : this->languages) l.Clear();
+	this->registrations.clear();
 	this->free_index = GUI_STRING_TABLE_END;
 }
 
+/**
+ * Materialize the strings of a language if that has not happened yet.
+ * Only languages that are actually used pay the time and memory cost of their string tables.
+ * @param lang_index Language to materialize.
+ */
+void LanguageManager::EnsureLoaded(int lang_index)
+{
+	LanguageBundle &bundle = this->languages[lang_index];
+	if (bundle.loaded) return;
+	bundle.loaded = true;
+	for (const StringRegistration &reg : this->registrations) {
+		bundle.AddRegistration(lang_index, reg, this->string_names.size());
+	}
+	bundle.InitMetaInfo(lang_index);
+}
+
 /**
  * Register loaded strings of rides etc. with the language system.
  * @param td Text data wrapper containing the loaded strings.
@@ -260,13 +301,8 @@ uint16 LanguageManager::RegisterStrings(const TextData &td, const char * const n
 		assert(base + td.string_count < this->free_index);
 	}
 
-	const size_t old_size = this->string_names.size();
-	if (base + td.string_count > old_size) {
+	if (base + td.string_count > this->string_names.size()) {
 		this->string_names.resize(base + td.string_count);
-		for (LanguageBundle &l : this->languages) {
-			assert(l.values.size() == old_size);
-			l.values.resize(base + td.string_count);
-		}
 	}
 
 	/* Names and text strings are not in the same order. */
@@ -274,15 +310,21 @@ uint16 LanguageManager::RegisterStrings(const TextData &td, const char * const n
 	for (uint i = 0; i < td.string_count; ++i) {
 		name_textstring_lookup[td.strings[i].name] = i;
 	}
+
+	StringRegistration reg;
+	reg.td = &td;
+	reg.base = base;
+	reg.text_indices.reserve(td.string_count);
 	for (uint i = 0; i < td.string_count; ++i) {
 		assert(names[i] != nullptr && *names[i] != '\0');
 		this->string_names.at(base + i) = names[i];
+		reg.text_indices.push_back(name_textstring_lookup.at(names[i]));
+	}
+	this->registrations.push_back(std::move(reg));
 
-		const uint text_index = name_textstring_lookup.at(names[i]);
-		for (int l = 0; l < LANGUAGE_COUNT; ++l) {
-			this->languages[l].values.at(base + i) = td.strings[text_index].languages[l];
-			this->languages[l].values.at(base + i).shrink_to_fit();
-		}
+	/* Languages already in use pick up the new strings immediately, the rest waits for #EnsureLoaded. */
+	for (int l = 0; l < LANGUAGE_COUNT; ++l) {
+		if (this->languages[l].loaded) this->languages[l].AddRegistration(l, this->registrations.back(), this->string_names.size());
 	}
 
 	return base;
@@ -294,9 +336,9 @@ uint16 LanguageManager::RegisterStrings(const TextData &td, const char * const n
  * @param count The value to use for selecting the appropriate plural form.
  * @return String corresponding to the number (not owned by the caller, so don't free it).
  */
-std::string LanguageManager::GetPlural(StringID number, int64 count) const
+std::string LanguageManager::GetPlural(StringID number, int64 count)
 {
-	static const std::string default_strings[] = {
+	static constexpr const char *default_strings[] = {
 		"",     // STR_NULL
 		"%1%",  // STR_ARG1
 	};
@@ -304,10 +346,12 @@ std::string LanguageManager::GetPlural(StringID number, int64 count) const
 	if (number < lengthof(default_strings)) return default_strings[number];
 
 	if (_current_language != SOURCE_LANGUAGE) {
+		this->EnsureLoaded(_current_language);
 		const char *str = languages[_current_language].GetPlural(number, count);
 		if (str != nullptr) return *str != '\0' ? str : "<empty translation>";
 	}
 
+	this->EnsureLoaded(SOURCE_LANGUAGE);
 	const char *str = languages[SOURCE_LANGUAGE].GetPlural(number, count);
 	if (str != nullptr) return *str != '\0' ? str : "<empty string>";
 
@@ -319,7 +363,7 @@ std::string LanguageManager::GetPlural(StringID number, int64 count) const
  * @param number string number to get.
  * @return String corresponding to the number (not owned by the caller, so don't free it).
  */
-std::string LanguageManager::GetSgText(StringID number) const
+std::string LanguageManager::GetSgText(StringID number)
 {
 	return this->GetPlural(number, 1);
 }
@@ -329,8 +373,9 @@ std::string LanguageManager::GetSgText(StringID number) const
  * @param lang_index The language to look in.
  * @return The language name.
  */
-std::string LanguageManager::GetLanguageName(int lang_index) const
+std::string LanguageManager::GetLanguageName(int lang_index)
 {
+	this->EnsureLoaded(lang_index);
 	return this->languages[lang_index].GetSgText(GUI_LANGUAGE_NAME);
 }
 
@@ -348,10 +393,13 @@ const char *LanguageManager::GetStringName(StringID number) const
  * Check that all meta info is present and sane,
  * and that all pluralized strings match their language's specifications,
  * and cache meta info for later access.
+ * Only materialized languages are checked; the others are checked when #EnsureLoaded materializes them.
  */
 void LanguageManager::InitMetaInfo()
 {
-	for (int i = 0; i < LANGUAGE_COUNT; ++i) this->languages[i].InitMetaInfo(i);
+	for (int i = 0; i < LANGUAGE_COUNT; ++i) {
+		if (this->languages[i].loaded) this->languages[i].InitMetaInfo(i);
+	}
 }
 
 /**
@@ -366,7 +414,7 @@ void LanguageBundle::InitMetaInfo(int index)
 
 	const uint32 nrstrings = this->values.size();
 	for (uint32 i = 0; i < nrstrings; ++i) {
-		int size = this->values.at(i).size();
+		int size = this->values.at(i).count;
 		if (_language.GetStringName(i) == nullptr && size != 0) {
 			error("Language %s has a string at undefined index %u.\n",
 					this->metadata->name, i);
@@ -385,37 +433,43 @@ void LanguageBundle::InitMetaInfo(int index)
  */
 static std::string MoneyStrFmt(int64 money)
 {
-	std::string result = _language.GetSgText(GUI_MONEY_CURRENCY_SYMBOL);
+	/* The locale strings only change with the language, look them up again only after a switch. */
+	static int locale_language = -1;
+	static std::string currency_symbol;
+	static std::string tho_sep;
+	static std::string dec_sep;
+	if (locale_language != _current_language) {
+		locale_language = _current_language;
+		currency_symbol = _language.GetSgText(GUI_MONEY_CURRENCY_SYMBOL);
+		tho_sep = _language.GetSgText(GUI_MONEY_THOUSANDS_SEPARATOR);
+		dec_sep = _language.GetSgText(GUI_MONEY_DECIMAL_SEPARATOR);
+	}
+
+	std::string result = currency_symbol;
 	if (money < 0) {
 		result += u8"\u2212";  // U+2212 Unicode Minus sign.
 		money *= -1;
 	}
 
-	const std::string tho_sep  = _language.GetSgText(GUI_MONEY_THOUSANDS_SEPARATOR);
-
 	const int cents = money % 100;
 	money /= 100;
 
-	/* Split string into groups of thousands. */
-	int tgroups = 0;
-	int64 temp_money = money;
-	for (; temp_money >= 1000; ++tgroups, temp_money /= 1000);
-	result += std::to_string(temp_money);
-	for (; tgroups > 0; --tgroups) {
-		result += tho_sep;
-
-		temp_money = money;
-		for (int i = tgroups; i > 1; --i, temp_money /= 1000);
-		temp_money %= 1000;
-		if (temp_money < 100) {
-			result += '0';
-			if (temp_money < 10) result += '0';
-		}
-		result += std::to_string(temp_money);
+	/* Extract the digits of the whole units in a single pass, back to front. */
+	char digits[20];  // Enough for any 64 bits value.
+	int ndigits = 0;
+	do {
+		digits[ndigits++] = '0' + (money % 10);
+		money /= 10;
+	} while (money > 0);
+
+	/* Emit the digits with a separator between each group of thousands. */
+	for (int i = ndigits - 1; i >= 0; i--) {
+		result += digits[i];
+		if (i > 0 && i % 3 == 0) result += tho_sep;
 	}
 
 	/* Write the cents. This should always be exactly two digits. */
-	result += _language.GetSgText(GUI_MONEY_DECIMAL_SEPARATOR);
+	result += dec_sep;
 	result += '0' + (cents / 10);
 	result += '0' + (cents % 10);
 
@@ -433,6 +487,47 @@ static inline std::string TemperatureStrFormat(int temp)
 	return Format(u8"%d \u2103", temp);  // U+2103 Unicode Degrees Celsius sign.
 }
 
+/**
+ * Cache of formatted strings, keyed by string number, language and parameter values.
+ * Since the parameter values are part of the key, a change by the data owner automatically
+ * invalidates the cached text; entries of stale values linger until the wholesale eviction
+ * in #DrawText. With that, re-drawing an unchanged window formats no strings at all.
+ */
+static std::map<std::string, std::string> _formatted_cache;
+
+static const uint FORMATTED_CACHE_MAX_SIZE = 4096;  ///< Evict #_formatted_cache wholesale beyond this many entries.
+
+/**
+ * Build the #_formatted_cache key for a string and its parameter values.
+ * @param strid String number to 'draw'.
+ * @param params String parameter values for the "%n%" patterns.
+ * @param [out] key Key to fill.
+ */
+static void MakeFormattedCacheKey(StringID strid, const StringParameters *params, std::string &key)
+{
+	key.clear();
+	key.append(reinterpret_cast<const char *>(&strid), sizeof(strid));
+	key.push_back(_current_language);
+	if (params == nullptr) return;
+	key.append(reinterpret_cast<const char *>(&params->pluralize_count), sizeof(params->pluralize_count));
+	for (const StringParameterData &parm : params->parms) {
+		key.push_back(parm.parm_type);
+		switch (parm.parm_type) {
+			case SPT_TEXT:
+				key.append(parm.text);
+				key.push_back('\0');
+				break;
+
+			case SPT_NONE:
+				break;
+
+			default:
+				key.append(reinterpret_cast<const char *>(&parm.u), sizeof(parm.u));
+				break;
+		}
+	}
+}
+
 /**
  * Draw the string into the supplied buffer.
  * @param strid String number to 'draw'.
@@ -441,6 +536,14 @@ static inline std::string TemperatureStrFormat(int temp)
  */
 std::string DrawText(StringID strid, StringParameters *params)
 {
+	std::string key;  // Local because formatting a date parameter re-enters this function.
+	MakeFormattedCacheKey(strid, params, key);
+	const auto cached = _formatted_cache.find(key);
+	if (cached != _formatted_cache.end()) {
+		if (params != nullptr) params->set_mode = false; // Clean parameters on next Set.
+		return cached->second;
+	}
+
 	std::string buffer;
 
 	const std::string txt = _language.GetPlural(strid, params == nullptr ? 1 : params->pluralize_count);
@@ -501,6 +604,8 @@ std::string DrawText(StringID strid, StringParameters *params)
 		ptr++;
 	}
 	if (params != nullptr) params->set_mode = false; // Clean parameters on next Set.
+	if (_formatted_cache.size() >= FORMATTED_CACHE_MAX_SIZE) _formatted_cache.clear();
+	_formatted_cache[key] = buffer;
 	return buffer;
 }
 
@@ -550,11 +655,21 @@ void GetTextSize(StringID strid, int *width, int *height)
  */
 std::string GetDateString(const Date &d)
 {
+	/* The toolbar formats the same date on every frame, remember the last result. */
+	static uint32 cached_dmy = 0;
+	static int cached_language = -1;
+	static std::string cached_text;
+	const uint32 dmy = d.Compress();
+	if (dmy == cached_dmy && cached_language == _current_language) return cached_text;
+
 	static StringParameters p;
 	p.SetNumber(1, d.day);
 	p.SetStrID(2, GetMonthName(d.month));
 	p.SetNumber(3, d.year);
-	return DrawText(GUI_DATE_FORMAT, &p);
+	cached_dmy = dmy;
+	cached_language = _current_language;
+	cached_text = DrawText(GUI_DATE_FORMAT, &p);
+	return cached_text;
 }
 
 /**
@@ -126,8 +126,25 @@ struct StringParameters {
 	int64 pluralize_count;                  ///< Value to use for selecting the plural form.
 };
 
-/** A string in one language with all its plural forms. */
-using PluralizedString = std::vector<const char*>;
+/**
+ * Reference to a string in one language with all its plural forms.
+ * The plural forms themselves live consecutively in a flattened string table,
+ * so loading many strings costs no allocation per string.
+ */
+struct PluralizedString {
+	uint32 first = 0;  ///< Index of the first plural form in the string table.
+	uint16 count = 0;  ///< Number of plural forms, \c 0 when the string has no translation.
+};
+
+/**
+ * Record of one #LanguageManager::RegisterStrings call.
+ * Languages are materialized lazily from these records, so unused languages cost neither startup time nor memory.
+ */
+struct StringRegistration {
+	const TextData *td;              ///< Loaded text data containing the strings. Memory is not owned.
+	uint16 base;                     ///< Base address of the strings.
+	std::vector<uint> text_indices;  ///< For every registered name, the index of its string in the text data.
+};
 
 /** Contains all strings and the meta-information for one specific language. */
 class LanguageBundle {
@@ -135,13 +152,16 @@ public:
 	LanguageBundle();
 	void Clear();
 	void InitMetaInfo(int index);
+	void AddRegistration(int index, const StringRegistration &reg, size_t nrstrings);
 
 	const char *GetSgText(StringID number) const;
 	const char *GetPlural(StringID number, int64 count) const;
 
 	std::vector<PluralizedString> values;  ///< Every known string with all its plural forms, indexed by #StringID.
-	                                       ///< Strings without a translation are \c nullptr. Memory is not owned.
+	                                       ///< References into #texts, \c count is \c 0 for strings without a translation.
+	std::vector<const char*> texts;        ///< Flattened table of the plural forms of all strings. Memory is not owned.
 	const LanguageDefinition *metadata;    ///< This language's metadata.
+	bool loaded;                           ///< Whether the strings of this language have been materialized.
 };
 
 /** Class for retrieving language strings. */
@@ -154,15 +174,18 @@ public:
 	uint16 RegisterStrings(const TextData &td, const char * const names[], uint16 base = STR_GENERIC_END);
 	void InitMetaInfo();
 
-	std::string GetSgText(StringID number) const;
-	std::string GetPlural(StringID number, int64 count) const;
-	std::string GetLanguageName(int lang_index) const;
+	std::string GetSgText(StringID number);
+	std::string GetPlural(StringID number, int64 count);
+	std::string GetLanguageName(int lang_index);
 	const char *GetStringName(StringID number) const;
 
 private:
-	LanguageBundle languages[LANGUAGE_COUNT];  ///< All registered languages.
-	std::vector<const char*> string_names;     ///< Names of every string, indexed by #StringID. Memory is not owned.
-	uint16 free_index;                         ///< Next free index for string storage.
+	void EnsureLoaded(int lang_index);
+
+	LanguageBundle languages[LANGUAGE_COUNT];       ///< All registered languages, materialized on first use.
+	std::vector<StringRegistration> registrations;  ///< All string registrations, to materialize languages from.
+	std::vector<const char*> string_names;          ///< Names of every string, indexed by #StringID. Memory is not owned.
+	uint16 free_index;                              ///< Next free index for string storage.
 };
 
 std::string GetLanguageName(int index);
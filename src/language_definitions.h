@@ -7,19 +7,21 @@
 
 /** @file language_definitions.h Definitions of known languages. */
 
-#include <string>
+#ifndef LANGUAGE_DEFINITIONS_H
+#define LANGUAGE_DEFINITIONS_H
+
 #include <string>
 
 #include "stdafx.h"
 
 /** The standard plural rule for English and many other languages: 1 is singular, everything else is plural. */
-inline int plural_rule_standard(int64 amount)
+constexpr int plural_rule_standard(int64 amount)
 {
 	return amount == 1 ? 0 : 1;
 }
 
 /** The french plural rule: Singular for 0 and 1, plural for everything else. */
-inline int plural_rule_french(int64 amount)
+constexpr int plural_rule_french(int64 amount)
 {
 	return amount > 1 ? 1 : 0;
 }
@@ -47,7 +49,57 @@ constexpr const LanguageDefinition _all_languages[] = {
 	LanguageDefinition("sv_SE", 2, &plural_rule_standard),
 };
 
-int GetLanguageIndex(const std::string &name);
-
 constexpr const int LANGUAGE_COUNT = lengthof(_all_languages);  ///< Number of supported languages.
-static const int SOURCE_LANGUAGE = GetLanguageIndex("en_GB");   ///< Source language of the program.
+
+/**
+ * Compare a language name with an entry of #_all_languages, \c strcmp style.
+ * @param name Name to look for.
+ * @param entry Name of the table entry.
+ * @return Negative, zero, or positive when \a name sorts before, equal to, or after \a entry.
+ */
+constexpr int CompareLanguageName(const char *name, const char *entry)
+{
+	while (*name != '\0' && *name == *entry) {
+		name++;
+		entry++;
+	}
+	return static_cast<unsigned char>(*name) - static_cast<unsigned char>(*entry);
+}
+
+/**
+ * Get the index number of a given language.
+ * @param lang_name Name of the language.
+ * @return Index of the language with the provided name, or \c -1 if not recognized.
+ */
+constexpr int GetLanguageIndex(const char *lang_name)
+{
+	int start = 0; // Inclusive lower bound.
+	int end = LANGUAGE_COUNT; // Exclusive upper bound.
+
+	while (start < end) {
+		int middle = (start + end) / 2;
+		int cmp = CompareLanguageName(lang_name, _all_languages[middle].name);
+		if (cmp == 0) return middle; // Jack pot.
+		if (cmp > 0) {
+			start = middle + 1;
+		} else {
+			end = middle;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Get the index number of a given language.
+ * @param lang_name Name of the language.
+ * @return Index of the language with the provided name, or \c -1 if not recognized.
+ */
+inline int GetLanguageIndex(const std::string &lang_name)
+{
+	return GetLanguageIndex(lang_name.c_str());
+}
+
+constexpr const int SOURCE_LANGUAGE = GetLanguageIndex("en_GB");  ///< Source language of the program.
+assert_compile(SOURCE_LANGUAGE >= 0);  ///< The source language must be in the table.
+
+#endif
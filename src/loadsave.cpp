@@ -19,16 +19,484 @@
 #include "people.h"
 #include "gamelevel.h"
 #include "gameobserver.h"
+#include "gamecontrol.h"
 #include "rev.h"
+#include "task_system.h"
+#include "fileio.h"
+#include <atomic>
+#include <fstream>
+#include <zlib.h>
+#ifdef LINUX
+	#include <unistd.h>
+#elif WINDOWS
+	#include <io.h>
+#endif
 
 /** Whether savegame files should automatically be resaved after loading. */
 bool _automatically_resave_files = false;
 
+/** Compression level of savegame files, \c 0 stores the data uncompressed (still inside the chunked container). @see Z_BEST_COMPRESSION */
+int _save_compression_level = 6;
+
+static const uint32 COMPRESSED_SAVEGAME_VERSION = 2;  ///< Version of the compressed savegame container.
+static const uint32 DELTA_SAVEGAME_VERSION = 3;       ///< Container version of differential savegames.
+static const size_t COMPRESS_CHUNK_SIZE = 64 << 10;   ///< Buffer size of one compression step.
+
+/** State of the differential autosave mode: the full base snapshot that delta saves reference. */
+struct DeltaBaseState {
+	std::string path;                            ///< Path of the current base snapshot, empty if there is none.
+	std::map<std::string, uint64> chunk_hashes;  ///< Hash of the raw serialized data of each chunk of the base.
+	int deltas_written = 0;                      ///< Number of delta saves written against the current base.
+	bool use_second_file = false;                ///< Which of the two alternating base files the current snapshot uses.
+};
+static DeltaBaseState _delta_base;  ///< Base snapshot state for differential autosaves.
+
 /**
- * Constructor of the loader class.
- * @param file Input file stream. Use \c nullptr for initialization to default.
+ * Compute the FNV-1a hash of a range of bytes.
+ * @param data Start of the range.
+ * @param length Number of bytes to hash.
+ * @return The hash.
+ */
+static uint64 HashBytes(const uint8 *data, size_t length)
+{
+	uint64 hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < length; i++) {
+		hash ^= data[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+static TaskGroup _save_group;  ///< Tracks the background task writing the previously serialized game to disk.
+static std::atomic<int> _background_save_result(0);  ///< Outcome of the last background save, \c 1 success, \c -1 failure, \c 0 already announced.
+
+/** Wait until a background save that is still writing to disk has finished. */
+void FinishPendingSave()
+{
+	_task_system.Wait(_save_group);
+}
+
+/**
+ * Post the outcome of a finished background save to the player's inbox.
+ * The inbox is not thread-safe, so the writer thread only records the outcome
+ * and the message is sent from the game thread through this function.
+ */
+void ProcessSaveNotifications()
+{
+	switch (_background_save_result.exchange(0)) {
+		case 0:
+			break;
+		case 1:
+			_inbox.SendMessage(new Message(GUI_MESSAGE_SAVE_COMPLETE));
+			break;
+		default:
+			_inbox.SendMessage(new Message(GUI_MESSAGE_SAVE_FAILED));
+			break;
+	}
+}
+
+/**
+ * Flush a finished savegame to disk, and move it atomically onto its final name.
+ * The data was written to a temporary file, so a crash or power cut mid-save
+ * never destroys an existing savegame at \a fname.
+ * @param fp Open file stream of the temporary file, closed by this function.
+ * @param tmp_name Name of the temporary file that was written.
+ * @param fname Final name of the savegame.
+ * @param written Whether writing the temporary file succeeded so far.
+ * @return Whether the savegame was committed to disk.
+ */
+static bool CommitSaveFile(FILE *fp, const std::string &tmp_name, const std::string &fname, bool written)
+{
+	written &= ferror(fp) == 0;
+	written &= fflush(fp) == 0;
+#ifdef LINUX
+	written &= fsync(fileno(fp)) == 0;  // The rename must not reach the disk before the data.
+#elif WINDOWS
+	written &= _commit(_fileno(fp)) == 0;
+#endif
+	fclose(fp);
+	if (!written) {
+		RemoveFile(tmp_name);
+		return false;
+	}
+	std::error_code ec;
+	std::filesystem::rename(tmp_name, fname, ec);  // Unlike std::rename, this also replaces existing files on Windows.
+	if (ec) RemoveFile(tmp_name);
+	return !ec;
+}
+
+/**
+ * Write a 32 bit unsigned number to a file, in little endian format.
+ * @param fp Output file stream.
+ * @param val Value to write.
  */
-Loader::Loader(FILE *file) : fp(file), rcd_file(nullptr), cache_count(0)
+static void WriteLong(FILE *fp, uint32 val)
+{
+	for (int i = 0; i < 4; i++) putc(val >> (8 * i), fp);
+}
+
+/**
+ * Compress a range of serialized data into a memory buffer.
+ * @param data Start of the data to compress.
+ * @param length Number of bytes to compress.
+ * @param level Compression level to use, \c 0 stores the data uncompressed.
+ * @param out [out] The compressed data stream.
+ * @return Whether compressing was successful.
+ */
+static bool DeflateBuffer(const uint8 *data, size_t length, int level, std::vector<uint8> *out)
+{
+	z_stream strm{};
+	if (deflateInit(&strm, std::min(level, Z_BEST_COMPRESSION)) != Z_OK) return false;
+	strm.next_in = const_cast<Bytef *>(data);
+	strm.avail_in = length;
+
+	std::unique_ptr<uint8[]> chunk(new uint8[COMPRESS_CHUNK_SIZE]);
+	bool compressed = true;
+	for (;;) {
+		strm.next_out = chunk.get();
+		strm.avail_out = COMPRESS_CHUNK_SIZE;
+		int result = deflate(&strm, Z_FINISH);
+		if (result != Z_OK && result != Z_STREAM_END) {
+			compressed = false;
+			break;
+		}
+		out->insert(out->end(), chunk.get(), chunk.get() + (COMPRESS_CHUNK_SIZE - strm.avail_out));
+		if (result == Z_STREAM_END) break;
+	}
+	deflateEnd(&strm);
+	return compressed;
+}
+
+/**
+ * Expand a compressed data stream, appending to a memory buffer.
+ * @param data Start of the compressed stream.
+ * @param length Number of compressed bytes.
+ * @param out [inout] Buffer to append the expanded data to.
+ * @param max_output Maximal total size of \a out, expansion stops early beyond it.
+ * @return Whether expanding was successful.
+ */
+static bool InflateBuffer(const uint8 *data, size_t length, std::vector<uint8> *out, size_t max_output)
+{
+	z_stream strm{};
+	if (inflateInit(&strm) != Z_OK) return false;
+	strm.next_in = const_cast<Bytef *>(data);
+	strm.avail_in = length;
+
+	std::unique_ptr<uint8[]> chunk(new uint8[COMPRESS_CHUNK_SIZE]);
+	bool expanded = true;
+	while (out->size() < max_output) {
+		strm.next_out = chunk.get();
+		strm.avail_out = COMPRESS_CHUNK_SIZE;
+		int result = inflate(&strm, Z_NO_FLUSH);
+		if (result != Z_OK && result != Z_STREAM_END) {
+			expanded = false;
+			break;
+		}
+		out->insert(out->end(), chunk.get(), chunk.get() + (COMPRESS_CHUNK_SIZE - strm.avail_out));
+		if (result == Z_STREAM_END) break;
+	}
+	inflateEnd(&strm);
+	return expanded;
+}
+
+static const size_t CONTAINER_HEADER_SIZE = 12;     ///< Size of the savegame container header (magic, version, chunk count).
+static const size_t CONTAINER_INDEX_ENTRY_SIZE = 28; ///< Size of one chunk index entry (name, offset, compressed and raw length).
+
+/**
+ * Write serialized game data to a file.
+ * The data is wrapped in a versioned container: a header index of the chunks, followed by
+ * one independent zlib stream per chunk, so readers can address the chunks selectively.
+ * @param fname Name of the file to write.
+ * @param data Serialized game data.
+ * @param chunks Chunk boundaries in \a data, in serialization order.
+ * @param level Compression level to use, \c 0 stores the chunks uncompressed.
+ * @return Whether writing was successful.
+ */
+static bool WriteSaveBuffer(const std::string &fname, const std::vector<uint8> &data, const std::vector<SaveChunk> &chunks, int level)
+{
+	/* Compress every chunk separately. */
+	std::vector<std::vector<uint8>> payloads(chunks.size());
+	for (uint i = 0; i < chunks.size(); i++) {
+		const size_t begin = chunks[i].begin;
+		const size_t end = (i + 1 < chunks.size()) ? chunks[i + 1].begin : data.size();
+		if (!DeflateBuffer(data.data() + begin, end - begin, level, &payloads[i])) return false;
+	}
+
+	const std::string tmp_name = fname + ".tmp";
+	FILE *fp = fopen(tmp_name.c_str(), "wb");
+	if (fp == nullptr) return false;
+
+	fwrite("FCTZ", 1, 4, fp);
+	WriteLong(fp, COMPRESSED_SAVEGAME_VERSION);
+	WriteLong(fp, chunks.size());
+
+	/* Chunk index. */
+	uint64 offset = CONTAINER_HEADER_SIZE + CONTAINER_INDEX_ENTRY_SIZE * chunks.size();
+	for (uint i = 0; i < chunks.size(); i++) {
+		const size_t end = (i + 1 < chunks.size()) ? chunks[i + 1].begin : data.size();
+		fwrite(chunks[i].name.c_str(), 1, 4, fp);
+		WriteLong(fp, offset);
+		WriteLong(fp, offset >> 32);
+		WriteLong(fp, payloads[i].size());
+		WriteLong(fp, static_cast<uint64>(payloads[i].size()) >> 32);
+		WriteLong(fp, end - chunks[i].begin);
+		WriteLong(fp, static_cast<uint64>(end - chunks[i].begin) >> 32);
+		offset += payloads[i].size();
+	}
+
+	bool written = true;
+	for (const std::vector<uint8> &payload : payloads) {
+		if (fwrite(payload.data(), 1, payload.size(), fp) != payload.size()) {
+			written = false;
+			break;
+		}
+	}
+	return CommitSaveFile(fp, tmp_name, fname, written);
+}
+
+/**
+ * Write serialized game data to a file as a differential save.
+ * Chunks that are unchanged since the current base snapshot are stored as a hash-validated
+ * reference into that snapshot instead of being rewritten. A new full base snapshot is
+ * written when there is none yet or after a full autosave rotation of deltas; two base
+ * files alternate so retained delta saves keep referencing an intact base.
+ * @param fname Name of the file to write.
+ * @param data Serialized game data.
+ * @param chunks Chunk boundaries in \a data, in serialization order.
+ * @param level Compression level to use, \c 0 stores changed chunks uncompressed.
+ * @return Whether writing was successful.
+ */
+static bool WriteDeltaSaveBuffer(const std::string &fname, const std::vector<uint8> &data, const std::vector<SaveChunk> &chunks, int level)
+{
+	/* Hash the raw data of every chunk of this save. */
+	std::vector<size_t> ends(chunks.size());
+	std::vector<uint64> hashes(chunks.size());
+	for (uint i = 0; i < chunks.size(); i++) {
+		ends[i] = (i + 1 < chunks.size()) ? chunks[i + 1].begin : data.size();
+		hashes[i] = HashBytes(data.data() + chunks[i].begin, ends[i] - chunks[i].begin);
+	}
+
+	const size_t dir_sep = fname.find_last_of(DIR_SEP);
+	const std::string dir = (dir_sep == std::string::npos) ? "" : fname.substr(0, dir_sep + 1);
+
+	if (_delta_base.path.empty() || _delta_base.deltas_written >= std::max(_max_autosaves, 4)) {
+		/* Write a new full base snapshot. */
+		_delta_base.use_second_file = !_delta_base.use_second_file;
+		_delta_base.path = dir + (_delta_base.use_second_file ? "autosave_base_b.fct" : "autosave_base_a.fct");
+		if (!WriteSaveBuffer(_delta_base.path, data, chunks, level)) {
+			_delta_base.path.clear();
+			return false;
+		}
+		_delta_base.chunk_hashes.clear();
+		for (uint i = 0; i < chunks.size(); i++) _delta_base.chunk_hashes[chunks[i].name] = hashes[i];
+		_delta_base.deltas_written = 0;
+	}
+	const std::string base_name = _delta_base.path.substr(dir.size());
+
+	/* Compress the changed chunks. */
+	std::vector<std::vector<uint8>> payloads(chunks.size());
+	std::vector<bool> in_base(chunks.size());
+	for (uint i = 0; i < chunks.size(); i++) {
+		const auto iter = _delta_base.chunk_hashes.find(chunks[i].name);
+		in_base[i] = iter != _delta_base.chunk_hashes.end() && iter->second == hashes[i];
+		if (in_base[i]) continue;
+		if (!DeflateBuffer(data.data() + chunks[i].begin, ends[i] - chunks[i].begin, level, &payloads[i])) return false;
+	}
+
+	const std::string tmp_name = fname + ".tmp";
+	FILE *fp = fopen(tmp_name.c_str(), "wb");
+	if (fp == nullptr) return false;
+
+	fwrite("FCTZ", 1, 4, fp);
+	WriteLong(fp, DELTA_SAVEGAME_VERSION);
+	WriteLong(fp, chunks.size());
+	WriteLong(fp, base_name.size());
+	fwrite(base_name.c_str(), 1, base_name.size(), fp);
+
+	/* Chunk index. Reference entries carry the chunk hash in the offset field and a zero compressed length. */
+	uint64 offset = CONTAINER_HEADER_SIZE + 4 + base_name.size() + CONTAINER_INDEX_ENTRY_SIZE * chunks.size();
+	for (uint i = 0; i < chunks.size(); i++) {
+		fwrite(chunks[i].name.c_str(), 1, 4, fp);
+		const uint64 offset_or_hash = in_base[i] ? hashes[i] : offset;
+		WriteLong(fp, offset_or_hash);
+		WriteLong(fp, offset_or_hash >> 32);
+		WriteLong(fp, payloads[i].size());
+		WriteLong(fp, static_cast<uint64>(payloads[i].size()) >> 32);
+		WriteLong(fp, ends[i] - chunks[i].begin);
+		WriteLong(fp, static_cast<uint64>(ends[i] - chunks[i].begin) >> 32);
+		offset += payloads[i].size();
+	}
+
+	bool written = true;
+	for (const std::vector<uint8> &payload : payloads) {
+		if (fwrite(payload.data(), 1, payload.size(), fp) != payload.size()) {
+			written = false;
+			break;
+		}
+	}
+	written = CommitSaveFile(fp, tmp_name, fname, written);
+	if (written) _delta_base.deltas_written++;
+	return written;
+}
+
+/**
+ * Read a 64 bit unsigned number from a memory buffer, in little endian format.
+ * @param data Start of the number.
+ * @return The value.
+ */
+static uint64 ReadLongLong(const uint8 *data)
+{
+	uint64 val = 0;
+	for (int i = 0; i < 8; i++) val |= static_cast<uint64>(data[i]) << (8 * i);
+	return val;
+}
+
+/**
+ * Read a file fully into memory.
+ * @param fname Name of the file to read.
+ * @param raw [out] The file contents.
+ * @return Whether the file could be read.
+ */
+static bool ReadRawFile(const std::string &fname, std::vector<uint8> *raw)
+{
+	FILE *fp = fopen(fname.c_str(), "rb");
+	if (fp == nullptr) return false;
+	if (fseek(fp, 0, SEEK_END) != 0) {
+		fclose(fp);
+		return false;
+	}
+	long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (length < 0) {
+		fclose(fp);
+		return false;
+	}
+	raw->resize(length);
+	bool read = fread(raw->data(), 1, raw->size(), fp) == raw->size();
+	fclose(fp);
+	return read;
+}
+
+/**
+ * Expand one chunk of a full (version 2) savegame container, validating it against an expected hash.
+ * Used to reconstruct chunks that a differential save stores as a reference into its base snapshot.
+ * @param base_raw Contents of the base snapshot file.
+ * @param name Name of the chunk to expand (4 characters).
+ * @param expected_hash Hash the raw chunk data must have.
+ * @param raw_length Size the raw chunk data must have.
+ * @param out [inout] Buffer to append the expanded data to.
+ * @param max_output Maximal total size of \a out.
+ * @return Whether the chunk was found, matched, and expanded.
+ */
+static bool ReadBaseChunk(const std::vector<uint8> &base_raw, const uint8 *name, uint64 expected_hash, uint64 raw_length, std::vector<uint8> *out, size_t max_output)
+{
+	if (base_raw.size() < CONTAINER_HEADER_SIZE || memcmp(base_raw.data(), "FCTZ", 4) != 0) return false;
+	uint32 version = 0;
+	uint32 count = 0;
+	for (int i = 0; i < 4; i++) version |= static_cast<uint32>(base_raw[4 + i]) << (8 * i);
+	for (int i = 0; i < 4; i++) count |= static_cast<uint32>(base_raw[8 + i]) << (8 * i);
+	if (version != COMPRESSED_SAVEGAME_VERSION) return false; // A base snapshot is always a full container.
+	if (CONTAINER_HEADER_SIZE + CONTAINER_INDEX_ENTRY_SIZE * static_cast<uint64>(count) > base_raw.size()) return false;
+
+	for (uint32 i = 0; i < count; i++) {
+		const uint8 *entry = base_raw.data() + CONTAINER_HEADER_SIZE + CONTAINER_INDEX_ENTRY_SIZE * i;
+		if (memcmp(entry, name, 4) != 0) continue;
+
+		const uint64 offset = ReadLongLong(entry + 4);
+		const uint64 compressed_length = ReadLongLong(entry + 12);
+		if (offset + compressed_length > base_raw.size()) return false;
+
+		/* Expand fully so the hash covers the whole chunk, then append up to the caller's limit. */
+		std::vector<uint8> chunk_data;
+		chunk_data.reserve(raw_length);
+		if (!InflateBuffer(base_raw.data() + offset, compressed_length, &chunk_data, SIZE_MAX)) return false;
+		if (chunk_data.size() != raw_length || HashBytes(chunk_data.data(), chunk_data.size()) != expected_hash) return false;
+
+		const size_t room = max_output - std::min(max_output, out->size());
+		out->insert(out->end(), chunk_data.begin(), chunk_data.begin() + std::min<size_t>(room, chunk_data.size()));
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Read a savegame file into memory, transparently expanding the compressed container.
+ * @param fname Name of the file to read.
+ * @param data [out] The (uncompressed) savegame data.
+ * @param max_output Maximal number of uncompressed bytes to expand, e.g. when only the header is of interest.
+ * @param only_chunk If not \c nullptr, expand only the chunk with this name (ignored for files without a chunk index).
+ * @return Whether the file could be read.
+ */
+static bool ReadSaveFile(const char *fname, std::vector<uint8> *data, size_t max_output = SIZE_MAX, const char *only_chunk = nullptr)
+{
+	std::vector<uint8> raw;
+	if (!ReadRawFile(fname, &raw)) return false;
+
+	if (raw.size() < CONTAINER_HEADER_SIZE || memcmp(raw.data(), "FCTZ", 4) != 0) {
+		/* An uncompressed legacy savegame. */
+		*data = std::move(raw);
+		return true;
+	}
+
+	uint32 version = 0;
+	for (int i = 0; i < 4; i++) version |= static_cast<uint32>(raw[4 + i]) << (8 * i);
+	data->clear();
+
+	if (version == 1) {
+		/* Version 1: the raw size, followed by a single stream of the entire savegame. */
+		if (raw.size() < 16) return false;
+		data->reserve(std::min<uint64>(ReadLongLong(raw.data() + 8), max_output));
+		return InflateBuffer(raw.data() + 16, raw.size() - 16, data, max_output);
+	}
+	if (version != COMPRESSED_SAVEGAME_VERSION && version != DELTA_SAVEGAME_VERSION) return false;
+
+	/* Version 2 and 3: a chunk index, followed by one independent stream per chunk.
+	 * Version 3 additionally names a base snapshot, and stores unchanged chunks as references into it. */
+	uint32 count = 0;
+	for (int i = 0; i < 4; i++) count |= static_cast<uint32>(raw[8 + i]) << (8 * i);
+
+	size_t index_start = CONTAINER_HEADER_SIZE;
+	std::vector<uint8> base_raw;
+	if (version == DELTA_SAVEGAME_VERSION) {
+		if (raw.size() < CONTAINER_HEADER_SIZE + 4) return false;
+		uint32 name_length = 0;
+		for (int i = 0; i < 4; i++) name_length |= static_cast<uint32>(raw[12 + i]) << (8 * i);
+		if (CONTAINER_HEADER_SIZE + 4 + static_cast<uint64>(name_length) > raw.size()) return false;
+
+		/* The base snapshot lives in the same directory as the delta file. */
+		std::string base_path(fname);
+		const size_t dir_sep = base_path.find_last_of(DIR_SEP);
+		base_path.erase((dir_sep == std::string::npos) ? 0 : dir_sep + 1);
+		base_path.append(reinterpret_cast<const char *>(raw.data() + CONTAINER_HEADER_SIZE + 4), name_length);
+		if (!ReadRawFile(base_path, &base_raw)) return false;
+
+		index_start += 4 + name_length;
+	}
+	if (index_start + CONTAINER_INDEX_ENTRY_SIZE * static_cast<uint64>(count) > raw.size()) return false;
+
+	for (uint32 i = 0; i < count && data->size() < max_output; i++) {
+		const uint8 *entry = raw.data() + index_start + CONTAINER_INDEX_ENTRY_SIZE * i;
+		if (only_chunk != nullptr && memcmp(entry, only_chunk, 4) != 0) continue;
+
+		const uint64 offset = ReadLongLong(entry + 4);
+		const uint64 compressed_length = ReadLongLong(entry + 12);
+		const uint64 raw_length = ReadLongLong(entry + 20);
+
+		if (version == DELTA_SAVEGAME_VERSION && compressed_length == 0) {
+			/* A reference into the base snapshot; the offset field holds the expected chunk hash. */
+			if (!ReadBaseChunk(base_raw, entry, offset, raw_length, data, max_output)) return false;
+			continue;
+		}
+		if (offset + compressed_length > raw.size()) return false;
+
+		data->reserve(std::min<uint64>(data->size() + raw_length, max_output));
+		if (!InflateBuffer(raw.data() + offset, compressed_length, data, max_output)) return false;
+	}
+	return true;
+}
+
+/** Constructor of the loader class, without a data source, for initialization to default. */
+Loader::Loader() : rcd_file(nullptr), cache_count(0)
 {
 }
 
@@ -36,7 +504,7 @@ Loader::Loader(FILE *file) : fp(file), rcd_file(nullptr), cache_count(0)
  * Constructor of the loader class.
  * @param rcd Input file stream.
  */
-Loader::Loader(RcdFileReader *rcd) : fp(nullptr), rcd_file(rcd), cache_count(0)
+Loader::Loader(RcdFileReader *rcd) : rcd_file(rcd), cache_count(0)
 {
 }
 
@@ -45,7 +513,7 @@ Loader::Loader(RcdFileReader *rcd) : fp(nullptr), rcd_file(rcd), cache_count(0)
  * @param data Data bytes stream.
  * @param length Total length of the data stream.
  */
-Loader::Loader(const uint8 *data, size_t length) : fp(nullptr), rcd_file(nullptr), binary_stream({data, length}), cache_count(0)
+Loader::Loader(const uint8 *data, size_t length) : rcd_file(nullptr), binary_stream({data, length}), cache_count(0)
 {
 }
 
@@ -55,7 +523,7 @@ Loader::Loader(const uint8 *data, size_t length) : fp(nullptr), rcd_file(nullptr
  */
 bool Loader::HasNoInput() const
 {
-	return this->fp == nullptr && this->rcd_file == nullptr && !this->binary_stream.has_value();
+	return this->rcd_file == nullptr && !this->binary_stream.has_value();
 }
 
 /**
@@ -103,41 +571,22 @@ void Loader::ClosePattern()
 {
 	if (this->HasNoInput()) return;
 	assert(!this->pattern_names.empty());
-	const std::string &blk_name = this->pattern_names.back();
-	for (int i = 0; i < static_cast<int>(blk_name.size()); ++i) {
-		if (this->GetByte() != blk_name.at(3 - i)) {
-			throw LoadingError("ClosePattern (%s) got unexpected data", blk_name.c_str());
+	const char *blk_name = this->pattern_names.back();
+	for (int i = 0; i < 4; ++i) {
+		if (this->GetByte() != blk_name[3 - i]) {
+			throw LoadingError("ClosePattern (%s) got unexpected data", blk_name);
 		}
 	}
 	this->pattern_names.pop_back();
 }
 
 /**
- * Get the next byte from the stream (or the cache).
+ * Get the next byte from an RCD file stream.
  * @return The read next byte.
  */
-uint8 Loader::GetByte()
+uint8 Loader::GetRcdByte()
 {
-	if (this->HasNoInput()) return 0;
-
-	if (this->cache_count > 0) {
-		this->cache_count--;
-		return this->cache[this->cache_count];
-	}
-
-	if (this->rcd_file != nullptr) return this->rcd_file->GetUInt8();
-
-	if (this->binary_stream.has_value()) {
-		if (this->binary_stream->second == 0) throw LoadingError("End of data stream encountered");
-		this->binary_stream->second--;
-		return *this->binary_stream->first++;
-	}
-
-	int k = getc(this->fp);
-	if (k == EOF) {
-		throw LoadingError("EOF encountered");
-	}
-	return k;
+	return this->rcd_file->GetUInt8();
 }
 
 /**
@@ -152,36 +601,24 @@ void Loader::PutByte(uint8 val)
 }
 
 /**
- * Get the next word from the stream (or the cache).
- * @return The read next word.
+ * Read a block of bytes from the stream in bulk.
+ * @param address Destination of the read data.
+ * @param length Number of bytes to read.
  */
-uint16 Loader::GetWord()
+void Loader::GetBlob(uint8 *address, size_t length)
 {
-	uint16 v = this->GetByte();
-	uint16 w = this->GetByte();
-	return v | (w << 8);
-}
-
-/**
- * Get the next long word from the stream (or the cache).
- * @return The read next long word.
- */
-uint32 Loader::GetLong()
-{
-	uint32 v = this->GetWord();
-	uint32 w = this->GetWord();
-	return v | (w << 16);
-}
-
-/**
- * Get the next long long word from the stream (or the cache).
- * @return The read next long long word.
- */
-uint64 Loader::GetLongLong()
-{
-	uint64 v = this->GetLong();
-	uint64 w = this->GetLong();
-	return v | (w << 32);
+	while (length > 0 && this->cache_count > 0) {
+		*address++ = this->GetByte();
+		length--;
+	}
+	if (this->binary_stream.has_value()) {
+		if (this->binary_stream->second < length) throw LoadingError("End of data stream encountered");
+		memcpy(address, this->binary_stream->first, length);
+		this->binary_stream->first += length;
+		this->binary_stream->second -= length;
+		return;
+	}
+	for (size_t i = 0; i < length; i++) address[i] = this->GetByte();
 }
 
 /**
@@ -219,15 +656,41 @@ void Loader::VersionMismatch(uint saved_version, uint current_version)
 {
 	assert(!this->pattern_names.empty());
 	throw LoadingError("Version mismatch in %s pattern: Saved version is %u, supported version is %u",
-			this->pattern_names.back().c_str(), saved_version, current_version);
+			this->pattern_names.back(), saved_version, current_version);
+}
+
+/** Constructor for the saver. */
+Saver::Saver()
+= default;
+
+/**
+ * Take the serialized data out of the saver.
+ * @return The serialized game data.
+ */
+std::vector<uint8> Saver::TakeBuffer()
+{
+	return std::move(this->buffer);
 }
 
 /**
- * Constructor for the saver.
- * @param file Output file stream to write to.
+ * Take the chunk boundaries out of the saver.
+ * @return The chunks in serialization order.
  */
-Saver::Saver(FILE *file) : fp(file)
+std::vector<SaveChunk> Saver::TakeChunks()
 {
+	return std::move(this->chunks);
+}
+
+/**
+ * Start a new independently addressable chunk of the savegame.
+ * Chunks are stored separately in the savegame file, so a reader can load them selectively.
+ * @param name Name of the chunk (4 characters).
+ */
+void Saver::StartChunk(const char *name)
+{
+	assert(strlen(name) == 4);
+	this->CheckNoOpenPattern();
+	this->chunks.push_back({name, this->buffer.size()});
 }
 
 /** Checks that no patterns are currently open. */
@@ -235,7 +698,7 @@ void Saver::CheckNoOpenPattern() const
 {
 	if (!this->pattern_names.empty()) {
 		throw LoadingError("Saver still has %d open pattern(s) (last is %s)",
-				static_cast<int>(this->pattern_names.size()), this->pattern_names.back().c_str());
+				static_cast<int>(this->pattern_names.size()), this->pattern_names.back());
 	}
 }
 
@@ -266,48 +729,19 @@ void Saver::StartPattern(const char *name, uint32 version)
 void Saver::EndPattern()
 {
 	assert(!this->pattern_names.empty());
-	const char *blk_name = this->pattern_names.back().c_str();
+	const char *blk_name = this->pattern_names.back();
 	for (int i = 3; i >= 0; i--) this->PutByte(blk_name[i]);
 	this->pattern_names.pop_back();
 }
 
 /**
- * Write a byte to the output stream.
- * @param val Value to write.
- */
-void Saver::PutByte(uint8 val)
-{
-	putc(val, this->fp);
-}
-
-/**
- * Write a word to the output stream.
- * @param val Value to write.
+ * Write a block of bytes to the output stream in bulk.
+ * @param data Start of the data to write.
+ * @param length Number of bytes to write.
  */
-void Saver::PutWord(uint16 val)
+void Saver::PutBlob(const uint8 *data, size_t length)
 {
-	this->PutByte(val);
-	this->PutByte(val >> 8);
-}
-
-/**
- * Write a long word to the output stream.
- * @param val Value to write.
- */
-void Saver::PutLong(uint32 val)
-{
-	this->PutWord(val);
-	this->PutWord(val >> 16);
-}
-
-/**
- * Write a long long word to the output stream.
- * @param val Value to write.
- */
-void Saver::PutLongLong(uint64 val)
-{
-	this->PutLong(val);
-	this->PutLong(val >> 32);
+	this->buffer.insert(this->buffer.end(), data, data + length);
 }
 
 /**
@@ -322,6 +756,12 @@ void Saver::PutText(const std::string &str, int length)
 	const char *p = str.c_str();
 	size_t size = (length >= 0) ? static_cast<size_t>(length) : 4; // 4 is max utf-8 character length.
 	for (;;) {
+		/* A run of plain ASCII counts one code point per byte. */
+		const size_t run = AsciiRunLength(p, size);
+		p += run;
+		if (length >= 0) size -= run;
+		count += run;
+
 		uint32 cpoint;
 		int len = DecodeUtf8Char(p, size, &cpoint);
 		if (len == 0 || cpoint == 0) break;
@@ -334,6 +774,14 @@ void Saver::PutText(const std::string &str, int length)
 	size = (length >= 0) ? static_cast<size_t>(length) : 4; // 4 is max utf-8 character length.
 	p = str.c_str();
 	while (count > 0) {
+		/* Emit a run of plain ASCII without per-character decoding. */
+		const size_t run = std::min<size_t>(AsciiRunLength(p, size), count);
+		for (size_t i = 0; i < run; i++) this->PutLong(static_cast<uint8>(p[i]));
+		p += run;
+		if (length >= 0) size -= run;
+		count -= run;
+		if (count == 0) break;
+
 		uint32 cpoint;
 		int len = DecodeUtf8Char(p, size, &cpoint);
 		if (len == 0 || cpoint == 0) break;
@@ -417,19 +865,25 @@ static void LoadElements(Loader &ldr, const PreloadData &preload)
  */
 static void SaveElements(Saver &svr)
 {
+	svr.StartChunk("META");
 	svr.StartPattern("FCTS", CURRENT_VERSION_FCTS);
 	svr.PutLongLong(std::time(nullptr));
 	svr.PutText(_freerct_revision);
 	_scenario.Save(svr);
 	svr.EndPattern();
 
+	svr.StartChunk("WRLD");
 	SaveDate(svr);
 	_world.Save(svr);
 	_finances_manager.Save(svr);
 	_weather.Save(svr);
 	_game_observer.Save(svr);
+
+	svr.StartChunk("RIDE");
 	_rides_manager.Save(svr);
 	_scenery.Save(svr);
+
+	svr.StartChunk("PPLE");
 	_guests.Save(svr);
 	_staff.Save(svr);
 	_inbox.Save(svr);
@@ -455,20 +909,22 @@ void LoadGame(Loader &ldr)
  */
 bool LoadGameFile(const char *fname)
 {
+	FinishPendingSave(); // The file to load may still be being written.
+	_delta_base = DeltaBaseState(); // Differential saves of the park being left must not reference its snapshot.
 	try {
-		FILE *fp = nullptr;
-		if (fname != nullptr) {
-			fp = fopen(fname, "rb");
-			if (fp == nullptr) throw LoadingError("Cannot open file '%s' for reading", fname);
+		if (fname == nullptr) {
+			Loader ldr;
+			LoadGame(ldr);
+			return true;
 		}
 
-		Loader ldr(fp);
+		std::vector<uint8> data;
+		if (!ReadSaveFile(fname, &data)) throw LoadingError("Cannot open file '%s' for reading", fname);
+
+		Loader ldr(data.data(), data.size());
 		LoadGame(ldr);
 
-		if (fp != nullptr) {
-			fclose(fp);
-			if (_automatically_resave_files) SaveGameFile(fname);
-		}
+		if (_automatically_resave_files) SaveGameFile(fname);
 		return true;
 	} catch (const LoadingError &e) {
 		if (fname != nullptr) {
@@ -496,11 +952,12 @@ PreloadData PreloadGameFile(const char *fname)
 	if (fname == nullptr) return result;
 
 	try {
-		FILE *fp = fopen(fname, "rb");
-		if (fp == nullptr) return result;
-		Loader ldr(fp);
+		/* Only the metadata chunk is of interest. Legacy single-stream files lack a chunk index,
+		 * for them expansion stops after a generous upper bound of the header size. */
+		std::vector<uint8> data;
+		if (!ReadSaveFile(fname, &data, 1 << 20, "META")) return result;
+		Loader ldr(data.data(), data.size());
 		result = Preload(ldr);
-		fclose(fp);
 	} catch (const LoadingError&) {
 		result.load_success = false;
 	}
@@ -510,20 +967,189 @@ PreloadData PreloadGameFile(const char *fname)
 	return result;
 }
 
+/** Cached preload result of one savegame file, so the load dialog need not re-read unchanged files. */
+struct PreloadCacheEntry {
+	uint64 size;                 ///< Size of the file when it was preloaded.
+	int64 mtime;                 ///< Modification time of the file when it was preloaded.
+	bool load_success;           ///< Whether the savegame header could be read.
+	int fcts_version;            ///< Version number of the FCTS block.
+	time_t timestamp;            ///< Timestamp when the savegame was created.
+	std::string revision;        ///< Program version that wrote the savegame.
+	std::string scenario_name;   ///< Name of the scenario of the savegame.
+};
+
+static std::map<std::string, PreloadCacheEntry> _preload_cache;  ///< Cached savegame preload results, by file path.
+static bool _preload_cache_loaded = false;                       ///< Whether #_preload_cache was read from disk.
+
+/**
+ * Get the path of the savegame preload cache file.
+ * @return The path.
+ */
+static std::string PreloadCachePath()
+{
+	std::string path = freerct_userdata_prefix();
+	path += DIR_SEP;
+	path += "savepreload.cache";
+	return path;
+}
+
+/** Load the savegame preload cache of the previous run, if present. */
+static void LoadPreloadCache()
+{
+	_preload_cache.clear();
+
+	std::ifstream file(PreloadCachePath());
+	if (!file.is_open()) return;
+	std::string line;
+	if (!std::getline(file, line) || line != "FRCPRELOAD 1") return;
+	while (std::getline(file, line)) {
+		/* Each line holds tab-separated size, mtime, success, version, timestamp, revision, scenario name,
+		 * and file path (path last, it may contain odd characters). */
+		PreloadCacheEntry entry;
+		size_t start = 0;
+		std::string fields[7];
+		int field = 0;
+		for (; field < 7; field++) {
+			size_t tab = line.find('\t', start);
+			if (tab == std::string::npos) break;
+			fields[field] = line.substr(start, tab - start);
+			start = tab + 1;
+		}
+		if (field != 7 || start >= line.size()) continue; // Malformed line, the file will just be re-read.
+		entry.size = strtoull(fields[0].c_str(), nullptr, 10);
+		entry.mtime = strtoll(fields[1].c_str(), nullptr, 10);
+		entry.load_success = fields[2] == "1";
+		entry.fcts_version = atoi(fields[3].c_str());
+		entry.timestamp = strtoll(fields[4].c_str(), nullptr, 10);
+		entry.revision = fields[5];
+		entry.scenario_name = fields[6];
+		_preload_cache[line.substr(start)] = entry;
+	}
+}
+
+/** Write the current savegame preload cache back to its file. */
+static void SavePreloadCache()
+{
+	std::ofstream file(PreloadCachePath(), std::ofstream::trunc);
+	if (!file.is_open()) return;
+	file << "FRCPRELOAD 1\n";
+	for (const auto &iter : _preload_cache) {
+		const PreloadCacheEntry &entry = iter.second;
+		file << entry.size << '\t' << entry.mtime << '\t' << (entry.load_success ? 1 : 0) << '\t' << entry.fcts_version << '\t'
+				<< entry.timestamp << '\t' << entry.revision << '\t' << entry.scenario_name << '\t' << iter.first << '\n';
+	}
+}
+
+/**
+ * Reconstruct the preload data of a savegame from its cache entry, without touching the file.
+ * @param path Path of the savegame file.
+ * @param entry Cache entry of the file.
+ * @return The preload data.
+ */
+static PreloadData PreloadFromCache(const std::string &path, const PreloadCacheEntry &entry)
+{
+	PreloadData pd;
+	pd.load_success = entry.load_success;
+	pd.filename = path.substr(path.find_last_of(DIR_SEP) + 1);
+	if (!entry.load_success) return pd; // Like a failed #PreloadGameFile, the other fields are invalid.
+
+	pd.fcts_version = entry.fcts_version;
+	pd.timestamp = entry.timestamp;
+	pd.revision = entry.revision;
+	/* The load dialog only uses the name of the scenario, the rest stays at its defaults. */
+	pd.scenario.reset(new Scenario);
+	pd.scenario->SetDefaultScenario();
+	pd.scenario->name = entry.scenario_name;
+	return pd;
+}
+
+/**
+ * Preload all savegame files in the savegame directory.
+ * Results are cached in a sidecar index file and revalidated by file size and modification time,
+ * so only new and changed savegames are actually read. Entries of removed files are dropped.
+ * @return Preload data of all savegames found.
+ */
+std::vector<PreloadData> PreloadSavegameDirectory()
+{
+	if (!_preload_cache_loaded) {
+		LoadPreloadCache();
+		_preload_cache_loaded = true;
+	}
+
+	std::vector<PreloadData> result;
+	std::map<std::string, PreloadCacheEntry> fresh;
+	bool dirty = false;
+	for (const std::string &path : GetAllEntries(SavegameDirectory())) {
+		if (path.size() <= 4 || path.compare(path.size() - 4, 4, ".fct") != 0) continue;
+
+		uint64 fsize;
+		int64 mtime;
+		const bool has_stats = GetFileStats(path, &fsize, &mtime);
+		if (has_stats) {
+			const auto iter = _preload_cache.find(path);
+			if (iter != _preload_cache.end() && iter->second.size == fsize && iter->second.mtime == mtime) {
+				fresh[path] = iter->second;
+				result.push_back(PreloadFromCache(path, iter->second));
+				continue;
+			}
+		}
+
+		PreloadData pd = PreloadGameFile(path.c_str());
+		if (has_stats) {
+			PreloadCacheEntry entry;
+			entry.size = fsize;
+			entry.mtime = mtime;
+			entry.load_success = pd.load_success;
+			entry.fcts_version = pd.load_success ? pd.fcts_version : 0;
+			entry.timestamp = pd.timestamp;
+			entry.revision = pd.revision;
+			entry.scenario_name = pd.scenario != nullptr ? pd.scenario->name : "";
+			fresh[path] = entry;
+			dirty = true;
+		}
+		result.push_back(std::move(pd));
+	}
+
+	if (dirty || fresh.size() != _preload_cache.size()) {
+		_preload_cache.swap(fresh);
+		SavePreloadCache();
+	} else {
+		_preload_cache.swap(fresh);
+	}
+	return result;
+}
+
 /**
  * Save the current game state to file.
  * @param fname Name of the file to write.
- * @return Whether saving was successful.
+ * @param background Perform the disk write on a background thread, so the game is only paused while serializing to memory.
+ * @param allow_delta Write a differential save against the current base snapshot when possible. @see WriteDeltaSaveBuffer
+ * @return Whether saving was successful. When writing in the background, write errors are only reported to the console.
  * @todo Show an error message if this fails.
  */
-bool SaveGameFile(const char *fname)
+bool SaveGameFile(const char *fname, bool background, bool allow_delta)
 {
-	FILE *fp = fopen(fname, "wb");
-	if (fp == nullptr) return false;
-
-	Saver svr(fp);
+	Saver svr;
 	SaveElements(svr);
-	fclose(fp);
+	std::vector<uint8> data = svr.TakeBuffer();
+	std::vector<SaveChunk> chunks = svr.TakeChunks();
+
+	/* Autosaves favour compression speed over the best ratio. */
+	const int level = background ? std::min(_save_compression_level, Z_BEST_SPEED) : _save_compression_level;
+
+	FinishPendingSave(); // At most one background write runs at a time, which also serializes access to #_delta_base.
+	if (background) {
+		_task_system.Submit([fname = std::string(fname), data = std::move(data), chunks = std::move(chunks), level, allow_delta]() {
+			const bool written = allow_delta ? WriteDeltaSaveBuffer(fname, data, chunks, level) : WriteSaveBuffer(fname, data, chunks, level);
+			if (!written) {
+				fprintf(stderr, "WARNING: Writing savegame '%s' failed.\n", fname.c_str());
+			}
+			_background_save_result = written ? 1 : -1;  // Picked up by #ProcessSaveNotifications on the game thread.
+		}, TKP_LOW, &_save_group);
+		return true;
+	}
+
+	if (allow_delta ? !WriteDeltaSaveBuffer(fname, data, chunks, level) : !WriteSaveBuffer(fname, data, chunks, level)) return false;
 
 #ifdef WEBASSEMBLY
 	printf("WEBASSEMBLY: Game saved to %s\n", fname);
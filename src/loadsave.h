@@ -21,32 +21,86 @@ struct Scenario;
 static const std::string SAVEGAME_DIRECTORY("save");  ///< The directory where savegames are stored, relative to the user data directory.
 static const std::string TRACK_DESIGN_DIRECTORY("tracks");  ///< The directory where track designs are stored, relative to the user data directory.
 
-/** Class for loading a save game. */
+/**
+ * Class for loading a save game.
+ * Data is always read from memory (the whole file is read or expanded in one go beforehand),
+ * so loading does not funnel every scalar through a file operation.
+ */
 class Loader {
 public:
-	explicit Loader(FILE *fp);
+	Loader();
 	explicit Loader(RcdFileReader *rcd);
 	explicit Loader(const uint8 *data, size_t length);
 
 	uint32 OpenPattern(const char *name, bool may_fail = false, bool name_only = false);
 	void ClosePattern();
 
-	uint8 GetByte();
-	uint16 GetWord();
-	uint32 GetLong();
-	uint64 GetLongLong();
+	/**
+	 * Get the next byte from the stream (or the cache).
+	 * @return The read next byte.
+	 */
+	inline uint8 GetByte()
+	{
+		if (this->cache_count > 0) {
+			this->cache_count--;
+			return this->cache[this->cache_count];
+		}
+		if (this->binary_stream.has_value()) {
+			if (this->binary_stream->second == 0) throw LoadingError("End of data stream encountered");
+			this->binary_stream->second--;
+			return *this->binary_stream->first++;
+		}
+		if (this->rcd_file != nullptr) return this->GetRcdByte();
+		return 0;
+	}
+
+	/**
+	 * Get the next word from the stream (or the cache).
+	 * @return The read next word.
+	 */
+	inline uint16 GetWord()
+	{
+		uint16 v = this->GetByte();
+		uint16 w = this->GetByte();
+		return v | (w << 8);
+	}
+
+	/**
+	 * Get the next long word from the stream (or the cache).
+	 * @return The read next long word.
+	 */
+	inline uint32 GetLong()
+	{
+		uint32 v = this->GetWord();
+		uint32 w = this->GetWord();
+		return v | (w << 16);
+	}
+
+	/**
+	 * Get the next long long word from the stream (or the cache).
+	 * @return The read next long long word.
+	 */
+	inline uint64 GetLongLong()
+	{
+		uint64 v = this->GetLong();
+		uint64 w = this->GetLong();
+		return v | (w << 32);
+	}
+
+	void GetBlob(uint8 *address, size_t length);
 	std::string GetText();
 
 	void VersionMismatch(uint saved_version, uint current_version);
 
 private:
 	bool HasNoInput() const;
+	uint8 GetRcdByte();
 	void PutByte(uint8 val);
 
-	std::vector<std::string> pattern_names; ///< Stack of the currently loaded pattern.
+	std::vector<const char *> pattern_names; ///< Stack of the currently loaded pattern. The names are not owned and must outlive the pattern.
 
-	/** Data streams being loaded. All except at most one of these must be \c nullptr or \c std::nullopt. */
-	FILE *fp;
+	/** Data streams being loaded. All except at most one of these must be \c nullptr or \c std::nullopt.
+	 * When both are absent, the loader default-initializes everything that is loaded from it. */
 	RcdFileReader *rcd_file;
 	std::optional<std::pair<const uint8*, size_t>> binary_stream;
 
@@ -54,26 +108,78 @@ private:
 	uint8 cache[8];       ///< Stack with temporary values to return on next read.
 };
 
-/** Class for saving a savegame. */
+/** An independently addressable chunk of serialized game data. */
+struct SaveChunk {
+	std::string name;  ///< Name of the chunk (4 characters).
+	size_t begin;      ///< Offset of the first byte of the chunk in the serialized data.
+};
+
+/**
+ * Class for saving a savegame.
+ * The game state is serialized to memory, so the (slow) disk write can happen
+ * after serialization is done, possibly on a background thread.
+ */
 class Saver {
 public:
-	Saver(FILE *fp);
+	Saver();
+
+	void StartChunk(const char *name);
 
 	void StartPattern(const char *name);
 	void StartPattern(const char *name, uint32 version);
 	void EndPattern();
 
-	void PutByte(uint8 val);
-	void PutWord(uint16 val);
-	void PutLong(uint32 val);
-	void PutLongLong(uint64 val);
+	/**
+	 * Write a byte to the output stream.
+	 * @param val Value to write.
+	 */
+	inline void PutByte(uint8 val)
+	{
+		this->buffer.push_back(val);
+	}
+
+	/**
+	 * Write a word to the output stream.
+	 * @param val Value to write.
+	 */
+	inline void PutWord(uint16 val)
+	{
+		this->PutByte(val);
+		this->PutByte(val >> 8);
+	}
+
+	/**
+	 * Write a long word to the output stream.
+	 * @param val Value to write.
+	 */
+	inline void PutLong(uint32 val)
+	{
+		this->PutWord(val);
+		this->PutWord(val >> 16);
+	}
+
+	/**
+	 * Write a long long word to the output stream.
+	 * @param val Value to write.
+	 */
+	inline void PutLongLong(uint64 val)
+	{
+		this->PutLong(val);
+		this->PutLong(val >> 32);
+	}
+
+	void PutBlob(const uint8 *data, size_t length);
 	void PutText(const std::string &str, int length = -1);
 
 	void CheckNoOpenPattern() const;
 
+	std::vector<uint8> TakeBuffer();
+	std::vector<SaveChunk> TakeChunks();
+
 private:
-	FILE *fp; ///< Output file stream.
-	std::vector<std::string> pattern_names; ///< Stack of the current pattern names.
+	std::vector<uint8> buffer;      ///< Serialized game data.
+	std::vector<SaveChunk> chunks;  ///< Chunk boundaries in #buffer, in serialization order.
+	std::vector<const char *> pattern_names; ///< Stack of the current pattern names. The names are not owned and must outlive the pattern.
 };
 
 /** Holds basic data about a savegame file. */
@@ -98,10 +204,14 @@ struct PreloadData {
 
 void LoadGame(Loader &ldr);
 bool LoadGameFile(const char *fname);
-bool SaveGameFile(const char *fname);
+bool SaveGameFile(const char *fname, bool background = false, bool allow_delta = false);
+void FinishPendingSave();
+void ProcessSaveNotifications();
 PreloadData Preload(Loader &ldr);
 PreloadData PreloadGameFile(const char *fname);
+std::vector<PreloadData> PreloadSavegameDirectory();
 
 extern bool _automatically_resave_files;
+extern int _save_compression_level;
 
 #endif
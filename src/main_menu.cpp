@@ -26,6 +26,16 @@ public:
 	WmMouseEvent OnMouseButtonEvent(MouseButtons state, WmMouseEventMode mode) override;
 	void OnDraw(MouseModeSelector *selector) override;
 	bool OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &symbol) override;
+	void TimeoutCallback() override;
+
+	/**
+	 * The menu only overlays the showcase park, its own contents do not change with game time.
+	 * @return Always \c false.
+	 */
+	bool DisplaysGameState() const override
+	{
+		return false;
+	}
 
 private:
 	Realtime animstart;            ///< Time when the animation started.
@@ -50,6 +60,7 @@ MainMenuGui::MainMenuGui() : Window(WC_MAIN_MENU, ALL_WINDOWS_OF_TYPE)
 	this->animstart = this->last_time = Time();
 	this->time_in_camera = 0;
 	this->current_camera_id = 0;
+	this->timeout = 1;  // Advance the animation every tick.
 }
 
 MainMenuGui::~MainMenuGui()
@@ -95,14 +106,20 @@ WmMouseEvent MainMenuGui::OnMouseButtonEvent(const MouseButtons state, WmMouseEv
 	return WMME_NONE;
 }
 
-void MainMenuGui::OnDraw([[maybe_unused]] MouseModeSelector *selector)
+/**
+ * Advance the splash screen and the camera animation.
+ * Between camera switches the menu overlay does not change, so it is only
+ * marked dirty while the splash screen is fading.
+ */
+void MainMenuGui::TimeoutCallback()
 {
 	const Realtime current_time = Time();
-	double frametime = Delta(this->animstart, current_time);
-	if (is_splash_screen && frametime > 3 * _main_menu_config.splash_duration) {
-		is_splash_screen = false;
-		this->animstart = current_time;
-		frametime = 0;
+	if (is_splash_screen) {
+		this->MarkDirty();
+		if (Delta(this->animstart, current_time) > 3 * _main_menu_config.splash_duration) {
+			is_splash_screen = false;
+			this->animstart = current_time;
+		}
 	}
 
 	this->time_in_camera += Delta(last_time, current_time);
@@ -115,6 +132,12 @@ void MainMenuGui::OnDraw([[maybe_unused]] MouseModeSelector *selector)
 		vp->view_pos = _main_menu_config.cameras.at(this->current_camera_id).pos;
 	}
 	this->last_time = current_time;
+	this->timeout = 1;  // The animation runs for as long as the menu exists.
+}
+
+void MainMenuGui::OnDraw([[maybe_unused]] MouseModeSelector *selector)
+{
+	const double frametime = Delta(this->animstart, Time());
 
 	if (is_splash_screen && frametime < 2 * _main_menu_config.splash_duration) {
 		_video.FillRectangle(Rectangle32(0, 0, _video.Width(), _video.Height()), 0xff);
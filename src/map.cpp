@@ -14,6 +14,7 @@
 #include "stdafx.h"
 #include "map.h"
 #include "memory.h"
+#include "path.h"
 #include "viewport.h"
 #include "math_func.h"
 #include "sprite_store.h"
@@ -24,6 +25,88 @@
  */
 VoxelWorld _world;
 
+/**
+ * Changed voxel columns since the last displayed frame.
+ * @ingroup map_group
+ */
+WorldDirtyTracker _world_dirty;
+
+/**
+ * Adapt the chunk version grid to a new world size.
+ * All chunk versions restart at \c 0; consumers comparing versions must resynchronize.
+ * @param xs X size of the world.
+ * @param ys Y size of the world.
+ */
+void WorldDirtyTracker::SetWorldSize(uint16 xs, uint16 ys)
+{
+	this->chunks_x = (xs + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	this->chunks_y = (ys + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	this->chunk_versions.assign(this->chunks_x * this->chunks_y, 0);
+}
+
+VoxelObjectIndex _voxel_object_index; ///< Spatial index of all voxel objects in the world.
+
+/** Default constructor, all chunks are empty. */
+VoxelObjectIndex::VoxelObjectIndex()
+{
+	std::fill_n(this->chunks, lengthof(this->chunks), nullptr);
+}
+
+/**
+ * Register a voxel object in the chunk of its current position.
+ * @param vo %Voxel object to register.
+ */
+void VoxelObjectIndex::Add(VoxelObject *vo)
+{
+	vo->chunk_index = (vo->vox_pos.x / CHUNK_SIZE) + (vo->vox_pos.y / CHUNK_SIZE) * (WORLD_X_SIZE / CHUNK_SIZE);
+
+	VoxelObject **head = &this->chunks[vo->chunk_index];
+	vo->next_chunk_object = *head;
+	if (vo->next_chunk_object != nullptr) vo->next_chunk_object->prev_chunk_object = vo;
+	vo->prev_chunk_object = nullptr;
+	*head = vo;
+}
+
+/**
+ * Deregister a voxel object from the chunk it was added to.
+ * The chunk is not derived from the current position, as movement code may have updated
+ * #VoxelObject::vox_pos already before removing the object from its former voxel.
+ * @param vo %Voxel object to deregister.
+ */
+void VoxelObjectIndex::Remove(VoxelObject *vo)
+{
+	if (vo->next_chunk_object != nullptr) vo->next_chunk_object->prev_chunk_object = vo->prev_chunk_object;
+	if (vo->prev_chunk_object != nullptr) {
+		vo->prev_chunk_object->next_chunk_object = vo->next_chunk_object;
+	} else {
+		assert(this->chunks[vo->chunk_index] == vo);
+		this->chunks[vo->chunk_index] = vo->next_chunk_object;
+	}
+	vo->next_chunk_object = nullptr;
+	vo->prev_chunk_object = nullptr;
+}
+
+/**
+ * Apply a function to every voxel object in a rectangle of voxel stacks.
+ * @param rect Rectangle to query, must be inside the world.
+ * @param func Function to apply to each object in the rectangle.
+ * @note The function must not add or remove voxel objects.
+ */
+void VoxelObjectIndex::ForEachInRectangle(const Rectangle16 &rect, const std::function<void(VoxelObject *)> &func) const
+{
+	if (rect.width == 0 || rect.height == 0) return;
+
+	uint cx_last = (rect.base.x + rect.width - 1) / CHUNK_SIZE;
+	uint cy_last = (rect.base.y + rect.height - 1) / CHUNK_SIZE;
+	for (uint cy = rect.base.y / CHUNK_SIZE; cy <= cy_last; cy++) {
+		for (uint cx = rect.base.x / CHUNK_SIZE; cx <= cx_last; cx++) {
+			for (VoxelObject *vo = this->chunks[cx + cy * (WORLD_X_SIZE / CHUNK_SIZE)]; vo != nullptr; vo = vo->next_chunk_object) {
+				if (rect.IsPointInside(vo->vox_pos.x, vo->vox_pos.y)) func(vo);
+			}
+		}
+	}
+}
+
 /** Make the voxel empty. */
 void Voxel::ClearVoxel()
 {
@@ -49,17 +132,18 @@ void Voxel::Load(Loader &ldr)
 	this->ClearVoxel();
 	if (version >= 1 && version <= CURRENT_VERSION_Voxel) {
 		this->ground = ldr.GetLong(); /// \todo Check sanity of the data.
-		this->instance = ldr.GetByte();
-		if (this->instance == SRI_FREE) {
+		const SmallRideInstance instance = static_cast<SmallRideInstance>(ldr.GetByte());
+		this->SetInstance(instance);
+		if (instance == SRI_FREE) {
 			this->instance_data = 0; // Full rides load after the world, overwriting map data.
-		} else if (this->instance >= SRI_RIDES_START && this->instance < SRI_FULL_RIDES) {
+		} else if (instance >= SRI_RIDES_START && instance < SRI_FULL_RIDES) {
 			this->instance_data = ldr.GetWord();
 		} else {
 			throw LoadingError("Unknown voxel instance data");
 		}
 
 		if (version >= 2) this->fences = ldr.GetWord();
-		if (version == 3 && this->instance == SRI_PATH) {
+		if (version == 3 && instance == SRI_PATH) {
 			int t = GB(instance_data, 6, 2);
 			this->instance_data = MakePathInstanceData(GB(instance_data, 0, 6), static_cast<PathType>(t), t == PAT_TILED ? PAS_QUEUE_PATH : PAS_NORMAL_PATH);
 		}
@@ -76,9 +160,10 @@ void Voxel::Load(Loader &ldr)
 void Voxel::Save(Saver &svr) const
 {
 	svr.StartPattern("voxl", CURRENT_VERSION_Voxel);
-	svr.PutLong(this->ground);
-	if (this->instance >= SRI_RIDES_START && this->instance < SRI_FULL_RIDES) {
-		svr.PutByte(this->instance);
+	svr.PutLong(GB(this->ground, 0, 24)); // The instance bits are stored separately below.
+	const SmallRideInstance instance = this->GetInstance();
+	if (instance >= SRI_RIDES_START && instance < SRI_FULL_RIDES) {
+		svr.PutByte(instance);
 		svr.PutWord(this->instance_data);
 	} else {
 		svr.PutByte(SRI_FREE); // Full rides save their own data from the world.
@@ -155,8 +240,50 @@ void VoxelObject::Save(Saver &svr)
 }
 
 /** Default constructor. */
-VoxelStack::VoxelStack() : base(0), height(0)
+VoxelStack::VoxelStack() : base(0), height(0), owner(OWN_NONE), first_drawable(0), last_drawable(-1), base_ground(-1), top_ground(-1), visibility_dirty(true)
+{
+}
+
+/** Recompute the range of voxels in the stack that can produce sprites, and the ground offsets. */
+void VoxelStack::UpdateVisibility() const
 {
+	this->first_drawable = this->height;
+	this->last_drawable = -1;
+	this->base_ground = -1;
+	this->top_ground = -1;
+	for (uint i = 0; i < this->height; i++) {
+		const Voxel &v = this->voxels[i];
+		if (v.IsEmpty() && (v.GetFences() == 0 || v.GetFences() == ALL_INVALID_FENCES)) continue;
+		if (this->first_drawable > (int)i) this->first_drawable = i;
+		this->last_drawable = i;
+		if (v.GetGroundType() != GTP_INVALID) {
+			this->top_ground = i;
+			if (!IsImplodedSteepSlopeTop(v.GetGroundSlope())) this->base_ground = i;
+		}
+	}
+	this->visibility_dirty = false;
+}
+
+/**
+ * Drop pure air voxels at both ends of the stack, freeing their storage.
+ * Stacks only ever grow while playing (#MakeVoxelStack), so spans of air accumulate, for
+ * example below removed elevated paths. Compacting is limited to loading, when no pointers
+ * into the stack exist.
+ */
+void VoxelStack::Compact()
+{
+	uint16 first = 0;
+	uint16 last = this->height;
+	while (last > first && this->voxels[last - 1].IsAir()) last--;
+	while (first < last && this->voxels[first].IsAir()) first++;
+	if (first == 0 && last == this->height) return;
+
+	this->voxels.erase(this->voxels.begin() + last, this->voxels.end());
+	this->voxels.erase(this->voxels.begin(), this->voxels.begin() + first);
+	this->voxels.shrink_to_fit();
+	this->height = last - first;
+	this->base = (this->height == 0) ? 0 : this->base + first;
+	this->InvalidateVisibility();
 }
 
 /** Remove the stack. */
@@ -166,6 +293,7 @@ void VoxelStack::Clear()
 	this->base = 0;
 	this->height = 0;
 	this->owner = OWN_NONE;
+	this->InvalidateVisibility();
 }
 
 /**
@@ -182,10 +310,11 @@ bool VoxelStack::MakeVoxelStack(int16 new_base, uint16 new_height)
 
 	assert(this->height == 0 || (this->base >= new_base && this->base + this->height <= new_base + new_height));
 
-	for (int i = new_base; i < this->base; i++) this->voxels.insert(this->voxels.begin(), std::unique_ptr<Voxel>(new Voxel));
-	for (size_t i = new_height - this->voxels.size(); i > 0; i--) this->voxels.push_back(std::unique_ptr<Voxel>(new Voxel));
+	if (new_base < this->base) this->voxels.insert(this->voxels.begin(), this->base - new_base, Voxel());
+	this->voxels.resize(new_height);
 	this->height = new_height;
 	this->base = new_base;
+	this->InvalidateVisibility();
 	return true;
 }
 
@@ -203,7 +332,7 @@ const Voxel *VoxelStack::Get(int16 z) const
 	assert(z >= this->base);
 	z -= this->base;
 	assert((uint16)z < this->height);
-	return this->voxels[z].get();
+	return &this->voxels[z];
 }
 
 /**
@@ -227,12 +356,13 @@ Voxel *VoxelStack::GetCreate(int16 z, bool create)
 	assert(z >= this->base);
 	z -= this->base;
 	assert((uint16)z < this->height);
-	return this->voxels[z].get();
+	return &this->voxels[z];
 }
 
 /** Default constructor of the voxel world. */
 VoxelWorld::VoxelWorld() : x_size(64), y_size(64)
 {
+	this->stacks.resize(static_cast<size_t>(this->x_size) * this->y_size);
 }
 
 /**
@@ -248,57 +378,57 @@ void VoxelWorld::SetWorldSize(uint16 xs, uint16 ys)
 	this->x_size = xs;
 	this->y_size = ys;
 
-	/* Clear the world. */
-	for (uint pos = 0; pos < WORLD_X_SIZE * WORLD_Y_SIZE; pos++) {
-		this->stacks[pos].Clear();
-	}
-}
-
-/**
- * Add foundation bits from the bottom up to the given voxel.
- * @param world %Voxel storage.
- * @param xpos X position of the voxel stack.
- * @param ypos Y position of the voxel stack.
- * @param z Height of the ground.
- * @param bits Foundation bits to add.
- */
-static void AddFoundations(VoxelWorld *world, uint16 xpos, uint16 ypos, int16 z, uint8 bits)
-{
-	for (int16 zpos = 0; zpos < z; zpos++) {
-		Voxel *v = world->GetCreateVoxel(XYZPoint16(xpos, ypos, zpos), true);
-		if (v->GetFoundationType() == FDT_INVALID) {
-			v->SetFoundationType(FDT_GROUND);
-			v->SetFoundationSlope(bits);
-			continue;
-		}
-		v->SetFoundationSlope(v->GetFoundationSlope() | bits);
-	}
+	/* Allocate a cleared world, sized to the requested dimensions. */
+	this->stacks.clear();
+	this->stacks.resize(static_cast<size_t>(xs) * ys);
+	_world_dirty.SetWorldSize(xs, ys);
+	_world_dirty.MarkAll();
 }
 
 /**
  * Creates a world of flat tiles.
+ * Every stack is materialized directly at its final size from prototype voxels, instead of
+ * being grown voxel by voxel through #GetCreateVoxel. The latter costs a stack lookup and a
+ * possible reallocation per voxel, which makes (re)starting a scenario noticeably slow for
+ * large worlds.
  * @param z Height of the tiles.
  */
 void VoxelWorld::MakeFlatWorld(int16 z)
 {
 	this->edges_without_border_fence.clear();
+
+	Voxel ground;
+	ground.SetFoundationType(FDT_INVALID);
+	ground.SetGroundType(GTP_GRASS0);
+	ground.SetGroundSlope(ImplodeTileSlope(SL_FLAT));
+	ground.ClearInstances();
+
 	for (uint16 xpos = 0; xpos < this->x_size; xpos++) {
 		for (uint16 ypos = 0; ypos < this->y_size; ypos++) {
-			Voxel *v = this->GetCreateVoxel(XYZPoint16(xpos, ypos, z), true);
-			v->SetFoundationType(FDT_INVALID);
-			v->SetGroundType(GTP_GRASS0);
-			v->SetGroundSlope(ImplodeTileSlope(SL_FLAT));
-			v->ClearInstances();
+			/* Border stacks get foundations from the world floor up to the ground. */
+			uint8 bits = 0;
+			if (ypos == 0) bits |= 0xC0;
+			if (ypos == this->y_size - 1) bits |= 0x0C;
+			if (xpos == 0) bits |= 0x03;
+			if (xpos == this->x_size - 1) bits |= 0x30;
+
+			VoxelStack *vs = this->GetModifyStack(xpos, ypos);
+			if (bits == 0) {
+				vs->voxels.assign(1, ground);
+				vs->base = z;
+				vs->height = 1;
+			} else {
+				Voxel foundation;
+				foundation.SetFoundationType(FDT_GROUND);
+				foundation.SetFoundationSlope(bits);
+				vs->voxels.assign(z, foundation);
+				vs->voxels.push_back(ground);
+				vs->base = 0;
+				vs->height = z + 1;
+			}
+			vs->InvalidateVisibility();
 		}
 	}
-	for (uint16 xpos = 0; xpos < this->x_size; xpos++) {
-		AddFoundations(this, xpos, 0, z, 0xC0);
-		AddFoundations(this, xpos, this->y_size - 1, z, 0x0C);
-	}
-	for (uint16 ypos = 0; ypos < this->y_size; ypos++) {
-		AddFoundations(this, 0, ypos, z, 0x03);
-		AddFoundations(this, this->x_size - 1, ypos, z, 0x30);
-	}
 }
 
 /**
@@ -307,11 +437,9 @@ void VoxelWorld::MakeFlatWorld(int16 z)
  */
 int VoxelStack::GetBaseGroundOffset() const
 {
-	for (int i = this->height - 1; i >= 0; i--) {
-		const Voxel &v = *this->voxels[i];
-		if (v.GetGroundType() != GTP_INVALID && !IsImplodedSteepSlopeTop(v.GetGroundSlope())) return i;
-	}
-	NOT_REACHED();
+	if (this->visibility_dirty) this->UpdateVisibility();
+	if (this->base_ground < 0) NOT_REACHED();
+	return this->base_ground;
 }
 
 /**
@@ -320,11 +448,9 @@ int VoxelStack::GetBaseGroundOffset() const
  */
 int VoxelStack::GetTopGroundOffset() const
 {
-	for (int i = this->height - 1; i >= 0; i--) {
-		const Voxel &v = *this->voxels[i];
-		if (v.GetGroundType() != GTP_INVALID) return i;
-	}
-	NOT_REACHED();
+	if (this->visibility_dirty) this->UpdateVisibility();
+	if (this->top_ground < 0) NOT_REACHED();
+	return this->top_ground;
 }
 
 /**
@@ -347,8 +473,7 @@ void VoxelStack::Load(Loader &ldr)
 			this->owner = (TileOwner)owner;
 			this->voxels.resize(height);
 			for (uint i = 0; i < height; i++) {
-				this->voxels[i].reset(new Voxel);
-				this->voxels[i]->Load(ldr);
+				this->voxels[i].Load(ldr);
 			}
 
 			/* In version 3 of VSTK, the fences of the lowest corner of steep slopes have moved from the top voxel to the base voxel. */
@@ -362,25 +487,26 @@ void VoxelStack::Load(Loader &ldr)
 				};
 
 				for (uint i = 0; i < height; i++) {
-					if (this->voxels[i]->GetGroundType() == GTP_INVALID) continue;
-					if (!IsImplodedSteepSlopeTop(this->voxels[i]->GetGroundSlope())) continue;
-					uint16 mask = low_fences_mask[this->voxels[i]->GetGroundSlope() - ISL_TOP_STEEP_NORTH];
+					if (this->voxels[i].GetGroundType() == GTP_INVALID) continue;
+					if (!IsImplodedSteepSlopeTop(this->voxels[i].GetGroundSlope())) continue;
+					uint16 mask = low_fences_mask[this->voxels[i].GetGroundSlope() - ISL_TOP_STEEP_NORTH];
 
 					/* Take out the fences of the top voxel that should be in the base voxel.
 					 * Make the low fences in the high voxel invalid. */
-					uint16 fences = this->voxels[i]->GetFences();
+					uint16 fences = this->voxels[i].GetFences();
 					uint16 lower_fences = fences & mask;
 					uint16 high_invalid = ALL_INVALID_FENCES & mask;
 					mask ^= 0xffff;
-					this->voxels[i]->SetFences(high_invalid | (fences & mask));
+					this->voxels[i].SetFences(high_invalid | (fences & mask));
 
 					/* Fix low fences. */
-					fences = this->voxels[i + 1]->GetFences();
-					this->voxels[i + 1]->SetFences(lower_fences | (fences & mask));
+					fences = this->voxels[i + 1].GetFences();
+					this->voxels[i + 1].SetFences(lower_fences | (fences & mask));
 
 					break; // Only one steep ground slope in a voxel stack at most.
 				}
 			}
+			this->Compact();
 		}
 	}
 	ldr.ClosePattern();
@@ -397,7 +523,7 @@ void VoxelStack::Save(Saver &svr) const
 	svr.PutWord(this->base);
 	svr.PutWord(this->height);
 	svr.PutByte(this->owner);
-	for (uint i = 0; i < this->height; i++) this->voxels[i]->Save(svr);
+	for (uint i = 0; i < this->height; i++) this->voxels[i].Save(svr);
 	svr.EndPattern();
 }
 
@@ -413,7 +539,10 @@ VoxelStack *VoxelWorld::GetModifyStack(uint16 x, uint16 y)
 	assert(x < WORLD_X_SIZE && x < this->x_size);
 	assert(y < WORLD_Y_SIZE && y < this->y_size);
 
-	return &this->stacks[x + y * WORLD_X_SIZE];
+	/* The caller may modify the stack contents, pessimistically assume it will. */
+	_world_dirty.MarkColumn(x, y);
+	this->stacks[x + y * this->x_size].InvalidateVisibility();
+	return &this->stacks[x + y * this->x_size];
 }
 
 /**
@@ -428,7 +557,7 @@ const VoxelStack *VoxelWorld::GetStack(uint16 x, uint16 y) const
 	assert(x < WORLD_X_SIZE && x < this->x_size);
 	assert(y < WORLD_Y_SIZE && y < this->y_size);
 
-	return &this->stacks[x + y * WORLD_X_SIZE];
+	return &this->stacks[x + y * this->x_size];
 }
 
 /**
@@ -687,6 +816,7 @@ void VoxelWorld::UpdateLandBorderFence(uint16 x, uint16 y, uint16 width, uint16
 void VoxelWorld::SetTileOwner(uint16 x, uint16 y, TileOwner owner)
 {
 	this->GetModifyStack(x, y)->owner = owner;
+	_path_network_version++;  // The park border moved, route answers towards it are stale.
 
 	UpdateLandBorderFence(x, y, 1, 1);
 }
@@ -706,6 +836,7 @@ void VoxelWorld::SetTileOwnerRect(uint16 x, uint16 y, uint16 width, uint16 heigh
 			this->GetModifyStack(ix, iy)->owner = owner;
 		}
 	}
+	_path_network_version++;  // The park border moved, route answers towards it are stale.
 
 	UpdateLandBorderFence(x, y, width, height);
 }
@@ -16,13 +16,14 @@
 #include "sprite_store.h"
 #include "bitmath.h"
 
+#include <functional>
 #include <map>
 #include <set>
 
 class Viewport;
 
-static const int WORLD_X_SIZE = 128; ///< Maximal length of the X side (North-West side) of the world.
-static const int WORLD_Y_SIZE = 128; ///< Maximal length of the Y side (North-East side) of the world.
+static const int WORLD_X_SIZE = 512; ///< Maximal length of the X side (North-West side) of the world.
+static const int WORLD_Y_SIZE = 512; ///< Maximal length of the Y side (North-East side) of the world.
 static const int WORLD_Z_SIZE =  64; ///< Maximal height of the world.
 
 /**
@@ -48,6 +49,172 @@ enum SmallRideInstance {
 
 class VoxelObject;
 
+/**
+ * Tracker of voxel columns that changed since the last displayed frame.
+ * World mutations (terraforming, construction, moving persons and ride cars) mark the columns
+ * they touch, so displays can limit redrawing to the changed screen regions instead of
+ * re-collecting the entire visible world every frame.
+ *
+ * Besides the per-frame column lists, the tracker keeps a version counter per chunk of
+ * #CHUNK_SIZE by #CHUNK_SIZE stacks that is bumped on every change in the chunk. Consumers
+ * that do not process every frame can remember the versions they saw and ask which chunks
+ * advanced since, instead of hooking every mutation site.
+ * @ingroup map_group
+ */
+class WorldDirtyTracker {
+public:
+	WorldDirtyTracker() : all_dirty(true)
+	{
+	}
+
+	void SetWorldSize(uint16 xs, uint16 ys);
+
+	/**
+	 * Mark a single voxel column as structurally changed (ground, paths, fences, rides, scenery).
+	 * @param x X position of the voxel stack.
+	 * @param y Y position of the voxel stack.
+	 */
+	inline void MarkColumn(int x, int y)
+	{
+		this->BumpChunk(x, y);
+		if (this->all_dirty) return;
+		if (this->columns.size() >= MAX_TRACKED_COLUMNS) {
+			this->MarkAll();
+			return;
+		}
+		this->columns.emplace_back(x, y);
+	}
+
+	/**
+	 * Mark a single voxel column as changed by a moving voxel object (person or ride car).
+	 * The static geometry of the column is unaffected, only the object sprites need re-collecting.
+	 * @param x X position of the voxel stack.
+	 * @param y Y position of the voxel stack.
+	 */
+	inline void MarkObjectColumn(int x, int y)
+	{
+		this->BumpChunk(x, y);
+		if (this->all_dirty) return;
+		if (this->object_columns.size() >= MAX_TRACKED_COLUMNS) {
+			this->MarkAll();
+			return;
+		}
+		this->object_columns.emplace_back(x, y);
+	}
+
+	/** Mark the entire world as changed. */
+	inline void MarkAll()
+	{
+		this->all_dirty = true;
+		this->columns.clear();
+		this->object_columns.clear();
+		for (uint32 &version : this->chunk_versions) version++;
+	}
+
+	/**
+	 * Get the number of chunks along the X axis.
+	 * @return Horizontal chunk count.
+	 */
+	inline uint16 ChunksX() const
+	{
+		return this->chunks_x;
+	}
+
+	/**
+	 * Get the number of chunks along the Y axis.
+	 * @return Vertical chunk count.
+	 */
+	inline uint16 ChunksY() const
+	{
+		return this->chunks_y;
+	}
+
+	/**
+	 * Get the change version of a chunk. The counter increases monotonically with every
+	 * change of a voxel column in the chunk (the world size is the sole exception, it
+	 * restarts all counters).
+	 * @param cx X position of the chunk.
+	 * @param cy Y position of the chunk.
+	 * @return Current version of the chunk.
+	 */
+	inline uint32 GetChunkVersion(uint16 cx, uint16 cy) const
+	{
+		return this->chunk_versions[cx + cy * this->chunks_x];
+	}
+
+	/**
+	 * Whether nothing was marked since the last #Reset.
+	 * @return No changes are pending.
+	 */
+	inline bool IsEmpty() const
+	{
+		return !this->all_dirty && this->columns.empty() && this->object_columns.empty();
+	}
+
+	/** All pending changes have been processed, start a new tracking period. */
+	inline void Reset()
+	{
+		this->all_dirty = false;
+		this->columns.clear();
+		this->object_columns.clear();
+	}
+
+	/** When more columns than this change in one frame, tracking them individually is no longer worthwhile. */
+	static const uint MAX_TRACKED_COLUMNS = 512;
+
+	/** Length of the edge of a square chunk of voxel stacks, must be a power of two. */
+	static const uint CHUNK_SIZE = 16;
+
+	std::vector<Point16> columns;        ///< Columns with structural changes (may contain duplicates).
+	std::vector<Point16> object_columns; ///< Columns with voxel-object changes only (may contain duplicates).
+	bool all_dirty;                      ///< The whole world should be considered changed.
+
+private:
+	/**
+	 * Advance the version of the chunk containing the given voxel column.
+	 * @param x X position of the voxel stack.
+	 * @param y Y position of the voxel stack.
+	 */
+	inline void BumpChunk(int x, int y)
+	{
+		const uint cx = x / CHUNK_SIZE;
+		const uint cy = y / CHUNK_SIZE;
+		if (cx >= this->chunks_x || cy >= this->chunks_y) return;
+		this->chunk_versions[cx + cy * this->chunks_x]++;
+	}
+
+	std::vector<uint32> chunk_versions;  ///< Change version of every chunk, row by row.
+	uint16 chunks_x = 0;                 ///< Number of chunks along the X axis.
+	uint16 chunks_y = 0;                 ///< Number of chunks along the Y axis.
+};
+
+extern WorldDirtyTracker _world_dirty;
+
+/**
+ * Spatial index of all voxel objects (persons and ride cars) in the world, grouped by chunks
+ * of #CHUNK_SIZE by #CHUNK_SIZE voxel stacks. Objects register and deregister themselves when
+ * they enter or leave a voxel (#VoxelObject::AddSelf and #VoxelObject::RemoveSelf), so area
+ * queries only walk the chains of the chunks overlapping the queried rectangle instead of
+ * visiting every voxel in it.
+ * @ingroup map_group
+ */
+class VoxelObjectIndex {
+public:
+	VoxelObjectIndex();
+
+	void Add(VoxelObject *vo);
+	void Remove(VoxelObject *vo);
+	void ForEachInRectangle(const Rectangle16 &rect, const std::function<void(VoxelObject *)> &func) const;
+
+	static const uint CHUNK_SIZE = 16; ///< Length of the side of a chunk, in voxel stacks.
+
+private:
+	/** First voxel object of each chunk, row by row. */
+	VoxelObject *chunks[(WORLD_X_SIZE / CHUNK_SIZE) * (WORLD_Y_SIZE / CHUNK_SIZE)];
+};
+
+extern VoxelObjectIndex _voxel_object_index;
+
 /**
  * One voxel cell in the world.
  * A voxel consists of four parts and the ground data.
@@ -61,8 +228,7 @@ class VoxelObject;
  */
 struct Voxel {
 public:
-	uint8 instance;       ///< Ride instances that uses this voxel.
-	uint16 instance_data; ///< %Voxel data of the #instance stored here.
+	uint16 instance_data; ///< %Voxel data of the ride instance stored here.
 
 	/** Constructor */
 	explicit Voxel()
@@ -76,7 +242,7 @@ public:
 	 */
 	inline SmallRideInstance GetInstance() const
 	{
-		return (SmallRideInstance)this->instance;
+		return (SmallRideInstance)GB(this->ground, 24, 8);
 	}
 
 	/**
@@ -85,7 +251,7 @@ public:
 	 */
 	inline void SetInstance(SmallRideInstance instance)
 	{
-		this->instance = instance;
+		SB(this->ground, 24, 8, instance);
 	}
 
 	/**
@@ -164,6 +330,7 @@ public:
 	 *   - bit 15: Northern corner of NW edge is up.
 	 * - bit 16..20 (5): Imploded ground slope. @see #ExpandTileSlope
 	 * - bit 21..23 (3): Growth of the tile grass.
+	 * - bit 24..31 (8): Ride instance that uses this voxel (not stored in the save game). @see SmallRideInstance
 	 */
 	uint32 ground;
 
@@ -280,6 +447,16 @@ public:
 		return this->GetInstance() == SRI_FREE && this->GetGroundType() == GTP_INVALID && this->GetFoundationType() == FDT_INVALID;
 	}
 
+	/**
+	 * Is the voxel pure air, without contents, fences, or voxel objects?
+	 * @return Whether nothing in the voxel can be seen or interacted with.
+	 */
+	inline bool IsAir() const
+	{
+		return this->IsEmpty() && this->voxel_objects == nullptr &&
+				(this->fences == 0 || this->fences == ALL_INVALID_FENCES);
+	}
+
 	VoxelObject *voxel_objects; ///< First voxel object in this voxel.
 
 	/**
@@ -299,7 +476,7 @@ public:
 /** Base class for (moving) objects that are stored at a voxel position for easy retrieval during drawing. */
 class VoxelObject {
 public:
-	VoxelObject() : next_object(nullptr), prev_object(nullptr), added(false)
+	VoxelObject() : next_object(nullptr), prev_object(nullptr), next_chunk_object(nullptr), prev_chunk_object(nullptr), chunk_index(0), added(false)
 	{
 	}
 
@@ -323,11 +500,15 @@ public:
 	{
 		assert(!this->added);
 		this->added = true;
+		this->StorePreviousPosition();  // A fresh or moved object has no older position to interpolate from.
 
 		this->next_object = v->voxel_objects;
 		if (this->next_object != nullptr) this->next_object->prev_object = this;
 		v->voxel_objects = this;
 		this->prev_object = nullptr;
+
+		_voxel_object_index.Add(this);
+		_world_dirty.MarkObjectColumn(this->vox_pos.x, this->vox_pos.y);
 	}
 
 	/**
@@ -346,6 +527,9 @@ public:
 			assert(v->voxel_objects == this);
 			v->voxel_objects = this->next_object;
 		}
+
+		_voxel_object_index.Remove(this);
+		_world_dirty.MarkObjectColumn(this->vox_pos.x, this->vox_pos.y);
 	}
 
 	/**
@@ -399,12 +583,27 @@ public:
 	void Load(Loader &ldr);
 	void Save(Saver &svr);
 
+	/** Remember the current position as the previous-tick position, for render interpolation. */
+	inline void StorePreviousPosition()
+	{
+		this->prev_vox_pos = this->vox_pos;
+		this->prev_pix_pos = this->pix_pos;
+	}
+
 	VoxelObject *next_object; ///< Next voxel object in the linked list.
 	VoxelObject *prev_object; ///< Previous voxel object in the linked list.
+
+	VoxelObject *next_chunk_object; ///< Next voxel object in the chunk chain of #_voxel_object_index.
+	VoxelObject *prev_chunk_object; ///< Previous voxel object in the chunk chain of #_voxel_object_index.
+	uint16 chunk_index;             ///< Chunk of #_voxel_object_index the object is registered in (only valid while #added).
+
 	bool added;               ///< Whether the voxel object has been added to a voxel.
 
 	XYZPoint16 vox_pos; ///< %Voxel position of the object.
 	XYZPoint16 pix_pos; ///< Position of the object inside the voxel (0..255, but may be outside).
+
+	XYZPoint16 prev_vox_pos; ///< #vox_pos at the previous simulation tick, for render interpolation.
+	XYZPoint16 prev_pix_pos; ///< #pix_pos at the previous simulation tick, for render interpolation.
 };
 
 /**
@@ -426,7 +625,7 @@ static inline bool HasValidPath(uint16 instance_data)
  */
 static inline bool HasValidPath(const Voxel *v)
 {
-	return v->instance == SRI_PATH && HasValidPath(v->instance_data);
+	return v->GetInstance() == SRI_PATH && HasValidPath(v->instance_data);
 }
 
 /**
@@ -558,11 +757,46 @@ public:
 	void Save(Saver &svr) const;
 	void Load(Loader &ldr);
 
-	std::vector<std::unique_ptr<Voxel>> voxels;  ///< %Voxel array at this stack.
+	void Compact();
+
+	/**
+	 * Can the voxel at the given offset in #voxels produce sprites at all?
+	 * Voxels outside the precomputed drawable range are empty and have no fences; they can
+	 * be skipped during sprite collection (unless they contain moving voxel objects, which
+	 * the collector checks separately).
+	 * @param offset Offset of the voxel in #voxels.
+	 * @return The voxel may produce sprites.
+	 */
+	inline bool IsVoxelDrawable(int offset) const
+	{
+		if (this->visibility_dirty) this->UpdateVisibility();
+		return offset >= this->first_drawable && offset <= this->last_drawable;
+	}
+
+	/** The contents of the stack changed, the drawable range needs recomputing. */
+	inline void InvalidateVisibility()
+	{
+		this->visibility_dirty = true;
+	}
+
+	/**
+	 * %Voxel array at this stack.
+	 * The voxels are stored contiguously so walking a column stays in cache. Pointers into
+	 * the array are invalidated when the stack is resized; do not keep them across calls
+	 * that may create voxels.
+	 */
+	std::vector<Voxel> voxels;
 	int16 base;      ///< Height of the bottom voxel.
 	uint16 height;   ///< Number of voxels in the stack.
 	TileOwner owner; ///< Ownership of the base tile of this voxel stack.
+
+	mutable int first_drawable;    ///< Offset in #voxels of the lowest voxel that can produce sprites (only valid if not #visibility_dirty).
+	mutable int last_drawable;     ///< Offset in #voxels of the highest voxel that can produce sprites (only valid if not #visibility_dirty).
+	mutable int base_ground;       ///< Offset in #voxels of the ground base, \c -1 if the stack has no ground (only valid if not #visibility_dirty).
+	mutable int top_ground;        ///< Offset in #voxels of the ground top, \c -1 if the stack has no ground (only valid if not #visibility_dirty).
+	mutable bool visibility_dirty; ///< The precomputed drawable range and ground offsets are outdated.
 protected:
+	void UpdateVisibility() const;
 	bool MakeVoxelStack(int16 new_base, uint16 new_height);
 };
 
@@ -651,7 +885,13 @@ private:
 	uint16 x_size; ///< Current max x size (in voxels).
 	uint16 y_size; ///< Current max y size (in voxels).
 
-	VoxelStack stacks[WORLD_X_SIZE * WORLD_Y_SIZE]; ///< All voxel stacks in the world.
+	/**
+	 * All voxel stacks of the current world, row by row, sized #x_size by #y_size.
+	 * Storage is allocated for the actual world rather than the maximal limits, so small
+	 * parks do not pay for the #WORLD_X_SIZE / #WORLD_Y_SIZE head room. Columns without
+	 * contents hold no voxel payload (see VoxelStack::voxels), keeping empty terrain cheap.
+	 */
+	std::vector<VoxelStack> stacks;
 	std::set<std::pair<Point16, TileEdge>> edges_without_border_fence;  ///< Tile edges at which no border fence is desired.
 };
 
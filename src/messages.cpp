@@ -15,7 +15,7 @@
 
 /** Default constructor, for loading only. */
 Message::Message()
-: category(MSC_INFO), message(STR_NULL), data_type(MDT_NONE), data1(0), data2(0), data_for_plural(nullptr)
+: category(MSC_INFO), message(STR_NULL), data_type(MDT_NONE), data1(0), data2(0), data_for_plural(nullptr), repeat_count(1)
 {
 }
 
@@ -26,7 +26,7 @@ Message::Message()
  * @param d2 Extra data as required by #str.
  */
 Message::Message(StringID str, uint32 d1, uint32 d2)
-: timestamp(_date), message(str), data1(d1), data2(d2), data_for_plural(nullptr)
+: timestamp(_date), message(str), data1(d1), data2(d2), data_for_plural(nullptr), repeat_count(1)
 {
 	this->InitMessageDataTypes();
 }
@@ -46,6 +46,12 @@ void Message::InitMessageDataTypes()
 			this->data_type = MDT_PARK;
 			return;
 
+		case GUI_MESSAGE_SAVE_COMPLETE:
+			this->category = MSC_INFO;
+			this->data_type = MDT_NONE;
+			return;
+
+		case GUI_MESSAGE_SAVE_FAILED:
 		case GUI_MESSAGE_SCENARIO_LOST:
 		case GUI_MESSAGE_COMPLAIN_HUNGRY:
 		case GUI_MESSAGE_COMPLAIN_THIRSTY:
@@ -146,17 +152,18 @@ void Message::OnClick() const
 }
 
 static const uint32 CURRENT_VERSION_INBX = 1;     ///< Currently supported version of the INBX Pattern.
-static const uint32 CURRENT_VERSION_Message = 1;  ///< Currently supported version of the %Message Pattern.
+static const uint32 CURRENT_VERSION_Message = 2;  ///< Currently supported version of the %Message Pattern.
 
 void Message::Load(Loader &ldr)
 {
 	const uint32 version = ldr.OpenPattern("mssg");
-	if (version != CURRENT_VERSION_Message) ldr.VersionMismatch(version, CURRENT_VERSION_Message);
+	if (version < 1 || version > CURRENT_VERSION_Message) ldr.VersionMismatch(version, CURRENT_VERSION_Message);
 
 	this->message = GUI_INBOX_TITLE + ldr.GetWord();
 	this->data1 = ldr.GetLong();
 	this->data2 = ldr.GetLong();
 	this->timestamp = Date(CompressedDate(ldr.GetLong()));
+	this->repeat_count = (version >= 2) ? ldr.GetLong() : 1;
 	this->InitMessageDataTypes();
 	ldr.ClosePattern();
 }
@@ -168,6 +175,7 @@ void Message::Save(Saver &svr) const
 	svr.PutLong(this->data1);
 	svr.PutLong(this->data2);
 	svr.PutLong(this->timestamp.Compress());
+	svr.PutLong(this->repeat_count);
 	svr.EndPattern();
 }
 
@@ -181,14 +189,38 @@ void Inbox::Clear()
 
 /**
  * Add a message to the inbox and notify the player.
+ * A repeat of the newest message is coalesced into it by raising its repeat count
+ * instead of adding an entry, and the oldest messages are dropped when the inbox
+ * exceeds #MAX_INBOX_MESSAGES entries.
  * @param message Message to send.
  */
 void Inbox::SendMessage(Message *message)
 {
+	if (!this->messages.empty()) {
+		Message *last = this->messages.back().get();
+		if (last->message == message->message && last->data_type == message->data_type &&
+				last->data1 == message->data1 && last->data2 == message->data2) {
+			last->repeat_count++;
+			last->timestamp = message->timestamp;
+			delete message;
+			if (this->display_message == nullptr) {
+				this->display_time = 0;
+				this->display_message = last;
+				this->display_it = std::prev(this->messages.end());
+			}
+			return;
+		}
+	}
+
 	this->messages.push_back(std::unique_ptr<Message>(message));
 	if (this->display_message == nullptr) {
 		this->display_time = 0;
 		this->display_message = message;
+		this->display_it = std::prev(this->messages.end());
+	}
+	while (this->messages.size() > MAX_INBOX_MESSAGES) {
+		if (this->messages.front().get() == this->display_message) this->DismissDisplayMessage();
+		this->messages.pop_front();
 	}
 }
 
@@ -207,16 +239,9 @@ void Inbox::Tick(const uint32 time)
 void Inbox::DismissDisplayMessage()
 {
 	this->display_time = 0;
-	bool found = false, changed = false;
-	for (auto &msg : this->messages) {
-		if (found) {
-			display_message = msg.get();
-			changed = true;
-			break;
-		}
-		found = (msg.get() == display_message);
-	}
-	if (!changed) this->display_message = nullptr;
+	if (this->display_message == nullptr) return;
+	this->display_it++;
+	this->display_message = (this->display_it == this->messages.end()) ? nullptr : this->display_it->get();
 }
 
 /**
@@ -48,17 +48,20 @@ public:
 	void Load(Loader &ldr);
 	void Save(Saver &svr) const;
 
-	Date timestamp;             ///< The game time when this message was sent.
+	Date timestamp;             ///< The game time when this message was sent (last).
 	MessageCategory category;   ///< Type of this message.
 	StringID message;           ///< Message content.
 	MessageDataType data_type;  ///< Type of the extra data.
 	uint32 data1, data2;        ///< Extra data the message may refer to (the meaning depends on #data_type).
 	uint32 *data_for_plural;    ///< The data variable to use for message pluralization (may be \c nullptr).
+	uint32 repeat_count;        ///< Number of identical events coalesced into this message.
 
 private:
 	void InitMessageDataTypes();
 };
 
+static const uint MAX_INBOX_MESSAGES = 500;  ///< Cap on the number of retained inbox messages; the oldest messages are dropped beyond it.
+
 /** All the player's messages. */
 struct Inbox {
 	void Load(Loader &ldr);
@@ -72,9 +75,10 @@ struct Inbox {
 	void NotifyRideDeletion(uint16 ride);
 	void NotifyGuestDeletion(uint16 guest);
 
-	std::list<std::unique_ptr<Message>> messages;  ///< All messages belonging to the player.
-	Message *display_message;                      ///< Message to display in the bottom toolbar (may be \c nullptr).
-	uint32 display_time;                           ///< Number of milliseconds for which the #display_message (if any) has been shown.
+	std::list<std::unique_ptr<Message>> messages;            ///< All messages belonging to the player, oldest first. At most #MAX_INBOX_MESSAGES entries.
+	std::list<std::unique_ptr<Message>>::iterator display_it; ///< Iterator at the #display_message, to advance to the next message in O(1). Only valid while #display_message is set.
+	Message *display_message;                                ///< Message to display in the bottom toolbar (may be \c nullptr).
+	uint32 display_time;                                     ///< Number of milliseconds for which the #display_message (if any) has been shown.
 };
 extern Inbox _inbox;
 
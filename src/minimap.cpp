@@ -16,6 +16,7 @@
 #include "gamecontrol.h"
 #include "gui_sprites.h"
 #include "sprite_data.h"
+#include "density_map.h"
 
 /**
  * %Minimap window.
@@ -31,8 +32,21 @@ public:
 private:
 	void UpdateButtons();
 	Point32 GetRenderingBase(const Rectangle32 &widget_pos) const;
+	void UpdateTileCache() const;
+	void UpdateTile(int x, int y) const;
 
-	int zoom;   ///< Size of a voxel in pixels on the minimap.
+	int zoom;           ///< Size of a voxel in pixels on the minimap.
+	bool show_crowds;   ///< Overlay the crowd density field on the map.
+
+	/** Cached minimap appearance of one world tile. */
+	struct TileData {
+		uint8 colour;  ///< Colour range to draw the tile with (#ColourRange).
+		uint8 height;  ///< Height of the top ground voxel.
+		bool darken;   ///< The tile lies outside the park and is darkened.
+	};
+	mutable std::vector<TileData> tiles;           ///< Per-tile drawing data, indexed by x * world y-size + y. Updated from #_world_dirty.
+	mutable std::vector<uint32> height_counts;     ///< Number of tiles at each height, for scaling the colour range.
+	mutable std::vector<uint32> chunk_versions;    ///< Chunk versions of #_world_dirty that #tiles was last updated for.
 };
 
 static const int MIN_ZOOM =  1;  ///< Minimum size of a voxel in pixels on the minimap.
@@ -46,6 +60,7 @@ enum MinimapWidgets {
 	MM_MAIN,         ///< Main minimap view.
 	MM_ZOOM_IN,      ///< Zoom in button.
 	MM_ZOOM_OUT,     ///< Zoom out button.
+	MM_CROWDS,       ///< Toggle the crowd density overlay.
 	MM_SCROLL_HORZ,  ///< Horizontal scrollbar.
 	MM_SCROLL_VERT,  ///< Vertical scrollbar.
 };
@@ -67,10 +82,11 @@ static const WidgetPart _minimap_build_gui_parts[] = {
 					Widget(WT_HOR_SCROLLBAR, MM_SCROLL_HORZ, COL_RANGE_GREY),
 				Widget(WT_VERT_SCROLLBAR, MM_SCROLL_VERT, COL_RANGE_GREY),
 		Widget(WT_PANEL, INVALID_WIDGET_INDEX, COL_RANGE_GREY),
-			Intermediate(1, 3),
+			Intermediate(1, 4),
 				Widget(WT_TEXT_PUSHBUTTON, MM_ZOOM_OUT,          COL_RANGE_GREY), SetData(GUI_DECREASE_BUTTON, STR_NULL),
 				Widget(WT_IMAGE_BUTTON,    INVALID_WIDGET_INDEX, COL_RANGE_GREY), SetData(SPR_GUI_COMPASS_START + TC_NORTH, STR_NULL),
 				Widget(WT_TEXT_PUSHBUTTON, MM_ZOOM_IN,           COL_RANGE_GREY), SetData(GUI_INCREASE_BUTTON, STR_NULL),
+				Widget(WT_TEXT_BUTTON,     MM_CROWDS,            COL_RANGE_GREY), SetData(GUI_MINIMAP_CROWDS, STR_NULL),
 	EndContainer(),
 };
 
@@ -81,6 +97,7 @@ Minimap::Minimap() : GuiWindow(WC_MINIMAP, ALL_WINDOWS_OF_TYPE)
 	this->SetScrolledWidget(MM_MAIN, MM_SCROLL_VERT);
 
 	this->zoom = 4;
+	this->show_crowds = false;
 	this->UpdateButtons();
 }
 
@@ -119,6 +136,61 @@ Point32 Minimap::GetRenderingBase(const Rectangle32 &widget_pos) const
 	return base;
 }
 
+/**
+ * Recompute the cached appearance of a single tile.
+ * @param x X position of the tile.
+ * @param y Y position of the tile.
+ */
+void Minimap::UpdateTile(int x, int y) const
+{
+	const VoxelStack *vs = _world.GetStack(x, y);
+	const int h = vs->GetTopGroundOffset();
+
+	ColourRange col_range = _ground_type_colour[vs->voxels[h].GetGroundType()];
+	for (int i = vs->voxels.size() - 1; i >= h; i--) {
+		const Voxel *v = &vs->voxels[i];
+		if (v->GetInstance() == SRI_PATH && HasValidPath(v)) {
+			col_range = COL_RANGE_GREY;
+			break;
+		} else if (v->GetInstance() >= SRI_FULL_RIDES) {
+			switch (_rides_manager.GetRideInstance(v->GetInstance())->GetKind()) {
+				case RTK_SHOP:    col_range = COL_RANGE_SEA_GREEN;  break;
+				case RTK_GENTLE:  col_range = COL_RANGE_PINK_BROWN; break;
+				case RTK_THRILL:  col_range = COL_RANGE_ORANGE;     break;
+				case RTK_WET:     col_range = COL_RANGE_BLUE;       break;
+				case RTK_COASTER: col_range = COL_RANGE_PURPLE;     break;
+				default: NOT_REACHED();
+			}
+			break;
+		}
+	}
+
+	TileData &tile = this->tiles[x * _world.GetYSize() + y];
+	this->height_counts[tile.height]--;
+	tile.colour = col_range;
+	tile.height = h + vs->base;
+	tile.darken = vs->owner != OWN_PARK;
+	this->height_counts[tile.height]++;
+}
+
+/** Recompute the cached appearance of all tiles. */
+void Minimap::UpdateTileCache() const
+{
+	const uint total = _world.GetXSize() * _world.GetYSize();
+	this->tiles.assign(total, TileData{0, 0, false});
+	this->height_counts.assign(WORLD_Z_SIZE, 0);
+	this->height_counts[0] = total;  // All cached tiles start at height 0, #UpdateTile moves them to their real height.
+	for (int x = 0; x < _world.GetXSize(); x++) {
+		for (int y = 0; y < _world.GetYSize(); y++) this->UpdateTile(x, y);
+	}
+	this->chunk_versions.assign(_world_dirty.ChunksX() * _world_dirty.ChunksY(), 0);
+	for (uint16 cy = 0; cy < _world_dirty.ChunksY(); cy++) {
+		for (uint16 cx = 0; cx < _world_dirty.ChunksX(); cx++) {
+			this->chunk_versions[cx + cy * _world_dirty.ChunksX()] = _world_dirty.GetChunkVersion(cx, cy);
+		}
+	}
+}
+
 void Minimap::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const
 {
 	if (wid_num != MM_MAIN) return GuiWindow::DrawWidget(wid_num, wid);
@@ -134,15 +206,36 @@ void Minimap::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const
 	baseX += rb.x;
 	baseY += rb.y;
 
-	/* First pass: Find highest and lowest Z positions in the world, to adjust the colour ranges. */
+	/* Refresh the cached tiles of every chunk that changed since the last poll.
+	 * Polling the chunk versions rather than the per-frame column lists means the
+	 * cache also catches up on changes from frames where the minimap did not draw. */
+	if (this->tiles.size() != static_cast<uint>(_world.GetXSize()) * _world.GetYSize() ||
+			this->chunk_versions.size() != static_cast<uint>(_world_dirty.ChunksX()) * _world_dirty.ChunksY()) {
+		this->UpdateTileCache();
+	} else {
+		const uint cs = WorldDirtyTracker::CHUNK_SIZE;
+		for (uint16 cy = 0; cy < _world_dirty.ChunksY(); cy++) {
+			for (uint16 cx = 0; cx < _world_dirty.ChunksX(); cx++) {
+				const uint32 version = _world_dirty.GetChunkVersion(cx, cy);
+				if (this->chunk_versions[cx + cy * _world_dirty.ChunksX()] == version) continue;
+				this->chunk_versions[cx + cy * _world_dirty.ChunksX()] = version;
+
+				const int max_x = std::min<int>((cx + 1) * cs, _world.GetXSize());
+				const int max_y = std::min<int>((cy + 1) * cs, _world.GetYSize());
+				for (int x = cx * cs; x < max_x; x++) {
+					for (int y = cy * cs; y < max_y; y++) this->UpdateTile(x, y);
+				}
+			}
+		}
+	}
+
+	/* Find the highest and lowest Z positions in the world, to adjust the colour ranges. */
 	int minZ = WORLD_Z_SIZE;
 	int maxZ = 0;
-	for (int x = 0; x < _world.GetXSize(); x++) {
-		for (int y = 0; y < _world.GetYSize(); y++) {
-			const int h = _world.GetTopGroundHeight(x, y);
-			minZ = std::min(minZ, h);
-			maxZ = std::max(maxZ, h);
-		}
+	for (int h = 0; h < WORLD_Z_SIZE; h++) {
+		if (this->height_counts[h] == 0) continue;
+		minZ = std::min(minZ, h);
+		maxZ = std::max(maxZ, h);
 	}
 	int colour_base;
 	float colour_step;
@@ -154,36 +247,33 @@ void Minimap::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const
 		colour_base = 0;
 	}
 
-	/* Second pass: Draw the map. */
-	for (int x = 0; x < _world.GetXSize(); x++) {
-		for (int y = 0; y < _world.GetYSize(); y++) {
-			const VoxelStack *vs = _world.GetStack(x, y);
-			const int h = vs->GetTopGroundOffset();
-
-			ColourRange col_range = _ground_type_colour[vs->voxels[h]->GetGroundType()];
-			for (int i = vs->voxels.size() - 1; i >= h; i--) {
-				const Voxel *v = vs->voxels[i].get();
-				if (v->instance == SRI_PATH && HasValidPath(v)) {
-					col_range = COL_RANGE_GREY;
-					break;
-				} else if (v->instance >= SRI_FULL_RIDES) {
-					switch (_rides_manager.GetRideInstance(v->instance)->GetKind()) {
-						case RTK_SHOP:    col_range = COL_RANGE_SEA_GREEN;  break;
-						case RTK_GENTLE:  col_range = COL_RANGE_PINK_BROWN; break;
-						case RTK_THRILL:  col_range = COL_RANGE_ORANGE;     break;
-						case RTK_WET:     col_range = COL_RANGE_BLUE;       break;
-						case RTK_COASTER: col_range = COL_RANGE_PURPLE;     break;
-						default: NOT_REACHED();
-					}
-					break;
-				}
+	/* Scale the crowd overlay to the busiest cell, so the hot spots stay visible as the park grows. */
+	uint max_crowd = 0;
+	if (this->show_crowds) {
+		const int cell_size = 1 << DensityMap::CELL_SHIFT;
+		for (int x = 0; x < _world.GetXSize(); x += cell_size) {
+			for (int y = 0; y < _world.GetYSize(); y += cell_size) {
+				max_crowd = std::max(max_crowd, _density_map.GetCrowd(x, y));
 			}
+		}
+	}
 
+	/* Draw the map from the cached tile data, all tiles in a single draw call. */
+	std::vector<std::pair<Rectangle32, uint32>> rects;
+	rects.reserve(this->tiles.size());
+	for (int x = 0; x < _world.GetXSize(); x++) {
+		for (int y = 0; y < _world.GetYSize(); y++) {
+			const TileData &tile = this->tiles[x * _world.GetYSize() + y];
 			const Rectangle32 r(baseX + this->zoom * (y - x - 1), baseY + this->zoom * (y + x - 0.5f), 2 * this->zoom, this->zoom);
-			_video.FillRectangle(r, _palette[static_cast<int>(COL_SERIES_START + col_range * COL_SERIES_LENGTH + colour_base + colour_step * (h + vs->base - minZ))]);
-			if (vs->owner != OWN_PARK) _video.FillRectangle(r, _palette[OVERLAY_DARKEN]);
+			rects.emplace_back(r, _palette[static_cast<int>(COL_SERIES_START + tile.colour * COL_SERIES_LENGTH + colour_base + colour_step * (tile.height - minZ))]);
+			if (tile.darken) rects.emplace_back(r, _palette[OVERLAY_DARKEN]);
+			if (max_crowd > 0) {
+				const uint crowd = _density_map.GetCrowd(x, y);
+				if (crowd > 0) rects.emplace_back(r, MakeRGBA(255, 32, 0, 40 + 150 * crowd / max_crowd));
+			}
 		}
 	}
+	_video.FillRectangles(rects);
 
 	/* Finally, add the viewport overlay. */
 	{
@@ -215,6 +305,11 @@ void Minimap::OnClick(WidgetNumber number, const Point16 &clicked_pos)
 			}
 			break;
 
+		case MM_CROWDS:
+			this->show_crowds = !this->show_crowds;
+			this->GetWidget<LeafWidget>(MM_CROWDS)->SetPressed(this->show_crowds);
+			break;
+
 		case MM_MAIN: {
 			const Point32 base = this->GetRenderingBase(this->GetWidget<BaseWidget>(MM_MAIN)->pos);
 			const float voxelX = (clicked_pos.y - base.y + base.x - clicked_pos.x) / (2.0f * this->zoom) + 0.25f;
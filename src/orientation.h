@@ -27,8 +27,26 @@ enum ViewOrientation {
 	VOR_INVALID = 0xFF,   ///< Invalid orientation.
 };
 
-extern const int8 _orientation_signum_dx[VOR_NUM_ORIENT];
-extern const int8 _orientation_signum_dy[VOR_NUM_ORIENT];
+/**
+ * The direction factor (\c 1 or \c -1) by which the x world coordinate changes depending on the
+ * viewport orientation when stepping down a visual line that is orthogonal to the viewport.
+ */
+constexpr int8 _orientation_signum_dx[VOR_NUM_ORIENT] = {
+	+1, ///< VOR_NORTH
+	+1, ///< VOR_EAST
+	-1, ///< VOR_SOUTH
+	-1, ///< VOR_WEST
+};
+/**
+ * The direction factor (\c 1 or \c -1) by which the y world coordinate changes depending on the
+ * viewport orientation when stepping down a visual line that is orthogonal to the viewport.
+ */
+constexpr int8 _orientation_signum_dy[VOR_NUM_ORIENT] = {
+	+1, ///< VOR_NORTH
+	-1, ///< VOR_EAST
+	-1, ///< VOR_SOUTH
+	+1, ///< VOR_WEST
+};
 
 /**
  * Rotate view 90 degrees clockwise.
@@ -92,8 +110,51 @@ static inline bool IsBackEdge(ViewOrientation orient, TileEdge edge)
 	return (BACK & (1u << (orient + 4 * edge))) != 0;
 }
 
-XYZPoint16 OrientatedOffset(const uint8 orientation, const int x, const int y, const int z = 0);
-XYZPoint16 UnorientatedOffset(const uint8 orientation, const int x, const int y);
+/**
+ * Rotation coefficients applied by #OrientatedOffset per object orientation.
+ * Each entry holds <tt>{xx, xy, yx, yy}</tt>; the rotated offset of (x, y) is <tt>(xx * x + xy * y, yx * x + yy * y)</tt>.
+ */
+constexpr int8 _orientated_offset_coefficients[VOR_NUM_ORIENT][4] = {
+	{ 0, -1, +1,  0}, ///< VOR_NORTH
+	{+1,  0,  0, +1}, ///< VOR_EAST
+	{ 0, +1, -1,  0}, ///< VOR_SOUTH
+	{-1,  0,  0, -1}, ///< VOR_WEST
+};
+
+/** Rotation coefficients of the inverse transform, applied by #UnorientatedOffset. Layout as in #_orientated_offset_coefficients. */
+constexpr int8 _unorientated_offset_coefficients[VOR_NUM_ORIENT][4] = {
+	{ 0, +1, -1,  0}, ///< VOR_NORTH
+	{+1,  0,  0, +1}, ///< VOR_EAST
+	{ 0, -1, +1,  0}, ///< VOR_SOUTH
+	{-1,  0,  0, -1}, ///< VOR_WEST
+};
+
+/**
+ * Determine at which voxel in the world a piece of a multi-voxel object should be located.
+ * @param orientation Orientation of the object.
+ * @param x Unrotated x coordinate of the object piece, relative to the object's base voxel.
+ * @param y Unrotated y coordinate of the object piece, relative to the object's base voxel.
+ * @param z Z offset coordinate.
+ * @return Rotated location of the object piece, relative to the object's base voxel.
+ */
+static inline XYZPoint16 OrientatedOffset(const uint8 orientation, const int x, const int y, const int z = 0)
+{
+	const int8 *c = _orientated_offset_coefficients[orientation % VOR_NUM_ORIENT];
+	return XYZPoint16(c[0] * x + c[1] * y, c[2] * x + c[3] * y, z);
+}
+
+/**
+ * Determine at which voxel in the world a object piece should be located.
+ * @param orientation Orientation of the fixed object.
+ * @param x Rotated x coordinate of the object piece, relative to the object's base voxel.
+ * @param y Rotated y coordinate of the object piece, relative to the object's base voxel.
+ * @return Unrotated location of the object piece, relative to the object's base voxel.
+ */
+static inline XYZPoint16 UnorientatedOffset(const uint8 orientation, const int x, const int y)
+{
+	const int8 *c = _unorientated_offset_coefficients[orientation % VOR_NUM_ORIENT];
+	return XYZPoint16(c[0] * x + c[1] * y, c[2] * x + c[3] * y, 0);
+}
 
 /** Information about the graphics sizes at a zoom scale. */
 struct ZoomScale {
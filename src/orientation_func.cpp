@@ -9,63 +9,6 @@
 
 #include "orientation.h"
 
-/**
- * The direction factor (\c 1 or \c -1) by which the x world coordinate changes depending on the
- * viewport orientation when stepping down a visual line that is orthogonal to the viewport.
- */
-const int8 _orientation_signum_dx[VOR_NUM_ORIENT] = {
-	+1, ///< VOR_NORTH
-	+1, ///< VOR_EAST
-	-1, ///< VOR_SOUTH
-	-1, ///< VOR_WEST
-};
-/**
- * The direction factor (\c 1 or \c -1) by which the y world coordinate changes depending on the
- * viewport orientation when stepping down a visual line that is orthogonal to the viewport.
- */
-const int8 _orientation_signum_dy[VOR_NUM_ORIENT] = {
-	+1, ///< VOR_NORTH
-	-1, ///< VOR_EAST
-	-1, ///< VOR_SOUTH
-	+1, ///< VOR_WEST
-};
-
-/**
- * Determine at which voxel in the world a piece of a multi-voxel object should be located.
- * @param orientation Orientation of the object.
- * @param x Unrotated x coordinate of the object piece, relative to the object's base voxel.
- * @param y Unrotated y coordinate of the object piece, relative to the object's base voxel.
- * @param z Z offset coordinate.
- * @return Rotated location of the object piece, relative to the object's base voxel.
- */
-XYZPoint16 OrientatedOffset(const uint8 orientation, const int x, const int y, const int z)
-{
-	switch (orientation % VOR_NUM_ORIENT) {
-		case VOR_EAST: return XYZPoint16(x, y, z);
-		case VOR_WEST: return XYZPoint16(-x, -y, z);
-		case VOR_NORTH: return XYZPoint16(-y, x, z);
-		case VOR_SOUTH: return XYZPoint16(y, -x, z);
-	}
-	NOT_REACHED();
-}
-/**
- * Determine at which voxel in the world a object piece should be located.
- * @param orientation Orientation of the fixed object.
- * @param x Rotated x coordinate of the object piece, relative to the object's base voxel.
- * @param x Rotated y coordinate of the object piece, relative to the object's base voxel.
- * @return Unrotated location of the object piece, relative to the object's base voxel.
- */
-XYZPoint16 UnorientatedOffset(const uint8 orientation, const int x, const int y)
-{
-	switch (orientation % VOR_NUM_ORIENT) {
-		case VOR_EAST: return XYZPoint16(x, y, 0);
-		case VOR_WEST: return XYZPoint16(-x, -y, 0);
-		case VOR_SOUTH: return XYZPoint16(-y, x, 0);
-		case VOR_NORTH: return XYZPoint16(y, -x, 0);
-	}
-	NOT_REACHED();
-}
-
 /**
  * Get the zoom scale with a given tile width.
  * @param w Desired tile width.
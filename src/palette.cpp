@@ -108,6 +108,7 @@ Recolouring::Recolouring()
 Recolouring::Recolouring(const Recolouring &rc)
 {
 	std::copy(&rc.entries[0], endof(rc.entries), this->entries);
+	this->InvalidateColourMap();
 }
 
 /**
@@ -119,6 +120,7 @@ Recolouring &Recolouring::operator=(const Recolouring &rc)
 {
 	if (this != &rc) {
 		std::copy(&rc.entries[0], endof(rc.entries), this->entries);
+		this->InvalidateColourMap();
 	}
 	return *this;
 }
@@ -127,6 +129,7 @@ Recolouring &Recolouring::operator=(const Recolouring &rc)
 void Recolouring::Reset()
 {
 	for (int i = 0; i < MAX_RECOLOUR; i++) entries[i].source = COL_RANGE_INVALID;
+	this->InvalidateColourMap();
 }
 
 /**
@@ -166,6 +169,7 @@ void Recolouring::AssignRandomColours()
 			}
 		}
 	}
+	this->InvalidateColourMap();
 }
 
 static const uint32 CURRENT_VERSION_Recolouring = 1;   ///< Currently supported version of %Recolouring.
@@ -180,10 +184,12 @@ void Recolouring::Load(Loader &ldr)
 	if (version != CURRENT_VERSION_Recolouring) ldr.VersionMismatch(version, CURRENT_VERSION_Recolouring);
 
 	assert(MAX_RECOLOUR == 4); // Check that we are compatible with other saves.
+	uint8 vals[MAX_RECOLOUR];
+	ldr.GetBlob(vals, MAX_RECOLOUR);
 	for (int i = 0; i < MAX_RECOLOUR; i++) {
-		uint8 val = ldr.GetByte();
-		this->entries[i].AssignDest((ColourRange)val);
+		this->entries[i].AssignDest((ColourRange)vals[i]);
 	}
+	this->InvalidateColourMap();
 	ldr.ClosePattern();
 }
 
@@ -195,39 +201,44 @@ void Recolouring::Save(Saver &svr)
 {
 	svr.StartPattern("rcol", CURRENT_VERSION_Recolouring);
 	assert(MAX_RECOLOUR == 4); // Check that we are compatible with other saves.
+	uint8 vals[MAX_RECOLOUR];
 	for (int i = 0; i < MAX_RECOLOUR; i++) {
 		const RecolourEntry &entry = this->entries[i];
-		uint8 val = (entry.source == COL_RANGE_INVALID) ? COL_RANGE_INVALID : entry.dest;
-		svr.PutByte(val);
+		vals[i] = (entry.source == COL_RANGE_INVALID) ? COL_RANGE_INVALID : entry.dest;
 	}
+	svr.PutBlob(vals, MAX_RECOLOUR);
 	svr.EndPattern();
 }
 
 /**
  * Compute the palette of the #Recolouring object from the #entries and the gradient shift.
+ * The map of each shift is computed at most once until the entries change, so alternating
+ * between the weather shift of the world display and #GS_NORMAL of the gui is cheap.
  * @param shift Applied gradient shift.
  * @return 8bpp palette, including recolouring.
  */
 const uint8 *Recolouring::GetPalette(GradientShift shift) const
 {
-	if (this->shift == shift) return this->colour_map;
-	this->shift = shift;
+	assert(shift <= GS_WIREFRAME);
+	uint8 *colour_map = this->colour_maps[shift];
+	if (GB(this->valid_maps, shift, 1) != 0) return colour_map;
+	this->valid_maps |= 1 << shift;
 
-	for (int i = 0; i < COL_SERIES_START; i++) this->colour_map[i] = i;
+	for (int i = 0; i < COL_SERIES_START; i++) colour_map[i] = i;
 	if (shift == GS_SEMI_TRANSPARENT) {
-		for (int i = COL_SERIES_START; i < COL_SERIES_END; i++) this->colour_map[i] = COL_SEMI_TRANSPARENT;
+		for (int i = COL_SERIES_START; i < COL_SERIES_END; i++) colour_map[i] = COL_SEMI_TRANSPARENT;
 	} else {
 		if (shift == GS_WIREFRAME) shift = GS_NIGHT;
 		for (int rng = 0; rng < COL_RANGE_COUNT; rng++) {
 			int base = GetColourRangeBase((ColourRange)rng);
 			int baseval = GetColourRangeBase(this->GetReplacementRange((ColourRange)rng));
 			for (int col = 0; col < COL_SERIES_LENGTH; col++) {
-				this->colour_map[base + col] = baseval + Clamp(col + shift - GS_NORMAL, 0, COL_SERIES_LENGTH - 1);
+				colour_map[base + col] = baseval + Clamp(col + shift - GS_NORMAL, 0, COL_SERIES_LENGTH - 1);
 			}
 		}
 	}
-	for (int i = COL_SERIES_END; i < 256; i++) this->colour_map[i] = i;
-	return this->colour_map;
+	for (int i = COL_SERIES_END; i < 256; i++) colour_map[i] = i;
+	return colour_map;
 }
 
 /**
@@ -255,6 +266,48 @@ CondensedRecolouring Recolouring::ToCondensed() const
 	return r;
 }
 
+/**
+ * Get a 256-entry lookup table implementing the gradient shift function of \a shift.
+ * Tight per-pixel loops should prefer the table over calling the shift function
+ * through a pointer for every channel value.
+ * @param shift Desired amount of gradient shift.
+ * @return Lookup table mapping each input channel value to its shifted value.
+ */
+const uint8 *GetGradientShiftTable(GradientShift shift)
+{
+	static uint8 tables[GS_WIREFRAME + 1][256];
+	static bool initialized = false;
+	if (!initialized) {
+		for (int s = 0; s <= GS_WIREFRAME; ++s) {
+			ShiftFunc sf = GetGradientShiftFunc(static_cast<GradientShift>(s));
+			for (int col = 0; col < 256; ++col) tables[s][col] = sf(col);
+		}
+		initialized = true;
+	}
+	assert(shift <= GS_WIREFRAME);
+	return tables[shift];
+}
+
+/**
+ * Get a 256-entry lookup table implementing the opacity shift function of \a shift.
+ * @param shift Desired amount of gradient shift.
+ * @return Lookup table mapping each input opacity value to its shifted value.
+ */
+const uint8 *GetAlphaShiftTable(GradientShift shift)
+{
+	static uint8 tables[GS_WIREFRAME + 1][256];
+	static bool initialized = false;
+	if (!initialized) {
+		for (int s = 0; s <= GS_WIREFRAME; ++s) {
+			ShiftFunc af = GetAlphaShiftFunc(static_cast<GradientShift>(s));
+			for (int col = 0; col < 256; ++col) tables[s][col] = af(col);
+		}
+		initialized = true;
+	}
+	assert(shift <= GS_WIREFRAME);
+	return tables[shift];
+}
+
 /** 8 bpp colours mapped to 32 bpp. */
 const uint32 _palette[256] = {
  	MakeRGBA(  0,   0,   0, TRANSPARENT), //  0 COL_BACKGROUND (background behind world display)
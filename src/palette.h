@@ -13,7 +13,7 @@
 class Random;
 
 extern const uint32 _palette[256];  ///< The 8bpp FreeRCT palette.
-extern const uint32 * const _recolour_palettes[18]; ///< 32bpp recolour tables.
+extern const uint32 _recolour_palettes[18][256]; ///< 32bpp recolour tables, one contiguous row per colour range.
 
 static const int MAX_RECOLOUR = 4;  ///< Maximum number of recolourings that can be defined in a #Recolouring class.
 
@@ -25,7 +25,7 @@ static const int MAX_RECOLOUR = 4;  ///< Maximum number of recolourings that can
  * @param a Opacity of the pixel.
  * @return Pixel value of the given combination of colour components.
  */
-static inline uint32 MakeRGBA(uint8 r, uint8 g, uint8 b, uint8 a)
+static constexpr uint32 MakeRGBA(uint8 r, uint8 g, uint8 b, uint8 a)
 {
 	return (((uint32)r) << 24) | (((uint32)g) << 16) | (((uint32)b) << 8) | a;
 }
@@ -389,6 +389,9 @@ static inline ShiftFunc GetAlphaShiftFunc(GradientShift shift)
 	}
 }
 
+const uint8 *GetGradientShiftTable(GradientShift shift);
+const uint8 *GetAlphaShiftTable(GradientShift shift);
+
 /**
  * Get the index of the base colour of a colour range.
  * @param cr Colour range to use.
@@ -461,6 +464,18 @@ public:
 		return _recolour_palettes[re.dest];
 	}
 
+	/**
+	 * Whether this recolouring replaces any colour range at all.
+	 * @return Whether at least one entry replaces a range with a different one.
+	 */
+	bool HasReplacements() const
+	{
+		for (const RecolourEntry &e : this->entries) {
+			if (e.source < COL_RANGE_COUNT && e.dest < COL_RANGE_COUNT && e.source != e.dest) return true;
+		}
+		return false;
+	}
+
 	/**
 	 * Recolour entries, (one for each layer in 32bpp).
 	 * Don't assign directly, use #Set instead.
@@ -468,16 +483,16 @@ public:
 	RecolourEntry entries[MAX_RECOLOUR];
 
 private:
-	/** Invalidate the colour map used last time. */
+	/** Invalidate all computed colour maps. */
 	void InvalidateColourMap()
 	{
-		this->shift = GS_INVALID;
+		this->valid_maps = 0;
 	}
 
 	ColourRange GetReplacementRange(ColourRange src) const;
 
-	mutable uint8 colour_map[256]; ///< Colour map used last time.
-	mutable GradientShift shift;   ///< Gradient shift used last time, #GS_INVALID if the #colour_map is not valid.
+	mutable uint8 colour_maps[GS_WIREFRAME + 1][256]; ///< Colour maps computed so far, one for each gradient shift.
+	mutable uint16 valid_maps;                        ///< Bit set of gradient shifts with a valid entry in #colour_maps.
 };
 
 extern const Recolouring _no_recolour;
@@ -665,7 +665,8 @@ void ParkManagementGui::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid)
 	static const int LABEL_W = 2 * LABEL_H;
 	static const int SPACING = 2;
 
-	const int MAX_VALUE = (wid_num == PM_GUESTS_GRAPH) ? std::max(_game_observer.max_guests, 1u) : MAX_PARK_RATING;
+	const StatisticsSeries &history = (wid_num == PM_GUESTS_GRAPH) ? _game_observer.guest_count_history : _game_observer.park_rating_history;
+	const int MAX_VALUE = (wid_num == PM_GUESTS_GRAPH) ? std::max(history.Maximum(), 1) : MAX_PARK_RATING;
 	uint32 graph_colour = _palette[TEXT_WHITE];
 	const uint32 warning_colour = _palette[COL_RANGE_RED * COL_SERIES_LENGTH + COL_SERIES_START + COL_SERIES_LENGTH / 2];
 	Rectangle32 pos = wid->pos;
@@ -711,20 +712,17 @@ void ParkManagementGui::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid)
 	_str_params.SetDate(1, Date(_date.day, _date.month, _date.year - 1));
 	DrawString(STR_ARG1, TEXT_WHITE, pos.base.x                , pos.base.y + pos.height + SPACING, pos.width / 2, ALG_LEFT);
 
-	const auto &history = (wid_num == PM_GUESTS_GRAPH) ? _game_observer.guest_count_history : _game_observer.park_rating_history;
-	if (history.empty()) return;
+	if (history.Count() == 0) return;
 
-	auto it = history.begin();
 	const double STEP_X = static_cast<double>(pos.width) / STATISTICS_HISTORY;
 	const double STEP_Y = static_cast<double>(pos.height) / MAX_VALUE;
 	double x = pos.base.x + pos.width;
-	double y = pos.base.y + pos.height - (*it * STEP_Y);
+	double y = pos.base.y + pos.height - (history[0] * STEP_Y);
 
 	_video.FillRectangle(Rectangle32(x - SPACING, y - SPACING, 2 * SPACING, 2 * SPACING), graph_colour);
-	++it;
-	for (; it != history.end(); ++it) {
+	for (uint i = 1; i < history.Count(); i++) {
 		double nx = x - STEP_X;
-		double ny = pos.base.y + pos.height - (*it * STEP_Y);
+		double ny = pos.base.y + pos.height - (history[i] * STEP_Y);
 		_video.DrawLine(Point16(x, y), Point16(nx, ny), graph_colour);
 		x = nx;
 		y = ny;
@@ -9,11 +9,20 @@
 
 #include "stdafx.h"
 #include "path.h"
+#include "path_graph.h"
 #include "map.h"
+#include "person.h"
 #include "ride_type.h"
 #include "scenery.h"
 #include "viewport.h"
 
+/**
+ * Monotonic version number of the path network.
+ * Bumped whenever the path layout or the park ownership changes; caches of route answers
+ * remember the version they were computed at and drop their contents when it moved on.
+ */
+uint32 _path_network_version = 0;
+
 /** Imploded path tile sprite number to use for an 'up' slope from a given edge. */
 const PathSprites _path_up_from_edge[EDGE_COUNT] = {
 	PATH_RAMP_NE, ///< EDGE_NE
@@ -250,6 +259,45 @@ uint8 GetPathExits(const Voxel *v)
 	return GetPathExits(GetImplodedPathSlope(inst_data), true);
 }
 
+/**
+ * Try to walk from a path voxel over the given edge to a neighbouring path voxel.
+ * @param from Position of the path voxel being left.
+ * @param exits Path exits of the voxel being left (see #GetPathExits).
+ * @param edge Edge to leave the voxel by.
+ * @param dest [out] Position of the path voxel arrived at, only valid when \c true is returned.
+ * @return Whether a walkable path connection exists over the edge.
+ */
+bool TraversePathEdge(const XYZPoint16 &from, uint8 exits, TileEdge edge, XYZPoint16 *dest)
+{
+	if ((exits & (0x11 << edge)) == 0) return false;
+
+	/* There is an outgoing connection, is it also on the world? */
+	Point16 dxy = _tile_dxy[edge];
+	if (dxy.x < 0 && from.x == 0) return false;
+	if (dxy.x > 0 && from.x + 1 == _world.GetXSize()) return false;
+	if (dxy.y < 0 && from.y == 0) return false;
+	if (dxy.y > 0 && from.y + 1 == _world.GetYSize()) return false;
+
+	int extra_z = ((exits & (0x10 << edge)) != 0);
+	if (from.z + extra_z < 0 || from.z + extra_z >= WORLD_Z_SIZE) return false;
+
+	/* Now check the other side, extra_z is the voxel where the path should be at the bottom. */
+	const Voxel *v2 = _world.GetVoxel(from + XYZPoint16(dxy.x, dxy.y, extra_z));
+	if (v2 == nullptr) return false;
+
+	uint8 other_exits = GetPathExits(v2);
+	if ((other_exits & (1 << ((edge + 2) % 4))) == 0) { // No path here, try one voxel below.
+		extra_z--;
+		if (from.z + extra_z < 0) return false;
+		v2 = _world.GetVoxel(from + XYZPoint16(dxy.x, dxy.y, extra_z));
+		if (v2 == nullptr) return false;
+		other_exits = GetPathExits(v2);
+		if ((other_exits & (0x10 << ((edge + 2) % 4))) == 0) return false;
+	}
+	*dest = from + XYZPoint16(dxy.x, dxy.y, extra_z);
+	return true;
+}
+
 /**
  * Walk over a queue path from the given entry edge at the given position.
  * If it leads to a new voxel edge, the provided position and edge is update with the exit point.
@@ -316,6 +364,39 @@ bool TravelQueuePath(XYZPoint16 *voxel_pos, TileEdge *entry)
 	}
 }
 
+/**
+ * Precomputed mapping of every combination of expanded path bits to the matching path sprite.
+ * The corner bits of the index are ignored and recomputed from the edge bits, so the table gives
+ * the correct sprite for any bit pattern, including stale corner decorations.
+ */
+class PathSpriteTable {
+public:
+	PathSpriteTable();
+
+	uint8 sprite[256]; ///< Imploded path sprite for each expanded bit pattern.
+};
+
+/** Build the table once at startup, by completing the corner bits of every edge combination. */
+PathSpriteTable::PathSpriteTable()
+{
+	const uint8 north_edges = (1 << PATHBIT_NE) | (1 << PATHBIT_NW);
+	const uint8 south_edges = (1 << PATHBIT_SE) | (1 << PATHBIT_SW);
+	const uint8 east_edges  = (1 << PATHBIT_NE) | (1 << PATHBIT_SE);
+	const uint8 west_edges  = (1 << PATHBIT_NW) | (1 << PATHBIT_SW);
+
+	for (uint bits = 0; bits < lengthof(this->sprite); bits++) {
+		uint8 slope = bits & PATHMASK_EDGES;
+		if ((slope & north_edges) == north_edges) slope |= 1 << PATHBIT_N;
+		if ((slope & south_edges) == south_edges) slope |= 1 << PATHBIT_S;
+		if ((slope & east_edges)  == east_edges)  slope |= 1 << PATHBIT_E;
+		if ((slope & west_edges)  == west_edges)  slope |= 1 << PATHBIT_W;
+		this->sprite[bits] = _path_implode[slope];
+		assert(this->sprite[bits] != PATH_INVALID);
+	}
+}
+
+static const PathSpriteTable _path_sprite_table; ///< Expanded path bits to sprite mapping.
+
 /**
  * Set the edge of a path sprite. Also updates the corner pieces of the flat path tiles.
  * @param slope Current path slope (imploded).
@@ -325,11 +406,6 @@ bool TravelQueuePath(XYZPoint16 *voxel_pos, TileEdge *entry)
  */
 uint8 SetPathEdge(uint8 slope, TileEdge edge, bool connect)
 {
-	const uint8 north_edges = (1 << PATHBIT_NE) | (1 << PATHBIT_NW);
-	const uint8 south_edges = (1 << PATHBIT_SE) | (1 << PATHBIT_SW);
-	const uint8 east_edges  = (1 << PATHBIT_NE) | (1 << PATHBIT_SE);
-	const uint8 west_edges  = (1 << PATHBIT_NW) | (1 << PATHBIT_SW);
-
 	if (slope >= PATH_FLAT_COUNT) return slope; // Ramps do not have edge to connect.
 
 	slope = _path_expand[slope];
@@ -346,13 +422,7 @@ uint8 SetPathEdge(uint8 slope, TileEdge edge, bool connect)
 	} else {
 		slope &= ~bit_value;
 	}
-
-	slope &= ~((1 << PATHBIT_N) | (1 << PATHBIT_E) | (1 << PATHBIT_S) | (1 << PATHBIT_W));
-	if ((slope & north_edges) == north_edges) slope |= 1 << PATHBIT_N;
-	if ((slope & south_edges) == south_edges) slope |= 1 << PATHBIT_S;
-	if ((slope & east_edges)  == east_edges)  slope |= 1 << PATHBIT_E;
-	if ((slope & west_edges)  == west_edges)  slope |= 1 << PATHBIT_W;
-	return _path_implode[slope];
+	return _path_sprite_table.sprite[slope];
 }
 
 /**
@@ -441,6 +511,11 @@ static bool ExamineNeighbourPathEdge(const XYZPoint16 &voxel_pos, TileEdge edge,
  */
 uint8 AddRemovePathEdges(const XYZPoint16 &voxel_pos, uint8 slope, uint8 dirs, PathStatus status)
 {
+	InvalidateExitDesireCache();   // Path layout changes, guests must reexamine the edges.
+	_path_graph.Invalidate();      // The junction graph mirrors the path connectivity.
+	_exit_flow_field.Invalidate(); // So does the flow field towards the park exit.
+	_path_network_version++;       // Version-checked route caches drop their answers.
+
 	PathStatus ngb_status[4];    // Neighbour path status, #PAS_UNUSED means do not connect.
 	Voxel *ngb_voxel[4];         // Neighbour voxels with path, may be null if it doesn't need changing.
 	uint16 ngb_instance_data[4]; // New instance data, if the voxel exists.
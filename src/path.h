@@ -129,6 +129,8 @@ struct Voxel;
 uint8 GetPathExits(PathSprites slope, bool use_path_connections);
 uint8 GetPathExits(const Voxel *v);
 
+bool TraversePathEdge(const XYZPoint16 &from, uint8 exits, TileEdge edge, XYZPoint16 *dest);
+
 bool TravelQueuePath(XYZPoint16 *voxel_pos, TileEdge *entry);
 
 bool PathExistsAtBottomEdge(XYZPoint16 voxel_pos, TileEdge edge);
@@ -136,4 +138,6 @@ bool PathExistsAtBottomEdge(XYZPoint16 voxel_pos, TileEdge edge);
 uint8 SetPathEdge(uint8 slope, TileEdge edge, bool connect);
 uint8 AddRemovePathEdges(const XYZPoint16 &voxel_pos, uint8 slope, uint8 dirs, PathStatus status);
 
+extern uint32 _path_network_version;
+
 #endif
@@ -9,62 +9,51 @@
 
 #include "stdafx.h"
 #include "path_finding.h"
+#include "path.h"
 #include "map.h"
 
+static const int INITIAL_TABLE_LOG_SIZE = 8;  ///< 2-log of the initial hash table size of a path searcher.
+static const uint32 NO_MEETING = std::numeric_limits<uint32>::max();  ///< #PathSearcher::best_meeting value when the frontiers have not met.
+
 /**
  * Constructor of a walked position.
  * @param cur_vox Current voxel position.
  * @param traveled Length of travel from the starting point so far.
  * @param estimate Estimated length of remaining travel to the destination (should be less or equal to the real value for optimal solutions).
  * @param prev_pos Previous walked position used to get at the new position, \c nullptr for the first position.
+ * @param side Frontier that reached the position.
  */
-WalkedPosition::WalkedPosition(const XYZPoint16 &cur_vox, uint32 traveled, uint32 estimate, const WalkedPosition *prev_pos)
-		: cur_vox(cur_vox), traveled(traveled), estimate(estimate), prev_pos(prev_pos)
-{
-}
-
-/**
-* Compare two walked positions, and order on position.
-* @param wp1 First position to compare.
-* @param wp2 Second position to compare.
-* @return Whether \a wp1 should come before \a wp2.
-*/
-bool operator<(const WalkedPosition &wp1, const WalkedPosition &wp2)
+WalkedPosition::WalkedPosition(const XYZPoint16 &cur_vox, uint32 traveled, uint32 estimate, const WalkedPosition *prev_pos, uint8 side)
+		: cur_vox(cur_vox), traveled(traveled), estimate(estimate), prev_pos(prev_pos), side(side)
 {
-	return wp1.cur_vox < wp2.cur_vox;
 }
 
 /**
- * Walked distance constructor.
- * @param traveled Length of travel from the starting point to \a pos.
- * @param estimate Estimated length of remaining travel from \a pos to the destination.
- * @param pos Current position.
+ * Constructor, find a path to (\a dest_x, \a dest_y, \a dest_z). Give starting points through PathSearcher::AddStart.
+ * @param init_dest_vox Coordinate of the destination voxel.
  */
-WalkedDistance::WalkedDistance(uint32 traveled, uint32 estimate, const WalkedPosition *pos) : traveled(traveled), estimate(estimate), pos(pos)
+PathSearcher::PathSearcher(const XYZPoint16 &init_dest_vox)
+: dest_vox(init_dest_vox), dest_pos(nullptr), position_count(0), table_log_size(INITIAL_TABLE_LOG_SIZE),
+		first_bucket{0, 0}, open_count{0, 0}, best_meeting(NO_MEETING), meet_pos{nullptr, nullptr}
 {
+	this->position_table.resize(1 << this->table_log_size, -1);
 }
 
 /**
- * Compare two walked distances, and order on minimal total distance.
- * @param wd1 First distance to compare.
- * @param wd2 Second distance to compare.
- * @return Whether \a wd1 should come before \a wd2.
+ * The shared path searcher.
+ * Searches always run to completion on the main thread and never nest, so one instance
+ * serves all callers, keeping its arena and table memory allocated between searches.
  */
-bool operator<(const WalkedDistance &wd1, const WalkedDistance &wd2)
-{
-	uint32 total1 = wd1.traveled + wd1.estimate;
-	uint32 total2 = wd2.traveled + wd2.estimate;
-	if (total1 != total2) return total1 < total2;
-	return wd1.traveled < wd2.traveled;
-}
+PathSearcher _path_searcher(XYZPoint16(-1, -1, -1));
 
 /**
- * Constructor, find a path to (\a dest_x, \a dest_y, \a dest_z). Give starting points through PathSearcher::AddStart.
- * @param init_dest_vox Coordinate of the destination voxel.
+ * Make the searcher ready for a new search, keeping the allocated memory of previous searches.
+ * @param dest_vox Coordinate of the destination voxel.
  */
-PathSearcher::PathSearcher(const XYZPoint16 &init_dest_vox)
-: dest_vox(init_dest_vox), dest_pos(nullptr)
+void PathSearcher::Reset(const XYZPoint16 &dest_vox)
 {
+	this->dest_vox = dest_vox;
+	this->Clear();
 }
 
 /**
@@ -73,66 +62,184 @@ PathSearcher::PathSearcher(const XYZPoint16 &init_dest_vox)
  */
 void PathSearcher::AddStart(const XYZPoint16 &start_vox)
 {
-	this->AddOpen(start_vox, 0, nullptr);
+	this->AddOpen(start_vox, 0, 0, nullptr);
 }
 
 /**
- * Get an (optimistic) estimate of the path length to go to the destination voxel.
+ * Get an (optimistic) estimate of the path length still to go for a frontier.
  * @param vox Current position in voxels.
+ * @param side Frontier the position belongs to.
  * @return Estimate of the length of path still to go.
  */
-inline uint32 PathSearcher::GetEstimate(const XYZPoint16 &vox)
+inline uint32 PathSearcher::GetEstimate(const XYZPoint16 &vox, uint8 side)
 {
+	if (side != 0) return 0;  // The backward frontier aims for any of the starts; search it uniformly.
+
 	int32 val = abs(vox.x - this->dest_vox.x) + abs(vox.y - this->dest_vox.y);
 	if (val < abs(vox.z - this->dest_vox.z)) return abs(vox.z - this->dest_vox.z);
 	return val;
 }
 
+/** Double the hash table, and re-insert all examined positions. */
+void PathSearcher::GrowPositionTable()
+{
+	this->table_log_size++;
+	this->position_table.assign(1 << this->table_log_size, -1);
+	for (uint i = 0; i < this->position_count; i++) {
+		const WalkedPosition &wp = this->PositionAt(i);
+		uint32 slot = this->SlotOf(SideKey(wp.cur_vox, wp.side));
+		while (this->position_table[slot] >= 0) slot = (slot + 1) & ((1 << this->table_log_size) - 1);
+		this->position_table[slot] = i;
+	}
+}
+
+/**
+ * Take a fresh walked position from the arena, growing it by a chunk when full.
+ * @return Uninitialized walked position with a stable address.
+ */
+WalkedPosition *PathSearcher::NewPosition()
+{
+	if (this->position_count == this->position_chunks.size() * POSITION_CHUNK_SIZE) {
+		this->position_chunks.emplace_back(new WalkedPosition[POSITION_CHUNK_SIZE]);
+	}
+	return &this->PositionAt(this->position_count++);
+}
+
 /**
- * Add a new open position to the set of open points, if it is better than already available.
+ * Find the walked position of a voxel, creating it if not examined before.
+ * @param vox Coordinate of the voxel.
+ * @param side Frontier the position belongs to.
+ * @param traveled Distance traveled to get to the position, used for initializing a new position.
+ * @param estimate Estimated remaining distance, used for initializing a new position.
+ * @param is_new [out] Whether the position was examined for the first time.
+ * @return The walked position of the voxel.
+ */
+WalkedPosition *PathSearcher::GetPosition(const XYZPoint16 &vox, uint8 side, uint32 traveled, uint32 estimate, bool *is_new)
+{
+	if (this->position_count * 4 >= this->position_table.size() * 3) this->GrowPositionTable();
+
+	const uint32 mask = (1 << this->table_log_size) - 1;
+	uint32 slot = this->SlotOf(SideKey(vox, side));
+	while (this->position_table[slot] >= 0) {
+		WalkedPosition &wp = this->PositionAt(this->position_table[slot]);
+		if (wp.cur_vox == vox && wp.side == side) {
+			*is_new = false;
+			return &wp;
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	this->position_table[slot] = this->position_count;
+	WalkedPosition *wp = this->NewPosition();
+	*wp = WalkedPosition(vox, traveled, estimate, nullptr, side);
+	*is_new = true;
+	return wp;
+}
+
+/**
+ * Find the walked position of a voxel without creating it.
+ * @param vox Coordinate of the voxel.
+ * @param side Frontier the position belongs to.
+ * @return The walked position, \c nullptr if the frontier never examined the voxel.
+ */
+WalkedPosition *PathSearcher::FindPosition(const XYZPoint16 &vox, uint8 side)
+{
+	const uint32 mask = (1 << this->table_log_size) - 1;
+	uint32 slot = this->SlotOf(SideKey(vox, side));
+	while (this->position_table[slot] >= 0) {
+		WalkedPosition &wp = this->PositionAt(this->position_table[slot]);
+		if (wp.cur_vox == vox && wp.side == side) return &wp;
+		slot = (slot + 1) & mask;
+	}
+	return nullptr;
+}
+
+/**
+ * Add a new open position to a frontier, if it is better than already available.
  * @param vox Position of the current position.
+ * @param side Frontier the position belongs to.
  * @param traveled Distance traveled to get to the current position.
  * @param prev_pos Previous position (\c nullptr for the start position).
  */
-void PathSearcher::AddOpen(const XYZPoint16 &vox, uint32 traveled, const WalkedPosition *prev_pos)
+void PathSearcher::AddOpen(const XYZPoint16 &vox, uint8 side, uint32 traveled, const WalkedPosition *prev_pos)
 {
-	uint32 estimate = this->GetEstimate(vox);
-	WalkedPosition wp(vox, traveled, estimate, prev_pos);
-
-	/* Find the position. */
-	PositionSet::iterator pos_iter = this->positions.find(wp);
-	if (pos_iter == positions.end()) { // New position.
-		pos_iter = this->positions.insert(wp).first;
-		this->open_points.emplace(traveled, estimate, &(*pos_iter));
-		return;
+	uint32 estimate = this->GetEstimate(vox, side);
+
+	bool is_new;
+	WalkedPosition *wp = this->GetPosition(vox, side, traveled, estimate, &is_new);
+	if (!is_new) {
+		/* Existing position, update if needed. */
+		if (wp->traveled + wp->estimate <= traveled + estimate) return;
+
+		/* New one is better, update. The sum is changed, making any old open points invalid. */
+		wp->traveled = traveled;
+		wp->estimate = estimate;
+	}
+	wp->prev_pos = prev_pos;
+
+	/* Did the other frontier already reach this voxel? (Never happens in single frontier mode.) */
+	WalkedPosition *other = this->FindPosition(vox, side ^ 1);
+	if (other != nullptr && traveled + other->traveled < this->best_meeting) {
+		this->best_meeting = traveled + other->traveled;
+		this->meet_pos[side] = wp;
+		this->meet_pos[side ^ 1] = other;
 	}
-	/* Existing position, update if needed. */
-	const WalkedPosition *pwp = &(*pos_iter);
-	if (pwp->traveled + pwp->estimate <= traveled + estimate) return;
-
-	/* New one is better, update. */
-	pwp->traveled = traveled;
-	pwp->estimate = estimate; // The sum is changed, making any old open points invalid.
-	pwp->prev_pos = prev_pos;
-	this->open_points.emplace(traveled, estimate, pwp);
+
+	const uint32 total = traveled + estimate;
+	std::vector<std::vector<OpenPoint>> &buckets = this->open_buckets[side];
+	if (total >= buckets.size()) buckets.resize(total + 1);
+	buckets[total].push_back(OpenPoint{traveled, estimate, wp});
+	this->open_count[side]++;
+	if (total < this->first_bucket[side]) this->first_bucket[side] = total;
+}
+
+/**
+ * Get the lowest total path length guess among the open points of a frontier.
+ * @param side Frontier to examine.
+ * @return The lowest bucket holding an open point, #NO_MEETING if the frontier is exhausted.
+ */
+uint32 PathSearcher::TopBucket(uint8 side)
+{
+	if (this->open_count[side] == 0) return NO_MEETING;
+	while (this->open_buckets[side][this->first_bucket[side]].empty()) this->first_bucket[side]++;
+	return this->first_bucket[side];
 }
 
 /**
  * Search for a path to the destination.
+ * @param bidirectional Also expand a frontier backward from the destination, and stitch both
+ *        frontiers together where they meet. Worthwhile for long routes, where a single
+ *        frontier explores roughly with the square of the distance.
  * @return Whether a path has been found.
  */
-bool PathSearcher::Search()
+bool PathSearcher::Search(bool bidirectional)
 {
 	this->dest_pos = nullptr;
-	while (!this->open_points.empty()) {
-		WalkedDistance wd = *this->open_points.begin();
-		this->open_points.erase(this->open_points.begin());
+	this->best_meeting = NO_MEETING;
+	this->meet_pos[0] = nullptr;
+	this->meet_pos[1] = nullptr;
+	if (bidirectional) this->AddOpen(this->dest_vox, 1, 0, nullptr);
+
+	for (;;) {
+		const uint32 top0 = this->TopBucket(0);
+		const uint32 top1 = bidirectional ? this->TopBucket(1) : NO_MEETING;
+		if (top0 == NO_MEETING && top1 == NO_MEETING) break; // Both frontiers exhausted.
 
-		if (wd.traveled != wd.pos->traveled || wd.estimate != wd.pos->estimate) continue; // Invalid open point.
+		/* Any meeting found from here on routes through an open point of one of the frontiers,
+		 * so it cannot be shorter than the lower of the two frontier guesses. */
+		if (this->best_meeting != NO_MEETING && std::min(top0, top1) >= this->best_meeting) break;
 
-		/* Reached the destination? */
-		const WalkedPosition *wp = wd.pos;
-		if (wp->cur_vox == this->dest_vox) {
+		const uint8 side = (top1 < top0) ? 1 : 0;
+		std::vector<OpenPoint> &bucket = this->open_buckets[side][this->first_bucket[side]];
+		OpenPoint op = bucket.back();
+		bucket.pop_back();
+		this->open_count[side]--;
+
+		if (op.traveled != op.pos->traveled || op.estimate != op.pos->estimate) continue; // Invalid open point.
+
+		/* Reached the destination? (In bidirectional mode the meeting bookkeeping covers this.) */
+		const WalkedPosition *wp = op.pos;
+		if (!bidirectional && wp->cur_vox == this->dest_vox) {
 			this->dest_pos = wp;
 			return true;
 		}
@@ -143,43 +250,42 @@ bool PathSearcher::Search()
 
 		uint8 exits = GetPathExits(v);
 		for (TileEdge edge = EDGE_BEGIN; edge < EDGE_COUNT; edge++) {
-			if ((exits & (0x11 << edge)) == 0) continue;
-
-			/* There is an outgoing connection, is it also on the world? */
-			Point16 dxy = _tile_dxy[edge];
-			if (dxy.x < 0 && wp->cur_vox.x == 0) continue;
-			if (dxy.x > 0 && wp->cur_vox.x + 1 == _world.GetXSize()) continue;
-			if (dxy.y < 0 && wp->cur_vox.y == 0) continue;
-			if (dxy.y > 0 && wp->cur_vox.y + 1 == _world.GetYSize()) continue;
-
-			int extra_z = ((exits & (0x10 << edge)) != 0);
-			if (wp->cur_vox.z + extra_z < 0 || wp->cur_vox.z + extra_z >= WORLD_Z_SIZE) continue;
-
-			/* Now check the other side, new_z is the voxel where the path should be at the bottom. */
-			const Voxel *v2 = _world.GetVoxel(wp->cur_vox + XYZPoint16(dxy.x, dxy.y, extra_z));
-			if (v2 == nullptr) continue;
-
-			uint8 other_exits = GetPathExits(v2);
-			if ((other_exits & (1 << ((edge + 2) % 4))) == 0) { // No path here, try one voxel below
-				extra_z--;
-				if (wp->cur_vox.z + extra_z < 0) continue;
-				v2 = _world.GetVoxel(wp->cur_vox + XYZPoint16(dxy.x, dxy.y, extra_z));
-				if (v2 == nullptr) continue;
-				other_exits = GetPathExits(v2);
-				if ((other_exits & (0x10 << ((edge + 2) % 4))) == 0) continue;
-			}
+			XYZPoint16 next;
+			if (!TraversePathEdge(wp->cur_vox, exits, edge, &next)) continue;
+
 			/* Add new open point to the path finder. */
-			this->AddOpen(wp->cur_vox + XYZPoint16(dxy.x, dxy.y, extra_z), wp->traveled + 1, wp);
+			this->AddOpen(next, side, wp->traveled + 1, wp);
 		}
 	}
-	return false;
+	if (this->best_meeting == NO_MEETING) return false;
+
+	/* Stitch the frontiers together at the meeting voxel. The backward chain runs from the
+	 * meeting towards the destination; reversing its links and hooking it onto the forward
+	 * chain yields one walk from the destination down to a start, as in single frontier mode. */
+	const WalkedPosition *prev = this->meet_pos[0]->prev_pos;
+	WalkedPosition *cur = this->meet_pos[1];
+	while (cur != nullptr) {
+		WalkedPosition *next = const_cast<WalkedPosition *>(cur->prev_pos); // Our own arena entry.
+		cur->prev_pos = prev;
+		prev = cur;
+		cur = next;
+	}
+	this->dest_pos = prev;
+	return true;
 }
 
-/** Clear the used data structures of the path searcher. */
+/** Clear the used data structures of the path searcher, keeping the allocated memory for reuse. */
 void PathSearcher::Clear()
 {
-	this->open_points.clear();
-	this->positions.clear();
+	this->position_count = 0;  // The arena chunks stay allocated for the next search.
+	std::fill(this->position_table.begin(), this->position_table.end(), -1);
+	for (uint8 side = 0; side < 2; side++) {
+		for (std::vector<OpenPoint> &bucket : this->open_buckets[side]) bucket.clear();
+		this->first_bucket[side] = 0;
+		this->open_count[side] = 0;
+	}
+	this->best_meeting = NO_MEETING;
+	this->meet_pos[0] = nullptr;
+	this->meet_pos[1] = nullptr;
 	this->dest_pos = nullptr;
 }
-
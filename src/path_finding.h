@@ -10,53 +10,109 @@
 #ifndef PATH_FINDING_H
 #define PATH_FINDING_H
 
-#include <set>
+#include <memory>
+#include <vector>
 
 #include "geometry.h"
 
 /** Intermediate position of a walk. */
 class WalkedPosition {
 public:
-	WalkedPosition(const XYZPoint16 &cur_vox, uint32 traveled, uint32 estimate, const WalkedPosition *prev_pos);
+	WalkedPosition() = default;
+	WalkedPosition(const XYZPoint16 &cur_vox, uint32 traveled, uint32 estimate, const WalkedPosition *prev_pos, uint8 side);
 
 	XYZPoint16 cur_vox; ///< Coordinate of the current position.
-	mutable uint32 traveled; ///< Length of the traveled path so far.
-	mutable uint32 estimate; ///< Estimated distance to the destination.
-	mutable const WalkedPosition *prev_pos; ///< Position coming from (\c nullptr for initial position).
-};
-
-/** Guessed path length at a (partially) explored position. */
-class WalkedDistance {
-public:
-	WalkedDistance(uint32 traveled, uint32 estimate, const WalkedPosition *pos);
-
 	uint32 traveled; ///< Length of the traveled path so far.
 	uint32 estimate; ///< Estimated distance to the destination.
-	const WalkedPosition *pos; ///< Current position.
+	const WalkedPosition *prev_pos; ///< Position coming from (\c nullptr for initial position).
+	uint8 side; ///< Frontier that reached the position, \c 0 from the starts, \c 1 from the destination.
 };
 
-typedef std::set<WalkedPosition> PositionSet;	  ///< Visited positions (best solution so far).
-typedef std::multiset<WalkedDistance> OpenPoints; ///< Points for further exploration.
-
 /** Class for searching (and hopefully finding) a path between tiles. */
 class PathSearcher {
 public:
 	PathSearcher(const XYZPoint16 &dest_vox);
 
+	void Reset(const XYZPoint16 &dest_vox);
 	void AddStart(const XYZPoint16 &start_vox);
-	bool Search();
+	bool Search(bool bidirectional = false);
 	void Clear();
 
 	XYZPoint16 dest_vox; ///< Coordinate of the desired destination voxel.
 	const WalkedPosition *dest_pos; ///< If path was found, this points to the end-point of the walk.
 
 protected:
-	PositionSet positions;   ///< Examined positions.
-	OpenPoints  open_points; ///< Open points to examine further.
-
-	inline uint32 GetEstimate(const XYZPoint16 &vox);
-	void AddOpen(const XYZPoint16 &vox, uint32 traveled, const WalkedPosition *prev_pos);
+	/** Entry of an #open_buckets bucket, denoting a position to explore further. */
+	struct OpenPoint {
+		uint32 traveled; ///< Length of the traveled path so far, stale if it does not match the position.
+		uint32 estimate; ///< Estimated distance to the destination, stale if it does not match the position.
+		WalkedPosition *pos; ///< Position to explore.
+	};
+
+	static const size_t POSITION_CHUNK_SIZE = 256; ///< Number of walked positions per arena chunk.
+
+	std::vector<std::unique_ptr<WalkedPosition[]>> position_chunks; ///< Arena of examined positions; chunks keep their addresses stable and are reused between searches.
+	size_t position_count;                ///< Number of walked positions in use in #position_chunks.
+	std::vector<int32> position_table;    ///< Open-addressing hash table with indices into the arena, \c -1 for empty slots.
+	int table_log_size;                   ///< 2-log of the size of #position_table.
+
+	std::vector<std::vector<OpenPoint>> open_buckets[2]; ///< Open points of both frontiers, bucketed by total path length guess.
+	uint32 first_bucket[2]; ///< Lowest bucket in #open_buckets of each frontier that may be non-empty.
+	size_t open_count[2];   ///< Total number of open points in #open_buckets of each frontier.
+
+	uint32 best_meeting;            ///< Length of the shortest known route through a voxel reached by both frontiers.
+	WalkedPosition *meet_pos[2];    ///< Positions of both frontiers at the voxel of the best known meeting.
+
+	inline uint32 GetEstimate(const XYZPoint16 &vox, uint8 side);
+	WalkedPosition *GetPosition(const XYZPoint16 &vox, uint8 side, uint32 traveled, uint32 estimate, bool *is_new);
+	WalkedPosition *FindPosition(const XYZPoint16 &vox, uint8 side);
+	WalkedPosition *NewPosition();
+	void GrowPositionTable();
+
+	/**
+	 * Get a walked position in the arena by index.
+	 * @param index Index of the position, smaller than #position_count.
+	 * @return The walked position.
+	 */
+	inline WalkedPosition &PositionAt(size_t index)
+	{
+		return this->position_chunks[index / POSITION_CHUNK_SIZE][index % POSITION_CHUNK_SIZE];
+	}
+	void AddOpen(const XYZPoint16 &vox, uint8 side, uint32 traveled, const WalkedPosition *prev_pos);
+	uint32 TopBucket(uint8 side);
+
+	/**
+	 * Pack a voxel coordinate into a hash key.
+	 * @param vox Coordinate of the voxel.
+	 * @return Key uniquely identifying the voxel.
+	 */
+	static inline uint32 PackVoxel(const XYZPoint16 &vox)
+	{
+		return (static_cast<uint32>(vox.x) << 20) | (static_cast<uint32>(vox.y) << 8) | static_cast<uint8>(vox.z);
+	}
+
+	/**
+	 * Pack a voxel coordinate and the frontier that reached it into a hash key.
+	 * @param vox Coordinate of the voxel.
+	 * @param side Frontier that reached the voxel.
+	 * @return Key uniquely identifying the voxel/frontier combination.
+	 */
+	static inline uint32 SideKey(const XYZPoint16 &vox, uint8 side)
+	{
+		return PackVoxel(vox) ^ (side != 0 ? 0xA5A5A5A5u : 0);
+	}
+
+	/**
+	 * Get the hash table slot of a voxel key.
+	 * @param key Packed voxel coordinate, see #SideKey.
+	 * @return Index of its first probe slot in #position_table.
+	 */
+	inline uint32 SlotOf(uint32 key) const
+	{
+		return (key * 0x9E3779B9u) >> (32 - this->table_log_size); // Fibonacci hashing.
+	}
 };
 
-#endif
+extern PathSearcher _path_searcher;
 
+#endif
@@ -0,0 +1,443 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file path_graph.cpp Implementation of the junction graph over the path network. */
+
+#include <queue>
+#include <set>
+
+#include "stdafx.h"
+#include "path_graph.h"
+#include "path.h"
+#include "path_jobs.h"
+#include "map.h"
+
+PathGraph _path_graph;  ///< The junction graph of the path network.
+
+static const size_t MAX_CACHED_ROUTES = 16;  ///< Number of destinations to keep route tables for before starting over.
+
+/** Copy the path exits of every path voxel of the world. Must be called on the main thread. */
+void PathNetworkSnapshot::Capture()
+{
+	this->x_size = _world.GetXSize();
+	this->y_size = _world.GetYSize();
+	this->exits.clear();
+	for (uint16 x = 0; x < this->x_size; x++) {
+		for (uint16 y = 0; y < this->y_size; y++) {
+			const VoxelStack *vs = _world.GetStack(x, y);
+			for (uint16 i = 0; i < vs->height; i++) {
+				uint8 e = GetPathExits(&vs->voxels[i]);
+				if (e != 0) this->exits[PackPathVoxel(XYZPoint16(x, y, vs->base + i))] = e;
+			}
+		}
+	}
+}
+
+/**
+ * Follow a path connection in the snapshot; the snapshot counterpart of #TraversePathEdge.
+ * @param from Position of the path voxel being left.
+ * @param exits Path exits of the voxel (see #ExitsOf).
+ * @param edge Tile edge to examine.
+ * @param dest [out] Position of the connected path voxel, if there is a walkable connection.
+ * @return Whether there is a walkable connection over the given edge.
+ */
+bool PathNetworkSnapshot::Traverse(const XYZPoint16 &from, uint8 exits, TileEdge edge, XYZPoint16 *dest) const
+{
+	if ((exits & (0x11 << edge)) == 0) return false;
+
+	/* There is an outgoing connection, is it also on the world? */
+	Point16 dxy = _tile_dxy[edge];
+	if (dxy.x < 0 && from.x == 0) return false;
+	if (dxy.x > 0 && from.x + 1 == this->x_size) return false;
+	if (dxy.y < 0 && from.y == 0) return false;
+	if (dxy.y > 0 && from.y + 1 == this->y_size) return false;
+
+	int extra_z = ((exits & (0x10 << edge)) != 0);
+	if (from.z + extra_z < 0 || from.z + extra_z >= WORLD_Z_SIZE) return false;
+
+	/* Now check the other side, extra_z is the voxel where the path should be at the bottom. */
+	XYZPoint16 next = from + XYZPoint16(dxy.x, dxy.y, extra_z);
+	uint8 other_exits = this->ExitsOf(next);
+	if ((other_exits & (1 << ((edge + 2) % 4))) == 0) { // No path here, try one voxel below.
+		extra_z--;
+		if (from.z + extra_z < 0) return false;
+		next = from + XYZPoint16(dxy.x, dxy.y, extra_z);
+		other_exits = this->ExitsOf(next);
+		if ((other_exits & (0x10 << ((edge + 2) % 4))) == 0) return false;
+	}
+	*dest = next;
+	return true;
+}
+
+PathGraph::PathGraph() : dirty(true), rebuild_pending(false)
+{
+}
+
+/**
+ * Count the walkable exits of a path voxel in a snapshot.
+ * @param snap Snapshot of the path network.
+ * @param pos Position of the path voxel.
+ * @param exits Path exits of the voxel.
+ * @return Number of edges with a walkable connection to a neighbouring path voxel.
+ */
+static int CountWalkableExits(const PathNetworkSnapshot &snap, const XYZPoint16 &pos, uint8 exits)
+{
+	int count = 0;
+	XYZPoint16 dest;
+	for (TileEdge edge = EDGE_BEGIN; edge < EDGE_COUNT; edge++) {
+		if (snap.Traverse(pos, exits, edge, &dest)) count++;
+	}
+	return count;
+}
+
+/**
+ * Verify against the live world that a path edge can still be walked.
+ * The structures producing route answers may lag a rebuild behind the world.
+ * @param from Position of the path tile being left.
+ * @param edge Proposed tile edge, may be #INVALID_EDGE.
+ * @return The edge if it is still walkable, #INVALID_EDGE otherwise.
+ */
+static TileEdge VerifyLiveStep(const XYZPoint16 &from, TileEdge edge)
+{
+	if (edge == INVALID_EDGE) return INVALID_EDGE;
+	if (!IsVoxelstackInsideWorld(from.x, from.y)) return INVALID_EDGE;
+	const Voxel *v = _world.GetVoxel(from);
+	XYZPoint16 next;
+	if (v == nullptr || !TraversePathEdge(from, GetPathExits(v), edge, &next)) return INVALID_EDGE;
+	return edge;
+}
+
+/** Swap in a finished rebuild, and start a background rebuild job if the graph is stale. */
+void PathGraph::EnsureFresh()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->result_mutex);
+		if (this->completed != nullptr) {
+			this->nodes = std::move(this->completed->nodes);
+			this->corridors = std::move(this->completed->corridors);
+			this->tiles = std::move(this->completed->tiles);
+			this->completed = nullptr;
+			this->rebuild_pending = false;
+			this->route_cache.clear();  // The tables index into the replaced graph.
+		}
+	}
+	if (!this->dirty || this->rebuild_pending) return;
+
+	this->dirty = false;
+	this->rebuild_pending = true;
+	auto snap = std::make_shared<PathNetworkSnapshot>();
+	snap->Capture();
+	auto result = std::make_shared<BuildResult>();
+	_path_job_queue.Submit([this, snap, result]() {
+		BuildFrom(*snap, result.get());
+		std::lock_guard<std::mutex> lock(this->result_mutex);
+		this->completed = result;
+	});
+}
+
+/**
+ * Build the junction graph from a snapshot of the path network. Runs on the worker thread.
+ * @param snap Snapshot of the path network.
+ * @param result [out] The built graph.
+ */
+void PathGraph::BuildFrom(const PathNetworkSnapshot &snap, BuildResult *result)
+{
+	/* First pass: every path tile with any number of walkable exits except two is a junction. */
+	for (const auto &iter : snap.exits) {
+		const XYZPoint16 pos = UnpackPathVoxel(iter.first);
+		if (CountWalkableExits(snap, pos, iter.second) == 2) continue; // Corridor tile, covered by the walks below.
+
+		result->tiles[iter.first] = PathTile{static_cast<int32>(result->nodes.size()), -1, {0, 0}, {0, 0}};
+		result->nodes.push_back(Node{pos, -1, {}});
+	}
+
+	/* Second pass: walk the corridors between the junctions.
+	 * Corridor tiles of loops without any junction stay out of the graph; queries
+	 * about them fall back to the voxel search. */
+	std::set<uint32> walked;  // Junction/edge combinations already covered by a walk.
+	for (uint32 n = 0; n < result->nodes.size(); n++) {
+		const XYZPoint16 start = result->nodes[n].vox;
+		const uint8 exits = snap.ExitsOf(start);
+		for (TileEdge edge = EDGE_BEGIN; edge < EDGE_COUNT; edge++) {
+			if (walked.count((n << 2) | edge) != 0) continue;
+
+			XYZPoint16 cur;
+			if (!snap.Traverse(start, exits, edge, &cur)) continue;
+			walked.insert((n << 2) | edge);
+
+			const int32 cid = result->corridors.size();
+			std::vector<uint32> corridor_keys;
+			TileEdge entry = edge;  // Edge used to leave the previous tile.
+			uint16 steps = 1;
+			int32 end_node = -1;
+			TileEdge end_edge = INVALID_EDGE;
+			for (;;) {
+				const uint32 key = PackPathVoxel(cur);
+				const auto it = result->tiles.find(key);
+				if (it != result->tiles.end() && it->second.node >= 0) {
+					/* Reached the junction at the far end. */
+					end_node = it->second.node;
+					end_edge = static_cast<TileEdge>((entry + 2) % 4);
+					break;
+				}
+
+				/* Corridor tile; record it and step to its other exit. */
+				const TileEdge back = static_cast<TileEdge>((entry + 2) % 4);
+				result->tiles[key] = PathTile{-1, cid, {steps, 0}, {static_cast<uint8>(back), 0}};
+				corridor_keys.push_back(key);
+
+				const uint8 cur_exits = snap.ExitsOf(cur);
+				XYZPoint16 next;
+				TileEdge leave = EDGE_COUNT;
+				for (TileEdge e2 = EDGE_BEGIN; e2 < EDGE_COUNT; e2++) {
+					if (e2 == back) continue;
+					if (snap.Traverse(cur, cur_exits, e2, &next)) {
+						leave = e2;
+						break;
+					}
+				}
+				if (leave == EDGE_COUNT) break; // Should not happen for a two-exit tile; leave the corridor half-open.
+
+				result->tiles[key].edge_to[1] = leave;
+				entry = leave;
+				cur = next;
+				steps++;
+			}
+
+			result->corridors.push_back(Corridor{static_cast<int32>(n), end_node, -1, steps,
+					static_cast<uint8>(edge), static_cast<uint8>(end_edge)});
+			result->nodes[n].corridors.push_back(cid);
+			if (end_node >= 0) {
+				walked.insert((static_cast<uint32>(end_node) << 2) | end_edge);
+				if (end_node != static_cast<int32>(n)) result->nodes[end_node].corridors.push_back(cid);
+			}
+
+			/* Now that the total length is known, fill in the distances to the far end. */
+			for (const uint32 key : corridor_keys) {
+				PathTile &pt = result->tiles[key];
+				pt.dist[1] = steps - pt.dist[0];
+			}
+		}
+	}
+
+	/* Third pass: union-find over the junctions to label the connectivity components. */
+	std::vector<int32> parent(result->nodes.size());
+	for (uint32 n = 0; n < result->nodes.size(); n++) parent[n] = n;
+	auto find = [&parent](int32 n) {
+		while (parent[n] != n) {
+			parent[n] = parent[parent[n]];  // Path halving.
+			n = parent[n];
+		}
+		return n;
+	};
+	for (const Corridor &c : result->corridors) {
+		if (c.node_b >= 0) parent[find(c.node_a)] = find(c.node_b);
+	}
+	for (uint32 n = 0; n < result->nodes.size(); n++) result->nodes[n].component = find(n);
+	for (Corridor &c : result->corridors) c.component = result->nodes[c.node_a].component;
+}
+
+/**
+ * Can one path tile be reached from another over the path network at all?
+ * Cheap connectivity pre-check to avoid running a full path search that is doomed to fail.
+ * @param from Position of one path tile.
+ * @param to Position of the other path tile.
+ * @return Whether the tiles may be connected; \c true is also returned when a tile is
+ *         outside the graph and the answer is unknown, so \c false is definite.
+ */
+bool PathGraph::IsConnected(const XYZPoint16 &from, const XYZPoint16 &to)
+{
+	this->EnsureFresh();
+	if (from == to) return true;
+
+	const auto it_from = this->tiles.find(PackPathVoxel(from));
+	const auto it_to = this->tiles.find(PackPathVoxel(to));
+	if (it_from == this->tiles.end() || it_to == this->tiles.end()) return true; // Unknown tile, let the caller search.
+
+	const PathTile &tf = it_from->second;
+	const PathTile &tt = it_to->second;
+	const int32 component_from = (tf.node >= 0) ? this->nodes[tf.node].component : this->corridors[tf.corridor].component;
+	const int32 component_to = (tt.node >= 0) ? this->nodes[tt.node].component : this->corridors[tt.corridor].component;
+	return component_from == component_to;
+}
+
+/**
+ * Get the direction to walk at a path tile to head towards another path tile.
+ * @param from Position of the path tile being left.
+ * @param to Position of the destination path tile.
+ * @return First edge of a shortest route over the path network, or #INVALID_EDGE if the
+ *         graph cannot answer the query (caller should fall back to a voxel search).
+ */
+TileEdge PathGraph::GetRouteDirection(const XYZPoint16 &from, const XYZPoint16 &to)
+{
+	this->EnsureFresh();
+	if (from == to) return INVALID_EDGE;
+
+	const auto it_from = this->tiles.find(PackPathVoxel(from));
+	const auto it_to = this->tiles.find(PackPathVoxel(to));
+	if (it_from == this->tiles.end() || it_to == this->tiles.end()) return INVALID_EDGE;
+	const PathTile &tf = it_from->second;
+	const PathTile &tt = it_to->second;
+
+	/* Both tiles on the same corridor: walk along it. */
+	if (tf.corridor >= 0 && tf.corridor == tt.corridor) {
+		return VerifyLiveStep(from, static_cast<TileEdge>(tt.dist[0] > tf.dist[0] ? tf.edge_to[1] : tf.edge_to[0]));
+	}
+
+	/* A route table answers this and every other query towards the same destination; people
+	 * heading for the same ride entrance share one Dijkstra run. The tables are dropped
+	 * whenever a rebuilt graph is swapped in. */
+	const uint32 dest_key = PackPathVoxel(to);
+	auto rit = this->route_cache.find(dest_key);
+	if (rit == this->route_cache.end()) {
+		if (this->route_cache.size() >= MAX_CACHED_ROUTES) this->route_cache.clear();
+		rit = this->route_cache.emplace(dest_key, RouteTable()).first;
+		this->BuildRouteTable(tt, &rit->second);
+	}
+	const RouteTable &table = rit->second;
+
+	const uint32 UNREACHED = std::numeric_limits<uint32>::max();
+	if (tf.node >= 0) {
+		if (table.cost[tf.node] == UNREACHED) return INVALID_EDGE;
+		return VerifyLiveStep(from, static_cast<TileEdge>(table.via[tf.node]));
+	}
+
+	/* Starting on a corridor: head for the end junction with the cheapest total route. */
+	const Corridor &c = this->corridors[tf.corridor];
+	uint32 best = UNREACHED;
+	TileEdge result = INVALID_EDGE;
+	if (c.node_a >= 0 && table.cost[c.node_a] != UNREACHED && tf.dist[0] + table.cost[c.node_a] < best) {
+		best = tf.dist[0] + table.cost[c.node_a];
+		result = static_cast<TileEdge>(tf.edge_to[0]);
+	}
+	if (c.node_b >= 0 && table.cost[c.node_b] != UNREACHED && tf.dist[1] + table.cost[c.node_b] < best) {
+		result = static_cast<TileEdge>(tf.edge_to[1]);
+	}
+	return VerifyLiveStep(from, result);
+}
+
+/**
+ * Run Dijkstra over the junction graph, outward from a destination tile.
+ * @param tt Graph bookkeeping of the destination tile.
+ * @param table [out] Distance and route edge of every junction towards the destination.
+ */
+void PathGraph::BuildRouteTable(const PathTile &tt, RouteTable *table) const
+{
+	const uint32 UNREACHED = std::numeric_limits<uint32>::max();
+	table->cost.assign(this->nodes.size(), UNREACHED);
+	table->via.assign(this->nodes.size(), INVALID_EDGE);
+	std::priority_queue<std::pair<uint32, int32>, std::vector<std::pair<uint32, int32>>, std::greater<std::pair<uint32, int32>>> frontier;
+
+	auto relax = [table, &frontier](int32 node, uint32 dist, uint8 entry_edge) {
+		if (dist >= table->cost[node]) return;
+		table->cost[node] = dist;
+		table->via[node] = entry_edge;
+		frontier.push({dist, node});
+	};
+
+	if (tt.node >= 0) {
+		relax(tt.node, 0, INVALID_EDGE);
+	} else {
+		/* Seed the end junctions of the destination's corridor; entering that corridor reaches the destination. */
+		const Corridor &c = this->corridors[tt.corridor];
+		if (c.node_a >= 0) relax(c.node_a, tt.dist[0], c.edge_a);
+		if (c.node_b >= 0) relax(c.node_b, tt.dist[1], c.edge_b);
+	}
+
+	while (!frontier.empty()) {
+		const auto [dist, node] = frontier.top();
+		frontier.pop();
+		if (dist != table->cost[node]) continue; // Stale entry, the node was relaxed again.
+
+		for (const int32 cid : this->nodes[node].corridors) {
+			const Corridor &c = this->corridors[cid];
+			if (c.node_a == node && c.node_b >= 0) relax(c.node_b, dist + c.length, c.edge_b);
+			if (c.node_b == node && c.node_a >= 0) relax(c.node_a, dist + c.length, c.edge_a);
+		}
+	}
+}
+
+PathFlowField _exit_flow_field;  ///< The shared flow field towards the park exit.
+
+PathFlowField::PathFlowField() : dirty(true), rebuild_pending(false), dest(-1, -1, -1)
+{
+}
+
+/**
+ * Get the direction to walk at a path tile to head towards the destination tile.
+ * While a rebuild is in flight, answers come from the previous field (verified against the
+ * live world) or are #INVALID_EDGE, telling the caller to keep its current heading.
+ * @param pos Position of the path tile being left.
+ * @param to Position of the destination path tile.
+ * @return Edge of a shortest route towards the destination, or #INVALID_EDGE if the
+ *         destination is unreachable, not yet computed, or \a pos is the destination itself.
+ */
+TileEdge PathFlowField::GetDirection(const XYZPoint16 &pos, const XYZPoint16 &to)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->result_mutex);
+		if (this->completed != nullptr) {
+			this->dest = this->completed->dest;
+			this->directions = std::move(this->completed->directions);
+			this->completed = nullptr;
+			this->rebuild_pending = false;
+		}
+	}
+	if ((this->dirty || this->dest != to) && !this->rebuild_pending) {
+		this->dirty = false;
+		this->rebuild_pending = true;
+		if (this->dest != to) {
+			this->dest = to;  // Never answer from a field of another destination.
+			this->directions.clear();
+		}
+		auto snap = std::make_shared<PathNetworkSnapshot>();
+		snap->Capture();
+		auto result = std::make_shared<BuildResult>();
+		result->dest = to;
+		_path_job_queue.Submit([this, snap, result]() {
+			BuildFrom(*snap, result.get());
+			std::lock_guard<std::mutex> lock(this->result_mutex);
+			this->completed = result;
+		});
+	}
+	if (this->dest != to) return INVALID_EDGE; // A rebuild for another destination is still in flight.
+
+	const auto it = this->directions.find(PackPathVoxel(pos));
+	if (it == this->directions.end()) return INVALID_EDGE;
+	return VerifyLiveStep(pos, static_cast<TileEdge>(it->second));
+}
+
+/**
+ * Build the flow field with a reverse breadth-first search from the destination.
+ * Runs on the worker thread.
+ * @param snap Snapshot of the path network.
+ * @param result [out] The built field; #BuildResult::dest must be set by the caller.
+ */
+void PathFlowField::BuildFrom(const PathNetworkSnapshot &snap, BuildResult *result)
+{
+	/* Breadth-first search outward from the destination; the first visit of a tile is over
+	 * a shortest route, and the reverse of the expanded edge points back towards the destination. */
+	result->directions[PackPathVoxel(result->dest)] = INVALID_EDGE;  // Standing at the destination, nowhere to walk.
+	std::queue<XYZPoint16> frontier;
+	frontier.push(result->dest);
+	while (!frontier.empty()) {
+		const XYZPoint16 tile = frontier.front();
+		frontier.pop();
+
+		const uint8 exits = snap.ExitsOf(tile);
+		for (TileEdge edge = EDGE_BEGIN; edge < EDGE_COUNT; edge++) {
+			XYZPoint16 next;
+			if (!snap.Traverse(tile, exits, edge, &next)) continue;
+
+			const uint32 key = PackPathVoxel(next);
+			if (result->directions.count(key) != 0) continue; // Already reached over a route at least as short.
+
+			result->directions[key] = (edge + 2) % 4;
+			frontier.push(next);
+		}
+	}
+}
@@ -0,0 +1,192 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file path_graph.h Junction graph over the path network. */
+
+#ifndef PATH_GRAPH_H
+#define PATH_GRAPH_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "geometry.h"
+#include "tile.h"
+
+/**
+ * Pack a voxel coordinate into a map key.
+ * @param vox Coordinate of the voxel.
+ * @return Key uniquely identifying the voxel.
+ */
+static inline uint32 PackPathVoxel(const XYZPoint16 &vox)
+{
+	return (static_cast<uint32>(vox.x) << 20) | (static_cast<uint32>(vox.y) << 8) | static_cast<uint8>(vox.z);
+}
+
+/**
+ * Unpack a voxel coordinate from a map key.
+ * @param key Key made by #PackPathVoxel.
+ * @return Coordinate of the voxel.
+ */
+static inline XYZPoint16 UnpackPathVoxel(uint32 key)
+{
+	return XYZPoint16(key >> 20, (key >> 8) & 0xFFF, key & 0xFF);
+}
+
+/**
+ * Immutable copy of the path network, safe to read from a background job.
+ *
+ * Captured on the main thread, it records the path exits of every path voxel so rebuild
+ * jobs can traverse the network without touching the world while the simulation keeps
+ * running and mutating it.
+ */
+struct PathNetworkSnapshot {
+	void Capture();
+	bool Traverse(const XYZPoint16 &from, uint8 exits, TileEdge edge, XYZPoint16 *dest) const;
+
+	/**
+	 * Get the path exits of a voxel in the snapshot.
+	 * @param vox Coordinate of the voxel.
+	 * @return Path exits of the voxel (see #GetPathExits), \c 0 if it holds no path.
+	 */
+	inline uint8 ExitsOf(const XYZPoint16 &vox) const
+	{
+		const auto it = this->exits.find(PackPathVoxel(vox));
+		return (it == this->exits.end()) ? 0 : it->second;
+	}
+
+	uint16 x_size;                 ///< Length of the world in x direction at capture time.
+	uint16 y_size;                 ///< Length of the world in y direction at capture time.
+	std::map<uint32, uint8> exits; ///< Path exits of every path voxel, keyed by packed position.
+};
+
+/**
+ * Junction-to-junction abstraction of the path network.
+ *
+ * Path tiles with two walkable exits are condensed into corridors between junction tiles
+ * (dead ends, crossings, and isolated tiles), giving a graph that is orders of magnitude
+ * smaller than the voxel world. Long-distance route queries run Dijkstra over the junction
+ * graph instead of a voxel-by-voxel search; since people re-query at every tile they walk
+ * onto, the first step of the route is all that is ever needed and no path refinement pass
+ * exists.
+ *
+ * After path edits have marked the graph invalid, it is rebuilt by a background job against
+ * a #PathNetworkSnapshot; until the result arrives, queries answer from the previous graph
+ * (each returned step is verified against the live world) or report "don't know", so a tick
+ * never stalls on a rebuild.
+ */
+class PathGraph {
+public:
+	PathGraph();
+
+	/** The path network changed, throw away the graph. It is rebuilt in the background after the next query. */
+	inline void Invalidate()
+	{
+		this->dirty = true;
+	}
+
+	TileEdge GetRouteDirection(const XYZPoint16 &from, const XYZPoint16 &to);
+	bool IsConnected(const XYZPoint16 &from, const XYZPoint16 &to);
+
+private:
+	/** A run of path tiles with two walkable exits, connecting two junctions. */
+	struct Corridor {
+		int32 node_a;     ///< Index of the junction at one end, negative if the corridor ends nowhere.
+		int32 node_b;     ///< Index of the junction at the other end, negative if the corridor ends nowhere.
+		int32 component;  ///< Connectivity component the corridor belongs to.
+		uint16 length;    ///< Number of steps from #node_a to #node_b.
+		uint8 edge_a;     ///< Tile edge at #node_a entering the corridor.
+		uint8 edge_b;     ///< Tile edge at #node_b entering the corridor.
+	};
+
+	/** A junction tile of the path network (a path tile with any number of walkable exits except two). */
+	struct Node {
+		XYZPoint16 vox;                ///< Position of the junction.
+		int32 component;               ///< Connectivity component the junction belongs to.
+		std::vector<int32> corridors;  ///< Corridors connected to the junction.
+	};
+
+	/** Graph bookkeeping of one path tile. */
+	struct PathTile {
+		int32 node;      ///< Junction node index of the tile, \c -1 for corridor tiles.
+		int32 corridor;  ///< Corridor index of the tile, \c -1 for junction tiles.
+		uint16 dist[2];  ///< Corridor tiles only: distance in steps to #Corridor::node_a respectively #Corridor::node_b.
+		uint8 edge_to[2]; ///< Corridor tiles only: tile edge leading towards #Corridor::node_a respectively #Corridor::node_b.
+	};
+
+	/** Output of one graph rebuild job, swapped in by the main thread when done. */
+	struct BuildResult {
+		std::vector<Node> nodes;          ///< Junctions of the path network.
+		std::vector<Corridor> corridors;  ///< Corridors between the junctions.
+		std::map<uint32, PathTile> tiles; ///< Graph bookkeeping of every path tile, keyed by packed position.
+	};
+
+	/** Route answers of every junction towards one destination, shared by all queries for it. */
+	struct RouteTable {
+		std::vector<uint32> cost; ///< Distance from each junction to the destination, \c UINT32_MAX if unreachable.
+		std::vector<uint8> via;   ///< Edge to leave each junction by on a shortest route, #INVALID_EDGE if unreachable.
+	};
+
+	void EnsureFresh();
+	void BuildRouteTable(const PathTile &tt, RouteTable *table) const;
+	static void BuildFrom(const PathNetworkSnapshot &snap, BuildResult *result);
+
+	bool dirty;                         ///< The path network changed since the last rebuild was started.
+	bool rebuild_pending;               ///< A rebuild job is queued or running.
+	std::mutex result_mutex;            ///< Protects #completed against the worker thread.
+	std::shared_ptr<BuildResult> completed; ///< Result of a finished rebuild job, waiting to be swapped in.
+	std::vector<Node> nodes;            ///< Junctions of the path network.
+	std::vector<Corridor> corridors;    ///< Corridors between the junctions.
+	std::map<uint32, PathTile> tiles;   ///< Graph bookkeeping of every path tile, keyed by packed position.
+	std::map<uint32, RouteTable> route_cache; ///< Route tables keyed by packed destination, valid for the current graph.
+};
+
+extern PathGraph _path_graph;
+
+/**
+ * Shared flow field over the path network towards a single destination tile.
+ *
+ * A reverse breadth-first search from the destination stores for every reachable path tile
+ * the edge to walk towards the destination, so any number of people heading for the same
+ * tile (typically the park exit during mass departures) share one search and read their
+ * direction with a single lookup. Like the junction graph, the field is rebuilt by a
+ * background job when the path network changes or the destination differs from the cached
+ * one; people keep their current heading until the result arrives.
+ */
+class PathFlowField {
+public:
+	PathFlowField();
+
+	/** The path network changed, throw away the field. It is rebuilt in the background after the next query. */
+	inline void Invalidate()
+	{
+		this->dirty = true;
+	}
+
+	TileEdge GetDirection(const XYZPoint16 &pos, const XYZPoint16 &to);
+
+private:
+	/** Output of one flow field rebuild job, swapped in by the main thread when done. */
+	struct BuildResult {
+		XYZPoint16 dest;                    ///< Destination tile the field leads to.
+		std::map<uint32, uint8> directions; ///< Edge to walk towards #dest for every reachable path tile, keyed by packed position.
+	};
+
+	static void BuildFrom(const PathNetworkSnapshot &snap, BuildResult *result);
+
+	bool dirty;                        ///< The path network changed since the last rebuild was started.
+	bool rebuild_pending;              ///< A rebuild job is queued or running.
+	std::mutex result_mutex;           ///< Protects #completed against the worker thread.
+	std::shared_ptr<BuildResult> completed; ///< Result of a finished rebuild job, waiting to be swapped in.
+	XYZPoint16 dest;                   ///< Destination tile the field leads to.
+	std::map<uint32, uint8> directions; ///< Edge to walk towards #dest for every reachable path tile, keyed by packed position.
+};
+
+extern PathFlowField _exit_flow_field;
+
+#endif
@@ -258,6 +258,11 @@ void PathBuildGui::SelectorMouseMoveEvent(Viewport *vp, [[maybe_unused]] const P
 	this->mouse_pos = fdata.voxel_pos;
 	if (this->single_tile_mode) this->TryAddRemovePath(_video.GetMouseDragging());
 
+	/* With a directional build position, the preview and the buttons depend only on that position
+	 * and the world; every mutation of them already refreshes the display. Skip the revalidation
+	 * (a dozen voxel probes) that used to run for every tile the mouse merely crossed. */
+	if (!this->single_tile_mode && this->build_pos.x >= 0) return;
+
 	this->SetButtons();
 	this->SetupSelector();
 }
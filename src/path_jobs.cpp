@@ -0,0 +1,65 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file path_jobs.cpp Implementation of the background pathfinding job queue. */
+
+#include "stdafx.h"
+#include "alloc_tracking.h"
+#include "path_jobs.h"
+#include "task_system.h"
+
+PathJobQueue _path_job_queue;  ///< The background pathfinding job queue.
+
+PathJobQueue::PathJobQueue() : draining(false)
+{
+}
+
+/**
+ * Queue a job for background execution.
+ * @param job Work to run; it must not touch the world or other mutable game state.
+ */
+void PathJobQueue::Submit(std::function<void()> job)
+{
+	bool start_drain = false;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->jobs.push_back(std::move(job));
+		if (!this->draining) {
+			this->draining = true;
+			start_drain = true;
+		}
+	}
+	/* Submit outside the lock; without worker threads the drain runs inline right here. */
+	if (start_drain) _task_system.Submit([this]() { this->Drain(); }, TKP_LOW);
+}
+
+/** Wait until all queued jobs have finished. Safe to call more than once. */
+void PathJobQueue::Shutdown()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->idle_condition.wait(lock, [this]() { return !this->draining; });
+}
+
+/** Run the queued jobs one at a time, until the queue is empty. Runs on the task system. */
+void PathJobQueue::Drain()
+{
+	const AllocationTagScope tag(ALT_PATHFINDING);  // The tag is thread-local, charge the drain task.
+	for (;;) {
+		std::function<void()> job;
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			if (this->jobs.empty()) {
+				this->draining = false;
+				this->idle_condition.notify_all();
+				return;
+			}
+			job = std::move(this->jobs.front());
+			this->jobs.pop_front();
+		}
+		job();
+	}
+}
@@ -0,0 +1,45 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file path_jobs.h Background job queue for pathfinding work. */
+
+#ifndef PATH_JOBS_H
+#define PATH_JOBS_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/**
+ * Job queue drained serially in the background, on the shared task system.
+ *
+ * Heavy pathfinding work (rebuilding the junction graph or a flow field) is submitted as a
+ * job working on an immutable snapshot of the path network, so the simulation tick never
+ * stalls on it. Jobs must not touch the world or any other mutable game state; they compute
+ * into their own storage and hand the result back for the main thread to pick up.
+ * Jobs run one at a time, in submission order.
+ */
+class PathJobQueue {
+public:
+	PathJobQueue();
+
+	void Submit(std::function<void()> job);
+	void Shutdown();
+
+private:
+	void Drain();
+
+	std::mutex mutex;                       ///< Protects #jobs and #draining.
+	std::condition_variable idle_condition; ///< Signals a #Shutdown caller that the queue ran empty.
+	std::deque<std::function<void()>> jobs; ///< Jobs waiting to be run.
+	bool draining;                          ///< A drain task is queued or running on the task system.
+};
+
+extern PathJobQueue _path_job_queue;
+
+#endif
@@ -143,7 +143,6 @@ void PathObjectGui::SetWidgetStringParameters(WidgetNumber wid_num) const
 void PathObjectGui::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 {
 	if (this->type == nullptr) return;
-	this->object.reset();
 
 	const Point32 world_pos = vp->ComputeHorizontalTranslation(vp->rect.width / 2 - pos.x, vp->rect.height / 2 - pos.y);
 	const int8 dx = _orientation_signum_dx[vp->orientation];
@@ -162,6 +161,7 @@ void PathObjectGui::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 		if (!this->type->can_exist_on_slope && GetImplodedPathSlope(v) >= PATH_FLAT_COUNT) continue;
 
 		/* The item can be placed here. */
+		if (this->object != nullptr && this->object->vox_pos == location && this->object->type == this->type) return;  // Selector is already up to date.
 		this->object.reset(new PathObjectInstance(this->type, location, XYZPoint16()));
 		_scenery.temp_path_object = this->object.get();
 		this->path_object_sel.SetPosition(location.x, location.y);
@@ -170,6 +170,8 @@ void PathObjectGui::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 		return;
 	}
 
+	this->object.reset();
+	_scenery.temp_path_object = nullptr;
 	this->path_object_sel.SetSize(0, 0);
 }
 
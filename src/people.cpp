@@ -16,11 +16,13 @@
 #include "person_type.h"
 #include "ride_type.h"
 #include "path_finding.h"
+#include "path_graph.h"
 #include "person.h"
 #include "people.h"
 #include "gamelevel.h"
 #include "gameobserver.h"
 #include "finances.h"
+#include "window.h"
 #include <limits>
 
 Guests _guests; ///< %Guests in the world/park.
@@ -45,7 +47,7 @@ assert_compile(lengthof(COMPLAINT_THRESHOLD) == Guests::COMPLAINT_COUNT);
 assert_compile(lengthof(COMPLAINT_MESSAGES ) == Guests::COMPLAINT_COUNT);
 
 /** Constructor. */
-Guests::Complaint::Complaint() : counter(0), time_since_message(COMPLAINT_TIMEOUT)
+Guests::Complaint::Complaint() : counter(0), next_message_time(0)
 {
 }
 
@@ -83,13 +85,45 @@ static Point16 FindEdgeRoad()
 	return {-1, -1};
 }
 
-constexpr int GUEST_BLOCK_SIZE = 64;  ///< Number of guests to batch-allocate.
+#define FOR_EACH_ACTIVE_STAFF(pool, block, m) for (auto &block : (pool).blocks) for (auto *m = block.get(); m < block.get() + STAFF_BLOCK_SIZE; ++m) if (m->IsActive())
 
 #define FOR_EACH_ACTIVE_GUEST(block, g) for (auto &block : this->guests) for (Guest *g = block.get(); g < block.get() + GUEST_BLOCK_SIZE; ++g) if (g->IsActive())
 
+/**
+ * Reschedule interval of a guest parked behind another queuing guest, in milliseconds.
+ * Only a safety net against missed wake-ups; must stay well below one wheel revolution
+ * (#WHEEL_BUCKET_COUNT * #WHEEL_GRANULARITY), and short enough that a guest stuck in a
+ * cyclic queuing dependency resolves it without a visible hitch.
+ */
+static const uint32 QUEUE_PARK_TIMEOUT = 400;
+
 Guests::Guests()
-: start_voxel(-1, -1), rnd(), daily_frac(0)
+: start_voxel(-1, -1), rnd(), daily_frac(0), tick_cursor(0), active_count(0), in_park_count(0), park_happiness_sum(0), anim_time(0)
+{
+}
+
+/**
+ * Register the time stamp at which a guest needs its next animation frame.
+ * Any previous registration of the guest becomes stale and is dropped when its bucket is drained.
+ * @param idx Index of the guest.
+ * @param due #anim_time stamp to service the guest at.
+ */
+void Guests::ScheduleGuest(int idx, uint32 due)
 {
+	this->DueTime(idx) = due;
+	this->wheel[(due / WHEEL_GRANULARITY) % WHEEL_BUCKET_COUNT].push_back({idx, due});
+}
+
+/**
+ * Wake a guest that parked itself in a queue, servicing it at the next animation update.
+ * Safe to call for guests that were deactivated or are already scheduled sooner.
+ * @param idx Index of the guest to wake.
+ */
+void Guests::WakeGuest(int idx)
+{
+	Guest *g = this->GetExisting(idx);
+	if (!g->IsActive()) return;
+	this->ScheduleGuest(idx, this->anim_time + 1);  // Any earlier wheel entry of the guest goes stale.
 }
 
 /** Deactivate all guests and reset variables. */
@@ -97,15 +131,22 @@ void Guests::Uninitialize()
 {
 	this->guests.clear();
 	this->free_guest_indices.clear();
+	this->due_times.clear();
+	for (std::vector<WheelEntry> &bucket : this->wheel) bucket.clear();
+	this->anim_time = 0;
 
 	this->start_voxel.x = -1;
 	this->start_voxel.y = -1;
 	this->daily_frac = 0;
+	this->tick_cursor = 0;
+	this->active_count = 0;
+	this->in_park_count = 0;
+	this->park_happiness_sum = 0;
 
 	for (Complaint &c : this->complaints) c = Complaint();
 }
 
-static const uint32 CURRENT_VERSION_GSTS = 2;   ///< Currently supported version of the GSTS Pattern.
+static const uint32 CURRENT_VERSION_GSTS = 3;   ///< Currently supported version of the GSTS Pattern.
 
 /**
  * Load guests from the save game.
@@ -118,7 +159,8 @@ void Guests::Load(Loader &ldr)
 		case 0:
 			break;
 		case 1:
-		case 2: {
+		case 2:
+		case 3: {
 			this->start_voxel.x = ldr.GetWord();
 			this->start_voxel.y = ldr.GetWord();
 			this->daily_frac = ldr.GetWord();
@@ -127,7 +169,16 @@ void Guests::Load(Loader &ldr)
 
 			if (version > 1) {
 				for (Complaint &c : this->complaints) c.counter = ldr.GetWord();
-				for (Complaint &c : this->complaints) c.time_since_message = ldr.GetLong();
+				if (version > 2) {
+					/* Time in milliseconds until a message about the subject may be sent again. */
+					for (Complaint &c : this->complaints) c.next_message_time = this->anim_time + ldr.GetLong();
+				} else {
+					/* Old games stored the time since the last message instead. */
+					for (Complaint &c : this->complaints) {
+						const uint32 since = ldr.GetLong();
+						c.next_message_time = this->anim_time + (since >= COMPLAINT_TIMEOUT ? 0 : COMPLAINT_TIMEOUT - since);
+					}
+				}
 			}
 
 			std::set<uint32> active_indices;
@@ -136,6 +187,12 @@ void Guests::Load(Loader &ldr)
 				active_indices.insert(id);
 				Guest *g = this->GetCreate(id);
 				g->Load(ldr);
+				this->active_count++;
+				if (g->IsInPark()) {
+					this->in_park_count++;
+					this->park_happiness_sum += g->happiness;
+				}
+				this->ScheduleGuest(id, this->anim_time + std::max<int>(1, g->frame_time));
 			}
 
 			for (auto it = this->free_guest_indices.begin(); it != free_guest_indices.end();) {
@@ -170,10 +227,11 @@ void Guests::Save(Saver &svr)
 	svr.PutLong(0);  // Next guest ID, currently unused.
 
 	for (const Complaint &c : this->complaints) svr.PutWord(c.counter);
-	for (const Complaint &c : this->complaints) svr.PutLong(c.time_since_message);
+	for (const Complaint &c : this->complaints) svr.PutLong(c.next_message_time > this->anim_time ? c.next_message_time - this->anim_time : 0);
 
 	svr.PutLong(this->CountActiveGuests());
 	FOR_EACH_ACTIVE_GUEST(block, g) {
+		g->frame_time = this->DueTime(g->id) - this->anim_time; // The guest object may hold a stale frame time, see #due_times.
 		svr.PutWord(g->id);
 		g->Save(svr);
 	}
@@ -186,9 +244,7 @@ void Guests::Save(Saver &svr)
  */
 uint32 Guests::CountActiveGuests() const
 {
-	uint32 count = 0;
-	FOR_EACH_ACTIVE_GUEST(block, g) ++count;
-	return count;
+	return this->active_count;
 }
 
 /**
@@ -197,13 +253,17 @@ uint32 Guests::CountActiveGuests() const
  */
 uint32 Guests::CountGuestsInPark() const
 {
-	uint32 count = 0;
-	FOR_EACH_ACTIVE_GUEST(block, g) {
-		if (g->IsInPark()) {
-			++count;
-		}
-	}
-	return count;
+	return this->in_park_count;
+}
+
+/**
+ * Get the summed happiness of all active guests in the park.
+ * The sum is kept in sync by guest state changes, so querying it is cheap.
+ * @return The summed happiness of all guests in the park.
+ */
+uint32 Guests::GetParkHappinessSum() const
+{
+	return this->park_happiness_sum;
 }
 
 /**
@@ -212,23 +272,76 @@ uint32 Guests::CountGuestsInPark() const
  */
 void Guests::OnAnimate(int delay)
 {
-	for (Complaint &c : this->complaints) c.time_since_message += delay;
+	const uint32 prev_time = this->anim_time;
+	this->anim_time += delay;
+
+	/* Drain every wheel bucket the elapsed interval touches. Guests whose next frame lies
+	 * further in the future sit untouched in their bucket, so dormant guests cost nothing. */
+	const uint32 first_slot = prev_time / WHEEL_GRANULARITY;
+	uint32 last_slot = this->anim_time / WHEEL_GRANULARITY;
+	if (last_slot - first_slot >= WHEEL_BUCKET_COUNT) last_slot = first_slot + WHEEL_BUCKET_COUNT - 1; // Huge delay, one revolution covers everything.
+	for (uint32 slot = first_slot; slot <= last_slot; slot++) {
+		std::vector<WheelEntry> bucket;
+		bucket.swap(this->wheel[slot % WHEEL_BUCKET_COUNT]);
+		for (const WheelEntry &entry : bucket) {
+			if (entry.due != this->DueTime(entry.guest)) continue; // Stale entry, the guest was rescheduled.
+
+			Guest *g = this->GetExisting(entry.guest);
+			if (!g->IsActive()) continue;
+
+			if (entry.due > this->anim_time) {
+				/* Not due yet; the entry wrapped around the wheel, put it back for the next revolution. */
+				this->wheel[slot % WHEEL_BUCKET_COUNT].push_back(entry);
+				continue;
+			}
 
-	FOR_EACH_ACTIVE_GUEST(block, g) {
-		AnimateResult ar = g->OnAnimate(delay);
-		if (ar != OAR_OK) g->DeActivate(ar);
+			const XYZPoint16 old_vox = g->vox_pos;
+			const XYZPoint16 old_pix = g->pix_pos;
+			g->frame_time = delay - static_cast<int>(this->anim_time - entry.due);
+			AnimateResult ar = g->OnAnimate(delay);
+			if (ar != OAR_OK) {
+				g->DeActivate(ar);
+				continue;
+			}
+			if (g->GetQueueWaiter() != INVALID_PERSON_HANDLE && (g->vox_pos != old_vox || g->pix_pos != old_pix)) {
+				/* The guest moved, wake the guest parked in the queue behind it. */
+				const uint16 waiter = g->GetQueueWaiter();
+				g->ClearQueueWaiter();
+				this->WakeGuest(waiter);
+			}
+			/* Parked guests sleep until woken; the timeout is only a safety net against missed wake-ups. */
+			this->ScheduleGuest(entry.guest, this->anim_time + (g->IsQueueParked() ? QUEUE_PARK_TIMEOUT : std::max<int>(1, g->frame_time)));
+		}
 	}
 }
 
-/** A new frame arrived, perform the daily call for some of the guests. */
-void Guests::DoTick()
+/**
+ * A new frame arrived, perform the daily call for some of the guests.
+ * The work is divisible: when the \a deadline passes, the pass over the guests is suspended
+ * and resumed in the next frame. A new pass only starts once the current one has finished.
+ * @param deadline Point in real time after which no further guests are serviced.
+ * @return The pass over the guests completed; \c false when it was suspended.
+ */
+bool Guests::DoTick(const Realtime &deadline)
 {
-	this->daily_frac = (this->daily_frac + 1) % TICK_COUNT_PER_DAY;
+	if (this->tick_cursor == 0) this->daily_frac = (this->daily_frac + 1) % TICK_COUNT_PER_DAY;
 
-	FOR_EACH_ACTIVE_GUEST(block, g) {
-		if (g->id % TICK_COUNT_PER_DAY != this->daily_frac) continue;
-		if (!g->DailyUpdate()) g->DeActivate(OAR_REMOVE);
+	static const uint32 DEADLINE_CHECK_INTERVAL = 64;  ///< Number of slots to examine between deadline checks.
+	uint32 until_check = DEADLINE_CHECK_INTERVAL;
+	const uint32 slot_count = this->guests.size() * GUEST_BLOCK_SIZE;
+	while (this->tick_cursor < slot_count) {
+		Guest *g = &this->guests[this->tick_cursor / GUEST_BLOCK_SIZE][this->tick_cursor % GUEST_BLOCK_SIZE];
+		this->tick_cursor++;
+		if (g->IsActive() && g->id % TICK_COUNT_PER_DAY == this->daily_frac) {
+			if (!g->DailyUpdate()) g->DeActivate(OAR_REMOVE);
+		}
+		if (--until_check == 0) {
+			until_check = DEADLINE_CHECK_INTERVAL;
+			if (Time() >= deadline) return false;
+		}
 	}
+	this->tick_cursor = 0;
+	return true;
 }
 
 /**
@@ -243,13 +356,42 @@ void Guests::OnNewDay()
 	}
 
 	/* Try adding a new guest to the park. */
-	if (this->CountActiveGuests() >= _scenario.max_guests) return;
-	if (!this->rnd.Success1024(_scenario.GetSpawnProbability(_game_observer.current_park_rating))) return;
+	if (this->CountActiveGuests() < _scenario.max_guests &&
+			this->rnd.Success1024(_scenario.GetSpawnProbability(_game_observer.current_park_rating))) {
+		this->SpawnGuest();
+	}
+
+	this->EnsureSpawnCapacity();
+}
 
+/**
+ * Prepare the next guest arrival ahead of time: make sure the entry road is known and a free
+ * guest slot exists, so #SpawnGuest only has to activate an already allocated record.
+ * Runs at the day boundary; the edge road scan and the block allocation thus never coincide
+ * with the spawn itself.
+ */
+void Guests::EnsureSpawnCapacity()
+{
+	if (!IsGoodEdgeRoad(this->start_voxel.x, this->start_voxel.y)) this->start_voxel = FindEdgeRoad();
+	if (!this->free_guest_indices.empty()) return;
+
+	/* Grow by one block; #GetCreate keeps the requested slot off the free list, give it back. */
+	const int idx = this->guests.size() * GUEST_BLOCK_SIZE;
+	this->GetCreate(idx);
+	this->free_guest_indices.push_back(idx);
+}
+
+/**
+ * Spawn a new guest at the park entrance road.
+ * The caller is responsible for respecting the scenario's maximal number of guests.
+ * @return The new guest, or \c nullptr if the world has no usable entrance road.
+ */
+Guest *Guests::SpawnGuest()
+{
 	if (!IsGoodEdgeRoad(this->start_voxel.x, this->start_voxel.y)) {
 		/* New guest, but no road. */
 		this->start_voxel = FindEdgeRoad();
-		if (!IsGoodEdgeRoad(this->start_voxel.x, this->start_voxel.y)) return;
+		if (!IsGoodEdgeRoad(this->start_voxel.x, this->start_voxel.y)) return nullptr;
 	}
 
 	/* New guest! */
@@ -263,6 +405,9 @@ void Guests::OnNewDay()
 		this->free_guest_indices.pop_back();
 	}
 	g->Activate(this->start_voxel, PERSON_GUEST);
+	this->active_count++;
+	this->ScheduleGuest(g->id, this->anim_time + std::max<int>(1, g->frame_time));
+	return g;
 }
 
 /**
@@ -281,6 +426,7 @@ Guest *Guests::GetCreate(int idx)
 	for (int i = this->guests.size(); i <= block_index; ++i) {
 		this->guests.emplace_back();
 		this->guests.back().reset(new Guest[GUEST_BLOCK_SIZE]);
+		this->due_times.emplace_back(new uint32[GUEST_BLOCK_SIZE]());
 		for (int j = 0; j < GUEST_BLOCK_SIZE; ++j) {
 			int id = i * GUEST_BLOCK_SIZE + j;
 			this->guests.back().get()[j].id = id;
@@ -320,6 +466,14 @@ const Guest *Guests::GetExisting(int idx) const
 void Guests::NotifyGuestDeactivation(int idx)
 {
 	assert(idx >= 0 && idx < static_cast<int>(GUEST_BLOCK_SIZE * this->guests.size()));
+	const Guest *g = this->GetExisting(idx);
+	if (g->IsActive()) {
+		this->active_count--;
+		if (g->IsInPark()) {
+			this->in_park_count--;
+			this->park_happiness_sum -= g->happiness;
+		}
+	}
 	this->free_guest_indices.push_back(idx);
 }
 
@@ -341,23 +495,44 @@ void Guests::Complain(const ComplaintType type)
 	assert(type < COMPLAINT_COUNT);
 	Complaint &c = this->complaints[type];
 	c.counter++;
-	if (c.time_since_message > COMPLAINT_TIMEOUT && c.counter >= COMPLAINT_THRESHOLD[type]) {
+	if (this->anim_time >= c.next_message_time && c.counter >= COMPLAINT_THRESHOLD[type]) {
 		c.counter = 0;
-		c.time_since_message = 0;
+		c.next_message_time = this->anim_time + COMPLAINT_TIMEOUT;
 		_inbox.SendMessage(new Message(COMPLAINT_MESSAGES[type]));
 	}
 }
 
+/**
+ * Get the complaint subject that guests currently complain most about.
+ * Counters are weighted by their notification threshold, so rarely voiced but serious
+ * subjects are not drowned out by frequent minor ones.
+ * @return The dominant complaint type, or #COMPLAINT_COUNT when there are no complaints at all.
+ */
+Guests::ComplaintType Guests::GetTopComplaint() const
+{
+	ComplaintType top = COMPLAINT_COUNT;
+	uint32 top_weight = 0;
+	for (int i = 0; i < COMPLAINT_COUNT; i++) {
+		const uint32 weight = 1024u * this->complaints[i].counter / COMPLAINT_THRESHOLD[i];
+		if (weight > top_weight) {
+			top_weight = weight;
+			top = static_cast<ComplaintType>(i);
+		}
+	}
+	return top;
+}
+
 static const uint16 STAFF_BASE_ID = std::numeric_limits<uint16>::max();  // Counting staff IDs backwards to avoid conflicts with %Guests.
 
 /** Remove all staff and reset all variables. */
 void Staff::Uninitialize()
 {
-	this->mechanics.clear();  // Do this first, it may generate new requests.
-	this->handymen.clear();
-	this->guards.clear();
-	this->entertainers.clear();
+	this->mechanics.Clear();  // Do this first, it may generate new requests.
+	this->handymen.Clear();
+	this->guards.Clear();
+	this->entertainers.Clear();
 	this->mechanic_requests.clear();
+	this->dirty_tiles.clear();
 	this->last_person_id = STAFF_BASE_ID;
 }
 
@@ -380,30 +555,24 @@ void Staff::Load(Loader &ldr)
 				this->last_person_id = ldr.GetWord();
 			}
 			for (uint i = ldr.GetLong(); i > 0; i--) {
-				this->mechanic_requests.push_back(_rides_manager.GetRideInstance(ldr.GetWord()));
+				/* Rides are loaded before staff; recover the urgency from the ride itself. */
+				RideInstance *ride = _rides_manager.GetRideInstance(ldr.GetWord());
+				this->InsertMechanicRequest(ride, ride->broken);
 			}
 			if (version >= 2) {
 				for (uint i = ldr.GetLong(); i > 0; i--) {
-					Mechanic *m = new Mechanic;
-					m->Load(ldr);
-					this->mechanics.push_back(std::unique_ptr<Mechanic>(m));
+					this->mechanics.Create()->Load(ldr);
 				}
 			}
 			if (version >= 3) {
 				for (uint i = ldr.GetLong(); i > 0; i--) {
-					Handyman *m = new Handyman;
-					m->Load(ldr);
-					this->handymen.push_back(std::unique_ptr<Handyman>(m));
+					this->handymen.Create()->Load(ldr);
 				}
 				for (uint i = ldr.GetLong(); i > 0; i--) {
-					Guard *m = new Guard;
-					m->Load(ldr);
-					this->guards.push_back(std::unique_ptr<Guard>(m));
+					this->guards.Create()->Load(ldr);
 				}
 				for (uint i = ldr.GetLong(); i > 0; i--) {
-					Entertainer *m = new Entertainer;
-					m->Load(ldr);
-					this->entertainers.push_back(std::unique_ptr<Entertainer>(m));
+					this->entertainers.Create()->Load(ldr);
 				}
 			}
 			break;
@@ -423,15 +592,15 @@ void Staff::Save(Saver &svr)
 	svr.StartPattern("STAF", CURRENT_VERSION_STAF);
 	svr.PutWord(this->last_person_id);
 	svr.PutLong(this->mechanic_requests.size());
-	for (RideInstance *ride : this->mechanic_requests) svr.PutWord(ride->GetIndex());
-	svr.PutLong(this->mechanics.size());
-	for (auto &m : this->mechanics) m->Save(svr);
-	svr.PutLong(this->handymen.size());
-	for (auto &m : this->handymen) m->Save(svr);
-	svr.PutLong(this->guards.size());
-	for (auto &m : this->guards) m->Save(svr);
-	svr.PutLong(this->entertainers.size());
-	for (auto &m : this->entertainers) m->Save(svr);
+	for (const MechanicRequest &req : this->mechanic_requests) svr.PutWord(req.ride->GetIndex());
+	svr.PutLong(this->mechanics.Count());
+	FOR_EACH_ACTIVE_STAFF(this->mechanics, block, m) m->Save(svr);
+	svr.PutLong(this->handymen.Count());
+	FOR_EACH_ACTIVE_STAFF(this->handymen, block, m) m->Save(svr);
+	svr.PutLong(this->guards.Count());
+	FOR_EACH_ACTIVE_STAFF(this->guards, block, m) m->Save(svr);
+	svr.PutLong(this->entertainers.Count());
+	FOR_EACH_ACTIVE_STAFF(this->entertainers, block, m) m->Save(svr);
 	svr.EndPattern();
 }
 
@@ -444,13 +613,89 @@ uint16 Staff::GenerateID()
 	return --last_person_id;
 }
 
+/**
+ * Insert a mechanic call at its position in the dispatch queue.
+ * Breakdowns go before routine inspections; calls of equal urgency are served in order of arrival.
+ * @param ride Ride to inspect or repair.
+ * @param breakdown The ride is broken down.
+ */
+void Staff::InsertMechanicRequest(RideInstance *ride, bool breakdown)
+{
+	auto it = this->mechanic_requests.begin();
+	if (breakdown) {
+		while (it != this->mechanic_requests.end() && it->breakdown) ++it;
+	} else {
+		it = this->mechanic_requests.end();
+	}
+	this->mechanic_requests.insert(it, {ride, breakdown});
+}
+
 /**
  * Request that a mechanic should inspect or repair a ride as soon as possible.
  * @param ride Ride to inspect or repair.
  */
 void Staff::RequestMechanic(RideInstance *ride)
 {
-	mechanic_requests.push_back(ride);
+	this->InsertMechanicRequest(ride, ride->broken);
+}
+
+/**
+ * A ride with a pending inspection call broke down; move its call to the breakdown section of the queue.
+ * Does nothing if the ride has no queued call (for example when a mechanic is already underway).
+ * @param ride Ride that broke down.
+ */
+void Staff::PromoteMechanicRequest(const RideInstance *ride)
+{
+	for (auto it = this->mechanic_requests.begin(); it != this->mechanic_requests.end(); ++it) {
+		if (it->ride != ride) continue;
+		if (it->breakdown) return;  // Already in the breakdown section.
+		RideInstance *ri = it->ride;
+		this->mechanic_requests.erase(it);
+		this->InsertMechanicRequest(ri, true);
+		return;
+	}
+}
+
+/**
+ * Report a tile that got litter or vomit dropped on it, so a handyman can be sent over.
+ * Reporting a tile that is already queued is allowed and does nothing.
+ * @param pos Coordinates of the dirty path tile.
+ */
+void Staff::QueueDirtyTile(const XYZPoint16 &pos)
+{
+	this->dirty_tiles.insert(pos);
+}
+
+/**
+ * A tile was cleaned (or its path removed); drop any pending call for it.
+ * @param pos Coordinates of the cleaned tile.
+ */
+void Staff::DirtyTileCleaned(const XYZPoint16 &pos)
+{
+	this->dirty_tiles.erase(pos);
+}
+
+/**
+ * Claim the queued dirty tile closest to a handyman, removing it from the queue.
+ * The claim is not tracked; a handyman that cannot serve it should re-queue the tile.
+ * @param near_pos Position of the handyman asking for work.
+ * @return Coordinates of the claimed tile, or a negative position if no tile is queued.
+ */
+XYZPoint16 Staff::ClaimDirtyTile(const XYZPoint16 &near_pos)
+{
+	if (this->dirty_tiles.empty()) return XYZPoint16(-1, -1, -1);
+	auto best = this->dirty_tiles.begin();
+	int best_dist = std::numeric_limits<int>::max();
+	for (auto it = this->dirty_tiles.begin(); it != this->dirty_tiles.end(); ++it) {
+		const int dist = abs(it->x - near_pos.x) + abs(it->y - near_pos.y) + abs(it->z - near_pos.z);
+		if (dist < best_dist) {
+			best_dist = dist;
+			best = it;
+		}
+	}
+	const XYZPoint16 pos = *best;
+	this->dirty_tiles.erase(best);
+	return pos;
 }
 
 /**
@@ -469,10 +714,9 @@ static void NameNewStaff(StaffMember *m, StringID text)
  */
 Mechanic *Staff::HireMechanic()
 {
-	Mechanic *m = new Mechanic;
+	Mechanic *m = this->mechanics.Create();
 	m->id = this->GenerateID();
 	m->Activate(Point16(9, 2), PERSON_MECHANIC);  // \todo Allow the player to decide where to put the new mechanic.
-	this->mechanics.push_back(std::unique_ptr<Mechanic>(m));
 	NameNewStaff(m, GUI_STAFF_NAME_MECHANIC);
 	return m;
 }
@@ -483,10 +727,9 @@ Mechanic *Staff::HireMechanic()
  */
 Handyman *Staff::HireHandyman()
 {
-	Handyman *m = new Handyman;
+	Handyman *m = this->handymen.Create();
 	m->id = this->GenerateID();
 	m->Activate(Point16(9, 2), PERSON_HANDYMAN);  // \todo Allow the player to decide where to put the new handyman.
-	this->handymen.push_back(std::unique_ptr<Handyman>(m));
 	NameNewStaff(m, GUI_STAFF_NAME_HANDYMAN);
 	return m;
 }
@@ -497,10 +740,9 @@ Handyman *Staff::HireHandyman()
  */
 Guard *Staff::HireGuard()
 {
-	Guard *m = new Guard;
+	Guard *m = this->guards.Create();
 	m->id = this->GenerateID();
 	m->Activate(Point16(9, 2), PERSON_GUARD);  // \todo Allow the player to decide where to put the new guard.
-	this->guards.push_back(std::unique_ptr<Guard>(m));
 	NameNewStaff(m, GUI_STAFF_NAME_GUARD);
 	return m;
 }
@@ -511,10 +753,9 @@ Guard *Staff::HireGuard()
  */
 Entertainer *Staff::HireEntertainer()
 {
-	Entertainer *m = new Entertainer;
+	Entertainer *m = this->entertainers.Create();
 	m->id = this->GenerateID();
 	m->Activate(Point16(9, 2), PERSON_ENTERTAINER);  // \todo Allow the player to decide where to put the new entertainer.
-	this->entertainers.push_back(std::unique_ptr<Entertainer>(m));
 	NameNewStaff(m, GUI_STAFF_NAME_ENTERTAINER);
 	return m;
 }
@@ -525,7 +766,7 @@ Entertainer *Staff::HireEntertainer()
  */
 uint16 Staff::CountMechanics() const
 {
-	return this->mechanics.size();
+	return this->mechanics.Count();
 }
 
 /**
@@ -534,7 +775,7 @@ uint16 Staff::CountMechanics() const
  */
 uint16 Staff::CountHandymen() const
 {
-	return this->handymen.size();
+	return this->handymen.Count();
 }
 
 /**
@@ -543,7 +784,7 @@ uint16 Staff::CountHandymen() const
  */
 uint16 Staff::CountGuards() const
 {
-	return this->guards.size();
+	return this->guards.Count();
 }
 
 /**
@@ -552,7 +793,7 @@ uint16 Staff::CountGuards() const
  */
 uint16 Staff::CountEntertainers() const
 {
-	return this->entertainers.size();
+	return this->entertainers.Count();
 }
 
 /**
@@ -582,10 +823,28 @@ uint16 Staff::Count(const PersonType t) const
 StaffMember *Staff::Get(const PersonType t, const uint list_index) const
 {
 	switch (t) {
-		case PERSON_MECHANIC:    { auto it = this->mechanics.begin();    std::advance(it, list_index); return it->get(); }
-		case PERSON_HANDYMAN:    { auto it = this->handymen.begin();     std::advance(it, list_index); return it->get(); }
-		case PERSON_GUARD:       { auto it = this->guards.begin();       std::advance(it, list_index); return it->get(); }
-		case PERSON_ENTERTAINER: { auto it = this->entertainers.begin(); std::advance(it, list_index); return it->get(); }
+		case PERSON_MECHANIC:    return this->mechanics.GetListMember(list_index);
+		case PERSON_HANDYMAN:    return this->handymen.GetListMember(list_index);
+		case PERSON_GUARD:       return this->guards.GetListMember(list_index);
+		case PERSON_ENTERTAINER: return this->entertainers.GetListMember(list_index);
+		default: NOT_REACHED();
+	}
+}
+
+/**
+ * Invoke a callback for a range of staff members of given type, in list order.
+ * @param t Type of staff.
+ * @param first List index of the first member to visit.
+ * @param count Number of members to visit (fewer if the list runs out).
+ * @param callback Called with each member and its list index.
+ */
+void Staff::VisitMembers(const PersonType t, const uint first, const uint count, const std::function<void(StaffMember *, uint)> &callback) const
+{
+	switch (t) {
+		case PERSON_MECHANIC:    this->mechanics.VisitListMembers(first, count, callback);    break;
+		case PERSON_HANDYMAN:    this->handymen.VisitListMembers(first, count, callback);     break;
+		case PERSON_GUARD:       this->guards.VisitListMembers(first, count, callback);       break;
+		case PERSON_ENTERTAINER: this->entertainers.VisitListMembers(first, count, callback); break;
 		default: NOT_REACHED();
 	}
 }
@@ -593,47 +852,28 @@ StaffMember *Staff::Get(const PersonType t, const uint list_index) const
 /**
  * Dismiss a staff member from the staff.
  * @param person Person to dismiss.
- * @note Invalidates the pointer.
+ * @note The person is deactivated and the slot becomes available for reuse.
  */
 void Staff::Dismiss(const StaffMember *person)
 {
-	switch (person->type) {
-		case PERSON_MECHANIC:
-			for (auto it = this->mechanics.begin(); it != this->mechanics.end(); it++) {
-				if (it->get() == person) {
-					this->mechanics.erase(it);  // This deletes the mechanic.
-					return;
-				}
-			}
-			break;
-		case PERSON_HANDYMAN:
-			for (auto it = this->handymen.begin(); it != this->handymen.end(); it++) {
-				if (it->get() == person) {
-					this->handymen.erase(it);  // This deletes the handyman.
-					return;
-				}
-			}
-			break;
-		case PERSON_GUARD:
-			for (auto it = this->guards.begin(); it != this->guards.end(); it++) {
-				if (it->get() == person) {
-					this->guards.erase(it);  // This deletes the guard.
-					return;
-				}
-			}
-			break;
-		case PERSON_ENTERTAINER:
-			for (auto it = this->entertainers.begin(); it != this->entertainers.end(); it++) {
-				if (it->get() == person) {
-					this->entertainers.erase(it);  // This deletes the entertainer.
-					return;
-				}
-			}
+	StaffMember *m = const_cast<StaffMember *>(person);  // The pools only hand out non-const members.
+	const PersonType t = m->type;
+	m->DeActivate(OAR_REMOVE);
+	m->ride = nullptr;
+	NotifyChange(WC_PERSON_INFO, m->id, CHG_PERSON_DELETED, 0);
+	NotifyChange(WC_STAFF, ALL_WINDOWS_OF_TYPE, CHG_PERSON_CHANGED, 0);
+	switch (t) {
+		case PERSON_MECHANIC:    this->mechanics.Release(static_cast<Mechanic *>(m));       break;
+		case PERSON_HANDYMAN: {
+			Handyman *h = static_cast<Handyman *>(m);
+			h->ReleaseCleaningClaim();  // Hand a claimed dirty tile back to the queue.
+			this->handymen.Release(h);
 			break;
-
+		}
+		case PERSON_GUARD:       this->guards.Release(static_cast<Guard *>(m));             break;
+		case PERSON_ENTERTAINER: this->entertainers.Release(static_cast<Entertainer *>(m)); break;
 		default: NOT_REACHED();
 	}
-	NOT_REACHED();
 }
 
 /**
@@ -641,7 +881,8 @@ void Staff::Dismiss(const StaffMember *person)
  * @param ri Ride being removed.
  */
 void Staff::NotifyRideDeletion(const RideInstance *ri) {
-	for (auto &m : this->mechanics) m->NotifyRideDeletion(ri);
+	this->mechanic_requests.remove_if([ri](const MechanicRequest &req) { return req.ride == ri; });
+	FOR_EACH_ACTIVE_STAFF(this->mechanics, block, m) m->NotifyRideDeletion(ri);
 }
 
 /**
@@ -650,43 +891,52 @@ void Staff::NotifyRideDeletion(const RideInstance *ri) {
  */
 void Staff::OnAnimate(const int delay)
 {
-	for (auto &m : this->mechanics   ) m->OnAnimate(delay);
-	for (auto &m : this->handymen    ) m->OnAnimate(delay);
-	for (auto &m : this->guards      ) m->OnAnimate(delay);
-	for (auto &m : this->entertainers) m->OnAnimate(delay);
+	FOR_EACH_ACTIVE_STAFF(this->mechanics,    block, m) m->OnAnimate(delay);
+	FOR_EACH_ACTIVE_STAFF(this->handymen,     block, m) m->OnAnimate(delay);
+	FOR_EACH_ACTIVE_STAFF(this->guards,       block, m) m->OnAnimate(delay);
+	FOR_EACH_ACTIVE_STAFF(this->entertainers, block, m) m->OnAnimate(delay);
 }
 
 /** A new frame arrived. */
 void Staff::DoTick()
 {
-	/* Assign one mechanic request to the nearest available mechanic, if any. */
-	if (!this->mechanic_requests.empty() && !this->mechanics.empty()) {
-		EdgeCoordinate destination = this->mechanic_requests.front()->GetMechanicEntrance();
+	/* Assign the most urgent mechanic request to the nearest idle mechanic, if any. */
+	if (!this->mechanic_requests.empty() && this->mechanics.Count() > 0) {
+		bool has_idle = false;
+		FOR_EACH_ACTIVE_STAFF(this->mechanics, block, m) {
+			if (m->ride == nullptr) has_idle = true;
+		}
+		if (!has_idle) return;  // All mechanics are underway, no need to compute routes.
+
+		EdgeCoordinate destination = this->mechanic_requests.front().ride->GetMechanicEntrance();
 		destination.coords.x += _tile_dxy[destination.edge].x;
 		destination.coords.y += _tile_dxy[destination.edge].y;
 
+		/* A single search from all idle mechanics to the entrance finds the nearest one;
+		 * the second attempt covers a path leading to the mechanic entrance that slopes upwards. */
 		Mechanic *best = nullptr;
-		uint32 distance = 0;
-		for (auto &m : this->mechanics) {
-			if (m->ride != nullptr) continue;
-
-			PathSearcher ps(m->vox_pos);
-			XYZPoint16 p(destination.coords);
-			ps.AddStart(p);
-			p.z--;
-			ps.AddStart(p);  // In case the path leading to the mechanic entrance is sloping upwards.
-
-			if (!ps.Search()) continue;  // No path exists.
-			uint32 d = 0;
-			for (const WalkedPosition *it = ps.dest_pos; it->prev_pos != nullptr; it = it->prev_pos) d++;
-
-			if (best == nullptr || d < distance) {
-				best = m.get();
-				distance = d;
+		XYZPoint16 p(destination.coords);
+		for (int attempt = 0; attempt < 2 && best == nullptr; attempt++) {
+			PathSearcher &ps = _path_searcher;
+			ps.Reset(p);
+			bool any_start = false;
+			FOR_EACH_ACTIVE_STAFF(this->mechanics, block, m) {
+				if (m->ride == nullptr && _path_graph.IsConnected(m->vox_pos, p)) {
+					ps.AddStart(m->vox_pos);
+					any_start = true;
+				}
 			}
+			if (any_start && ps.Search(true)) { // Dispatch routes cross the park; meet in the middle.
+				const WalkedPosition *root = ps.dest_pos;
+				while (root->prev_pos != nullptr) root = root->prev_pos;  // The winning start is the nearest mechanic.
+				FOR_EACH_ACTIVE_STAFF(this->mechanics, block, m) {
+					if (best == nullptr && m->ride == nullptr && m->vox_pos == root->cur_vox) best = m;
+				}
+			}
+			p.z--;
 		}
 		if (best != nullptr) {
-			best->Assign(this->mechanic_requests.front());
+			best->Assign(this->mechanic_requests.front().ride);
 			this->mechanic_requests.pop_front();
 		}
 	}
@@ -10,10 +10,15 @@
 #ifndef PEOPLE_H
 #define PEOPLE_H
 
+#include <functional>
 #include <list>
 #include <map>
+#include <set>
 
 #include "person.h"
+#include "time_func.h"
+
+constexpr int GUEST_BLOCK_SIZE = 64;  ///< Number of guests to batch-allocate.
 
 /**
  * All our guests.
@@ -30,6 +35,7 @@ public:
 
 	uint32 CountActiveGuests() const;
 	uint32 CountGuestsInPark() const;
+	uint32 GetParkHappinessSum() const;
 
 	Guest *GetExisting(int idx);
 	const Guest *GetExisting(int idx) const;
@@ -38,9 +44,12 @@ public:
 	void NotifyGuestDeactivation(int idx);
 
 	void OnAnimate(int delay);
-	void DoTick();
+	bool DoTick(const Realtime &deadline);
 	void OnNewDay();
 
+	Guest *SpawnGuest();
+	void WakeGuest(int idx);
+
 	void NotifyRideDeletion(const RideInstance *);
 
 	/** All the things guests like to complain about. */
@@ -55,24 +64,205 @@ public:
 	};
 
 	void Complain(ComplaintType t);
+	ComplaintType GetTopComplaint() const;
+
+	/**
+	 * A guest passed the entrance into the park.
+	 * @param g The guest that entered.
+	 */
+	inline void GuestEnteredPark(const Guest *g)
+	{
+		this->in_park_count++;
+		this->park_happiness_sum += g->happiness;
+	}
+
+	/**
+	 * A guest left the park, or was removed while inside.
+	 * @param g The guest that left.
+	 */
+	inline void GuestLeftPark(const Guest *g)
+	{
+		assert(this->in_park_count > 0);
+		this->in_park_count--;
+		this->park_happiness_sum -= g->happiness;
+	}
+
+	/**
+	 * The happiness of a guest inside the park changed.
+	 * @param delta Change of the guest's happiness.
+	 */
+	inline void ChangeParkHappiness(int delta)
+	{
+		this->park_happiness_sum += delta;
+	}
 
 	Point16 start_voxel;  ///< Entry x/y coordinate of the voxel stack at the edge (negative X/Y coordinate means invalid).
 
 private:
 	Random rnd;           ///< Random number generator for creating new guests.
 	int daily_frac;       ///< Frame counter.
+	uint32 tick_cursor;   ///< Next guest slot to examine in the current #DoTick pass, \c 0 when no pass is suspended.
+	uint32 active_count;  ///< Number of active guests, kept in sync at (de)activation.
+	uint32 in_park_count; ///< Number of active guests inside the park, kept in sync by #Guest::SetActivity.
+	uint32 park_happiness_sum; ///< Summed happiness of all guests inside the park, kept in sync by guest state changes.
 
 	/** Holds statistics about guest complaints of a specific type. */
 	struct Complaint {
 		Complaint();
 
-		uint16 counter;             ///< Counter for the number of complaints.
-		uint32 time_since_message;  ///< Time in milliseconds since a message was last sent to the player.
+		uint16 counter;            ///< Counter for the number of complaints, decayed daily.
+		uint32 next_message_time;  ///< #anim_time stamp from which on a message about this subject may be sent to the player again.
 	};
 	Complaint complaints[COMPLAINT_COUNT];  ///< Statistics about all complaint types.
 
 	std::vector<std::unique_ptr<Guest[]>> guests;  ///< All guest slots.
 	std::vector<int> free_guest_indices;           ///< Unused indices in %guests.
+
+	static const uint WHEEL_BUCKET_COUNT = 256;  ///< Number of buckets in the timing wheel.
+	static const uint WHEEL_GRANULARITY = 32;    ///< Time span of one timing wheel bucket, in milliseconds.
+
+	/** Entry of a timing wheel bucket, denoting when a guest wants to be serviced next. */
+	struct WheelEntry {
+		int guest;  ///< Index of the guest.
+		uint32 due; ///< #anim_time stamp at which the guest needs its next animation frame.
+	};
+
+	uint32 anim_time;  ///< Total animation time that has passed, in milliseconds.
+
+	/**
+	 * Timing wheel with the next service time of every active guest.
+	 * A guest registers its next-due time stamp when it is serviced; ticks then only drain the
+	 * buckets the elapsed interval touches, so dormant guests (queuing, on rides, resting) cost
+	 * nothing at all. Entries are validated lazily against #due_times when their bucket is
+	 * drained; far-future entries that wrapped around the wheel are re-inserted.
+	 */
+	std::vector<WheelEntry> wheel[WHEEL_BUCKET_COUNT];
+
+	/**
+	 * Next service time stamp of each guest, parallel to #guests.
+	 * Authoritative while a guest is active; the guest's own #Person::frame_time is only
+	 * synchronized when the guest is serviced, activated, loaded or saved. A wheel entry whose
+	 * time stamp does not match this array is stale and gets dropped.
+	 */
+	std::vector<std::unique_ptr<uint32[]>> due_times;
+
+	/**
+	 * Access the next service time stamp of a guest slot.
+	 * @param idx Index of the guest.
+	 * @return Reference to the due time stamp of the guest.
+	 */
+	inline uint32 &DueTime(int idx)
+	{
+		return this->due_times[idx / GUEST_BLOCK_SIZE][idx % GUEST_BLOCK_SIZE];
+	}
+
+	void ScheduleGuest(int idx, uint32 due);
+	void EnsureSpawnCapacity();
+};
+
+constexpr int STAFF_BLOCK_SIZE = 16;  ///< Number of staff members to batch-allocate.
+
+/**
+ * Typed pool of staff members of one kind.
+ * Members are stored in blocks of #STAFF_BLOCK_SIZE objects instead of being heap-allocated
+ * individually, so hiring and dismissing staff does not fragment the heap and iteration walks
+ * contiguous memory. Slots are reused after dismissal; a slot address stays stable for as long
+ * as the member is employed.
+ * @tparam T Type of the staff members in the pool.
+ */
+template <typename T>
+class StaffPool {
+public:
+	/** Remove all staff members and their storage from the pool. */
+	void Clear()
+	{
+		this->blocks.clear();
+		this->free_indices.clear();
+	}
+
+	/**
+	 * Get the number of employed staff members in the pool.
+	 * @return Number of active members.
+	 */
+	uint16 Count() const
+	{
+		return this->blocks.size() * STAFF_BLOCK_SIZE - this->free_indices.size();
+	}
+
+	/**
+	 * Claim a free slot for a new staff member.
+	 * The member is not initialized; the caller should activate or load it.
+	 * @return The claimed member.
+	 */
+	T *Create()
+	{
+		if (this->free_indices.empty()) {
+			const int block_index = this->blocks.size();
+			this->blocks.emplace_back(new T[STAFF_BLOCK_SIZE]);
+			for (int j = STAFF_BLOCK_SIZE - 1; j >= 0; j--) this->free_indices.push_back(block_index * STAFF_BLOCK_SIZE + j);
+		}
+		const int idx = this->free_indices.back();
+		this->free_indices.pop_back();
+		return &this->blocks[idx / STAFF_BLOCK_SIZE][idx % STAFF_BLOCK_SIZE];
+	}
+
+	/**
+	 * Get the n-th active staff member of the pool.
+	 * @param list_index Index of the member among the active members.
+	 * @return The member.
+	 */
+	T *GetListMember(uint list_index) const
+	{
+		for (const auto &block : this->blocks) {
+			for (T *m = block.get(); m < block.get() + STAFF_BLOCK_SIZE; ++m) {
+				if (!m->IsActive()) continue;
+				if (list_index == 0) return m;
+				list_index--;
+			}
+		}
+		NOT_REACHED();
+	}
+
+	/**
+	 * Invoke a callback for a range of active staff members, in list order.
+	 * The pool is scanned only once, unlike repeated #GetListMember calls.
+	 * @param first List index of the first member to visit.
+	 * @param count Number of members to visit (fewer if the pool runs out).
+	 * @param callback Called with each member and its list index.
+	 */
+	void VisitListMembers(uint first, uint count, const std::function<void(T *, uint)> &callback) const
+	{
+		uint list_index = 0;
+		for (const auto &block : this->blocks) {
+			for (T *m = block.get(); m < block.get() + STAFF_BLOCK_SIZE; ++m) {
+				if (!m->IsActive()) continue;
+				if (list_index >= first + count) return;
+				if (list_index >= first) callback(m, list_index);
+				list_index++;
+			}
+		}
+	}
+
+	/**
+	 * Release the slot of a dismissed staff member for reuse.
+	 * @param m Member being dismissed (must be deactivated already).
+	 */
+	void Release(T *m)
+	{
+		for (uint i = 0; i < this->blocks.size(); i++) {
+			T *block = this->blocks[i].get();
+			if (m >= block && m < block + STAFF_BLOCK_SIZE) {
+				this->free_indices.push_back(i * STAFF_BLOCK_SIZE + (m - block));
+				return;
+			}
+		}
+		NOT_REACHED();
+	}
+
+	std::vector<std::unique_ptr<T[]>> blocks;  ///< All member slots, in blocks of #STAFF_BLOCK_SIZE.
+
+private:
+	std::vector<int> free_indices;  ///< Unused slot indices in #blocks.
 };
 
 /** All the staff (handymen, mechanics, entertainers, guards) in the park. */
@@ -82,8 +272,13 @@ public:
 	void Uninitialize();
 
 	void RequestMechanic(RideInstance *ride);
+	void PromoteMechanicRequest(const RideInstance *ride);
 	void NotifyRideDeletion(const RideInstance *);
 
+	void QueueDirtyTile(const XYZPoint16 &pos);
+	void DirtyTileCleaned(const XYZPoint16 &pos);
+	XYZPoint16 ClaimDirtyTile(const XYZPoint16 &near_pos);
+
 	Mechanic    *HireMechanic();
 	Handyman    *HireHandyman();
 	Guard       *HireGuard();
@@ -95,6 +290,7 @@ public:
 	uint16 Count(PersonType t) const;
 
 	StaffMember *Get(PersonType t, uint list_index) const;
+	void VisitMembers(PersonType t, uint first, uint count, const std::function<void(StaffMember *, uint)> &callback) const;
 	void Dismiss(const StaffMember* m);
 
 	void OnAnimate(int delay);
@@ -107,13 +303,21 @@ public:
 
 private:
 	uint16 GenerateID();
+	void InsertMechanicRequest(RideInstance *ride, bool breakdown);
+
+	/** A pending call for a mechanic. */
+	struct MechanicRequest {
+		RideInstance *ride;  ///< Ride in need of a mechanic.
+		bool breakdown;      ///< The ride is broken down; breakdowns are served before routine inspections.
+	};
 
-	uint16 last_person_id;                                 ///< ID of the last staff member hired.
-	std::list<RideInstance*> mechanic_requests;            ///< Rides in need of a mechanic.
-	std::list<std::unique_ptr<Mechanic>>    mechanics;     ///< All mechanics    in the park.
-	std::list<std::unique_ptr<Handyman>>    handymen;      ///< All handymen     in the park.
-	std::list<std::unique_ptr<Guard>>       guards;        ///< All guards       in the park.
-	std::list<std::unique_ptr<Entertainer>> entertainers;  ///< All entertainers in the park.
+	uint16 last_person_id;                        ///< ID of the last staff member hired.
+	std::list<MechanicRequest> mechanic_requests; ///< Pending mechanic calls, most urgent call first.
+	std::set<XYZPoint16> dirty_tiles;             ///< Tiles with litter or vomit awaiting a handyman, fed by littering events.
+	StaffPool<Mechanic>    mechanics;            ///< All mechanics    in the park.
+	StaffPool<Handyman>    handymen;             ///< All handymen     in the park.
+	StaffPool<Guard>       guards;               ///< All guards       in the park.
+	StaffPool<Entertainer> entertainers;         ///< All entertainers in the park.
 };
 
 extern Guests _guests;
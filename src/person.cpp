@@ -15,12 +15,14 @@
 #include "sprite_store.h"
 #include "person.h"
 #include "people.h"
+#include "density_map.h"
 #include "fileio.h"
 #include "finances.h"
 #include "gameobserver.h"
 #include "map.h"
 #include "messages.h"
 #include "path_finding.h"
+#include "path_graph.h"
 #include "scenery.h"
 #include "viewport.h"
 #include "weather.h"
@@ -103,7 +105,8 @@ void LoadPRSG(RcdFileReader *rcd_file)
 	}
 }
 
-Person::Person() : rnd(), type(PERSON_INVALID), offset(this->rnd.Uniform(100)), ride(nullptr), status(GUI_PERSON_STATUS_WANDER)
+Person::Person() : rnd(), type(PERSON_INVALID), offset(this->rnd.Uniform(100)), sprite_cache(nullptr), ride(nullptr), status(GUI_PERSON_STATUS_WANDER),
+		queuing_blocked_on(INVALID_PERSON_HANDLE), queuing_waiter(INVALID_PERSON_HANDLE), queue_parked(false)
 {
 }
 
@@ -115,8 +118,19 @@ Person::~Person()
 const ImageData *Person::GetSprite(ViewOrientation orient, int zoom, const Recolouring **recolour) const
 {
 	*recolour = &this->recolour;
-	AnimationType anim_type = this->walk->anim_type;
-	return _sprite_manager.GetSprite(zoom, &SpriteStorage::GetAnimationSprite, anim_type, this->frame_index, this->type, orient);
+	const AnimationType anim_type = this->walk->anim_type;
+	/* Resolving a sprite walks the zoom scales and takes a scaled-variant lookup behind a lock
+	 * in #ImageData::Scale. Most persons show the same frame as last time, keep the result
+	 * until the animation frame or the view changes. */
+	if (this->sprite_cache == nullptr || anim_type != this->cached_anim_type || this->frame_index != this->cached_frame_index ||
+			orient != this->cached_orientation || zoom != this->cached_zoom) {
+		this->sprite_cache = _sprite_manager.GetSprite(zoom, &SpriteStorage::GetAnimationSprite, anim_type, this->frame_index, this->type, orient);
+		this->cached_anim_type = anim_type;
+		this->cached_frame_index = this->frame_index;
+		this->cached_orientation = orient;
+		this->cached_zoom = zoom;
+	}
+	return this->sprite_cache;
 }
 
 /**
@@ -399,13 +413,16 @@ void Person::Activate(const Point16 &start, PersonType person_type)
 	/* Set up the person sprite recolouring table. */
 	const PersonTypeData &person_type_data = GetPersonTypeData(this->type);
 	this->recolour = person_type_data.graphics.MakeRecolouring();
+	this->sprite_cache = nullptr;  // Sprites of the previous occupant of this person slot do not apply.
 
 	/* Set up initial position. */
 	this->vox_pos.x = start.x;
 	this->vox_pos.y = start.y;
 	this->vox_pos.z = _world.GetBaseGroundHeight(start.x, start.y);
 	this->AddSelf(_world.GetCreateVoxel(this->vox_pos, false));
-	this->queuing_blocked_on = nullptr;
+	this->queuing_blocked_on = INVALID_PERSON_HANDLE;
+	this->queuing_waiter = INVALID_PERSON_HANDLE;
+	this->queue_parked = false;
 
 	if (start.x == 0) {
 		this->pix_pos.x = 0;
@@ -829,7 +846,9 @@ void Person::Load(Loader &ldr)
 	if (version < 1 || version > CURRENT_VERSION_Person) ldr.VersionMismatch(version, CURRENT_VERSION_Person);
 	this->VoxelObject::Load(ldr);
 
-	this->queuing_blocked_on = nullptr;  // Will be recalculated later in OnAnimate().
+	this->queuing_blocked_on = INVALID_PERSON_HANDLE;  // Will be recalculated later in OnAnimate().
+	this->queuing_waiter = INVALID_PERSON_HANDLE;      // Restored while the game runs, parked guests re-park after their timeout.
+	this->queue_parked = false;
 
 	this->type = (PersonType)ldr.GetByte();
 	this->offset = ldr.GetWord();
@@ -911,6 +930,83 @@ bool Person::IsLeavingPath() const
 	return false;
 }
 
+/** What a guest finds when leaving a path tile over a given edge. */
+enum ExitKind {
+	EK_NOTHING,  ///< Nothing of interest beyond the edge.
+	EK_PATH,     ///< Another path tile beyond the edge.
+	EK_RIDE,     ///< A visitable ride entrance beyond the edge (possibly at the end of a queue path).
+};
+
+/** Cached classification of one exit edge of a path tile, for steering guests. */
+struct CachedExit {
+	uint32 epoch;         ///< Value of #_exit_cache_epoch when the entry was computed; any other value means stale.
+	ExitKind kind;        ///< What lies beyond the edge.
+	RideInstance *ride;   ///< Ride beyond the edge, if #kind is #EK_RIDE.
+	XYZPoint16 ride_pos;  ///< Voxel position of the ride entrance, if #kind is #EK_RIDE.
+	TileEdge ride_edge;   ///< Edge over which the ride entrance is entered, if #kind is #EK_RIDE.
+};
+
+/** Cached exit classifications of all edges of a path tile. */
+struct CachedTileExits {
+	CachedExit edges[EDGE_COUNT];  ///< Classification of each exit edge.
+};
+
+static std::map<uint32, CachedTileExits> _exit_cache;  ///< Exit classifications of path tiles, indexed by packed voxel coordinate.
+static uint32 _exit_cache_epoch = 1;                   ///< Validity stamp of the #_exit_cache entries.
+
+/**
+ * Invalidate all cached exit classifications of path tiles.
+ * Call whenever paths are added or removed, or a ride is built, deleted, or changes state, so
+ * that guest steering recomputes what lies beyond the path edges.
+ */
+void InvalidateExitDesireCache()
+{
+	_exit_cache_epoch++;
+	if (_exit_cache_epoch == 0) {  // Wrapped around, stale entries could look valid; drop everything.
+		_exit_cache.clear();
+		_exit_cache_epoch = 1;
+	}
+}
+
+/**
+ * Classify what a guest finds beyond an exit edge of a path tile, using the cached answer when available.
+ * The classification only depends on the layout of paths and rides, not on the guest, so it is
+ * computed once per tile edge and reused until #InvalidateExitDesireCache is called.
+ * @param vox_pos Coordinate of the path voxel.
+ * @param exit_edge Exit edge being examined.
+ * @return The (re)validated classification of the edge.
+ */
+static const CachedExit &ClassifyExitForGuest(const XYZPoint16 &vox_pos, TileEdge exit_edge)
+{
+	const uint32 key = ((uint32)(uint16)vox_pos.x << 20) | ((uint32)(uint16)vox_pos.y << 8) | (uint8)vox_pos.z;
+	CachedExit &ce = _exit_cache[key].edges[exit_edge];
+	if (ce.epoch == _exit_cache_epoch) return ce;
+
+	ce.epoch = _exit_cache_epoch;
+	ce.kind = EK_NOTHING;
+	ce.ride = nullptr;
+
+	XYZPoint16 cur_pos = vox_pos;
+	TileEdge edge = exit_edge;
+	if (!TravelQueuePath(&cur_pos, &edge)) return ce;  // Path leads to nowhere.
+	if (PathExistsAtBottomEdge(cur_pos, edge)) {
+		ce.kind = EK_PATH;
+		return ce;
+	}
+
+	RideInstance *ri = RideExistsAtBottom(cur_pos, edge);
+	if (ri == nullptr) return ce;  // No ride here.
+	Point16 dxy = _tile_dxy[edge];
+	const XYZPoint16 ride_pos = cur_pos + XYZPoint16(dxy.x, dxy.y, 0);
+	if (!ri->CanBeVisited(ride_pos, edge)) return ce;  // Ride cannot be entered here.
+
+	ce.kind = EK_RIDE;
+	ce.ride = ri;
+	ce.ride_pos = ride_pos;
+	ce.ride_edge = edge;
+	return ce;
+}
+
 /**
  * Decide whether visiting the exit edge is useful.
  * @param current_edge Edge at the current position.
@@ -923,6 +1019,47 @@ RideVisitDesire Person::ComputeExitDesire(TileEdge current_edge, XYZPoint16 cur_
 {
 	if (current_edge == exit_edge) return RVD_NO_VISIT; // Skip incoming edge (may get added later if no other options exist).
 
+	if (this->IsGuest()) {
+		/* Guests steer from the cached classification; only the checks that depend on the
+		 * guest itself (queue length, wanted ride, desire) are evaluated here. */
+		const CachedExit &ce = ClassifyExitForGuest(cur_pos, exit_edge);
+		switch (ce.kind) {
+			case EK_NOTHING: return RVD_NO_VISIT;  // Path leads to nowhere, or ride cannot be entered.
+			case EK_PATH:    return RVD_NO_RIDE;   // Found a path.
+			case EK_RIDE:    break;
+		}
+		RideInstance *ri = ce.ride;
+
+		/* Check whether the queue is so long that someone is queuing near the tile edge. */
+		XYZPoint32 tile_edge_pix_pos(128, 128, 0);
+		switch (exit_edge) {
+			case EDGE_NE: tile_edge_pix_pos.x =   0; break;
+			case EDGE_NW: tile_edge_pix_pos.y =   0; break;
+			case EDGE_SW: tile_edge_pix_pos.x = 255; break;
+			case EDGE_SE: tile_edge_pix_pos.y = 255; break;
+			default: NOT_REACHED();
+		}
+		if (!this->IsQueuingGuest() && this->GetQueuingGuestNearby(cur_pos, tile_edge_pix_pos, false) != nullptr) {
+			ri->NotifyLongQueue();
+			return RVD_NO_VISIT;
+		}
+
+		if (ri == this->ride) {  // Guest decided before that this shop/ride should be visited.
+			*seen_wanted_ride = true;
+			return RVD_MUST_VISIT;
+		}
+
+		RideVisitDesire rvd = this->WantToVisit(ri, ce.ride_pos, ce.ride_edge);
+		if ((rvd == RVD_MAY_VISIT || rvd == RVD_MUST_VISIT) && this->ride == nullptr) {
+			/* Decided to want to visit one ride, and no wanted ride yet. */
+			// \todo Add a timeout so a guest gets bored waiting for the ride at some point.
+			this->ride = ri;
+			*seen_wanted_ride = true;
+			return RVD_MUST_VISIT;
+		}
+		return rvd;
+	}
+
 	const TileEdge original_exit_edge = exit_edge;
 	const XYZPoint16 original_cur_pos = cur_pos;
 	bool travel = this->WalksOnQueuePaths() || TravelQueuePath(&cur_pos, &exit_edge);
@@ -984,7 +1121,7 @@ void Guest::NotifyRideDeletion(const RideInstance *ri)
 	if (this->ride == ri) {
 		switch (this->activity) {
 			case GA_QUEUING:
-				this->activity = GA_WANDER;
+				this->SetActivity(GA_WANDER);
 				this->ride = nullptr;
 				break;
 
@@ -1012,7 +1149,7 @@ void Guest::ExitRide(RideInstance *ri, TileEdge entry)
 	this->vox_pos.x = exit_pos.x >> 8; this->pix_pos.x = exit_pos.x & 0xff;
 	this->vox_pos.y = exit_pos.y >> 8; this->pix_pos.y = exit_pos.y & 0xff;
 	this->vox_pos.z = exit_pos.z >> 8; this->pix_pos.z = exit_pos.z & 0xff;
-	this->activity = GA_WANDER;
+	this->SetActivity(GA_WANDER);
 	this->AddSelf(_world.GetCreateVoxel(this->vox_pos, false));
 	this->UpdateZPosition();
 	this->DecideMoveDirection();
@@ -1083,14 +1220,28 @@ uint8 Guest::GetExitDirections(const Voxel *v, TileEdge start_edge, bool *seen_w
 	return (shops << 4) | bot_exits;
 }
 
+static std::map<uint32, TileEdge> _park_entry_cache;  ///< Park-entry directions of path tiles, indexed by packed voxel coordinate.
+static uint32 _park_entry_cache_version = 0;          ///< Value of #_path_network_version the #_park_entry_cache entries were computed at.
+
 /**
  * From a junction, find the direction that leads to an entrance of the park.
+ * The answer only depends on the path network and the park border, so it is cached per tile
+ * and shared by all guests standing there, until the path network version moves on.
  * @param pos Current position.
  * @return Edge to go to to go to an entrance of the park, or #INVALID_EDGE if no path could be found.
  */
 static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
 {
-	PathSearcher ps(pos); // Current position is the destination.
+	if (_park_entry_cache_version != _path_network_version) {
+		_park_entry_cache.clear();
+		_park_entry_cache_version = _path_network_version;
+	}
+	const uint32 cache_key = PackPathVoxel(pos);
+	const auto cached = _park_entry_cache.find(cache_key);
+	if (cached != _park_entry_cache.end()) return cached->second;
+
+	PathSearcher &ps = _path_searcher;
+	ps.Reset(pos); // Current position is the destination.
 
 	/* Add path tiles with a connection to outside the park to the initial starting points. */
 	for (int x = 0; x < _world.GetXSize() - 1; x++) {
@@ -1099,7 +1250,7 @@ static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
 			if (vs->owner == OWN_PARK) {
 				if (_world.GetStack(x + 1, y)->owner != OWN_PARK || _world.GetStack(x, y + 1)->owner != OWN_PARK) {
 					int offset = vs->GetBaseGroundOffset();
-					const Voxel *v = vs->voxels[offset].get();
+					const Voxel *v = &vs->voxels[offset];
 					if (HasValidPath(v) && GetImplodedPathSlope(v) < PATH_FLAT_COUNT &&
 							(GetPathExits(v) & ((1 << EDGE_SE) | (1 << EDGE_SW))) != 0) {
 						ps.AddStart(XYZPoint16(x, y, vs->base + offset));
@@ -1109,7 +1260,7 @@ static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
 				vs = _world.GetStack(x + 1, y);
 				if (vs->owner == OWN_PARK) {
 					int offset = vs->GetBaseGroundOffset();
-					const Voxel *v = vs->voxels[offset].get();
+					const Voxel *v = &vs->voxels[offset];
 					if (HasValidPath(v) && GetImplodedPathSlope(v) < PATH_FLAT_COUNT &&
 							(GetPathExits(v) & (1 << EDGE_NE)) != 0) {
 						ps.AddStart(XYZPoint16(x + 1, y, vs->base + offset));
@@ -1119,7 +1270,7 @@ static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
 				vs = _world.GetStack(x, y + 1);
 				if (vs->owner == OWN_PARK) {
 					int offset = vs->GetBaseGroundOffset();
-					const Voxel *v = vs->voxels[offset].get();
+					const Voxel *v = &vs->voxels[offset];
 					if (HasValidPath(v) && GetImplodedPathSlope(v) < PATH_FLAT_COUNT &&
 							(GetPathExits(v) & (1 << EDGE_NW)) != 0) {
 						ps.AddStart(XYZPoint16(x, y + 1, vs->base + offset));
@@ -1128,13 +1279,14 @@ static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
 			}
 		}
 	}
-	if (!ps.Search()) return INVALID_EDGE; // Search failed.
-
-	const WalkedPosition *dest = ps.dest_pos;
-	const WalkedPosition *prev = dest->prev_pos;
-	if (prev == nullptr) return INVALID_EDGE; // Already at tile.
-
-	return GetAdjacentEdge(dest->cur_vox.x, dest->cur_vox.y, prev->cur_vox.x, prev->cur_vox.y);
+	TileEdge result = INVALID_EDGE;  // Stays invalid when the search fails or the tile is already outside.
+	if (ps.Search()) {
+		const WalkedPosition *dest = ps.dest_pos;
+		const WalkedPosition *prev = dest->prev_pos;
+		if (prev != nullptr) result = GetAdjacentEdge(dest->cur_vox.x, dest->cur_vox.y, prev->cur_vox.x, prev->cur_vox.y);
+	}
+	_park_entry_cache[cache_key] = result;  // Failures are worth caching too, they are the expensive case.
+	return result;
 }
 
 /**
@@ -1144,19 +1296,13 @@ static TileEdge GetParkEntryDirection(const XYZPoint16 &pos)
  */
 static TileEdge GetGoHomeDirection(const XYZPoint16 &pos)
 {
-	PathSearcher ps(pos); // Current position is the destination.
-
 	int x = _guests.start_voxel.x;
 	int y = _guests.start_voxel.y;
-	ps.AddStart(XYZPoint16(x, y, _world.GetBaseGroundHeight(x, y)));
+	const XYZPoint16 home(x, y, _world.GetBaseGroundHeight(x, y));
 
-	if (!ps.Search()) return INVALID_EDGE;
-
-	const WalkedPosition *dest = ps.dest_pos;
-	const WalkedPosition *prev = dest->prev_pos;
-	if (prev == nullptr) return INVALID_EDGE; // Already at tile.
-
-	return GetAdjacentEdge(dest->cur_vox.x, dest->cur_vox.y, prev->cur_vox.x, prev->cur_vox.y);
+	/* All departing guests share one flow field towards the exit; reading a direction is a
+	 * single lookup. The field also answers 'unreachable' and 'already there' definitively. */
+	return _exit_flow_field.GetDirection(pos, home);
 }
 
 /**
@@ -1189,6 +1335,8 @@ static int GetDesiredEdgeIndex(TileEdge desired_edge, uint8 exits)
  */
 void Guest::DecideMoveDirection()
 {
+	_density_map.AddCrowd(this->vox_pos);  // Feed the crowd field that steers entertainers.
+
 	const VoxelStack *vs = _world.GetStack(this->vox_pos.x, this->vox_pos.y);
 	const Voxel *v = vs->Get(this->vox_pos.z);
 	TileEdge start_edge = this->GetCurrentEdge(); // Edge the person is currently.
@@ -1196,17 +1344,17 @@ void Guest::DecideMoveDirection()
 
 	if (this->activity == GA_ENTER_PARK && vs->owner == OWN_PARK) {
 		if (!_game_observer.park_open || this->cash < _game_observer.entrance_fee) {
-			this->activity = GA_GO_HOME;
+			this->SetActivity(GA_GO_HOME);
 			allow_return = true;
 		} else {
 			this->cash_spent += _game_observer.entrance_fee;
 			this->cash       -= _game_observer.entrance_fee;
 			_finances_manager.EarnParkTickets(_game_observer.entrance_fee);
-			this->activity = GA_WANDER;
+			this->SetActivity(GA_WANDER);
 		}
 		// Add some happiness?? (Somewhat useless as every guest enters the park. On the other hand, a nice point to configure difficulty level perhaps?)
 	} else if (!_game_observer.park_open && this->activity != GA_GO_HOME) {
-		this->activity = GA_GO_HOME;
+		this->SetActivity(GA_GO_HOME);
 		allow_return = true;
 	}
 
@@ -1230,13 +1378,13 @@ void Guest::DecideMoveDirection()
 	/* Switch between wandering and queuing depending on being on a queue path and having a desired ride. */
 	if (this->activity == GA_WANDER) {
 		if (queue_path && this->ride != nullptr) {
-			this->activity = GA_QUEUING;
+			this->SetActivity(GA_QUEUING);
 		} else {
 			queue_path = false;
 		}
 	} else if (this->activity == GA_QUEUING) {
 		if (this->ride == nullptr) {
-			this->activity = GA_WANDER;
+			this->SetActivity(GA_WANDER);
 			queue_path = false;
 		}
 	}
@@ -1396,12 +1544,19 @@ void Person::DeActivate(AnimateResult ar)
 {
 	if (!this->IsActive()) return;
 
+	if (this->queuing_waiter != INVALID_PERSON_HANDLE) {
+		/* Don't let the guest behind us wait for a person that no longer exists. */
+		_guests.WakeGuest(this->queuing_waiter);
+		this->queuing_waiter = INVALID_PERSON_HANDLE;
+	}
+
 	if (ar == OAR_REMOVE && _world.VoxelExists(this->vox_pos)) {
 		/* If not wandered off-world, remove the person from the voxel person list. */
 		this->RemoveSelf(_world.GetCreateVoxel(this->vox_pos, false));
 	}
 
 	_inbox.NotifyGuestDeletion(this->id);
+	NotifyChange(WC_PERSON_INFO, this->id, CHG_PERSON_DELETED, 0);
 	this->type = PERSON_INVALID;
 	this->name.clear();
 }
@@ -1480,9 +1635,11 @@ AnimateResult Person::InteractWithPathObject([[maybe_unused]] PathObjectInstance
 bool Person::HasCyclicQueuingDependency() const
 {
 	std::set<const Person *> iterated = {this};
-	for (const Person *it = this->queuing_blocked_on; it != nullptr; it = it->queuing_blocked_on) {
+	for (uint16 handle = this->queuing_blocked_on; handle != INVALID_PERSON_HANDLE;) {
+		const Person *it = _guests.GetExisting(handle);
 		if (iterated.count(it) > 0) return true;
 		iterated.insert(it);
+		handle = it->queuing_blocked_on;
 	}
 	return false;
 }
@@ -1495,12 +1652,17 @@ bool Person::HasCyclicQueuingDependency() const
  */
 AnimateResult Person::OnAnimate(int delay)
 {
-	this->queuing_blocked_on = nullptr;
+	this->StorePreviousPosition();  // The renderer interpolates between this tick's position and the next.
+	this->queuing_blocked_on = INVALID_PERSON_HANDLE;
+	this->queue_parked = false;
 	this->frame_time -= delay;
 	if (this->frame_time > 0) return OAR_OK;
 
 	if (this->frames == nullptr || this->frame_count == 0) return OAR_REMOVE;
 
+	/* The person is about to move or change its animation frame. */
+	_world_dirty.MarkObjectColumn(this->vox_pos.x, this->vox_pos.y);
+
 	int16 x_limit = -1;
 	switch (GB(this->walk->limit_type, WLM_X_START, WLM_LIMIT_LENGTH)) {
 		case WLM_MINIMAL: x_limit =   0;                break;
@@ -1521,14 +1683,21 @@ AnimateResult Person::OnAnimate(int delay)
 
 	const AnimationFrame *frame = &this->frames[this->frame_index];
 	if (this->IsQueuingGuest()) {
-		this->queuing_blocked_on = this->GetQueuingGuestNearby(this->vox_pos, this->pix_pos, true);
-		if (this->queuing_blocked_on != nullptr && !this->HasCyclicQueuingDependency()) {
-			/* Freeze in place if we are too close to the person queuing in front of us. */
+		const Person *blocker = this->GetQueuingGuestNearby(this->vox_pos, this->pix_pos, true);
+		this->queuing_blocked_on = (blocker != nullptr) ? blocker->id : INVALID_PERSON_HANDLE;
+		if (blocker != nullptr && !this->HasCyclicQueuingDependency()) {
+			/* Freeze in place if we are too close to the person queuing in front of us.
+			 * Park on the blocker if it has no waiter yet, so we sleep until it moves
+			 * instead of rechecking every animation frame. */
+			if (blocker->queuing_waiter == INVALID_PERSON_HANDLE || blocker->queuing_waiter == this->id) {
+				const_cast<Person *>(blocker)->queuing_waiter = this->id;
+				this->queue_parked = true;
+			}
 			this->frame_time += delay;
 			return OAR_OK;
 		}
 		/* Either there is no one in front of this person, or each person is waiting for the other one to make the first move. */
-		this->queuing_blocked_on = nullptr;
+		this->queuing_blocked_on = INVALID_PERSON_HANDLE;
 	}
 	this->pix_pos.x += frame->dx;
 	this->pix_pos.y += frame->dy;
@@ -1785,6 +1954,22 @@ Guest::Guest()
 Guest::~Guest()
 = default;
 
+/**
+ * Change the activity the guest is performing, keeping the park-level guest aggregates in sync.
+ * @param activity New activity of the guest.
+ */
+void Guest::SetActivity(const GuestActivity activity)
+{
+	const bool was_in_park = this->IsInPark();
+	this->activity = activity;
+	if (this->IsInPark() == was_in_park) return;
+	if (was_in_park) {
+		_guests.GuestLeftPark(this);
+	} else {
+		_guests.GuestEnteredPark(this);
+	}
+}
+
 /** Initialize this guest's ride preferences with random values. */
 void Guest::InitRidePreferences()
 {
@@ -1797,7 +1982,7 @@ void Guest::InitRidePreferences()
 
 void Guest::Activate(const Point16 &start, PersonType person_type)
 {
-	this->activity = GA_ENTER_PARK;
+	this->activity = GA_ENTER_PARK; // Set directly: the slot may hold a stale activity, counting happens at park entry.
 	this->Person::Activate(start, person_type);
 
 	this->happiness = 50 + this->rnd.Uniform(50);
@@ -1949,11 +2134,11 @@ AnimateResult Guest::VisitRideOnAnimate(RideInstance *ri, TileEdge exit_edge)
 {
 	if (ri->CanBeVisited(this->vox_pos, exit_edge) && this->SelectItem(ri) != ITP_NOTHING) {
 		/* All lights are green, let's try to enter the ride. */
-		this->activity = GA_ON_RIDE;
+		this->SetActivity(GA_ON_RIDE);
 		this->ride = ri;
 		const RideEntryResult rer = ri->EnterRide(this->id, this->vox_pos, exit_edge);
 		if (rer == RER_WAIT) {
-			this->activity = GA_QUEUING;
+			this->SetActivity(GA_QUEUING);
 			return OAR_HALT;
 		}
 		if (rer != RER_REFUSED) {
@@ -1964,7 +2149,7 @@ AnimateResult Guest::VisitRideOnAnimate(RideInstance *ri, TileEdge exit_edge)
 
 		/* Could not enter, find another ride. */
 		this->ride = nullptr;
-		this->activity = GA_WANDER;
+		this->SetActivity(GA_WANDER);
 	}
 	return OAR_CONTINUE;
 }
@@ -1997,26 +2182,19 @@ AnimateResult Guest::InteractWithPathObject(PathObjectInstance *obj)
 			obj->SetLeftGuest(edge, this->id);
 			this->pix_pos = _bench_pix_pos[edge][0];
 		}
-		this->activity = GA_RESTING;
+		this->SetActivity(GA_RESTING);
 		this->StartAnimation(_guest_bench[edge]);
 		return OAR_OK;
 	} else if (this->happiness < 40) {
 		/* Smash something up, then keep walking. */
-		for (int8 dx = -2; dx <= 2; dx++) {
-			for (int8 dy = -2; dy <= 2; dy++) {
-				if (!IsVoxelstackInsideWorld(this->vox_pos.x + dx, this->vox_pos.y + dy)) continue;
-				for (int8 dz = -1; dz <= 1; dz++) {
-					const Voxel *vx = _world.GetVoxel(XYZPoint16(this->vox_pos.x + dx, this->vox_pos.y + dy, this->vox_pos.z + dz));
-					if (vx == nullptr) continue;
-					for (VoxelObject *o = vx->voxel_objects; o != nullptr; o = o->next_object) {
-						if (dynamic_cast<Guard*>(o) != nullptr) {
-							/* A security guard is nearby, so no vandalism just yet. */
-							return OAR_CONTINUE;
-						}
-					}
-				}
-			}
-		}
+		Rectangle16 nearby(this->vox_pos.x - 2, this->vox_pos.y - 2, 5, 5);
+		nearby.RestrictTo(0, 0, _world.GetXSize(), _world.GetYSize());
+		bool guard_nearby = false;
+		_voxel_object_index.ForEachInRectangle(nearby, [this, &guard_nearby](VoxelObject *o) {
+			if (guard_nearby || std::abs(o->vox_pos.z - this->vox_pos.z) > 1) return;
+			if (dynamic_cast<Guard*>(o) != nullptr) guard_nearby = true;
+		});
+		if (guard_nearby) return OAR_CONTINUE; // A security guard is nearby, so no vandalism just yet.
 
 		obj->Demolish(edge);
 	}
@@ -2044,7 +2222,7 @@ AnimateResult Guest::ActionAnimationCallback()
 		obj->SetRightGuest(edge, PathObjectType::NO_GUEST_ON_BENCH);
 	}
 
-	this->activity = GA_WANDER;
+	this->SetActivity(GA_WANDER);
 	return OAR_CONTINUE;
 }
 
@@ -2052,7 +2230,7 @@ AnimateResult Guest::ActionAnimationCallback()
 void Guest::ExpelFromBench()
 {
 	assert(this->activity == GA_RESTING);
-	this->activity = GA_WANDER;
+	this->SetActivity(GA_WANDER);
 	this->ChangeHappiness(-10);
 	this->DecideMoveDirection();
 }
@@ -2068,6 +2246,10 @@ void Guest::ChangeHappiness(int16 amount)
 	int16 old_happiness = this->happiness;
 	this->happiness = Clamp(this->happiness + amount, 0, 100);
 	if (amount > 0) this->total_happiness = std::min(1000, this->total_happiness + this->happiness - old_happiness);
+	if (this->happiness != old_happiness) {
+		if (this->IsInPark()) _guests.ChangeParkHappiness(this->happiness - old_happiness);
+		this->NotifyInfoChange();
+	}
 }
 
 /**
@@ -2158,9 +2340,10 @@ bool Guest::DailyUpdate()
 	}
 
 	this->ChangeHappiness(happiness_change);
+	this->NotifyInfoChange();  // Hunger, thirst, waste, and nausea changed above.
 
 	if (this->activity == GA_WANDER && this->happiness <= 10) {
-		this->activity = GA_GO_HOME; // Go home when bored.
+		this->SetActivity(GA_GO_HOME); // Go home when bored.
 	}
 	return true;
 }
@@ -2392,7 +2575,17 @@ std::string Person::GetStatus() const
  */
 void Person::SetStatus(StringID s)
 {
+	if (this->status == s) return;
 	this->status = s;
+	this->NotifyInfoChange();
+}
+
+/** Notify this person's open info window, if any, that the displayed state changed. */
+void Person::NotifyInfoChange() const
+{
+	NotifyChange(WC_PERSON_INFO, this->id, CHG_PERSON_CHANGED, 0);
+	/* The staff management window lists the status of every staff member. */
+	if (!this->IsGuest()) NotifyChange(WC_STAFF, ALL_WINDOWS_OF_TYPE, CHG_PERSON_CHANGED, 0);
 }
 
 bool StaffMember::DailyUpdate()
@@ -2477,20 +2670,73 @@ void StaffMember::DecideMoveDirection()
 	if (walk_count == 0) SB(exits, start_edge, 1, 1);  // No exits: Add 'return' as option.
 
 	const WalkInformation *walks[4]; // Walks that can be done at this tile.
+	TileEdge walk_edges[4];          // Exit edge of each walk.
 	walk_count = 0;
 	for (TileEdge exit_edge = EDGE_BEGIN; exit_edge != EDGE_COUNT; exit_edge++) {
 		if (GB(exits, exit_edge, 1) != 0) {
+			walk_edges[walk_count] = exit_edge;
 			walks[walk_count++] = _walk_path_tile[start_edge][exit_edge];
 		}
 	}
 
-	const WalkInformation *new_walk;
-	if (walk_count == 1) {
-		new_walk = walks[0];
-	} else {
-		new_walk = walks[this->rnd.Uniform(walk_count - 1)];
+	this->StartAnimation(walks[this->SelectWanderExit(walk_edges, walk_count)]);
+}
+
+/**
+ * Select which of the available exits to take while wandering.
+ * @param edges Exit edges that can be taken.
+ * @param count Number of entries in \a edges.
+ * @return Index in \a edges of the exit to take.
+ */
+int StaffMember::SelectWanderExit([[maybe_unused]] const TileEdge *edges, int count)
+{
+	return (count == 1) ? 0 : this->rnd.Uniform(count - 1);
+}
+
+/**
+ * Select the exit leading towards the area with the highest density in the field.
+ * @param pos Current position of the staff member.
+ * @param edges Exit edges that can be taken.
+ * @param count Number of entries in \a edges.
+ * @param litter Maximize the litter density rather than the crowd density.
+ * @param rnd Random number generator for breaking ties.
+ * @return Index in \a edges of the best exit, or \c -1 if the field shows nothing of interest nearby.
+ */
+static int SelectDensestExit(const XYZPoint16 &pos, const TileEdge *edges, int count, bool litter, Random &rnd)
+{
+	static const int LOOKAHEAD = 1 << (DensityMap::CELL_SHIFT - 1);  // Sample half a cell ahead, to peek into the adjacent cell.
+
+	int best[4];
+	int best_count = 0;
+	uint best_density = 0;
+	for (int i = 0; i < count; i++) {
+		const int x = pos.x + _tile_dxy[edges[i]].x * LOOKAHEAD;
+		const int y = pos.y + _tile_dxy[edges[i]].y * LOOKAHEAD;
+		const uint density = litter ? _density_map.GetLitter(x, y) : _density_map.GetCrowd(x, y);
+		if (density > best_density) {
+			best_density = density;
+			best_count = 0;
+		}
+		if (density == best_density) best[best_count++] = i;
 	}
-	this->StartAnimation(new_walk);
+	if (best_density == 0) return -1;
+	return best[(best_count == 1) ? 0 : rnd.Uniform(best_count - 1)];
+}
+
+/* Entertainers seek out the biggest crowds. */
+int Entertainer::SelectWanderExit(const TileEdge *edges, int count)
+{
+	const int best = SelectDensestExit(this->vox_pos, edges, count, false, this->rnd);
+	if (best >= 0) return best;
+	return StaffMember::SelectWanderExit(edges, count);  // No guests nearby, keep wandering.
+}
+
+/* Handymen head for the areas with the most litter. */
+int Handyman::SelectWanderExit(const TileEdge *edges, int count)
+{
+	const int best = SelectDensestExit(this->vox_pos, edges, count, true, this->rnd);
+	if (best >= 0) return best;
+	return StaffMember::SelectWanderExit(edges, count);  // Nothing to sweep nearby, keep wandering.
 }
 
 /* Destructor. */
@@ -2551,12 +2797,36 @@ void Mechanic::DecideMoveDirection()
 	destination.coords.x += _tile_dxy[destination.edge].x;
 	destination.coords.y += _tile_dxy[destination.edge].y;
 
-	PathSearcher ps(this->vox_pos);
+	/* The junction graph answers most route queries without a voxel search. */
+	TileEdge route_edge = _path_graph.GetRouteDirection(this->vox_pos, destination.coords);
+	if (route_edge == INVALID_EDGE) {
+		XYZPoint16 below = destination.coords;
+		below.z--;  // In case the path leading to the mechanic entrance is sloping upwards.
+		route_edge = _path_graph.GetRouteDirection(this->vox_pos, below);
+	}
+	if (route_edge != INVALID_EDGE) {
+		this->SetStatus(GUI_PERSON_STATUS_HEADING_TO_RIDE);
+		this->StartAnimation(_walk_path_tile[this->GetCurrentEdge()][route_edge]);
+		return;
+	}
+
+	/* Fall back to the voxel search; it also covers already standing at the destination. */
+	XYZPoint16 below = destination.coords;
+	below.z--;
+	if (!_path_graph.IsConnected(this->vox_pos, destination.coords) && !_path_graph.IsConnected(this->vox_pos, below)) {
+		/* Definitely unreachable, don't run a search that is doomed to fail. */
+		_staff.RequestMechanic(this->ride);
+		this->ride = nullptr;
+		return StaffMember::DecideMoveDirection();
+	}
+
+	PathSearcher &ps = _path_searcher;
+	ps.Reset(this->vox_pos);
 	ps.AddStart(destination.coords);
 	destination.coords.z--;
 	ps.AddStart(destination.coords);  // In case the path leading to the mechanic entrance is sloping upwards.
 
-	if (!ps.Search()) {
+	if (!ps.Search(true)) { // A mechanic may be anywhere in the park; meet in the middle.
 		/* Could not find a path from our position to the destination ride, probably because no such path exists. */
 		_staff.RequestMechanic(this->ride);
 		this->ride = nullptr;
@@ -2644,10 +2914,22 @@ void Entertainer::Save(Saver &svr)
 }
 
 /* Constructor. */
-Handyman::Handyman() : activity(HandymanActivity::WANDER)
+Handyman::Handyman() : activity(HandymanActivity::WANDER), cleaning_target(-1, -1, -1)
 {
 }
 
+/**
+ * Hand a claimed dirty tile back to the global queue, e.g. when the handyman is dismissed.
+ * Does nothing if the handyman holds no claim.
+ */
+void Handyman::ReleaseCleaningClaim()
+{
+	if (this->cleaning_target.x < 0) return;
+	_staff.QueueDirtyTile(this->cleaning_target);
+	this->cleaning_target = XYZPoint16(-1, -1, -1);
+	if (this->activity == HandymanActivity::HEADING_TO_CLEANING) this->activity = HandymanActivity::WANDER;
+}
+
 void Handyman::Load(Loader &ldr)
 {
 	const uint32 version = ldr.OpenPattern("hndy");
@@ -2687,6 +2969,12 @@ void Handyman::DecideMoveDirection()
 		return;
 	}
 
+	if (this->activity == HandymanActivity::HEADING_TO_CLEANING && this->vox_pos == this->cleaning_target) {
+		/* Arrived at the claimed dirty tile; the regular sweep check below takes over. */
+		this->activity = HandymanActivity::WANDER;
+		this->cleaning_target = XYZPoint16(-1, -1, -1);
+	}
+
 	const Voxel *vx = _world.GetVoxel(this->vox_pos);
 	const bool is_on_path = HasValidPath(vx);
 	if (is_on_path && _scenery.CountLitterAndVomit(this->vox_pos) > 0) {
@@ -2749,7 +3037,7 @@ void Handyman::DecideMoveDirection()
 		const Voxel *voxel = _world.GetVoxel(pos);
 		if (voxel == nullptr) continue;
 
-		if (voxel->instance != SRI_SCENERY || voxel->instance_data == INVALID_VOXEL_DATA) continue;  // No flowers here.
+		if (voxel->GetInstance() != SRI_SCENERY || voxel->instance_data == INVALID_VOXEL_DATA) continue;  // No flowers here.
 		if (_world.GetTileOwner(pos.x, pos.y) != OWN_PARK) continue;                                 // Not our responsibility.
 
 		const SceneryType *type = _scenery.GetType(voxel->instance_data);
@@ -2782,6 +3070,24 @@ void Handyman::DecideMoveDirection()
 		return;
 	}
 
+	/* Nothing to do here; head for the nearest reported dirty tile, if any. */
+	if (this->activity == HandymanActivity::WANDER || this->activity == HandymanActivity::HEADING_TO_CLEANING) {
+		if (this->cleaning_target.x < 0) this->cleaning_target = _staff.ClaimDirtyTile(this->vox_pos);
+		if (this->cleaning_target.x >= 0) {
+			const TileEdge route_edge = _path_graph.GetRouteDirection(this->vox_pos, this->cleaning_target);
+			if (route_edge != INVALID_EDGE) {
+				this->activity = HandymanActivity::HEADING_TO_CLEANING;
+				this->SetStatus(GUI_PERSON_STATUS_SWEEPING);
+				this->StartAnimation(_walk_path_tile[start_edge][route_edge]);
+				return;
+			}
+			/* The tile is not reachable from here; hand it back and wander on. */
+			_staff.QueueDirtyTile(this->cleaning_target);
+			this->cleaning_target = XYZPoint16(-1, -1, -1);
+			this->activity = HandymanActivity::WANDER;
+		}
+	}
+
 	return StaffMember::DecideMoveDirection();
 }
 
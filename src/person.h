@@ -89,6 +89,8 @@ enum RideVisitDesire {
 	RVD_MUST_VISIT, ///< Person wants to visit the ride.
 };
 
+static const uint16 INVALID_PERSON_HANDLE = 0xFFFF;  ///< Handle denoting the absence of a person (#Person::id never takes this value).
+
 /**
  * Class of a person in the world.
  *
@@ -141,6 +143,7 @@ public:
 	void SetName(const std::string &name);
 	std::string GetName() const;
 	std::string GetStatus() const;
+	void NotifyInfoChange() const;
 
 protected:
 	Random rnd; ///< Random number generator for deciding how the person reacts.
@@ -150,18 +153,51 @@ public:
 	PersonType type; ///< Type of person.
 	int16 offset;    ///< Offset with respect to centre of paths walked on (0..100).
 
+	/**
+	 * Get the guest parked behind this person in a ride queue, waiting for it to move.
+	 * @return Handle (#id) of the waiting guest, or #INVALID_PERSON_HANDLE if none.
+	 */
+	inline uint16 GetQueueWaiter() const
+	{
+		return this->queuing_waiter;
+	}
+
+	/** Forget the guest parked behind this person (after waking it). */
+	inline void ClearQueueWaiter()
+	{
+		this->queuing_waiter = INVALID_PERSON_HANDLE;
+	}
+
+	/**
+	 * Did this person park itself behind a queuing guest in the last animation update?
+	 * @return Whether the person sleeps until woken (or until a safety timeout).
+	 */
+	inline bool IsQueueParked() const
+	{
+		return this->queue_parked;
+	}
+
 	const WalkInformation *walk;  ///< Walk animation sequence being performed.
 	const AnimationFrame *frames; ///< Animation frames of the current animation.
 	uint16 frame_count;           ///< Number of frames in #frames.
 	uint16 frame_index;           ///< Currently displayed frame of #frames.
 	int16 frame_time;             ///< Remaining display time of this frame.
+
+	mutable const ImageData *sprite_cache;   ///< Sprite last resolved by #GetSprite, \c nullptr if none was resolved yet.
+	mutable AnimationType cached_anim_type;  ///< Animation type #sprite_cache was resolved for.
+	mutable uint16 cached_frame_index;       ///< Frame index #sprite_cache was resolved for.
+	mutable uint8 cached_orientation;        ///< View orientation #sprite_cache was resolved for.
+	mutable uint8 cached_zoom;               ///< Zoom scale #sprite_cache was resolved for.
+
 	Recolouring recolour;         ///< Person recolouring.
 	RideInstance *ride;           ///< The ride we're intending to interact with, if any.
 
 protected:
 	std::string name; ///< Name of the person. \c "" means it has a default name (like "Guest XYZ").
 	StringID status;  ///< What the person is doing right now, for display in the GUI.
-	const Person *queuing_blocked_on;  ///< The person standing before this one in the queue, if this is a queuing guest.
+	uint16 queuing_blocked_on;  ///< Handle (#id) of the guest standing before this one in the queue, #INVALID_PERSON_HANDLE if none. Only used by queuing guests.
+	uint16 queuing_waiter;      ///< Handle (#id) of the guest parked behind this one, to wake when this person moves. Not saved, restored while the game runs.
+	bool queue_parked;          ///< The person parked itself behind #queuing_blocked_on and sleeps until woken (or a safety timeout).
 
 	TileEdge GetCurrentEdge() const;
 	uint8 GetInparkDirections();
@@ -220,6 +256,7 @@ public:
 	bool DailyUpdate() override;
 	AnimateResult ActionAnimationCallback() override;
 
+	void SetActivity(GuestActivity activity);
 	void ChangeHappiness(int16 amount);
 	ItemType SelectItem(const RideInstance *ri);
 	void BuyItem(RideInstance *ri);
@@ -286,6 +323,9 @@ public:
 	RideVisitDesire WantToVisit(const RideInstance *ri, const XYZPoint16 &ride_pos, TileEdge exit_edge) override;
 
 	static const std::map<PersonType, Money> SALARY;   ///< The monthly salary for each staff member.
+
+protected:
+	virtual int SelectWanderExit(const TileEdge *edges, int count);
 };
 
 /** A mechanic who can repair and inspect rides. */
@@ -347,6 +387,9 @@ public:
 	{
 		return true;
 	}
+
+protected:
+	int SelectWanderExit(const TileEdge *edges, int count) override;
 };
 
 /** A handyman who walks around the park and waters the flowerbeds, empties the litter bins and sweeps the paths. */
@@ -363,6 +406,7 @@ public:
 		EMPTY_NW,  ///< Emptying the bin on the north-west edge of the current tile.
 		HEADING_TO_WATERING,  ///< Currently walking to a flowerbed in need of watering.
 		LOOKING_FOR_PATH,     ///< Trying to get back onto a path.
+		HEADING_TO_CLEANING,  ///< Currently walking to a queued dirty tile.
 	};
 
 	Handyman();
@@ -374,12 +418,19 @@ public:
 	AnimateResult ActionAnimationCallback() override;
 	bool IsLeavingPath() const override;
 	AnimateResult InteractWithPathObject(PathObjectInstance *obj) override;
+	void ReleaseCleaningClaim();
 	bool WalksOnQueuePaths() const override
 	{
 		return true;
 	}
 
 	HandymanActivity activity;  ///< What the handyman is doing right now.
+	XYZPoint16 cleaning_target; ///< Claimed dirty tile the handyman is heading to (negative coordinates if none).
+
+protected:
+	int SelectWanderExit(const TileEdge *edges, int count) override;
 };
 
+void InvalidateExitDesireCache();
+
 #endif
@@ -74,6 +74,16 @@ public:
 	GuestInfoWindow(const Guest *guest);
 
 	void SetWidgetStringParameters(WidgetNumber wid_num) const override;
+	void OnChange(ChangeCode code, uint32 parameter) override;
+
+	/**
+	 * The guest publishes a #CHG_PERSON_CHANGED event whenever its displayed state changes.
+	 * @return The window needs no per-frame repaint.
+	 */
+	bool DisplaysGameState() const override
+	{
+		return false;
+	}
 
 private:
 	const Guest *guest; ///< The guest getting looked at by this window.
@@ -135,6 +145,17 @@ void GuestInfoWindow::SetWidgetStringParameters(WidgetNumber wid_num) const
 	}
 }
 
+void GuestInfoWindow::OnChange(ChangeCode code, [[maybe_unused]] uint32 parameter)
+{
+	switch (code) {
+		case CHG_PERSON_DELETED:
+			delete this;
+			break;
+		default:
+			break;  // #NotifyChange already marked the window dirty.
+	}
+}
+
 /** Widgets of the staff info window. */
 enum StaffInfoWidgets {
 	SIW_TITLEBAR,     ///< Title bar widget.
@@ -167,6 +188,15 @@ public:
 	void OnChange(ChangeCode code, uint32 parameter) override;
 	void OnClick(WidgetNumber number, const Point16 &pos) override;
 
+	/**
+	 * The staff member publishes a #CHG_PERSON_CHANGED event whenever its displayed state changes.
+	 * @return The window needs no per-frame repaint.
+	 */
+	bool DisplaysGameState() const override
+	{
+		return false;
+	}
+
 private:
 	const StaffMember *person;  ///< The person getting looked at by this window.
 };
@@ -0,0 +1,305 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file profiler.cpp Per-frame zone timing and the profiler window. */
+
+#include "stdafx.h"
+#include "alloc_tracking.h"
+#include "profiler.h"
+#include "window.h"
+#include "viewport.h"
+#include "language.h"
+#include "string_func.h"
+#include "gamecontrol.h"
+#include "ride_type.h"
+#include "sprite_data.h"
+#include "video.h"
+#include "gui_sprites.h"
+
+#include <algorithm>
+
+Profiler _profiler;  ///< The profiler of the program.
+
+/** Names of the profiled zones, in #ProfiledZone order. */
+static const char *_zone_names[PFZ_COUNT] = {
+	"guests tick",
+	"staff tick",
+	"observer",
+	"guests animate",
+	"staff animate",
+	"rides animate",
+	"scenery animate",
+	"density animate",
+	"voxel collect",
+	"blit",
+	"present",
+};
+
+/**
+ * Get the display name of a profiled zone.
+ * @param zone Zone to name.
+ * @return The name of the zone.
+ */
+const char *ProfiledZoneName(ProfiledZone zone)
+{
+	return _zone_names[zone];
+}
+
+Profiler::Profiler() : enabled(false), trace_file(nullptr)
+{
+	this->Reset();
+}
+
+/** Drop all recorded measurements and start a fresh frame. */
+void Profiler::Reset()
+{
+	std::fill_n(this->current, static_cast<int>(PFZ_COUNT), 0.0);
+	this->next = 0;
+	this->count = 0;
+}
+
+/**
+ * Close the frame in progress: store its zone times in the sample history and
+ * start accumulating the next frame. Called once per rendered frame.
+ */
+void Profiler::EndFrame()
+{
+	if (this->trace_file != nullptr) {
+		/* Instant event marking the frame boundary in the trace. */
+		fprintf(this->trace_file, "{\"name\":\"frame\",\"ph\":\"i\",\"ts\":%.1f,\"pid\":1,\"tid\":1,\"s\":\"t\"},\n", Delta(this->trace_start) * 1000.0);
+		/* Counter event tracking the allocated bytes per subsystem. */
+		fprintf(this->trace_file, "{\"name\":\"allocated_bytes\",\"ph\":\"C\",\"ts\":%.1f,\"pid\":1,\"tid\":1,\"args\":{", Delta(this->trace_start) * 1000.0);
+		for (int tag = 0; tag < ALT_COUNT; tag++) {
+			const AllocationTag alt = static_cast<AllocationTag>(tag);
+			fprintf(this->trace_file, "%s\"%s\":%llu", tag == 0 ? "" : ",",
+					AllocationTagName(alt), static_cast<unsigned long long>(GetTagAllocationStats(alt).bytes));
+		}
+		fputs("}},\n", this->trace_file);
+	}
+	if (!this->enabled) return;
+	for (int zone = 0; zone < PFZ_COUNT; zone++) {
+		this->samples[zone][this->next] = this->current[zone];
+		this->current[zone] = 0.0;
+	}
+	this->next = (this->next + 1) % PROFILE_HISTORY_LENGTH;
+	this->count = std::min(this->count + 1, PROFILE_HISTORY_LENGTH);
+}
+
+/**
+ * Compute a percentile of the recorded frame times of a zone.
+ * @param zone Zone to query.
+ * @param fraction Percentile to compute, between \c 0.0 and \c 1.0.
+ * @return Frame time at the percentile, in milliseconds (\c 0.0 without samples).
+ */
+double Profiler::Percentile(ProfiledZone zone, double fraction) const
+{
+	if (this->count == 0) return 0.0;
+	double sorted[PROFILE_HISTORY_LENGTH];
+	std::copy_n(this->samples[zone], this->count, sorted);
+	const uint index = std::min(this->count - 1, static_cast<uint>(fraction * this->count));
+	std::nth_element(sorted, sorted + index, sorted + this->count);
+	return sorted[index];
+}
+
+/**
+ * Get the worst recorded frame time of a zone.
+ * @param zone Zone to query.
+ * @return Worst frame time, in milliseconds (\c 0.0 without samples).
+ */
+double Profiler::Maximum(ProfiledZone zone) const
+{
+	if (this->count == 0) return 0.0;
+	return *std::max_element(this->samples[zone], this->samples[zone] + this->count);
+}
+
+/**
+ * Start recording all zone measurements to a trace file in the chrome://tracing
+ * JSON format, for offline inspection in a trace viewer. Recording runs until
+ * #StopTrace at program exit.
+ * @param path File to write the trace to.
+ */
+void Profiler::StartTrace(const std::string &path)
+{
+	assert(this->trace_file == nullptr);
+	this->trace_file = fopen(path.c_str(), "wt");
+	if (this->trace_file == nullptr) {
+		fprintf(stderr, "Could not open trace file '%s' for writing.\n", path.c_str());
+		return;
+	}
+	this->trace_start = Time();
+	fputs("[\n", this->trace_file);
+}
+
+/** Finish and close the trace recording, if one is running. */
+void Profiler::StopTrace()
+{
+	if (this->trace_file == nullptr) return;
+	fputs("{}]\n", this->trace_file);
+	fclose(this->trace_file);
+	this->trace_file = nullptr;
+}
+
+/**
+ * Append one complete ('X') event to the trace recording.
+ * @param zone Zone the time was spent in.
+ * @param start Start of the measurement.
+ * @param ms Measured time, in milliseconds.
+ */
+void Profiler::TraceEvent(ProfiledZone zone, const Realtime &start, double ms)
+{
+	fprintf(this->trace_file, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.1f,\"dur\":%.1f,\"pid\":1,\"tid\":1},\n",
+			_zone_names[zone], Delta(this->trace_start, start) * 1000.0, ms * 1000.0);
+}
+
+/**
+ * %Window showing rolling per-frame timing statistics of the profiled zones.
+ * The profiler only records measurements while this window is open.
+ * @ingroup gui_group
+ */
+class ProfilerWindow : public GuiWindow {
+public:
+	ProfilerWindow();
+	~ProfilerWindow();
+
+	void SetWidgetStringParameters(WidgetNumber wid_num) const override;
+	void UpdateWidgetSize(WidgetNumber wid_num, BaseWidget *wid) override;
+	void DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const override;
+};
+
+/**
+ * Widget numbers of the profiler window.
+ * @ingroup gui_group
+ */
+enum ProfilerWidgets {
+	PRF_TITLEBAR,  ///< Titlebar widget.
+	PRF_ZONES,     ///< Zone statistics display.
+};
+
+static const int PROFILER_BAR_WIDTH = 120;  ///< Width of the timing bar column, in pixels.
+static const int PROFILER_SPACING   =   4;  ///< Horizontal space between the columns, in pixels.
+
+/**
+ * Widget parts of the profiler window.
+ * @ingroup gui_group
+ */
+static const WidgetPart _profiler_gui_parts[] = {
+	Intermediate(0, 1),
+		Intermediate(1, 0),
+			Widget(WT_TITLEBAR, PRF_TITLEBAR, COL_RANGE_GREY), SetData(STR_ARG1, GUI_TITLEBAR_TIP),
+			Widget(WT_CLOSEBOX, INVALID_WIDGET_INDEX, COL_RANGE_GREY),
+		EndContainer(),
+		Widget(WT_PANEL, INVALID_WIDGET_INDEX, COL_RANGE_GREY),
+			Widget(WT_EMPTY, PRF_ZONES, COL_RANGE_GREY), SetPadding(2, 2, 2, 2),
+	EndContainer(),
+};
+
+ProfilerWindow::ProfilerWindow() : GuiWindow(WC_PROFILER, ALL_WINDOWS_OF_TYPE)
+{
+	this->SetupWidgetTree(_profiler_gui_parts, lengthof(_profiler_gui_parts));
+	_profiler.Reset();
+	_profiler.enabled = true;
+}
+
+ProfilerWindow::~ProfilerWindow()
+{
+	_profiler.enabled = false;
+}
+
+void ProfilerWindow::SetWidgetStringParameters(WidgetNumber wid_num) const
+{
+	switch (wid_num) {
+		case PRF_TITLEBAR:
+			/* The profiler is only interesting for developers, no need to make it translatable. */
+			_str_params.SetText(1, "Profiler");
+			break;
+
+		default: break;
+	}
+}
+
+void ProfilerWindow::UpdateWidgetSize(WidgetNumber wid_num, BaseWidget *wid)
+{
+	if (wid_num != PRF_ZONES) return;
+
+	int name_width = 0;
+	for (const char *name : _zone_names) {
+		int width, height;
+		_video.GetTextSize(name, &width, &height);
+		name_width = std::max(name_width, width);
+	}
+	int stats_width, stats_height;
+	_video.GetTextSize("999.9 / 999.9 / 999.9 ms", &stats_width, &stats_height);
+
+	wid->min_x = name_width + PROFILER_SPACING + PROFILER_BAR_WIDTH + PROFILER_SPACING + stats_width;
+	wid->min_y = (PFZ_COUNT + 1 + ALT_COUNT + 2) * GetTextHeight();
+}
+
+void ProfilerWindow::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const
+{
+	if (wid_num != PRF_ZONES) return GuiWindow::DrawWidget(wid_num, wid);
+
+	const int base_x = this->GetWidgetScreenX(wid);
+	int y = this->GetWidgetScreenY(wid);
+	const int row_height = GetTextHeight();
+
+	int stats_width, stats_height;
+	_video.GetTextSize("999.9 / 999.9 / 999.9 ms", &stats_width, &stats_height);
+	const int stats_x = base_x + wid->pos.width - stats_width;
+	const int bar_x = stats_x - PROFILER_SPACING - PROFILER_BAR_WIDTH;
+
+	/* The profiler is only interesting for developers, no need to make it translatable. */
+	_video.BlitText("p50 / p95 / max", _palette[TEXT_BLACK], stats_x, y);
+	y += row_height;
+
+	for (int zone = 0; zone < PFZ_COUNT; zone++) {
+		const ProfiledZone pfz = static_cast<ProfiledZone>(zone);
+		const double p50 = _profiler.Percentile(pfz, 0.50);
+		const double p95 = _profiler.Percentile(pfz, 0.95);
+		const double max = _profiler.Maximum(pfz);
+
+		_video.BlitText(_zone_names[zone], _palette[TEXT_BLACK], base_x, y);
+
+		/* Bar length scales with the 95th percentile; one full bar is one simulation tick. */
+		const int bar_length = std::min<int>(PROFILER_BAR_WIDTH, PROFILER_BAR_WIDTH * p95 / SIMULATION_TICK_MS);
+		const uint32 bar_colour = (p95 > SIMULATION_TICK_MS / 2.0) ? MakeRGBA(180, 40, 40, OPAQUE) : MakeRGBA(40, 140, 40, OPAQUE);
+		_video.FillRectangle(Rectangle32(bar_x, y + 1, PROFILER_BAR_WIDTH, row_height - 2), MakeRGBA(0, 0, 0, OPAQUE));
+		if (bar_length > 0) _video.FillRectangle(Rectangle32(bar_x, y + 1, bar_length, row_height - 2), bar_colour);
+
+		_video.BlitText(Format("%5.1f / %5.1f / %5.1f ms", p50, p95, max), _palette[TEXT_BLACK], stats_x, y);
+		y += row_height;
+	}
+
+	y += row_height;  // Blank separator before the allocation counters.
+	for (int tag = 0; tag < ALT_COUNT; tag++) {
+		const AllocationTag alt = static_cast<AllocationTag>(tag);
+		const TagAllocationStats stats = GetTagAllocationStats(alt);
+		_video.BlitText(Format("alloc %s", AllocationTagName(alt)), _palette[TEXT_BLACK], base_x, y);
+		_video.BlitText(Format("%llu allocs, %.1f MB", static_cast<unsigned long long>(stats.count), stats.bytes / 1048576.0),
+				_palette[TEXT_BLACK], base_x, y, wid->pos.width, ALG_RIGHT);
+		y += row_height;
+	}
+
+	/* Pressure on the sprite memory budget, i.e. how full the evictable sprite caches are. */
+	const double cached_mb = (_video.TextureCacheBytes() + _image_variants.CacheBytes()) / 1048576.0;
+	_video.BlitText("sprite caches", _palette[TEXT_BLACK], base_x, y);
+	if (_sprite_memory_budget == 0) {
+		_video.BlitText(Format("%.1f MB, no budget", cached_mb), _palette[TEXT_BLACK], base_x, y, wid->pos.width, ALG_RIGHT);
+	} else {
+		_video.BlitText(Format("%.1f / %.1f MB", cached_mb, _sprite_memory_budget / 1048576.0),
+				_palette[TEXT_BLACK], base_x, y, wid->pos.width, ALG_RIGHT);
+	}
+}
+
+/**
+ * Open the profiler window.
+ * @ingroup gui_group
+ */
+void ShowProfilerWindow()
+{
+	if (HighlightWindowByType(WC_PROFILER, ALL_WINDOWS_OF_TYPE) != nullptr) return;
+	new ProfilerWindow;
+}
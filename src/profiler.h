@@ -0,0 +1,125 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file profiler.h Per-frame zone timing for the profiler window. */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "stdafx.h"
+#include "time_func.h"
+
+/**
+ * Profiled zones of one frame.
+ * The first #PFZ_RENDER_BEGIN entries mirror the simulation subsystems of the
+ * frame budget scheduler in gamecontrol.cpp, in the same order; the remaining
+ * zones cover the render pipeline.
+ */
+enum ProfiledZone {
+	PFZ_GUESTS_TICK,      ///< Daily guest updates.
+	PFZ_STAFF_TICK,       ///< Daily staff updates.
+	PFZ_OBSERVER,         ///< Date handling and game observer.
+	PFZ_GUESTS_ANIMATE,   ///< Guest movement.
+	PFZ_STAFF_ANIMATE,    ///< Staff movement.
+	PFZ_RIDES_ANIMATE,    ///< Ride animation.
+	PFZ_SCENERY_ANIMATE,  ///< Scenery animation.
+	PFZ_DENSITY_ANIMATE,  ///< Density map maintenance.
+
+	PFZ_VOXEL_COLLECT,    ///< Collecting sprites from the voxel world.
+	PFZ_BLIT,             ///< Blitting the collected viewport sprites.
+	PFZ_PRESENT,          ///< Flushing the blit batch and swapping buffers.
+
+	PFZ_COUNT,            ///< Number of profiled zones.
+
+	PFZ_RENDER_BEGIN = PFZ_VOXEL_COLLECT,  ///< First zone that is not a simulation subsystem.
+};
+
+static const uint PROFILE_HISTORY_LENGTH = 128;  ///< Number of frames kept per zone for computing percentiles.
+
+const char *ProfiledZoneName(ProfiledZone zone);
+
+/**
+ * Collector of per-frame zone times.
+ * Measurements are only recorded while the profiler window is open (#enabled)
+ * or a trace recording runs; an idle profiler costs one branch per annotation.
+ */
+class Profiler {
+public:
+	Profiler();
+
+	/**
+	 * Record a measurement of a zone in the current frame.
+	 * @param zone Zone the time was spent in.
+	 * @param start Start of the measurement.
+	 * @param ms Measured time, in milliseconds.
+	 */
+	inline void Record(ProfiledZone zone, const Realtime &start, double ms)
+	{
+		if (this->enabled) this->current[zone] += ms;
+		if (this->trace_file != nullptr) this->TraceEvent(zone, start, ms);
+	}
+
+	/**
+	 * Whether any measurement sink (live window or trace recording) is active.
+	 * @return Measurements are currently being recorded.
+	 */
+	inline bool Measuring() const
+	{
+		return this->enabled || this->trace_file != nullptr;
+	}
+
+	void Reset();
+	void EndFrame();
+	double Percentile(ProfiledZone zone, double fraction) const;
+	double Maximum(ProfiledZone zone) const;
+
+	void StartTrace(const std::string &path);
+	void StopTrace();
+
+	bool enabled;  ///< The live statistics are being recorded; managed by the profiler window.
+
+private:
+	void TraceEvent(ProfiledZone zone, const Realtime &start, double ms);
+
+	double current[PFZ_COUNT];  ///< Accumulated zone times of the frame in progress, in milliseconds.
+	double samples[PFZ_COUNT][PROFILE_HISTORY_LENGTH];  ///< Ring of completed frame times per zone, in milliseconds.
+	uint next;   ///< Ring index in #samples to store the next completed frame at.
+	uint count;  ///< Number of valid frames in #samples.
+
+	FILE *trace_file;      ///< Open trace recording, \c nullptr when not tracing.
+	Realtime trace_start;  ///< Start of the trace recording, origin of its timestamps.
+};
+
+extern Profiler _profiler;
+
+/**
+ * Scope guard adding its own lifetime to a profiled zone.
+ * Declare one at the top of the block to measure.
+ */
+class ZoneTimer {
+public:
+	/**
+	 * Start timing a zone.
+	 * @param zone Zone to account the elapsed time to.
+	 */
+	explicit ZoneTimer(ProfiledZone zone) : zone(zone), measuring(_profiler.Measuring())
+	{
+		if (this->measuring) this->start = Time();
+	}
+
+	~ZoneTimer()
+	{
+		if (this->measuring) _profiler.Record(this->zone, this->start, Delta(this->start));
+	}
+
+private:
+	const ProfiledZone zone;  ///< Zone being timed.
+	const bool measuring;     ///< The profiler was measuring when the timer started.
+	Realtime start;           ///< Start of the measurement, only valid if #measuring is set.
+};
+
+#endif
@@ -22,12 +22,30 @@ void Random::Initialize()
 	seed = static_cast<uint64>(seed) * seed % 0x100000000;
 }
 
+/**
+ * Get the current seed of the generators, for capturing reproducible sessions.
+ * @return The current seed.
+ */
+uint32 Random::GetSeed()
+{
+	return seed;
+}
+
+/**
+ * Restore a previously captured seed, making the upcoming draws reproducible.
+ * @param new_seed The seed to continue from.
+ */
+void Random::SetSeed(uint32 new_seed)
+{
+	seed = new_seed;
+}
+
 /**
  * See whether we are lucky.
  * @param upper Upper bound on the value (exclusive), between \c 0 and \c 1024.
  * @return Drawn value is less then the \a upper limit.
  */
-bool Random::Success1024(uint upper)
+bool RandomSource::Success1024(uint upper)
 {
 	uint32 val = this->DrawNumber() >> 22; // Keep the upper 10 bits.
 	return val < upper;
@@ -38,7 +56,7 @@ bool Random::Success1024(uint upper)
  * @param perc Percentage of success.
  * @return Whether we were lucky.
  */
-bool Random::Success(int perc)
+bool RandomSource::Success(int perc)
 {
 	assert(perc >= 0 && perc <= 100);
 	return this->Success1024((uint)perc * 1024 / 100);
@@ -49,7 +67,7 @@ bool Random::Success(int perc)
  * @param mean The mean interval between events
  * @return An interval length drawn from the exponential distribution
  */
-uint16 Random::Exponential(uint16 mean)
+uint16 RandomSource::Exponential(uint16 mean)
 {
 	assert(mean > 0);
 	double u = this->DrawNumber() * (1.0 / 4294967296.0); // Uniform between [0,1)
@@ -61,7 +79,7 @@ uint16 Random::Exponential(uint16 mean)
  * @param incl_upper Inclusive upper bound.
  * @return Value drawn from the distribution within the set limits.
  */
-uint16 Random::Uniform(uint16 incl_upper)
+uint16 RandomSource::Uniform(uint16 incl_upper)
 {
 	uint length = 1;
 	uint32 val = 2;
@@ -86,6 +104,46 @@ uint32 Random::DrawNumber()
 	return seed;
 }
 
+/**
+ * Construct a counter-based generator stream.
+ * @param stream Identity of the drawing entity, e.g. its index in the owning collection.
+ * @param tick Current simulation tick.
+ */
+CounterRandom::CounterRandom(uint32 stream, uint32 tick) : stream(stream), tick(tick), counter(0)
+{
+}
+
+/**
+ * One round of the Philox-style mixing function.
+ * @param x0 [inout] First half of the counter block.
+ * @param x1 [inout] Second half of the counter block.
+ * @param key [inout] Round key, advanced by the Weyl constant.
+ */
+static inline void PhiloxRound(uint32 &x0, uint32 &x1, uint32 &key)
+{
+	const uint64 product = static_cast<uint64>(0xD256D193u) * x0;
+	const uint32 hi = static_cast<uint32>(product >> 32);
+	const uint32 lo = static_cast<uint32>(product);
+	x0 = hi ^ key ^ x1;
+	x1 = lo;
+	key += 0x9E3779B9u;  // Golden ratio increment.
+}
+
+/**
+ * Draw a random 32 bit number by hashing (seed, stream, tick, draw count).
+ * Nothing outside this stream is read or written, so streams can be drawn from concurrently,
+ * and the values only depend on the key, never on the order in which entities are simulated.
+ * @return New random number on every call.
+ */
+uint32 CounterRandom::DrawNumber()
+{
+	uint32 x0 = this->tick;
+	uint32 x1 = this->counter++;
+	uint32 key = Random::GetSeed() ^ this->stream;
+	for (int round = 0; round < 7; round++) PhiloxRound(x0, x1, key);
+	return x0;
+}
+
 static const uint32 CURRENT_VERSION_RAND = 1;   ///< Currently supported version of the RAND pattern.
 
 /**
@@ -10,22 +10,53 @@
 #ifndef RANDOM_H
 #define RANDOM_H
 
-/** A random generator class. */
-class Random {
+/** Distributions on top of a uniform 32 bit random number source. */
+class RandomSource {
 public:
+	virtual ~RandomSource() = default;
+
 	bool Success1024(uint upper);
 	bool Success(int perc);
 	uint16 Uniform(uint16 incl_upper);
 	uint16 Exponential(uint16 mean);
 
+protected:
+	virtual uint32 DrawNumber() = 0;
+};
+
+/** A random generator class. */
+class Random : public RandomSource {
+public:
 	static void Initialize();
+	static uint32 GetSeed();
+	static void SetSeed(uint32 new_seed);
 	static void Load(Loader &ldr);
 	static void Save(Saver &svr);
 
 private:
 	static uint32 seed; ///< Seed of the generators.
 
-	uint32 DrawNumber();
+	uint32 DrawNumber() override;
+};
+
+/**
+ * Counter-based random generator (a small Philox-style bijection).
+ *
+ * Unlike #Random, drawing a number does not advance any shared state; the value is a hash
+ * of (game seed, stream, tick, draw count). Entities simulated in parallel can therefore
+ * each construct their own stream keyed by their handle and the current tick, and obtain
+ * randomness that is reproducible regardless of the order in which the entities run.
+ */
+class CounterRandom : public RandomSource {
+public:
+	CounterRandom(uint32 stream, uint32 tick);
+
+private:
+	uint32 DrawNumber() override;
+
+	uint32 stream;   ///< Identity of the drawing entity, e.g. its index in the owning collection.
+	uint32 tick;     ///< Simulation tick the numbers are drawn in.
+	uint32 counter;  ///< Number of values drawn from this stream so far.
 };
 
 #endif
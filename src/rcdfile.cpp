@@ -12,10 +12,81 @@
 #include "fileio.h"
 #include "string_func.h"
 #include "rev.h"
+#include <fstream>
 #include <memory>
 
 RcdFileCollection _rcd_collection; ///< Available RCD files.
 
+/** Cached scan result of one RCD file, so unchanged files need not be re-read. */
+struct ScanCacheEntry {
+	uint64 size;       ///< Size of the file when it was scanned.
+	int64 mtime;       ///< Modification time of the file when it was scanned.
+	std::string uri;   ///< URI from the INFO block.
+	std::string build; ///< Build version from the INFO block.
+};
+
+static std::map<std::string, ScanCacheEntry> _scan_cache;      ///< Scan results of the previous run, by file path.
+static std::map<std::string, ScanCacheEntry> _scan_cache_new;  ///< Scan results of this run, written back at the end.
+static bool _scan_cache_dirty = false;                         ///< Whether #_scan_cache_new differs from #_scan_cache.
+
+/**
+ * Get the path of the directory scan cache file.
+ * @return The path.
+ */
+static std::string ScanCachePath()
+{
+	std::string path = freerct_userdata_prefix();
+	path += DIR_SEP;
+	path += "rcdscan.cache";
+	return path;
+}
+
+/** Load the directory scan cache of the previous run, if present. */
+static void LoadScanCache()
+{
+	_scan_cache.clear();
+	_scan_cache_new.clear();
+	_scan_cache_dirty = false;
+
+	std::ifstream file(ScanCachePath());
+	if (!file.is_open()) return;
+	std::string line;
+	if (!std::getline(file, line) || line != "FRCDSCAN 1") return;
+	while (std::getline(file, line)) {
+		/* Each line holds tab-separated size, mtime, build, uri, and path (path last, it may contain odd characters). */
+		ScanCacheEntry entry;
+		size_t start = 0;
+		std::string fields[4];
+		int field = 0;
+		for (; field < 4; field++) {
+			size_t tab = line.find('\t', start);
+			if (tab == std::string::npos) break;
+			fields[field] = line.substr(start, tab - start);
+			start = tab + 1;
+		}
+		if (field != 4 || start >= line.size()) continue; // Malformed line, the file will just be re-scanned.
+		entry.size = strtoull(fields[0].c_str(), nullptr, 10);
+		entry.mtime = strtoll(fields[1].c_str(), nullptr, 10);
+		entry.build = fields[2];
+		entry.uri = fields[3];
+		_scan_cache[line.substr(start)] = entry;
+	}
+}
+
+/** Write the scan results of this run back to the cache file, dropping entries of files that disappeared. */
+static void SaveScanCache()
+{
+	if (!_scan_cache_dirty && _scan_cache_new.size() == _scan_cache.size()) return; // Nothing changed.
+
+	std::ofstream file(ScanCachePath(), std::ofstream::trunc);
+	if (!file.is_open()) return;
+	file << "FRCDSCAN 1\n";
+	for (const auto &iter : _scan_cache_new) {
+		const ScanCacheEntry &entry = iter.second;
+		file << entry.size << '\t' << entry.mtime << '\t' << entry.build << '\t' << entry.uri << '\t' << iter.first << '\n';
+	}
+}
+
 /**
  * Constructor from its data elements.
  * @param path File path of the RCD file.
@@ -69,12 +140,14 @@ void RcdFileCollection::AddFile(const RcdFileInfo &rcd)
 /** Scan directories, looking for RCD and FTK files to add. */
 void RcdFileCollection::ScanDirectories()
 {
+	LoadScanCache();
 	const std::string _rcd_paths[] = {
 		".",
 		freerct_install_prefix() + DIR_SEP + "rcd",
 		TrackDesignDirectory()
 	};
 	for (const std::string &rcd_path : _rcd_paths) this->ScanDirectory(rcd_path, 3);
+	SaveScanCache();
 }
 
 /**
@@ -100,6 +173,29 @@ void RcdFileCollection::ScanDirectory(const std::string &dir, int recursion_dept
 	}
 }
 
+/**
+ * Find known RCD files whose contents changed on disk since they were scanned, and refresh their scan cache entries.
+ * Files that disappeared or that cannot be read (for example because they are still being written) are skipped,
+ * their previously loaded data stays in use.
+ * @return Paths of the changed files.
+ */
+std::vector<std::string> RcdFileCollection::FindChangedFiles()
+{
+	std::vector<std::string> changed;
+	for (const auto &iter : this->rcdfiles) {
+		const std::string &path = iter.second.path;
+		uint64 fsize;
+		int64 mtime;
+		if (!GetFileStats(path, &fsize, &mtime)) continue;
+		const auto cached = _scan_cache_new.find(path);
+		if (cached != _scan_cache_new.end() && cached->second.size == fsize && cached->second.mtime == mtime) continue;
+		if (this->ScanFileForMetaInfo(path) != nullptr) continue;
+		changed.push_back(path);
+	}
+	if (!changed.empty()) SaveScanCache();
+	return changed;
+}
+
 /**
  * Read a nul-terminated string from the rcd file that takes a fixed maximum length.
  * Skip reading if \a remaining is #UINT32_MAX, set it to that value if there is an error in reading.
@@ -141,6 +237,19 @@ static std::string GetString(RcdFileReader &rcd_file, uint max_bytes, uint32 *re
  */
 const char *RcdFileCollection::ScanFileForMetaInfo(const std::string &fname)
 {
+	/* An unchanged file (same size and modification time as the previous run) is not re-read. */
+	uint64 fsize;
+	int64 mtime;
+	const bool has_stats = GetFileStats(fname, &fsize, &mtime);
+	if (has_stats) {
+		const auto iter = _scan_cache.find(fname);
+		if (iter != _scan_cache.end() && iter->second.size == fsize && iter->second.mtime == mtime) {
+			_scan_cache_new[fname] = iter->second;
+			this->AddFile(RcdFileInfo(fname, iter->second.uri, iter->second.build));
+			return nullptr;
+		}
+	}
+
 	RcdFileReader rcd_file(fname);
 	if (!rcd_file.CheckFileHeader("RCDF", 2)) return "Wrong header";
 
@@ -160,6 +269,11 @@ const char *RcdFileCollection::ScanFileForMetaInfo(const std::string &fname)
 	std::string description = GetString(rcd_file, 512, &remaining);
 	if (remaining != 0) return "Error while reading INFO text.";
 
+	if (has_stats) {
+		_scan_cache_new[fname] = ScanCacheEntry{fsize, mtime, uri, build};
+		_scan_cache_dirty = true;
+	}
+
 	RcdFileInfo rfi(fname, uri, build);
 	this->AddFile(rfi);
 	return nullptr; // Success.
@@ -32,6 +32,7 @@ public:
 	void ScanDirectories();
 	void ScanDirectory(const std::string &dir, int recursion_depth);
 	void AddFile(const RcdFileInfo &rcd);
+	std::vector<std::string> FindChangedFiles();
 
 	std::map<std::string, RcdFileInfo> rcdfiles; ///< Found unique RCD files, mapping of uri to the Rcd file information.
 	std::vector<std::string>           ftkfiles; ///< Found unique FTK file paths.
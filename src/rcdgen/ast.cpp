@@ -8,13 +8,32 @@
 /** @file ast.cpp AST data structure implementation. */
 
 #include "../stdafx.h"
+#include <map>
+#include <set>
+#include <string_view>
 #include "ast.h"
+#include "build_cache.h"
 #include "scanner_funcs.h"
 #include "utils.h"
 
+/**
+ * Get the interned copy of a file name.
+ * Positions are copied into every AST node; keeping one canonical string per file
+ * turns those copies into pointer assignments instead of heap allocations.
+ * @param fname File name to intern.
+ * @return Pointer to the canonical copy, stable for the duration of the run.
+ */
+const std::string *InternFilename(const std::string &fname)
+{
+	static std::set<std::string> pool;
+	return &*pool.insert(fname).first;
+}
+
+AstArena _ast_arena; ///< Arena owning the AST nodes of the file being processed.
+
 Position::Position()
 {
-	this->filename = "unknown";
+	this->filename = InternFilename("unknown");
 	this->line = 0;
 }
 
@@ -23,7 +42,7 @@ Position::Position()
  * @param filename Name of the file containing the position.
  * @param line Line number in the file.
  */
-Position::Position(const char *filename, int line) : filename(filename)
+Position::Position(const char *filename, int line) : filename(InternFilename(filename))
 {
 	this->line = line;
 }
@@ -33,7 +52,7 @@ Position::Position(const char *filename, int line) : filename(filename)
  * @param filename Name of the file containing the position.
  * @param line Line number in the file.
  */
-Position::Position(const std::string &filename, int line) : filename(filename)
+Position::Position(const std::string &filename, int line) : filename(InternFilename(filename))
 {
 	this->line = line;
 }
@@ -69,7 +88,7 @@ Position &Position::operator=(const Position &pos)
 const char *Position::ToString() const
 {
 	static char buffer[256];
-	snprintf(buffer, 255, "\"%s\" line %d", this->filename.c_str(), this->line);
+	snprintf(buffer, 255, "\"%s\" line %d", this->filename->c_str(), this->line);
 	return buffer;
 }
 
@@ -115,8 +134,8 @@ std::shared_ptr<const Expression> UnaryOperator::Evaluate(const Symbol *symbols)
 		exit(1);
 	}
 	switch (this->oper) {
-		case '-': return std::make_shared<const NumberLiteral>(this->pos, -number->value);
-		case '~': return std::make_shared<const NumberLiteral>(this->pos, ~number->value);
+		case '-': return MakeAstNode<const NumberLiteral>(this->pos, -number->value);
+		case '~': return MakeAstNode<const NumberLiteral>(this->pos, ~number->value);
 		default: NOT_REACHED();
 	}
 }
@@ -151,16 +170,16 @@ std::shared_ptr<const Expression> BinaryOperator::Evaluate(const Symbol *symbols
 	}
 
 	switch (this->oper) {
-		case '&': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value & right_operand->value);
-		case '|': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value | right_operand->value);
-		case '^': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value ^ right_operand->value);
-		case '<': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value < right_operand->value);
-		case '>': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value > right_operand->value);
-		case '+': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value + right_operand->value);
-		case '-': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value - right_operand->value);
-		case '*': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value * right_operand->value);
-		case '/': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value / right_operand->value);
-		case '%': return std::make_shared<const NumberLiteral>(this->pos, left_operand->value % right_operand->value);
+		case '&': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value & right_operand->value);
+		case '|': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value | right_operand->value);
+		case '^': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value ^ right_operand->value);
+		case '<': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value < right_operand->value);
+		case '>': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value > right_operand->value);
+		case '+': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value + right_operand->value);
+		case '-': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value - right_operand->value);
+		case '*': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value * right_operand->value);
+		case '/': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value / right_operand->value);
+		case '%': return MakeAstNode<const NumberLiteral>(this->pos, left_operand->value % right_operand->value);
 		default: NOT_REACHED();
 	}
 }
@@ -176,7 +195,7 @@ StringLiteral::StringLiteral(const Position &pos, const std::string &text) : Exp
 
 std::shared_ptr<const Expression> StringLiteral::Evaluate([[maybe_unused]] const Symbol *symbols) const
 {
-	return std::make_shared<const StringLiteral>(this->pos, this->text);
+	return MakeAstNode<const StringLiteral>(this->pos, this->text);
 }
 
 /**
@@ -191,12 +210,16 @@ IdentifierLiteral::IdentifierLiteral(const Position &pos, const std::string &nam
 std::shared_ptr<const Expression> IdentifierLiteral::Evaluate(const Symbol *symbols) const
 {
 	if (symbols != nullptr) {
-		for (;;) {
-			if (symbols->name == nullptr) break; // Reached the end.
-			if (symbols->name == this->name) {
-				return std::make_shared<const NumberLiteral>(this->pos, symbols->value);
-			}
-			symbols++;
+		/* The symbol tables are static arrays that are scanned for every identifier;
+		 * index each table once and look names up through the index instead. */
+		static std::map<const Symbol *, std::map<std::string_view, int>> table_indices;
+		std::map<std::string_view, int> &index = table_indices[symbols];
+		if (index.empty()) {
+			for (const Symbol *sym = symbols; sym->name != nullptr; sym++) index.emplace(sym->name, sym->value);
+		}
+		const auto iter = index.find(this->name);
+		if (iter != index.end()) {
+			return MakeAstNode<const NumberLiteral>(this->pos, iter->second);
 		}
 	}
 	fprintf(stderr, "Evaluate error %s: Identifier \"%s\" is not known\n", this->pos.ToString(), this->name.c_str());
@@ -214,7 +237,7 @@ NumberLiteral::NumberLiteral(const Position &pos, long long value) : Expression(
 
 std::shared_ptr<const Expression> NumberLiteral::Evaluate([[maybe_unused]] const Symbol *symbols) const
 {
-	return std::make_shared<const NumberLiteral>(this->pos, this->value);
+	return MakeAstNode<const NumberLiteral>(this->pos, this->value);
 }
 
 /**
@@ -241,7 +264,7 @@ std::shared_ptr<const Expression> BitSet::Evaluate(const Symbol *symbols) const
 			value |= 1ll << nl->value;
 		}
 	}
-	return std::make_shared<const NumberLiteral>(this->pos, value);
+	return MakeAstNode<const NumberLiteral>(this->pos, value);
 }
 
 Name::Name()
@@ -536,19 +559,37 @@ std::shared_ptr<NamedValueList> LoadFile(const char *filename, int line)
 	nest_level++;
 
 	/* Parse the input. */
-	FILE *infile = nullptr;
+	std::unique_ptr<char[]> buffer;
+	_parsed_data = nullptr;
 	if (filename != nullptr) {
-		infile = fopen(filename, "rb");
+		/* Read the entire file up front, so the scanner lexes one in-memory batch. */
+		FILE *infile = fopen(filename, "rb");
 		if (infile == nullptr) {
 			fprintf(stderr, "Error: Could not open file \"%s\"\n", filename);
 			exit(1);
 		}
+		RegisterBuildCacheInput(filename);
+		fseek(infile, 0, SEEK_END);
+		long length = ftell(infile);
+		fseek(infile, 0, SEEK_SET);
+		if (length < 0) {
+			fprintf(stderr, "Error: Could not read file \"%s\"\n", filename);
+			exit(1);
+		}
+		buffer.reset(new char[length + 2]);
+		if (length > 0 && (long)fread(buffer.get(), 1, length, infile) != length) {
+			fprintf(stderr, "Error: Could not read file \"%s\"\n", filename);
+			exit(1);
+		}
+		fclose(infile);
+		buffer[length] = '\0'; // The scanner requires two sentinel bytes after the data.
+		buffer[length + 1] = '\0';
+		SetupScannerBuffer(filename, buffer.get(), length + 2);
+	} else {
+		SetupScanner(nullptr, nullptr);
 	}
-	_parsed_data = nullptr;
-	SetupScanner(filename, infile);
 	yyparse();
-
-	if (infile != nullptr) fclose(infile);
+	buffer.reset();
 
 	if (_parsed_data == nullptr) {
 		fprintf(stderr, "Parsing of the input file did not give a result\n");
@@ -557,6 +598,7 @@ std::shared_ptr<NamedValueList> LoadFile(const char *filename, int line)
 
 	/* Process imports. */
 	std::shared_ptr<NamedValueList> nvs = _parsed_data;
+	_parsed_data = nullptr; // Drop the global reference; the nodes must all be released before the arena is cleared.
 	nvs->HandleImports(); // Recursively calls this function, so _parsed_data is not safe.
 
 	/* Restore to pre-call state. */
@@ -13,6 +13,115 @@
 #include <list>
 #include <string>
 #include <memory>
+#include <vector>
+
+const std::string *InternFilename(const std::string &fname);
+
+constexpr size_t AST_SLAB_SIZE = 1 << 20;  ///< Size of one slab of the AST arena (arbitrary number).
+
+/**
+ * Arena handing out AST node memory from large contiguous slabs.
+ * The parser creates many small nodes per file; they are bump-allocated here, and the
+ * whole arena is released at once when the file has been checked and written.
+ */
+class AstArena {
+public:
+	/**
+	 * Allocate AST node memory.
+	 * @param size Number of bytes needed.
+	 * @return Start of the memory; it stays valid until #Clear is called.
+	 */
+	void *Allocate(size_t size)
+	{
+		size = (size + 15) & ~(size_t)15; // Keep the next allocation aligned.
+		this->allocations++;
+		this->allocated += size;
+		if (size > AST_SLAB_SIZE) { // Does not fit in a slab, give it its own allocation.
+			this->slabs.emplace_back(new char[size]);
+			return this->slabs.back().get();
+		}
+		if (this->slabs.empty() || this->used + size > AST_SLAB_SIZE) {
+			this->slabs.emplace_back(new char[AST_SLAB_SIZE]);
+			this->used = 0;
+		}
+		char *address = this->slabs.back().get() + this->used;
+		this->used += size;
+		return address;
+	}
+
+	/** Release all memory. All AST nodes become invalid. */
+	void Clear()
+	{
+		this->slabs.clear();
+		this->used = 0;
+		this->allocations = 0;
+		this->allocated = 0;
+	}
+
+	/**
+	 * Get the number of allocations made since the last #Clear.
+	 * @return Number of allocations.
+	 */
+	size_t Allocations() const
+	{
+		return this->allocations;
+	}
+
+	/**
+	 * Get the number of bytes handed out since the last #Clear.
+	 * @return Number of allocated bytes.
+	 */
+	size_t AllocatedBytes() const
+	{
+		return this->allocated;
+	}
+
+private:
+	std::vector<std::unique_ptr<char[]>> slabs; ///< Allocated slabs; only the last one has free space.
+	size_t used = 0;         ///< Used bytes of the last slab.
+	size_t allocations = 0;  ///< Number of allocations since the last #Clear.
+	size_t allocated = 0;    ///< Number of bytes handed out since the last #Clear.
+};
+
+extern AstArena _ast_arena;
+
+/**
+ * STL allocator handing out memory from the AST arena.
+ * @tparam T Type to allocate for.
+ */
+template <typename T>
+struct AstAllocator {
+	using value_type = T;
+
+	AstAllocator() = default;
+	template <typename U> AstAllocator(const AstAllocator<U> &) {}
+
+	T *allocate(size_t count)
+	{
+		return static_cast<T *>(_ast_arena.Allocate(count * sizeof(T)));
+	}
+
+	void deallocate(T *, size_t)
+	{
+		/* Memory is released wholesale by the arena. */
+	}
+};
+
+template <typename T, typename U> bool operator==(const AstAllocator<T> &, const AstAllocator<U> &) { return true;  }
+template <typename T, typename U> bool operator!=(const AstAllocator<T> &, const AstAllocator<U> &) { return false; }
+
+/**
+ * Construct a shared AST node, with the node and its reference count allocated from the arena.
+ * The result must not be kept beyond the next #AstArena::Clear.
+ * @tparam T Node type to construct.
+ * @param args Constructor arguments of the node.
+ * @return The constructed node.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeAstNode(Args &&... args)
+{
+	return std::allocate_shared<T>(AstAllocator<T>(), std::forward<Args>(args)...);
+}
 
 /** Position in a source file. */
 class Position {
@@ -25,8 +134,8 @@ public:
 
 	const char *ToString() const;
 
-	std::string filename; ///< File containing the line.
-	int line;             ///< Number of the line referred to.
+	const std::string *filename; ///< File containing the line (interned, never \c nullptr).
+	int line;                    ///< Number of the line referred to.
 };
 
 /** A Symbol in a 'symbol table'. */
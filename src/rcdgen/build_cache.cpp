@@ -0,0 +1,228 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file build_cache.cpp Cache for skipping the regeneration of up-to-date RCD files.
+ *
+ * Next to each preprocessed input file, a manifest records the content hash of every input
+ * that contributed to the generated RCD files (the preprocessed source, the language files,
+ * and all sprite images), together with a copy of the outputs. When all input hashes still
+ * match on the next run, the outputs are restored from the cached copies instead of
+ * re-encoding every sprite, so a one-sprite tweak only rebuilds the files that use it.
+ */
+
+#include "../stdafx.h"
+#include <set>
+#include "build_cache.h"
+
+static const char *CACHE_MAGIC = "RCDGEN-CACHE";      ///< First word of a manifest file.
+static const int CACHE_VERSION = 1;                   ///< Version number of the manifest format.
+static const char *CACHE_STAMP = __DATE__ "," __TIME__;  ///< Build stamp of rcdgen itself; a rebuilt rcdgen invalidates all manifests.
+
+static std::set<std::string> _cache_inputs;   ///< Input files read while generating the current RCD files.
+static std::vector<std::string> _cache_outputs;  ///< Output files written for the current input file, in order.
+
+/** Forget the inputs and outputs recorded for the previous input file. */
+void ClearBuildCacheRun()
+{
+	_cache_inputs.clear();
+	_cache_outputs.clear();
+}
+
+/**
+ * Record that a file was read while generating the current RCD files.
+ * @param fname Name of the input file.
+ */
+void RegisterBuildCacheInput(const std::string &fname)
+{
+	_cache_inputs.insert(fname);
+}
+
+/**
+ * Record that an RCD file was written for the current input file.
+ * @param fname Name of the output file.
+ */
+void RegisterBuildCacheOutput(const std::string &fname)
+{
+	_cache_outputs.push_back(fname);
+}
+
+/**
+ * Compute the FNV-1a hash of the contents of a file.
+ * @param fname Name of the file to hash.
+ * @param hash [out] The computed hash.
+ * @return Whether the file could be read.
+ */
+static bool HashFileContents(const std::string &fname, uint64 *hash)
+{
+	FILE *fp = fopen(fname.c_str(), "rb");
+	if (fp == nullptr) return false;
+
+	uint64 h = 0xcbf29ce484222325ull;
+	uint8 buffer[4096];
+	for (;;) {
+		const size_t length = fread(buffer, 1, sizeof(buffer), fp);
+		for (size_t i = 0; i < length; i++) {
+			h ^= buffer[i];
+			h *= 0x100000001b3ull;
+		}
+		if (length < sizeof(buffer)) break;
+	}
+	const bool ok = ferror(fp) == 0;
+	fclose(fp);
+	*hash = h;
+	return ok;
+}
+
+/**
+ * Copy a file.
+ * @param src Name of the file to copy.
+ * @param dest Name of the copy to make.
+ * @return Whether copying succeeded.
+ */
+static bool CopyFileContents(const std::string &src, const std::string &dest)
+{
+	FILE *in = fopen(src.c_str(), "rb");
+	if (in == nullptr) return false;
+	FILE *out = fopen(dest.c_str(), "wb");
+	if (out == nullptr) {
+		fclose(in);
+		return false;
+	}
+
+	uint8 buffer[4096];
+	bool ok = true;
+	for (;;) {
+		const size_t length = fread(buffer, 1, sizeof(buffer), in);
+		if (length > 0 && fwrite(buffer, 1, length, out) != length) {
+			ok = false;
+			break;
+		}
+		if (length < sizeof(buffer)) break;
+	}
+	ok &= ferror(in) == 0 && ferror(out) == 0;
+	fclose(in);
+	fclose(out);
+	return ok;
+}
+
+/**
+ * Get the name of the manifest file belonging to an input file.
+ * @param fpp_name Name of the preprocessed input file.
+ * @return Name of the manifest file.
+ */
+static std::string ManifestName(const std::string &fpp_name)
+{
+	return fpp_name + ".cache";
+}
+
+/**
+ * Get the name of the cached copy of an output file.
+ * The copy lives next to the manifest, so the source tree stays clean.
+ * @param fpp_name Name of the preprocessed input file.
+ * @param out_name Name of the output file.
+ * @return Name of the cached copy.
+ */
+static std::string CachedOutputName(const std::string &fpp_name, const std::string &out_name)
+{
+	const size_t dir_sep = fpp_name.find_last_of('/');
+	const std::string dir = (dir_sep == std::string::npos) ? "" : fpp_name.substr(0, dir_sep + 1);
+	return dir + out_name + ".cached";
+}
+
+/**
+ * Try to restore the RCD files of an input file from the cache.
+ * @param fpp_name Name of the preprocessed input file.
+ * @param lang_files Language files loaded for this run.
+ * @return Whether all recorded inputs were unchanged and the outputs were restored.
+ */
+bool LoadFromBuildCache(const std::string &fpp_name, const std::vector<std::string> &lang_files)
+{
+	FILE *fp = fopen(ManifestName(fpp_name).c_str(), "rt");
+	if (fp == nullptr) return false;
+
+	char magic[16];
+	char stamp[64];
+	int version = 0;
+	if (fscanf(fp, "%15s %d %63s\n", magic, &version, stamp) != 3 ||
+			strcmp(magic, CACHE_MAGIC) != 0 || version != CACHE_VERSION || strcmp(stamp, CACHE_STAMP) != 0) {
+		fclose(fp);
+		return false;
+	}
+
+	/* The language files are inputs of every run; a manifest that does not list them all is stale. */
+	std::set<std::string> recorded_inputs;
+
+	std::vector<std::string> outputs;
+	bool current = true;
+	char line[1024];
+	while (current && fgets(line, sizeof(line), fp) != nullptr) {
+		size_t length = strlen(line);
+		while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) line[--length] = '\0';
+		if (length < 2 || line[1] != ' ') continue;
+
+		if (line[0] == 'O') {
+			outputs.push_back(line + 2);
+		} else if (line[0] == 'I') {
+			uint64 recorded = 0;
+			int offset = 0;
+			if (sscanf(line + 2, "%llx %n", (unsigned long long *)&recorded, &offset) != 1) {
+				current = false;
+				break;
+			}
+			const std::string fname(line + 2 + offset);
+			recorded_inputs.insert(fname);
+			uint64 hash;
+			current = HashFileContents(fname, &hash) && hash == recorded;
+		}
+	}
+	fclose(fp);
+
+	if (!current || outputs.empty()) return false;
+	for (const std::string &lang_file : lang_files) {
+		if (recorded_inputs.count(lang_file) == 0) return false;
+	}
+
+	for (const std::string &out_name : outputs) {
+		if (!CopyFileContents(CachedOutputName(fpp_name, out_name), out_name)) return false;
+	}
+	return true;
+}
+
+/**
+ * Write the manifest of a completed run, and keep a copy of the written outputs.
+ * @param fpp_name Name of the preprocessed input file.
+ * @param lang_files Language files loaded for this run.
+ */
+void WriteBuildCacheManifest(const std::string &fpp_name, const std::vector<std::string> &lang_files)
+{
+	const std::string manifest = ManifestName(fpp_name);
+	for (const std::string &out_name : _cache_outputs) {
+		if (!CopyFileContents(out_name, CachedOutputName(fpp_name, out_name))) {
+			remove(manifest.c_str());  // Never leave a manifest that promises outputs the cache does not hold.
+			return;
+		}
+	}
+
+	for (const std::string &lang_file : lang_files) _cache_inputs.insert(lang_file);
+	_cache_inputs.insert(fpp_name);
+
+	FILE *fp = fopen(manifest.c_str(), "wt");
+	if (fp == nullptr) return;
+
+	fprintf(fp, "%s %d %s\n", CACHE_MAGIC, CACHE_VERSION, CACHE_STAMP);
+	for (const std::string &out_name : _cache_outputs) fprintf(fp, "O %s\n", out_name.c_str());
+	bool ok = true;
+	for (const std::string &fname : _cache_inputs) {
+		uint64 hash;
+		ok &= HashFileContents(fname, &hash);
+		fprintf(fp, "I %016llx %s\n", (unsigned long long)hash, fname.c_str());
+	}
+	ok &= ferror(fp) == 0;
+	fclose(fp);
+	if (!ok) remove(manifest.c_str());
+}
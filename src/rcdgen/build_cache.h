@@ -0,0 +1,22 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file build_cache.h Cache for skipping the regeneration of up-to-date RCD files. */
+
+#ifndef BUILD_CACHE_H
+#define BUILD_CACHE_H
+
+#include <string>
+#include <vector>
+
+void ClearBuildCacheRun();
+void RegisterBuildCacheInput(const std::string &fname);
+void RegisterBuildCacheOutput(const std::string &fname);
+bool LoadFromBuildCache(const std::string &fpp_name, const std::vector<std::string> &lang_files);
+void WriteBuildCacheManifest(const std::string &fpp_name, const std::vector<std::string> &lang_files);
+
+#endif
@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <sstream>
+#include <string_view>
 #include "ast.h"
 #include "nodes.h"
 #include "string_storage.h"
@@ -476,6 +477,8 @@ public:
 
 private:
 	void CreateValues(int named_count, int unnamed_count);
+
+	std::map<std::string, std::vector<int>, std::less<>> name_index; ///< Indices in #named_values by value name, in insertion order.
 };
 
 /**
@@ -610,6 +613,11 @@ void Values::PrepareNamedValues(std::shared_ptr<NamedValueList> values, bool all
 	}
 	assert(named_count == this->named_count);
 	assert(unnamed_count == this->unnamed_count);
+
+	/* Index the values by name; sheets expand to hundreds of named sprites, and scanning
+	 * the list again for every field lookup made this phase quadratic. */
+	this->name_index.clear();
+	for (int i = 0; i < this->named_count; i++) this->name_index[this->named_values[i]->name].push_back(i);
 }
 
 /**
@@ -619,11 +627,14 @@ void Values::PrepareNamedValues(std::shared_ptr<NamedValueList> values, bool all
  */
 std::shared_ptr<ValueInformation> Values::FindValue(const char *fld_name)
 {
-	for (int i = 0; i < this->named_count; i++) {
-		std::shared_ptr<ValueInformation> vi = this->named_values[i];
-		if (!vi->used && vi->name == fld_name) {
-			vi->used = true;
-			return vi;
+	const auto iter = this->name_index.find(std::string_view(fld_name));
+	if (iter != this->name_index.end()) {
+		for (int index : iter->second) {
+			std::shared_ptr<ValueInformation> vi = this->named_values[index];
+			if (!vi->used) {
+				vi->used = true;
+				return vi;
+			}
 		}
 	}
 	fprintf(stderr, "Error at %s: Cannot find a value for field \"%s\" in node \"%s\"\n", this->pos.ToString(), fld_name, this->node_name);
@@ -637,9 +648,10 @@ std::shared_ptr<ValueInformation> Values::FindValue(const char *fld_name)
  */
 bool Values::HasValue(const char *fld_name)
 {
-	for (int i = 0; i < this->named_count; i++) {
-		std::shared_ptr<ValueInformation> vi = this->named_values[i];
-		if (!vi->used && vi->name == fld_name) return true;
+	const auto iter = this->name_index.find(std::string_view(fld_name));
+	if (iter == this->name_index.end()) return false;
+	for (int index : iter->second) {
+		if (!this->named_values[index]->used) return true;
 	}
 	return false;
 }
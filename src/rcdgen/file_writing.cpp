@@ -157,15 +157,32 @@ bool operator==(const FileBlock &fb1, const FileBlock &fb2)
 	return memcmp(fb1.data, fb2.data, fb1.length) == 0;
 }
 
+/**
+ * Compute the FNV-1a hash of the contents of a file block.
+ * @param blk Block to hash.
+ * @return The hash.
+ */
+static uint64 HashBlock(const FileBlock *blk)
+{
+	uint64 hash = 0xcbf29ce484222325ull;
+	for (int i = 0; i < blk->length; i++) {
+		hash ^= blk->data[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
 /**
  * Add a block to the file.
+ * Byte-identical blocks (mirrored frames, repeated tiles) are stored once, and every
+ * duplicate gets the block number of the first copy.
  * @param blk Block to add.
  * @return Block index number where the block is stored in the file.
  * @note Takes ownership of #blk.
  */
 int FileWriter::AddBlock(FileBlock *blk)
 {
-	auto &group = this->blocks_by_length[blk->length];
+	auto &group = this->blocks_by_hash[HashBlock(blk)];
 	for (auto &iter : group) {
 		/* Block already added, just return the old block number. */
 		if (*iter.second == *blk) {
@@ -180,6 +197,25 @@ int FileWriter::AddBlock(FileBlock *blk)
 	return idx;
 }
 
+/**
+ * Print profiling information about the blocks of this file in a machine readable format.
+ * One line per block kind: <tt>PROFILE block FILE KIND COUNT BYTES</tt>.
+ * @param fname Name of the output file the blocks belong to.
+ */
+void FileWriter::PrintBlockProfile(const std::string &fname) const
+{
+	std::map<std::string, std::pair<int, uint64>> kinds;
+	for (const auto &blk : this->blocks) {
+		if (blk->length == 0) continue;
+		auto &entry = kinds[std::string(reinterpret_cast<const char *>(blk->data), 4)];
+		entry.first++;
+		entry.second += blk->length;
+	}
+	for (const auto &iter : kinds) {
+		printf("PROFILE block %s %s %d %llu\n", fname.c_str(), iter.first.c_str(), iter.second.first, (unsigned long long)iter.second.second);
+	}
+}
+
 /**
  * Write all blocks of the RCD file to the file.
  * @param fname Filename to create.
@@ -198,7 +234,40 @@ void FileWriter::WriteFile(std::string fname)
 		exit(1);
 	}
 
+	/* Build the table of contents of the blocks as they will appear in the file.
+	 * Blocks of length 0 are not written, so they do not get an entry. */
+	int block_count = 0;
+	for (auto &iter : this->blocks) {
+		if (iter->length > 0) block_count++;
+	}
+	FileBlock toc;
+	toc.StartSave("TOCB", 1, 4 + 16 * block_count);
+	toc.SaveUInt32(block_count);
+	uint32 offset = 8; // The file header comes first.
+	for (auto &iter : this->blocks) {
+		if (iter->length == 0) continue;
+		toc.SaveBytes(iter->data, 4); // Block name.
+		uint32 version = iter->data[4] | (iter->data[5] << 8) | (iter->data[6] << 16) | (iter->data[7] << 24);
+		toc.SaveUInt32(version);
+		toc.SaveUInt32(offset);
+		toc.SaveUInt32(iter->length - 12); // Data length, excluding the block header.
+		offset += iter->length;
+	}
+	toc.CheckEndSave();
+
 	for (auto &iter : this->blocks) iter->Write(fp);
 
+	/* Append the table of contents, and a trailer so readers can find it.
+	 * Readers that scan the blocks linearly skip the table as an unknown block. */
+	toc.Write(fp);
+	const uint8 trailer[8] = {
+		(uint8)offset, (uint8)(offset >> 8), (uint8)(offset >> 16), (uint8)(offset >> 24),
+		'T', 'O', 'C', 'F',
+	};
+	if (fwrite(trailer, 1, 8, fp) != 8) {
+		fprintf(stderr, "Failed to write the table of contents trailer of \"%s\".", fname.c_str());
+		exit(1);
+	}
+
 	fclose(fp);
 }
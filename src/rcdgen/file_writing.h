@@ -52,10 +52,11 @@ public:
 	int AddBlock(FileBlock *fb);
 
 	void WriteFile(const std::string fname);
+	void PrintBlockProfile(const std::string &fname) const;
 
 private:
 	FileBlockPtrList blocks; ///< Blocks stored in the file so far.
-	std::map<size_t, std::vector<std::pair<int, FileBlock*>>> blocks_by_length;  ///< All blocks with their index grouped by their length for faster searching.
+	std::map<uint64, std::vector<std::pair<int, FileBlock*>>> blocks_by_hash;  ///< All blocks with their index grouped by their content hash for faster searching.
 };
 
 #endif
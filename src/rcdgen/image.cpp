@@ -8,8 +8,11 @@
 /** @file image.cpp %Image loading, cutting, and saving the sprites. */
 
 #include "../stdafx.h"
+#include <algorithm>
+#include <zlib.h>
 #include <map>
 #include <vector>
+#include "build_cache.h"
 #include "image.h"
 
 #include "mask64.xbm"
@@ -77,6 +80,8 @@ void ImageFile::Clear()
  */
 const char *ImageFile::LoadFile(const std::string &fname, std::shared_ptr<const ImageFile> &result)
 {
+	RegisterBuildCacheInput(fname);
+
 	static std::map<std::string, std::shared_ptr<const ImageFile>> cache;
 	const auto it = cache.find(fname);
 	if (it != cache.end()) {
@@ -222,10 +227,24 @@ Image::Image(const ImageFile *imf, const char *block_name, int block_version, Bi
 		this->mask = GetMask(mask->type);
 		this->mask_xpos = mask->x_pos;
 		this->mask_ypos = mask->y_pos;
+
+		/* Expand the packed bitmap into 64 bit words, so pixel tests become one bit test
+		 * and row scans can process whole words at a time. */
+		this->mask_words_per_row = (this->mask->width + 63) / 64;
+		this->mask_rows.resize((size_t)this->mask->height * this->mask_words_per_row);
+		const int row_bytes = (this->mask->width + 7) / 8;
+		for (int y = 0; y < this->mask->height; y++) {
+			for (int x = 0; x < this->mask->width; x++) {
+				if ((this->mask->data[y * row_bytes + x / 8] & (1 << (x & 7))) != 0) {
+					this->mask_rows[(size_t)y * this->mask_words_per_row + x / 64] |= 1ull << (x & 63);
+				}
+			}
+		}
 	} else {
 		this->mask = nullptr;
 		this->mask_xpos = 0;
 		this->mask_ypos = 0;
+		this->mask_words_per_row = 0;
 	}
 }
 
@@ -282,12 +301,9 @@ bool Image::IsMaskedOut(int x, int y) const
 	if (this->mask != nullptr) {
 		if (x >= this->mask_xpos && x < this->mask_xpos + this->mask->width &&
 				y >= this->mask_ypos && y < this->mask_ypos + this->mask->height) {
-			const uint8 *p = this->mask->data;
-			int off = (this->mask_ypos - y) * ((this->mask->width + 7) / 8);
-			p += off;
-			off = this->mask_xpos - x;
-			p += off / 8;
-			return (*p & (1 << (off & 7))) == 0;
+			const int col = x - this->mask_xpos;
+			const uint64 word = this->mask_rows[(size_t)(y - this->mask_ypos) * this->mask_words_per_row + col / 64];
+			return (word & (1ull << (col & 63))) == 0;
 		}
 	}
 	return false;
@@ -342,25 +358,81 @@ bool Image8bpp::IsTransparent(int xpos, int ypos) const
 	return this->GetPixel(xpos, ypos) == TRANSPARENT_INDEX;
 }
 
+/**
+ * Find the first transparent pixel at or after \a start in a transparency bit row.
+ * @param row Transparency bit row (a set bit means the pixel is transparent).
+ * @param start First pixel position to consider.
+ * @param limit Number of pixels in the row.
+ * @return Position of the first transparent pixel, or \a limit if there is none.
+ */
+static int NextTransparent(const uint64 *row, int start, int limit)
+{
+	while (start < limit) {
+		uint64 w = row[start / 64] >> (start & 63);
+		if (w == 0) { // Rest of the word is opaque, continue with the next one.
+			start = (start | 63) + 1;
+			continue;
+		}
+		while ((w & 1) == 0) {
+			w >>= 1;
+			start++;
+		}
+		break;
+	}
+	return std::min(start, limit);
+}
+
+/**
+ * Find the first opaque pixel at or after \a start in a transparency bit row.
+ * @param row Transparency bit row (a set bit means the pixel is transparent).
+ * @param start First pixel position to consider.
+ * @param limit Number of pixels in the row.
+ * @return Position of the first opaque pixel, or \a limit if there is none.
+ */
+static int NextOpaque(const uint64 *row, int start, int limit)
+{
+	while (start < limit) {
+		uint64 w = ~row[start / 64] >> (start & 63);
+		if (w == 0) { // Rest of the word is transparent, continue with the next one.
+			start = (start | 63) + 1;
+			continue;
+		}
+		while ((w & 1) == 0) {
+			w >>= 1;
+			start++;
+		}
+		break;
+	}
+	return std::min(start, limit);
+}
+
 uint8 *Image8bpp::Encode(int xpos, int ypos, int width, int height, int *size) const
 {
 	auto row_sizes = std::vector<int>();
 	row_sizes.reserve(height);
 
+	/* Build the transparency bitmap of the sprite once; both passes below find
+	 * the pixel runs in it a word at a time instead of testing pixel by pixel. */
+	const int words = (width + 63) / 64;
+	std::vector<uint64> transparent((size_t)height * words);
+	for (int y = 0; y < height; y++) {
+		uint64 *row = &transparent[(size_t)y * words];
+		for (int x = 0; x < width; x++) {
+			if (this->IsTransparent(xpos + x, ypos + y)) row[x / 64] |= 1ull << (x & 63);
+		}
+	}
+
 	/* Examine the sprite, and record length of data for each row. */
 	int data_size = 0;
 	for (int y = 0; y < height; y++) {
+		const uint64 *row = &transparent[(size_t)y * words];
 		int length = 0;
 		int last_stored = 0; // Up to this position (exclusive), the row was counted.
-		for (int x = 0; x < width; x++) {
-			if (this->IsTransparent(xpos + x, ypos + y)) continue;
-
+		int x = NextOpaque(row, 0, width);
+		while (x < width) {
 			int start = x;
-			x++;
-			while (x < width) {
-				if (this->IsTransparent(xpos + x, ypos + y)) break;
-				x++;
-			}
+			x = NextTransparent(row, x + 1, width);
+
 			/* from 'start' upto and excluding 'x' are pixels to draw. */
 			while (last_stored + 127 < start) {
 				length += 2; // 127 pixels gap, 0 pixels to draw.
@@ -372,6 +444,8 @@ uint8 *Image8bpp::Encode(int xpos, int ypos, int width, int height, int *size) c
 			}
 			length += 2 + x - start;
 			last_stored = x;
+
+			x = NextOpaque(row, x + 1, width);
 		}
 		assert(length <= 0xffff);
 		row_sizes.push_back(length);
@@ -403,17 +477,14 @@ uint8 *Image8bpp::Encode(int xpos, int ypos, int width, int height, int *size) c
 	for (int y = 0; y < height; y++) {
 		if (row_sizes[y] == 0) continue;
 
+		const uint64 *row = &transparent[(size_t)y * words];
 		uint8 *last_header = nullptr;
 		int last_stored = 0; // Up to this position (exclusive), the row was counted.
-		for (int x = 0; x < width; x++) {
-			if (this->IsTransparent(xpos + x, ypos + y)) continue;
-
+		int x = NextOpaque(row, 0, width);
+		while (x < width) {
 			int start = x;
-			x++;
-			while (x < width) {
-				if (this->IsTransparent(xpos + x, ypos + y)) break;
-				x++;
-			}
+			x = NextTransparent(row, x + 1, width);
+
 			/* from 'start' up to and excluding 'x' are pixels to draw. */
 			while (last_stored + 127 < start) {
 				*ptr++ = 127; // 127 pixels gap, 0 pixels to draw.
@@ -437,6 +508,8 @@ uint8 *Image8bpp::Encode(int xpos, int ypos, int width, int height, int *size) c
 				start++;
 			}
 			last_stored = x;
+
+			x = NextOpaque(row, x + 1, width);
 		}
 		assert(last_header != nullptr);
 		*last_header |= 128; // This was the last sequence of pixels.
@@ -509,7 +582,7 @@ static inline uint8 GetA(uint32 rgba)
  * @param imf Image file to use.
  * @param mask Bitmask to apply, or \c nullptr.
  */
-Image32bpp::Image32bpp(const ImageFile *imf, BitMaskData *mask) : Image(imf, "32PX", 1, mask)
+Image32bpp::Image32bpp(const ImageFile *imf, BitMaskData *mask) : Image(imf, "32PX", 2, mask)
 {
 	this->recolour = nullptr;
 }
@@ -550,177 +623,196 @@ bool Image32bpp::IsTransparent(int xpos, int ypos) const
 }
 
 /**
- * Find out how many pixels at the line have the same recolour information.
- * @param x X position of the first pixel in the image to examine.
- * @param y Y position of the first pixel in the image to examine.
- * @param max_length Maximum number of pixels to test (should be at least \c 1).
- * @param count [out] Number of pixels with the same recolour information.
- * @return Value of the recolour information (at \a x, \a y).
+ * Delta-filter the rows of a pixel plane in place.
+ * Every byte gets replaced by its difference with the same channel of the previous
+ * pixel, turning runs of similar pixels into zero bytes for the compressor.
+ * @param plane Plane to filter.
+ * @param height Number of rows in the plane.
+ * @param row_bytes Number of bytes in a row.
+ * @param stride Number of bytes of one pixel.
  */
-uint8 Image32bpp::GetCurrentRecolour(int x, int y, int max_length, int *count) const
+static void FilterRows(uint8 *plane, int height, int row_bytes, int stride)
 {
-	if (this->recolour == nullptr) { // No recolour image available.
-		*count = max_length;
-		return 0;
+	for (int y = 0; y < height; y++) {
+		uint8 *row = plane + (size_t)y * row_bytes;
+		for (int i = row_bytes - 1; i >= stride; i--) row[i] -= row[i - stride];
 	}
+}
 
-	uint8 rec = recolour->GetPixel(x, y);
-	*count = 1;
-	x++;
-	max_length--;
-	while (max_length > 0) {
-		uint8 rr = recolour->GetPixel(x, y);
-		if (rr != rec) break;
-		(*count)++;
-		x++;
-		max_length--;
+uint8 *Image32bpp::Encode(int xpos, int ypos, int width, int height, int *size) const
+{
+	/* Version 2 encoding: the decoded pixel planes (RGBA, then recolour layer and
+	 * table index per pixel), row delta-filtered and compressed as one zlib stream. */
+	const size_t pixels = (size_t)width * height;
+	std::unique_ptr<uint8[]> planes(new uint8[pixels * 6]);
+	uint8 *rgba_ptr = planes.get();
+	uint8 *recol_ptr = planes.get() + pixels * 4;
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			uint32 pixel = this->GetPixel(xpos + x, ypos + y);
+			uint8 layer = (this->recolour != nullptr) ? this->recolour->GetPixel(xpos + x, ypos + y) : 0;
+			if (layer != 0) {
+				/* Recoloured pixel, the colour comes from the palette; only store the brightness. */
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = GetA(pixel);
+				*recol_ptr++ = layer;
+				*recol_ptr++ = std::max(std::max(GetR(pixel), GetG(pixel)), GetB(pixel));
+			} else if (GetA(pixel) == FULLY_TRANSPARENT) {
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = 0;
+				*rgba_ptr++ = 0;
+				*recol_ptr++ = 0;
+				*recol_ptr++ = 0;
+			} else {
+				*rgba_ptr++ = GetR(pixel);
+				*rgba_ptr++ = GetG(pixel);
+				*rgba_ptr++ = GetB(pixel);
+				*rgba_ptr++ = GetA(pixel);
+				*recol_ptr++ = 0;
+				*recol_ptr++ = 0;
+			}
+		}
 	}
-	return rec;
+	FilterRows(planes.get(), height, width * 4, 4);
+	FilterRows(planes.get() + pixels * 4, height, width * 2, 2);
+
+	uLongf comp_size = compressBound(pixels * 6);
+	std::unique_ptr<uint8[]> compressed(new uint8[comp_size]);
+	if (compress2(compressed.get(), &comp_size, planes.get(), pixels * 6, Z_BEST_COMPRESSION) != Z_OK) {
+		error("Failed to compress a 32bpp sprite\n");
+	}
+	uint8 *data = new uint8[comp_size];
+	memcpy(data, compressed.get(), comp_size);
+	*size = comp_size;
+	return data;
 }
 
 /**
- * Find how many pixels at a line from the given position, have the same opaqueness value.
- * @param x X position of the first pixel in the image to examine.
- * @param y Y position of the first pixel in the image to examine.
- * @param max_length Maximum number of pixels to test (should be at least \c 1).
- * @param count [out] Number of pixels with the same opaqueness value.
- * @return Value of the opaqueness (at \a x, \a y).
+ * Get a pixel accessor for a loaded image file, applying the given bit mask and recolour file.
+ * The accessors are cached for the duration of the run, so nodes referencing the same
+ * (file, mask, recolour) combination share one accessor instead of building their own.
+ * The caller must not delete the result; the cache keeps it and the decoded files alive.
+ * @param imf Loaded image file to access.
+ * @param mask Bit mask to apply first (\c nullptr for none).
+ * @param rmf Loaded 8bpp recolour file (\c nullptr for none, ignored for 8bpp images).
+ * @return Pixel accessor for the image.
  */
-uint8 Image32bpp::GetSameOpaqueness(int x, int y, int max_length, int *count) const
-{
-	uint8 a = GetA(this->GetPixel(x, y));
-	*count = 1;
-	x++;
-	max_length--;
-	while (max_length > 0) {
-		uint8 aa = GetA(this->GetPixel(x, y));
-		if (aa != a) break;
-		(*count)++;
-		x++;
-		max_length--;
+Image *GetCachedImage(const std::shared_ptr<const ImageFile> &imf, BitMaskData *mask, const std::shared_ptr<const ImageFile> &rmf)
+{
+	/** An %Image accessor owned by the cache, with the data it references. */
+	struct CachedImage {
+		std::unique_ptr<Image> image;           ///< The pixel accessor.
+		std::unique_ptr<Image8bpp> recolour;    ///< Recolour accessor referenced by #image (if any).
+		std::shared_ptr<const ImageFile> imf;   ///< Decoded image file, kept alive for #image.
+		std::shared_ptr<const ImageFile> rmf;   ///< Decoded recolour file, kept alive for #recolour.
+	};
+	static std::map<std::string, CachedImage> cache;
+
+	std::string key = imf->fname;
+	if (mask != nullptr) {
+		key += '|';
+		key += mask->type;
+		key += '@' + std::to_string(mask->x_pos) + ',' + std::to_string(mask->y_pos);
+	}
+	if (rmf != nullptr) {
+		key += '|';
+		key += rmf->fname;
 	}
-	return a;
+
+	auto it = cache.find(key);
+	if (it == cache.end()) {
+		CachedImage ci;
+		ci.imf = imf;
+		if (imf->Is8bpp()) {
+			ci.image.reset(new Image8bpp(imf.get(), mask));
+		} else {
+			Image32bpp *im = new Image32bpp(imf.get(), mask);
+			ci.image.reset(im);
+			if (rmf != nullptr) {
+				ci.rmf = rmf;
+				ci.recolour.reset(new Image8bpp(rmf.get(), nullptr));
+				im->SetRecolourImage(ci.recolour.get());
+			}
+		}
+		it = cache.emplace(key, std::move(ci)).first;
+	}
+	return it->second.image.get();
 }
 
-uint8 *Image32bpp::Encode(int xpos, int ypos, int width, int height, int *size) const
+/** Number of sprite encoder worker threads, \c -1 selects the number of hardware threads, \c 1 encodes serially. */
+int _sprite_encoder_jobs = -1;
+
+SpriteEncoderPool _sprite_encoder;  ///< The worker pool running the sprite encodes.
+
+SpriteEncoderPool::SpriteEncoderPool()
 {
-	/// \todo Add recolouring image handling.
-	//
-	auto row_sizes = std::vector<int>();
-	row_sizes.reserve(height);
+	this->busy = 0;
+	this->stop = false;
+	this->enqueued = 0;
+}
 
-	/* Decide size of each scanline. */
-	for (int y = 0; y < height; y++) {
-		int count = 0;
-		int x = 0;
-		while (x < width) {
-			int recolour_length, opaq_length;
-			uint8 recolour = GetCurrentRecolour(xpos + x, ypos + y, width - x, &recolour_length);
-			uint8 opaq = this->GetSameOpaqueness(xpos + x, ypos + y, recolour_length, &opaq_length);
-
-			if (recolour != 0) {
-				/* Recoloured pixels. */
-				if (opaq_length > 63) opaq_length = 63;
-				count += 1 + 1 + 1 + opaq_length;
-				x += opaq_length;
-				continue;
-			}
-			if (opaq == FULLY_OPAQUE) {
-				/* Plain fully opaque 24 bit pixels. */
-				if (opaq_length > 63) opaq_length = 63;
-				count += 1 + opaq_length * 3;
-				x += opaq_length;
-				continue;
-			}
-			if (opaq == FULLY_TRANSPARENT) {
-				/* Plain fully transparent pixels. */
-				if (opaq_length + x == width) break; // End of the line reached.
-
-				if (opaq_length > 63) opaq_length = 63;
-				count += 1;
-				x += opaq_length;
-				continue;
-			}
-			/* Partially transparent pixels. */
-			if (opaq_length > 63) opaq_length = 63;
-			count += 1 + 1 + opaq_length * 3;
-			x += opaq_length;
-		}
-		count++; // Terminating 0 byte
-		row_sizes.push_back(count);
+/** Destructor, shuts down the worker threads. */
+SpriteEncoderPool::~SpriteEncoderPool()
+{
+	this->Drain();
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stop = true;
 	}
+	this->task_added.notify_all();
+	for (std::thread &worker : this->workers) worker.join();
+}
 
-	*size = 0;
-	for (int y = 0; y < height; y++) {
-		assert(row_sizes[y] <= 0xFFFF - 2);
-		*size += 2 + row_sizes[y];
+/**
+ * Queue a sprite encode for execution by the worker threads.
+ * The worker threads are started when the first task is queued; with less than
+ * two jobs configured, the task is run immediately instead.
+ * @param task Encode to run.
+ */
+void SpriteEncoderPool::Enqueue(std::function<void()> task)
+{
+	this->enqueued++;
+	if (_sprite_encoder_jobs < 0) _sprite_encoder_jobs = std::max(1u, std::thread::hardware_concurrency());
+	if (_sprite_encoder_jobs < 2) {
+		task();
+		return;
 	}
-	uint8 *data = new uint8[*size];
-	uint8 *ptr = data;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->tasks.push_back(std::move(task));
+		if (this->workers.empty()) {
+			for (int i = 0; i < _sprite_encoder_jobs; i++) this->workers.emplace_back(&SpriteEncoderPool::Work, this);
+		}
+	}
+	this->task_added.notify_one();
+}
 
-	/* Store pixel data. */
-	for (int y = 0; y < height; y++) {
-		uint size = (y < height - 1) ? row_sizes[y] + 2 : 0;
-		*ptr++ = size & 0xff;
-		*ptr++ = (size >> 8) & 0xff;
+/** Wait until all queued encodes have finished. */
+void SpriteEncoderPool::Drain()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->task_done.wait(lock, [this]() { return this->tasks.empty() && this->busy == 0; });
+}
 
-		int x = 0;
-		while (x < width) {
-			int recolour_length, opaq_length;
-			uint8 recolour = GetCurrentRecolour(xpos + x, ypos + y, width - x, &recolour_length);
-			uint8 opaq = this->GetSameOpaqueness(xpos + x, ypos + y, recolour_length, &opaq_length);
-
-			if (recolour != 0) {
-				/* Recoloured pixels. */
-				if (opaq_length > 63) opaq_length = 63;
-				*ptr++ = 128 + 64 + opaq_length;
-				*ptr++ = recolour;
-				*ptr++ = opaq;
-				for (int dx = 0; dx < opaq_length; dx++) {
-					uint32 pixel = this->GetPixel(xpos + x, ypos + y);
-					*ptr++ = std::max(std::max(GetR(pixel), GetG(pixel)), GetB(pixel));
-					x++;
-				}
-				continue;
-			}
-			if (opaq == FULLY_OPAQUE) {
-				/* Plain fully opaque 24 bit pixels. */
-				if (opaq_length > 63) opaq_length = 63;
-				*ptr++ = 0 + opaq_length;
-				for (int dx = 0; dx < opaq_length; dx++) {
-					uint32 pixel = this->GetPixel(xpos + x, ypos + y);
-					*ptr++ = GetR(pixel);
-					*ptr++ = GetG(pixel);
-					*ptr++ = GetB(pixel);
-					x++;
-				}
-				continue;
-			}
-			if (opaq == FULLY_TRANSPARENT) {
-				/* Plain fully transparent pixels. */
-				if (opaq_length + x == width) break; // End of the line reached.
-
-				if (opaq_length > 63) opaq_length = 63;
-				*ptr++ = 128 + opaq_length;
-				x += opaq_length;
-				continue;
-			}
-			/* Partially transparent pixels. */
-			if (opaq_length > 63) opaq_length = 63;
-			*ptr++ = 64 + opaq_length;
-			*ptr++ = opaq;
-			for (int dx = 0; dx < opaq_length; dx++) {
-				uint32 pixel = this->GetPixel(xpos + x, ypos + y);
-				*ptr++ = GetR(pixel);
-				*ptr++ = GetG(pixel);
-				*ptr++ = GetB(pixel);
-				x++;
-			}
-		}
-		*ptr++ = 0; // Terminating 0 byte.
+/** Main loop of a worker thread. */
+void SpriteEncoderPool::Work()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+	for (;;) {
+		this->task_added.wait(lock, [this]() { return this->stop || !this->tasks.empty(); });
+		if (this->stop) return;
+		std::function<void()> task = std::move(this->tasks.front());
+		this->tasks.pop_front();
+		this->busy++;
+		lock.unlock();
+		task();
+		lock.lock();
+		this->busy--;
+		if (this->tasks.empty() && this->busy == 0) this->task_done.notify_all();
 	}
-	assert(ptr - data == *size);
-	return data;
 }
 
 SpriteImage::SpriteImage()
@@ -729,10 +821,12 @@ SpriteImage::SpriteImage()
 	this->data_size = 0;
 	this->width = 0;
 	this->height = 0;
+	this->encode_pending = false;
 }
 
 SpriteImage::~SpriteImage()
 {
+	if (this->encode_pending) _sprite_encoder.Drain();
 	delete[] this->data;
 }
 
@@ -751,6 +845,7 @@ SpriteImage::~SpriteImage()
 const char *SpriteImage::CopySprite(Image *img, int xoffset, int yoffset, int xpos, int ypos, int xsize, int ysize, bool crop)
 {
 	/* Remove any old data. */
+	if (this->encode_pending) _sprite_encoder.Drain();
 	delete[] this->data;
 	this->data = nullptr;
 	this->data_size = 0;
@@ -809,7 +904,11 @@ const char *SpriteImage::CopySprite(Image *img, int xoffset, int yoffset, int xp
 	this->yoffset = yoffset;
 	this->width = xsize;
 	this->height = ysize;
-	this->data = img->Encode(xpos, ypos, xsize, ysize, &this->data_size);
-	if (this->data == nullptr && this->data_size != 0) return "Cannot store sprite (not enough memory)";
+	this->encode_pending = true;
+	_sprite_encoder.Enqueue([this, img, xpos, ypos, xsize, ysize]() {
+		this->data = img->Encode(xpos, ypos, xsize, ysize, &this->data_size);
+		if (this->data == nullptr && this->data_size != 0) error("Cannot store sprite (not enough memory)\n");
+		this->encode_pending = false;
+	});
 	return nullptr;
 }
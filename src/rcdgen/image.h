@@ -10,7 +10,14 @@
 #ifndef IMAGE_H
 #define IMAGE_H
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <png.h>
 
 /** Bitmask description. */
@@ -79,6 +86,8 @@ protected:
 	int mask_xpos;               ///< X position of the left of the mask.
 	int mask_ypos;               ///< Y position of the top of the mask.
 	const MaskInformation *mask; ///< Information about the used bitmask (or \c nullptr).
+	std::vector<uint64> mask_rows; ///< Mask bitmap expanded to 64 bit words (a set bit means the pixel is visible).
+	int mask_words_per_row;      ///< Number of words of one row in #mask_rows.
 };
 
 /** An 8bpp image. */
@@ -103,12 +112,51 @@ public:
 	virtual uint8 *Encode(int xpos, int ypos, int width, int height, int *size) const override;
 
 protected:
-	uint8 GetCurrentRecolour(int x, int y, int max_length, int *count) const;
-	uint8 GetSameOpaqueness(int x, int y, int max_length, int *count) const;
-
 	Image8bpp *recolour; ///< Recolour information (not owned by this class).
 };
 
+/**
+ * Worker pool running sprite encodings concurrently.
+ * Sprite sheets yield many independent sprites, and encoding them is pure CPU work on
+ * read-only image data, so encodes are queued here and executed by a fixed set of worker
+ * threads. #Drain must be called before the source image of a queued encode is destroyed,
+ * and before the result of the encode is used.
+ */
+class SpriteEncoderPool {
+public:
+	SpriteEncoderPool();
+	~SpriteEncoderPool();
+
+	void Enqueue(std::function<void()> task);
+	void Drain();
+
+	/**
+	 * Get the number of sprite encodes queued so far.
+	 * @return Number of queued encodes.
+	 */
+	size_t Enqueued() const
+	{
+		return this->enqueued;
+	}
+
+private:
+	void Work();
+
+	std::vector<std::thread> workers;         ///< Worker threads, started when the first task is queued.
+	std::deque<std::function<void()>> tasks;  ///< Queued encodes not yet picked up by a worker.
+	std::mutex mutex;                         ///< Protects #tasks, #busy, and #stop.
+	std::condition_variable task_added;       ///< Signalled when a task is queued or the pool shuts down.
+	std::condition_variable task_done;        ///< Signalled when a worker finishes a task.
+	int busy;                                 ///< Number of tasks currently being executed by a worker.
+	bool stop;                                ///< Whether the workers should exit.
+	std::atomic<size_t> enqueued;             ///< Total number of tasks queued so far (for profiling).
+};
+
+extern SpriteEncoderPool _sprite_encoder;
+extern int _sprite_encoder_jobs;
+
+Image *GetCachedImage(const std::shared_ptr<const ImageFile> &imf, BitMaskData *mask, const std::shared_ptr<const ImageFile> &rmf);
+
 /** A Sprite. */
 class SpriteImage {
 public:
@@ -126,6 +174,8 @@ public:
 
 	uint8 *data;   ///< Compressed image data.
 	int data_size; ///< Size of the #data field.
+
+	std::atomic<bool> encode_pending;  ///< Whether an encode for this sprite is still queued or running.
 };
 
 #endif
@@ -9,6 +9,7 @@
 
 #include "../stdafx.h"
 #include <cmath>
+#include <string_view>
 #include "ast.h"
 #include "nodes.h"
 #include "string_storage.h"
@@ -265,14 +266,10 @@ SheetBlock::SheetBlock(const Position &pos) : pos(pos)
 	this->imf = nullptr;
 	this->img_sheet = nullptr;
 	this->rmf = nullptr;
-	this->rim = nullptr;
 }
 
 SheetBlock::~SheetBlock()
-{
-	delete this->img_sheet;
-	delete this->rim;
-}
+= default;
 
 /**
  * Get the sprite sheet. Loads the sheet from the disk on the first call.
@@ -290,26 +287,20 @@ Image *SheetBlock::GetSheet()
 	}
 	BitMaskData *bmd = (this->mask == nullptr) ? nullptr : &this->mask->data;
 	if (this->imf->Is8bpp()) {
-		this->img_sheet = new Image8bpp(this->imf.get(), bmd);
 		if (!this->recolour.empty()) fprintf(stderr, "Error at %s, cannot recolour an 8bpp image, ignoring the file.\n", this->pos.ToString());
-	} else {
-		Image32bpp *im = new Image32bpp(this->imf.get(), bmd);
-		this->img_sheet = im;
-		if (!this->recolour.empty()) {
-			this->rmf.reset();
-			const char *err = ImageFile::LoadFile(this->recolour, this->rmf);
-			if (err != nullptr) {
-				fprintf(stderr, "Error at %s, loading of the recolour file failed: %s\n", this->pos.ToString(), err);
-				exit(1);
-			}
-			if (!this->rmf->Is8bpp()) {
-				fprintf(stderr, "Error at %s, recolour file must be an 8bpp image.\n", this->pos.ToString());
-				exit(1);
-			}
-			this->rim = new Image8bpp(this->rmf.get(), nullptr);
-			im->SetRecolourImage(this->rim);
+	} else if (!this->recolour.empty()) {
+		this->rmf.reset();
+		const char *err = ImageFile::LoadFile(this->recolour, this->rmf);
+		if (err != nullptr) {
+			fprintf(stderr, "Error at %s, loading of the recolour file failed: %s\n", this->pos.ToString(), err);
+			exit(1);
+		}
+		if (!this->rmf->Is8bpp()) {
+			fprintf(stderr, "Error at %s, recolour file must be an 8bpp image.\n", this->pos.ToString());
+			exit(1);
 		}
 	}
+	this->img_sheet = GetCachedImage(this->imf, bmd, this->rmf);
 	return this->img_sheet;
 }
 
@@ -345,37 +336,27 @@ report_error:
 
 	std::shared_ptr<const ImageFile> imf;
 	std::shared_ptr<const ImageFile> rmf;
-	Image *img = nullptr;
-	Image8bpp *rim = nullptr;
 
 	err = ImageFile::LoadFile(this->file.MakeFilename(col), imf);
 	if (err != nullptr) goto report_error;
 
 	BitMaskData *bmd = (this->mask == nullptr) ? nullptr : &this->mask->data;
 	if (imf->Is8bpp()) {
-		img = new Image8bpp(imf.get(), bmd);
 		if (this->recolour.length >= 0) fprintf(stderr, "Error at %s, cannot recolour an 8bpp image, ignoring the file.\n", this->pos.ToString());
-	} else {
-		Image32bpp *im32 = new Image32bpp(imf.get(), bmd);
-		img = im32;
-		if (this->recolour.length >= 0) {
-			err = ImageFile::LoadFile(this->recolour.MakeFilename(col), rmf);
-			if (err != nullptr) goto report_error;
-			if (!rmf->Is8bpp()) {
-				err = "Recolour file is not an 8bpp image.\n";
-				goto report_error;
-			}
-			rim = new Image8bpp(rmf.get(), nullptr);
-			im32->SetRecolourImage(rim);
+	} else if (this->recolour.length >= 0) {
+		err = ImageFile::LoadFile(this->recolour.MakeFilename(col), rmf);
+		if (err != nullptr) goto report_error;
+		if (!rmf->Is8bpp()) {
+			err = "Recolour file is not an 8bpp image.\n";
+			goto report_error;
 		}
 	}
 
 	std::shared_ptr<SpriteBlock> spr_blk(new SpriteBlock);
-	err = spr_blk->sprite_image.CopySprite(img, this->xoffset, this->yoffset, this->xbase, this->ybase, this->width, this->height, this->crop);
+	err = spr_blk->sprite_image.CopySprite(GetCachedImage(imf, bmd, rmf),
+			this->xoffset, this->yoffset, this->xbase, this->ybase, this->width, this->height, this->crop);
 	if (err != nullptr) goto report_error;
 
-	delete img;
-	delete rim;
 	return spr_blk;
 }
 
@@ -664,16 +645,17 @@ StringsNode::StringsNode()
  */
 void StringsNode::Add(const StringNode &node, const Position &pos)
 {
-	for (const auto &iter : this->strings) {
+	std::vector<const StringNode *> &same_name = this->strings_by_name[node.name];
+	for (const StringNode *iter : same_name) {
 		/* Check for duplicates: No same names with same language and same key. */
-		if (iter.name != node.name) continue;
-		if (iter.lang_index >= 0 && node.lang_index >= 0 && iter.lang_index != node.lang_index) continue;
-		if (iter.key.empty() || node.key.empty() || iter.key != node.key) continue;
+		if (iter->lang_index >= 0 && node.lang_index >= 0 && iter->lang_index != node.lang_index) continue;
+		if (iter->key.empty() || node.key.empty() || iter->key != node.key) continue;
 		fprintf(stderr, "Error at %s: ", node.text_pos.ToString());
-		fprintf(stderr, "\"string node\" conflicts with node at %s\n", iter.text_pos.ToString());
+		fprintf(stderr, "\"string node\" conflicts with node at %s\n", iter->text_pos.ToString());
 		exit(1);
 	}
 	this->strings.push_back(node);
+	same_name.push_back(&this->strings.back());
 	if (!this->key.empty()) {
 		if (node.key.empty()) {
 			this->strings.back().key = this->key;
@@ -873,16 +855,13 @@ void StringBundle::CheckTranslations(const char *names[], int name_count, const
 	}
 
 	/* Check that the bundle has no extra strings. */
+	std::set<std::string_view> expected;
+	for (int i = 0; i < name_count; i++) expected.insert(names[i]);
 	for (const auto &text : this->texts) {
 		if (_strings_storage.keys_to_ignore.count(text.first) > 0) continue;
-		bool found = false;
-		for (int i = 0; i < name_count; i++) {
-			if (names[i] == text.first) {
-				found = true;
-				break;
-			}
+		if (expected.count(std::string_view(text.first)) == 0) {
+			printf("Warning at %s: String \"%s\" is not needed.\n", pos.ToString(), text.first.c_str());
 		}
-		if (!found) printf("Warning at %s: String \"%s\" is not needed.\n", pos.ToString(), text.first.c_str());
 	}
 
 	/* Check that all necessary strings exist. */
@@ -909,7 +888,7 @@ void StringBundle::CheckTranslations(const char *names[], int name_count, const
 	for (uint i = 0; i < missing_count.size(); i++) {
 		if (static_cast<int>(i) == SOURCE_LANGUAGE) continue;  // There are no "missing" British English strings.
 		if (missing_count[i] > 0) {
-			printf("Language %s has %i missing translations in %s\n", _all_languages[i].name, missing_count[i], pos.filename.c_str());
+			printf("Language %s has %i missing translations in %s\n", _all_languages[i].name, missing_count[i], pos.filename->c_str());
 		}
 	}
 }
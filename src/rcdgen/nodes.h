@@ -153,10 +153,9 @@ public:
 	bool crop;    ///< Crop sprite.
 
 	std::shared_ptr<const ImageFile> imf;  ///< Loaded image file.
-	Image *img_sheet;                      ///< Sheet of images.
+	Image *img_sheet;                      ///< Sheet of images (owned by the image cache).
 	std::shared_ptr<BitMask> mask;         ///< Bit mask to apply first (if available).
 	std::shared_ptr<const ImageFile> rmf;  ///< Loaded recolour file.
-	Image8bpp *rim;                        ///< Recolour image.
 };
 
 /** A 'spritefiles' block. */
@@ -556,6 +555,7 @@ public:
 
 private:
 	std::string key; ///< Key associated with the strings, if any.
+	std::map<std::string, std::vector<const StringNode *>> strings_by_name; ///< Stored strings grouped by name, for fast duplicate detection.
 };
 
 /** Texts (translations) of a single string. */
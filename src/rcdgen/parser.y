@@ -38,7 +38,7 @@ Program : NamedValueList {
         ;
 
 ExpressionList : Expression {
-	$$ = std::make_shared<ExpressionList>();
+	$$ = MakeAstNode<ExpressionList>();
 	$$->exprs.push_back($1);
 }
                ;
@@ -55,19 +55,19 @@ Expression : ShiftTerm {
 
 Expression : Expression AND ShiftTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '&', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '&', $3);
 }
            ;
 
 Expression : Expression PIPE ShiftTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '|', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '|', $3);
 }
            ;
 
 Expression : Expression XOR ShiftTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '^', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '^', $3);
 }
            ;
 
@@ -79,13 +79,13 @@ ShiftTerm : AddTerm {
 
 ShiftTerm : ShiftTerm SHL AddTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '<', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '<', $3);
 }
           ;
 
 ShiftTerm : ShiftTerm SHR AddTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '>', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '>', $3);
 }
           ;
 
@@ -97,13 +97,13 @@ AddTerm : MulTerm {
 
 AddTerm : AddTerm ADD MulTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '+', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '+', $3);
 }
            ;
 
 AddTerm : AddTerm MINUS MulTerm {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '-', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '-', $3);
 }
            ;
 
@@ -115,19 +115,19 @@ MulTerm : Term {
 
 MulTerm : MulTerm MUL Term {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '*', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '*', $3);
 }
         ;
 
 MulTerm : MulTerm DIV Term {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '/', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '/', $3);
 }
         ;
 
 MulTerm : MulTerm MOD Term {
 	Position pos(filename, $2);
-	$$ = std::make_shared<BinaryOperator>(pos, $1, '%', $3);
+	$$ = MakeAstNode<BinaryOperator>(pos, $1, '%', $3);
 }
         ;
 
@@ -139,45 +139,45 @@ Term : Factor {
 
 Term : MINUS Factor {
 	Position pos(filename, $1);
-	$$ = std::make_shared<UnaryOperator>(pos, '-', $2);
+	$$ = MakeAstNode<UnaryOperator>(pos, '-', $2);
 }
      ;
 
 Term : NEG Factor {
 	Position pos(filename, $1);
-	$$ = std::make_shared<UnaryOperator>(pos, '~', $2);
+	$$ = MakeAstNode<UnaryOperator>(pos, '~', $2);
 }
      ;
 
 /* Elementary expressions. */
 Factor : STRING {
 	Position pos(filename, $1.line);
-	$$ = std::make_shared<StringLiteral>(pos, $1.value);
+	$$ = MakeAstNode<StringLiteral>(pos, $1.value);
 }
        ;
 
 Factor : NUMBER {
 	Position pos(filename, $1.line);
-	$$ = std::make_shared<NumberLiteral>(pos, $1.value);
+	$$ = MakeAstNode<NumberLiteral>(pos, $1.value);
 }
        ;
 
 Factor : IDENTIFIER {
 	Position pos(filename, $1.line);
 	CheckIsSingleName($1.value, pos);
-	$$ = std::make_shared<IdentifierLiteral>(pos, $1.value);
+	$$ = MakeAstNode<IdentifierLiteral>(pos, $1.value);
 }
        ;
 
 Factor : BITSET_KW PAR_OPEN PAR_CLOSE {
 	Position pos(filename, $1);
-	$$ = std::make_shared<BitSet>(pos, nullptr);
+	$$ = MakeAstNode<BitSet>(pos, nullptr);
 }
        ;
 
 Factor : BITSET_KW PAR_OPEN ExpressionList PAR_CLOSE {
 	Position pos(filename, $1);
-	$$ = std::make_shared<BitSet>(pos, $3);
+	$$ = MakeAstNode<BitSet>(pos, $3);
 }
        ;
 
@@ -187,7 +187,7 @@ Factor : PAR_OPEN Expression PAR_CLOSE {
        ;
 
 NamedValueList : /* Empty */ {
-	$$ = std::make_shared<NamedValueList>();
+	$$ = MakeAstNode<NamedValueList>();
 }
                ;
 
@@ -198,35 +198,35 @@ NamedValueList : NamedValueList NamedValue {
                ;
 
 NamedValue : Group {
-	$$ = std::make_shared<NamedValue>(nullptr, $1);
+	$$ = MakeAstNode<NamedValue>(nullptr, $1);
 }
            ;
 
 NamedValue : IDENTIFIER COLON Group {
 	Position pos(filename, $1.line);
 	CheckIsSingleName($1.value, pos);
-	std::shared_ptr<Name> name = std::make_shared<SingleName>(pos, $1.value);
-	$$ = std::make_shared<NamedValue>(name, $3);
+	std::shared_ptr<Name> name = MakeAstNode<SingleName>(pos, $1.value);
+	$$ = MakeAstNode<NamedValue>(name, $3);
 }
            ;
 
 NamedValue : IDENTIFIER COLON Expression SEMICOLON {
 	Position pos(filename, $1.line);
 	CheckIsSingleName($1.value, pos);
-	std::shared_ptr<Name> name = std::make_shared<SingleName>(pos, $1.value);
-	std::shared_ptr<Group> group = std::make_shared<ExpressionGroup>($3);
-	$$ = std::make_shared<NamedValue>(name, group);
+	std::shared_ptr<Name> name = MakeAstNode<SingleName>(pos, $1.value);
+	std::shared_ptr<Group> group = MakeAstNode<ExpressionGroup>($3);
+	$$ = MakeAstNode<NamedValue>(name, group);
 }
            ;
 
 NamedValue : IdentifierTable COLON Group {
-	$$ = std::make_shared<NamedValue>($1, $3);
+	$$ = MakeAstNode<NamedValue>($1, $3);
 }
            ;
 
 NamedValue : IMPORT_KW STRING SEMICOLON {
 	Position pos(filename, $1);
-	$$ = std::make_shared<ImportValue>(pos, $2.value);
+	$$ = MakeAstNode<ImportValue>(pos, $2.value);
 }
            ;
 
@@ -236,7 +236,7 @@ IdentifierTable : PAR_OPEN IdentifierRows PAR_CLOSE {
                 ;
 
 IdentifierRows : IdentifierRow {
-	$$ = std::make_shared<NameTable>();
+	$$ = MakeAstNode<NameTable>();
 	$$->rows.push_back($1);
 }
                ;
@@ -248,9 +248,9 @@ IdentifierRows : IdentifierRows PIPE IdentifierRow {
                ;
 
 IdentifierRow : IDENTIFIER {
-	$$ = std::make_shared<NameRow>();
+	$$ = MakeAstNode<NameRow>();
 	Position pos(filename, $1.line);
-	std::shared_ptr<IdentifierLine> il = std::make_shared<IdentifierLine>(pos, $1.value);
+	std::shared_ptr<IdentifierLine> il = MakeAstNode<IdentifierLine>(pos, $1.value);
 	$$->identifiers.push_back(il);
 }
               ;
@@ -258,7 +258,7 @@ IdentifierRow : IDENTIFIER {
 IdentifierRow : IdentifierRow COMMA IDENTIFIER {
 	$$ = $1;
 	Position pos(filename, $3.line);
-	std::shared_ptr<IdentifierLine> il = std::make_shared<IdentifierLine>(pos, $3.value);
+	std::shared_ptr<IdentifierLine> il = MakeAstNode<IdentifierLine>(pos, $3.value);
 	$$->identifiers.push_back(il);
 }
               ;
@@ -266,14 +266,14 @@ IdentifierRow : IdentifierRow COMMA IDENTIFIER {
 Group : IDENTIFIER CURLY_OPEN NamedValueList CURLY_CLOSE {
 	Position pos(filename, $1.line);
 	CheckIsSingleName($1.value, pos);
-	$$ = std::make_shared<NodeGroup>(pos, $1.value, nullptr, $3);
+	$$ = MakeAstNode<NodeGroup>(pos, $1.value, nullptr, $3);
 }
       ;
 
 Group : IDENTIFIER PAR_OPEN ExpressionList PAR_CLOSE CURLY_OPEN NamedValueList CURLY_CLOSE {
 	Position pos(filename, $1.line);
 	CheckIsSingleName($1.value, pos);
-	$$ = std::make_shared<NodeGroup>(pos, $1.value, $3, $6);
+	$$ = MakeAstNode<NodeGroup>(pos, $1.value, $3, $6);
 }
       ;
 
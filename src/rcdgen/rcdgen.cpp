@@ -12,9 +12,11 @@
 #include "../string_func.h"
 #include "scanner_funcs.h"
 #include "ast.h"
+#include "build_cache.h"
 #include "nodes.h"
 #include "string_storage.h"
 #include "file_writing.h"
+#include <chrono>
 #include <cstdarg>
 
 /**
@@ -40,9 +42,24 @@ static const OptionData _options[] = {
 	GETOPT_VALUE('c', "--code"),
 	GETOPT_VALUE('b', "--base"),
 	GETOPT_VALUE('p', "--prefix"),
+	GETOPT_VALUE('j', "--jobs"),
+	GETOPT_NOVAL('P', "--profile"),
 	GETOPT_END()
 };
 
+static bool _profile = false; ///< Whether to print per-phase profiling reports while generating RCD files.
+
+/**
+ * Get the number of milliseconds between two time points, for profiling output.
+ * @param start Start of the measured interval.
+ * @param end End of the measured interval.
+ * @return Elapsed wall clock time, in milliseconds.
+ */
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start, const std::chrono::steady_clock::time_point &end)
+{
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
 /** Output online help. */
 static void PrintUsage()
 {
@@ -54,7 +71,12 @@ static void PrintUsage()
 	printf("\n");
 	printf("2. Generate RCD data files from input files or stdin:\n");
 	printf("\n");
-	printf("\trcdgen [FILE ...]\n");
+	printf("\trcdgen [--jobs JOBS] [--profile] [FILE ...]\n");
+	printf("\n");
+	printf("   JOBS   is the number of threads encoding sprites concurrently.\n");
+	printf("          If omitted, one thread per hardware thread is used; \"1\" encodes serially.\n");
+	printf("   --profile prints machine readable \"PROFILE\" lines to stdout, reporting\n");
+	printf("          elapsed time and allocation counts per phase, and size per output block kind.\n");
 	printf("\n");
 	printf("3. Generate .h and/or .cpp files for strings of the program:\n");
 	printf("\n");
@@ -106,6 +128,14 @@ int main(int argc, char *argv[])
 				prefix = opt_data.opt;
 				break;
 
+			case 'j':
+				_sprite_encoder_jobs = std::max(1, atoi(opt_data.opt));
+				break;
+
+			case 'P':
+				_profile = true;
+				break;
+
 			case -1:
 				break;
 
@@ -127,12 +157,14 @@ int main(int argc, char *argv[])
 	if (header != nullptr) printf("Warning: --header option is not used.\n");
 	if (code != nullptr) printf("Warning: --code option is not used.\n");
 
+	std::vector<std::string> lang_files;
 	int num_files = std::max(1, opt_data.numleft);
 	for (int i = 0; i < num_files; i++) {
 		assert(i < opt_data.numleft);
 		if (StrEndsWith(opt_data.argv[i], ".yml", false) || StrEndsWith(opt_data.argv[i], ".yaml", false)) {
 			/* Translations. Update the strings storage and proceed with the next file. */
 			_strings_storage.ReadFromYAML(opt_data.argv[i]);
+			lang_files.push_back(opt_data.argv[i]);
 			continue;
 		} else if (!StrEndsWith(opt_data.argv[i], ".fpp", false)) {
 			if (StrEndsWith(opt_data.argv[i], ".fml", false)) {
@@ -145,21 +177,44 @@ int main(int argc, char *argv[])
 			exit(1);
 		}
 
+		/* Phase 0: Restore the output files from the cache if no input changed. */
+		ClearBuildCacheRun();
+		if (LoadFromBuildCache(opt_data.argv[i], lang_files)) continue;
+		size_t sprites_before = _sprite_encoder.Enqueued();
+
 		/* Phase 1: Parse the input file. */
+		std::chrono::steady_clock::time_point parse_start = std::chrono::steady_clock::now();
 		std::shared_ptr<NamedValueList> nvs = LoadFile(opt_data.argv[i]);
+		std::chrono::steady_clock::time_point parse_end = std::chrono::steady_clock::now();
 
 		/* Phase 2: Check and simplify the loaded input. */
 		FileNodeList *file_nodes = CheckTree(nvs);
 		nvs = nullptr;
+		std::chrono::steady_clock::time_point check_end = std::chrono::steady_clock::now();
 
 		/* Phase 3: Construct output files. */
+		_sprite_encoder.Drain();  // All queued sprite encodes must have finished before their data is written.
+		std::chrono::steady_clock::time_point encode_end = std::chrono::steady_clock::now();
 		for (const auto& iter : file_nodes->files) {
 			FileWriter fw;
 			iter->Write(&fw);
 			fw.WriteFile(iter->file_name);
+			RegisterBuildCacheOutput(iter->file_name);
+			if (_profile) fw.PrintBlockProfile(iter->file_name);
+		}
+		std::chrono::steady_clock::time_point write_end = std::chrono::steady_clock::now();
+
+		if (_profile) {
+			printf("PROFILE file %s parse_ms %.1f check_ms %.1f encode_wait_ms %.1f write_ms %.1f ast_allocs %llu ast_bytes %llu sprites_encoded %llu\n",
+					opt_data.argv[i], ElapsedMs(parse_start, parse_end), ElapsedMs(parse_end, check_end),
+					ElapsedMs(check_end, encode_end), ElapsedMs(encode_end, write_end),
+					(unsigned long long)_ast_arena.Allocations(), (unsigned long long)_ast_arena.AllocatedBytes(),
+					(unsigned long long)(_sprite_encoder.Enqueued() - sprites_before));
 		}
 
 		delete file_nodes;
+		WriteBuildCacheManifest(opt_data.argv[i], lang_files);
+		_ast_arena.Clear(); // The AST of this file is no longer referenced, release its nodes wholesale.
 	}
 	exit(0);
 }
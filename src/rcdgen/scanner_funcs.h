@@ -55,4 +55,14 @@ extern std::shared_ptr<NamedValueList> _parsed_data; ///< Result of parsing the
  */
 void SetupScanner(const char *fname, FILE *new_file);
 
+/**
+ * Setup the scanner to tokenize an in-memory buffer.
+ * The entire input file is handed over at once, so the scanner lexes it in one
+ * batch instead of refilling a window from stdio.
+ * @param fname Name of the file the buffer was read from.
+ * @param buffer Text to tokenize, followed by two \c '\0' sentinel bytes.
+ * @param size Size of the buffer, including the two sentinel bytes.
+ */
+void SetupScannerBuffer(const char *fname, char *buffer, size_t size);
+
 #endif
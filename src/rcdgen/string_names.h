@@ -297,6 +297,8 @@ static const char *_gui_string_names[] = {
 	"TERRAFORM_SUB_TOOLTIP",
 	"TERRAFORM_LEVEL_TEXT",
 	"TERRAFORM_MOVE_TEXT",
+	"TERRAFORM_SMOOTH_TEXT",
+	"TERRAFORM_FLATTEN_TEXT",
 	"TERRAFORM_OWNER_UNCHANGED_TEXT",
 	"TERRAFORM_OWNER_NONE_TEXT",
 	"TERRAFORM_OWNER_PARK_TEXT",
@@ -328,6 +330,7 @@ static const char *_gui_string_names[] = {
 
 	/* Minimap window. */
 	"MINIMAP_TITLE",
+	"MINIMAP_CROWDS",
 
 	/* Finances window. */
 	"FINANCES_TITLE",
@@ -375,6 +378,8 @@ static const char *_gui_string_names[] = {
 	"MESSAGE_AWARD_WON",         ///< The park has won an award.
 	"MESSAGE_NEGATIVE_AWARD",    ///< The park has received a negative award.
 	"MESSAGE_COMPLAIN_VANDALISM",  ///< Lots of park objects are demolished.
+	"MESSAGE_SAVE_COMPLETE",     ///< A savegame has been written to disk in the background.
+	"MESSAGE_SAVE_FAILED",       ///< A savegame could not be written to disk.
 
 	/* Coaster construction window. */
 	"COASTER_BUILD_LEFT_BEND_TOOLTIP",
@@ -158,6 +158,20 @@ HorVert ParameterizedName::DecodeName(const char *name, const Position &pos)
 	this->variant = new char[(p - name) + 1];
 	memcpy(this->name, name, (p - name) + 1);
 
+	/* Compile the expansion plan, so #GetParmName only copies segments and formats numbers. */
+	this->segments.clear();
+	const ParameterizedNameRange *ordered[2];
+	int range_count = 0;
+	if (this->hor_range.used) ordered[range_count++] = &this->hor_range;
+	if (this->vert_range.used) ordered[range_count++] = &this->vert_range;
+	if (range_count == 2 && ordered[0]->offset > ordered[1]->offset) std::swap(ordered[0], ordered[1]);
+	int start = 0;
+	for (int i = 0; i < range_count; i++) {
+		this->segments.push_back({std::string(name + start, ordered[i]->offset - start), ordered[i]});
+		start = ordered[i]->offset + ordered[i]->length;
+	}
+	this->segments.push_back({std::string(name + start), nullptr});
+
 	return this->result;
 }
 
@@ -171,22 +185,14 @@ const char *ParameterizedName::GetParmName(int row, int col)
 {
 	assert(this->variant != nullptr);
 	char *dest = this->variant;
-	int i = 0;
-	while (this->name[i] != '\0') {
-		if (this->hor_range.used && this->hor_range.offset == i) {
-			dest += sprintf(dest, "%d", this->hor_range.min_value + col);
-			i = this->hor_range.offset + this->hor_range.length;
-			continue;
-		}
-		if (this->vert_range.used && this->vert_range.offset == i) {
-			dest += sprintf(dest, "%d", this->vert_range.min_value + row);
-			i = this->vert_range.offset + this->vert_range.length;
-			continue;
-		}
-		*dest++ = this->name[i++];
+	for (const NameSegment &seg : this->segments) {
+		memcpy(dest, seg.text.c_str(), seg.text.size());
+		dest += seg.text.size();
+		if (seg.range == nullptr) continue;
+		dest += sprintf(dest, "%d", seg.range->min_value + (seg.range == &this->hor_range ? col : row));
 	}
 	*dest = '\0';
-	assert(dest - this->variant <= i); // No buffer overflow.
+	assert(dest - this->variant <= (ptrdiff_t)strlen(this->name)); // No buffer overflow.
 	return this->variant;
 }
 
@@ -10,6 +10,8 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <vector>
+
 class Position;
 
 /** Data about one range in a parameterized name. */
@@ -53,6 +55,14 @@ public:
 	ParameterizedNameRange vert_range; ///< Information about the vertical range.
 
 	static bool HasNoParameters(const std::string &name);
+
+private:
+	/** A literal piece of the name, followed by an optional parameter value. */
+	struct NameSegment {
+		std::string text;                    ///< Literal text before the parameter.
+		const ParameterizedNameRange *range; ///< Range providing the value after #text, \c nullptr for the tail segment.
+	};
+	std::vector<NameSegment> segments; ///< Expansion plan of the name, compiled once by #DecodeName.
 };
 
 void CheckIsSingleName(const std::string &name, const Position &pos);
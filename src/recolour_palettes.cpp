@@ -10,1248 +10,1229 @@
 #include "stdafx.h"
 #include "palette.h"
 
-/** Recolour table for ColoureRange::COL_RANGE_GREY. */
-static const uint32 _recolour00[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  2,  2, 0), MakeRGBA(  2,  4,  4, 0), MakeRGBA(  4,  5,  5, 0),
-	MakeRGBA(  5,  7,  7, 0), MakeRGBA(  6,  9,  9, 0), MakeRGBA(  7, 11, 11, 0), MakeRGBA(  8, 12, 12, 0),
-	MakeRGBA(  9, 14, 14, 0), MakeRGBA( 11, 16, 16, 0), MakeRGBA( 12, 18, 18, 0), MakeRGBA( 13, 20, 20, 0),
-	MakeRGBA( 14, 21, 21, 0), MakeRGBA( 15, 23, 23, 0), MakeRGBA( 16, 25, 25, 0), MakeRGBA( 18, 27, 27, 0),
-	MakeRGBA( 19, 28, 28, 0), MakeRGBA( 20, 30, 30, 0), MakeRGBA( 21, 32, 32, 0), MakeRGBA( 22, 34, 34, 0),
-	MakeRGBA( 23, 35, 35, 0), MakeRGBA( 24, 36, 36, 0), MakeRGBA( 24, 37, 37, 0), MakeRGBA( 25, 38, 38, 0),
-	MakeRGBA( 26, 39, 39, 0), MakeRGBA( 26, 39, 39, 0), MakeRGBA( 27, 40, 40, 0), MakeRGBA( 27, 41, 41, 0),
-	MakeRGBA( 28, 42, 42, 0), MakeRGBA( 29, 43, 43, 0), MakeRGBA( 29, 43, 43, 0), MakeRGBA( 30, 44, 44, 0),
-	MakeRGBA( 31, 45, 45, 0), MakeRGBA( 31, 46, 46, 0), MakeRGBA( 32, 47, 47, 0), MakeRGBA( 32, 47, 47, 0),
-	MakeRGBA( 33, 48, 48, 0), MakeRGBA( 34, 49, 49, 0), MakeRGBA( 34, 50, 50, 0), MakeRGBA( 35, 51, 51, 0),
-	MakeRGBA( 35, 52, 52, 0), MakeRGBA( 36, 52, 52, 0), MakeRGBA( 37, 53, 53, 0), MakeRGBA( 37, 54, 54, 0),
-	MakeRGBA( 38, 55, 55, 0), MakeRGBA( 38, 56, 56, 0), MakeRGBA( 39, 56, 56, 0), MakeRGBA( 40, 57, 57, 0),
-	MakeRGBA( 40, 58, 58, 0), MakeRGBA( 41, 59, 59, 0), MakeRGBA( 41, 60, 60, 0), MakeRGBA( 42, 60, 60, 0),
-	MakeRGBA( 43, 61, 61, 0), MakeRGBA( 43, 62, 62, 0), MakeRGBA( 44, 63, 63, 0), MakeRGBA( 45, 64, 64, 0),
-	MakeRGBA( 45, 65, 65, 0), MakeRGBA( 46, 65, 65, 0), MakeRGBA( 46, 66, 66, 0), MakeRGBA( 47, 67, 67, 0),
-	MakeRGBA( 48, 68, 68, 0), MakeRGBA( 49, 69, 69, 0), MakeRGBA( 49, 69, 69, 0), MakeRGBA( 50, 70, 70, 0),
-	MakeRGBA( 51, 71, 71, 0), MakeRGBA( 52, 72, 72, 0), MakeRGBA( 53, 73, 73, 0), MakeRGBA( 53, 73, 73, 0),
-	MakeRGBA( 54, 74, 74, 0), MakeRGBA( 55, 75, 75, 0), MakeRGBA( 56, 76, 76, 0), MakeRGBA( 57, 77, 77, 0),
-	MakeRGBA( 58, 78, 78, 0), MakeRGBA( 58, 78, 78, 0), MakeRGBA( 59, 79, 79, 0), MakeRGBA( 60, 80, 80, 0),
-	MakeRGBA( 61, 81, 81, 0), MakeRGBA( 62, 82, 82, 0), MakeRGBA( 62, 82, 82, 0), MakeRGBA( 63, 83, 83, 0),
-	MakeRGBA( 64, 84, 84, 0), MakeRGBA( 64, 85, 85, 0), MakeRGBA( 65, 86, 86, 0), MakeRGBA( 66, 86, 86, 0),
-	MakeRGBA( 66, 87, 87, 0), MakeRGBA( 67, 88, 88, 0), MakeRGBA( 67, 89, 89, 0), MakeRGBA( 68, 90, 90, 0),
-	MakeRGBA( 69, 91, 91, 0), MakeRGBA( 69, 91, 91, 0), MakeRGBA( 70, 92, 92, 0), MakeRGBA( 70, 93, 93, 0),
-	MakeRGBA( 71, 94, 94, 0), MakeRGBA( 72, 95, 95, 0), MakeRGBA( 72, 95, 95, 0), MakeRGBA( 73, 96, 96, 0),
-	MakeRGBA( 74, 97, 97, 0), MakeRGBA( 74, 98, 98, 0), MakeRGBA( 75, 99, 99, 0), MakeRGBA( 75, 99, 99, 0),
-	MakeRGBA( 76,100,100, 0), MakeRGBA( 77,101,101, 0), MakeRGBA( 78,102,102, 0), MakeRGBA( 79,103,103, 0),
-	MakeRGBA( 80,104,104, 0), MakeRGBA( 80,104,104, 0), MakeRGBA( 81,105,105, 0), MakeRGBA( 82,106,106, 0),
-	MakeRGBA( 83,107,107, 0), MakeRGBA( 84,108,108, 0), MakeRGBA( 84,108,108, 0), MakeRGBA( 85,109,109, 0),
-	MakeRGBA( 86,110,110, 0), MakeRGBA( 87,111,111, 0), MakeRGBA( 88,112,112, 0), MakeRGBA( 88,112,112, 0),
-	MakeRGBA( 89,113,113, 0), MakeRGBA( 90,114,114, 0), MakeRGBA( 91,115,115, 0), MakeRGBA( 92,116,116, 0),
-	MakeRGBA( 93,117,117, 0), MakeRGBA( 94,117,117, 0), MakeRGBA( 95,118,118, 0), MakeRGBA( 96,119,119, 0),
-	MakeRGBA( 97,120,120, 0), MakeRGBA( 98,121,121, 0), MakeRGBA( 99,121,121, 0), MakeRGBA(100,122,122, 0),
-	MakeRGBA(101,123,123, 0), MakeRGBA(102,124,124, 0), MakeRGBA(103,125,125, 0), MakeRGBA(104,125,125, 0),
-	MakeRGBA(105,126,126, 0), MakeRGBA(106,127,127, 0), MakeRGBA(107,128,128, 0), MakeRGBA(108,129,129, 0),
-	MakeRGBA(109,130,130, 0), MakeRGBA(110,130,130, 0), MakeRGBA(111,131,131, 0), MakeRGBA(112,132,132, 0),
-	MakeRGBA(113,133,133, 0), MakeRGBA(114,134,134, 0), MakeRGBA(115,135,135, 0), MakeRGBA(116,136,136, 0),
-	MakeRGBA(117,137,137, 0), MakeRGBA(118,138,138, 0), MakeRGBA(119,139,139, 0), MakeRGBA(120,140,140, 0),
-	MakeRGBA(121,141,141, 0), MakeRGBA(122,142,142, 0), MakeRGBA(123,143,143, 0), MakeRGBA(124,144,144, 0),
-	MakeRGBA(125,145,145, 0), MakeRGBA(126,146,146, 0), MakeRGBA(127,147,147, 0), MakeRGBA(128,148,148, 0),
-	MakeRGBA(129,149,149, 0), MakeRGBA(130,150,150, 0), MakeRGBA(132,152,152, 0), MakeRGBA(133,153,153, 0),
-	MakeRGBA(135,154,154, 0), MakeRGBA(136,155,155, 0), MakeRGBA(137,156,156, 0), MakeRGBA(139,158,158, 0),
-	MakeRGBA(140,159,159, 0), MakeRGBA(142,160,160, 0), MakeRGBA(143,161,161, 0), MakeRGBA(144,163,163, 0),
-	MakeRGBA(146,164,164, 0), MakeRGBA(147,165,165, 0), MakeRGBA(149,166,166, 0), MakeRGBA(150,167,167, 0),
-	MakeRGBA(152,169,169, 0), MakeRGBA(153,170,170, 0), MakeRGBA(154,171,171, 0), MakeRGBA(156,172,172, 0),
-	MakeRGBA(157,174,174, 0), MakeRGBA(159,175,175, 0), MakeRGBA(160,176,176, 0), MakeRGBA(161,177,177, 0),
-	MakeRGBA(162,178,178, 0), MakeRGBA(164,179,179, 0), MakeRGBA(165,180,180, 0), MakeRGBA(166,181,181, 0),
-	MakeRGBA(167,182,182, 0), MakeRGBA(168,183,183, 0), MakeRGBA(170,184,184, 0), MakeRGBA(171,185,185, 0),
-	MakeRGBA(172,186,186, 0), MakeRGBA(173,187,187, 0), MakeRGBA(175,188,188, 0), MakeRGBA(176,189,189, 0),
-	MakeRGBA(177,190,190, 0), MakeRGBA(178,191,191, 0), MakeRGBA(179,192,192, 0), MakeRGBA(181,193,193, 0),
-	MakeRGBA(182,194,194, 0), MakeRGBA(183,195,195, 0), MakeRGBA(185,196,196, 0), MakeRGBA(186,198,198, 0),
-	MakeRGBA(187,199,199, 0), MakeRGBA(189,200,200, 0), MakeRGBA(190,201,201, 0), MakeRGBA(192,202,202, 0),
-	MakeRGBA(193,204,204, 0), MakeRGBA(194,205,205, 0), MakeRGBA(196,206,206, 0), MakeRGBA(197,207,207, 0),
-	MakeRGBA(199,209,209, 0), MakeRGBA(200,210,210, 0), MakeRGBA(202,211,211, 0), MakeRGBA(203,212,212, 0),
-	MakeRGBA(204,213,213, 0), MakeRGBA(206,215,215, 0), MakeRGBA(207,216,216, 0), MakeRGBA(209,217,217, 0),
-	MakeRGBA(210,218,218, 0), MakeRGBA(212,219,219, 0), MakeRGBA(213,221,221, 0), MakeRGBA(214,222,222, 0),
-	MakeRGBA(216,223,223, 0), MakeRGBA(217,224,224, 0), MakeRGBA(219,226,226, 0), MakeRGBA(220,227,227, 0),
-	MakeRGBA(221,228,228, 0), MakeRGBA(223,229,229, 0), MakeRGBA(224,230,230, 0), MakeRGBA(226,232,232, 0),
-	MakeRGBA(227,233,233, 0), MakeRGBA(229,234,234, 0), MakeRGBA(230,235,235, 0), MakeRGBA(231,237,237, 0),
-	MakeRGBA(233,238,238, 0), MakeRGBA(234,239,239, 0), MakeRGBA(236,240,240, 0), MakeRGBA(237,241,241, 0),
-	MakeRGBA(239,243,243, 0), MakeRGBA(240,243,243, 0), MakeRGBA(240,244,244, 0), MakeRGBA(241,245,245, 0),
-	MakeRGBA(242,245,245, 0), MakeRGBA(243,246,246, 0), MakeRGBA(244,246,246, 0), MakeRGBA(244,247,247, 0),
-	MakeRGBA(245,248,248, 0), MakeRGBA(246,248,248, 0), MakeRGBA(247,249,249, 0), MakeRGBA(248,250,250, 0),
-	MakeRGBA(249,250,250, 0), MakeRGBA(249,251,251, 0), MakeRGBA(250,251,251, 0), MakeRGBA(251,252,252, 0),
-	MakeRGBA(252,253,253, 0), MakeRGBA(253,253,253, 0), MakeRGBA(253,254,254, 0), MakeRGBA(254,254,254, 0),
-};
+/** The 32bpp recolour tables, one contiguous row per #ColourRange. */
+constexpr uint32 _recolour_palettes[18][256] = {
+	/* Recolour table for ColoureRange::COL_RANGE_GREY. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  2,  2, 0), MakeRGBA(  2,  4,  4, 0), MakeRGBA(  4,  5,  5, 0),
+		MakeRGBA(  5,  7,  7, 0), MakeRGBA(  6,  9,  9, 0), MakeRGBA(  7, 11, 11, 0), MakeRGBA(  8, 12, 12, 0),
+		MakeRGBA(  9, 14, 14, 0), MakeRGBA( 11, 16, 16, 0), MakeRGBA( 12, 18, 18, 0), MakeRGBA( 13, 20, 20, 0),
+		MakeRGBA( 14, 21, 21, 0), MakeRGBA( 15, 23, 23, 0), MakeRGBA( 16, 25, 25, 0), MakeRGBA( 18, 27, 27, 0),
+		MakeRGBA( 19, 28, 28, 0), MakeRGBA( 20, 30, 30, 0), MakeRGBA( 21, 32, 32, 0), MakeRGBA( 22, 34, 34, 0),
+		MakeRGBA( 23, 35, 35, 0), MakeRGBA( 24, 36, 36, 0), MakeRGBA( 24, 37, 37, 0), MakeRGBA( 25, 38, 38, 0),
+		MakeRGBA( 26, 39, 39, 0), MakeRGBA( 26, 39, 39, 0), MakeRGBA( 27, 40, 40, 0), MakeRGBA( 27, 41, 41, 0),
+		MakeRGBA( 28, 42, 42, 0), MakeRGBA( 29, 43, 43, 0), MakeRGBA( 29, 43, 43, 0), MakeRGBA( 30, 44, 44, 0),
+		MakeRGBA( 31, 45, 45, 0), MakeRGBA( 31, 46, 46, 0), MakeRGBA( 32, 47, 47, 0), MakeRGBA( 32, 47, 47, 0),
+		MakeRGBA( 33, 48, 48, 0), MakeRGBA( 34, 49, 49, 0), MakeRGBA( 34, 50, 50, 0), MakeRGBA( 35, 51, 51, 0),
+		MakeRGBA( 35, 52, 52, 0), MakeRGBA( 36, 52, 52, 0), MakeRGBA( 37, 53, 53, 0), MakeRGBA( 37, 54, 54, 0),
+		MakeRGBA( 38, 55, 55, 0), MakeRGBA( 38, 56, 56, 0), MakeRGBA( 39, 56, 56, 0), MakeRGBA( 40, 57, 57, 0),
+		MakeRGBA( 40, 58, 58, 0), MakeRGBA( 41, 59, 59, 0), MakeRGBA( 41, 60, 60, 0), MakeRGBA( 42, 60, 60, 0),
+		MakeRGBA( 43, 61, 61, 0), MakeRGBA( 43, 62, 62, 0), MakeRGBA( 44, 63, 63, 0), MakeRGBA( 45, 64, 64, 0),
+		MakeRGBA( 45, 65, 65, 0), MakeRGBA( 46, 65, 65, 0), MakeRGBA( 46, 66, 66, 0), MakeRGBA( 47, 67, 67, 0),
+		MakeRGBA( 48, 68, 68, 0), MakeRGBA( 49, 69, 69, 0), MakeRGBA( 49, 69, 69, 0), MakeRGBA( 50, 70, 70, 0),
+		MakeRGBA( 51, 71, 71, 0), MakeRGBA( 52, 72, 72, 0), MakeRGBA( 53, 73, 73, 0), MakeRGBA( 53, 73, 73, 0),
+		MakeRGBA( 54, 74, 74, 0), MakeRGBA( 55, 75, 75, 0), MakeRGBA( 56, 76, 76, 0), MakeRGBA( 57, 77, 77, 0),
+		MakeRGBA( 58, 78, 78, 0), MakeRGBA( 58, 78, 78, 0), MakeRGBA( 59, 79, 79, 0), MakeRGBA( 60, 80, 80, 0),
+		MakeRGBA( 61, 81, 81, 0), MakeRGBA( 62, 82, 82, 0), MakeRGBA( 62, 82, 82, 0), MakeRGBA( 63, 83, 83, 0),
+		MakeRGBA( 64, 84, 84, 0), MakeRGBA( 64, 85, 85, 0), MakeRGBA( 65, 86, 86, 0), MakeRGBA( 66, 86, 86, 0),
+		MakeRGBA( 66, 87, 87, 0), MakeRGBA( 67, 88, 88, 0), MakeRGBA( 67, 89, 89, 0), MakeRGBA( 68, 90, 90, 0),
+		MakeRGBA( 69, 91, 91, 0), MakeRGBA( 69, 91, 91, 0), MakeRGBA( 70, 92, 92, 0), MakeRGBA( 70, 93, 93, 0),
+		MakeRGBA( 71, 94, 94, 0), MakeRGBA( 72, 95, 95, 0), MakeRGBA( 72, 95, 95, 0), MakeRGBA( 73, 96, 96, 0),
+		MakeRGBA( 74, 97, 97, 0), MakeRGBA( 74, 98, 98, 0), MakeRGBA( 75, 99, 99, 0), MakeRGBA( 75, 99, 99, 0),
+		MakeRGBA( 76,100,100, 0), MakeRGBA( 77,101,101, 0), MakeRGBA( 78,102,102, 0), MakeRGBA( 79,103,103, 0),
+		MakeRGBA( 80,104,104, 0), MakeRGBA( 80,104,104, 0), MakeRGBA( 81,105,105, 0), MakeRGBA( 82,106,106, 0),
+		MakeRGBA( 83,107,107, 0), MakeRGBA( 84,108,108, 0), MakeRGBA( 84,108,108, 0), MakeRGBA( 85,109,109, 0),
+		MakeRGBA( 86,110,110, 0), MakeRGBA( 87,111,111, 0), MakeRGBA( 88,112,112, 0), MakeRGBA( 88,112,112, 0),
+		MakeRGBA( 89,113,113, 0), MakeRGBA( 90,114,114, 0), MakeRGBA( 91,115,115, 0), MakeRGBA( 92,116,116, 0),
+		MakeRGBA( 93,117,117, 0), MakeRGBA( 94,117,117, 0), MakeRGBA( 95,118,118, 0), MakeRGBA( 96,119,119, 0),
+		MakeRGBA( 97,120,120, 0), MakeRGBA( 98,121,121, 0), MakeRGBA( 99,121,121, 0), MakeRGBA(100,122,122, 0),
+		MakeRGBA(101,123,123, 0), MakeRGBA(102,124,124, 0), MakeRGBA(103,125,125, 0), MakeRGBA(104,125,125, 0),
+		MakeRGBA(105,126,126, 0), MakeRGBA(106,127,127, 0), MakeRGBA(107,128,128, 0), MakeRGBA(108,129,129, 0),
+		MakeRGBA(109,130,130, 0), MakeRGBA(110,130,130, 0), MakeRGBA(111,131,131, 0), MakeRGBA(112,132,132, 0),
+		MakeRGBA(113,133,133, 0), MakeRGBA(114,134,134, 0), MakeRGBA(115,135,135, 0), MakeRGBA(116,136,136, 0),
+		MakeRGBA(117,137,137, 0), MakeRGBA(118,138,138, 0), MakeRGBA(119,139,139, 0), MakeRGBA(120,140,140, 0),
+		MakeRGBA(121,141,141, 0), MakeRGBA(122,142,142, 0), MakeRGBA(123,143,143, 0), MakeRGBA(124,144,144, 0),
+		MakeRGBA(125,145,145, 0), MakeRGBA(126,146,146, 0), MakeRGBA(127,147,147, 0), MakeRGBA(128,148,148, 0),
+		MakeRGBA(129,149,149, 0), MakeRGBA(130,150,150, 0), MakeRGBA(132,152,152, 0), MakeRGBA(133,153,153, 0),
+		MakeRGBA(135,154,154, 0), MakeRGBA(136,155,155, 0), MakeRGBA(137,156,156, 0), MakeRGBA(139,158,158, 0),
+		MakeRGBA(140,159,159, 0), MakeRGBA(142,160,160, 0), MakeRGBA(143,161,161, 0), MakeRGBA(144,163,163, 0),
+		MakeRGBA(146,164,164, 0), MakeRGBA(147,165,165, 0), MakeRGBA(149,166,166, 0), MakeRGBA(150,167,167, 0),
+		MakeRGBA(152,169,169, 0), MakeRGBA(153,170,170, 0), MakeRGBA(154,171,171, 0), MakeRGBA(156,172,172, 0),
+		MakeRGBA(157,174,174, 0), MakeRGBA(159,175,175, 0), MakeRGBA(160,176,176, 0), MakeRGBA(161,177,177, 0),
+		MakeRGBA(162,178,178, 0), MakeRGBA(164,179,179, 0), MakeRGBA(165,180,180, 0), MakeRGBA(166,181,181, 0),
+		MakeRGBA(167,182,182, 0), MakeRGBA(168,183,183, 0), MakeRGBA(170,184,184, 0), MakeRGBA(171,185,185, 0),
+		MakeRGBA(172,186,186, 0), MakeRGBA(173,187,187, 0), MakeRGBA(175,188,188, 0), MakeRGBA(176,189,189, 0),
+		MakeRGBA(177,190,190, 0), MakeRGBA(178,191,191, 0), MakeRGBA(179,192,192, 0), MakeRGBA(181,193,193, 0),
+		MakeRGBA(182,194,194, 0), MakeRGBA(183,195,195, 0), MakeRGBA(185,196,196, 0), MakeRGBA(186,198,198, 0),
+		MakeRGBA(187,199,199, 0), MakeRGBA(189,200,200, 0), MakeRGBA(190,201,201, 0), MakeRGBA(192,202,202, 0),
+		MakeRGBA(193,204,204, 0), MakeRGBA(194,205,205, 0), MakeRGBA(196,206,206, 0), MakeRGBA(197,207,207, 0),
+		MakeRGBA(199,209,209, 0), MakeRGBA(200,210,210, 0), MakeRGBA(202,211,211, 0), MakeRGBA(203,212,212, 0),
+		MakeRGBA(204,213,213, 0), MakeRGBA(206,215,215, 0), MakeRGBA(207,216,216, 0), MakeRGBA(209,217,217, 0),
+		MakeRGBA(210,218,218, 0), MakeRGBA(212,219,219, 0), MakeRGBA(213,221,221, 0), MakeRGBA(214,222,222, 0),
+		MakeRGBA(216,223,223, 0), MakeRGBA(217,224,224, 0), MakeRGBA(219,226,226, 0), MakeRGBA(220,227,227, 0),
+		MakeRGBA(221,228,228, 0), MakeRGBA(223,229,229, 0), MakeRGBA(224,230,230, 0), MakeRGBA(226,232,232, 0),
+		MakeRGBA(227,233,233, 0), MakeRGBA(229,234,234, 0), MakeRGBA(230,235,235, 0), MakeRGBA(231,237,237, 0),
+		MakeRGBA(233,238,238, 0), MakeRGBA(234,239,239, 0), MakeRGBA(236,240,240, 0), MakeRGBA(237,241,241, 0),
+		MakeRGBA(239,243,243, 0), MakeRGBA(240,243,243, 0), MakeRGBA(240,244,244, 0), MakeRGBA(241,245,245, 0),
+		MakeRGBA(242,245,245, 0), MakeRGBA(243,246,246, 0), MakeRGBA(244,246,246, 0), MakeRGBA(244,247,247, 0),
+		MakeRGBA(245,248,248, 0), MakeRGBA(246,248,248, 0), MakeRGBA(247,249,249, 0), MakeRGBA(248,250,250, 0),
+		MakeRGBA(249,250,250, 0), MakeRGBA(249,251,251, 0), MakeRGBA(250,251,251, 0), MakeRGBA(251,252,252, 0),
+		MakeRGBA(252,253,253, 0), MakeRGBA(253,253,253, 0), MakeRGBA(253,254,254, 0), MakeRGBA(254,254,254, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_GREEN_BROWN. */
-static const uint32 _recolour01[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  2,  0, 0), MakeRGBA(  5,  5,  0, 0), MakeRGBA(  8,  7,  0, 0),
-	MakeRGBA( 10, 10,  0, 0), MakeRGBA( 13, 12,  0, 0), MakeRGBA( 16, 14,  0, 0), MakeRGBA( 18, 17,  0, 0),
-	MakeRGBA( 21, 19,  0, 0), MakeRGBA( 23, 21,  0, 0), MakeRGBA( 26, 24,  0, 0), MakeRGBA( 28, 26,  0, 0),
-	MakeRGBA( 31, 29,  0, 0), MakeRGBA( 34, 31,  0, 0), MakeRGBA( 36, 33,  0, 0), MakeRGBA( 39, 36,  0, 0),
-	MakeRGBA( 41, 38,  0, 0), MakeRGBA( 44, 41,  0, 0), MakeRGBA( 47, 43,  0, 0), MakeRGBA( 49, 45,  0, 0),
-	MakeRGBA( 51, 47,  0, 0), MakeRGBA( 52, 48,  0, 0), MakeRGBA( 52, 48,  0, 0), MakeRGBA( 53, 49,  0, 0),
-	MakeRGBA( 54, 50,  0, 0), MakeRGBA( 54, 50,  0, 0), MakeRGBA( 55, 51,  0, 0), MakeRGBA( 55, 51,  0, 0),
-	MakeRGBA( 56, 52,  0, 0), MakeRGBA( 57, 53,  0, 0), MakeRGBA( 57, 53,  0, 0), MakeRGBA( 58, 54,  0, 0),
-	MakeRGBA( 59, 55,  0, 0), MakeRGBA( 59, 55,  0, 0), MakeRGBA( 60, 56,  0, 0), MakeRGBA( 60, 56,  0, 0),
-	MakeRGBA( 61, 57,  0, 0), MakeRGBA( 62, 58,  0, 0), MakeRGBA( 62, 58,  0, 0), MakeRGBA( 63, 59,  0, 0),
-	MakeRGBA( 64, 60,  0, 0), MakeRGBA( 64, 60,  1, 0), MakeRGBA( 65, 61,  1, 0), MakeRGBA( 66, 62,  2, 0),
-	MakeRGBA( 67, 63,  3, 0), MakeRGBA( 68, 64,  3, 0), MakeRGBA( 68, 64,  4, 0), MakeRGBA( 69, 65,  4, 0),
-	MakeRGBA( 70, 66,  5, 0), MakeRGBA( 71, 67,  5, 0), MakeRGBA( 72, 68,  6, 0), MakeRGBA( 72, 68,  6, 0),
-	MakeRGBA( 73, 69,  7, 0), MakeRGBA( 74, 70,  8, 0), MakeRGBA( 75, 71,  8, 0), MakeRGBA( 76, 72,  9, 0),
-	MakeRGBA( 77, 73,  9, 0), MakeRGBA( 77, 73, 10, 0), MakeRGBA( 78, 74, 10, 0), MakeRGBA( 79, 75, 11, 0),
-	MakeRGBA( 80, 76, 11, 0), MakeRGBA( 80, 77, 12, 0), MakeRGBA( 81, 77, 12, 0), MakeRGBA( 81, 78, 13, 0),
-	MakeRGBA( 82, 79, 13, 0), MakeRGBA( 83, 80, 13, 0), MakeRGBA( 83, 81, 14, 0), MakeRGBA( 84, 81, 14, 0),
-	MakeRGBA( 84, 82, 15, 0), MakeRGBA( 85, 83, 15, 0), MakeRGBA( 86, 84, 15, 0), MakeRGBA( 86, 85, 16, 0),
-	MakeRGBA( 87, 86, 16, 0), MakeRGBA( 87, 86, 17, 0), MakeRGBA( 88, 87, 17, 0), MakeRGBA( 89, 88, 17, 0),
-	MakeRGBA( 89, 89, 18, 0), MakeRGBA( 90, 90, 18, 0), MakeRGBA( 91, 90, 19, 0), MakeRGBA( 91, 91, 19, 0),
-	MakeRGBA( 92, 92, 20, 0), MakeRGBA( 93, 93, 20, 0), MakeRGBA( 94, 94, 21, 0), MakeRGBA( 94, 94, 22, 0),
-	MakeRGBA( 95, 95, 22, 0), MakeRGBA( 96, 96, 23, 0), MakeRGBA( 97, 97, 23, 0), MakeRGBA( 98, 98, 24, 0),
-	MakeRGBA( 99, 99, 25, 0), MakeRGBA( 99, 99, 25, 0), MakeRGBA(100,100, 26, 0), MakeRGBA(101,101, 26, 0),
-	MakeRGBA(102,102, 27, 0), MakeRGBA(103,103, 28, 0), MakeRGBA(103,103, 28, 0), MakeRGBA(104,104, 29, 0),
-	MakeRGBA(105,105, 29, 0), MakeRGBA(106,106, 30, 0), MakeRGBA(107,107, 31, 0), MakeRGBA(107,107, 31, 0),
-	MakeRGBA(108,108, 32, 0), MakeRGBA(109,109, 33, 0), MakeRGBA(109,110, 34, 0), MakeRGBA(110,111, 35, 0),
-	MakeRGBA(110,112, 35, 0), MakeRGBA(111,112, 36, 0), MakeRGBA(112,113, 37, 0), MakeRGBA(112,114, 38, 0),
-	MakeRGBA(113,115, 39, 0), MakeRGBA(113,116, 40, 0), MakeRGBA(114,116, 40, 0), MakeRGBA(115,117, 41, 0),
-	MakeRGBA(115,118, 42, 0), MakeRGBA(116,119, 43, 0), MakeRGBA(116,120, 44, 0), MakeRGBA(117,120, 44, 0),
-	MakeRGBA(118,121, 45, 0), MakeRGBA(118,122, 46, 0), MakeRGBA(119,123, 47, 0), MakeRGBA(120,124, 48, 0),
-	MakeRGBA(121,125, 48, 0), MakeRGBA(121,125, 49, 0), MakeRGBA(122,126, 49, 0), MakeRGBA(123,127, 50, 0),
-	MakeRGBA(124,128, 51, 0), MakeRGBA(125,129, 51, 0), MakeRGBA(125,129, 52, 0), MakeRGBA(126,130, 52, 0),
-	MakeRGBA(127,131, 53, 0), MakeRGBA(128,132, 54, 0), MakeRGBA(129,133, 54, 0), MakeRGBA(129,133, 55, 0),
-	MakeRGBA(130,134, 55, 0), MakeRGBA(131,135, 56, 0), MakeRGBA(132,136, 57, 0), MakeRGBA(133,137, 57, 0),
-	MakeRGBA(134,138, 58, 0), MakeRGBA(134,138, 58, 0), MakeRGBA(135,139, 59, 0), MakeRGBA(136,140, 60, 0),
-	MakeRGBA(137,141, 61, 0), MakeRGBA(138,142, 62, 0), MakeRGBA(138,142, 63, 0), MakeRGBA(139,143, 64, 0),
-	MakeRGBA(140,144, 65, 0), MakeRGBA(141,145, 66, 0), MakeRGBA(142,146, 67, 0), MakeRGBA(142,146, 68, 0),
-	MakeRGBA(143,147, 69, 0), MakeRGBA(144,148, 70, 0), MakeRGBA(145,149, 71, 0), MakeRGBA(146,150, 72, 0),
-	MakeRGBA(146,150, 73, 0), MakeRGBA(147,151, 74, 0), MakeRGBA(148,152, 75, 0), MakeRGBA(149,153, 76, 0),
-	MakeRGBA(150,154, 77, 0), MakeRGBA(151,155, 78, 0), MakeRGBA(151,155, 79, 0), MakeRGBA(152,156, 80, 0),
-	MakeRGBA(153,158, 81, 0), MakeRGBA(154,159, 82, 0), MakeRGBA(155,160, 83, 0), MakeRGBA(155,161, 83, 0),
-	MakeRGBA(156,162, 84, 0), MakeRGBA(157,163, 85, 0), MakeRGBA(158,164, 86, 0), MakeRGBA(159,165, 87, 0),
-	MakeRGBA(160,166, 88, 0), MakeRGBA(160,167, 88, 0), MakeRGBA(161,168, 89, 0), MakeRGBA(162,169, 90, 0),
-	MakeRGBA(163,170, 91, 0), MakeRGBA(164,171, 92, 0), MakeRGBA(164,172, 92, 0), MakeRGBA(165,173, 93, 0),
-	MakeRGBA(166,174, 94, 0), MakeRGBA(167,175, 95, 0), MakeRGBA(168,176, 96, 0), MakeRGBA(169,176, 97, 0),
-	MakeRGBA(170,177, 98, 0), MakeRGBA(171,178, 99, 0), MakeRGBA(172,179,100, 0), MakeRGBA(173,180,101, 0),
-	MakeRGBA(174,181,102, 0), MakeRGBA(175,181,103, 0), MakeRGBA(176,182,104, 0), MakeRGBA(177,183,105, 0),
-	MakeRGBA(178,184,106, 0), MakeRGBA(179,185,107, 0), MakeRGBA(180,185,108, 0), MakeRGBA(181,186,109, 0),
-	MakeRGBA(182,187,110, 0), MakeRGBA(183,188,111, 0), MakeRGBA(184,189,112, 0), MakeRGBA(185,189,113, 0),
-	MakeRGBA(186,190,114, 0), MakeRGBA(187,191,115, 0), MakeRGBA(188,192,116, 0), MakeRGBA(189,193,118, 0),
-	MakeRGBA(190,194,119, 0), MakeRGBA(190,194,120, 0), MakeRGBA(191,195,121, 0), MakeRGBA(192,196,122, 0),
-	MakeRGBA(193,197,124, 0), MakeRGBA(194,198,125, 0), MakeRGBA(194,198,126, 0), MakeRGBA(195,199,127, 0),
-	MakeRGBA(196,200,129, 0), MakeRGBA(197,201,130, 0), MakeRGBA(198,202,131, 0), MakeRGBA(198,202,132, 0),
-	MakeRGBA(199,203,133, 0), MakeRGBA(200,204,135, 0), MakeRGBA(201,205,136, 0), MakeRGBA(202,206,137, 0),
-	MakeRGBA(203,207,138, 0), MakeRGBA(203,207,139, 0), MakeRGBA(204,208,141, 0), MakeRGBA(205,209,142, 0),
-	MakeRGBA(206,210,143, 0), MakeRGBA(207,211,144, 0), MakeRGBA(208,212,146, 0), MakeRGBA(209,213,147, 0),
-	MakeRGBA(210,214,148, 0), MakeRGBA(212,216,149, 0), MakeRGBA(213,217,150, 0), MakeRGBA(214,218,152, 0),
-	MakeRGBA(215,219,153, 0), MakeRGBA(216,220,154, 0), MakeRGBA(217,221,155, 0), MakeRGBA(218,222,157, 0),
-	MakeRGBA(219,223,158, 0), MakeRGBA(220,224,159, 0), MakeRGBA(221,225,160, 0), MakeRGBA(222,226,161, 0),
-	MakeRGBA(223,227,163, 0), MakeRGBA(224,228,166, 0), MakeRGBA(226,229,171, 0), MakeRGBA(227,231,176, 0),
-	MakeRGBA(229,232,180, 0), MakeRGBA(231,234,185, 0), MakeRGBA(232,235,190, 0), MakeRGBA(234,237,194, 0),
-	MakeRGBA(235,238,199, 0), MakeRGBA(237,239,204, 0), MakeRGBA(239,241,208, 0), MakeRGBA(240,242,213, 0),
-	MakeRGBA(242,244,218, 0), MakeRGBA(244,245,222, 0), MakeRGBA(245,246,227, 0), MakeRGBA(247,248,232, 0),
-	MakeRGBA(248,249,236, 0), MakeRGBA(250,251,241, 0), MakeRGBA(252,252,246, 0), MakeRGBA(253,254,250, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_GREEN_BROWN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  2,  0, 0), MakeRGBA(  5,  5,  0, 0), MakeRGBA(  8,  7,  0, 0),
+		MakeRGBA( 10, 10,  0, 0), MakeRGBA( 13, 12,  0, 0), MakeRGBA( 16, 14,  0, 0), MakeRGBA( 18, 17,  0, 0),
+		MakeRGBA( 21, 19,  0, 0), MakeRGBA( 23, 21,  0, 0), MakeRGBA( 26, 24,  0, 0), MakeRGBA( 28, 26,  0, 0),
+		MakeRGBA( 31, 29,  0, 0), MakeRGBA( 34, 31,  0, 0), MakeRGBA( 36, 33,  0, 0), MakeRGBA( 39, 36,  0, 0),
+		MakeRGBA( 41, 38,  0, 0), MakeRGBA( 44, 41,  0, 0), MakeRGBA( 47, 43,  0, 0), MakeRGBA( 49, 45,  0, 0),
+		MakeRGBA( 51, 47,  0, 0), MakeRGBA( 52, 48,  0, 0), MakeRGBA( 52, 48,  0, 0), MakeRGBA( 53, 49,  0, 0),
+		MakeRGBA( 54, 50,  0, 0), MakeRGBA( 54, 50,  0, 0), MakeRGBA( 55, 51,  0, 0), MakeRGBA( 55, 51,  0, 0),
+		MakeRGBA( 56, 52,  0, 0), MakeRGBA( 57, 53,  0, 0), MakeRGBA( 57, 53,  0, 0), MakeRGBA( 58, 54,  0, 0),
+		MakeRGBA( 59, 55,  0, 0), MakeRGBA( 59, 55,  0, 0), MakeRGBA( 60, 56,  0, 0), MakeRGBA( 60, 56,  0, 0),
+		MakeRGBA( 61, 57,  0, 0), MakeRGBA( 62, 58,  0, 0), MakeRGBA( 62, 58,  0, 0), MakeRGBA( 63, 59,  0, 0),
+		MakeRGBA( 64, 60,  0, 0), MakeRGBA( 64, 60,  1, 0), MakeRGBA( 65, 61,  1, 0), MakeRGBA( 66, 62,  2, 0),
+		MakeRGBA( 67, 63,  3, 0), MakeRGBA( 68, 64,  3, 0), MakeRGBA( 68, 64,  4, 0), MakeRGBA( 69, 65,  4, 0),
+		MakeRGBA( 70, 66,  5, 0), MakeRGBA( 71, 67,  5, 0), MakeRGBA( 72, 68,  6, 0), MakeRGBA( 72, 68,  6, 0),
+		MakeRGBA( 73, 69,  7, 0), MakeRGBA( 74, 70,  8, 0), MakeRGBA( 75, 71,  8, 0), MakeRGBA( 76, 72,  9, 0),
+		MakeRGBA( 77, 73,  9, 0), MakeRGBA( 77, 73, 10, 0), MakeRGBA( 78, 74, 10, 0), MakeRGBA( 79, 75, 11, 0),
+		MakeRGBA( 80, 76, 11, 0), MakeRGBA( 80, 77, 12, 0), MakeRGBA( 81, 77, 12, 0), MakeRGBA( 81, 78, 13, 0),
+		MakeRGBA( 82, 79, 13, 0), MakeRGBA( 83, 80, 13, 0), MakeRGBA( 83, 81, 14, 0), MakeRGBA( 84, 81, 14, 0),
+		MakeRGBA( 84, 82, 15, 0), MakeRGBA( 85, 83, 15, 0), MakeRGBA( 86, 84, 15, 0), MakeRGBA( 86, 85, 16, 0),
+		MakeRGBA( 87, 86, 16, 0), MakeRGBA( 87, 86, 17, 0), MakeRGBA( 88, 87, 17, 0), MakeRGBA( 89, 88, 17, 0),
+		MakeRGBA( 89, 89, 18, 0), MakeRGBA( 90, 90, 18, 0), MakeRGBA( 91, 90, 19, 0), MakeRGBA( 91, 91, 19, 0),
+		MakeRGBA( 92, 92, 20, 0), MakeRGBA( 93, 93, 20, 0), MakeRGBA( 94, 94, 21, 0), MakeRGBA( 94, 94, 22, 0),
+		MakeRGBA( 95, 95, 22, 0), MakeRGBA( 96, 96, 23, 0), MakeRGBA( 97, 97, 23, 0), MakeRGBA( 98, 98, 24, 0),
+		MakeRGBA( 99, 99, 25, 0), MakeRGBA( 99, 99, 25, 0), MakeRGBA(100,100, 26, 0), MakeRGBA(101,101, 26, 0),
+		MakeRGBA(102,102, 27, 0), MakeRGBA(103,103, 28, 0), MakeRGBA(103,103, 28, 0), MakeRGBA(104,104, 29, 0),
+		MakeRGBA(105,105, 29, 0), MakeRGBA(106,106, 30, 0), MakeRGBA(107,107, 31, 0), MakeRGBA(107,107, 31, 0),
+		MakeRGBA(108,108, 32, 0), MakeRGBA(109,109, 33, 0), MakeRGBA(109,110, 34, 0), MakeRGBA(110,111, 35, 0),
+		MakeRGBA(110,112, 35, 0), MakeRGBA(111,112, 36, 0), MakeRGBA(112,113, 37, 0), MakeRGBA(112,114, 38, 0),
+		MakeRGBA(113,115, 39, 0), MakeRGBA(113,116, 40, 0), MakeRGBA(114,116, 40, 0), MakeRGBA(115,117, 41, 0),
+		MakeRGBA(115,118, 42, 0), MakeRGBA(116,119, 43, 0), MakeRGBA(116,120, 44, 0), MakeRGBA(117,120, 44, 0),
+		MakeRGBA(118,121, 45, 0), MakeRGBA(118,122, 46, 0), MakeRGBA(119,123, 47, 0), MakeRGBA(120,124, 48, 0),
+		MakeRGBA(121,125, 48, 0), MakeRGBA(121,125, 49, 0), MakeRGBA(122,126, 49, 0), MakeRGBA(123,127, 50, 0),
+		MakeRGBA(124,128, 51, 0), MakeRGBA(125,129, 51, 0), MakeRGBA(125,129, 52, 0), MakeRGBA(126,130, 52, 0),
+		MakeRGBA(127,131, 53, 0), MakeRGBA(128,132, 54, 0), MakeRGBA(129,133, 54, 0), MakeRGBA(129,133, 55, 0),
+		MakeRGBA(130,134, 55, 0), MakeRGBA(131,135, 56, 0), MakeRGBA(132,136, 57, 0), MakeRGBA(133,137, 57, 0),
+		MakeRGBA(134,138, 58, 0), MakeRGBA(134,138, 58, 0), MakeRGBA(135,139, 59, 0), MakeRGBA(136,140, 60, 0),
+		MakeRGBA(137,141, 61, 0), MakeRGBA(138,142, 62, 0), MakeRGBA(138,142, 63, 0), MakeRGBA(139,143, 64, 0),
+		MakeRGBA(140,144, 65, 0), MakeRGBA(141,145, 66, 0), MakeRGBA(142,146, 67, 0), MakeRGBA(142,146, 68, 0),
+		MakeRGBA(143,147, 69, 0), MakeRGBA(144,148, 70, 0), MakeRGBA(145,149, 71, 0), MakeRGBA(146,150, 72, 0),
+		MakeRGBA(146,150, 73, 0), MakeRGBA(147,151, 74, 0), MakeRGBA(148,152, 75, 0), MakeRGBA(149,153, 76, 0),
+		MakeRGBA(150,154, 77, 0), MakeRGBA(151,155, 78, 0), MakeRGBA(151,155, 79, 0), MakeRGBA(152,156, 80, 0),
+		MakeRGBA(153,158, 81, 0), MakeRGBA(154,159, 82, 0), MakeRGBA(155,160, 83, 0), MakeRGBA(155,161, 83, 0),
+		MakeRGBA(156,162, 84, 0), MakeRGBA(157,163, 85, 0), MakeRGBA(158,164, 86, 0), MakeRGBA(159,165, 87, 0),
+		MakeRGBA(160,166, 88, 0), MakeRGBA(160,167, 88, 0), MakeRGBA(161,168, 89, 0), MakeRGBA(162,169, 90, 0),
+		MakeRGBA(163,170, 91, 0), MakeRGBA(164,171, 92, 0), MakeRGBA(164,172, 92, 0), MakeRGBA(165,173, 93, 0),
+		MakeRGBA(166,174, 94, 0), MakeRGBA(167,175, 95, 0), MakeRGBA(168,176, 96, 0), MakeRGBA(169,176, 97, 0),
+		MakeRGBA(170,177, 98, 0), MakeRGBA(171,178, 99, 0), MakeRGBA(172,179,100, 0), MakeRGBA(173,180,101, 0),
+		MakeRGBA(174,181,102, 0), MakeRGBA(175,181,103, 0), MakeRGBA(176,182,104, 0), MakeRGBA(177,183,105, 0),
+		MakeRGBA(178,184,106, 0), MakeRGBA(179,185,107, 0), MakeRGBA(180,185,108, 0), MakeRGBA(181,186,109, 0),
+		MakeRGBA(182,187,110, 0), MakeRGBA(183,188,111, 0), MakeRGBA(184,189,112, 0), MakeRGBA(185,189,113, 0),
+		MakeRGBA(186,190,114, 0), MakeRGBA(187,191,115, 0), MakeRGBA(188,192,116, 0), MakeRGBA(189,193,118, 0),
+		MakeRGBA(190,194,119, 0), MakeRGBA(190,194,120, 0), MakeRGBA(191,195,121, 0), MakeRGBA(192,196,122, 0),
+		MakeRGBA(193,197,124, 0), MakeRGBA(194,198,125, 0), MakeRGBA(194,198,126, 0), MakeRGBA(195,199,127, 0),
+		MakeRGBA(196,200,129, 0), MakeRGBA(197,201,130, 0), MakeRGBA(198,202,131, 0), MakeRGBA(198,202,132, 0),
+		MakeRGBA(199,203,133, 0), MakeRGBA(200,204,135, 0), MakeRGBA(201,205,136, 0), MakeRGBA(202,206,137, 0),
+		MakeRGBA(203,207,138, 0), MakeRGBA(203,207,139, 0), MakeRGBA(204,208,141, 0), MakeRGBA(205,209,142, 0),
+		MakeRGBA(206,210,143, 0), MakeRGBA(207,211,144, 0), MakeRGBA(208,212,146, 0), MakeRGBA(209,213,147, 0),
+		MakeRGBA(210,214,148, 0), MakeRGBA(212,216,149, 0), MakeRGBA(213,217,150, 0), MakeRGBA(214,218,152, 0),
+		MakeRGBA(215,219,153, 0), MakeRGBA(216,220,154, 0), MakeRGBA(217,221,155, 0), MakeRGBA(218,222,157, 0),
+		MakeRGBA(219,223,158, 0), MakeRGBA(220,224,159, 0), MakeRGBA(221,225,160, 0), MakeRGBA(222,226,161, 0),
+		MakeRGBA(223,227,163, 0), MakeRGBA(224,228,166, 0), MakeRGBA(226,229,171, 0), MakeRGBA(227,231,176, 0),
+		MakeRGBA(229,232,180, 0), MakeRGBA(231,234,185, 0), MakeRGBA(232,235,190, 0), MakeRGBA(234,237,194, 0),
+		MakeRGBA(235,238,199, 0), MakeRGBA(237,239,204, 0), MakeRGBA(239,241,208, 0), MakeRGBA(240,242,213, 0),
+		MakeRGBA(242,244,218, 0), MakeRGBA(244,245,222, 0), MakeRGBA(245,246,227, 0), MakeRGBA(247,248,232, 0),
+		MakeRGBA(248,249,236, 0), MakeRGBA(250,251,241, 0), MakeRGBA(252,252,246, 0), MakeRGBA(253,254,250, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_ORANGE_BROWN. */
-static const uint32 _recolour02[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  2,  0, 0), MakeRGBA(  7,  4,  1, 0), MakeRGBA( 10,  7,  1, 0),
-	MakeRGBA( 14,  9,  1, 0), MakeRGBA( 17, 11,  2, 0), MakeRGBA( 20, 13,  2, 0), MakeRGBA( 24, 15,  2, 0),
-	MakeRGBA( 27, 17,  3, 0), MakeRGBA( 31, 20,  3, 0), MakeRGBA( 34, 22,  4, 0), MakeRGBA( 37, 24,  4, 0),
-	MakeRGBA( 41, 26,  4, 0), MakeRGBA( 44, 28,  5, 0), MakeRGBA( 48, 31,  5, 0), MakeRGBA( 51, 33,  5, 0),
-	MakeRGBA( 54, 35,  6, 0), MakeRGBA( 58, 37,  6, 0), MakeRGBA( 61, 39,  6, 0), MakeRGBA( 65, 41,  7, 0),
-	MakeRGBA( 67, 43,  7, 0), MakeRGBA( 68, 44,  7, 0), MakeRGBA( 69, 45,  7, 0), MakeRGBA( 70, 46,  8, 0),
-	MakeRGBA( 71, 47,  8, 0), MakeRGBA( 72, 47,  8, 0), MakeRGBA( 73, 48,  8, 0), MakeRGBA( 74, 49,  8, 0),
-	MakeRGBA( 75, 50,  9, 0), MakeRGBA( 76, 51,  9, 0), MakeRGBA( 77, 51,  9, 0), MakeRGBA( 78, 52,  9, 0),
-	MakeRGBA( 80, 53, 10, 0), MakeRGBA( 81, 54, 10, 0), MakeRGBA( 82, 55, 10, 0), MakeRGBA( 83, 55, 10, 0),
-	MakeRGBA( 84, 56, 10, 0), MakeRGBA( 85, 57, 11, 0), MakeRGBA( 86, 58, 11, 0), MakeRGBA( 87, 59, 11, 0),
-	MakeRGBA( 88, 60, 11, 0), MakeRGBA( 89, 60, 12, 0), MakeRGBA( 90, 61, 13, 0), MakeRGBA( 91, 62, 13, 0),
-	MakeRGBA( 93, 63, 14, 0), MakeRGBA( 94, 64, 14, 0), MakeRGBA( 95, 64, 15, 0), MakeRGBA( 96, 65, 16, 0),
-	MakeRGBA( 98, 66, 16, 0), MakeRGBA( 99, 67, 17, 0), MakeRGBA(100, 68, 17, 0), MakeRGBA(101, 68, 18, 0),
-	MakeRGBA(102, 69, 19, 0), MakeRGBA(104, 70, 19, 0), MakeRGBA(105, 71, 20, 0), MakeRGBA(106, 72, 21, 0),
-	MakeRGBA(107, 73, 21, 0), MakeRGBA(108, 73, 22, 0), MakeRGBA(110, 74, 22, 0), MakeRGBA(111, 75, 23, 0),
-	MakeRGBA(112, 76, 23, 0), MakeRGBA(113, 76, 24, 0), MakeRGBA(113, 77, 24, 0), MakeRGBA(114, 77, 25, 0),
-	MakeRGBA(115, 78, 25, 0), MakeRGBA(116, 79, 25, 0), MakeRGBA(117, 79, 26, 0), MakeRGBA(117, 80, 26, 0),
-	MakeRGBA(118, 80, 27, 0), MakeRGBA(119, 81, 27, 0), MakeRGBA(120, 82, 27, 0), MakeRGBA(121, 82, 28, 0),
-	MakeRGBA(122, 83, 28, 0), MakeRGBA(122, 83, 29, 0), MakeRGBA(123, 84, 29, 0), MakeRGBA(124, 85, 29, 0),
-	MakeRGBA(125, 85, 30, 0), MakeRGBA(126, 86, 30, 0), MakeRGBA(126, 87, 31, 0), MakeRGBA(127, 87, 31, 0),
-	MakeRGBA(128, 88, 32, 0), MakeRGBA(129, 88, 32, 0), MakeRGBA(130, 89, 32, 0), MakeRGBA(130, 90, 33, 0),
-	MakeRGBA(131, 90, 33, 0), MakeRGBA(132, 91, 34, 0), MakeRGBA(133, 91, 34, 0), MakeRGBA(134, 92, 34, 0),
-	MakeRGBA(135, 93, 35, 0), MakeRGBA(135, 93, 35, 0), MakeRGBA(136, 94, 36, 0), MakeRGBA(137, 94, 36, 0),
-	MakeRGBA(138, 95, 36, 0), MakeRGBA(139, 96, 37, 0), MakeRGBA(139, 96, 37, 0), MakeRGBA(140, 97, 38, 0),
-	MakeRGBA(141, 98, 38, 0), MakeRGBA(142, 98, 38, 0), MakeRGBA(143, 99, 39, 0), MakeRGBA(143, 99, 39, 0),
-	MakeRGBA(144,100, 40, 0), MakeRGBA(145,101, 41, 0), MakeRGBA(146,102, 41, 0), MakeRGBA(147,103, 42, 0),
-	MakeRGBA(148,104, 42, 0), MakeRGBA(148,104, 43, 0), MakeRGBA(149,105, 44, 0), MakeRGBA(150,106, 44, 0),
-	MakeRGBA(151,107, 45, 0), MakeRGBA(152,108, 45, 0), MakeRGBA(152,108, 46, 0), MakeRGBA(153,109, 47, 0),
-	MakeRGBA(154,110, 47, 0), MakeRGBA(155,111, 48, 0), MakeRGBA(156,112, 48, 0), MakeRGBA(156,112, 49, 0),
-	MakeRGBA(157,113, 50, 0), MakeRGBA(158,114, 50, 0), MakeRGBA(159,115, 51, 0), MakeRGBA(160,116, 52, 0),
-	MakeRGBA(161,117, 52, 0), MakeRGBA(162,117, 53, 0), MakeRGBA(163,118, 54, 0), MakeRGBA(164,119, 55, 0),
-	MakeRGBA(165,120, 56, 0), MakeRGBA(166,121, 57, 0), MakeRGBA(167,121, 57, 0), MakeRGBA(168,122, 58, 0),
-	MakeRGBA(169,123, 59, 0), MakeRGBA(170,124, 60, 0), MakeRGBA(171,125, 61, 0), MakeRGBA(172,125, 61, 0),
-	MakeRGBA(173,126, 62, 0), MakeRGBA(174,127, 63, 0), MakeRGBA(175,128, 64, 0), MakeRGBA(176,129, 65, 0),
-	MakeRGBA(177,130, 66, 0), MakeRGBA(178,130, 66, 0), MakeRGBA(179,131, 67, 0), MakeRGBA(180,132, 68, 0),
-	MakeRGBA(180,133, 69, 0), MakeRGBA(181,134, 70, 0), MakeRGBA(182,135, 71, 0), MakeRGBA(182,136, 72, 0),
-	MakeRGBA(183,137, 73, 0), MakeRGBA(183,138, 74, 0), MakeRGBA(184,139, 75, 0), MakeRGBA(185,140, 76, 0),
-	MakeRGBA(185,141, 77, 0), MakeRGBA(186,142, 78, 0), MakeRGBA(186,143, 79, 0), MakeRGBA(187,144, 80, 0),
-	MakeRGBA(188,145, 81, 0), MakeRGBA(188,146, 82, 0), MakeRGBA(189,147, 83, 0), MakeRGBA(189,148, 84, 0),
-	MakeRGBA(190,149, 85, 0), MakeRGBA(191,150, 86, 0), MakeRGBA(191,152, 88, 0), MakeRGBA(192,153, 89, 0),
-	MakeRGBA(193,154, 90, 0), MakeRGBA(193,155, 91, 0), MakeRGBA(194,156, 92, 0), MakeRGBA(194,158, 94, 0),
-	MakeRGBA(195,159, 95, 0), MakeRGBA(196,160, 96, 0), MakeRGBA(196,161, 97, 0), MakeRGBA(197,163, 99, 0),
-	MakeRGBA(197,164,100, 0), MakeRGBA(198,165,101, 0), MakeRGBA(199,166,102, 0), MakeRGBA(199,167,103, 0),
-	MakeRGBA(200,169,105, 0), MakeRGBA(200,170,106, 0), MakeRGBA(201,171,107, 0), MakeRGBA(202,172,108, 0),
-	MakeRGBA(202,174,109, 0), MakeRGBA(203,175,111, 0), MakeRGBA(204,176,112, 0), MakeRGBA(204,177,113, 0),
-	MakeRGBA(205,178,114, 0), MakeRGBA(206,180,116, 0), MakeRGBA(207,181,117, 0), MakeRGBA(208,182,118, 0),
-	MakeRGBA(209,183,119, 0), MakeRGBA(209,184,120, 0), MakeRGBA(210,186,122, 0), MakeRGBA(211,187,123, 0),
-	MakeRGBA(212,188,124, 0), MakeRGBA(213,189,125, 0), MakeRGBA(213,191,127, 0), MakeRGBA(214,192,128, 0),
-	MakeRGBA(215,193,129, 0), MakeRGBA(216,194,130, 0), MakeRGBA(217,195,131, 0), MakeRGBA(217,197,133, 0),
-	MakeRGBA(218,198,134, 0), MakeRGBA(219,199,135, 0), MakeRGBA(220,200,137, 0), MakeRGBA(220,201,138, 0),
-	MakeRGBA(221,202,139, 0), MakeRGBA(221,203,141, 0), MakeRGBA(222,204,142, 0), MakeRGBA(223,205,144, 0),
-	MakeRGBA(223,206,145, 0), MakeRGBA(224,207,146, 0), MakeRGBA(225,208,148, 0), MakeRGBA(225,209,149, 0),
-	MakeRGBA(226,210,151, 0), MakeRGBA(226,211,152, 0), MakeRGBA(227,212,154, 0), MakeRGBA(228,213,155, 0),
-	MakeRGBA(228,214,156, 0), MakeRGBA(229,215,158, 0), MakeRGBA(229,216,159, 0), MakeRGBA(230,217,161, 0),
-	MakeRGBA(231,218,162, 0), MakeRGBA(231,219,164, 0), MakeRGBA(232,220,165, 0), MakeRGBA(233,221,167, 0),
-	MakeRGBA(234,222,168, 0), MakeRGBA(235,223,170, 0), MakeRGBA(235,224,172, 0), MakeRGBA(236,225,173, 0),
-	MakeRGBA(237,226,175, 0), MakeRGBA(238,228,177, 0), MakeRGBA(239,229,178, 0), MakeRGBA(239,230,180, 0),
-	MakeRGBA(240,231,181, 0), MakeRGBA(241,232,183, 0), MakeRGBA(242,233,185, 0), MakeRGBA(243,234,186, 0),
-	MakeRGBA(243,235,188, 0), MakeRGBA(244,236,190, 0), MakeRGBA(245,237,191, 0), MakeRGBA(246,238,193, 0),
-	MakeRGBA(247,239,194, 0), MakeRGBA(247,240,197, 0), MakeRGBA(248,240,200, 0), MakeRGBA(248,241,203, 0),
-	MakeRGBA(249,242,206, 0), MakeRGBA(249,243,209, 0), MakeRGBA(249,244,212, 0), MakeRGBA(250,244,215, 0),
-	MakeRGBA(250,245,218, 0), MakeRGBA(251,246,221, 0), MakeRGBA(251,247,225, 0), MakeRGBA(251,248,228, 0),
-	MakeRGBA(252,249,231, 0), MakeRGBA(252,249,234, 0), MakeRGBA(253,250,237, 0), MakeRGBA(253,251,240, 0),
-	MakeRGBA(253,252,243, 0), MakeRGBA(254,253,246, 0), MakeRGBA(254,253,249, 0), MakeRGBA(255,254,252, 0),
-};
-
-/** Recolour table for ColoureRange::COL_RANGE_YELLOW. */
-static const uint32 _recolour03[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  1,  0, 0), MakeRGBA(  7,  3,  0, 0), MakeRGBA( 11,  4,  0, 0),
-	MakeRGBA( 14,  5,  0, 0), MakeRGBA( 18,  7,  0, 0), MakeRGBA( 22,  8,  0, 0), MakeRGBA( 25, 10,  0, 0),
-	MakeRGBA( 29, 11,  0, 0), MakeRGBA( 32, 12,  0, 0), MakeRGBA( 36, 14,  0, 0), MakeRGBA( 40, 15,  0, 0),
-	MakeRGBA( 43, 16,  0, 0), MakeRGBA( 47, 18,  0, 0), MakeRGBA( 50, 19,  0, 0), MakeRGBA( 54, 21,  0, 0),
-	MakeRGBA( 58, 22,  0, 0), MakeRGBA( 61, 23,  0, 0), MakeRGBA( 65, 25,  0, 0), MakeRGBA( 69, 26,  0, 0),
-	MakeRGBA( 71, 27,  0, 0), MakeRGBA( 73, 28,  0, 0), MakeRGBA( 74, 29,  0, 0), MakeRGBA( 75, 30,  0, 0),
-	MakeRGBA( 76, 31,  0, 0), MakeRGBA( 77, 31,  0, 0), MakeRGBA( 79, 32,  0, 0), MakeRGBA( 80, 33,  0, 0),
-	MakeRGBA( 81, 34,  0, 0), MakeRGBA( 82, 35,  0, 0), MakeRGBA( 84, 35,  0, 0), MakeRGBA( 85, 36,  0, 0),
-	MakeRGBA( 86, 37,  0, 0), MakeRGBA( 87, 38,  0, 0), MakeRGBA( 88, 39,  0, 0), MakeRGBA( 90, 39,  0, 0),
-	MakeRGBA( 91, 40,  0, 0), MakeRGBA( 92, 41,  0, 0), MakeRGBA( 93, 42,  0, 0), MakeRGBA( 95, 43,  0, 0),
-	MakeRGBA( 96, 44,  0, 0), MakeRGBA( 97, 45,  0, 0), MakeRGBA( 98, 46,  0, 0), MakeRGBA( 99, 47,  0, 0),
-	MakeRGBA(101, 48,  0, 0), MakeRGBA(102, 49,  0, 0), MakeRGBA(103, 50,  0, 0), MakeRGBA(104, 51,  0, 0),
-	MakeRGBA(106, 52,  0, 0), MakeRGBA(107, 53,  0, 0), MakeRGBA(108, 54,  0, 0), MakeRGBA(109, 55,  0, 0),
-	MakeRGBA(110, 56,  0, 0), MakeRGBA(112, 57,  0, 0), MakeRGBA(113, 58,  0, 0), MakeRGBA(114, 59,  0, 0),
-	MakeRGBA(115, 60,  0, 0), MakeRGBA(116, 61,  0, 0), MakeRGBA(118, 62,  0, 0), MakeRGBA(119, 63,  0, 0),
-	MakeRGBA(120, 64,  0, 0), MakeRGBA(121, 65,  1, 0), MakeRGBA(123, 66,  1, 0), MakeRGBA(124, 67,  1, 0),
-	MakeRGBA(125, 68,  2, 0), MakeRGBA(126, 69,  2, 0), MakeRGBA(127, 70,  2, 0), MakeRGBA(129, 71,  3, 0),
-	MakeRGBA(130, 72,  3, 0), MakeRGBA(131, 73,  4, 0), MakeRGBA(132, 74,  4, 0), MakeRGBA(134, 75,  4, 0),
-	MakeRGBA(135, 76,  5, 0), MakeRGBA(136, 77,  5, 0), MakeRGBA(137, 78,  5, 0), MakeRGBA(138, 79,  6, 0),
-	MakeRGBA(140, 80,  6, 0), MakeRGBA(141, 81,  6, 0), MakeRGBA(142, 82,  7, 0), MakeRGBA(143, 83,  7, 0),
-	MakeRGBA(145, 85,  7, 0), MakeRGBA(146, 86,  7, 0), MakeRGBA(147, 88,  7, 0), MakeRGBA(148, 89,  7, 0),
-	MakeRGBA(149, 90,  7, 0), MakeRGBA(151, 92,  7, 0), MakeRGBA(152, 93,  7, 0), MakeRGBA(153, 95,  7, 0),
-	MakeRGBA(154, 96,  7, 0), MakeRGBA(155, 98,  7, 0), MakeRGBA(157, 99,  7, 0), MakeRGBA(158,100,  7, 0),
-	MakeRGBA(159,102,  7, 0), MakeRGBA(160,103,  7, 0), MakeRGBA(162,105,  7, 0), MakeRGBA(163,106,  7, 0),
-	MakeRGBA(164,108,  7, 0), MakeRGBA(165,109,  7, 0), MakeRGBA(166,110,  7, 0), MakeRGBA(168,112,  7, 0),
-	MakeRGBA(169,113,  8, 0), MakeRGBA(170,115,  8, 0), MakeRGBA(171,116,  8, 0), MakeRGBA(173,117,  9, 0),
-	MakeRGBA(174,119,  9, 0), MakeRGBA(175,120, 10, 0), MakeRGBA(176,122, 10, 0), MakeRGBA(177,123, 10, 0),
-	MakeRGBA(179,125, 11, 0), MakeRGBA(180,126, 11, 0), MakeRGBA(181,127, 12, 0), MakeRGBA(182,129, 12, 0),
-	MakeRGBA(184,130, 12, 0), MakeRGBA(185,132, 13, 0), MakeRGBA(186,133, 13, 0), MakeRGBA(187,135, 14, 0),
-	MakeRGBA(188,136, 14, 0), MakeRGBA(190,137, 15, 0), MakeRGBA(191,139, 15, 0), MakeRGBA(192,140, 15, 0),
-	MakeRGBA(193,142, 15, 0), MakeRGBA(194,143, 16, 0), MakeRGBA(196,144, 16, 0), MakeRGBA(197,146, 16, 0),
-	MakeRGBA(198,147, 16, 0), MakeRGBA(199,149, 16, 0), MakeRGBA(201,150, 17, 0), MakeRGBA(202,152, 17, 0),
-	MakeRGBA(203,153, 17, 0), MakeRGBA(204,154, 17, 0), MakeRGBA(205,156, 17, 0), MakeRGBA(207,157, 18, 0),
-	MakeRGBA(208,159, 18, 0), MakeRGBA(209,160, 18, 0), MakeRGBA(210,162, 18, 0), MakeRGBA(212,163, 18, 0),
-	MakeRGBA(213,164, 19, 0), MakeRGBA(214,166, 19, 0), MakeRGBA(215,167, 19, 0), MakeRGBA(217,169, 19, 0),
-	MakeRGBA(218,171, 20, 0), MakeRGBA(219,173, 20, 0), MakeRGBA(221,175, 21, 0), MakeRGBA(222,176, 21, 0),
-	MakeRGBA(224,178, 21, 0), MakeRGBA(225,180, 22, 0), MakeRGBA(227,182, 22, 0), MakeRGBA(228,184, 23, 0),
-	MakeRGBA(229,186, 23, 0), MakeRGBA(231,187, 24, 0), MakeRGBA(232,189, 24, 0), MakeRGBA(234,191, 24, 0),
-	MakeRGBA(235,193, 25, 0), MakeRGBA(237,195, 25, 0), MakeRGBA(238,197, 26, 0), MakeRGBA(239,198, 26, 0),
-	MakeRGBA(241,200, 26, 0), MakeRGBA(242,202, 27, 0), MakeRGBA(243,204, 27, 0), MakeRGBA(244,205, 28, 0),
-	MakeRGBA(245,207, 29, 0), MakeRGBA(245,208, 31, 0), MakeRGBA(246,209, 32, 0), MakeRGBA(246,211, 33, 0),
-	MakeRGBA(247,212, 34, 0), MakeRGBA(248,214, 35, 0), MakeRGBA(248,215, 36, 0), MakeRGBA(249,216, 37, 0),
-	MakeRGBA(249,218, 38, 0), MakeRGBA(250,219, 39, 0), MakeRGBA(251,221, 40, 0), MakeRGBA(251,222, 41, 0),
-	MakeRGBA(252,224, 42, 0), MakeRGBA(252,225, 43, 0), MakeRGBA(253,226, 44, 0), MakeRGBA(254,228, 45, 0),
-	MakeRGBA(254,229, 46, 0), MakeRGBA(255,231, 47, 0), MakeRGBA(255,231, 49, 0), MakeRGBA(255,232, 51, 0),
-	MakeRGBA(255,233, 54, 0), MakeRGBA(255,233, 56, 0), MakeRGBA(255,234, 59, 0), MakeRGBA(255,235, 61, 0),
-	MakeRGBA(255,235, 64, 0), MakeRGBA(255,236, 66, 0), MakeRGBA(255,236, 68, 0), MakeRGBA(255,237, 71, 0),
-	MakeRGBA(255,238, 73, 0), MakeRGBA(255,238, 76, 0), MakeRGBA(255,239, 78, 0), MakeRGBA(255,239, 81, 0),
-	MakeRGBA(255,240, 83, 0), MakeRGBA(255,241, 85, 0), MakeRGBA(255,241, 88, 0), MakeRGBA(255,242, 90, 0),
-	MakeRGBA(255,242, 93, 0), MakeRGBA(255,243, 95, 0), MakeRGBA(255,243, 98, 0), MakeRGBA(255,244,100, 0),
-	MakeRGBA(255,244,102, 0), MakeRGBA(255,245,105, 0), MakeRGBA(255,245,107, 0), MakeRGBA(255,245,110, 0),
-	MakeRGBA(255,246,112, 0), MakeRGBA(255,246,115, 0), MakeRGBA(255,247,117, 0), MakeRGBA(255,247,120, 0),
-	MakeRGBA(255,248,122, 0), MakeRGBA(255,248,124, 0), MakeRGBA(255,248,127, 0), MakeRGBA(255,249,129, 0),
-	MakeRGBA(255,249,132, 0), MakeRGBA(255,250,134, 0), MakeRGBA(255,250,137, 0), MakeRGBA(255,250,139, 0),
-	MakeRGBA(255,251,141, 0), MakeRGBA(255,251,144, 0), MakeRGBA(255,251,147, 0), MakeRGBA(255,251,149, 0),
-	MakeRGBA(255,252,152, 0), MakeRGBA(255,252,155, 0), MakeRGBA(255,252,157, 0), MakeRGBA(255,252,160, 0),
-	MakeRGBA(255,253,162, 0), MakeRGBA(255,253,165, 0), MakeRGBA(255,253,168, 0), MakeRGBA(255,253,170, 0),
-	MakeRGBA(255,253,173, 0), MakeRGBA(255,254,176, 0), MakeRGBA(255,254,178, 0), MakeRGBA(255,254,181, 0),
-	MakeRGBA(255,254,184, 0), MakeRGBA(255,254,186, 0), MakeRGBA(255,255,189, 0), MakeRGBA(255,255,192, 0),
-	MakeRGBA(255,255,194, 0), MakeRGBA(255,255,197, 0), MakeRGBA(255,255,200, 0), MakeRGBA(255,255,203, 0),
-	MakeRGBA(255,255,206, 0), MakeRGBA(255,255,209, 0), MakeRGBA(255,255,212, 0), MakeRGBA(255,255,215, 0),
-	MakeRGBA(255,255,218, 0), MakeRGBA(255,255,221, 0), MakeRGBA(255,255,225, 0), MakeRGBA(255,255,228, 0),
-	MakeRGBA(255,255,231, 0), MakeRGBA(255,255,234, 0), MakeRGBA(255,255,237, 0), MakeRGBA(255,255,240, 0),
-	MakeRGBA(255,255,243, 0), MakeRGBA(255,255,246, 0), MakeRGBA(255,255,249, 0), MakeRGBA(255,255,252, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_ORANGE_BROWN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  2,  0, 0), MakeRGBA(  7,  4,  1, 0), MakeRGBA( 10,  7,  1, 0),
+		MakeRGBA( 14,  9,  1, 0), MakeRGBA( 17, 11,  2, 0), MakeRGBA( 20, 13,  2, 0), MakeRGBA( 24, 15,  2, 0),
+		MakeRGBA( 27, 17,  3, 0), MakeRGBA( 31, 20,  3, 0), MakeRGBA( 34, 22,  4, 0), MakeRGBA( 37, 24,  4, 0),
+		MakeRGBA( 41, 26,  4, 0), MakeRGBA( 44, 28,  5, 0), MakeRGBA( 48, 31,  5, 0), MakeRGBA( 51, 33,  5, 0),
+		MakeRGBA( 54, 35,  6, 0), MakeRGBA( 58, 37,  6, 0), MakeRGBA( 61, 39,  6, 0), MakeRGBA( 65, 41,  7, 0),
+		MakeRGBA( 67, 43,  7, 0), MakeRGBA( 68, 44,  7, 0), MakeRGBA( 69, 45,  7, 0), MakeRGBA( 70, 46,  8, 0),
+		MakeRGBA( 71, 47,  8, 0), MakeRGBA( 72, 47,  8, 0), MakeRGBA( 73, 48,  8, 0), MakeRGBA( 74, 49,  8, 0),
+		MakeRGBA( 75, 50,  9, 0), MakeRGBA( 76, 51,  9, 0), MakeRGBA( 77, 51,  9, 0), MakeRGBA( 78, 52,  9, 0),
+		MakeRGBA( 80, 53, 10, 0), MakeRGBA( 81, 54, 10, 0), MakeRGBA( 82, 55, 10, 0), MakeRGBA( 83, 55, 10, 0),
+		MakeRGBA( 84, 56, 10, 0), MakeRGBA( 85, 57, 11, 0), MakeRGBA( 86, 58, 11, 0), MakeRGBA( 87, 59, 11, 0),
+		MakeRGBA( 88, 60, 11, 0), MakeRGBA( 89, 60, 12, 0), MakeRGBA( 90, 61, 13, 0), MakeRGBA( 91, 62, 13, 0),
+		MakeRGBA( 93, 63, 14, 0), MakeRGBA( 94, 64, 14, 0), MakeRGBA( 95, 64, 15, 0), MakeRGBA( 96, 65, 16, 0),
+		MakeRGBA( 98, 66, 16, 0), MakeRGBA( 99, 67, 17, 0), MakeRGBA(100, 68, 17, 0), MakeRGBA(101, 68, 18, 0),
+		MakeRGBA(102, 69, 19, 0), MakeRGBA(104, 70, 19, 0), MakeRGBA(105, 71, 20, 0), MakeRGBA(106, 72, 21, 0),
+		MakeRGBA(107, 73, 21, 0), MakeRGBA(108, 73, 22, 0), MakeRGBA(110, 74, 22, 0), MakeRGBA(111, 75, 23, 0),
+		MakeRGBA(112, 76, 23, 0), MakeRGBA(113, 76, 24, 0), MakeRGBA(113, 77, 24, 0), MakeRGBA(114, 77, 25, 0),
+		MakeRGBA(115, 78, 25, 0), MakeRGBA(116, 79, 25, 0), MakeRGBA(117, 79, 26, 0), MakeRGBA(117, 80, 26, 0),
+		MakeRGBA(118, 80, 27, 0), MakeRGBA(119, 81, 27, 0), MakeRGBA(120, 82, 27, 0), MakeRGBA(121, 82, 28, 0),
+		MakeRGBA(122, 83, 28, 0), MakeRGBA(122, 83, 29, 0), MakeRGBA(123, 84, 29, 0), MakeRGBA(124, 85, 29, 0),
+		MakeRGBA(125, 85, 30, 0), MakeRGBA(126, 86, 30, 0), MakeRGBA(126, 87, 31, 0), MakeRGBA(127, 87, 31, 0),
+		MakeRGBA(128, 88, 32, 0), MakeRGBA(129, 88, 32, 0), MakeRGBA(130, 89, 32, 0), MakeRGBA(130, 90, 33, 0),
+		MakeRGBA(131, 90, 33, 0), MakeRGBA(132, 91, 34, 0), MakeRGBA(133, 91, 34, 0), MakeRGBA(134, 92, 34, 0),
+		MakeRGBA(135, 93, 35, 0), MakeRGBA(135, 93, 35, 0), MakeRGBA(136, 94, 36, 0), MakeRGBA(137, 94, 36, 0),
+		MakeRGBA(138, 95, 36, 0), MakeRGBA(139, 96, 37, 0), MakeRGBA(139, 96, 37, 0), MakeRGBA(140, 97, 38, 0),
+		MakeRGBA(141, 98, 38, 0), MakeRGBA(142, 98, 38, 0), MakeRGBA(143, 99, 39, 0), MakeRGBA(143, 99, 39, 0),
+		MakeRGBA(144,100, 40, 0), MakeRGBA(145,101, 41, 0), MakeRGBA(146,102, 41, 0), MakeRGBA(147,103, 42, 0),
+		MakeRGBA(148,104, 42, 0), MakeRGBA(148,104, 43, 0), MakeRGBA(149,105, 44, 0), MakeRGBA(150,106, 44, 0),
+		MakeRGBA(151,107, 45, 0), MakeRGBA(152,108, 45, 0), MakeRGBA(152,108, 46, 0), MakeRGBA(153,109, 47, 0),
+		MakeRGBA(154,110, 47, 0), MakeRGBA(155,111, 48, 0), MakeRGBA(156,112, 48, 0), MakeRGBA(156,112, 49, 0),
+		MakeRGBA(157,113, 50, 0), MakeRGBA(158,114, 50, 0), MakeRGBA(159,115, 51, 0), MakeRGBA(160,116, 52, 0),
+		MakeRGBA(161,117, 52, 0), MakeRGBA(162,117, 53, 0), MakeRGBA(163,118, 54, 0), MakeRGBA(164,119, 55, 0),
+		MakeRGBA(165,120, 56, 0), MakeRGBA(166,121, 57, 0), MakeRGBA(167,121, 57, 0), MakeRGBA(168,122, 58, 0),
+		MakeRGBA(169,123, 59, 0), MakeRGBA(170,124, 60, 0), MakeRGBA(171,125, 61, 0), MakeRGBA(172,125, 61, 0),
+		MakeRGBA(173,126, 62, 0), MakeRGBA(174,127, 63, 0), MakeRGBA(175,128, 64, 0), MakeRGBA(176,129, 65, 0),
+		MakeRGBA(177,130, 66, 0), MakeRGBA(178,130, 66, 0), MakeRGBA(179,131, 67, 0), MakeRGBA(180,132, 68, 0),
+		MakeRGBA(180,133, 69, 0), MakeRGBA(181,134, 70, 0), MakeRGBA(182,135, 71, 0), MakeRGBA(182,136, 72, 0),
+		MakeRGBA(183,137, 73, 0), MakeRGBA(183,138, 74, 0), MakeRGBA(184,139, 75, 0), MakeRGBA(185,140, 76, 0),
+		MakeRGBA(185,141, 77, 0), MakeRGBA(186,142, 78, 0), MakeRGBA(186,143, 79, 0), MakeRGBA(187,144, 80, 0),
+		MakeRGBA(188,145, 81, 0), MakeRGBA(188,146, 82, 0), MakeRGBA(189,147, 83, 0), MakeRGBA(189,148, 84, 0),
+		MakeRGBA(190,149, 85, 0), MakeRGBA(191,150, 86, 0), MakeRGBA(191,152, 88, 0), MakeRGBA(192,153, 89, 0),
+		MakeRGBA(193,154, 90, 0), MakeRGBA(193,155, 91, 0), MakeRGBA(194,156, 92, 0), MakeRGBA(194,158, 94, 0),
+		MakeRGBA(195,159, 95, 0), MakeRGBA(196,160, 96, 0), MakeRGBA(196,161, 97, 0), MakeRGBA(197,163, 99, 0),
+		MakeRGBA(197,164,100, 0), MakeRGBA(198,165,101, 0), MakeRGBA(199,166,102, 0), MakeRGBA(199,167,103, 0),
+		MakeRGBA(200,169,105, 0), MakeRGBA(200,170,106, 0), MakeRGBA(201,171,107, 0), MakeRGBA(202,172,108, 0),
+		MakeRGBA(202,174,109, 0), MakeRGBA(203,175,111, 0), MakeRGBA(204,176,112, 0), MakeRGBA(204,177,113, 0),
+		MakeRGBA(205,178,114, 0), MakeRGBA(206,180,116, 0), MakeRGBA(207,181,117, 0), MakeRGBA(208,182,118, 0),
+		MakeRGBA(209,183,119, 0), MakeRGBA(209,184,120, 0), MakeRGBA(210,186,122, 0), MakeRGBA(211,187,123, 0),
+		MakeRGBA(212,188,124, 0), MakeRGBA(213,189,125, 0), MakeRGBA(213,191,127, 0), MakeRGBA(214,192,128, 0),
+		MakeRGBA(215,193,129, 0), MakeRGBA(216,194,130, 0), MakeRGBA(217,195,131, 0), MakeRGBA(217,197,133, 0),
+		MakeRGBA(218,198,134, 0), MakeRGBA(219,199,135, 0), MakeRGBA(220,200,137, 0), MakeRGBA(220,201,138, 0),
+		MakeRGBA(221,202,139, 0), MakeRGBA(221,203,141, 0), MakeRGBA(222,204,142, 0), MakeRGBA(223,205,144, 0),
+		MakeRGBA(223,206,145, 0), MakeRGBA(224,207,146, 0), MakeRGBA(225,208,148, 0), MakeRGBA(225,209,149, 0),
+		MakeRGBA(226,210,151, 0), MakeRGBA(226,211,152, 0), MakeRGBA(227,212,154, 0), MakeRGBA(228,213,155, 0),
+		MakeRGBA(228,214,156, 0), MakeRGBA(229,215,158, 0), MakeRGBA(229,216,159, 0), MakeRGBA(230,217,161, 0),
+		MakeRGBA(231,218,162, 0), MakeRGBA(231,219,164, 0), MakeRGBA(232,220,165, 0), MakeRGBA(233,221,167, 0),
+		MakeRGBA(234,222,168, 0), MakeRGBA(235,223,170, 0), MakeRGBA(235,224,172, 0), MakeRGBA(236,225,173, 0),
+		MakeRGBA(237,226,175, 0), MakeRGBA(238,228,177, 0), MakeRGBA(239,229,178, 0), MakeRGBA(239,230,180, 0),
+		MakeRGBA(240,231,181, 0), MakeRGBA(241,232,183, 0), MakeRGBA(242,233,185, 0), MakeRGBA(243,234,186, 0),
+		MakeRGBA(243,235,188, 0), MakeRGBA(244,236,190, 0), MakeRGBA(245,237,191, 0), MakeRGBA(246,238,193, 0),
+		MakeRGBA(247,239,194, 0), MakeRGBA(247,240,197, 0), MakeRGBA(248,240,200, 0), MakeRGBA(248,241,203, 0),
+		MakeRGBA(249,242,206, 0), MakeRGBA(249,243,209, 0), MakeRGBA(249,244,212, 0), MakeRGBA(250,244,215, 0),
+		MakeRGBA(250,245,218, 0), MakeRGBA(251,246,221, 0), MakeRGBA(251,247,225, 0), MakeRGBA(251,248,228, 0),
+		MakeRGBA(252,249,231, 0), MakeRGBA(252,249,234, 0), MakeRGBA(253,250,237, 0), MakeRGBA(253,251,240, 0),
+		MakeRGBA(253,252,243, 0), MakeRGBA(254,253,246, 0), MakeRGBA(254,253,249, 0), MakeRGBA(255,254,252, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_DARK_RED. */
-static const uint32 _recolour04[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  0,  0, 0), MakeRGBA(  4,  0,  0, 0), MakeRGBA(  5,  0,  0, 0),
-	MakeRGBA(  7,  0,  0, 0), MakeRGBA(  9,  0,  0, 0), MakeRGBA( 11,  0,  0, 0), MakeRGBA( 12,  0,  0, 0),
-	MakeRGBA( 14,  0,  0, 0), MakeRGBA( 16,  0,  0, 0), MakeRGBA( 18,  0,  0, 0), MakeRGBA( 20,  0,  0, 0),
-	MakeRGBA( 21,  0,  0, 0), MakeRGBA( 23,  0,  0, 0), MakeRGBA( 25,  0,  0, 0), MakeRGBA( 27,  0,  0, 0),
-	MakeRGBA( 28,  0,  0, 0), MakeRGBA( 30,  0,  0, 0), MakeRGBA( 32,  0,  0, 0), MakeRGBA( 34,  0,  0, 0),
-	MakeRGBA( 36,  0,  0, 0), MakeRGBA( 38,  0,  0, 0), MakeRGBA( 40,  0,  0, 0), MakeRGBA( 42,  0,  0, 0),
-	MakeRGBA( 45,  0,  0, 0), MakeRGBA( 47,  0,  0, 0), MakeRGBA( 49,  0,  0, 0), MakeRGBA( 51,  0,  0, 0),
-	MakeRGBA( 54,  0,  0, 0), MakeRGBA( 56,  0,  0, 0), MakeRGBA( 58,  0,  0, 0), MakeRGBA( 60,  0,  0, 0),
-	MakeRGBA( 63,  0,  0, 0), MakeRGBA( 65,  0,  0, 0), MakeRGBA( 67,  0,  0, 0), MakeRGBA( 69,  0,  0, 0),
-	MakeRGBA( 71,  0,  0, 0), MakeRGBA( 74,  0,  0, 0), MakeRGBA( 76,  0,  0, 0), MakeRGBA( 78,  0,  0, 0),
-	MakeRGBA( 80,  0,  0, 0), MakeRGBA( 80,  1,  1, 0), MakeRGBA( 81,  1,  1, 0), MakeRGBA( 82,  1,  1, 0),
-	MakeRGBA( 83,  2,  2, 0), MakeRGBA( 84,  2,  2, 0), MakeRGBA( 84,  2,  2, 0), MakeRGBA( 85,  3,  3, 0),
-	MakeRGBA( 86,  3,  3, 0), MakeRGBA( 87,  3,  3, 0), MakeRGBA( 88,  4,  4, 0), MakeRGBA( 88,  4,  4, 0),
-	MakeRGBA( 89,  4,  4, 0), MakeRGBA( 90,  5,  5, 0), MakeRGBA( 91,  5,  5, 0), MakeRGBA( 92,  6,  6, 0),
-	MakeRGBA( 93,  6,  6, 0), MakeRGBA( 93,  6,  6, 0), MakeRGBA( 94,  7,  7, 0), MakeRGBA( 95,  7,  7, 0),
-	MakeRGBA( 96,  7,  7, 0), MakeRGBA( 97,  8,  8, 0), MakeRGBA( 97,  8,  8, 0), MakeRGBA( 98,  9,  9, 0),
-	MakeRGBA( 99,  9,  9, 0), MakeRGBA(100,  9,  9, 0), MakeRGBA(101, 10, 10, 0), MakeRGBA(101, 10, 10, 0),
-	MakeRGBA(102, 11, 11, 0), MakeRGBA(103, 11, 11, 0), MakeRGBA(104, 11, 11, 0), MakeRGBA(105, 12, 12, 0),
-	MakeRGBA(106, 12, 12, 0), MakeRGBA(106, 13, 13, 0), MakeRGBA(107, 13, 13, 0), MakeRGBA(108, 13, 13, 0),
-	MakeRGBA(109, 14, 14, 0), MakeRGBA(110, 14, 14, 0), MakeRGBA(110, 15, 15, 0), MakeRGBA(111, 15, 15, 0),
-	MakeRGBA(112, 16, 16, 0), MakeRGBA(113, 16, 16, 0), MakeRGBA(114, 17, 17, 0), MakeRGBA(114, 18, 18, 0),
-	MakeRGBA(115, 18, 18, 0), MakeRGBA(116, 19, 19, 0), MakeRGBA(117, 19, 19, 0), MakeRGBA(118, 20, 20, 0),
-	MakeRGBA(119, 21, 21, 0), MakeRGBA(119, 21, 21, 0), MakeRGBA(120, 22, 22, 0), MakeRGBA(121, 22, 22, 0),
-	MakeRGBA(122, 23, 23, 0), MakeRGBA(123, 24, 24, 0), MakeRGBA(123, 24, 24, 0), MakeRGBA(124, 25, 25, 0),
-	MakeRGBA(125, 25, 25, 0), MakeRGBA(126, 26, 26, 0), MakeRGBA(127, 27, 27, 0), MakeRGBA(127, 27, 27, 0),
-	MakeRGBA(128, 28, 28, 0), MakeRGBA(129, 29, 29, 0), MakeRGBA(130, 29, 29, 0), MakeRGBA(131, 30, 30, 0),
-	MakeRGBA(132, 30, 30, 0), MakeRGBA(132, 31, 31, 0), MakeRGBA(133, 32, 32, 0), MakeRGBA(134, 32, 32, 0),
-	MakeRGBA(135, 33, 33, 0), MakeRGBA(136, 33, 33, 0), MakeRGBA(136, 34, 34, 0), MakeRGBA(137, 35, 35, 0),
-	MakeRGBA(138, 35, 35, 0), MakeRGBA(139, 36, 36, 0), MakeRGBA(140, 36, 36, 0), MakeRGBA(140, 37, 37, 0),
-	MakeRGBA(141, 38, 38, 0), MakeRGBA(142, 38, 38, 0), MakeRGBA(143, 39, 39, 0), MakeRGBA(144, 40, 40, 0),
-	MakeRGBA(145, 41, 41, 0), MakeRGBA(146, 42, 42, 0), MakeRGBA(147, 43, 43, 0), MakeRGBA(148, 44, 44, 0),
-	MakeRGBA(149, 45, 45, 0), MakeRGBA(150, 46, 46, 0), MakeRGBA(151, 47, 47, 0), MakeRGBA(152, 48, 48, 0),
-	MakeRGBA(153, 49, 49, 0), MakeRGBA(154, 50, 50, 0), MakeRGBA(155, 51, 51, 0), MakeRGBA(156, 52, 52, 0),
-	MakeRGBA(157, 53, 53, 0), MakeRGBA(158, 54, 54, 0), MakeRGBA(159, 55, 55, 0), MakeRGBA(160, 56, 56, 0),
-	MakeRGBA(161, 57, 57, 0), MakeRGBA(162, 58, 58, 0), MakeRGBA(163, 59, 59, 0), MakeRGBA(164, 60, 60, 0),
-	MakeRGBA(165, 61, 61, 0), MakeRGBA(166, 62, 62, 0), MakeRGBA(166, 63, 63, 0), MakeRGBA(167, 64, 64, 0),
-	MakeRGBA(168, 65, 65, 0), MakeRGBA(169, 66, 66, 0), MakeRGBA(170, 67, 67, 0), MakeRGBA(170, 68, 68, 0),
-	MakeRGBA(171, 69, 69, 0), MakeRGBA(172, 70, 70, 0), MakeRGBA(173, 71, 71, 0), MakeRGBA(174, 72, 72, 0),
-	MakeRGBA(174, 73, 73, 0), MakeRGBA(175, 74, 74, 0), MakeRGBA(176, 75, 75, 0), MakeRGBA(177, 76, 76, 0),
-	MakeRGBA(178, 77, 77, 0), MakeRGBA(179, 78, 78, 0), MakeRGBA(179, 80, 80, 0), MakeRGBA(180, 81, 81, 0),
-	MakeRGBA(182, 82, 82, 0), MakeRGBA(183, 83, 83, 0), MakeRGBA(184, 84, 84, 0), MakeRGBA(185, 86, 86, 0),
-	MakeRGBA(186, 87, 87, 0), MakeRGBA(187, 88, 88, 0), MakeRGBA(188, 89, 89, 0), MakeRGBA(189, 91, 91, 0),
-	MakeRGBA(190, 92, 92, 0), MakeRGBA(191, 93, 93, 0), MakeRGBA(192, 94, 94, 0), MakeRGBA(193, 95, 95, 0),
-	MakeRGBA(194, 97, 97, 0), MakeRGBA(195, 98, 98, 0), MakeRGBA(196, 99, 99, 0), MakeRGBA(197,100,100, 0),
-	MakeRGBA(198,101,101, 0), MakeRGBA(199,103,103, 0), MakeRGBA(200,104,104, 0), MakeRGBA(200,105,105, 0),
-	MakeRGBA(201,106,106, 0), MakeRGBA(202,108,108, 0), MakeRGBA(203,109,109, 0), MakeRGBA(204,110,110, 0),
-	MakeRGBA(205,111,111, 0), MakeRGBA(205,112,112, 0), MakeRGBA(206,114,114, 0), MakeRGBA(207,115,115, 0),
-	MakeRGBA(208,116,116, 0), MakeRGBA(209,117,117, 0), MakeRGBA(209,119,119, 0), MakeRGBA(210,120,120, 0),
-	MakeRGBA(211,121,121, 0), MakeRGBA(212,122,122, 0), MakeRGBA(213,123,123, 0), MakeRGBA(213,125,125, 0),
-	MakeRGBA(214,126,126, 0), MakeRGBA(215,127,127, 0), MakeRGBA(216,129,129, 0), MakeRGBA(217,130,130, 0),
-	MakeRGBA(218,132,132, 0), MakeRGBA(219,134,134, 0), MakeRGBA(220,135,135, 0), MakeRGBA(221,137,137, 0),
-	MakeRGBA(222,138,138, 0), MakeRGBA(223,140,140, 0), MakeRGBA(224,142,142, 0), MakeRGBA(225,143,143, 0),
-	MakeRGBA(226,145,145, 0), MakeRGBA(227,147,147, 0), MakeRGBA(228,148,148, 0), MakeRGBA(229,150,150, 0),
-	MakeRGBA(230,151,151, 0), MakeRGBA(231,153,153, 0), MakeRGBA(232,155,155, 0), MakeRGBA(233,156,156, 0),
-	MakeRGBA(234,158,158, 0), MakeRGBA(235,160,160, 0), MakeRGBA(236,161,161, 0), MakeRGBA(237,163,163, 0),
-	MakeRGBA(238,164,164, 0), MakeRGBA(239,166,166, 0), MakeRGBA(240,168,168, 0), MakeRGBA(241,169,169, 0),
-	MakeRGBA(242,171,171, 0), MakeRGBA(244,173,173, 0), MakeRGBA(245,174,174, 0), MakeRGBA(246,176,176, 0),
-	MakeRGBA(247,177,177, 0), MakeRGBA(248,179,179, 0), MakeRGBA(249,181,181, 0), MakeRGBA(250,182,182, 0),
-	MakeRGBA(251,184,184, 0), MakeRGBA(252,186,186, 0), MakeRGBA(253,187,187, 0), MakeRGBA(254,189,189, 0),
-	MakeRGBA(255,190,190, 0), MakeRGBA(255,193,193, 0), MakeRGBA(255,196,196, 0), MakeRGBA(255,200,200, 0),
-	MakeRGBA(255,203,203, 0), MakeRGBA(255,206,206, 0), MakeRGBA(255,209,209, 0), MakeRGBA(255,213,213, 0),
-	MakeRGBA(255,216,216, 0), MakeRGBA(255,219,219, 0), MakeRGBA(255,222,222, 0), MakeRGBA(255,226,226, 0),
-	MakeRGBA(255,229,229, 0), MakeRGBA(255,232,232, 0), MakeRGBA(255,235,235, 0), MakeRGBA(255,239,239, 0),
-	MakeRGBA(255,242,242, 0), MakeRGBA(255,245,245, 0), MakeRGBA(255,248,248, 0), MakeRGBA(255,252,252, 0),
-};
+	/* Recolour table for ColoureRange::COL_RANGE_YELLOW. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  1,  0, 0), MakeRGBA(  7,  3,  0, 0), MakeRGBA( 11,  4,  0, 0),
+		MakeRGBA( 14,  5,  0, 0), MakeRGBA( 18,  7,  0, 0), MakeRGBA( 22,  8,  0, 0), MakeRGBA( 25, 10,  0, 0),
+		MakeRGBA( 29, 11,  0, 0), MakeRGBA( 32, 12,  0, 0), MakeRGBA( 36, 14,  0, 0), MakeRGBA( 40, 15,  0, 0),
+		MakeRGBA( 43, 16,  0, 0), MakeRGBA( 47, 18,  0, 0), MakeRGBA( 50, 19,  0, 0), MakeRGBA( 54, 21,  0, 0),
+		MakeRGBA( 58, 22,  0, 0), MakeRGBA( 61, 23,  0, 0), MakeRGBA( 65, 25,  0, 0), MakeRGBA( 69, 26,  0, 0),
+		MakeRGBA( 71, 27,  0, 0), MakeRGBA( 73, 28,  0, 0), MakeRGBA( 74, 29,  0, 0), MakeRGBA( 75, 30,  0, 0),
+		MakeRGBA( 76, 31,  0, 0), MakeRGBA( 77, 31,  0, 0), MakeRGBA( 79, 32,  0, 0), MakeRGBA( 80, 33,  0, 0),
+		MakeRGBA( 81, 34,  0, 0), MakeRGBA( 82, 35,  0, 0), MakeRGBA( 84, 35,  0, 0), MakeRGBA( 85, 36,  0, 0),
+		MakeRGBA( 86, 37,  0, 0), MakeRGBA( 87, 38,  0, 0), MakeRGBA( 88, 39,  0, 0), MakeRGBA( 90, 39,  0, 0),
+		MakeRGBA( 91, 40,  0, 0), MakeRGBA( 92, 41,  0, 0), MakeRGBA( 93, 42,  0, 0), MakeRGBA( 95, 43,  0, 0),
+		MakeRGBA( 96, 44,  0, 0), MakeRGBA( 97, 45,  0, 0), MakeRGBA( 98, 46,  0, 0), MakeRGBA( 99, 47,  0, 0),
+		MakeRGBA(101, 48,  0, 0), MakeRGBA(102, 49,  0, 0), MakeRGBA(103, 50,  0, 0), MakeRGBA(104, 51,  0, 0),
+		MakeRGBA(106, 52,  0, 0), MakeRGBA(107, 53,  0, 0), MakeRGBA(108, 54,  0, 0), MakeRGBA(109, 55,  0, 0),
+		MakeRGBA(110, 56,  0, 0), MakeRGBA(112, 57,  0, 0), MakeRGBA(113, 58,  0, 0), MakeRGBA(114, 59,  0, 0),
+		MakeRGBA(115, 60,  0, 0), MakeRGBA(116, 61,  0, 0), MakeRGBA(118, 62,  0, 0), MakeRGBA(119, 63,  0, 0),
+		MakeRGBA(120, 64,  0, 0), MakeRGBA(121, 65,  1, 0), MakeRGBA(123, 66,  1, 0), MakeRGBA(124, 67,  1, 0),
+		MakeRGBA(125, 68,  2, 0), MakeRGBA(126, 69,  2, 0), MakeRGBA(127, 70,  2, 0), MakeRGBA(129, 71,  3, 0),
+		MakeRGBA(130, 72,  3, 0), MakeRGBA(131, 73,  4, 0), MakeRGBA(132, 74,  4, 0), MakeRGBA(134, 75,  4, 0),
+		MakeRGBA(135, 76,  5, 0), MakeRGBA(136, 77,  5, 0), MakeRGBA(137, 78,  5, 0), MakeRGBA(138, 79,  6, 0),
+		MakeRGBA(140, 80,  6, 0), MakeRGBA(141, 81,  6, 0), MakeRGBA(142, 82,  7, 0), MakeRGBA(143, 83,  7, 0),
+		MakeRGBA(145, 85,  7, 0), MakeRGBA(146, 86,  7, 0), MakeRGBA(147, 88,  7, 0), MakeRGBA(148, 89,  7, 0),
+		MakeRGBA(149, 90,  7, 0), MakeRGBA(151, 92,  7, 0), MakeRGBA(152, 93,  7, 0), MakeRGBA(153, 95,  7, 0),
+		MakeRGBA(154, 96,  7, 0), MakeRGBA(155, 98,  7, 0), MakeRGBA(157, 99,  7, 0), MakeRGBA(158,100,  7, 0),
+		MakeRGBA(159,102,  7, 0), MakeRGBA(160,103,  7, 0), MakeRGBA(162,105,  7, 0), MakeRGBA(163,106,  7, 0),
+		MakeRGBA(164,108,  7, 0), MakeRGBA(165,109,  7, 0), MakeRGBA(166,110,  7, 0), MakeRGBA(168,112,  7, 0),
+		MakeRGBA(169,113,  8, 0), MakeRGBA(170,115,  8, 0), MakeRGBA(171,116,  8, 0), MakeRGBA(173,117,  9, 0),
+		MakeRGBA(174,119,  9, 0), MakeRGBA(175,120, 10, 0), MakeRGBA(176,122, 10, 0), MakeRGBA(177,123, 10, 0),
+		MakeRGBA(179,125, 11, 0), MakeRGBA(180,126, 11, 0), MakeRGBA(181,127, 12, 0), MakeRGBA(182,129, 12, 0),
+		MakeRGBA(184,130, 12, 0), MakeRGBA(185,132, 13, 0), MakeRGBA(186,133, 13, 0), MakeRGBA(187,135, 14, 0),
+		MakeRGBA(188,136, 14, 0), MakeRGBA(190,137, 15, 0), MakeRGBA(191,139, 15, 0), MakeRGBA(192,140, 15, 0),
+		MakeRGBA(193,142, 15, 0), MakeRGBA(194,143, 16, 0), MakeRGBA(196,144, 16, 0), MakeRGBA(197,146, 16, 0),
+		MakeRGBA(198,147, 16, 0), MakeRGBA(199,149, 16, 0), MakeRGBA(201,150, 17, 0), MakeRGBA(202,152, 17, 0),
+		MakeRGBA(203,153, 17, 0), MakeRGBA(204,154, 17, 0), MakeRGBA(205,156, 17, 0), MakeRGBA(207,157, 18, 0),
+		MakeRGBA(208,159, 18, 0), MakeRGBA(209,160, 18, 0), MakeRGBA(210,162, 18, 0), MakeRGBA(212,163, 18, 0),
+		MakeRGBA(213,164, 19, 0), MakeRGBA(214,166, 19, 0), MakeRGBA(215,167, 19, 0), MakeRGBA(217,169, 19, 0),
+		MakeRGBA(218,171, 20, 0), MakeRGBA(219,173, 20, 0), MakeRGBA(221,175, 21, 0), MakeRGBA(222,176, 21, 0),
+		MakeRGBA(224,178, 21, 0), MakeRGBA(225,180, 22, 0), MakeRGBA(227,182, 22, 0), MakeRGBA(228,184, 23, 0),
+		MakeRGBA(229,186, 23, 0), MakeRGBA(231,187, 24, 0), MakeRGBA(232,189, 24, 0), MakeRGBA(234,191, 24, 0),
+		MakeRGBA(235,193, 25, 0), MakeRGBA(237,195, 25, 0), MakeRGBA(238,197, 26, 0), MakeRGBA(239,198, 26, 0),
+		MakeRGBA(241,200, 26, 0), MakeRGBA(242,202, 27, 0), MakeRGBA(243,204, 27, 0), MakeRGBA(244,205, 28, 0),
+		MakeRGBA(245,207, 29, 0), MakeRGBA(245,208, 31, 0), MakeRGBA(246,209, 32, 0), MakeRGBA(246,211, 33, 0),
+		MakeRGBA(247,212, 34, 0), MakeRGBA(248,214, 35, 0), MakeRGBA(248,215, 36, 0), MakeRGBA(249,216, 37, 0),
+		MakeRGBA(249,218, 38, 0), MakeRGBA(250,219, 39, 0), MakeRGBA(251,221, 40, 0), MakeRGBA(251,222, 41, 0),
+		MakeRGBA(252,224, 42, 0), MakeRGBA(252,225, 43, 0), MakeRGBA(253,226, 44, 0), MakeRGBA(254,228, 45, 0),
+		MakeRGBA(254,229, 46, 0), MakeRGBA(255,231, 47, 0), MakeRGBA(255,231, 49, 0), MakeRGBA(255,232, 51, 0),
+		MakeRGBA(255,233, 54, 0), MakeRGBA(255,233, 56, 0), MakeRGBA(255,234, 59, 0), MakeRGBA(255,235, 61, 0),
+		MakeRGBA(255,235, 64, 0), MakeRGBA(255,236, 66, 0), MakeRGBA(255,236, 68, 0), MakeRGBA(255,237, 71, 0),
+		MakeRGBA(255,238, 73, 0), MakeRGBA(255,238, 76, 0), MakeRGBA(255,239, 78, 0), MakeRGBA(255,239, 81, 0),
+		MakeRGBA(255,240, 83, 0), MakeRGBA(255,241, 85, 0), MakeRGBA(255,241, 88, 0), MakeRGBA(255,242, 90, 0),
+		MakeRGBA(255,242, 93, 0), MakeRGBA(255,243, 95, 0), MakeRGBA(255,243, 98, 0), MakeRGBA(255,244,100, 0),
+		MakeRGBA(255,244,102, 0), MakeRGBA(255,245,105, 0), MakeRGBA(255,245,107, 0), MakeRGBA(255,245,110, 0),
+		MakeRGBA(255,246,112, 0), MakeRGBA(255,246,115, 0), MakeRGBA(255,247,117, 0), MakeRGBA(255,247,120, 0),
+		MakeRGBA(255,248,122, 0), MakeRGBA(255,248,124, 0), MakeRGBA(255,248,127, 0), MakeRGBA(255,249,129, 0),
+		MakeRGBA(255,249,132, 0), MakeRGBA(255,250,134, 0), MakeRGBA(255,250,137, 0), MakeRGBA(255,250,139, 0),
+		MakeRGBA(255,251,141, 0), MakeRGBA(255,251,144, 0), MakeRGBA(255,251,147, 0), MakeRGBA(255,251,149, 0),
+		MakeRGBA(255,252,152, 0), MakeRGBA(255,252,155, 0), MakeRGBA(255,252,157, 0), MakeRGBA(255,252,160, 0),
+		MakeRGBA(255,253,162, 0), MakeRGBA(255,253,165, 0), MakeRGBA(255,253,168, 0), MakeRGBA(255,253,170, 0),
+		MakeRGBA(255,253,173, 0), MakeRGBA(255,254,176, 0), MakeRGBA(255,254,178, 0), MakeRGBA(255,254,181, 0),
+		MakeRGBA(255,254,184, 0), MakeRGBA(255,254,186, 0), MakeRGBA(255,255,189, 0), MakeRGBA(255,255,192, 0),
+		MakeRGBA(255,255,194, 0), MakeRGBA(255,255,197, 0), MakeRGBA(255,255,200, 0), MakeRGBA(255,255,203, 0),
+		MakeRGBA(255,255,206, 0), MakeRGBA(255,255,209, 0), MakeRGBA(255,255,212, 0), MakeRGBA(255,255,215, 0),
+		MakeRGBA(255,255,218, 0), MakeRGBA(255,255,221, 0), MakeRGBA(255,255,225, 0), MakeRGBA(255,255,228, 0),
+		MakeRGBA(255,255,231, 0), MakeRGBA(255,255,234, 0), MakeRGBA(255,255,237, 0), MakeRGBA(255,255,240, 0),
+		MakeRGBA(255,255,243, 0), MakeRGBA(255,255,246, 0), MakeRGBA(255,255,249, 0), MakeRGBA(255,255,252, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_DARK_GREEN. */
-static const uint32 _recolour05[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  3,  1, 0), MakeRGBA(  3,  5,  2, 0), MakeRGBA(  4,  8,  3, 0),
-	MakeRGBA(  5, 10,  4, 0), MakeRGBA(  7, 13,  5, 0), MakeRGBA(  8, 16,  6, 0), MakeRGBA( 10, 18,  7, 0),
-	MakeRGBA( 11, 21,  8, 0), MakeRGBA( 12, 23,  9, 0), MakeRGBA( 14, 26, 10, 0), MakeRGBA( 15, 28, 11, 0),
-	MakeRGBA( 16, 31, 12, 0), MakeRGBA( 18, 34, 13, 0), MakeRGBA( 19, 36, 14, 0), MakeRGBA( 21, 39, 14, 0),
-	MakeRGBA( 22, 41, 15, 0), MakeRGBA( 23, 44, 16, 0), MakeRGBA( 25, 47, 17, 0), MakeRGBA( 26, 49, 18, 0),
-	MakeRGBA( 27, 51, 19, 0), MakeRGBA( 28, 52, 19, 0), MakeRGBA( 28, 52, 19, 0), MakeRGBA( 28, 53, 20, 0),
-	MakeRGBA( 29, 54, 20, 0), MakeRGBA( 29, 54, 20, 0), MakeRGBA( 30, 55, 20, 0), MakeRGBA( 30, 55, 20, 0),
-	MakeRGBA( 30, 56, 21, 0), MakeRGBA( 31, 57, 21, 0), MakeRGBA( 31, 57, 21, 0), MakeRGBA( 32, 58, 21, 0),
-	MakeRGBA( 32, 59, 22, 0), MakeRGBA( 32, 59, 22, 0), MakeRGBA( 33, 60, 22, 0), MakeRGBA( 33, 60, 22, 0),
-	MakeRGBA( 34, 61, 22, 0), MakeRGBA( 34, 62, 23, 0), MakeRGBA( 34, 62, 23, 0), MakeRGBA( 35, 63, 23, 0),
-	MakeRGBA( 35, 64, 23, 0), MakeRGBA( 36, 64, 24, 0), MakeRGBA( 37, 65, 24, 0), MakeRGBA( 37, 66, 24, 0),
-	MakeRGBA( 38, 67, 25, 0), MakeRGBA( 38, 68, 25, 0), MakeRGBA( 39, 68, 26, 0), MakeRGBA( 40, 69, 26, 0),
-	MakeRGBA( 40, 70, 27, 0), MakeRGBA( 41, 71, 27, 0), MakeRGBA( 41, 72, 27, 0), MakeRGBA( 42, 72, 28, 0),
-	MakeRGBA( 43, 73, 28, 0), MakeRGBA( 43, 74, 29, 0), MakeRGBA( 44, 75, 29, 0), MakeRGBA( 45, 76, 29, 0),
-	MakeRGBA( 45, 77, 30, 0), MakeRGBA( 46, 77, 30, 0), MakeRGBA( 46, 78, 31, 0), MakeRGBA( 47, 79, 31, 0),
-	MakeRGBA( 48, 80, 31, 0), MakeRGBA( 48, 81, 32, 0), MakeRGBA( 49, 81, 32, 0), MakeRGBA( 49, 82, 33, 0),
-	MakeRGBA( 50, 83, 33, 0), MakeRGBA( 51, 84, 33, 0), MakeRGBA( 51, 85, 34, 0), MakeRGBA( 52, 85, 34, 0),
-	MakeRGBA( 52, 86, 35, 0), MakeRGBA( 53, 87, 35, 0), MakeRGBA( 54, 88, 35, 0), MakeRGBA( 54, 89, 36, 0),
-	MakeRGBA( 55, 90, 36, 0), MakeRGBA( 55, 90, 37, 0), MakeRGBA( 56, 91, 37, 0), MakeRGBA( 57, 92, 37, 0),
-	MakeRGBA( 57, 93, 38, 0), MakeRGBA( 58, 94, 38, 0), MakeRGBA( 59, 94, 39, 0), MakeRGBA( 59, 95, 39, 0),
-	MakeRGBA( 60, 96, 39, 0), MakeRGBA( 60, 97, 39, 0), MakeRGBA( 61, 98, 40, 0), MakeRGBA( 62, 98, 40, 0),
-	MakeRGBA( 62, 99, 40, 0), MakeRGBA( 63,100, 40, 0), MakeRGBA( 63,101, 40, 0), MakeRGBA( 64,102, 41, 0),
-	MakeRGBA( 65,103, 41, 0), MakeRGBA( 65,103, 41, 0), MakeRGBA( 66,104, 41, 0), MakeRGBA( 66,105, 41, 0),
-	MakeRGBA( 67,106, 42, 0), MakeRGBA( 68,107, 42, 0), MakeRGBA( 68,107, 42, 0), MakeRGBA( 69,108, 42, 0),
-	MakeRGBA( 70,109, 43, 0), MakeRGBA( 70,110, 43, 0), MakeRGBA( 71,111, 43, 0), MakeRGBA( 71,111, 43, 0),
-	MakeRGBA( 72,112, 44, 0), MakeRGBA( 73,113, 44, 0), MakeRGBA( 74,114, 44, 0), MakeRGBA( 75,115, 45, 0),
-	MakeRGBA( 76,116, 45, 0), MakeRGBA( 76,116, 46, 0), MakeRGBA( 77,117, 46, 0), MakeRGBA( 78,118, 46, 0),
-	MakeRGBA( 79,119, 47, 0), MakeRGBA( 80,120, 47, 0), MakeRGBA( 80,120, 48, 0), MakeRGBA( 81,121, 48, 0),
-	MakeRGBA( 82,122, 49, 0), MakeRGBA( 83,123, 49, 0), MakeRGBA( 84,124, 49, 0), MakeRGBA( 84,124, 50, 0),
-	MakeRGBA( 85,125, 50, 0), MakeRGBA( 86,126, 51, 0), MakeRGBA( 87,127, 51, 0), MakeRGBA( 88,128, 51, 0),
-	MakeRGBA( 88,129, 52, 0), MakeRGBA( 89,129, 52, 0), MakeRGBA( 89,130, 53, 0), MakeRGBA( 90,131, 53, 0),
-	MakeRGBA( 91,132, 53, 0), MakeRGBA( 91,133, 54, 0), MakeRGBA( 92,133, 54, 0), MakeRGBA( 92,134, 55, 0),
-	MakeRGBA( 93,135, 55, 0), MakeRGBA( 94,136, 55, 0), MakeRGBA( 94,137, 56, 0), MakeRGBA( 95,137, 56, 0),
-	MakeRGBA( 95,138, 57, 0), MakeRGBA( 96,139, 57, 0), MakeRGBA( 97,140, 57, 0), MakeRGBA( 97,141, 58, 0),
-	MakeRGBA( 98,142, 58, 0), MakeRGBA( 98,142, 59, 0), MakeRGBA( 99,143, 59, 0), MakeRGBA(100,144, 59, 0),
-	MakeRGBA(101,144, 60, 0), MakeRGBA(102,145, 60, 0), MakeRGBA(102,146, 61, 0), MakeRGBA(103,146, 61, 0),
-	MakeRGBA(104,147, 61, 0), MakeRGBA(105,147, 62, 0), MakeRGBA(106,148, 62, 0), MakeRGBA(106,149, 63, 0),
-	MakeRGBA(107,149, 63, 0), MakeRGBA(108,150, 64, 0), MakeRGBA(109,150, 64, 0), MakeRGBA(110,151, 64, 0),
-	MakeRGBA(110,152, 65, 0), MakeRGBA(111,152, 65, 0), MakeRGBA(112,153, 66, 0), MakeRGBA(113,153, 66, 0),
-	MakeRGBA(114,154, 66, 0), MakeRGBA(115,155, 67, 0), MakeRGBA(115,155, 67, 0), MakeRGBA(116,156, 68, 0),
-	MakeRGBA(117,157, 68, 0), MakeRGBA(118,158, 68, 0), MakeRGBA(119,159, 69, 0), MakeRGBA(119,159, 69, 0),
-	MakeRGBA(120,160, 70, 0), MakeRGBA(121,161, 70, 0), MakeRGBA(122,162, 70, 0), MakeRGBA(123,163, 71, 0),
-	MakeRGBA(124,164, 71, 0), MakeRGBA(124,164, 72, 0), MakeRGBA(125,165, 72, 0), MakeRGBA(126,166, 72, 0),
-	MakeRGBA(127,167, 73, 0), MakeRGBA(128,168, 73, 0), MakeRGBA(128,168, 74, 0), MakeRGBA(129,169, 74, 0),
-	MakeRGBA(130,170, 75, 0), MakeRGBA(131,171, 75, 0), MakeRGBA(132,172, 75, 0), MakeRGBA(132,172, 76, 0),
-	MakeRGBA(133,173, 76, 0), MakeRGBA(134,174, 77, 0), MakeRGBA(135,175, 77, 0), MakeRGBA(136,176, 77, 0),
-	MakeRGBA(137,177, 78, 0), MakeRGBA(137,177, 78, 0), MakeRGBA(138,178, 79, 0), MakeRGBA(139,179, 79, 0),
-	MakeRGBA(140,180, 79, 0), MakeRGBA(141,181, 80, 0), MakeRGBA(141,181, 80, 0), MakeRGBA(142,182, 81, 0),
-	MakeRGBA(143,183, 81, 0), MakeRGBA(144,184, 81, 0), MakeRGBA(145,185, 82, 0), MakeRGBA(145,185, 82, 0),
-	MakeRGBA(146,186, 83, 0), MakeRGBA(147,187, 83, 0), MakeRGBA(148,188, 84, 0), MakeRGBA(149,189, 84, 0),
-	MakeRGBA(150,190, 85, 0), MakeRGBA(150,190, 85, 0), MakeRGBA(151,191, 86, 0), MakeRGBA(152,192, 87, 0),
-	MakeRGBA(153,193, 87, 0), MakeRGBA(154,194, 88, 0), MakeRGBA(154,194, 89, 0), MakeRGBA(155,195, 89, 0),
-	MakeRGBA(156,196, 90, 0), MakeRGBA(157,197, 90, 0), MakeRGBA(158,198, 91, 0), MakeRGBA(158,198, 92, 0),
-	MakeRGBA(159,199, 92, 0), MakeRGBA(160,200, 93, 0), MakeRGBA(161,201, 93, 0), MakeRGBA(162,202, 94, 0),
-	MakeRGBA(163,203, 95, 0), MakeRGBA(163,203, 95, 0), MakeRGBA(164,204, 96, 0), MakeRGBA(165,205, 96, 0),
-	MakeRGBA(166,206, 96, 0), MakeRGBA(167,207, 97, 0), MakeRGBA(168,207, 97, 0), MakeRGBA(169,208, 98, 0),
-	MakeRGBA(170,209, 98, 0), MakeRGBA(172,210, 98, 0), MakeRGBA(173,211, 99, 0), MakeRGBA(174,211, 99, 0),
-	MakeRGBA(175,212,100, 0), MakeRGBA(176,213,100, 0), MakeRGBA(177,214,100, 0), MakeRGBA(178,215,101, 0),
-	MakeRGBA(179,215,101, 0), MakeRGBA(180,216,102, 0), MakeRGBA(181,217,102, 0), MakeRGBA(182,218,102, 0),
-	MakeRGBA(183,219,103, 0), MakeRGBA(186,220,108, 0), MakeRGBA(189,222,116, 0), MakeRGBA(193,224,124, 0),
-	MakeRGBA(196,226,131, 0), MakeRGBA(200,228,139, 0), MakeRGBA(204,229,147, 0), MakeRGBA(207,231,155, 0),
-	MakeRGBA(211,233,162, 0), MakeRGBA(215,235,170, 0), MakeRGBA(218,237,178, 0), MakeRGBA(222,239,186, 0),
-	MakeRGBA(226,240,193, 0), MakeRGBA(229,242,201, 0), MakeRGBA(233,244,209, 0), MakeRGBA(237,246,216, 0),
-	MakeRGBA(240,248,224, 0), MakeRGBA(244,250,232, 0), MakeRGBA(248,251,240, 0), MakeRGBA(251,253,247, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_DARK_RED. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  0,  0, 0), MakeRGBA(  4,  0,  0, 0), MakeRGBA(  5,  0,  0, 0),
+		MakeRGBA(  7,  0,  0, 0), MakeRGBA(  9,  0,  0, 0), MakeRGBA( 11,  0,  0, 0), MakeRGBA( 12,  0,  0, 0),
+		MakeRGBA( 14,  0,  0, 0), MakeRGBA( 16,  0,  0, 0), MakeRGBA( 18,  0,  0, 0), MakeRGBA( 20,  0,  0, 0),
+		MakeRGBA( 21,  0,  0, 0), MakeRGBA( 23,  0,  0, 0), MakeRGBA( 25,  0,  0, 0), MakeRGBA( 27,  0,  0, 0),
+		MakeRGBA( 28,  0,  0, 0), MakeRGBA( 30,  0,  0, 0), MakeRGBA( 32,  0,  0, 0), MakeRGBA( 34,  0,  0, 0),
+		MakeRGBA( 36,  0,  0, 0), MakeRGBA( 38,  0,  0, 0), MakeRGBA( 40,  0,  0, 0), MakeRGBA( 42,  0,  0, 0),
+		MakeRGBA( 45,  0,  0, 0), MakeRGBA( 47,  0,  0, 0), MakeRGBA( 49,  0,  0, 0), MakeRGBA( 51,  0,  0, 0),
+		MakeRGBA( 54,  0,  0, 0), MakeRGBA( 56,  0,  0, 0), MakeRGBA( 58,  0,  0, 0), MakeRGBA( 60,  0,  0, 0),
+		MakeRGBA( 63,  0,  0, 0), MakeRGBA( 65,  0,  0, 0), MakeRGBA( 67,  0,  0, 0), MakeRGBA( 69,  0,  0, 0),
+		MakeRGBA( 71,  0,  0, 0), MakeRGBA( 74,  0,  0, 0), MakeRGBA( 76,  0,  0, 0), MakeRGBA( 78,  0,  0, 0),
+		MakeRGBA( 80,  0,  0, 0), MakeRGBA( 80,  1,  1, 0), MakeRGBA( 81,  1,  1, 0), MakeRGBA( 82,  1,  1, 0),
+		MakeRGBA( 83,  2,  2, 0), MakeRGBA( 84,  2,  2, 0), MakeRGBA( 84,  2,  2, 0), MakeRGBA( 85,  3,  3, 0),
+		MakeRGBA( 86,  3,  3, 0), MakeRGBA( 87,  3,  3, 0), MakeRGBA( 88,  4,  4, 0), MakeRGBA( 88,  4,  4, 0),
+		MakeRGBA( 89,  4,  4, 0), MakeRGBA( 90,  5,  5, 0), MakeRGBA( 91,  5,  5, 0), MakeRGBA( 92,  6,  6, 0),
+		MakeRGBA( 93,  6,  6, 0), MakeRGBA( 93,  6,  6, 0), MakeRGBA( 94,  7,  7, 0), MakeRGBA( 95,  7,  7, 0),
+		MakeRGBA( 96,  7,  7, 0), MakeRGBA( 97,  8,  8, 0), MakeRGBA( 97,  8,  8, 0), MakeRGBA( 98,  9,  9, 0),
+		MakeRGBA( 99,  9,  9, 0), MakeRGBA(100,  9,  9, 0), MakeRGBA(101, 10, 10, 0), MakeRGBA(101, 10, 10, 0),
+		MakeRGBA(102, 11, 11, 0), MakeRGBA(103, 11, 11, 0), MakeRGBA(104, 11, 11, 0), MakeRGBA(105, 12, 12, 0),
+		MakeRGBA(106, 12, 12, 0), MakeRGBA(106, 13, 13, 0), MakeRGBA(107, 13, 13, 0), MakeRGBA(108, 13, 13, 0),
+		MakeRGBA(109, 14, 14, 0), MakeRGBA(110, 14, 14, 0), MakeRGBA(110, 15, 15, 0), MakeRGBA(111, 15, 15, 0),
+		MakeRGBA(112, 16, 16, 0), MakeRGBA(113, 16, 16, 0), MakeRGBA(114, 17, 17, 0), MakeRGBA(114, 18, 18, 0),
+		MakeRGBA(115, 18, 18, 0), MakeRGBA(116, 19, 19, 0), MakeRGBA(117, 19, 19, 0), MakeRGBA(118, 20, 20, 0),
+		MakeRGBA(119, 21, 21, 0), MakeRGBA(119, 21, 21, 0), MakeRGBA(120, 22, 22, 0), MakeRGBA(121, 22, 22, 0),
+		MakeRGBA(122, 23, 23, 0), MakeRGBA(123, 24, 24, 0), MakeRGBA(123, 24, 24, 0), MakeRGBA(124, 25, 25, 0),
+		MakeRGBA(125, 25, 25, 0), MakeRGBA(126, 26, 26, 0), MakeRGBA(127, 27, 27, 0), MakeRGBA(127, 27, 27, 0),
+		MakeRGBA(128, 28, 28, 0), MakeRGBA(129, 29, 29, 0), MakeRGBA(130, 29, 29, 0), MakeRGBA(131, 30, 30, 0),
+		MakeRGBA(132, 30, 30, 0), MakeRGBA(132, 31, 31, 0), MakeRGBA(133, 32, 32, 0), MakeRGBA(134, 32, 32, 0),
+		MakeRGBA(135, 33, 33, 0), MakeRGBA(136, 33, 33, 0), MakeRGBA(136, 34, 34, 0), MakeRGBA(137, 35, 35, 0),
+		MakeRGBA(138, 35, 35, 0), MakeRGBA(139, 36, 36, 0), MakeRGBA(140, 36, 36, 0), MakeRGBA(140, 37, 37, 0),
+		MakeRGBA(141, 38, 38, 0), MakeRGBA(142, 38, 38, 0), MakeRGBA(143, 39, 39, 0), MakeRGBA(144, 40, 40, 0),
+		MakeRGBA(145, 41, 41, 0), MakeRGBA(146, 42, 42, 0), MakeRGBA(147, 43, 43, 0), MakeRGBA(148, 44, 44, 0),
+		MakeRGBA(149, 45, 45, 0), MakeRGBA(150, 46, 46, 0), MakeRGBA(151, 47, 47, 0), MakeRGBA(152, 48, 48, 0),
+		MakeRGBA(153, 49, 49, 0), MakeRGBA(154, 50, 50, 0), MakeRGBA(155, 51, 51, 0), MakeRGBA(156, 52, 52, 0),
+		MakeRGBA(157, 53, 53, 0), MakeRGBA(158, 54, 54, 0), MakeRGBA(159, 55, 55, 0), MakeRGBA(160, 56, 56, 0),
+		MakeRGBA(161, 57, 57, 0), MakeRGBA(162, 58, 58, 0), MakeRGBA(163, 59, 59, 0), MakeRGBA(164, 60, 60, 0),
+		MakeRGBA(165, 61, 61, 0), MakeRGBA(166, 62, 62, 0), MakeRGBA(166, 63, 63, 0), MakeRGBA(167, 64, 64, 0),
+		MakeRGBA(168, 65, 65, 0), MakeRGBA(169, 66, 66, 0), MakeRGBA(170, 67, 67, 0), MakeRGBA(170, 68, 68, 0),
+		MakeRGBA(171, 69, 69, 0), MakeRGBA(172, 70, 70, 0), MakeRGBA(173, 71, 71, 0), MakeRGBA(174, 72, 72, 0),
+		MakeRGBA(174, 73, 73, 0), MakeRGBA(175, 74, 74, 0), MakeRGBA(176, 75, 75, 0), MakeRGBA(177, 76, 76, 0),
+		MakeRGBA(178, 77, 77, 0), MakeRGBA(179, 78, 78, 0), MakeRGBA(179, 80, 80, 0), MakeRGBA(180, 81, 81, 0),
+		MakeRGBA(182, 82, 82, 0), MakeRGBA(183, 83, 83, 0), MakeRGBA(184, 84, 84, 0), MakeRGBA(185, 86, 86, 0),
+		MakeRGBA(186, 87, 87, 0), MakeRGBA(187, 88, 88, 0), MakeRGBA(188, 89, 89, 0), MakeRGBA(189, 91, 91, 0),
+		MakeRGBA(190, 92, 92, 0), MakeRGBA(191, 93, 93, 0), MakeRGBA(192, 94, 94, 0), MakeRGBA(193, 95, 95, 0),
+		MakeRGBA(194, 97, 97, 0), MakeRGBA(195, 98, 98, 0), MakeRGBA(196, 99, 99, 0), MakeRGBA(197,100,100, 0),
+		MakeRGBA(198,101,101, 0), MakeRGBA(199,103,103, 0), MakeRGBA(200,104,104, 0), MakeRGBA(200,105,105, 0),
+		MakeRGBA(201,106,106, 0), MakeRGBA(202,108,108, 0), MakeRGBA(203,109,109, 0), MakeRGBA(204,110,110, 0),
+		MakeRGBA(205,111,111, 0), MakeRGBA(205,112,112, 0), MakeRGBA(206,114,114, 0), MakeRGBA(207,115,115, 0),
+		MakeRGBA(208,116,116, 0), MakeRGBA(209,117,117, 0), MakeRGBA(209,119,119, 0), MakeRGBA(210,120,120, 0),
+		MakeRGBA(211,121,121, 0), MakeRGBA(212,122,122, 0), MakeRGBA(213,123,123, 0), MakeRGBA(213,125,125, 0),
+		MakeRGBA(214,126,126, 0), MakeRGBA(215,127,127, 0), MakeRGBA(216,129,129, 0), MakeRGBA(217,130,130, 0),
+		MakeRGBA(218,132,132, 0), MakeRGBA(219,134,134, 0), MakeRGBA(220,135,135, 0), MakeRGBA(221,137,137, 0),
+		MakeRGBA(222,138,138, 0), MakeRGBA(223,140,140, 0), MakeRGBA(224,142,142, 0), MakeRGBA(225,143,143, 0),
+		MakeRGBA(226,145,145, 0), MakeRGBA(227,147,147, 0), MakeRGBA(228,148,148, 0), MakeRGBA(229,150,150, 0),
+		MakeRGBA(230,151,151, 0), MakeRGBA(231,153,153, 0), MakeRGBA(232,155,155, 0), MakeRGBA(233,156,156, 0),
+		MakeRGBA(234,158,158, 0), MakeRGBA(235,160,160, 0), MakeRGBA(236,161,161, 0), MakeRGBA(237,163,163, 0),
+		MakeRGBA(238,164,164, 0), MakeRGBA(239,166,166, 0), MakeRGBA(240,168,168, 0), MakeRGBA(241,169,169, 0),
+		MakeRGBA(242,171,171, 0), MakeRGBA(244,173,173, 0), MakeRGBA(245,174,174, 0), MakeRGBA(246,176,176, 0),
+		MakeRGBA(247,177,177, 0), MakeRGBA(248,179,179, 0), MakeRGBA(249,181,181, 0), MakeRGBA(250,182,182, 0),
+		MakeRGBA(251,184,184, 0), MakeRGBA(252,186,186, 0), MakeRGBA(253,187,187, 0), MakeRGBA(254,189,189, 0),
+		MakeRGBA(255,190,190, 0), MakeRGBA(255,193,193, 0), MakeRGBA(255,196,196, 0), MakeRGBA(255,200,200, 0),
+		MakeRGBA(255,203,203, 0), MakeRGBA(255,206,206, 0), MakeRGBA(255,209,209, 0), MakeRGBA(255,213,213, 0),
+		MakeRGBA(255,216,216, 0), MakeRGBA(255,219,219, 0), MakeRGBA(255,222,222, 0), MakeRGBA(255,226,226, 0),
+		MakeRGBA(255,229,229, 0), MakeRGBA(255,232,232, 0), MakeRGBA(255,235,235, 0), MakeRGBA(255,239,239, 0),
+		MakeRGBA(255,242,242, 0), MakeRGBA(255,245,245, 0), MakeRGBA(255,248,248, 0), MakeRGBA(255,252,252, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_LIGHT_GREEN. */
-static const uint32 _recolour06[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  3,  1, 0), MakeRGBA(  3,  6,  3, 0), MakeRGBA(  5,  8,  4, 0),
-	MakeRGBA(  6, 11,  5, 0), MakeRGBA(  8, 14,  7, 0), MakeRGBA(  9, 17,  8, 0), MakeRGBA( 11, 20, 10, 0),
-	MakeRGBA( 13, 22, 11, 0), MakeRGBA( 14, 25, 12, 0), MakeRGBA( 16, 28, 14, 0), MakeRGBA( 17, 31, 15, 0),
-	MakeRGBA( 19, 34, 16, 0), MakeRGBA( 20, 36, 18, 0), MakeRGBA( 22, 39, 19, 0), MakeRGBA( 24, 42, 21, 0),
-	MakeRGBA( 25, 45, 22, 0), MakeRGBA( 27, 47, 23, 0), MakeRGBA( 28, 50, 25, 0), MakeRGBA( 30, 53, 26, 0),
-	MakeRGBA( 31, 55, 27, 0), MakeRGBA( 32, 56, 28, 0), MakeRGBA( 33, 57, 28, 0), MakeRGBA( 34, 58, 28, 0),
-	MakeRGBA( 35, 59, 29, 0), MakeRGBA( 35, 59, 29, 0), MakeRGBA( 36, 60, 30, 0), MakeRGBA( 37, 61, 30, 0),
-	MakeRGBA( 38, 62, 30, 0), MakeRGBA( 39, 63, 31, 0), MakeRGBA( 39, 63, 31, 0), MakeRGBA( 40, 64, 32, 0),
-	MakeRGBA( 41, 65, 32, 0), MakeRGBA( 42, 66, 32, 0), MakeRGBA( 43, 67, 33, 0), MakeRGBA( 43, 67, 33, 0),
-	MakeRGBA( 44, 68, 34, 0), MakeRGBA( 45, 69, 34, 0), MakeRGBA( 46, 70, 34, 0), MakeRGBA( 47, 71, 35, 0),
-	MakeRGBA( 47, 71, 35, 0), MakeRGBA( 48, 72, 36, 0), MakeRGBA( 49, 73, 36, 0), MakeRGBA( 49, 73, 36, 0),
-	MakeRGBA( 50, 74, 37, 0), MakeRGBA( 50, 74, 37, 0), MakeRGBA( 51, 75, 38, 0), MakeRGBA( 52, 76, 38, 0),
-	MakeRGBA( 52, 76, 39, 0), MakeRGBA( 53, 77, 39, 0), MakeRGBA( 53, 77, 39, 0), MakeRGBA( 54, 78, 40, 0),
-	MakeRGBA( 55, 79, 40, 0), MakeRGBA( 55, 79, 41, 0), MakeRGBA( 56, 80, 41, 0), MakeRGBA( 57, 81, 41, 0),
-	MakeRGBA( 57, 81, 42, 0), MakeRGBA( 58, 82, 42, 0), MakeRGBA( 58, 82, 43, 0), MakeRGBA( 59, 83, 43, 0),
-	MakeRGBA( 60, 84, 44, 0), MakeRGBA( 61, 85, 44, 0), MakeRGBA( 61, 85, 45, 0), MakeRGBA( 62, 86, 45, 0),
-	MakeRGBA( 63, 87, 46, 0), MakeRGBA( 64, 88, 47, 0), MakeRGBA( 65, 89, 47, 0), MakeRGBA( 65, 89, 48, 0),
-	MakeRGBA( 66, 90, 48, 0), MakeRGBA( 67, 91, 49, 0), MakeRGBA( 68, 92, 50, 0), MakeRGBA( 69, 93, 50, 0),
-	MakeRGBA( 70, 94, 51, 0), MakeRGBA( 70, 94, 51, 0), MakeRGBA( 71, 95, 52, 0), MakeRGBA( 72, 96, 53, 0),
-	MakeRGBA( 73, 97, 53, 0), MakeRGBA( 74, 98, 54, 0), MakeRGBA( 74, 98, 55, 0), MakeRGBA( 75, 99, 55, 0),
-	MakeRGBA( 76,100, 56, 0), MakeRGBA( 77,100, 56, 0), MakeRGBA( 78,101, 57, 0), MakeRGBA( 78,102, 58, 0),
-	MakeRGBA( 79,102, 58, 0), MakeRGBA( 80,103, 59, 0), MakeRGBA( 81,103, 59, 0), MakeRGBA( 82,104, 60, 0),
-	MakeRGBA( 83,105, 61, 0), MakeRGBA( 83,105, 61, 0), MakeRGBA( 84,106, 62, 0), MakeRGBA( 85,106, 62, 0),
-	MakeRGBA( 86,107, 63, 0), MakeRGBA( 87,108, 64, 0), MakeRGBA( 87,108, 64, 0), MakeRGBA( 88,109, 65, 0),
-	MakeRGBA( 89,110, 66, 0), MakeRGBA( 90,110, 66, 0), MakeRGBA( 91,111, 67, 0), MakeRGBA( 92,112, 67, 0),
-	MakeRGBA( 93,113, 68, 0), MakeRGBA( 94,114, 69, 0), MakeRGBA( 95,115, 69, 0), MakeRGBA( 96,117, 70, 0),
-	MakeRGBA( 97,118, 70, 0), MakeRGBA( 98,119, 71, 0), MakeRGBA( 99,120, 72, 0), MakeRGBA(100,121, 72, 0),
-	MakeRGBA(101,123, 73, 0), MakeRGBA(102,124, 73, 0), MakeRGBA(103,125, 74, 0), MakeRGBA(104,126, 75, 0),
-	MakeRGBA(105,128, 75, 0), MakeRGBA(106,129, 76, 0), MakeRGBA(107,130, 76, 0), MakeRGBA(108,131, 77, 0),
-	MakeRGBA(109,132, 78, 0), MakeRGBA(110,134, 78, 0), MakeRGBA(111,135, 79, 0), MakeRGBA(112,136, 80, 0),
-	MakeRGBA(113,137, 81, 0), MakeRGBA(114,138, 81, 0), MakeRGBA(116,140, 82, 0), MakeRGBA(117,141, 83, 0),
-	MakeRGBA(118,142, 84, 0), MakeRGBA(119,143, 85, 0), MakeRGBA(121,145, 85, 0), MakeRGBA(122,146, 86, 0),
-	MakeRGBA(123,147, 87, 0), MakeRGBA(124,148, 88, 0), MakeRGBA(125,149, 89, 0), MakeRGBA(127,151, 89, 0),
-	MakeRGBA(128,152, 90, 0), MakeRGBA(129,153, 91, 0), MakeRGBA(130,154, 92, 0), MakeRGBA(132,156, 93, 0),
-	MakeRGBA(133,157, 94, 0), MakeRGBA(134,158, 94, 0), MakeRGBA(135,159, 95, 0), MakeRGBA(136,160, 96, 0),
-	MakeRGBA(138,162, 97, 0), MakeRGBA(139,163, 98, 0), MakeRGBA(140,164, 98, 0), MakeRGBA(141,165, 99, 0),
-	MakeRGBA(142,166,100, 0), MakeRGBA(144,168,101, 0), MakeRGBA(145,169,102, 0), MakeRGBA(146,170,102, 0),
-	MakeRGBA(147,171,103, 0), MakeRGBA(149,173,104, 0), MakeRGBA(150,174,105, 0), MakeRGBA(151,175,106, 0),
-	MakeRGBA(152,176,106, 0), MakeRGBA(153,177,107, 0), MakeRGBA(155,179,108, 0), MakeRGBA(156,180,109, 0),
-	MakeRGBA(157,181,110, 0), MakeRGBA(158,182,111, 0), MakeRGBA(160,184,111, 0), MakeRGBA(161,185,112, 0),
-	MakeRGBA(162,186,113, 0), MakeRGBA(163,187,114, 0), MakeRGBA(164,188,115, 0), MakeRGBA(166,190,115, 0),
-	MakeRGBA(167,191,116, 0), MakeRGBA(168,192,117, 0), MakeRGBA(169,193,118, 0), MakeRGBA(171,195,119, 0),
-	MakeRGBA(172,196,120, 0), MakeRGBA(173,197,120, 0), MakeRGBA(174,198,121, 0), MakeRGBA(175,199,122, 0),
-	MakeRGBA(177,201,123, 0), MakeRGBA(178,202,124, 0), MakeRGBA(179,203,124, 0), MakeRGBA(180,204,125, 0),
-	MakeRGBA(182,206,126, 0), MakeRGBA(183,207,127, 0), MakeRGBA(183,207,128, 0), MakeRGBA(184,208,129, 0),
-	MakeRGBA(185,209,130, 0), MakeRGBA(185,209,131, 0), MakeRGBA(186,210,132, 0), MakeRGBA(187,211,133, 0),
-	MakeRGBA(187,211,134, 0), MakeRGBA(188,212,135, 0), MakeRGBA(188,212,136, 0), MakeRGBA(189,213,137, 0),
-	MakeRGBA(190,214,138, 0), MakeRGBA(190,214,139, 0), MakeRGBA(191,215,140, 0), MakeRGBA(191,215,141, 0),
-	MakeRGBA(192,216,142, 0), MakeRGBA(193,217,143, 0), MakeRGBA(193,217,144, 0), MakeRGBA(194,218,145, 0),
-	MakeRGBA(194,218,146, 0), MakeRGBA(195,219,147, 0), MakeRGBA(196,220,148, 0), MakeRGBA(196,220,149, 0),
-	MakeRGBA(197,221,150, 0), MakeRGBA(197,221,151, 0), MakeRGBA(198,222,152, 0), MakeRGBA(199,223,153, 0),
-	MakeRGBA(199,223,154, 0), MakeRGBA(200,224,155, 0), MakeRGBA(201,225,156, 0), MakeRGBA(201,225,157, 0),
-	MakeRGBA(202,226,158, 0), MakeRGBA(202,226,159, 0), MakeRGBA(203,227,160, 0), MakeRGBA(204,228,161, 0),
-	MakeRGBA(204,228,162, 0), MakeRGBA(205,229,163, 0), MakeRGBA(205,229,164, 0), MakeRGBA(206,230,165, 0),
-	MakeRGBA(207,231,166, 0), MakeRGBA(207,231,167, 0), MakeRGBA(208,232,169, 0), MakeRGBA(209,233,170, 0),
-	MakeRGBA(210,234,171, 0), MakeRGBA(211,235,172, 0), MakeRGBA(211,235,174, 0), MakeRGBA(212,236,175, 0),
-	MakeRGBA(213,237,176, 0), MakeRGBA(214,238,177, 0), MakeRGBA(215,239,178, 0), MakeRGBA(215,239,180, 0),
-	MakeRGBA(216,240,181, 0), MakeRGBA(217,241,182, 0), MakeRGBA(218,242,183, 0), MakeRGBA(219,243,185, 0),
-	MakeRGBA(219,243,186, 0), MakeRGBA(220,244,187, 0), MakeRGBA(221,245,188, 0), MakeRGBA(222,246,189, 0),
-	MakeRGBA(223,247,191, 0), MakeRGBA(224,247,193, 0), MakeRGBA(226,248,196, 0), MakeRGBA(227,248,200, 0),
-	MakeRGBA(229,249,203, 0), MakeRGBA(231,249,206, 0), MakeRGBA(232,249,209, 0), MakeRGBA(234,250,213, 0),
-	MakeRGBA(235,250,216, 0), MakeRGBA(237,251,219, 0), MakeRGBA(239,251,222, 0), MakeRGBA(240,251,226, 0),
-	MakeRGBA(242,252,229, 0), MakeRGBA(244,252,232, 0), MakeRGBA(245,253,235, 0), MakeRGBA(247,253,239, 0),
-	MakeRGBA(248,253,242, 0), MakeRGBA(250,254,245, 0), MakeRGBA(252,254,248, 0), MakeRGBA(253,255,252, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_DARK_GREEN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  3,  1, 0), MakeRGBA(  3,  5,  2, 0), MakeRGBA(  4,  8,  3, 0),
+		MakeRGBA(  5, 10,  4, 0), MakeRGBA(  7, 13,  5, 0), MakeRGBA(  8, 16,  6, 0), MakeRGBA( 10, 18,  7, 0),
+		MakeRGBA( 11, 21,  8, 0), MakeRGBA( 12, 23,  9, 0), MakeRGBA( 14, 26, 10, 0), MakeRGBA( 15, 28, 11, 0),
+		MakeRGBA( 16, 31, 12, 0), MakeRGBA( 18, 34, 13, 0), MakeRGBA( 19, 36, 14, 0), MakeRGBA( 21, 39, 14, 0),
+		MakeRGBA( 22, 41, 15, 0), MakeRGBA( 23, 44, 16, 0), MakeRGBA( 25, 47, 17, 0), MakeRGBA( 26, 49, 18, 0),
+		MakeRGBA( 27, 51, 19, 0), MakeRGBA( 28, 52, 19, 0), MakeRGBA( 28, 52, 19, 0), MakeRGBA( 28, 53, 20, 0),
+		MakeRGBA( 29, 54, 20, 0), MakeRGBA( 29, 54, 20, 0), MakeRGBA( 30, 55, 20, 0), MakeRGBA( 30, 55, 20, 0),
+		MakeRGBA( 30, 56, 21, 0), MakeRGBA( 31, 57, 21, 0), MakeRGBA( 31, 57, 21, 0), MakeRGBA( 32, 58, 21, 0),
+		MakeRGBA( 32, 59, 22, 0), MakeRGBA( 32, 59, 22, 0), MakeRGBA( 33, 60, 22, 0), MakeRGBA( 33, 60, 22, 0),
+		MakeRGBA( 34, 61, 22, 0), MakeRGBA( 34, 62, 23, 0), MakeRGBA( 34, 62, 23, 0), MakeRGBA( 35, 63, 23, 0),
+		MakeRGBA( 35, 64, 23, 0), MakeRGBA( 36, 64, 24, 0), MakeRGBA( 37, 65, 24, 0), MakeRGBA( 37, 66, 24, 0),
+		MakeRGBA( 38, 67, 25, 0), MakeRGBA( 38, 68, 25, 0), MakeRGBA( 39, 68, 26, 0), MakeRGBA( 40, 69, 26, 0),
+		MakeRGBA( 40, 70, 27, 0), MakeRGBA( 41, 71, 27, 0), MakeRGBA( 41, 72, 27, 0), MakeRGBA( 42, 72, 28, 0),
+		MakeRGBA( 43, 73, 28, 0), MakeRGBA( 43, 74, 29, 0), MakeRGBA( 44, 75, 29, 0), MakeRGBA( 45, 76, 29, 0),
+		MakeRGBA( 45, 77, 30, 0), MakeRGBA( 46, 77, 30, 0), MakeRGBA( 46, 78, 31, 0), MakeRGBA( 47, 79, 31, 0),
+		MakeRGBA( 48, 80, 31, 0), MakeRGBA( 48, 81, 32, 0), MakeRGBA( 49, 81, 32, 0), MakeRGBA( 49, 82, 33, 0),
+		MakeRGBA( 50, 83, 33, 0), MakeRGBA( 51, 84, 33, 0), MakeRGBA( 51, 85, 34, 0), MakeRGBA( 52, 85, 34, 0),
+		MakeRGBA( 52, 86, 35, 0), MakeRGBA( 53, 87, 35, 0), MakeRGBA( 54, 88, 35, 0), MakeRGBA( 54, 89, 36, 0),
+		MakeRGBA( 55, 90, 36, 0), MakeRGBA( 55, 90, 37, 0), MakeRGBA( 56, 91, 37, 0), MakeRGBA( 57, 92, 37, 0),
+		MakeRGBA( 57, 93, 38, 0), MakeRGBA( 58, 94, 38, 0), MakeRGBA( 59, 94, 39, 0), MakeRGBA( 59, 95, 39, 0),
+		MakeRGBA( 60, 96, 39, 0), MakeRGBA( 60, 97, 39, 0), MakeRGBA( 61, 98, 40, 0), MakeRGBA( 62, 98, 40, 0),
+		MakeRGBA( 62, 99, 40, 0), MakeRGBA( 63,100, 40, 0), MakeRGBA( 63,101, 40, 0), MakeRGBA( 64,102, 41, 0),
+		MakeRGBA( 65,103, 41, 0), MakeRGBA( 65,103, 41, 0), MakeRGBA( 66,104, 41, 0), MakeRGBA( 66,105, 41, 0),
+		MakeRGBA( 67,106, 42, 0), MakeRGBA( 68,107, 42, 0), MakeRGBA( 68,107, 42, 0), MakeRGBA( 69,108, 42, 0),
+		MakeRGBA( 70,109, 43, 0), MakeRGBA( 70,110, 43, 0), MakeRGBA( 71,111, 43, 0), MakeRGBA( 71,111, 43, 0),
+		MakeRGBA( 72,112, 44, 0), MakeRGBA( 73,113, 44, 0), MakeRGBA( 74,114, 44, 0), MakeRGBA( 75,115, 45, 0),
+		MakeRGBA( 76,116, 45, 0), MakeRGBA( 76,116, 46, 0), MakeRGBA( 77,117, 46, 0), MakeRGBA( 78,118, 46, 0),
+		MakeRGBA( 79,119, 47, 0), MakeRGBA( 80,120, 47, 0), MakeRGBA( 80,120, 48, 0), MakeRGBA( 81,121, 48, 0),
+		MakeRGBA( 82,122, 49, 0), MakeRGBA( 83,123, 49, 0), MakeRGBA( 84,124, 49, 0), MakeRGBA( 84,124, 50, 0),
+		MakeRGBA( 85,125, 50, 0), MakeRGBA( 86,126, 51, 0), MakeRGBA( 87,127, 51, 0), MakeRGBA( 88,128, 51, 0),
+		MakeRGBA( 88,129, 52, 0), MakeRGBA( 89,129, 52, 0), MakeRGBA( 89,130, 53, 0), MakeRGBA( 90,131, 53, 0),
+		MakeRGBA( 91,132, 53, 0), MakeRGBA( 91,133, 54, 0), MakeRGBA( 92,133, 54, 0), MakeRGBA( 92,134, 55, 0),
+		MakeRGBA( 93,135, 55, 0), MakeRGBA( 94,136, 55, 0), MakeRGBA( 94,137, 56, 0), MakeRGBA( 95,137, 56, 0),
+		MakeRGBA( 95,138, 57, 0), MakeRGBA( 96,139, 57, 0), MakeRGBA( 97,140, 57, 0), MakeRGBA( 97,141, 58, 0),
+		MakeRGBA( 98,142, 58, 0), MakeRGBA( 98,142, 59, 0), MakeRGBA( 99,143, 59, 0), MakeRGBA(100,144, 59, 0),
+		MakeRGBA(101,144, 60, 0), MakeRGBA(102,145, 60, 0), MakeRGBA(102,146, 61, 0), MakeRGBA(103,146, 61, 0),
+		MakeRGBA(104,147, 61, 0), MakeRGBA(105,147, 62, 0), MakeRGBA(106,148, 62, 0), MakeRGBA(106,149, 63, 0),
+		MakeRGBA(107,149, 63, 0), MakeRGBA(108,150, 64, 0), MakeRGBA(109,150, 64, 0), MakeRGBA(110,151, 64, 0),
+		MakeRGBA(110,152, 65, 0), MakeRGBA(111,152, 65, 0), MakeRGBA(112,153, 66, 0), MakeRGBA(113,153, 66, 0),
+		MakeRGBA(114,154, 66, 0), MakeRGBA(115,155, 67, 0), MakeRGBA(115,155, 67, 0), MakeRGBA(116,156, 68, 0),
+		MakeRGBA(117,157, 68, 0), MakeRGBA(118,158, 68, 0), MakeRGBA(119,159, 69, 0), MakeRGBA(119,159, 69, 0),
+		MakeRGBA(120,160, 70, 0), MakeRGBA(121,161, 70, 0), MakeRGBA(122,162, 70, 0), MakeRGBA(123,163, 71, 0),
+		MakeRGBA(124,164, 71, 0), MakeRGBA(124,164, 72, 0), MakeRGBA(125,165, 72, 0), MakeRGBA(126,166, 72, 0),
+		MakeRGBA(127,167, 73, 0), MakeRGBA(128,168, 73, 0), MakeRGBA(128,168, 74, 0), MakeRGBA(129,169, 74, 0),
+		MakeRGBA(130,170, 75, 0), MakeRGBA(131,171, 75, 0), MakeRGBA(132,172, 75, 0), MakeRGBA(132,172, 76, 0),
+		MakeRGBA(133,173, 76, 0), MakeRGBA(134,174, 77, 0), MakeRGBA(135,175, 77, 0), MakeRGBA(136,176, 77, 0),
+		MakeRGBA(137,177, 78, 0), MakeRGBA(137,177, 78, 0), MakeRGBA(138,178, 79, 0), MakeRGBA(139,179, 79, 0),
+		MakeRGBA(140,180, 79, 0), MakeRGBA(141,181, 80, 0), MakeRGBA(141,181, 80, 0), MakeRGBA(142,182, 81, 0),
+		MakeRGBA(143,183, 81, 0), MakeRGBA(144,184, 81, 0), MakeRGBA(145,185, 82, 0), MakeRGBA(145,185, 82, 0),
+		MakeRGBA(146,186, 83, 0), MakeRGBA(147,187, 83, 0), MakeRGBA(148,188, 84, 0), MakeRGBA(149,189, 84, 0),
+		MakeRGBA(150,190, 85, 0), MakeRGBA(150,190, 85, 0), MakeRGBA(151,191, 86, 0), MakeRGBA(152,192, 87, 0),
+		MakeRGBA(153,193, 87, 0), MakeRGBA(154,194, 88, 0), MakeRGBA(154,194, 89, 0), MakeRGBA(155,195, 89, 0),
+		MakeRGBA(156,196, 90, 0), MakeRGBA(157,197, 90, 0), MakeRGBA(158,198, 91, 0), MakeRGBA(158,198, 92, 0),
+		MakeRGBA(159,199, 92, 0), MakeRGBA(160,200, 93, 0), MakeRGBA(161,201, 93, 0), MakeRGBA(162,202, 94, 0),
+		MakeRGBA(163,203, 95, 0), MakeRGBA(163,203, 95, 0), MakeRGBA(164,204, 96, 0), MakeRGBA(165,205, 96, 0),
+		MakeRGBA(166,206, 96, 0), MakeRGBA(167,207, 97, 0), MakeRGBA(168,207, 97, 0), MakeRGBA(169,208, 98, 0),
+		MakeRGBA(170,209, 98, 0), MakeRGBA(172,210, 98, 0), MakeRGBA(173,211, 99, 0), MakeRGBA(174,211, 99, 0),
+		MakeRGBA(175,212,100, 0), MakeRGBA(176,213,100, 0), MakeRGBA(177,214,100, 0), MakeRGBA(178,215,101, 0),
+		MakeRGBA(179,215,101, 0), MakeRGBA(180,216,102, 0), MakeRGBA(181,217,102, 0), MakeRGBA(182,218,102, 0),
+		MakeRGBA(183,219,103, 0), MakeRGBA(186,220,108, 0), MakeRGBA(189,222,116, 0), MakeRGBA(193,224,124, 0),
+		MakeRGBA(196,226,131, 0), MakeRGBA(200,228,139, 0), MakeRGBA(204,229,147, 0), MakeRGBA(207,231,155, 0),
+		MakeRGBA(211,233,162, 0), MakeRGBA(215,235,170, 0), MakeRGBA(218,237,178, 0), MakeRGBA(222,239,186, 0),
+		MakeRGBA(226,240,193, 0), MakeRGBA(229,242,201, 0), MakeRGBA(233,244,209, 0), MakeRGBA(237,246,216, 0),
+		MakeRGBA(240,248,224, 0), MakeRGBA(244,250,232, 0), MakeRGBA(248,251,240, 0), MakeRGBA(251,253,247, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_GREEN. */
-static const uint32 _recolour07[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  3,  0, 0), MakeRGBA(  2,  6,  0, 0), MakeRGBA(  2, 10,  0, 0),
-	MakeRGBA(  3, 13,  0, 0), MakeRGBA(  4, 16,  0, 0), MakeRGBA(  5, 19,  0, 0), MakeRGBA(  5, 22,  0, 0),
-	MakeRGBA(  6, 26,  0, 0), MakeRGBA(  7, 29,  0, 0), MakeRGBA(  8, 32,  0, 0), MakeRGBA(  8, 35,  0, 0),
-	MakeRGBA(  9, 38,  0, 0), MakeRGBA( 10, 42,  0, 0), MakeRGBA( 11, 45,  0, 0), MakeRGBA( 11, 48,  0, 0),
-	MakeRGBA( 12, 51,  0, 0), MakeRGBA( 13, 54,  0, 0), MakeRGBA( 14, 58,  0, 0), MakeRGBA( 14, 61,  0, 0),
-	MakeRGBA( 15, 63,  0, 0), MakeRGBA( 15, 64,  0, 0), MakeRGBA( 15, 65,  0, 0), MakeRGBA( 16, 66,  0, 0),
-	MakeRGBA( 16, 67,  0, 0), MakeRGBA( 16, 68,  0, 0), MakeRGBA( 16, 69,  0, 0), MakeRGBA( 16, 70,  0, 0),
-	MakeRGBA( 17, 71,  0, 0), MakeRGBA( 17, 72,  0, 0), MakeRGBA( 17, 73,  0, 0), MakeRGBA( 17, 74,  0, 0),
-	MakeRGBA( 18, 76,  0, 0), MakeRGBA( 18, 77,  0, 0), MakeRGBA( 18, 78,  0, 0), MakeRGBA( 18, 79,  0, 0),
-	MakeRGBA( 18, 80,  0, 0), MakeRGBA( 19, 81,  0, 0), MakeRGBA( 19, 82,  0, 0), MakeRGBA( 19, 83,  0, 0),
-	MakeRGBA( 19, 84,  0, 0), MakeRGBA( 19, 85,  0, 0), MakeRGBA( 20, 86,  0, 0), MakeRGBA( 20, 87,  0, 0),
-	MakeRGBA( 20, 88,  0, 0), MakeRGBA( 20, 89,  0, 0), MakeRGBA( 20, 90,  0, 0), MakeRGBA( 21, 91,  0, 0),
-	MakeRGBA( 21, 92,  0, 0), MakeRGBA( 21, 93,  0, 0), MakeRGBA( 21, 94,  0, 0), MakeRGBA( 21, 95,  0, 0),
-	MakeRGBA( 22, 96,  0, 0), MakeRGBA( 22, 97,  0, 0), MakeRGBA( 22, 98,  0, 0), MakeRGBA( 22, 99,  0, 0),
-	MakeRGBA( 22,100,  0, 0), MakeRGBA( 23,101,  0, 0), MakeRGBA( 23,102,  0, 0), MakeRGBA( 23,103,  0, 0),
-	MakeRGBA( 23,104,  0, 0), MakeRGBA( 24,105,  0, 0), MakeRGBA( 24,106,  0, 0), MakeRGBA( 25,107,  0, 0),
-	MakeRGBA( 25,108,  0, 0), MakeRGBA( 25,109,  0, 0), MakeRGBA( 26,110,  0, 0), MakeRGBA( 26,111,  0, 0),
-	MakeRGBA( 27,112,  0, 0), MakeRGBA( 27,113,  0, 0), MakeRGBA( 27,114,  0, 0), MakeRGBA( 28,115,  0, 0),
-	MakeRGBA( 28,116,  0, 0), MakeRGBA( 29,117,  0, 0), MakeRGBA( 29,118,  0, 0), MakeRGBA( 29,119,  0, 0),
-	MakeRGBA( 30,120,  0, 0), MakeRGBA( 30,121,  0, 0), MakeRGBA( 31,122,  0, 0), MakeRGBA( 31,123,  0, 0),
-	MakeRGBA( 32,124,  0, 0), MakeRGBA( 32,125,  1, 0), MakeRGBA( 32,126,  1, 0), MakeRGBA( 33,127,  2, 0),
-	MakeRGBA( 33,128,  2, 0), MakeRGBA( 34,129,  2, 0), MakeRGBA( 34,130,  3, 0), MakeRGBA( 34,131,  3, 0),
-	MakeRGBA( 35,132,  3, 0), MakeRGBA( 35,133,  4, 0), MakeRGBA( 36,134,  4, 0), MakeRGBA( 36,135,  4, 0),
-	MakeRGBA( 36,136,  5, 0), MakeRGBA( 37,137,  5, 0), MakeRGBA( 37,138,  5, 0), MakeRGBA( 38,139,  6, 0),
-	MakeRGBA( 38,141,  6, 0), MakeRGBA( 38,142,  6, 0), MakeRGBA( 39,143,  7, 0), MakeRGBA( 39,143,  7, 0),
-	MakeRGBA( 40,144,  8, 0), MakeRGBA( 41,145,  9, 0), MakeRGBA( 42,146, 10, 0), MakeRGBA( 43,147, 11, 0),
-	MakeRGBA( 43,148, 11, 0), MakeRGBA( 44,148, 12, 0), MakeRGBA( 45,149, 13, 0), MakeRGBA( 46,150, 14, 0),
-	MakeRGBA( 47,151, 15, 0), MakeRGBA( 48,152, 16, 0), MakeRGBA( 48,152, 16, 0), MakeRGBA( 49,153, 17, 0),
-	MakeRGBA( 50,154, 18, 0), MakeRGBA( 51,155, 19, 0), MakeRGBA( 52,156, 20, 0), MakeRGBA( 52,156, 20, 0),
-	MakeRGBA( 53,157, 21, 0), MakeRGBA( 54,158, 22, 0), MakeRGBA( 55,159, 23, 0), MakeRGBA( 56,160, 24, 0),
-	MakeRGBA( 56,161, 24, 0), MakeRGBA( 57,161, 25, 0), MakeRGBA( 58,162, 26, 0), MakeRGBA( 59,163, 27, 0),
-	MakeRGBA( 60,164, 28, 0), MakeRGBA( 61,165, 29, 0), MakeRGBA( 61,165, 29, 0), MakeRGBA( 62,166, 30, 0),
-	MakeRGBA( 63,167, 31, 0), MakeRGBA( 64,168, 32, 0), MakeRGBA( 65,169, 33, 0), MakeRGBA( 65,169, 33, 0),
-	MakeRGBA( 66,170, 34, 0), MakeRGBA( 67,171, 35, 0), MakeRGBA( 68,172, 36, 0), MakeRGBA( 69,173, 37, 0),
-	MakeRGBA( 70,174, 37, 0), MakeRGBA( 70,174, 38, 0), MakeRGBA( 71,175, 39, 0), MakeRGBA( 72,176, 40, 0),
-	MakeRGBA( 73,177, 42, 0), MakeRGBA( 74,178, 43, 0), MakeRGBA( 75,178, 44, 0), MakeRGBA( 76,179, 45, 0),
-	MakeRGBA( 77,180, 46, 0), MakeRGBA( 78,181, 48, 0), MakeRGBA( 79,182, 49, 0), MakeRGBA( 80,182, 50, 0),
-	MakeRGBA( 81,183, 51, 0), MakeRGBA( 82,184, 53, 0), MakeRGBA( 83,185, 54, 0), MakeRGBA( 84,186, 55, 0),
-	MakeRGBA( 85,186, 56, 0), MakeRGBA( 86,187, 57, 0), MakeRGBA( 87,188, 59, 0), MakeRGBA( 88,189, 60, 0),
-	MakeRGBA( 89,190, 61, 0), MakeRGBA( 90,191, 62, 0), MakeRGBA( 91,191, 64, 0), MakeRGBA( 92,192, 65, 0),
-	MakeRGBA( 93,193, 66, 0), MakeRGBA( 95,194, 67, 0), MakeRGBA( 96,195, 68, 0), MakeRGBA( 97,195, 70, 0),
-	MakeRGBA( 98,196, 71, 0), MakeRGBA( 99,197, 72, 0), MakeRGBA(100,198, 73, 0), MakeRGBA(101,199, 75, 0),
-	MakeRGBA(102,200, 76, 0), MakeRGBA(103,200, 77, 0), MakeRGBA(104,201, 78, 0), MakeRGBA(105,202, 79, 0),
-	MakeRGBA(106,203, 81, 0), MakeRGBA(107,204, 82, 0), MakeRGBA(108,204, 83, 0), MakeRGBA(109,205, 84, 0),
-	MakeRGBA(110,206, 85, 0), MakeRGBA(111,207, 87, 0), MakeRGBA(112,208, 88, 0), MakeRGBA(114,208, 90, 0),
-	MakeRGBA(115,209, 91, 0), MakeRGBA(116,210, 92, 0), MakeRGBA(118,211, 94, 0), MakeRGBA(119,212, 95, 0),
-	MakeRGBA(121,213, 97, 0), MakeRGBA(122,213, 98, 0), MakeRGBA(123,214, 99, 0), MakeRGBA(125,215,101, 0),
-	MakeRGBA(126,216,102, 0), MakeRGBA(128,217,104, 0), MakeRGBA(129,217,105, 0), MakeRGBA(131,218,107, 0),
-	MakeRGBA(132,219,108, 0), MakeRGBA(133,220,109, 0), MakeRGBA(135,221,111, 0), MakeRGBA(136,221,112, 0),
-	MakeRGBA(138,222,114, 0), MakeRGBA(139,223,115, 0), MakeRGBA(140,224,117, 0), MakeRGBA(142,225,118, 0),
-	MakeRGBA(143,226,119, 0), MakeRGBA(144,226,121, 0), MakeRGBA(145,227,122, 0), MakeRGBA(146,228,124, 0),
-	MakeRGBA(148,229,125, 0), MakeRGBA(149,230,126, 0), MakeRGBA(150,230,128, 0), MakeRGBA(151,231,129, 0),
-	MakeRGBA(153,232,131, 0), MakeRGBA(154,233,132, 0), MakeRGBA(155,234,134, 0), MakeRGBA(156,234,135, 0),
-	MakeRGBA(157,235,136, 0), MakeRGBA(159,236,138, 0), MakeRGBA(160,237,139, 0), MakeRGBA(161,238,141, 0),
-	MakeRGBA(162,239,142, 0), MakeRGBA(164,239,144, 0), MakeRGBA(165,240,146, 0), MakeRGBA(167,241,147, 0),
-	MakeRGBA(168,242,149, 0), MakeRGBA(170,243,151, 0), MakeRGBA(172,243,153, 0), MakeRGBA(173,244,155, 0),
-	MakeRGBA(175,245,156, 0), MakeRGBA(177,246,158, 0), MakeRGBA(178,247,160, 0), MakeRGBA(180,247,162, 0),
-	MakeRGBA(181,248,164, 0), MakeRGBA(183,249,166, 0), MakeRGBA(185,250,167, 0), MakeRGBA(186,251,169, 0),
-	MakeRGBA(188,251,171, 0), MakeRGBA(190,252,173, 0), MakeRGBA(191,253,175, 0), MakeRGBA(193,254,177, 0),
-	MakeRGBA(194,255,178, 0), MakeRGBA(197,255,182, 0), MakeRGBA(200,255,186, 0), MakeRGBA(203,255,189, 0),
-	MakeRGBA(206,255,193, 0), MakeRGBA(209,255,197, 0), MakeRGBA(212,255,201, 0), MakeRGBA(215,255,205, 0),
-	MakeRGBA(218,255,209, 0), MakeRGBA(221,255,213, 0), MakeRGBA(225,255,216, 0), MakeRGBA(228,255,220, 0),
-	MakeRGBA(231,255,224, 0), MakeRGBA(234,255,228, 0), MakeRGBA(237,255,232, 0), MakeRGBA(240,255,236, 0),
-	MakeRGBA(243,255,240, 0), MakeRGBA(246,255,243, 0), MakeRGBA(249,255,247, 0), MakeRGBA(252,255,251, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_LIGHT_GREEN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  3,  1, 0), MakeRGBA(  3,  6,  3, 0), MakeRGBA(  5,  8,  4, 0),
+		MakeRGBA(  6, 11,  5, 0), MakeRGBA(  8, 14,  7, 0), MakeRGBA(  9, 17,  8, 0), MakeRGBA( 11, 20, 10, 0),
+		MakeRGBA( 13, 22, 11, 0), MakeRGBA( 14, 25, 12, 0), MakeRGBA( 16, 28, 14, 0), MakeRGBA( 17, 31, 15, 0),
+		MakeRGBA( 19, 34, 16, 0), MakeRGBA( 20, 36, 18, 0), MakeRGBA( 22, 39, 19, 0), MakeRGBA( 24, 42, 21, 0),
+		MakeRGBA( 25, 45, 22, 0), MakeRGBA( 27, 47, 23, 0), MakeRGBA( 28, 50, 25, 0), MakeRGBA( 30, 53, 26, 0),
+		MakeRGBA( 31, 55, 27, 0), MakeRGBA( 32, 56, 28, 0), MakeRGBA( 33, 57, 28, 0), MakeRGBA( 34, 58, 28, 0),
+		MakeRGBA( 35, 59, 29, 0), MakeRGBA( 35, 59, 29, 0), MakeRGBA( 36, 60, 30, 0), MakeRGBA( 37, 61, 30, 0),
+		MakeRGBA( 38, 62, 30, 0), MakeRGBA( 39, 63, 31, 0), MakeRGBA( 39, 63, 31, 0), MakeRGBA( 40, 64, 32, 0),
+		MakeRGBA( 41, 65, 32, 0), MakeRGBA( 42, 66, 32, 0), MakeRGBA( 43, 67, 33, 0), MakeRGBA( 43, 67, 33, 0),
+		MakeRGBA( 44, 68, 34, 0), MakeRGBA( 45, 69, 34, 0), MakeRGBA( 46, 70, 34, 0), MakeRGBA( 47, 71, 35, 0),
+		MakeRGBA( 47, 71, 35, 0), MakeRGBA( 48, 72, 36, 0), MakeRGBA( 49, 73, 36, 0), MakeRGBA( 49, 73, 36, 0),
+		MakeRGBA( 50, 74, 37, 0), MakeRGBA( 50, 74, 37, 0), MakeRGBA( 51, 75, 38, 0), MakeRGBA( 52, 76, 38, 0),
+		MakeRGBA( 52, 76, 39, 0), MakeRGBA( 53, 77, 39, 0), MakeRGBA( 53, 77, 39, 0), MakeRGBA( 54, 78, 40, 0),
+		MakeRGBA( 55, 79, 40, 0), MakeRGBA( 55, 79, 41, 0), MakeRGBA( 56, 80, 41, 0), MakeRGBA( 57, 81, 41, 0),
+		MakeRGBA( 57, 81, 42, 0), MakeRGBA( 58, 82, 42, 0), MakeRGBA( 58, 82, 43, 0), MakeRGBA( 59, 83, 43, 0),
+		MakeRGBA( 60, 84, 44, 0), MakeRGBA( 61, 85, 44, 0), MakeRGBA( 61, 85, 45, 0), MakeRGBA( 62, 86, 45, 0),
+		MakeRGBA( 63, 87, 46, 0), MakeRGBA( 64, 88, 47, 0), MakeRGBA( 65, 89, 47, 0), MakeRGBA( 65, 89, 48, 0),
+		MakeRGBA( 66, 90, 48, 0), MakeRGBA( 67, 91, 49, 0), MakeRGBA( 68, 92, 50, 0), MakeRGBA( 69, 93, 50, 0),
+		MakeRGBA( 70, 94, 51, 0), MakeRGBA( 70, 94, 51, 0), MakeRGBA( 71, 95, 52, 0), MakeRGBA( 72, 96, 53, 0),
+		MakeRGBA( 73, 97, 53, 0), MakeRGBA( 74, 98, 54, 0), MakeRGBA( 74, 98, 55, 0), MakeRGBA( 75, 99, 55, 0),
+		MakeRGBA( 76,100, 56, 0), MakeRGBA( 77,100, 56, 0), MakeRGBA( 78,101, 57, 0), MakeRGBA( 78,102, 58, 0),
+		MakeRGBA( 79,102, 58, 0), MakeRGBA( 80,103, 59, 0), MakeRGBA( 81,103, 59, 0), MakeRGBA( 82,104, 60, 0),
+		MakeRGBA( 83,105, 61, 0), MakeRGBA( 83,105, 61, 0), MakeRGBA( 84,106, 62, 0), MakeRGBA( 85,106, 62, 0),
+		MakeRGBA( 86,107, 63, 0), MakeRGBA( 87,108, 64, 0), MakeRGBA( 87,108, 64, 0), MakeRGBA( 88,109, 65, 0),
+		MakeRGBA( 89,110, 66, 0), MakeRGBA( 90,110, 66, 0), MakeRGBA( 91,111, 67, 0), MakeRGBA( 92,112, 67, 0),
+		MakeRGBA( 93,113, 68, 0), MakeRGBA( 94,114, 69, 0), MakeRGBA( 95,115, 69, 0), MakeRGBA( 96,117, 70, 0),
+		MakeRGBA( 97,118, 70, 0), MakeRGBA( 98,119, 71, 0), MakeRGBA( 99,120, 72, 0), MakeRGBA(100,121, 72, 0),
+		MakeRGBA(101,123, 73, 0), MakeRGBA(102,124, 73, 0), MakeRGBA(103,125, 74, 0), MakeRGBA(104,126, 75, 0),
+		MakeRGBA(105,128, 75, 0), MakeRGBA(106,129, 76, 0), MakeRGBA(107,130, 76, 0), MakeRGBA(108,131, 77, 0),
+		MakeRGBA(109,132, 78, 0), MakeRGBA(110,134, 78, 0), MakeRGBA(111,135, 79, 0), MakeRGBA(112,136, 80, 0),
+		MakeRGBA(113,137, 81, 0), MakeRGBA(114,138, 81, 0), MakeRGBA(116,140, 82, 0), MakeRGBA(117,141, 83, 0),
+		MakeRGBA(118,142, 84, 0), MakeRGBA(119,143, 85, 0), MakeRGBA(121,145, 85, 0), MakeRGBA(122,146, 86, 0),
+		MakeRGBA(123,147, 87, 0), MakeRGBA(124,148, 88, 0), MakeRGBA(125,149, 89, 0), MakeRGBA(127,151, 89, 0),
+		MakeRGBA(128,152, 90, 0), MakeRGBA(129,153, 91, 0), MakeRGBA(130,154, 92, 0), MakeRGBA(132,156, 93, 0),
+		MakeRGBA(133,157, 94, 0), MakeRGBA(134,158, 94, 0), MakeRGBA(135,159, 95, 0), MakeRGBA(136,160, 96, 0),
+		MakeRGBA(138,162, 97, 0), MakeRGBA(139,163, 98, 0), MakeRGBA(140,164, 98, 0), MakeRGBA(141,165, 99, 0),
+		MakeRGBA(142,166,100, 0), MakeRGBA(144,168,101, 0), MakeRGBA(145,169,102, 0), MakeRGBA(146,170,102, 0),
+		MakeRGBA(147,171,103, 0), MakeRGBA(149,173,104, 0), MakeRGBA(150,174,105, 0), MakeRGBA(151,175,106, 0),
+		MakeRGBA(152,176,106, 0), MakeRGBA(153,177,107, 0), MakeRGBA(155,179,108, 0), MakeRGBA(156,180,109, 0),
+		MakeRGBA(157,181,110, 0), MakeRGBA(158,182,111, 0), MakeRGBA(160,184,111, 0), MakeRGBA(161,185,112, 0),
+		MakeRGBA(162,186,113, 0), MakeRGBA(163,187,114, 0), MakeRGBA(164,188,115, 0), MakeRGBA(166,190,115, 0),
+		MakeRGBA(167,191,116, 0), MakeRGBA(168,192,117, 0), MakeRGBA(169,193,118, 0), MakeRGBA(171,195,119, 0),
+		MakeRGBA(172,196,120, 0), MakeRGBA(173,197,120, 0), MakeRGBA(174,198,121, 0), MakeRGBA(175,199,122, 0),
+		MakeRGBA(177,201,123, 0), MakeRGBA(178,202,124, 0), MakeRGBA(179,203,124, 0), MakeRGBA(180,204,125, 0),
+		MakeRGBA(182,206,126, 0), MakeRGBA(183,207,127, 0), MakeRGBA(183,207,128, 0), MakeRGBA(184,208,129, 0),
+		MakeRGBA(185,209,130, 0), MakeRGBA(185,209,131, 0), MakeRGBA(186,210,132, 0), MakeRGBA(187,211,133, 0),
+		MakeRGBA(187,211,134, 0), MakeRGBA(188,212,135, 0), MakeRGBA(188,212,136, 0), MakeRGBA(189,213,137, 0),
+		MakeRGBA(190,214,138, 0), MakeRGBA(190,214,139, 0), MakeRGBA(191,215,140, 0), MakeRGBA(191,215,141, 0),
+		MakeRGBA(192,216,142, 0), MakeRGBA(193,217,143, 0), MakeRGBA(193,217,144, 0), MakeRGBA(194,218,145, 0),
+		MakeRGBA(194,218,146, 0), MakeRGBA(195,219,147, 0), MakeRGBA(196,220,148, 0), MakeRGBA(196,220,149, 0),
+		MakeRGBA(197,221,150, 0), MakeRGBA(197,221,151, 0), MakeRGBA(198,222,152, 0), MakeRGBA(199,223,153, 0),
+		MakeRGBA(199,223,154, 0), MakeRGBA(200,224,155, 0), MakeRGBA(201,225,156, 0), MakeRGBA(201,225,157, 0),
+		MakeRGBA(202,226,158, 0), MakeRGBA(202,226,159, 0), MakeRGBA(203,227,160, 0), MakeRGBA(204,228,161, 0),
+		MakeRGBA(204,228,162, 0), MakeRGBA(205,229,163, 0), MakeRGBA(205,229,164, 0), MakeRGBA(206,230,165, 0),
+		MakeRGBA(207,231,166, 0), MakeRGBA(207,231,167, 0), MakeRGBA(208,232,169, 0), MakeRGBA(209,233,170, 0),
+		MakeRGBA(210,234,171, 0), MakeRGBA(211,235,172, 0), MakeRGBA(211,235,174, 0), MakeRGBA(212,236,175, 0),
+		MakeRGBA(213,237,176, 0), MakeRGBA(214,238,177, 0), MakeRGBA(215,239,178, 0), MakeRGBA(215,239,180, 0),
+		MakeRGBA(216,240,181, 0), MakeRGBA(217,241,182, 0), MakeRGBA(218,242,183, 0), MakeRGBA(219,243,185, 0),
+		MakeRGBA(219,243,186, 0), MakeRGBA(220,244,187, 0), MakeRGBA(221,245,188, 0), MakeRGBA(222,246,189, 0),
+		MakeRGBA(223,247,191, 0), MakeRGBA(224,247,193, 0), MakeRGBA(226,248,196, 0), MakeRGBA(227,248,200, 0),
+		MakeRGBA(229,249,203, 0), MakeRGBA(231,249,206, 0), MakeRGBA(232,249,209, 0), MakeRGBA(234,250,213, 0),
+		MakeRGBA(235,250,216, 0), MakeRGBA(237,251,219, 0), MakeRGBA(239,251,222, 0), MakeRGBA(240,251,226, 0),
+		MakeRGBA(242,252,229, 0), MakeRGBA(244,252,232, 0), MakeRGBA(245,253,235, 0), MakeRGBA(247,253,239, 0),
+		MakeRGBA(248,253,242, 0), MakeRGBA(250,254,245, 0), MakeRGBA(252,254,248, 0), MakeRGBA(253,255,252, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_PINK_BROWN. */
-static const uint32 _recolour08[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  2,  1, 0), MakeRGBA(  8,  4,  2, 0), MakeRGBA( 12,  7,  3, 0),
-	MakeRGBA( 16,  9,  4, 0), MakeRGBA( 20, 11,  5, 0), MakeRGBA( 24, 13,  6, 0), MakeRGBA( 28, 15,  7, 0),
-	MakeRGBA( 32, 17,  8, 0), MakeRGBA( 36, 20,  9, 0), MakeRGBA( 40, 22, 10, 0), MakeRGBA( 44, 24, 11, 0),
-	MakeRGBA( 48, 26, 12, 0), MakeRGBA( 52, 28, 13, 0), MakeRGBA( 56, 31, 14, 0), MakeRGBA( 60, 33, 14, 0),
-	MakeRGBA( 64, 35, 15, 0), MakeRGBA( 68, 37, 16, 0), MakeRGBA( 72, 39, 17, 0), MakeRGBA( 76, 41, 18, 0),
-	MakeRGBA( 79, 43, 19, 0), MakeRGBA( 80, 44, 20, 0), MakeRGBA( 81, 44, 20, 0), MakeRGBA( 82, 45, 20, 0),
-	MakeRGBA( 83, 46, 21, 0), MakeRGBA( 84, 46, 21, 0), MakeRGBA( 85, 47, 22, 0), MakeRGBA( 86, 47, 22, 0),
-	MakeRGBA( 87, 48, 22, 0), MakeRGBA( 88, 49, 23, 0), MakeRGBA( 89, 49, 23, 0), MakeRGBA( 90, 50, 24, 0),
-	MakeRGBA( 92, 51, 24, 0), MakeRGBA( 93, 51, 24, 0), MakeRGBA( 94, 52, 25, 0), MakeRGBA( 95, 52, 25, 0),
-	MakeRGBA( 96, 53, 26, 0), MakeRGBA( 97, 54, 26, 0), MakeRGBA( 98, 54, 26, 0), MakeRGBA( 99, 55, 27, 0),
-	MakeRGBA(100, 56, 28, 0), MakeRGBA(101, 56, 28, 0), MakeRGBA(102, 57, 29, 0), MakeRGBA(103, 58, 30, 0),
-	MakeRGBA(104, 59, 31, 0), MakeRGBA(105, 60, 32, 0), MakeRGBA(106, 60, 32, 0), MakeRGBA(107, 61, 33, 0),
-	MakeRGBA(108, 62, 34, 0), MakeRGBA(109, 63, 35, 0), MakeRGBA(110, 64, 36, 0), MakeRGBA(111, 64, 36, 0),
-	MakeRGBA(112, 65, 37, 0), MakeRGBA(113, 66, 38, 0), MakeRGBA(114, 67, 39, 0), MakeRGBA(115, 68, 40, 0),
-	MakeRGBA(116, 69, 41, 0), MakeRGBA(117, 69, 41, 0), MakeRGBA(118, 70, 42, 0), MakeRGBA(119, 71, 43, 0),
-	MakeRGBA(120, 72, 44, 0), MakeRGBA(121, 73, 45, 0), MakeRGBA(122, 73, 45, 0), MakeRGBA(123, 74, 46, 0),
-	MakeRGBA(124, 75, 47, 0), MakeRGBA(125, 76, 48, 0), MakeRGBA(126, 77, 49, 0), MakeRGBA(127, 77, 49, 0),
-	MakeRGBA(128, 78, 50, 0), MakeRGBA(129, 79, 51, 0), MakeRGBA(130, 80, 52, 0), MakeRGBA(131, 81, 53, 0),
-	MakeRGBA(132, 82, 54, 0), MakeRGBA(133, 82, 54, 0), MakeRGBA(134, 83, 55, 0), MakeRGBA(135, 84, 56, 0),
-	MakeRGBA(136, 85, 57, 0), MakeRGBA(137, 86, 58, 0), MakeRGBA(138, 86, 58, 0), MakeRGBA(139, 87, 59, 0),
-	MakeRGBA(141, 88, 60, 0), MakeRGBA(142, 88, 60, 0), MakeRGBA(144, 89, 60, 0), MakeRGBA(145, 90, 61, 0),
-	MakeRGBA(146, 90, 61, 0), MakeRGBA(148, 91, 62, 0), MakeRGBA(149, 91, 62, 0), MakeRGBA(151, 92, 62, 0),
-	MakeRGBA(152, 93, 63, 0), MakeRGBA(154, 93, 63, 0), MakeRGBA(155, 94, 64, 0), MakeRGBA(156, 94, 64, 0),
-	MakeRGBA(158, 95, 64, 0), MakeRGBA(159, 96, 65, 0), MakeRGBA(161, 96, 65, 0), MakeRGBA(162, 97, 66, 0),
-	MakeRGBA(164, 98, 66, 0), MakeRGBA(165, 98, 66, 0), MakeRGBA(166, 99, 67, 0), MakeRGBA(168, 99, 67, 0),
-	MakeRGBA(169,100, 68, 0), MakeRGBA(170,101, 69, 0), MakeRGBA(171,102, 70, 0), MakeRGBA(172,103, 71, 0),
-	MakeRGBA(173,104, 72, 0), MakeRGBA(174,104, 72, 0), MakeRGBA(175,105, 73, 0), MakeRGBA(176,106, 74, 0),
-	MakeRGBA(177,107, 75, 0), MakeRGBA(178,108, 76, 0), MakeRGBA(179,108, 76, 0), MakeRGBA(180,109, 77, 0),
-	MakeRGBA(181,110, 78, 0), MakeRGBA(182,111, 79, 0), MakeRGBA(183,112, 80, 0), MakeRGBA(184,112, 80, 0),
-	MakeRGBA(185,113, 81, 0), MakeRGBA(186,114, 82, 0), MakeRGBA(187,115, 83, 0), MakeRGBA(188,116, 84, 0),
-	MakeRGBA(189,117, 85, 0), MakeRGBA(190,117, 85, 0), MakeRGBA(191,118, 86, 0), MakeRGBA(192,119, 87, 0),
-	MakeRGBA(193,120, 88, 0), MakeRGBA(194,121, 89, 0), MakeRGBA(195,121, 89, 0), MakeRGBA(196,122, 90, 0),
-	MakeRGBA(197,123, 91, 0), MakeRGBA(198,124, 92, 0), MakeRGBA(199,125, 93, 0), MakeRGBA(200,125, 93, 0),
-	MakeRGBA(201,126, 94, 0), MakeRGBA(202,127, 95, 0), MakeRGBA(203,128, 96, 0), MakeRGBA(204,129, 97, 0),
-	MakeRGBA(205,130, 98, 0), MakeRGBA(206,130, 98, 0), MakeRGBA(207,131, 99, 0), MakeRGBA(207,132,100, 0),
-	MakeRGBA(208,133,101, 0), MakeRGBA(208,134,102, 0), MakeRGBA(209,135,102, 0), MakeRGBA(209,136,103, 0),
-	MakeRGBA(210,137,104, 0), MakeRGBA(210,138,105, 0), MakeRGBA(210,139,106, 0), MakeRGBA(211,140,106, 0),
-	MakeRGBA(211,141,107, 0), MakeRGBA(212,142,108, 0), MakeRGBA(212,143,109, 0), MakeRGBA(212,144,110, 0),
-	MakeRGBA(213,145,110, 0), MakeRGBA(213,146,111, 0), MakeRGBA(214,147,112, 0), MakeRGBA(214,148,113, 0),
-	MakeRGBA(214,149,114, 0), MakeRGBA(215,150,115, 0), MakeRGBA(215,151,115, 0), MakeRGBA(216,152,116, 0),
-	MakeRGBA(217,154,117, 0), MakeRGBA(217,155,118, 0), MakeRGBA(218,156,119, 0), MakeRGBA(218,157,119, 0),
-	MakeRGBA(219,158,120, 0), MakeRGBA(220,159,121, 0), MakeRGBA(220,160,122, 0), MakeRGBA(221,161,123, 0),
-	MakeRGBA(221,162,124, 0), MakeRGBA(222,163,124, 0), MakeRGBA(223,164,125, 0), MakeRGBA(223,165,126, 0),
-	MakeRGBA(224,166,127, 0), MakeRGBA(224,167,128, 0), MakeRGBA(225,168,128, 0), MakeRGBA(226,169,129, 0),
-	MakeRGBA(226,170,130, 0), MakeRGBA(227,171,131, 0), MakeRGBA(227,172,132, 0), MakeRGBA(228,173,133, 0),
-	MakeRGBA(229,174,134, 0), MakeRGBA(229,175,135, 0), MakeRGBA(230,176,136, 0), MakeRGBA(231,177,137, 0),
-	MakeRGBA(231,178,138, 0), MakeRGBA(232,179,139, 0), MakeRGBA(232,180,140, 0), MakeRGBA(233,181,141, 0),
-	MakeRGBA(234,182,142, 0), MakeRGBA(234,183,143, 0), MakeRGBA(235,184,144, 0), MakeRGBA(235,185,145, 0),
-	MakeRGBA(236,186,146, 0), MakeRGBA(237,187,147, 0), MakeRGBA(237,188,148, 0), MakeRGBA(238,189,149, 0),
-	MakeRGBA(238,190,150, 0), MakeRGBA(239,191,151, 0), MakeRGBA(239,192,152, 0), MakeRGBA(240,193,153, 0),
-	MakeRGBA(240,194,154, 0), MakeRGBA(241,194,155, 0), MakeRGBA(241,195,156, 0), MakeRGBA(241,196,157, 0),
-	MakeRGBA(242,197,158, 0), MakeRGBA(242,198,159, 0), MakeRGBA(243,198,160, 0), MakeRGBA(243,199,161, 0),
-	MakeRGBA(244,200,162, 0), MakeRGBA(244,201,163, 0), MakeRGBA(244,202,164, 0), MakeRGBA(245,202,165, 0),
-	MakeRGBA(245,203,166, 0), MakeRGBA(246,204,167, 0), MakeRGBA(246,205,168, 0), MakeRGBA(246,206,169, 0),
-	MakeRGBA(247,207,170, 0), MakeRGBA(247,207,171, 0), MakeRGBA(248,208,173, 0), MakeRGBA(248,209,174, 0),
-	MakeRGBA(248,210,175, 0), MakeRGBA(249,211,176, 0), MakeRGBA(249,212,178, 0), MakeRGBA(250,213,179, 0),
-	MakeRGBA(250,214,180, 0), MakeRGBA(250,216,181, 0), MakeRGBA(251,217,182, 0), MakeRGBA(251,218,184, 0),
-	MakeRGBA(252,219,185, 0), MakeRGBA(252,220,186, 0), MakeRGBA(252,221,187, 0), MakeRGBA(253,222,189, 0),
-	MakeRGBA(253,223,190, 0), MakeRGBA(254,224,191, 0), MakeRGBA(254,225,192, 0), MakeRGBA(254,226,193, 0),
-	MakeRGBA(255,227,195, 0), MakeRGBA(255,228,197, 0), MakeRGBA(255,229,200, 0), MakeRGBA(255,231,203, 0),
-	MakeRGBA(255,232,206, 0), MakeRGBA(255,234,209, 0), MakeRGBA(255,235,212, 0), MakeRGBA(255,237,215, 0),
-	MakeRGBA(255,238,218, 0), MakeRGBA(255,239,221, 0), MakeRGBA(255,241,225, 0), MakeRGBA(255,242,228, 0),
-	MakeRGBA(255,244,231, 0), MakeRGBA(255,245,234, 0), MakeRGBA(255,246,237, 0), MakeRGBA(255,248,240, 0),
-	MakeRGBA(255,249,243, 0), MakeRGBA(255,251,246, 0), MakeRGBA(255,252,249, 0), MakeRGBA(255,254,252, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_GREEN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  3,  0, 0), MakeRGBA(  2,  6,  0, 0), MakeRGBA(  2, 10,  0, 0),
+		MakeRGBA(  3, 13,  0, 0), MakeRGBA(  4, 16,  0, 0), MakeRGBA(  5, 19,  0, 0), MakeRGBA(  5, 22,  0, 0),
+		MakeRGBA(  6, 26,  0, 0), MakeRGBA(  7, 29,  0, 0), MakeRGBA(  8, 32,  0, 0), MakeRGBA(  8, 35,  0, 0),
+		MakeRGBA(  9, 38,  0, 0), MakeRGBA( 10, 42,  0, 0), MakeRGBA( 11, 45,  0, 0), MakeRGBA( 11, 48,  0, 0),
+		MakeRGBA( 12, 51,  0, 0), MakeRGBA( 13, 54,  0, 0), MakeRGBA( 14, 58,  0, 0), MakeRGBA( 14, 61,  0, 0),
+		MakeRGBA( 15, 63,  0, 0), MakeRGBA( 15, 64,  0, 0), MakeRGBA( 15, 65,  0, 0), MakeRGBA( 16, 66,  0, 0),
+		MakeRGBA( 16, 67,  0, 0), MakeRGBA( 16, 68,  0, 0), MakeRGBA( 16, 69,  0, 0), MakeRGBA( 16, 70,  0, 0),
+		MakeRGBA( 17, 71,  0, 0), MakeRGBA( 17, 72,  0, 0), MakeRGBA( 17, 73,  0, 0), MakeRGBA( 17, 74,  0, 0),
+		MakeRGBA( 18, 76,  0, 0), MakeRGBA( 18, 77,  0, 0), MakeRGBA( 18, 78,  0, 0), MakeRGBA( 18, 79,  0, 0),
+		MakeRGBA( 18, 80,  0, 0), MakeRGBA( 19, 81,  0, 0), MakeRGBA( 19, 82,  0, 0), MakeRGBA( 19, 83,  0, 0),
+		MakeRGBA( 19, 84,  0, 0), MakeRGBA( 19, 85,  0, 0), MakeRGBA( 20, 86,  0, 0), MakeRGBA( 20, 87,  0, 0),
+		MakeRGBA( 20, 88,  0, 0), MakeRGBA( 20, 89,  0, 0), MakeRGBA( 20, 90,  0, 0), MakeRGBA( 21, 91,  0, 0),
+		MakeRGBA( 21, 92,  0, 0), MakeRGBA( 21, 93,  0, 0), MakeRGBA( 21, 94,  0, 0), MakeRGBA( 21, 95,  0, 0),
+		MakeRGBA( 22, 96,  0, 0), MakeRGBA( 22, 97,  0, 0), MakeRGBA( 22, 98,  0, 0), MakeRGBA( 22, 99,  0, 0),
+		MakeRGBA( 22,100,  0, 0), MakeRGBA( 23,101,  0, 0), MakeRGBA( 23,102,  0, 0), MakeRGBA( 23,103,  0, 0),
+		MakeRGBA( 23,104,  0, 0), MakeRGBA( 24,105,  0, 0), MakeRGBA( 24,106,  0, 0), MakeRGBA( 25,107,  0, 0),
+		MakeRGBA( 25,108,  0, 0), MakeRGBA( 25,109,  0, 0), MakeRGBA( 26,110,  0, 0), MakeRGBA( 26,111,  0, 0),
+		MakeRGBA( 27,112,  0, 0), MakeRGBA( 27,113,  0, 0), MakeRGBA( 27,114,  0, 0), MakeRGBA( 28,115,  0, 0),
+		MakeRGBA( 28,116,  0, 0), MakeRGBA( 29,117,  0, 0), MakeRGBA( 29,118,  0, 0), MakeRGBA( 29,119,  0, 0),
+		MakeRGBA( 30,120,  0, 0), MakeRGBA( 30,121,  0, 0), MakeRGBA( 31,122,  0, 0), MakeRGBA( 31,123,  0, 0),
+		MakeRGBA( 32,124,  0, 0), MakeRGBA( 32,125,  1, 0), MakeRGBA( 32,126,  1, 0), MakeRGBA( 33,127,  2, 0),
+		MakeRGBA( 33,128,  2, 0), MakeRGBA( 34,129,  2, 0), MakeRGBA( 34,130,  3, 0), MakeRGBA( 34,131,  3, 0),
+		MakeRGBA( 35,132,  3, 0), MakeRGBA( 35,133,  4, 0), MakeRGBA( 36,134,  4, 0), MakeRGBA( 36,135,  4, 0),
+		MakeRGBA( 36,136,  5, 0), MakeRGBA( 37,137,  5, 0), MakeRGBA( 37,138,  5, 0), MakeRGBA( 38,139,  6, 0),
+		MakeRGBA( 38,141,  6, 0), MakeRGBA( 38,142,  6, 0), MakeRGBA( 39,143,  7, 0), MakeRGBA( 39,143,  7, 0),
+		MakeRGBA( 40,144,  8, 0), MakeRGBA( 41,145,  9, 0), MakeRGBA( 42,146, 10, 0), MakeRGBA( 43,147, 11, 0),
+		MakeRGBA( 43,148, 11, 0), MakeRGBA( 44,148, 12, 0), MakeRGBA( 45,149, 13, 0), MakeRGBA( 46,150, 14, 0),
+		MakeRGBA( 47,151, 15, 0), MakeRGBA( 48,152, 16, 0), MakeRGBA( 48,152, 16, 0), MakeRGBA( 49,153, 17, 0),
+		MakeRGBA( 50,154, 18, 0), MakeRGBA( 51,155, 19, 0), MakeRGBA( 52,156, 20, 0), MakeRGBA( 52,156, 20, 0),
+		MakeRGBA( 53,157, 21, 0), MakeRGBA( 54,158, 22, 0), MakeRGBA( 55,159, 23, 0), MakeRGBA( 56,160, 24, 0),
+		MakeRGBA( 56,161, 24, 0), MakeRGBA( 57,161, 25, 0), MakeRGBA( 58,162, 26, 0), MakeRGBA( 59,163, 27, 0),
+		MakeRGBA( 60,164, 28, 0), MakeRGBA( 61,165, 29, 0), MakeRGBA( 61,165, 29, 0), MakeRGBA( 62,166, 30, 0),
+		MakeRGBA( 63,167, 31, 0), MakeRGBA( 64,168, 32, 0), MakeRGBA( 65,169, 33, 0), MakeRGBA( 65,169, 33, 0),
+		MakeRGBA( 66,170, 34, 0), MakeRGBA( 67,171, 35, 0), MakeRGBA( 68,172, 36, 0), MakeRGBA( 69,173, 37, 0),
+		MakeRGBA( 70,174, 37, 0), MakeRGBA( 70,174, 38, 0), MakeRGBA( 71,175, 39, 0), MakeRGBA( 72,176, 40, 0),
+		MakeRGBA( 73,177, 42, 0), MakeRGBA( 74,178, 43, 0), MakeRGBA( 75,178, 44, 0), MakeRGBA( 76,179, 45, 0),
+		MakeRGBA( 77,180, 46, 0), MakeRGBA( 78,181, 48, 0), MakeRGBA( 79,182, 49, 0), MakeRGBA( 80,182, 50, 0),
+		MakeRGBA( 81,183, 51, 0), MakeRGBA( 82,184, 53, 0), MakeRGBA( 83,185, 54, 0), MakeRGBA( 84,186, 55, 0),
+		MakeRGBA( 85,186, 56, 0), MakeRGBA( 86,187, 57, 0), MakeRGBA( 87,188, 59, 0), MakeRGBA( 88,189, 60, 0),
+		MakeRGBA( 89,190, 61, 0), MakeRGBA( 90,191, 62, 0), MakeRGBA( 91,191, 64, 0), MakeRGBA( 92,192, 65, 0),
+		MakeRGBA( 93,193, 66, 0), MakeRGBA( 95,194, 67, 0), MakeRGBA( 96,195, 68, 0), MakeRGBA( 97,195, 70, 0),
+		MakeRGBA( 98,196, 71, 0), MakeRGBA( 99,197, 72, 0), MakeRGBA(100,198, 73, 0), MakeRGBA(101,199, 75, 0),
+		MakeRGBA(102,200, 76, 0), MakeRGBA(103,200, 77, 0), MakeRGBA(104,201, 78, 0), MakeRGBA(105,202, 79, 0),
+		MakeRGBA(106,203, 81, 0), MakeRGBA(107,204, 82, 0), MakeRGBA(108,204, 83, 0), MakeRGBA(109,205, 84, 0),
+		MakeRGBA(110,206, 85, 0), MakeRGBA(111,207, 87, 0), MakeRGBA(112,208, 88, 0), MakeRGBA(114,208, 90, 0),
+		MakeRGBA(115,209, 91, 0), MakeRGBA(116,210, 92, 0), MakeRGBA(118,211, 94, 0), MakeRGBA(119,212, 95, 0),
+		MakeRGBA(121,213, 97, 0), MakeRGBA(122,213, 98, 0), MakeRGBA(123,214, 99, 0), MakeRGBA(125,215,101, 0),
+		MakeRGBA(126,216,102, 0), MakeRGBA(128,217,104, 0), MakeRGBA(129,217,105, 0), MakeRGBA(131,218,107, 0),
+		MakeRGBA(132,219,108, 0), MakeRGBA(133,220,109, 0), MakeRGBA(135,221,111, 0), MakeRGBA(136,221,112, 0),
+		MakeRGBA(138,222,114, 0), MakeRGBA(139,223,115, 0), MakeRGBA(140,224,117, 0), MakeRGBA(142,225,118, 0),
+		MakeRGBA(143,226,119, 0), MakeRGBA(144,226,121, 0), MakeRGBA(145,227,122, 0), MakeRGBA(146,228,124, 0),
+		MakeRGBA(148,229,125, 0), MakeRGBA(149,230,126, 0), MakeRGBA(150,230,128, 0), MakeRGBA(151,231,129, 0),
+		MakeRGBA(153,232,131, 0), MakeRGBA(154,233,132, 0), MakeRGBA(155,234,134, 0), MakeRGBA(156,234,135, 0),
+		MakeRGBA(157,235,136, 0), MakeRGBA(159,236,138, 0), MakeRGBA(160,237,139, 0), MakeRGBA(161,238,141, 0),
+		MakeRGBA(162,239,142, 0), MakeRGBA(164,239,144, 0), MakeRGBA(165,240,146, 0), MakeRGBA(167,241,147, 0),
+		MakeRGBA(168,242,149, 0), MakeRGBA(170,243,151, 0), MakeRGBA(172,243,153, 0), MakeRGBA(173,244,155, 0),
+		MakeRGBA(175,245,156, 0), MakeRGBA(177,246,158, 0), MakeRGBA(178,247,160, 0), MakeRGBA(180,247,162, 0),
+		MakeRGBA(181,248,164, 0), MakeRGBA(183,249,166, 0), MakeRGBA(185,250,167, 0), MakeRGBA(186,251,169, 0),
+		MakeRGBA(188,251,171, 0), MakeRGBA(190,252,173, 0), MakeRGBA(191,253,175, 0), MakeRGBA(193,254,177, 0),
+		MakeRGBA(194,255,178, 0), MakeRGBA(197,255,182, 0), MakeRGBA(200,255,186, 0), MakeRGBA(203,255,189, 0),
+		MakeRGBA(206,255,193, 0), MakeRGBA(209,255,197, 0), MakeRGBA(212,255,201, 0), MakeRGBA(215,255,205, 0),
+		MakeRGBA(218,255,209, 0), MakeRGBA(221,255,213, 0), MakeRGBA(225,255,216, 0), MakeRGBA(228,255,220, 0),
+		MakeRGBA(231,255,224, 0), MakeRGBA(234,255,228, 0), MakeRGBA(237,255,232, 0), MakeRGBA(240,255,236, 0),
+		MakeRGBA(243,255,240, 0), MakeRGBA(246,255,243, 0), MakeRGBA(249,255,247, 0), MakeRGBA(252,255,251, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_DARK_PURPLE. */
-static const uint32 _recolour09[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  1,  3, 0), MakeRGBA(  2,  2,  6, 0), MakeRGBA(  2,  3,  8, 0),
-	MakeRGBA(  3,  4, 11, 0), MakeRGBA(  4,  5, 14, 0), MakeRGBA(  5,  6, 17, 0), MakeRGBA(  5,  7, 20, 0),
-	MakeRGBA(  6,  8, 22, 0), MakeRGBA(  7,  9, 25, 0), MakeRGBA(  8, 10, 28, 0), MakeRGBA(  8, 11, 31, 0),
-	MakeRGBA(  9, 12, 34, 0), MakeRGBA( 10, 13, 36, 0), MakeRGBA( 11, 14, 39, 0), MakeRGBA( 11, 14, 42, 0),
-	MakeRGBA( 12, 15, 45, 0), MakeRGBA( 13, 16, 47, 0), MakeRGBA( 14, 17, 50, 0), MakeRGBA( 14, 18, 53, 0),
-	MakeRGBA( 15, 19, 56, 0), MakeRGBA( 17, 21, 57, 0), MakeRGBA( 18, 22, 59, 0), MakeRGBA( 19, 23, 60, 0),
-	MakeRGBA( 20, 24, 62, 0), MakeRGBA( 21, 25, 64, 0), MakeRGBA( 23, 27, 65, 0), MakeRGBA( 24, 28, 67, 0),
-	MakeRGBA( 25, 29, 69, 0), MakeRGBA( 26, 30, 70, 0), MakeRGBA( 28, 32, 72, 0), MakeRGBA( 29, 33, 73, 0),
-	MakeRGBA( 30, 34, 75, 0), MakeRGBA( 31, 35, 77, 0), MakeRGBA( 32, 36, 78, 0), MakeRGBA( 34, 38, 80, 0),
-	MakeRGBA( 35, 39, 82, 0), MakeRGBA( 36, 40, 83, 0), MakeRGBA( 37, 41, 85, 0), MakeRGBA( 39, 43, 86, 0),
-	MakeRGBA( 39, 43, 88, 0), MakeRGBA( 40, 44, 88, 0), MakeRGBA( 41, 45, 89, 0), MakeRGBA( 41, 45, 90, 0),
-	MakeRGBA( 42, 46, 91, 0), MakeRGBA( 42, 46, 92, 0), MakeRGBA( 43, 47, 92, 0), MakeRGBA( 44, 48, 93, 0),
-	MakeRGBA( 44, 48, 94, 0), MakeRGBA( 45, 49, 95, 0), MakeRGBA( 45, 49, 96, 0), MakeRGBA( 46, 50, 96, 0),
-	MakeRGBA( 47, 51, 97, 0), MakeRGBA( 47, 51, 98, 0), MakeRGBA( 48, 52, 99, 0), MakeRGBA( 49, 53,100, 0),
-	MakeRGBA( 49, 53,101, 0), MakeRGBA( 50, 54,101, 0), MakeRGBA( 50, 54,102, 0), MakeRGBA( 51, 55,103, 0),
-	MakeRGBA( 52, 56,104, 0), MakeRGBA( 52, 56,105, 0), MakeRGBA( 53, 57,105, 0), MakeRGBA( 53, 57,106, 0),
-	MakeRGBA( 54, 58,107, 0), MakeRGBA( 55, 59,108, 0), MakeRGBA( 55, 59,109, 0), MakeRGBA( 56, 60,109, 0),
-	MakeRGBA( 56, 60,110, 0), MakeRGBA( 57, 61,111, 0), MakeRGBA( 58, 62,112, 0), MakeRGBA( 58, 62,113, 0),
-	MakeRGBA( 59, 63,114, 0), MakeRGBA( 59, 63,114, 0), MakeRGBA( 60, 64,115, 0), MakeRGBA( 61, 65,116, 0),
-	MakeRGBA( 61, 65,117, 0), MakeRGBA( 62, 66,118, 0), MakeRGBA( 63, 67,118, 0), MakeRGBA( 63, 67,119, 0),
-	MakeRGBA( 64, 68,120, 0), MakeRGBA( 65, 69,121, 0), MakeRGBA( 66, 70,122, 0), MakeRGBA( 67, 70,123, 0),
-	MakeRGBA( 68, 71,124, 0), MakeRGBA( 69, 72,125, 0), MakeRGBA( 70, 73,126, 0), MakeRGBA( 71, 74,127, 0),
-	MakeRGBA( 72, 75,128, 0), MakeRGBA( 73, 75,129, 0), MakeRGBA( 74, 76,130, 0), MakeRGBA( 75, 77,131, 0),
-	MakeRGBA( 76, 78,132, 0), MakeRGBA( 77, 79,133, 0), MakeRGBA( 78, 79,134, 0), MakeRGBA( 79, 80,135, 0),
-	MakeRGBA( 81, 81,137, 0), MakeRGBA( 82, 82,138, 0), MakeRGBA( 83, 83,139, 0), MakeRGBA( 83, 83,139, 0),
-	MakeRGBA( 84, 84,140, 0), MakeRGBA( 85, 85,141, 0), MakeRGBA( 86, 86,142, 0), MakeRGBA( 87, 87,143, 0),
-	MakeRGBA( 88, 88,144, 0), MakeRGBA( 88, 88,144, 0), MakeRGBA( 89, 89,145, 0), MakeRGBA( 90, 90,146, 0),
-	MakeRGBA( 91, 91,147, 0), MakeRGBA( 92, 92,148, 0), MakeRGBA( 92, 92,148, 0), MakeRGBA( 93, 93,149, 0),
-	MakeRGBA( 94, 94,150, 0), MakeRGBA( 95, 95,151, 0), MakeRGBA( 96, 96,152, 0), MakeRGBA( 96, 96,152, 0),
-	MakeRGBA( 97, 97,153, 0), MakeRGBA( 98, 98,154, 0), MakeRGBA( 99, 99,155, 0), MakeRGBA(100,100,156, 0),
-	MakeRGBA(101,101,157, 0), MakeRGBA(102,102,158, 0), MakeRGBA(103,103,159, 0), MakeRGBA(104,104,160, 0),
-	MakeRGBA(105,105,161, 0), MakeRGBA(106,106,162, 0), MakeRGBA(107,107,163, 0), MakeRGBA(108,108,164, 0),
-	MakeRGBA(109,109,165, 0), MakeRGBA(110,110,166, 0), MakeRGBA(111,111,167, 0), MakeRGBA(112,112,168, 0),
-	MakeRGBA(113,113,169, 0), MakeRGBA(114,114,170, 0), MakeRGBA(115,115,171, 0), MakeRGBA(116,116,172, 0),
-	MakeRGBA(117,117,173, 0), MakeRGBA(118,118,174, 0), MakeRGBA(119,119,175, 0), MakeRGBA(120,120,176, 0),
-	MakeRGBA(121,121,177, 0), MakeRGBA(122,122,178, 0), MakeRGBA(123,123,178, 0), MakeRGBA(124,124,179, 0),
-	MakeRGBA(125,125,180, 0), MakeRGBA(126,126,181, 0), MakeRGBA(127,127,182, 0), MakeRGBA(128,128,182, 0),
-	MakeRGBA(129,129,183, 0), MakeRGBA(130,130,184, 0), MakeRGBA(131,131,185, 0), MakeRGBA(132,132,186, 0),
-	MakeRGBA(133,133,186, 0), MakeRGBA(134,134,187, 0), MakeRGBA(135,135,188, 0), MakeRGBA(136,136,189, 0),
-	MakeRGBA(137,137,190, 0), MakeRGBA(138,138,191, 0), MakeRGBA(139,139,191, 0), MakeRGBA(140,140,192, 0),
-	MakeRGBA(142,142,193, 0), MakeRGBA(143,143,194, 0), MakeRGBA(144,144,195, 0), MakeRGBA(145,145,195, 0),
-	MakeRGBA(146,146,196, 0), MakeRGBA(147,147,197, 0), MakeRGBA(148,148,198, 0), MakeRGBA(149,149,199, 0),
-	MakeRGBA(150,150,200, 0), MakeRGBA(151,151,200, 0), MakeRGBA(152,152,201, 0), MakeRGBA(153,153,202, 0),
-	MakeRGBA(154,154,203, 0), MakeRGBA(155,155,204, 0), MakeRGBA(156,156,204, 0), MakeRGBA(157,157,205, 0),
-	MakeRGBA(158,158,206, 0), MakeRGBA(159,159,207, 0), MakeRGBA(160,160,208, 0), MakeRGBA(161,161,208, 0),
-	MakeRGBA(162,162,209, 0), MakeRGBA(164,164,210, 0), MakeRGBA(165,165,211, 0), MakeRGBA(166,166,212, 0),
-	MakeRGBA(167,167,213, 0), MakeRGBA(168,168,213, 0), MakeRGBA(170,170,214, 0), MakeRGBA(171,171,215, 0),
-	MakeRGBA(172,172,216, 0), MakeRGBA(173,173,217, 0), MakeRGBA(175,175,217, 0), MakeRGBA(176,176,218, 0),
-	MakeRGBA(177,177,219, 0), MakeRGBA(178,178,220, 0), MakeRGBA(179,179,221, 0), MakeRGBA(181,181,221, 0),
-	MakeRGBA(182,182,222, 0), MakeRGBA(183,183,223, 0), MakeRGBA(185,185,224, 0), MakeRGBA(186,186,225, 0),
-	MakeRGBA(187,187,226, 0), MakeRGBA(189,189,226, 0), MakeRGBA(190,190,227, 0), MakeRGBA(192,192,228, 0),
-	MakeRGBA(193,193,229, 0), MakeRGBA(194,194,230, 0), MakeRGBA(196,196,230, 0), MakeRGBA(197,197,231, 0),
-	MakeRGBA(199,199,232, 0), MakeRGBA(200,200,233, 0), MakeRGBA(202,202,234, 0), MakeRGBA(203,203,234, 0),
-	MakeRGBA(204,204,235, 0), MakeRGBA(206,206,236, 0), MakeRGBA(207,207,237, 0), MakeRGBA(209,209,238, 0),
-	MakeRGBA(210,210,239, 0), MakeRGBA(212,212,239, 0), MakeRGBA(213,213,240, 0), MakeRGBA(214,214,241, 0),
-	MakeRGBA(216,216,242, 0), MakeRGBA(217,217,243, 0), MakeRGBA(219,219,243, 0), MakeRGBA(220,220,244, 0),
-	MakeRGBA(221,221,245, 0), MakeRGBA(223,223,246, 0), MakeRGBA(224,224,247, 0), MakeRGBA(226,226,247, 0),
-	MakeRGBA(227,227,248, 0), MakeRGBA(229,229,249, 0), MakeRGBA(230,230,250, 0), MakeRGBA(231,231,251, 0),
-	MakeRGBA(233,233,251, 0), MakeRGBA(234,234,252, 0), MakeRGBA(236,236,253, 0), MakeRGBA(237,237,254, 0),
-	MakeRGBA(239,239,255, 0), MakeRGBA(240,240,255, 0), MakeRGBA(240,240,255, 0), MakeRGBA(241,241,255, 0),
-	MakeRGBA(242,242,255, 0), MakeRGBA(243,243,255, 0), MakeRGBA(244,244,255, 0), MakeRGBA(244,244,255, 0),
-	MakeRGBA(245,245,255, 0), MakeRGBA(246,246,255, 0), MakeRGBA(247,247,255, 0), MakeRGBA(248,248,255, 0),
-	MakeRGBA(249,249,255, 0), MakeRGBA(249,249,255, 0), MakeRGBA(250,250,255, 0), MakeRGBA(251,251,255, 0),
-	MakeRGBA(252,252,255, 0), MakeRGBA(253,253,255, 0), MakeRGBA(253,253,255, 0), MakeRGBA(254,254,255, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_PINK_BROWN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  2,  1, 0), MakeRGBA(  8,  4,  2, 0), MakeRGBA( 12,  7,  3, 0),
+		MakeRGBA( 16,  9,  4, 0), MakeRGBA( 20, 11,  5, 0), MakeRGBA( 24, 13,  6, 0), MakeRGBA( 28, 15,  7, 0),
+		MakeRGBA( 32, 17,  8, 0), MakeRGBA( 36, 20,  9, 0), MakeRGBA( 40, 22, 10, 0), MakeRGBA( 44, 24, 11, 0),
+		MakeRGBA( 48, 26, 12, 0), MakeRGBA( 52, 28, 13, 0), MakeRGBA( 56, 31, 14, 0), MakeRGBA( 60, 33, 14, 0),
+		MakeRGBA( 64, 35, 15, 0), MakeRGBA( 68, 37, 16, 0), MakeRGBA( 72, 39, 17, 0), MakeRGBA( 76, 41, 18, 0),
+		MakeRGBA( 79, 43, 19, 0), MakeRGBA( 80, 44, 20, 0), MakeRGBA( 81, 44, 20, 0), MakeRGBA( 82, 45, 20, 0),
+		MakeRGBA( 83, 46, 21, 0), MakeRGBA( 84, 46, 21, 0), MakeRGBA( 85, 47, 22, 0), MakeRGBA( 86, 47, 22, 0),
+		MakeRGBA( 87, 48, 22, 0), MakeRGBA( 88, 49, 23, 0), MakeRGBA( 89, 49, 23, 0), MakeRGBA( 90, 50, 24, 0),
+		MakeRGBA( 92, 51, 24, 0), MakeRGBA( 93, 51, 24, 0), MakeRGBA( 94, 52, 25, 0), MakeRGBA( 95, 52, 25, 0),
+		MakeRGBA( 96, 53, 26, 0), MakeRGBA( 97, 54, 26, 0), MakeRGBA( 98, 54, 26, 0), MakeRGBA( 99, 55, 27, 0),
+		MakeRGBA(100, 56, 28, 0), MakeRGBA(101, 56, 28, 0), MakeRGBA(102, 57, 29, 0), MakeRGBA(103, 58, 30, 0),
+		MakeRGBA(104, 59, 31, 0), MakeRGBA(105, 60, 32, 0), MakeRGBA(106, 60, 32, 0), MakeRGBA(107, 61, 33, 0),
+		MakeRGBA(108, 62, 34, 0), MakeRGBA(109, 63, 35, 0), MakeRGBA(110, 64, 36, 0), MakeRGBA(111, 64, 36, 0),
+		MakeRGBA(112, 65, 37, 0), MakeRGBA(113, 66, 38, 0), MakeRGBA(114, 67, 39, 0), MakeRGBA(115, 68, 40, 0),
+		MakeRGBA(116, 69, 41, 0), MakeRGBA(117, 69, 41, 0), MakeRGBA(118, 70, 42, 0), MakeRGBA(119, 71, 43, 0),
+		MakeRGBA(120, 72, 44, 0), MakeRGBA(121, 73, 45, 0), MakeRGBA(122, 73, 45, 0), MakeRGBA(123, 74, 46, 0),
+		MakeRGBA(124, 75, 47, 0), MakeRGBA(125, 76, 48, 0), MakeRGBA(126, 77, 49, 0), MakeRGBA(127, 77, 49, 0),
+		MakeRGBA(128, 78, 50, 0), MakeRGBA(129, 79, 51, 0), MakeRGBA(130, 80, 52, 0), MakeRGBA(131, 81, 53, 0),
+		MakeRGBA(132, 82, 54, 0), MakeRGBA(133, 82, 54, 0), MakeRGBA(134, 83, 55, 0), MakeRGBA(135, 84, 56, 0),
+		MakeRGBA(136, 85, 57, 0), MakeRGBA(137, 86, 58, 0), MakeRGBA(138, 86, 58, 0), MakeRGBA(139, 87, 59, 0),
+		MakeRGBA(141, 88, 60, 0), MakeRGBA(142, 88, 60, 0), MakeRGBA(144, 89, 60, 0), MakeRGBA(145, 90, 61, 0),
+		MakeRGBA(146, 90, 61, 0), MakeRGBA(148, 91, 62, 0), MakeRGBA(149, 91, 62, 0), MakeRGBA(151, 92, 62, 0),
+		MakeRGBA(152, 93, 63, 0), MakeRGBA(154, 93, 63, 0), MakeRGBA(155, 94, 64, 0), MakeRGBA(156, 94, 64, 0),
+		MakeRGBA(158, 95, 64, 0), MakeRGBA(159, 96, 65, 0), MakeRGBA(161, 96, 65, 0), MakeRGBA(162, 97, 66, 0),
+		MakeRGBA(164, 98, 66, 0), MakeRGBA(165, 98, 66, 0), MakeRGBA(166, 99, 67, 0), MakeRGBA(168, 99, 67, 0),
+		MakeRGBA(169,100, 68, 0), MakeRGBA(170,101, 69, 0), MakeRGBA(171,102, 70, 0), MakeRGBA(172,103, 71, 0),
+		MakeRGBA(173,104, 72, 0), MakeRGBA(174,104, 72, 0), MakeRGBA(175,105, 73, 0), MakeRGBA(176,106, 74, 0),
+		MakeRGBA(177,107, 75, 0), MakeRGBA(178,108, 76, 0), MakeRGBA(179,108, 76, 0), MakeRGBA(180,109, 77, 0),
+		MakeRGBA(181,110, 78, 0), MakeRGBA(182,111, 79, 0), MakeRGBA(183,112, 80, 0), MakeRGBA(184,112, 80, 0),
+		MakeRGBA(185,113, 81, 0), MakeRGBA(186,114, 82, 0), MakeRGBA(187,115, 83, 0), MakeRGBA(188,116, 84, 0),
+		MakeRGBA(189,117, 85, 0), MakeRGBA(190,117, 85, 0), MakeRGBA(191,118, 86, 0), MakeRGBA(192,119, 87, 0),
+		MakeRGBA(193,120, 88, 0), MakeRGBA(194,121, 89, 0), MakeRGBA(195,121, 89, 0), MakeRGBA(196,122, 90, 0),
+		MakeRGBA(197,123, 91, 0), MakeRGBA(198,124, 92, 0), MakeRGBA(199,125, 93, 0), MakeRGBA(200,125, 93, 0),
+		MakeRGBA(201,126, 94, 0), MakeRGBA(202,127, 95, 0), MakeRGBA(203,128, 96, 0), MakeRGBA(204,129, 97, 0),
+		MakeRGBA(205,130, 98, 0), MakeRGBA(206,130, 98, 0), MakeRGBA(207,131, 99, 0), MakeRGBA(207,132,100, 0),
+		MakeRGBA(208,133,101, 0), MakeRGBA(208,134,102, 0), MakeRGBA(209,135,102, 0), MakeRGBA(209,136,103, 0),
+		MakeRGBA(210,137,104, 0), MakeRGBA(210,138,105, 0), MakeRGBA(210,139,106, 0), MakeRGBA(211,140,106, 0),
+		MakeRGBA(211,141,107, 0), MakeRGBA(212,142,108, 0), MakeRGBA(212,143,109, 0), MakeRGBA(212,144,110, 0),
+		MakeRGBA(213,145,110, 0), MakeRGBA(213,146,111, 0), MakeRGBA(214,147,112, 0), MakeRGBA(214,148,113, 0),
+		MakeRGBA(214,149,114, 0), MakeRGBA(215,150,115, 0), MakeRGBA(215,151,115, 0), MakeRGBA(216,152,116, 0),
+		MakeRGBA(217,154,117, 0), MakeRGBA(217,155,118, 0), MakeRGBA(218,156,119, 0), MakeRGBA(218,157,119, 0),
+		MakeRGBA(219,158,120, 0), MakeRGBA(220,159,121, 0), MakeRGBA(220,160,122, 0), MakeRGBA(221,161,123, 0),
+		MakeRGBA(221,162,124, 0), MakeRGBA(222,163,124, 0), MakeRGBA(223,164,125, 0), MakeRGBA(223,165,126, 0),
+		MakeRGBA(224,166,127, 0), MakeRGBA(224,167,128, 0), MakeRGBA(225,168,128, 0), MakeRGBA(226,169,129, 0),
+		MakeRGBA(226,170,130, 0), MakeRGBA(227,171,131, 0), MakeRGBA(227,172,132, 0), MakeRGBA(228,173,133, 0),
+		MakeRGBA(229,174,134, 0), MakeRGBA(229,175,135, 0), MakeRGBA(230,176,136, 0), MakeRGBA(231,177,137, 0),
+		MakeRGBA(231,178,138, 0), MakeRGBA(232,179,139, 0), MakeRGBA(232,180,140, 0), MakeRGBA(233,181,141, 0),
+		MakeRGBA(234,182,142, 0), MakeRGBA(234,183,143, 0), MakeRGBA(235,184,144, 0), MakeRGBA(235,185,145, 0),
+		MakeRGBA(236,186,146, 0), MakeRGBA(237,187,147, 0), MakeRGBA(237,188,148, 0), MakeRGBA(238,189,149, 0),
+		MakeRGBA(238,190,150, 0), MakeRGBA(239,191,151, 0), MakeRGBA(239,192,152, 0), MakeRGBA(240,193,153, 0),
+		MakeRGBA(240,194,154, 0), MakeRGBA(241,194,155, 0), MakeRGBA(241,195,156, 0), MakeRGBA(241,196,157, 0),
+		MakeRGBA(242,197,158, 0), MakeRGBA(242,198,159, 0), MakeRGBA(243,198,160, 0), MakeRGBA(243,199,161, 0),
+		MakeRGBA(244,200,162, 0), MakeRGBA(244,201,163, 0), MakeRGBA(244,202,164, 0), MakeRGBA(245,202,165, 0),
+		MakeRGBA(245,203,166, 0), MakeRGBA(246,204,167, 0), MakeRGBA(246,205,168, 0), MakeRGBA(246,206,169, 0),
+		MakeRGBA(247,207,170, 0), MakeRGBA(247,207,171, 0), MakeRGBA(248,208,173, 0), MakeRGBA(248,209,174, 0),
+		MakeRGBA(248,210,175, 0), MakeRGBA(249,211,176, 0), MakeRGBA(249,212,178, 0), MakeRGBA(250,213,179, 0),
+		MakeRGBA(250,214,180, 0), MakeRGBA(250,216,181, 0), MakeRGBA(251,217,182, 0), MakeRGBA(251,218,184, 0),
+		MakeRGBA(252,219,185, 0), MakeRGBA(252,220,186, 0), MakeRGBA(252,221,187, 0), MakeRGBA(253,222,189, 0),
+		MakeRGBA(253,223,190, 0), MakeRGBA(254,224,191, 0), MakeRGBA(254,225,192, 0), MakeRGBA(254,226,193, 0),
+		MakeRGBA(255,227,195, 0), MakeRGBA(255,228,197, 0), MakeRGBA(255,229,200, 0), MakeRGBA(255,231,203, 0),
+		MakeRGBA(255,232,206, 0), MakeRGBA(255,234,209, 0), MakeRGBA(255,235,212, 0), MakeRGBA(255,237,215, 0),
+		MakeRGBA(255,238,218, 0), MakeRGBA(255,239,221, 0), MakeRGBA(255,241,225, 0), MakeRGBA(255,242,228, 0),
+		MakeRGBA(255,244,231, 0), MakeRGBA(255,245,234, 0), MakeRGBA(255,246,237, 0), MakeRGBA(255,248,240, 0),
+		MakeRGBA(255,249,243, 0), MakeRGBA(255,251,246, 0), MakeRGBA(255,252,249, 0), MakeRGBA(255,254,252, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_BLUE. */
-static const uint32 _recolour10[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  0,  1,  6, 0), MakeRGBA(  0,  3, 11, 0), MakeRGBA(  0,  4, 17, 0),
-	MakeRGBA(  0,  5, 23, 0), MakeRGBA(  0,  7, 28, 0), MakeRGBA(  0,  8, 34, 0), MakeRGBA(  0, 10, 39, 0),
-	MakeRGBA(  0, 11, 45, 0), MakeRGBA(  0, 12, 51, 0), MakeRGBA(  0, 14, 56, 0), MakeRGBA(  0, 15, 62, 0),
-	MakeRGBA(  0, 16, 68, 0), MakeRGBA(  0, 18, 73, 0), MakeRGBA(  0, 19, 79, 0), MakeRGBA(  0, 21, 85, 0),
-	MakeRGBA(  0, 22, 90, 0), MakeRGBA(  0, 23, 96, 0), MakeRGBA(  0, 25,101, 0), MakeRGBA(  0, 26,107, 0),
-	MakeRGBA(  0, 27,112, 0), MakeRGBA(  0, 28,114, 0), MakeRGBA(  0, 28,116, 0), MakeRGBA(  0, 29,118, 0),
-	MakeRGBA(  0, 30,120, 0), MakeRGBA(  0, 30,122, 0), MakeRGBA(  0, 31,124, 0), MakeRGBA(  0, 31,126, 0),
-	MakeRGBA(  0, 32,128, 0), MakeRGBA(  0, 33,130, 0), MakeRGBA(  0, 33,132, 0), MakeRGBA(  0, 34,134, 0),
-	MakeRGBA(  0, 35,136, 0), MakeRGBA(  0, 35,138, 0), MakeRGBA(  0, 36,140, 0), MakeRGBA(  0, 36,142, 0),
-	MakeRGBA(  0, 37,144, 0), MakeRGBA(  0, 38,146, 0), MakeRGBA(  0, 38,148, 0), MakeRGBA(  0, 39,150, 0),
-	MakeRGBA(  0, 39,152, 0), MakeRGBA(  1, 40,152, 0), MakeRGBA(  1, 41,153, 0), MakeRGBA(  1, 41,154, 0),
-	MakeRGBA(  2, 42,155, 0), MakeRGBA(  2, 42,156, 0), MakeRGBA(  2, 43,156, 0), MakeRGBA(  3, 44,157, 0),
-	MakeRGBA(  3, 44,158, 0), MakeRGBA(  3, 45,159, 0), MakeRGBA(  4, 45,160, 0), MakeRGBA(  4, 46,160, 0),
-	MakeRGBA(  4, 47,161, 0), MakeRGBA(  5, 47,162, 0), MakeRGBA(  5, 48,163, 0), MakeRGBA(  6, 49,164, 0),
-	MakeRGBA(  6, 49,165, 0), MakeRGBA(  6, 50,165, 0), MakeRGBA(  7, 50,166, 0), MakeRGBA(  7, 51,167, 0),
-	MakeRGBA(  7, 52,168, 0), MakeRGBA(  8, 53,169, 0), MakeRGBA(  8, 53,170, 0), MakeRGBA(  9, 54,171, 0),
-	MakeRGBA(  9, 55,172, 0), MakeRGBA(  9, 56,173, 0), MakeRGBA( 10, 57,174, 0), MakeRGBA( 10, 57,175, 0),
-	MakeRGBA( 11, 58,176, 0), MakeRGBA( 11, 59,177, 0), MakeRGBA( 11, 60,178, 0), MakeRGBA( 12, 61,179, 0),
-	MakeRGBA( 12, 62,180, 0), MakeRGBA( 13, 62,181, 0), MakeRGBA( 13, 63,182, 0), MakeRGBA( 13, 64,183, 0),
-	MakeRGBA( 14, 65,184, 0), MakeRGBA( 14, 66,185, 0), MakeRGBA( 15, 66,186, 0), MakeRGBA( 15, 67,187, 0),
-	MakeRGBA( 16, 68,188, 0), MakeRGBA( 16, 69,189, 0), MakeRGBA( 17, 70,190, 0), MakeRGBA( 18, 70,190, 0),
-	MakeRGBA( 18, 71,191, 0), MakeRGBA( 19, 72,192, 0), MakeRGBA( 19, 73,193, 0), MakeRGBA( 20, 74,194, 0),
-	MakeRGBA( 21, 75,195, 0), MakeRGBA( 21, 75,195, 0), MakeRGBA( 22, 76,196, 0), MakeRGBA( 22, 77,197, 0),
-	MakeRGBA( 23, 78,198, 0), MakeRGBA( 24, 79,199, 0), MakeRGBA( 24, 79,199, 0), MakeRGBA( 25, 80,200, 0),
-	MakeRGBA( 25, 81,201, 0), MakeRGBA( 26, 82,202, 0), MakeRGBA( 27, 83,203, 0), MakeRGBA( 27, 84,204, 0),
-	MakeRGBA( 28, 85,205, 0), MakeRGBA( 29, 86,206, 0), MakeRGBA( 30, 87,207, 0), MakeRGBA( 31, 88,208, 0),
-	MakeRGBA( 31, 89,209, 0), MakeRGBA( 32, 90,210, 0), MakeRGBA( 33, 91,211, 0), MakeRGBA( 34, 92,212, 0),
-	MakeRGBA( 35, 93,213, 0), MakeRGBA( 36, 94,214, 0), MakeRGBA( 36, 95,215, 0), MakeRGBA( 37, 96,216, 0),
-	MakeRGBA( 38, 97,217, 0), MakeRGBA( 39, 98,218, 0), MakeRGBA( 40, 99,219, 0), MakeRGBA( 40,100,220, 0),
-	MakeRGBA( 41,101,221, 0), MakeRGBA( 42,102,222, 0), MakeRGBA( 43,103,223, 0), MakeRGBA( 44,104,223, 0),
-	MakeRGBA( 45,106,223, 0), MakeRGBA( 46,108,224, 0), MakeRGBA( 48,109,224, 0), MakeRGBA( 49,111,224, 0),
-	MakeRGBA( 50,112,224, 0), MakeRGBA( 51,114,224, 0), MakeRGBA( 53,116,225, 0), MakeRGBA( 54,117,225, 0),
-	MakeRGBA( 55,119,225, 0), MakeRGBA( 56,121,225, 0), MakeRGBA( 57,122,225, 0), MakeRGBA( 59,124,226, 0),
-	MakeRGBA( 60,125,226, 0), MakeRGBA( 61,127,226, 0), MakeRGBA( 62,129,226, 0), MakeRGBA( 64,130,226, 0),
-	MakeRGBA( 65,132,227, 0), MakeRGBA( 66,134,227, 0), MakeRGBA( 67,135,227, 0), MakeRGBA( 68,137,227, 0),
-	MakeRGBA( 70,138,227, 0), MakeRGBA( 71,139,228, 0), MakeRGBA( 72,141,228, 0), MakeRGBA( 73,142,228, 0),
-	MakeRGBA( 74,144,228, 0), MakeRGBA( 76,145,228, 0), MakeRGBA( 77,147,229, 0), MakeRGBA( 78,148,229, 0),
-	MakeRGBA( 79,149,229, 0), MakeRGBA( 81,151,229, 0), MakeRGBA( 82,152,229, 0), MakeRGBA( 83,154,230, 0),
-	MakeRGBA( 84,155,230, 0), MakeRGBA( 85,157,230, 0), MakeRGBA( 87,158,230, 0), MakeRGBA( 88,159,230, 0),
-	MakeRGBA( 89,161,231, 0), MakeRGBA( 90,162,231, 0), MakeRGBA( 92,164,231, 0), MakeRGBA( 93,165,232, 0),
-	MakeRGBA( 94,166,232, 0), MakeRGBA( 96,167,232, 0), MakeRGBA( 97,168,233, 0), MakeRGBA( 99,170,233, 0),
-	MakeRGBA(100,171,234, 0), MakeRGBA(102,172,234, 0), MakeRGBA(103,173,234, 0), MakeRGBA(104,175,235, 0),
-	MakeRGBA(106,176,235, 0), MakeRGBA(107,177,236, 0), MakeRGBA(109,178,236, 0), MakeRGBA(110,179,236, 0),
-	MakeRGBA(112,181,237, 0), MakeRGBA(113,182,237, 0), MakeRGBA(114,183,238, 0), MakeRGBA(116,184,238, 0),
-	MakeRGBA(117,186,239, 0), MakeRGBA(119,187,239, 0), MakeRGBA(120,188,239, 0), MakeRGBA(121,189,239, 0),
-	MakeRGBA(122,190,240, 0), MakeRGBA(124,192,240, 0), MakeRGBA(125,193,240, 0), MakeRGBA(126,194,240, 0),
-	MakeRGBA(127,195,240, 0), MakeRGBA(128,196,241, 0), MakeRGBA(130,198,241, 0), MakeRGBA(131,199,241, 0),
-	MakeRGBA(132,200,241, 0), MakeRGBA(133,201,241, 0), MakeRGBA(135,203,242, 0), MakeRGBA(136,204,242, 0),
-	MakeRGBA(137,205,242, 0), MakeRGBA(138,206,242, 0), MakeRGBA(139,207,242, 0), MakeRGBA(141,209,243, 0),
-	MakeRGBA(142,210,243, 0), MakeRGBA(143,211,243, 0), MakeRGBA(145,212,243, 0), MakeRGBA(146,213,244, 0),
-	MakeRGBA(148,214,244, 0), MakeRGBA(150,215,245, 0), MakeRGBA(151,216,245, 0), MakeRGBA(153,217,245, 0),
-	MakeRGBA(154,218,246, 0), MakeRGBA(156,219,246, 0), MakeRGBA(158,220,247, 0), MakeRGBA(159,221,247, 0),
-	MakeRGBA(161,222,248, 0), MakeRGBA(163,223,248, 0), MakeRGBA(164,224,248, 0), MakeRGBA(166,225,249, 0),
-	MakeRGBA(167,226,249, 0), MakeRGBA(169,227,250, 0), MakeRGBA(171,228,250, 0), MakeRGBA(172,229,250, 0),
-	MakeRGBA(174,230,251, 0), MakeRGBA(176,231,251, 0), MakeRGBA(178,232,251, 0), MakeRGBA(180,233,251, 0),
-	MakeRGBA(182,234,252, 0), MakeRGBA(184,235,252, 0), MakeRGBA(186,235,252, 0), MakeRGBA(188,236,252, 0),
-	MakeRGBA(190,237,253, 0), MakeRGBA(192,238,253, 0), MakeRGBA(194,239,253, 0), MakeRGBA(196,239,253, 0),
-	MakeRGBA(198,240,253, 0), MakeRGBA(200,241,254, 0), MakeRGBA(202,242,254, 0), MakeRGBA(204,243,254, 0),
-	MakeRGBA(206,243,254, 0), MakeRGBA(208,244,254, 0), MakeRGBA(210,245,255, 0), MakeRGBA(212,246,255, 0),
-	MakeRGBA(214,247,255, 0), MakeRGBA(216,247,255, 0), MakeRGBA(218,248,255, 0), MakeRGBA(220,248,255, 0),
-	MakeRGBA(222,249,255, 0), MakeRGBA(225,249,255, 0), MakeRGBA(227,249,255, 0), MakeRGBA(229,250,255, 0),
-	MakeRGBA(231,250,255, 0), MakeRGBA(233,251,255, 0), MakeRGBA(235,251,255, 0), MakeRGBA(237,251,255, 0),
-	MakeRGBA(239,252,255, 0), MakeRGBA(241,252,255, 0), MakeRGBA(243,253,255, 0), MakeRGBA(245,253,255, 0),
-	MakeRGBA(247,253,255, 0), MakeRGBA(249,254,255, 0), MakeRGBA(251,254,255, 0), MakeRGBA(253,255,255, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_DARK_PURPLE. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  1,  3, 0), MakeRGBA(  2,  2,  6, 0), MakeRGBA(  2,  3,  8, 0),
+		MakeRGBA(  3,  4, 11, 0), MakeRGBA(  4,  5, 14, 0), MakeRGBA(  5,  6, 17, 0), MakeRGBA(  5,  7, 20, 0),
+		MakeRGBA(  6,  8, 22, 0), MakeRGBA(  7,  9, 25, 0), MakeRGBA(  8, 10, 28, 0), MakeRGBA(  8, 11, 31, 0),
+		MakeRGBA(  9, 12, 34, 0), MakeRGBA( 10, 13, 36, 0), MakeRGBA( 11, 14, 39, 0), MakeRGBA( 11, 14, 42, 0),
+		MakeRGBA( 12, 15, 45, 0), MakeRGBA( 13, 16, 47, 0), MakeRGBA( 14, 17, 50, 0), MakeRGBA( 14, 18, 53, 0),
+		MakeRGBA( 15, 19, 56, 0), MakeRGBA( 17, 21, 57, 0), MakeRGBA( 18, 22, 59, 0), MakeRGBA( 19, 23, 60, 0),
+		MakeRGBA( 20, 24, 62, 0), MakeRGBA( 21, 25, 64, 0), MakeRGBA( 23, 27, 65, 0), MakeRGBA( 24, 28, 67, 0),
+		MakeRGBA( 25, 29, 69, 0), MakeRGBA( 26, 30, 70, 0), MakeRGBA( 28, 32, 72, 0), MakeRGBA( 29, 33, 73, 0),
+		MakeRGBA( 30, 34, 75, 0), MakeRGBA( 31, 35, 77, 0), MakeRGBA( 32, 36, 78, 0), MakeRGBA( 34, 38, 80, 0),
+		MakeRGBA( 35, 39, 82, 0), MakeRGBA( 36, 40, 83, 0), MakeRGBA( 37, 41, 85, 0), MakeRGBA( 39, 43, 86, 0),
+		MakeRGBA( 39, 43, 88, 0), MakeRGBA( 40, 44, 88, 0), MakeRGBA( 41, 45, 89, 0), MakeRGBA( 41, 45, 90, 0),
+		MakeRGBA( 42, 46, 91, 0), MakeRGBA( 42, 46, 92, 0), MakeRGBA( 43, 47, 92, 0), MakeRGBA( 44, 48, 93, 0),
+		MakeRGBA( 44, 48, 94, 0), MakeRGBA( 45, 49, 95, 0), MakeRGBA( 45, 49, 96, 0), MakeRGBA( 46, 50, 96, 0),
+		MakeRGBA( 47, 51, 97, 0), MakeRGBA( 47, 51, 98, 0), MakeRGBA( 48, 52, 99, 0), MakeRGBA( 49, 53,100, 0),
+		MakeRGBA( 49, 53,101, 0), MakeRGBA( 50, 54,101, 0), MakeRGBA( 50, 54,102, 0), MakeRGBA( 51, 55,103, 0),
+		MakeRGBA( 52, 56,104, 0), MakeRGBA( 52, 56,105, 0), MakeRGBA( 53, 57,105, 0), MakeRGBA( 53, 57,106, 0),
+		MakeRGBA( 54, 58,107, 0), MakeRGBA( 55, 59,108, 0), MakeRGBA( 55, 59,109, 0), MakeRGBA( 56, 60,109, 0),
+		MakeRGBA( 56, 60,110, 0), MakeRGBA( 57, 61,111, 0), MakeRGBA( 58, 62,112, 0), MakeRGBA( 58, 62,113, 0),
+		MakeRGBA( 59, 63,114, 0), MakeRGBA( 59, 63,114, 0), MakeRGBA( 60, 64,115, 0), MakeRGBA( 61, 65,116, 0),
+		MakeRGBA( 61, 65,117, 0), MakeRGBA( 62, 66,118, 0), MakeRGBA( 63, 67,118, 0), MakeRGBA( 63, 67,119, 0),
+		MakeRGBA( 64, 68,120, 0), MakeRGBA( 65, 69,121, 0), MakeRGBA( 66, 70,122, 0), MakeRGBA( 67, 70,123, 0),
+		MakeRGBA( 68, 71,124, 0), MakeRGBA( 69, 72,125, 0), MakeRGBA( 70, 73,126, 0), MakeRGBA( 71, 74,127, 0),
+		MakeRGBA( 72, 75,128, 0), MakeRGBA( 73, 75,129, 0), MakeRGBA( 74, 76,130, 0), MakeRGBA( 75, 77,131, 0),
+		MakeRGBA( 76, 78,132, 0), MakeRGBA( 77, 79,133, 0), MakeRGBA( 78, 79,134, 0), MakeRGBA( 79, 80,135, 0),
+		MakeRGBA( 81, 81,137, 0), MakeRGBA( 82, 82,138, 0), MakeRGBA( 83, 83,139, 0), MakeRGBA( 83, 83,139, 0),
+		MakeRGBA( 84, 84,140, 0), MakeRGBA( 85, 85,141, 0), MakeRGBA( 86, 86,142, 0), MakeRGBA( 87, 87,143, 0),
+		MakeRGBA( 88, 88,144, 0), MakeRGBA( 88, 88,144, 0), MakeRGBA( 89, 89,145, 0), MakeRGBA( 90, 90,146, 0),
+		MakeRGBA( 91, 91,147, 0), MakeRGBA( 92, 92,148, 0), MakeRGBA( 92, 92,148, 0), MakeRGBA( 93, 93,149, 0),
+		MakeRGBA( 94, 94,150, 0), MakeRGBA( 95, 95,151, 0), MakeRGBA( 96, 96,152, 0), MakeRGBA( 96, 96,152, 0),
+		MakeRGBA( 97, 97,153, 0), MakeRGBA( 98, 98,154, 0), MakeRGBA( 99, 99,155, 0), MakeRGBA(100,100,156, 0),
+		MakeRGBA(101,101,157, 0), MakeRGBA(102,102,158, 0), MakeRGBA(103,103,159, 0), MakeRGBA(104,104,160, 0),
+		MakeRGBA(105,105,161, 0), MakeRGBA(106,106,162, 0), MakeRGBA(107,107,163, 0), MakeRGBA(108,108,164, 0),
+		MakeRGBA(109,109,165, 0), MakeRGBA(110,110,166, 0), MakeRGBA(111,111,167, 0), MakeRGBA(112,112,168, 0),
+		MakeRGBA(113,113,169, 0), MakeRGBA(114,114,170, 0), MakeRGBA(115,115,171, 0), MakeRGBA(116,116,172, 0),
+		MakeRGBA(117,117,173, 0), MakeRGBA(118,118,174, 0), MakeRGBA(119,119,175, 0), MakeRGBA(120,120,176, 0),
+		MakeRGBA(121,121,177, 0), MakeRGBA(122,122,178, 0), MakeRGBA(123,123,178, 0), MakeRGBA(124,124,179, 0),
+		MakeRGBA(125,125,180, 0), MakeRGBA(126,126,181, 0), MakeRGBA(127,127,182, 0), MakeRGBA(128,128,182, 0),
+		MakeRGBA(129,129,183, 0), MakeRGBA(130,130,184, 0), MakeRGBA(131,131,185, 0), MakeRGBA(132,132,186, 0),
+		MakeRGBA(133,133,186, 0), MakeRGBA(134,134,187, 0), MakeRGBA(135,135,188, 0), MakeRGBA(136,136,189, 0),
+		MakeRGBA(137,137,190, 0), MakeRGBA(138,138,191, 0), MakeRGBA(139,139,191, 0), MakeRGBA(140,140,192, 0),
+		MakeRGBA(142,142,193, 0), MakeRGBA(143,143,194, 0), MakeRGBA(144,144,195, 0), MakeRGBA(145,145,195, 0),
+		MakeRGBA(146,146,196, 0), MakeRGBA(147,147,197, 0), MakeRGBA(148,148,198, 0), MakeRGBA(149,149,199, 0),
+		MakeRGBA(150,150,200, 0), MakeRGBA(151,151,200, 0), MakeRGBA(152,152,201, 0), MakeRGBA(153,153,202, 0),
+		MakeRGBA(154,154,203, 0), MakeRGBA(155,155,204, 0), MakeRGBA(156,156,204, 0), MakeRGBA(157,157,205, 0),
+		MakeRGBA(158,158,206, 0), MakeRGBA(159,159,207, 0), MakeRGBA(160,160,208, 0), MakeRGBA(161,161,208, 0),
+		MakeRGBA(162,162,209, 0), MakeRGBA(164,164,210, 0), MakeRGBA(165,165,211, 0), MakeRGBA(166,166,212, 0),
+		MakeRGBA(167,167,213, 0), MakeRGBA(168,168,213, 0), MakeRGBA(170,170,214, 0), MakeRGBA(171,171,215, 0),
+		MakeRGBA(172,172,216, 0), MakeRGBA(173,173,217, 0), MakeRGBA(175,175,217, 0), MakeRGBA(176,176,218, 0),
+		MakeRGBA(177,177,219, 0), MakeRGBA(178,178,220, 0), MakeRGBA(179,179,221, 0), MakeRGBA(181,181,221, 0),
+		MakeRGBA(182,182,222, 0), MakeRGBA(183,183,223, 0), MakeRGBA(185,185,224, 0), MakeRGBA(186,186,225, 0),
+		MakeRGBA(187,187,226, 0), MakeRGBA(189,189,226, 0), MakeRGBA(190,190,227, 0), MakeRGBA(192,192,228, 0),
+		MakeRGBA(193,193,229, 0), MakeRGBA(194,194,230, 0), MakeRGBA(196,196,230, 0), MakeRGBA(197,197,231, 0),
+		MakeRGBA(199,199,232, 0), MakeRGBA(200,200,233, 0), MakeRGBA(202,202,234, 0), MakeRGBA(203,203,234, 0),
+		MakeRGBA(204,204,235, 0), MakeRGBA(206,206,236, 0), MakeRGBA(207,207,237, 0), MakeRGBA(209,209,238, 0),
+		MakeRGBA(210,210,239, 0), MakeRGBA(212,212,239, 0), MakeRGBA(213,213,240, 0), MakeRGBA(214,214,241, 0),
+		MakeRGBA(216,216,242, 0), MakeRGBA(217,217,243, 0), MakeRGBA(219,219,243, 0), MakeRGBA(220,220,244, 0),
+		MakeRGBA(221,221,245, 0), MakeRGBA(223,223,246, 0), MakeRGBA(224,224,247, 0), MakeRGBA(226,226,247, 0),
+		MakeRGBA(227,227,248, 0), MakeRGBA(229,229,249, 0), MakeRGBA(230,230,250, 0), MakeRGBA(231,231,251, 0),
+		MakeRGBA(233,233,251, 0), MakeRGBA(234,234,252, 0), MakeRGBA(236,236,253, 0), MakeRGBA(237,237,254, 0),
+		MakeRGBA(239,239,255, 0), MakeRGBA(240,240,255, 0), MakeRGBA(240,240,255, 0), MakeRGBA(241,241,255, 0),
+		MakeRGBA(242,242,255, 0), MakeRGBA(243,243,255, 0), MakeRGBA(244,244,255, 0), MakeRGBA(244,244,255, 0),
+		MakeRGBA(245,245,255, 0), MakeRGBA(246,246,255, 0), MakeRGBA(247,247,255, 0), MakeRGBA(248,248,255, 0),
+		MakeRGBA(249,249,255, 0), MakeRGBA(249,249,255, 0), MakeRGBA(250,250,255, 0), MakeRGBA(251,251,255, 0),
+		MakeRGBA(252,252,255, 0), MakeRGBA(253,253,255, 0), MakeRGBA(253,253,255, 0), MakeRGBA(254,254,255, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_DARK_JADE_GREEN. */
-static const uint32 _recolour11[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  2,  1, 0), MakeRGBA(  1,  4,  2, 0), MakeRGBA(  2,  7,  2, 0),
-	MakeRGBA(  2,  9,  3, 0), MakeRGBA(  3, 11,  4, 0), MakeRGBA(  3, 13,  5, 0), MakeRGBA(  4, 15,  5, 0),
-	MakeRGBA(  4, 17,  6, 0), MakeRGBA(  5, 20,  7, 0), MakeRGBA(  6, 22,  8, 0), MakeRGBA(  6, 24,  8, 0),
-	MakeRGBA(  7, 26,  9, 0), MakeRGBA(  7, 28, 10, 0), MakeRGBA(  8, 31, 11, 0), MakeRGBA(  8, 33, 11, 0),
-	MakeRGBA(  9, 35, 12, 0), MakeRGBA(  9, 37, 13, 0), MakeRGBA( 10, 39, 14, 0), MakeRGBA( 11, 41, 14, 0),
-	MakeRGBA( 11, 43, 15, 0), MakeRGBA( 11, 44, 16, 0), MakeRGBA( 11, 44, 16, 0), MakeRGBA( 12, 45, 16, 0),
-	MakeRGBA( 12, 46, 17, 0), MakeRGBA( 12, 46, 17, 0), MakeRGBA( 12, 47, 18, 0), MakeRGBA( 12, 47, 18, 0),
-	MakeRGBA( 13, 48, 18, 0), MakeRGBA( 13, 49, 19, 0), MakeRGBA( 13, 49, 19, 0), MakeRGBA( 13, 50, 20, 0),
-	MakeRGBA( 14, 51, 20, 0), MakeRGBA( 14, 51, 20, 0), MakeRGBA( 14, 52, 21, 0), MakeRGBA( 14, 52, 21, 0),
-	MakeRGBA( 14, 53, 22, 0), MakeRGBA( 15, 54, 22, 0), MakeRGBA( 15, 54, 22, 0), MakeRGBA( 15, 55, 23, 0),
-	MakeRGBA( 15, 56, 23, 0), MakeRGBA( 16, 56, 24, 0), MakeRGBA( 16, 57, 24, 0), MakeRGBA( 16, 58, 24, 0),
-	MakeRGBA( 17, 59, 25, 0), MakeRGBA( 17, 60, 25, 0), MakeRGBA( 18, 60, 26, 0), MakeRGBA( 18, 61, 26, 0),
-	MakeRGBA( 19, 62, 27, 0), MakeRGBA( 19, 63, 27, 0), MakeRGBA( 19, 64, 27, 0), MakeRGBA( 20, 64, 28, 0),
-	MakeRGBA( 20, 65, 28, 0), MakeRGBA( 21, 66, 29, 0), MakeRGBA( 21, 67, 29, 0), MakeRGBA( 21, 68, 29, 0),
-	MakeRGBA( 22, 69, 30, 0), MakeRGBA( 22, 69, 30, 0), MakeRGBA( 23, 70, 31, 0), MakeRGBA( 23, 71, 31, 0),
-	MakeRGBA( 24, 72, 32, 0), MakeRGBA( 24, 72, 32, 0), MakeRGBA( 25, 73, 33, 0), MakeRGBA( 25, 73, 33, 0),
-	MakeRGBA( 26, 74, 34, 0), MakeRGBA( 27, 75, 35, 0), MakeRGBA( 27, 75, 35, 0), MakeRGBA( 28, 76, 36, 0),
-	MakeRGBA( 28, 76, 36, 0), MakeRGBA( 29, 77, 37, 0), MakeRGBA( 30, 78, 38, 0), MakeRGBA( 30, 78, 38, 0),
-	MakeRGBA( 31, 79, 39, 0), MakeRGBA( 31, 79, 39, 0), MakeRGBA( 32, 80, 40, 0), MakeRGBA( 33, 81, 41, 0),
-	MakeRGBA( 33, 81, 41, 0), MakeRGBA( 34, 82, 42, 0), MakeRGBA( 35, 83, 43, 0), MakeRGBA( 35, 83, 43, 0),
-	MakeRGBA( 36, 84, 44, 0), MakeRGBA( 36, 85, 45, 0), MakeRGBA( 37, 86, 46, 0), MakeRGBA( 38, 86, 46, 0),
-	MakeRGBA( 38, 87, 47, 0), MakeRGBA( 39, 88, 48, 0), MakeRGBA( 39, 89, 49, 0), MakeRGBA( 40, 90, 50, 0),
-	MakeRGBA( 41, 91, 51, 0), MakeRGBA( 41, 91, 51, 0), MakeRGBA( 42, 92, 52, 0), MakeRGBA( 42, 93, 53, 0),
-	MakeRGBA( 43, 94, 54, 0), MakeRGBA( 44, 95, 55, 0), MakeRGBA( 44, 95, 55, 0), MakeRGBA( 45, 96, 56, 0),
-	MakeRGBA( 46, 97, 57, 0), MakeRGBA( 46, 98, 58, 0), MakeRGBA( 47, 99, 59, 0), MakeRGBA( 47, 99, 59, 0),
-	MakeRGBA( 48,100, 60, 0), MakeRGBA( 49,101, 61, 0), MakeRGBA( 49,102, 62, 0), MakeRGBA( 50,103, 63, 0),
-	MakeRGBA( 50,104, 63, 0), MakeRGBA( 51,104, 64, 0), MakeRGBA( 52,105, 65, 0), MakeRGBA( 52,106, 66, 0),
-	MakeRGBA( 53,107, 67, 0), MakeRGBA( 53,108, 68, 0), MakeRGBA( 54,108, 68, 0), MakeRGBA( 55,109, 69, 0),
-	MakeRGBA( 55,110, 70, 0), MakeRGBA( 56,111, 71, 0), MakeRGBA( 56,112, 72, 0), MakeRGBA( 57,112, 72, 0),
-	MakeRGBA( 58,113, 73, 0), MakeRGBA( 58,114, 74, 0), MakeRGBA( 59,115, 75, 0), MakeRGBA( 60,116, 76, 0),
-	MakeRGBA( 61,117, 77, 0), MakeRGBA( 62,118, 78, 0), MakeRGBA( 63,119, 79, 0), MakeRGBA( 64,120, 80, 0),
-	MakeRGBA( 65,121, 81, 0), MakeRGBA( 66,122, 82, 0), MakeRGBA( 67,123, 83, 0), MakeRGBA( 68,124, 84, 0),
-	MakeRGBA( 69,125, 85, 0), MakeRGBA( 70,126, 86, 0), MakeRGBA( 71,127, 87, 0), MakeRGBA( 72,128, 88, 0),
-	MakeRGBA( 73,129, 89, 0), MakeRGBA( 74,130, 90, 0), MakeRGBA( 75,131, 91, 0), MakeRGBA( 76,132, 92, 0),
-	MakeRGBA( 77,133, 93, 0), MakeRGBA( 78,134, 94, 0), MakeRGBA( 79,135, 95, 0), MakeRGBA( 80,136, 96, 0),
-	MakeRGBA( 81,137, 98, 0), MakeRGBA( 82,138, 99, 0), MakeRGBA( 83,139,100, 0), MakeRGBA( 84,140,101, 0),
-	MakeRGBA( 85,141,102, 0), MakeRGBA( 86,142,104, 0), MakeRGBA( 87,143,105, 0), MakeRGBA( 88,144,106, 0),
-	MakeRGBA( 89,145,107, 0), MakeRGBA( 90,146,109, 0), MakeRGBA( 91,147,110, 0), MakeRGBA( 92,148,111, 0),
-	MakeRGBA( 93,149,112, 0), MakeRGBA( 94,150,113, 0), MakeRGBA( 95,151,115, 0), MakeRGBA( 96,152,116, 0),
-	MakeRGBA( 97,153,117, 0), MakeRGBA( 98,154,118, 0), MakeRGBA(100,155,119, 0), MakeRGBA(101,156,120, 0),
-	MakeRGBA(102,158,121, 0), MakeRGBA(103,159,123, 0), MakeRGBA(104,160,124, 0), MakeRGBA(106,161,125, 0),
-	MakeRGBA(107,162,126, 0), MakeRGBA(108,163,127, 0), MakeRGBA(109,164,128, 0), MakeRGBA(111,165,129, 0),
-	MakeRGBA(112,166,130, 0), MakeRGBA(113,167,131, 0), MakeRGBA(114,168,132, 0), MakeRGBA(115,169,133, 0),
-	MakeRGBA(117,170,134, 0), MakeRGBA(118,171,135, 0), MakeRGBA(119,172,136, 0), MakeRGBA(120,173,137, 0),
-	MakeRGBA(121,174,138, 0), MakeRGBA(123,175,139, 0), MakeRGBA(124,176,140, 0), MakeRGBA(125,177,142, 0),
-	MakeRGBA(126,178,143, 0), MakeRGBA(128,180,144, 0), MakeRGBA(129,181,146, 0), MakeRGBA(130,182,147, 0),
-	MakeRGBA(131,183,149, 0), MakeRGBA(132,184,150, 0), MakeRGBA(134,186,151, 0), MakeRGBA(135,187,153, 0),
-	MakeRGBA(136,188,154, 0), MakeRGBA(137,189,156, 0), MakeRGBA(139,191,157, 0), MakeRGBA(140,192,159, 0),
-	MakeRGBA(141,193,160, 0), MakeRGBA(142,194,161, 0), MakeRGBA(143,195,163, 0), MakeRGBA(145,197,164, 0),
-	MakeRGBA(146,198,166, 0), MakeRGBA(147,199,167, 0), MakeRGBA(149,200,169, 0), MakeRGBA(150,201,170, 0),
-	MakeRGBA(151,202,171, 0), MakeRGBA(153,203,173, 0), MakeRGBA(154,204,174, 0), MakeRGBA(156,205,176, 0),
-	MakeRGBA(157,206,177, 0), MakeRGBA(158,207,178, 0), MakeRGBA(160,208,180, 0), MakeRGBA(161,209,181, 0),
-	MakeRGBA(163,210,183, 0), MakeRGBA(164,211,184, 0), MakeRGBA(166,212,186, 0), MakeRGBA(167,213,187, 0),
-	MakeRGBA(168,214,188, 0), MakeRGBA(170,215,190, 0), MakeRGBA(171,216,191, 0), MakeRGBA(173,217,193, 0),
-	MakeRGBA(174,218,194, 0), MakeRGBA(176,219,196, 0), MakeRGBA(177,221,197, 0), MakeRGBA(179,222,198, 0),
-	MakeRGBA(180,223,200, 0), MakeRGBA(182,224,201, 0), MakeRGBA(184,226,203, 0), MakeRGBA(185,227,204, 0),
-	MakeRGBA(187,228,205, 0), MakeRGBA(189,229,207, 0), MakeRGBA(190,230,208, 0), MakeRGBA(192,232,210, 0),
-	MakeRGBA(193,233,211, 0), MakeRGBA(195,234,213, 0), MakeRGBA(197,235,214, 0), MakeRGBA(198,237,215, 0),
-	MakeRGBA(200,238,217, 0), MakeRGBA(202,239,218, 0), MakeRGBA(203,240,220, 0), MakeRGBA(205,241,221, 0),
-	MakeRGBA(206,243,223, 0), MakeRGBA(209,243,224, 0), MakeRGBA(211,244,226, 0), MakeRGBA(214,245,227, 0),
-	MakeRGBA(216,245,229, 0), MakeRGBA(218,246,231, 0), MakeRGBA(221,246,232, 0), MakeRGBA(223,247,234, 0),
-	MakeRGBA(226,248,235, 0), MakeRGBA(228,248,237, 0), MakeRGBA(231,249,239, 0), MakeRGBA(233,250,240, 0),
-	MakeRGBA(235,250,242, 0), MakeRGBA(238,251,244, 0), MakeRGBA(240,251,245, 0), MakeRGBA(243,252,247, 0),
-	MakeRGBA(245,253,248, 0), MakeRGBA(248,253,250, 0), MakeRGBA(250,254,252, 0), MakeRGBA(253,254,253, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_BLUE. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  0,  1,  6, 0), MakeRGBA(  0,  3, 11, 0), MakeRGBA(  0,  4, 17, 0),
+		MakeRGBA(  0,  5, 23, 0), MakeRGBA(  0,  7, 28, 0), MakeRGBA(  0,  8, 34, 0), MakeRGBA(  0, 10, 39, 0),
+		MakeRGBA(  0, 11, 45, 0), MakeRGBA(  0, 12, 51, 0), MakeRGBA(  0, 14, 56, 0), MakeRGBA(  0, 15, 62, 0),
+		MakeRGBA(  0, 16, 68, 0), MakeRGBA(  0, 18, 73, 0), MakeRGBA(  0, 19, 79, 0), MakeRGBA(  0, 21, 85, 0),
+		MakeRGBA(  0, 22, 90, 0), MakeRGBA(  0, 23, 96, 0), MakeRGBA(  0, 25,101, 0), MakeRGBA(  0, 26,107, 0),
+		MakeRGBA(  0, 27,112, 0), MakeRGBA(  0, 28,114, 0), MakeRGBA(  0, 28,116, 0), MakeRGBA(  0, 29,118, 0),
+		MakeRGBA(  0, 30,120, 0), MakeRGBA(  0, 30,122, 0), MakeRGBA(  0, 31,124, 0), MakeRGBA(  0, 31,126, 0),
+		MakeRGBA(  0, 32,128, 0), MakeRGBA(  0, 33,130, 0), MakeRGBA(  0, 33,132, 0), MakeRGBA(  0, 34,134, 0),
+		MakeRGBA(  0, 35,136, 0), MakeRGBA(  0, 35,138, 0), MakeRGBA(  0, 36,140, 0), MakeRGBA(  0, 36,142, 0),
+		MakeRGBA(  0, 37,144, 0), MakeRGBA(  0, 38,146, 0), MakeRGBA(  0, 38,148, 0), MakeRGBA(  0, 39,150, 0),
+		MakeRGBA(  0, 39,152, 0), MakeRGBA(  1, 40,152, 0), MakeRGBA(  1, 41,153, 0), MakeRGBA(  1, 41,154, 0),
+		MakeRGBA(  2, 42,155, 0), MakeRGBA(  2, 42,156, 0), MakeRGBA(  2, 43,156, 0), MakeRGBA(  3, 44,157, 0),
+		MakeRGBA(  3, 44,158, 0), MakeRGBA(  3, 45,159, 0), MakeRGBA(  4, 45,160, 0), MakeRGBA(  4, 46,160, 0),
+		MakeRGBA(  4, 47,161, 0), MakeRGBA(  5, 47,162, 0), MakeRGBA(  5, 48,163, 0), MakeRGBA(  6, 49,164, 0),
+		MakeRGBA(  6, 49,165, 0), MakeRGBA(  6, 50,165, 0), MakeRGBA(  7, 50,166, 0), MakeRGBA(  7, 51,167, 0),
+		MakeRGBA(  7, 52,168, 0), MakeRGBA(  8, 53,169, 0), MakeRGBA(  8, 53,170, 0), MakeRGBA(  9, 54,171, 0),
+		MakeRGBA(  9, 55,172, 0), MakeRGBA(  9, 56,173, 0), MakeRGBA( 10, 57,174, 0), MakeRGBA( 10, 57,175, 0),
+		MakeRGBA( 11, 58,176, 0), MakeRGBA( 11, 59,177, 0), MakeRGBA( 11, 60,178, 0), MakeRGBA( 12, 61,179, 0),
+		MakeRGBA( 12, 62,180, 0), MakeRGBA( 13, 62,181, 0), MakeRGBA( 13, 63,182, 0), MakeRGBA( 13, 64,183, 0),
+		MakeRGBA( 14, 65,184, 0), MakeRGBA( 14, 66,185, 0), MakeRGBA( 15, 66,186, 0), MakeRGBA( 15, 67,187, 0),
+		MakeRGBA( 16, 68,188, 0), MakeRGBA( 16, 69,189, 0), MakeRGBA( 17, 70,190, 0), MakeRGBA( 18, 70,190, 0),
+		MakeRGBA( 18, 71,191, 0), MakeRGBA( 19, 72,192, 0), MakeRGBA( 19, 73,193, 0), MakeRGBA( 20, 74,194, 0),
+		MakeRGBA( 21, 75,195, 0), MakeRGBA( 21, 75,195, 0), MakeRGBA( 22, 76,196, 0), MakeRGBA( 22, 77,197, 0),
+		MakeRGBA( 23, 78,198, 0), MakeRGBA( 24, 79,199, 0), MakeRGBA( 24, 79,199, 0), MakeRGBA( 25, 80,200, 0),
+		MakeRGBA( 25, 81,201, 0), MakeRGBA( 26, 82,202, 0), MakeRGBA( 27, 83,203, 0), MakeRGBA( 27, 84,204, 0),
+		MakeRGBA( 28, 85,205, 0), MakeRGBA( 29, 86,206, 0), MakeRGBA( 30, 87,207, 0), MakeRGBA( 31, 88,208, 0),
+		MakeRGBA( 31, 89,209, 0), MakeRGBA( 32, 90,210, 0), MakeRGBA( 33, 91,211, 0), MakeRGBA( 34, 92,212, 0),
+		MakeRGBA( 35, 93,213, 0), MakeRGBA( 36, 94,214, 0), MakeRGBA( 36, 95,215, 0), MakeRGBA( 37, 96,216, 0),
+		MakeRGBA( 38, 97,217, 0), MakeRGBA( 39, 98,218, 0), MakeRGBA( 40, 99,219, 0), MakeRGBA( 40,100,220, 0),
+		MakeRGBA( 41,101,221, 0), MakeRGBA( 42,102,222, 0), MakeRGBA( 43,103,223, 0), MakeRGBA( 44,104,223, 0),
+		MakeRGBA( 45,106,223, 0), MakeRGBA( 46,108,224, 0), MakeRGBA( 48,109,224, 0), MakeRGBA( 49,111,224, 0),
+		MakeRGBA( 50,112,224, 0), MakeRGBA( 51,114,224, 0), MakeRGBA( 53,116,225, 0), MakeRGBA( 54,117,225, 0),
+		MakeRGBA( 55,119,225, 0), MakeRGBA( 56,121,225, 0), MakeRGBA( 57,122,225, 0), MakeRGBA( 59,124,226, 0),
+		MakeRGBA( 60,125,226, 0), MakeRGBA( 61,127,226, 0), MakeRGBA( 62,129,226, 0), MakeRGBA( 64,130,226, 0),
+		MakeRGBA( 65,132,227, 0), MakeRGBA( 66,134,227, 0), MakeRGBA( 67,135,227, 0), MakeRGBA( 68,137,227, 0),
+		MakeRGBA( 70,138,227, 0), MakeRGBA( 71,139,228, 0), MakeRGBA( 72,141,228, 0), MakeRGBA( 73,142,228, 0),
+		MakeRGBA( 74,144,228, 0), MakeRGBA( 76,145,228, 0), MakeRGBA( 77,147,229, 0), MakeRGBA( 78,148,229, 0),
+		MakeRGBA( 79,149,229, 0), MakeRGBA( 81,151,229, 0), MakeRGBA( 82,152,229, 0), MakeRGBA( 83,154,230, 0),
+		MakeRGBA( 84,155,230, 0), MakeRGBA( 85,157,230, 0), MakeRGBA( 87,158,230, 0), MakeRGBA( 88,159,230, 0),
+		MakeRGBA( 89,161,231, 0), MakeRGBA( 90,162,231, 0), MakeRGBA( 92,164,231, 0), MakeRGBA( 93,165,232, 0),
+		MakeRGBA( 94,166,232, 0), MakeRGBA( 96,167,232, 0), MakeRGBA( 97,168,233, 0), MakeRGBA( 99,170,233, 0),
+		MakeRGBA(100,171,234, 0), MakeRGBA(102,172,234, 0), MakeRGBA(103,173,234, 0), MakeRGBA(104,175,235, 0),
+		MakeRGBA(106,176,235, 0), MakeRGBA(107,177,236, 0), MakeRGBA(109,178,236, 0), MakeRGBA(110,179,236, 0),
+		MakeRGBA(112,181,237, 0), MakeRGBA(113,182,237, 0), MakeRGBA(114,183,238, 0), MakeRGBA(116,184,238, 0),
+		MakeRGBA(117,186,239, 0), MakeRGBA(119,187,239, 0), MakeRGBA(120,188,239, 0), MakeRGBA(121,189,239, 0),
+		MakeRGBA(122,190,240, 0), MakeRGBA(124,192,240, 0), MakeRGBA(125,193,240, 0), MakeRGBA(126,194,240, 0),
+		MakeRGBA(127,195,240, 0), MakeRGBA(128,196,241, 0), MakeRGBA(130,198,241, 0), MakeRGBA(131,199,241, 0),
+		MakeRGBA(132,200,241, 0), MakeRGBA(133,201,241, 0), MakeRGBA(135,203,242, 0), MakeRGBA(136,204,242, 0),
+		MakeRGBA(137,205,242, 0), MakeRGBA(138,206,242, 0), MakeRGBA(139,207,242, 0), MakeRGBA(141,209,243, 0),
+		MakeRGBA(142,210,243, 0), MakeRGBA(143,211,243, 0), MakeRGBA(145,212,243, 0), MakeRGBA(146,213,244, 0),
+		MakeRGBA(148,214,244, 0), MakeRGBA(150,215,245, 0), MakeRGBA(151,216,245, 0), MakeRGBA(153,217,245, 0),
+		MakeRGBA(154,218,246, 0), MakeRGBA(156,219,246, 0), MakeRGBA(158,220,247, 0), MakeRGBA(159,221,247, 0),
+		MakeRGBA(161,222,248, 0), MakeRGBA(163,223,248, 0), MakeRGBA(164,224,248, 0), MakeRGBA(166,225,249, 0),
+		MakeRGBA(167,226,249, 0), MakeRGBA(169,227,250, 0), MakeRGBA(171,228,250, 0), MakeRGBA(172,229,250, 0),
+		MakeRGBA(174,230,251, 0), MakeRGBA(176,231,251, 0), MakeRGBA(178,232,251, 0), MakeRGBA(180,233,251, 0),
+		MakeRGBA(182,234,252, 0), MakeRGBA(184,235,252, 0), MakeRGBA(186,235,252, 0), MakeRGBA(188,236,252, 0),
+		MakeRGBA(190,237,253, 0), MakeRGBA(192,238,253, 0), MakeRGBA(194,239,253, 0), MakeRGBA(196,239,253, 0),
+		MakeRGBA(198,240,253, 0), MakeRGBA(200,241,254, 0), MakeRGBA(202,242,254, 0), MakeRGBA(204,243,254, 0),
+		MakeRGBA(206,243,254, 0), MakeRGBA(208,244,254, 0), MakeRGBA(210,245,255, 0), MakeRGBA(212,246,255, 0),
+		MakeRGBA(214,247,255, 0), MakeRGBA(216,247,255, 0), MakeRGBA(218,248,255, 0), MakeRGBA(220,248,255, 0),
+		MakeRGBA(222,249,255, 0), MakeRGBA(225,249,255, 0), MakeRGBA(227,249,255, 0), MakeRGBA(229,250,255, 0),
+		MakeRGBA(231,250,255, 0), MakeRGBA(233,251,255, 0), MakeRGBA(235,251,255, 0), MakeRGBA(237,251,255, 0),
+		MakeRGBA(239,252,255, 0), MakeRGBA(241,252,255, 0), MakeRGBA(243,253,255, 0), MakeRGBA(245,253,255, 0),
+		MakeRGBA(247,253,255, 0), MakeRGBA(249,254,255, 0), MakeRGBA(251,254,255, 0), MakeRGBA(253,255,255, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_PURPLE. */
-static const uint32 _recolour12[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  5, 0), MakeRGBA(  6,  0, 10, 0), MakeRGBA( 10,  0, 14, 0),
-	MakeRGBA( 13,  0, 19, 0), MakeRGBA( 16,  0, 24, 0), MakeRGBA( 19,  0, 29, 0), MakeRGBA( 22,  0, 34, 0),
-	MakeRGBA( 26,  0, 39, 0), MakeRGBA( 29,  0, 43, 0), MakeRGBA( 32,  0, 48, 0), MakeRGBA( 35,  0, 53, 0),
-	MakeRGBA( 38,  0, 58, 0), MakeRGBA( 42,  0, 63, 0), MakeRGBA( 45,  0, 68, 0), MakeRGBA( 48,  0, 72, 0),
-	MakeRGBA( 51,  0, 77, 0), MakeRGBA( 54,  0, 82, 0), MakeRGBA( 58,  0, 87, 0), MakeRGBA( 61,  0, 92, 0),
-	MakeRGBA( 63,  0, 95, 0), MakeRGBA( 64,  0, 96, 0), MakeRGBA( 64,  1, 97, 0), MakeRGBA( 65,  1, 98, 0),
-	MakeRGBA( 66,  2, 99, 0), MakeRGBA( 66,  2,100, 0), MakeRGBA( 67,  2,101, 0), MakeRGBA( 67,  3,102, 0),
-	MakeRGBA( 68,  3,103, 0), MakeRGBA( 69,  3,104, 0), MakeRGBA( 69,  4,105, 0), MakeRGBA( 70,  4,106, 0),
-	MakeRGBA( 71,  4,108, 0), MakeRGBA( 71,  5,109, 0), MakeRGBA( 72,  5,110, 0), MakeRGBA( 72,  5,111, 0),
-	MakeRGBA( 73,  6,112, 0), MakeRGBA( 74,  6,113, 0), MakeRGBA( 74,  7,114, 0), MakeRGBA( 75,  7,115, 0),
-	MakeRGBA( 75,  7,115, 0), MakeRGBA( 76,  8,116, 0), MakeRGBA( 76,  8,117, 0), MakeRGBA( 76,  8,117, 0),
-	MakeRGBA( 77,  9,118, 0), MakeRGBA( 77,  9,118, 0), MakeRGBA( 78, 10,119, 0), MakeRGBA( 78, 10,120, 0),
-	MakeRGBA( 79, 11,120, 0), MakeRGBA( 79, 11,121, 0), MakeRGBA( 79, 11,121, 0), MakeRGBA( 80, 12,122, 0),
-	MakeRGBA( 80, 12,123, 0), MakeRGBA( 81, 13,123, 0), MakeRGBA( 81, 13,124, 0), MakeRGBA( 81, 13,125, 0),
-	MakeRGBA( 82, 14,125, 0), MakeRGBA( 82, 14,126, 0), MakeRGBA( 83, 15,126, 0), MakeRGBA( 83, 15,127, 0),
-	MakeRGBA( 84, 16,128, 0), MakeRGBA( 84, 17,129, 0), MakeRGBA( 85, 17,129, 0), MakeRGBA( 85, 18,130, 0),
-	MakeRGBA( 86, 19,131, 0), MakeRGBA( 87, 20,132, 0), MakeRGBA( 87, 21,133, 0), MakeRGBA( 88, 21,133, 0),
-	MakeRGBA( 88, 22,134, 0), MakeRGBA( 89, 23,135, 0), MakeRGBA( 90, 24,136, 0), MakeRGBA( 90, 25,137, 0),
-	MakeRGBA( 91, 25,138, 0), MakeRGBA( 91, 26,138, 0), MakeRGBA( 92, 27,139, 0), MakeRGBA( 93, 28,140, 0),
-	MakeRGBA( 93, 29,141, 0), MakeRGBA( 94, 30,142, 0), MakeRGBA( 95, 30,142, 0), MakeRGBA( 95, 31,143, 0),
-	MakeRGBA( 96, 32,144, 0), MakeRGBA( 96, 32,144, 0), MakeRGBA( 97, 33,145, 0), MakeRGBA( 98, 34,146, 0),
-	MakeRGBA( 98, 34,146, 0), MakeRGBA( 99, 35,147, 0), MakeRGBA( 99, 35,147, 0), MakeRGBA(100, 36,148, 0),
-	MakeRGBA(101, 37,149, 0), MakeRGBA(101, 37,149, 0), MakeRGBA(102, 38,150, 0), MakeRGBA(102, 38,150, 0),
-	MakeRGBA(103, 39,151, 0), MakeRGBA(104, 40,152, 0), MakeRGBA(104, 40,152, 0), MakeRGBA(105, 41,153, 0),
-	MakeRGBA(106, 42,154, 0), MakeRGBA(106, 42,154, 0), MakeRGBA(107, 43,155, 0), MakeRGBA(107, 44,155, 0),
-	MakeRGBA(108, 45,156, 0), MakeRGBA(109, 46,157, 0), MakeRGBA(110, 47,158, 0), MakeRGBA(111, 48,159, 0),
-	MakeRGBA(112, 49,160, 0), MakeRGBA(112, 50,160, 0), MakeRGBA(113, 51,161, 0), MakeRGBA(114, 52,162, 0),
-	MakeRGBA(115, 53,163, 0), MakeRGBA(116, 54,164, 0), MakeRGBA(116, 55,164, 0), MakeRGBA(117, 56,165, 0),
-	MakeRGBA(118, 57,166, 0), MakeRGBA(119, 58,167, 0), MakeRGBA(120, 59,168, 0), MakeRGBA(120, 60,168, 0),
-	MakeRGBA(121, 61,169, 0), MakeRGBA(122, 62,170, 0), MakeRGBA(123, 63,171, 0), MakeRGBA(124, 64,172, 0),
-	MakeRGBA(124, 65,173, 0), MakeRGBA(125, 66,173, 0), MakeRGBA(125, 67,174, 0), MakeRGBA(126, 68,175, 0),
-	MakeRGBA(127, 69,176, 0), MakeRGBA(127, 70,177, 0), MakeRGBA(128, 71,177, 0), MakeRGBA(128, 72,178, 0),
-	MakeRGBA(129, 73,179, 0), MakeRGBA(130, 74,180, 0), MakeRGBA(130, 75,181, 0), MakeRGBA(131, 76,181, 0),
-	MakeRGBA(131, 77,182, 0), MakeRGBA(132, 78,183, 0), MakeRGBA(133, 79,184, 0), MakeRGBA(133, 80,185, 0),
-	MakeRGBA(134, 81,186, 0), MakeRGBA(134, 82,186, 0), MakeRGBA(135, 83,187, 0), MakeRGBA(136, 84,188, 0),
-	MakeRGBA(137, 85,188, 0), MakeRGBA(138, 86,189, 0), MakeRGBA(139, 87,190, 0), MakeRGBA(140, 88,190, 0),
-	MakeRGBA(141, 89,191, 0), MakeRGBA(142, 90,191, 0), MakeRGBA(143, 91,192, 0), MakeRGBA(144, 92,193, 0),
-	MakeRGBA(145, 93,193, 0), MakeRGBA(146, 94,194, 0), MakeRGBA(147, 95,194, 0), MakeRGBA(148, 96,195, 0),
-	MakeRGBA(149, 97,196, 0), MakeRGBA(150, 98,196, 0), MakeRGBA(151, 99,197, 0), MakeRGBA(152,100,197, 0),
-	MakeRGBA(153,101,198, 0), MakeRGBA(154,102,199, 0), MakeRGBA(155,104,199, 0), MakeRGBA(156,105,200, 0),
-	MakeRGBA(157,106,201, 0), MakeRGBA(158,107,202, 0), MakeRGBA(159,108,203, 0), MakeRGBA(159,110,203, 0),
-	MakeRGBA(160,111,204, 0), MakeRGBA(161,112,205, 0), MakeRGBA(162,113,206, 0), MakeRGBA(163,115,207, 0),
-	MakeRGBA(164,116,208, 0), MakeRGBA(164,117,208, 0), MakeRGBA(165,118,209, 0), MakeRGBA(166,119,210, 0),
-	MakeRGBA(167,121,211, 0), MakeRGBA(168,122,212, 0), MakeRGBA(168,123,212, 0), MakeRGBA(169,124,213, 0),
-	MakeRGBA(170,125,214, 0), MakeRGBA(171,127,215, 0), MakeRGBA(172,128,216, 0), MakeRGBA(173,130,216, 0),
-	MakeRGBA(174,131,217, 0), MakeRGBA(175,132,218, 0), MakeRGBA(176,134,219, 0), MakeRGBA(177,135,220, 0),
-	MakeRGBA(178,137,221, 0), MakeRGBA(179,138,221, 0), MakeRGBA(180,139,222, 0), MakeRGBA(181,141,223, 0),
-	MakeRGBA(182,142,224, 0), MakeRGBA(183,144,225, 0), MakeRGBA(184,145,225, 0), MakeRGBA(185,147,226, 0),
-	MakeRGBA(186,148,227, 0), MakeRGBA(187,149,228, 0), MakeRGBA(188,151,229, 0), MakeRGBA(189,152,229, 0),
-	MakeRGBA(190,154,230, 0), MakeRGBA(191,155,231, 0), MakeRGBA(192,157,232, 0), MakeRGBA(194,159,232, 0),
-	MakeRGBA(195,161,233, 0), MakeRGBA(196,163,233, 0), MakeRGBA(197,165,234, 0), MakeRGBA(198,167,235, 0),
-	MakeRGBA(200,169,235, 0), MakeRGBA(201,171,236, 0), MakeRGBA(202,173,237, 0), MakeRGBA(203,175,237, 0),
-	MakeRGBA(205,177,238, 0), MakeRGBA(206,180,238, 0), MakeRGBA(207,182,239, 0), MakeRGBA(208,184,240, 0),
-	MakeRGBA(209,186,240, 0), MakeRGBA(211,188,241, 0), MakeRGBA(212,190,241, 0), MakeRGBA(213,192,242, 0),
-	MakeRGBA(214,194,243, 0), MakeRGBA(216,196,243, 0), MakeRGBA(217,198,244, 0), MakeRGBA(218,200,244, 0),
-	MakeRGBA(220,202,245, 0), MakeRGBA(221,204,246, 0), MakeRGBA(223,206,246, 0), MakeRGBA(224,208,247, 0),
-	MakeRGBA(225,210,247, 0), MakeRGBA(227,212,248, 0), MakeRGBA(228,214,249, 0), MakeRGBA(230,216,249, 0),
-	MakeRGBA(231,218,250, 0), MakeRGBA(233,220,251, 0), MakeRGBA(234,222,251, 0), MakeRGBA(235,224,252, 0),
-	MakeRGBA(237,226,252, 0), MakeRGBA(238,228,253, 0), MakeRGBA(240,230,254, 0), MakeRGBA(241,232,254, 0),
-	MakeRGBA(243,234,255, 0), MakeRGBA(243,236,255, 0), MakeRGBA(244,237,255, 0), MakeRGBA(245,238,255, 0),
-	MakeRGBA(245,239,255, 0), MakeRGBA(246,240,255, 0), MakeRGBA(246,241,255, 0), MakeRGBA(247,242,255, 0),
-	MakeRGBA(248,243,255, 0), MakeRGBA(248,244,255, 0), MakeRGBA(249,245,255, 0), MakeRGBA(250,246,255, 0),
-	MakeRGBA(250,247,255, 0), MakeRGBA(251,248,255, 0), MakeRGBA(251,249,255, 0), MakeRGBA(252,250,255, 0),
-	MakeRGBA(253,251,255, 0), MakeRGBA(253,252,255, 0), MakeRGBA(254,253,255, 0), MakeRGBA(254,254,255, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_DARK_JADE_GREEN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  1,  2,  1, 0), MakeRGBA(  1,  4,  2, 0), MakeRGBA(  2,  7,  2, 0),
+		MakeRGBA(  2,  9,  3, 0), MakeRGBA(  3, 11,  4, 0), MakeRGBA(  3, 13,  5, 0), MakeRGBA(  4, 15,  5, 0),
+		MakeRGBA(  4, 17,  6, 0), MakeRGBA(  5, 20,  7, 0), MakeRGBA(  6, 22,  8, 0), MakeRGBA(  6, 24,  8, 0),
+		MakeRGBA(  7, 26,  9, 0), MakeRGBA(  7, 28, 10, 0), MakeRGBA(  8, 31, 11, 0), MakeRGBA(  8, 33, 11, 0),
+		MakeRGBA(  9, 35, 12, 0), MakeRGBA(  9, 37, 13, 0), MakeRGBA( 10, 39, 14, 0), MakeRGBA( 11, 41, 14, 0),
+		MakeRGBA( 11, 43, 15, 0), MakeRGBA( 11, 44, 16, 0), MakeRGBA( 11, 44, 16, 0), MakeRGBA( 12, 45, 16, 0),
+		MakeRGBA( 12, 46, 17, 0), MakeRGBA( 12, 46, 17, 0), MakeRGBA( 12, 47, 18, 0), MakeRGBA( 12, 47, 18, 0),
+		MakeRGBA( 13, 48, 18, 0), MakeRGBA( 13, 49, 19, 0), MakeRGBA( 13, 49, 19, 0), MakeRGBA( 13, 50, 20, 0),
+		MakeRGBA( 14, 51, 20, 0), MakeRGBA( 14, 51, 20, 0), MakeRGBA( 14, 52, 21, 0), MakeRGBA( 14, 52, 21, 0),
+		MakeRGBA( 14, 53, 22, 0), MakeRGBA( 15, 54, 22, 0), MakeRGBA( 15, 54, 22, 0), MakeRGBA( 15, 55, 23, 0),
+		MakeRGBA( 15, 56, 23, 0), MakeRGBA( 16, 56, 24, 0), MakeRGBA( 16, 57, 24, 0), MakeRGBA( 16, 58, 24, 0),
+		MakeRGBA( 17, 59, 25, 0), MakeRGBA( 17, 60, 25, 0), MakeRGBA( 18, 60, 26, 0), MakeRGBA( 18, 61, 26, 0),
+		MakeRGBA( 19, 62, 27, 0), MakeRGBA( 19, 63, 27, 0), MakeRGBA( 19, 64, 27, 0), MakeRGBA( 20, 64, 28, 0),
+		MakeRGBA( 20, 65, 28, 0), MakeRGBA( 21, 66, 29, 0), MakeRGBA( 21, 67, 29, 0), MakeRGBA( 21, 68, 29, 0),
+		MakeRGBA( 22, 69, 30, 0), MakeRGBA( 22, 69, 30, 0), MakeRGBA( 23, 70, 31, 0), MakeRGBA( 23, 71, 31, 0),
+		MakeRGBA( 24, 72, 32, 0), MakeRGBA( 24, 72, 32, 0), MakeRGBA( 25, 73, 33, 0), MakeRGBA( 25, 73, 33, 0),
+		MakeRGBA( 26, 74, 34, 0), MakeRGBA( 27, 75, 35, 0), MakeRGBA( 27, 75, 35, 0), MakeRGBA( 28, 76, 36, 0),
+		MakeRGBA( 28, 76, 36, 0), MakeRGBA( 29, 77, 37, 0), MakeRGBA( 30, 78, 38, 0), MakeRGBA( 30, 78, 38, 0),
+		MakeRGBA( 31, 79, 39, 0), MakeRGBA( 31, 79, 39, 0), MakeRGBA( 32, 80, 40, 0), MakeRGBA( 33, 81, 41, 0),
+		MakeRGBA( 33, 81, 41, 0), MakeRGBA( 34, 82, 42, 0), MakeRGBA( 35, 83, 43, 0), MakeRGBA( 35, 83, 43, 0),
+		MakeRGBA( 36, 84, 44, 0), MakeRGBA( 36, 85, 45, 0), MakeRGBA( 37, 86, 46, 0), MakeRGBA( 38, 86, 46, 0),
+		MakeRGBA( 38, 87, 47, 0), MakeRGBA( 39, 88, 48, 0), MakeRGBA( 39, 89, 49, 0), MakeRGBA( 40, 90, 50, 0),
+		MakeRGBA( 41, 91, 51, 0), MakeRGBA( 41, 91, 51, 0), MakeRGBA( 42, 92, 52, 0), MakeRGBA( 42, 93, 53, 0),
+		MakeRGBA( 43, 94, 54, 0), MakeRGBA( 44, 95, 55, 0), MakeRGBA( 44, 95, 55, 0), MakeRGBA( 45, 96, 56, 0),
+		MakeRGBA( 46, 97, 57, 0), MakeRGBA( 46, 98, 58, 0), MakeRGBA( 47, 99, 59, 0), MakeRGBA( 47, 99, 59, 0),
+		MakeRGBA( 48,100, 60, 0), MakeRGBA( 49,101, 61, 0), MakeRGBA( 49,102, 62, 0), MakeRGBA( 50,103, 63, 0),
+		MakeRGBA( 50,104, 63, 0), MakeRGBA( 51,104, 64, 0), MakeRGBA( 52,105, 65, 0), MakeRGBA( 52,106, 66, 0),
+		MakeRGBA( 53,107, 67, 0), MakeRGBA( 53,108, 68, 0), MakeRGBA( 54,108, 68, 0), MakeRGBA( 55,109, 69, 0),
+		MakeRGBA( 55,110, 70, 0), MakeRGBA( 56,111, 71, 0), MakeRGBA( 56,112, 72, 0), MakeRGBA( 57,112, 72, 0),
+		MakeRGBA( 58,113, 73, 0), MakeRGBA( 58,114, 74, 0), MakeRGBA( 59,115, 75, 0), MakeRGBA( 60,116, 76, 0),
+		MakeRGBA( 61,117, 77, 0), MakeRGBA( 62,118, 78, 0), MakeRGBA( 63,119, 79, 0), MakeRGBA( 64,120, 80, 0),
+		MakeRGBA( 65,121, 81, 0), MakeRGBA( 66,122, 82, 0), MakeRGBA( 67,123, 83, 0), MakeRGBA( 68,124, 84, 0),
+		MakeRGBA( 69,125, 85, 0), MakeRGBA( 70,126, 86, 0), MakeRGBA( 71,127, 87, 0), MakeRGBA( 72,128, 88, 0),
+		MakeRGBA( 73,129, 89, 0), MakeRGBA( 74,130, 90, 0), MakeRGBA( 75,131, 91, 0), MakeRGBA( 76,132, 92, 0),
+		MakeRGBA( 77,133, 93, 0), MakeRGBA( 78,134, 94, 0), MakeRGBA( 79,135, 95, 0), MakeRGBA( 80,136, 96, 0),
+		MakeRGBA( 81,137, 98, 0), MakeRGBA( 82,138, 99, 0), MakeRGBA( 83,139,100, 0), MakeRGBA( 84,140,101, 0),
+		MakeRGBA( 85,141,102, 0), MakeRGBA( 86,142,104, 0), MakeRGBA( 87,143,105, 0), MakeRGBA( 88,144,106, 0),
+		MakeRGBA( 89,145,107, 0), MakeRGBA( 90,146,109, 0), MakeRGBA( 91,147,110, 0), MakeRGBA( 92,148,111, 0),
+		MakeRGBA( 93,149,112, 0), MakeRGBA( 94,150,113, 0), MakeRGBA( 95,151,115, 0), MakeRGBA( 96,152,116, 0),
+		MakeRGBA( 97,153,117, 0), MakeRGBA( 98,154,118, 0), MakeRGBA(100,155,119, 0), MakeRGBA(101,156,120, 0),
+		MakeRGBA(102,158,121, 0), MakeRGBA(103,159,123, 0), MakeRGBA(104,160,124, 0), MakeRGBA(106,161,125, 0),
+		MakeRGBA(107,162,126, 0), MakeRGBA(108,163,127, 0), MakeRGBA(109,164,128, 0), MakeRGBA(111,165,129, 0),
+		MakeRGBA(112,166,130, 0), MakeRGBA(113,167,131, 0), MakeRGBA(114,168,132, 0), MakeRGBA(115,169,133, 0),
+		MakeRGBA(117,170,134, 0), MakeRGBA(118,171,135, 0), MakeRGBA(119,172,136, 0), MakeRGBA(120,173,137, 0),
+		MakeRGBA(121,174,138, 0), MakeRGBA(123,175,139, 0), MakeRGBA(124,176,140, 0), MakeRGBA(125,177,142, 0),
+		MakeRGBA(126,178,143, 0), MakeRGBA(128,180,144, 0), MakeRGBA(129,181,146, 0), MakeRGBA(130,182,147, 0),
+		MakeRGBA(131,183,149, 0), MakeRGBA(132,184,150, 0), MakeRGBA(134,186,151, 0), MakeRGBA(135,187,153, 0),
+		MakeRGBA(136,188,154, 0), MakeRGBA(137,189,156, 0), MakeRGBA(139,191,157, 0), MakeRGBA(140,192,159, 0),
+		MakeRGBA(141,193,160, 0), MakeRGBA(142,194,161, 0), MakeRGBA(143,195,163, 0), MakeRGBA(145,197,164, 0),
+		MakeRGBA(146,198,166, 0), MakeRGBA(147,199,167, 0), MakeRGBA(149,200,169, 0), MakeRGBA(150,201,170, 0),
+		MakeRGBA(151,202,171, 0), MakeRGBA(153,203,173, 0), MakeRGBA(154,204,174, 0), MakeRGBA(156,205,176, 0),
+		MakeRGBA(157,206,177, 0), MakeRGBA(158,207,178, 0), MakeRGBA(160,208,180, 0), MakeRGBA(161,209,181, 0),
+		MakeRGBA(163,210,183, 0), MakeRGBA(164,211,184, 0), MakeRGBA(166,212,186, 0), MakeRGBA(167,213,187, 0),
+		MakeRGBA(168,214,188, 0), MakeRGBA(170,215,190, 0), MakeRGBA(171,216,191, 0), MakeRGBA(173,217,193, 0),
+		MakeRGBA(174,218,194, 0), MakeRGBA(176,219,196, 0), MakeRGBA(177,221,197, 0), MakeRGBA(179,222,198, 0),
+		MakeRGBA(180,223,200, 0), MakeRGBA(182,224,201, 0), MakeRGBA(184,226,203, 0), MakeRGBA(185,227,204, 0),
+		MakeRGBA(187,228,205, 0), MakeRGBA(189,229,207, 0), MakeRGBA(190,230,208, 0), MakeRGBA(192,232,210, 0),
+		MakeRGBA(193,233,211, 0), MakeRGBA(195,234,213, 0), MakeRGBA(197,235,214, 0), MakeRGBA(198,237,215, 0),
+		MakeRGBA(200,238,217, 0), MakeRGBA(202,239,218, 0), MakeRGBA(203,240,220, 0), MakeRGBA(205,241,221, 0),
+		MakeRGBA(206,243,223, 0), MakeRGBA(209,243,224, 0), MakeRGBA(211,244,226, 0), MakeRGBA(214,245,227, 0),
+		MakeRGBA(216,245,229, 0), MakeRGBA(218,246,231, 0), MakeRGBA(221,246,232, 0), MakeRGBA(223,247,234, 0),
+		MakeRGBA(226,248,235, 0), MakeRGBA(228,248,237, 0), MakeRGBA(231,249,239, 0), MakeRGBA(233,250,240, 0),
+		MakeRGBA(235,250,242, 0), MakeRGBA(238,251,244, 0), MakeRGBA(240,251,245, 0), MakeRGBA(243,252,247, 0),
+		MakeRGBA(245,253,248, 0), MakeRGBA(248,253,250, 0), MakeRGBA(250,254,252, 0), MakeRGBA(253,254,253, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_RED. */
-static const uint32 _recolour13[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  0, 0), MakeRGBA(  6,  0,  0, 0), MakeRGBA( 10,  0,  0, 0),
-	MakeRGBA( 13,  0,  0, 0), MakeRGBA( 16,  0,  0, 0), MakeRGBA( 19,  0,  0, 0), MakeRGBA( 22,  0,  0, 0),
-	MakeRGBA( 26,  0,  0, 0), MakeRGBA( 29,  0,  0, 0), MakeRGBA( 32,  0,  0, 0), MakeRGBA( 35,  0,  0, 0),
-	MakeRGBA( 38,  0,  0, 0), MakeRGBA( 42,  0,  0, 0), MakeRGBA( 45,  0,  0, 0), MakeRGBA( 48,  0,  0, 0),
-	MakeRGBA( 51,  0,  0, 0), MakeRGBA( 54,  0,  0, 0), MakeRGBA( 58,  0,  0, 0), MakeRGBA( 61,  0,  0, 0),
-	MakeRGBA( 63,  0,  0, 0), MakeRGBA( 65,  0,  0, 0), MakeRGBA( 66,  0,  0, 0), MakeRGBA( 67,  0,  0, 0),
-	MakeRGBA( 68,  0,  0, 0), MakeRGBA( 69,  0,  0, 0), MakeRGBA( 71,  0,  0, 0), MakeRGBA( 72,  0,  0, 0),
-	MakeRGBA( 73,  0,  0, 0), MakeRGBA( 74,  0,  0, 0), MakeRGBA( 76,  0,  0, 0), MakeRGBA( 77,  0,  0, 0),
-	MakeRGBA( 78,  0,  0, 0), MakeRGBA( 79,  0,  0, 0), MakeRGBA( 80,  0,  0, 0), MakeRGBA( 82,  0,  0, 0),
-	MakeRGBA( 83,  0,  0, 0), MakeRGBA( 84,  0,  0, 0), MakeRGBA( 85,  0,  0, 0), MakeRGBA( 87,  0,  0, 0),
-	MakeRGBA( 88,  0,  0, 0), MakeRGBA( 89,  0,  0, 0), MakeRGBA( 91,  0,  0, 0), MakeRGBA( 92,  0,  0, 0),
-	MakeRGBA( 94,  0,  0, 0), MakeRGBA( 95,  0,  0, 0), MakeRGBA( 96,  0,  0, 0), MakeRGBA( 98,  0,  0, 0),
-	MakeRGBA( 99,  0,  0, 0), MakeRGBA(101,  0,  0, 0), MakeRGBA(102,  0,  0, 0), MakeRGBA(104,  0,  0, 0),
-	MakeRGBA(105,  0,  0, 0), MakeRGBA(106,  0,  0, 0), MakeRGBA(108,  0,  0, 0), MakeRGBA(109,  0,  0, 0),
-	MakeRGBA(111,  0,  0, 0), MakeRGBA(112,  0,  0, 0), MakeRGBA(113,  0,  0, 0), MakeRGBA(115,  0,  0, 0),
-	MakeRGBA(116,  0,  0, 0), MakeRGBA(118,  0,  0, 0), MakeRGBA(119,  0,  0, 0), MakeRGBA(121,  0,  0, 0),
-	MakeRGBA(122,  0,  0, 0), MakeRGBA(123,  0,  0, 0), MakeRGBA(125,  0,  0, 0), MakeRGBA(126,  0,  0, 0),
-	MakeRGBA(128,  0,  0, 0), MakeRGBA(129,  0,  0, 0), MakeRGBA(131,  0,  0, 0), MakeRGBA(132,  0,  0, 0),
-	MakeRGBA(133,  0,  0, 0), MakeRGBA(135,  0,  0, 0), MakeRGBA(136,  0,  0, 0), MakeRGBA(138,  0,  0, 0),
-	MakeRGBA(139,  0,  0, 0), MakeRGBA(140,  0,  0, 0), MakeRGBA(142,  0,  0, 0), MakeRGBA(143,  0,  0, 0),
-	MakeRGBA(145,  0,  0, 0), MakeRGBA(146,  0,  0, 0), MakeRGBA(148,  0,  0, 0), MakeRGBA(149,  0,  0, 0),
-	MakeRGBA(150,  0,  0, 0), MakeRGBA(152,  0,  0, 0), MakeRGBA(153,  0,  0, 0), MakeRGBA(155,  0,  0, 0),
-	MakeRGBA(156,  0,  0, 0), MakeRGBA(158,  0,  0, 0), MakeRGBA(159,  0,  0, 0), MakeRGBA(160,  0,  0, 0),
-	MakeRGBA(162,  0,  0, 0), MakeRGBA(163,  0,  0, 0), MakeRGBA(165,  0,  0, 0), MakeRGBA(166,  0,  0, 0),
-	MakeRGBA(168,  0,  0, 0), MakeRGBA(169,  0,  0, 0), MakeRGBA(170,  0,  0, 0), MakeRGBA(172,  0,  0, 0),
-	MakeRGBA(173,  0,  0, 0), MakeRGBA(175,  0,  0, 0), MakeRGBA(176,  0,  0, 0), MakeRGBA(177,  0,  0, 0),
-	MakeRGBA(179,  0,  0, 0), MakeRGBA(180,  0,  0, 0), MakeRGBA(182,  0,  0, 0), MakeRGBA(183,  0,  0, 0),
-	MakeRGBA(185,  0,  0, 0), MakeRGBA(186,  0,  0, 0), MakeRGBA(187,  0,  0, 0), MakeRGBA(189,  0,  0, 0),
-	MakeRGBA(190,  0,  0, 0), MakeRGBA(192,  0,  0, 0), MakeRGBA(193,  0,  0, 0), MakeRGBA(195,  0,  0, 0),
-	MakeRGBA(196,  0,  0, 0), MakeRGBA(197,  0,  0, 0), MakeRGBA(199,  0,  0, 0), MakeRGBA(200,  0,  0, 0),
-	MakeRGBA(202,  1,  0, 0), MakeRGBA(203,  1,  0, 0), MakeRGBA(204,  1,  0, 0), MakeRGBA(206,  2,  0, 0),
-	MakeRGBA(207,  2,  0, 0), MakeRGBA(209,  2,  0, 0), MakeRGBA(210,  3,  0, 0), MakeRGBA(212,  3,  0, 0),
-	MakeRGBA(213,  3,  0, 0), MakeRGBA(214,  4,  0, 0), MakeRGBA(216,  4,  0, 0), MakeRGBA(217,  5,  0, 0),
-	MakeRGBA(219,  5,  0, 0), MakeRGBA(220,  5,  0, 0), MakeRGBA(222,  6,  0, 0), MakeRGBA(223,  6,  0, 0),
-	MakeRGBA(224,  6,  0, 0), MakeRGBA(226,  7,  0, 0), MakeRGBA(227,  7,  0, 0), MakeRGBA(229,  7,  0, 0),
-	MakeRGBA(230,  7,  0, 0), MakeRGBA(231,  7,  0, 0), MakeRGBA(233,  7,  0, 0), MakeRGBA(234,  7,  0, 0),
-	MakeRGBA(236,  7,  0, 0), MakeRGBA(237,  7,  0, 0), MakeRGBA(239,  7,  0, 0), MakeRGBA(240,  7,  0, 0),
-	MakeRGBA(241,  7,  0, 0), MakeRGBA(243,  7,  0, 0), MakeRGBA(244,  7,  0, 0), MakeRGBA(246,  7,  0, 0),
-	MakeRGBA(247,  7,  0, 0), MakeRGBA(249,  7,  0, 0), MakeRGBA(250,  7,  0, 0), MakeRGBA(251,  7,  0, 0),
-	MakeRGBA(253,  7,  0, 0), MakeRGBA(254,  7,  0, 0), MakeRGBA(255,  9,  2, 0), MakeRGBA(255, 12,  5, 0),
-	MakeRGBA(255, 16,  8, 0), MakeRGBA(255, 20, 12, 0), MakeRGBA(255, 23, 15, 0), MakeRGBA(255, 27, 19, 0),
-	MakeRGBA(255, 31, 22, 0), MakeRGBA(255, 34, 25, 0), MakeRGBA(255, 38, 29, 0), MakeRGBA(255, 42, 32, 0),
-	MakeRGBA(255, 45, 36, 0), MakeRGBA(255, 49, 39, 0), MakeRGBA(255, 53, 42, 0), MakeRGBA(255, 56, 46, 0),
-	MakeRGBA(255, 60, 49, 0), MakeRGBA(255, 64, 53, 0), MakeRGBA(255, 67, 56, 0), MakeRGBA(255, 71, 59, 0),
-	MakeRGBA(255, 74, 63, 0), MakeRGBA(255, 78, 66, 0), MakeRGBA(255, 81, 69, 0), MakeRGBA(255, 83, 71, 0),
-	MakeRGBA(255, 85, 74, 0), MakeRGBA(255, 87, 76, 0), MakeRGBA(255, 90, 79, 0), MakeRGBA(255, 92, 81, 0),
-	MakeRGBA(255, 94, 84, 0), MakeRGBA(255, 96, 86, 0), MakeRGBA(255, 99, 88, 0), MakeRGBA(255,101, 91, 0),
-	MakeRGBA(255,103, 93, 0), MakeRGBA(255,105, 96, 0), MakeRGBA(255,108, 98, 0), MakeRGBA(255,110,101, 0),
-	MakeRGBA(255,112,103, 0), MakeRGBA(255,114,105, 0), MakeRGBA(255,116,108, 0), MakeRGBA(255,119,110, 0),
-	MakeRGBA(255,121,113, 0), MakeRGBA(255,123,115, 0), MakeRGBA(255,126,118, 0), MakeRGBA(255,128,120, 0),
-	MakeRGBA(255,130,122, 0), MakeRGBA(255,133,125, 0), MakeRGBA(255,135,127, 0), MakeRGBA(255,138,130, 0),
-	MakeRGBA(255,140,132, 0), MakeRGBA(255,143,135, 0), MakeRGBA(255,145,137, 0), MakeRGBA(255,148,140, 0),
-	MakeRGBA(255,150,142, 0), MakeRGBA(255,152,144, 0), MakeRGBA(255,155,147, 0), MakeRGBA(255,157,149, 0),
-	MakeRGBA(255,160,152, 0), MakeRGBA(255,162,154, 0), MakeRGBA(255,165,157, 0), MakeRGBA(255,167,159, 0),
-	MakeRGBA(255,169,161, 0), MakeRGBA(255,172,164, 0), MakeRGBA(255,174,167, 0), MakeRGBA(255,177,169, 0),
-	MakeRGBA(255,179,172, 0), MakeRGBA(255,182,175, 0), MakeRGBA(255,184,177, 0), MakeRGBA(255,187,180, 0),
-	MakeRGBA(255,189,182, 0), MakeRGBA(255,191,185, 0), MakeRGBA(255,194,188, 0), MakeRGBA(255,196,190, 0),
-	MakeRGBA(255,199,193, 0), MakeRGBA(255,201,196, 0), MakeRGBA(255,204,198, 0), MakeRGBA(255,206,201, 0),
-	MakeRGBA(255,208,204, 0), MakeRGBA(255,211,206, 0), MakeRGBA(255,213,209, 0), MakeRGBA(255,216,212, 0),
-	MakeRGBA(255,218,214, 0), MakeRGBA(255,220,216, 0), MakeRGBA(255,222,218, 0), MakeRGBA(255,224,220, 0),
-	MakeRGBA(255,226,222, 0), MakeRGBA(255,228,225, 0), MakeRGBA(255,229,227, 0), MakeRGBA(255,231,229, 0),
-	MakeRGBA(255,233,231, 0), MakeRGBA(255,235,233, 0), MakeRGBA(255,237,235, 0), MakeRGBA(255,239,237, 0),
-	MakeRGBA(255,240,239, 0), MakeRGBA(255,242,241, 0), MakeRGBA(255,244,243, 0), MakeRGBA(255,246,245, 0),
-	MakeRGBA(255,248,247, 0), MakeRGBA(255,250,249, 0), MakeRGBA(255,251,251, 0), MakeRGBA(255,253,253, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_PURPLE. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  5, 0), MakeRGBA(  6,  0, 10, 0), MakeRGBA( 10,  0, 14, 0),
+		MakeRGBA( 13,  0, 19, 0), MakeRGBA( 16,  0, 24, 0), MakeRGBA( 19,  0, 29, 0), MakeRGBA( 22,  0, 34, 0),
+		MakeRGBA( 26,  0, 39, 0), MakeRGBA( 29,  0, 43, 0), MakeRGBA( 32,  0, 48, 0), MakeRGBA( 35,  0, 53, 0),
+		MakeRGBA( 38,  0, 58, 0), MakeRGBA( 42,  0, 63, 0), MakeRGBA( 45,  0, 68, 0), MakeRGBA( 48,  0, 72, 0),
+		MakeRGBA( 51,  0, 77, 0), MakeRGBA( 54,  0, 82, 0), MakeRGBA( 58,  0, 87, 0), MakeRGBA( 61,  0, 92, 0),
+		MakeRGBA( 63,  0, 95, 0), MakeRGBA( 64,  0, 96, 0), MakeRGBA( 64,  1, 97, 0), MakeRGBA( 65,  1, 98, 0),
+		MakeRGBA( 66,  2, 99, 0), MakeRGBA( 66,  2,100, 0), MakeRGBA( 67,  2,101, 0), MakeRGBA( 67,  3,102, 0),
+		MakeRGBA( 68,  3,103, 0), MakeRGBA( 69,  3,104, 0), MakeRGBA( 69,  4,105, 0), MakeRGBA( 70,  4,106, 0),
+		MakeRGBA( 71,  4,108, 0), MakeRGBA( 71,  5,109, 0), MakeRGBA( 72,  5,110, 0), MakeRGBA( 72,  5,111, 0),
+		MakeRGBA( 73,  6,112, 0), MakeRGBA( 74,  6,113, 0), MakeRGBA( 74,  7,114, 0), MakeRGBA( 75,  7,115, 0),
+		MakeRGBA( 75,  7,115, 0), MakeRGBA( 76,  8,116, 0), MakeRGBA( 76,  8,117, 0), MakeRGBA( 76,  8,117, 0),
+		MakeRGBA( 77,  9,118, 0), MakeRGBA( 77,  9,118, 0), MakeRGBA( 78, 10,119, 0), MakeRGBA( 78, 10,120, 0),
+		MakeRGBA( 79, 11,120, 0), MakeRGBA( 79, 11,121, 0), MakeRGBA( 79, 11,121, 0), MakeRGBA( 80, 12,122, 0),
+		MakeRGBA( 80, 12,123, 0), MakeRGBA( 81, 13,123, 0), MakeRGBA( 81, 13,124, 0), MakeRGBA( 81, 13,125, 0),
+		MakeRGBA( 82, 14,125, 0), MakeRGBA( 82, 14,126, 0), MakeRGBA( 83, 15,126, 0), MakeRGBA( 83, 15,127, 0),
+		MakeRGBA( 84, 16,128, 0), MakeRGBA( 84, 17,129, 0), MakeRGBA( 85, 17,129, 0), MakeRGBA( 85, 18,130, 0),
+		MakeRGBA( 86, 19,131, 0), MakeRGBA( 87, 20,132, 0), MakeRGBA( 87, 21,133, 0), MakeRGBA( 88, 21,133, 0),
+		MakeRGBA( 88, 22,134, 0), MakeRGBA( 89, 23,135, 0), MakeRGBA( 90, 24,136, 0), MakeRGBA( 90, 25,137, 0),
+		MakeRGBA( 91, 25,138, 0), MakeRGBA( 91, 26,138, 0), MakeRGBA( 92, 27,139, 0), MakeRGBA( 93, 28,140, 0),
+		MakeRGBA( 93, 29,141, 0), MakeRGBA( 94, 30,142, 0), MakeRGBA( 95, 30,142, 0), MakeRGBA( 95, 31,143, 0),
+		MakeRGBA( 96, 32,144, 0), MakeRGBA( 96, 32,144, 0), MakeRGBA( 97, 33,145, 0), MakeRGBA( 98, 34,146, 0),
+		MakeRGBA( 98, 34,146, 0), MakeRGBA( 99, 35,147, 0), MakeRGBA( 99, 35,147, 0), MakeRGBA(100, 36,148, 0),
+		MakeRGBA(101, 37,149, 0), MakeRGBA(101, 37,149, 0), MakeRGBA(102, 38,150, 0), MakeRGBA(102, 38,150, 0),
+		MakeRGBA(103, 39,151, 0), MakeRGBA(104, 40,152, 0), MakeRGBA(104, 40,152, 0), MakeRGBA(105, 41,153, 0),
+		MakeRGBA(106, 42,154, 0), MakeRGBA(106, 42,154, 0), MakeRGBA(107, 43,155, 0), MakeRGBA(107, 44,155, 0),
+		MakeRGBA(108, 45,156, 0), MakeRGBA(109, 46,157, 0), MakeRGBA(110, 47,158, 0), MakeRGBA(111, 48,159, 0),
+		MakeRGBA(112, 49,160, 0), MakeRGBA(112, 50,160, 0), MakeRGBA(113, 51,161, 0), MakeRGBA(114, 52,162, 0),
+		MakeRGBA(115, 53,163, 0), MakeRGBA(116, 54,164, 0), MakeRGBA(116, 55,164, 0), MakeRGBA(117, 56,165, 0),
+		MakeRGBA(118, 57,166, 0), MakeRGBA(119, 58,167, 0), MakeRGBA(120, 59,168, 0), MakeRGBA(120, 60,168, 0),
+		MakeRGBA(121, 61,169, 0), MakeRGBA(122, 62,170, 0), MakeRGBA(123, 63,171, 0), MakeRGBA(124, 64,172, 0),
+		MakeRGBA(124, 65,173, 0), MakeRGBA(125, 66,173, 0), MakeRGBA(125, 67,174, 0), MakeRGBA(126, 68,175, 0),
+		MakeRGBA(127, 69,176, 0), MakeRGBA(127, 70,177, 0), MakeRGBA(128, 71,177, 0), MakeRGBA(128, 72,178, 0),
+		MakeRGBA(129, 73,179, 0), MakeRGBA(130, 74,180, 0), MakeRGBA(130, 75,181, 0), MakeRGBA(131, 76,181, 0),
+		MakeRGBA(131, 77,182, 0), MakeRGBA(132, 78,183, 0), MakeRGBA(133, 79,184, 0), MakeRGBA(133, 80,185, 0),
+		MakeRGBA(134, 81,186, 0), MakeRGBA(134, 82,186, 0), MakeRGBA(135, 83,187, 0), MakeRGBA(136, 84,188, 0),
+		MakeRGBA(137, 85,188, 0), MakeRGBA(138, 86,189, 0), MakeRGBA(139, 87,190, 0), MakeRGBA(140, 88,190, 0),
+		MakeRGBA(141, 89,191, 0), MakeRGBA(142, 90,191, 0), MakeRGBA(143, 91,192, 0), MakeRGBA(144, 92,193, 0),
+		MakeRGBA(145, 93,193, 0), MakeRGBA(146, 94,194, 0), MakeRGBA(147, 95,194, 0), MakeRGBA(148, 96,195, 0),
+		MakeRGBA(149, 97,196, 0), MakeRGBA(150, 98,196, 0), MakeRGBA(151, 99,197, 0), MakeRGBA(152,100,197, 0),
+		MakeRGBA(153,101,198, 0), MakeRGBA(154,102,199, 0), MakeRGBA(155,104,199, 0), MakeRGBA(156,105,200, 0),
+		MakeRGBA(157,106,201, 0), MakeRGBA(158,107,202, 0), MakeRGBA(159,108,203, 0), MakeRGBA(159,110,203, 0),
+		MakeRGBA(160,111,204, 0), MakeRGBA(161,112,205, 0), MakeRGBA(162,113,206, 0), MakeRGBA(163,115,207, 0),
+		MakeRGBA(164,116,208, 0), MakeRGBA(164,117,208, 0), MakeRGBA(165,118,209, 0), MakeRGBA(166,119,210, 0),
+		MakeRGBA(167,121,211, 0), MakeRGBA(168,122,212, 0), MakeRGBA(168,123,212, 0), MakeRGBA(169,124,213, 0),
+		MakeRGBA(170,125,214, 0), MakeRGBA(171,127,215, 0), MakeRGBA(172,128,216, 0), MakeRGBA(173,130,216, 0),
+		MakeRGBA(174,131,217, 0), MakeRGBA(175,132,218, 0), MakeRGBA(176,134,219, 0), MakeRGBA(177,135,220, 0),
+		MakeRGBA(178,137,221, 0), MakeRGBA(179,138,221, 0), MakeRGBA(180,139,222, 0), MakeRGBA(181,141,223, 0),
+		MakeRGBA(182,142,224, 0), MakeRGBA(183,144,225, 0), MakeRGBA(184,145,225, 0), MakeRGBA(185,147,226, 0),
+		MakeRGBA(186,148,227, 0), MakeRGBA(187,149,228, 0), MakeRGBA(188,151,229, 0), MakeRGBA(189,152,229, 0),
+		MakeRGBA(190,154,230, 0), MakeRGBA(191,155,231, 0), MakeRGBA(192,157,232, 0), MakeRGBA(194,159,232, 0),
+		MakeRGBA(195,161,233, 0), MakeRGBA(196,163,233, 0), MakeRGBA(197,165,234, 0), MakeRGBA(198,167,235, 0),
+		MakeRGBA(200,169,235, 0), MakeRGBA(201,171,236, 0), MakeRGBA(202,173,237, 0), MakeRGBA(203,175,237, 0),
+		MakeRGBA(205,177,238, 0), MakeRGBA(206,180,238, 0), MakeRGBA(207,182,239, 0), MakeRGBA(208,184,240, 0),
+		MakeRGBA(209,186,240, 0), MakeRGBA(211,188,241, 0), MakeRGBA(212,190,241, 0), MakeRGBA(213,192,242, 0),
+		MakeRGBA(214,194,243, 0), MakeRGBA(216,196,243, 0), MakeRGBA(217,198,244, 0), MakeRGBA(218,200,244, 0),
+		MakeRGBA(220,202,245, 0), MakeRGBA(221,204,246, 0), MakeRGBA(223,206,246, 0), MakeRGBA(224,208,247, 0),
+		MakeRGBA(225,210,247, 0), MakeRGBA(227,212,248, 0), MakeRGBA(228,214,249, 0), MakeRGBA(230,216,249, 0),
+		MakeRGBA(231,218,250, 0), MakeRGBA(233,220,251, 0), MakeRGBA(234,222,251, 0), MakeRGBA(235,224,252, 0),
+		MakeRGBA(237,226,252, 0), MakeRGBA(238,228,253, 0), MakeRGBA(240,230,254, 0), MakeRGBA(241,232,254, 0),
+		MakeRGBA(243,234,255, 0), MakeRGBA(243,236,255, 0), MakeRGBA(244,237,255, 0), MakeRGBA(245,238,255, 0),
+		MakeRGBA(245,239,255, 0), MakeRGBA(246,240,255, 0), MakeRGBA(246,241,255, 0), MakeRGBA(247,242,255, 0),
+		MakeRGBA(248,243,255, 0), MakeRGBA(248,244,255, 0), MakeRGBA(249,245,255, 0), MakeRGBA(250,246,255, 0),
+		MakeRGBA(250,247,255, 0), MakeRGBA(251,248,255, 0), MakeRGBA(251,249,255, 0), MakeRGBA(252,250,255, 0),
+		MakeRGBA(253,251,255, 0), MakeRGBA(253,252,255, 0), MakeRGBA(254,253,255, 0), MakeRGBA(254,254,255, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_ORANGE. */
-static const uint32 _recolour14[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  2,  0, 0), MakeRGBA(  8,  4,  0, 0), MakeRGBA( 12,  6,  0, 0),
-	MakeRGBA( 16,  8,  0, 0), MakeRGBA( 20, 10,  0, 0), MakeRGBA( 24, 12,  0, 0), MakeRGBA( 28, 14,  0, 0),
-	MakeRGBA( 32, 16,  0, 0), MakeRGBA( 36, 18,  0, 0), MakeRGBA( 40, 20,  0, 0), MakeRGBA( 44, 22,  0, 0),
-	MakeRGBA( 48, 24,  0, 0), MakeRGBA( 52, 26,  0, 0), MakeRGBA( 56, 28,  0, 0), MakeRGBA( 60, 30,  0, 0),
-	MakeRGBA( 64, 32,  0, 0), MakeRGBA( 68, 34,  0, 0), MakeRGBA( 72, 36,  0, 0), MakeRGBA( 76, 38,  0, 0),
-	MakeRGBA( 80, 39,  0, 0), MakeRGBA( 81, 40,  0, 0), MakeRGBA( 83, 40,  0, 0), MakeRGBA( 84, 41,  0, 0),
-	MakeRGBA( 86, 42,  0, 0), MakeRGBA( 88, 42,  0, 0), MakeRGBA( 89, 43,  0, 0), MakeRGBA( 91, 43,  0, 0),
-	MakeRGBA( 93, 44,  0, 0), MakeRGBA( 94, 45,  0, 0), MakeRGBA( 96, 45,  0, 0), MakeRGBA( 97, 46,  0, 0),
-	MakeRGBA( 99, 47,  0, 0), MakeRGBA(101, 47,  0, 0), MakeRGBA(102, 48,  0, 0), MakeRGBA(104, 48,  0, 0),
-	MakeRGBA(106, 49,  0, 0), MakeRGBA(107, 50,  0, 0), MakeRGBA(109, 50,  0, 0), MakeRGBA(110, 51,  0, 0),
-	MakeRGBA(112, 51,  0, 0), MakeRGBA(114, 52,  0, 0), MakeRGBA(116, 53,  0, 0), MakeRGBA(118, 53,  0, 0),
-	MakeRGBA(119, 54,  0, 0), MakeRGBA(121, 54,  0, 0), MakeRGBA(123, 55,  0, 0), MakeRGBA(125, 56,  0, 0),
-	MakeRGBA(127, 56,  0, 0), MakeRGBA(129, 57,  0, 0), MakeRGBA(130, 57,  0, 0), MakeRGBA(132, 58,  0, 0),
-	MakeRGBA(134, 59,  0, 0), MakeRGBA(136, 59,  0, 0), MakeRGBA(138, 60,  0, 0), MakeRGBA(140, 61,  0, 0),
-	MakeRGBA(141, 61,  0, 0), MakeRGBA(143, 62,  0, 0), MakeRGBA(145, 62,  0, 0), MakeRGBA(147, 63,  0, 0),
-	MakeRGBA(149, 63,  0, 0), MakeRGBA(151, 64,  0, 0), MakeRGBA(152, 64,  0, 0), MakeRGBA(154, 65,  0, 0),
-	MakeRGBA(156, 65,  0, 0), MakeRGBA(158, 65,  0, 0), MakeRGBA(160, 66,  0, 0), MakeRGBA(161, 66,  0, 0),
-	MakeRGBA(163, 67,  0, 0), MakeRGBA(165, 67,  0, 0), MakeRGBA(167, 67,  0, 0), MakeRGBA(169, 68,  0, 0),
-	MakeRGBA(171, 68,  0, 0), MakeRGBA(172, 69,  0, 0), MakeRGBA(174, 69,  0, 0), MakeRGBA(176, 69,  0, 0),
-	MakeRGBA(178, 70,  0, 0), MakeRGBA(180, 70,  0, 0), MakeRGBA(182, 71,  0, 0), MakeRGBA(183, 71,  0, 0),
-	MakeRGBA(185, 72,  0, 0), MakeRGBA(187, 72,  0, 0), MakeRGBA(189, 72,  0, 0), MakeRGBA(191, 73,  0, 0),
-	MakeRGBA(193, 73,  0, 0), MakeRGBA(194, 74,  0, 0), MakeRGBA(196, 74,  0, 0), MakeRGBA(198, 74,  0, 0),
-	MakeRGBA(200, 75,  0, 0), MakeRGBA(202, 75,  0, 0), MakeRGBA(204, 76,  0, 0), MakeRGBA(205, 76,  0, 0),
-	MakeRGBA(207, 76,  0, 0), MakeRGBA(209, 77,  0, 0), MakeRGBA(211, 77,  0, 0), MakeRGBA(213, 78,  0, 0),
-	MakeRGBA(215, 78,  0, 0), MakeRGBA(216, 78,  0, 0), MakeRGBA(218, 79,  0, 0), MakeRGBA(220, 79,  0, 0),
-	MakeRGBA(222, 79,  0, 0), MakeRGBA(224, 80,  0, 0), MakeRGBA(225, 80,  0, 0), MakeRGBA(227, 80,  0, 0),
-	MakeRGBA(229, 80,  0, 0), MakeRGBA(231, 80,  0, 0), MakeRGBA(233, 81,  0, 0), MakeRGBA(235, 81,  0, 0),
-	MakeRGBA(236, 81,  0, 0), MakeRGBA(238, 81,  0, 0), MakeRGBA(240, 81,  0, 0), MakeRGBA(242, 82,  0, 0),
-	MakeRGBA(244, 82,  0, 0), MakeRGBA(246, 82,  0, 0), MakeRGBA(247, 82,  0, 0), MakeRGBA(249, 82,  0, 0),
-	MakeRGBA(251, 83,  0, 0), MakeRGBA(253, 83,  0, 0), MakeRGBA(255, 83,  0, 0), MakeRGBA(255, 84,  1, 0),
-	MakeRGBA(255, 86,  2, 0), MakeRGBA(255, 87,  3, 0), MakeRGBA(255, 88,  4, 0), MakeRGBA(255, 90,  6, 0),
-	MakeRGBA(255, 91,  7, 0), MakeRGBA(255, 93,  8, 0), MakeRGBA(255, 94,  9, 0), MakeRGBA(255, 96, 10, 0),
-	MakeRGBA(255, 97, 11, 0), MakeRGBA(255, 98, 13, 0), MakeRGBA(255,100, 14, 0), MakeRGBA(255,101, 15, 0),
-	MakeRGBA(255,103, 16, 0), MakeRGBA(255,104, 17, 0), MakeRGBA(255,106, 19, 0), MakeRGBA(255,107, 20, 0),
-	MakeRGBA(255,108, 21, 0), MakeRGBA(255,110, 22, 0), MakeRGBA(255,111, 23, 0), MakeRGBA(255,113, 25, 0),
-	MakeRGBA(255,114, 26, 0), MakeRGBA(255,115, 27, 0), MakeRGBA(255,117, 29, 0), MakeRGBA(255,118, 30, 0),
-	MakeRGBA(255,120, 32, 0), MakeRGBA(255,121, 33, 0), MakeRGBA(255,123, 35, 0), MakeRGBA(255,124, 36, 0),
-	MakeRGBA(255,125, 37, 0), MakeRGBA(255,127, 39, 0), MakeRGBA(255,128, 40, 0), MakeRGBA(255,130, 42, 0),
-	MakeRGBA(255,131, 43, 0), MakeRGBA(255,133, 45, 0), MakeRGBA(255,134, 46, 0), MakeRGBA(255,135, 47, 0),
-	MakeRGBA(255,137, 49, 0), MakeRGBA(255,138, 50, 0), MakeRGBA(255,140, 52, 0), MakeRGBA(255,141, 53, 0),
-	MakeRGBA(255,142, 54, 0), MakeRGBA(255,143, 56, 0), MakeRGBA(255,144, 57, 0), MakeRGBA(255,146, 59, 0),
-	MakeRGBA(255,147, 60, 0), MakeRGBA(255,148, 62, 0), MakeRGBA(255,149, 63, 0), MakeRGBA(255,151, 64, 0),
-	MakeRGBA(255,152, 66, 0), MakeRGBA(255,153, 67, 0), MakeRGBA(255,154, 69, 0), MakeRGBA(255,155, 70, 0),
-	MakeRGBA(255,157, 72, 0), MakeRGBA(255,158, 73, 0), MakeRGBA(255,159, 74, 0), MakeRGBA(255,160, 76, 0),
-	MakeRGBA(255,162, 77, 0), MakeRGBA(255,163, 79, 0), MakeRGBA(255,164, 80, 0), MakeRGBA(255,165, 82, 0),
-	MakeRGBA(255,166, 83, 0), MakeRGBA(255,167, 84, 0), MakeRGBA(255,168, 86, 0), MakeRGBA(255,169, 87, 0),
-	MakeRGBA(255,170, 89, 0), MakeRGBA(255,171, 90, 0), MakeRGBA(255,172, 91, 0), MakeRGBA(255,173, 93, 0),
-	MakeRGBA(255,174, 94, 0), MakeRGBA(255,175, 96, 0), MakeRGBA(255,176, 97, 0), MakeRGBA(255,177, 99, 0),
-	MakeRGBA(255,178,100, 0), MakeRGBA(255,179,101, 0), MakeRGBA(255,180,103, 0), MakeRGBA(255,181,104, 0),
-	MakeRGBA(255,182,106, 0), MakeRGBA(255,183,107, 0), MakeRGBA(255,184,109, 0), MakeRGBA(255,185,110, 0),
-	MakeRGBA(255,186,111, 0), MakeRGBA(255,187,113, 0), MakeRGBA(255,188,114, 0), MakeRGBA(255,189,116, 0),
-	MakeRGBA(255,190,117, 0), MakeRGBA(255,191,118, 0), MakeRGBA(255,192,120, 0), MakeRGBA(255,193,121, 0),
-	MakeRGBA(255,194,123, 0), MakeRGBA(255,195,124, 0), MakeRGBA(255,196,126, 0), MakeRGBA(255,197,127, 0),
-	MakeRGBA(255,198,128, 0), MakeRGBA(255,199,130, 0), MakeRGBA(255,200,131, 0), MakeRGBA(255,201,133, 0),
-	MakeRGBA(255,202,134, 0), MakeRGBA(255,203,136, 0), MakeRGBA(255,204,137, 0), MakeRGBA(255,205,138, 0),
-	MakeRGBA(255,206,140, 0), MakeRGBA(255,207,141, 0), MakeRGBA(255,207,143, 0), MakeRGBA(255,208,144, 0),
-	MakeRGBA(255,209,145, 0), MakeRGBA(255,210,147, 0), MakeRGBA(255,211,148, 0), MakeRGBA(255,211,150, 0),
-	MakeRGBA(255,212,151, 0), MakeRGBA(255,213,153, 0), MakeRGBA(255,214,154, 0), MakeRGBA(255,215,155, 0),
-	MakeRGBA(255,215,157, 0), MakeRGBA(255,216,158, 0), MakeRGBA(255,217,160, 0), MakeRGBA(255,218,161, 0),
-	MakeRGBA(255,219,163, 0), MakeRGBA(255,220,166, 0), MakeRGBA(255,222,171, 0), MakeRGBA(255,224,176, 0),
-	MakeRGBA(255,226,180, 0), MakeRGBA(255,228,185, 0), MakeRGBA(255,229,190, 0), MakeRGBA(255,231,194, 0),
-	MakeRGBA(255,233,199, 0), MakeRGBA(255,235,204, 0), MakeRGBA(255,237,208, 0), MakeRGBA(255,239,213, 0),
-	MakeRGBA(255,240,218, 0), MakeRGBA(255,242,222, 0), MakeRGBA(255,244,227, 0), MakeRGBA(255,246,232, 0),
-	MakeRGBA(255,248,236, 0), MakeRGBA(255,250,241, 0), MakeRGBA(255,251,246, 0), MakeRGBA(255,253,250, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_RED. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  0, 0), MakeRGBA(  6,  0,  0, 0), MakeRGBA( 10,  0,  0, 0),
+		MakeRGBA( 13,  0,  0, 0), MakeRGBA( 16,  0,  0, 0), MakeRGBA( 19,  0,  0, 0), MakeRGBA( 22,  0,  0, 0),
+		MakeRGBA( 26,  0,  0, 0), MakeRGBA( 29,  0,  0, 0), MakeRGBA( 32,  0,  0, 0), MakeRGBA( 35,  0,  0, 0),
+		MakeRGBA( 38,  0,  0, 0), MakeRGBA( 42,  0,  0, 0), MakeRGBA( 45,  0,  0, 0), MakeRGBA( 48,  0,  0, 0),
+		MakeRGBA( 51,  0,  0, 0), MakeRGBA( 54,  0,  0, 0), MakeRGBA( 58,  0,  0, 0), MakeRGBA( 61,  0,  0, 0),
+		MakeRGBA( 63,  0,  0, 0), MakeRGBA( 65,  0,  0, 0), MakeRGBA( 66,  0,  0, 0), MakeRGBA( 67,  0,  0, 0),
+		MakeRGBA( 68,  0,  0, 0), MakeRGBA( 69,  0,  0, 0), MakeRGBA( 71,  0,  0, 0), MakeRGBA( 72,  0,  0, 0),
+		MakeRGBA( 73,  0,  0, 0), MakeRGBA( 74,  0,  0, 0), MakeRGBA( 76,  0,  0, 0), MakeRGBA( 77,  0,  0, 0),
+		MakeRGBA( 78,  0,  0, 0), MakeRGBA( 79,  0,  0, 0), MakeRGBA( 80,  0,  0, 0), MakeRGBA( 82,  0,  0, 0),
+		MakeRGBA( 83,  0,  0, 0), MakeRGBA( 84,  0,  0, 0), MakeRGBA( 85,  0,  0, 0), MakeRGBA( 87,  0,  0, 0),
+		MakeRGBA( 88,  0,  0, 0), MakeRGBA( 89,  0,  0, 0), MakeRGBA( 91,  0,  0, 0), MakeRGBA( 92,  0,  0, 0),
+		MakeRGBA( 94,  0,  0, 0), MakeRGBA( 95,  0,  0, 0), MakeRGBA( 96,  0,  0, 0), MakeRGBA( 98,  0,  0, 0),
+		MakeRGBA( 99,  0,  0, 0), MakeRGBA(101,  0,  0, 0), MakeRGBA(102,  0,  0, 0), MakeRGBA(104,  0,  0, 0),
+		MakeRGBA(105,  0,  0, 0), MakeRGBA(106,  0,  0, 0), MakeRGBA(108,  0,  0, 0), MakeRGBA(109,  0,  0, 0),
+		MakeRGBA(111,  0,  0, 0), MakeRGBA(112,  0,  0, 0), MakeRGBA(113,  0,  0, 0), MakeRGBA(115,  0,  0, 0),
+		MakeRGBA(116,  0,  0, 0), MakeRGBA(118,  0,  0, 0), MakeRGBA(119,  0,  0, 0), MakeRGBA(121,  0,  0, 0),
+		MakeRGBA(122,  0,  0, 0), MakeRGBA(123,  0,  0, 0), MakeRGBA(125,  0,  0, 0), MakeRGBA(126,  0,  0, 0),
+		MakeRGBA(128,  0,  0, 0), MakeRGBA(129,  0,  0, 0), MakeRGBA(131,  0,  0, 0), MakeRGBA(132,  0,  0, 0),
+		MakeRGBA(133,  0,  0, 0), MakeRGBA(135,  0,  0, 0), MakeRGBA(136,  0,  0, 0), MakeRGBA(138,  0,  0, 0),
+		MakeRGBA(139,  0,  0, 0), MakeRGBA(140,  0,  0, 0), MakeRGBA(142,  0,  0, 0), MakeRGBA(143,  0,  0, 0),
+		MakeRGBA(145,  0,  0, 0), MakeRGBA(146,  0,  0, 0), MakeRGBA(148,  0,  0, 0), MakeRGBA(149,  0,  0, 0),
+		MakeRGBA(150,  0,  0, 0), MakeRGBA(152,  0,  0, 0), MakeRGBA(153,  0,  0, 0), MakeRGBA(155,  0,  0, 0),
+		MakeRGBA(156,  0,  0, 0), MakeRGBA(158,  0,  0, 0), MakeRGBA(159,  0,  0, 0), MakeRGBA(160,  0,  0, 0),
+		MakeRGBA(162,  0,  0, 0), MakeRGBA(163,  0,  0, 0), MakeRGBA(165,  0,  0, 0), MakeRGBA(166,  0,  0, 0),
+		MakeRGBA(168,  0,  0, 0), MakeRGBA(169,  0,  0, 0), MakeRGBA(170,  0,  0, 0), MakeRGBA(172,  0,  0, 0),
+		MakeRGBA(173,  0,  0, 0), MakeRGBA(175,  0,  0, 0), MakeRGBA(176,  0,  0, 0), MakeRGBA(177,  0,  0, 0),
+		MakeRGBA(179,  0,  0, 0), MakeRGBA(180,  0,  0, 0), MakeRGBA(182,  0,  0, 0), MakeRGBA(183,  0,  0, 0),
+		MakeRGBA(185,  0,  0, 0), MakeRGBA(186,  0,  0, 0), MakeRGBA(187,  0,  0, 0), MakeRGBA(189,  0,  0, 0),
+		MakeRGBA(190,  0,  0, 0), MakeRGBA(192,  0,  0, 0), MakeRGBA(193,  0,  0, 0), MakeRGBA(195,  0,  0, 0),
+		MakeRGBA(196,  0,  0, 0), MakeRGBA(197,  0,  0, 0), MakeRGBA(199,  0,  0, 0), MakeRGBA(200,  0,  0, 0),
+		MakeRGBA(202,  1,  0, 0), MakeRGBA(203,  1,  0, 0), MakeRGBA(204,  1,  0, 0), MakeRGBA(206,  2,  0, 0),
+		MakeRGBA(207,  2,  0, 0), MakeRGBA(209,  2,  0, 0), MakeRGBA(210,  3,  0, 0), MakeRGBA(212,  3,  0, 0),
+		MakeRGBA(213,  3,  0, 0), MakeRGBA(214,  4,  0, 0), MakeRGBA(216,  4,  0, 0), MakeRGBA(217,  5,  0, 0),
+		MakeRGBA(219,  5,  0, 0), MakeRGBA(220,  5,  0, 0), MakeRGBA(222,  6,  0, 0), MakeRGBA(223,  6,  0, 0),
+		MakeRGBA(224,  6,  0, 0), MakeRGBA(226,  7,  0, 0), MakeRGBA(227,  7,  0, 0), MakeRGBA(229,  7,  0, 0),
+		MakeRGBA(230,  7,  0, 0), MakeRGBA(231,  7,  0, 0), MakeRGBA(233,  7,  0, 0), MakeRGBA(234,  7,  0, 0),
+		MakeRGBA(236,  7,  0, 0), MakeRGBA(237,  7,  0, 0), MakeRGBA(239,  7,  0, 0), MakeRGBA(240,  7,  0, 0),
+		MakeRGBA(241,  7,  0, 0), MakeRGBA(243,  7,  0, 0), MakeRGBA(244,  7,  0, 0), MakeRGBA(246,  7,  0, 0),
+		MakeRGBA(247,  7,  0, 0), MakeRGBA(249,  7,  0, 0), MakeRGBA(250,  7,  0, 0), MakeRGBA(251,  7,  0, 0),
+		MakeRGBA(253,  7,  0, 0), MakeRGBA(254,  7,  0, 0), MakeRGBA(255,  9,  2, 0), MakeRGBA(255, 12,  5, 0),
+		MakeRGBA(255, 16,  8, 0), MakeRGBA(255, 20, 12, 0), MakeRGBA(255, 23, 15, 0), MakeRGBA(255, 27, 19, 0),
+		MakeRGBA(255, 31, 22, 0), MakeRGBA(255, 34, 25, 0), MakeRGBA(255, 38, 29, 0), MakeRGBA(255, 42, 32, 0),
+		MakeRGBA(255, 45, 36, 0), MakeRGBA(255, 49, 39, 0), MakeRGBA(255, 53, 42, 0), MakeRGBA(255, 56, 46, 0),
+		MakeRGBA(255, 60, 49, 0), MakeRGBA(255, 64, 53, 0), MakeRGBA(255, 67, 56, 0), MakeRGBA(255, 71, 59, 0),
+		MakeRGBA(255, 74, 63, 0), MakeRGBA(255, 78, 66, 0), MakeRGBA(255, 81, 69, 0), MakeRGBA(255, 83, 71, 0),
+		MakeRGBA(255, 85, 74, 0), MakeRGBA(255, 87, 76, 0), MakeRGBA(255, 90, 79, 0), MakeRGBA(255, 92, 81, 0),
+		MakeRGBA(255, 94, 84, 0), MakeRGBA(255, 96, 86, 0), MakeRGBA(255, 99, 88, 0), MakeRGBA(255,101, 91, 0),
+		MakeRGBA(255,103, 93, 0), MakeRGBA(255,105, 96, 0), MakeRGBA(255,108, 98, 0), MakeRGBA(255,110,101, 0),
+		MakeRGBA(255,112,103, 0), MakeRGBA(255,114,105, 0), MakeRGBA(255,116,108, 0), MakeRGBA(255,119,110, 0),
+		MakeRGBA(255,121,113, 0), MakeRGBA(255,123,115, 0), MakeRGBA(255,126,118, 0), MakeRGBA(255,128,120, 0),
+		MakeRGBA(255,130,122, 0), MakeRGBA(255,133,125, 0), MakeRGBA(255,135,127, 0), MakeRGBA(255,138,130, 0),
+		MakeRGBA(255,140,132, 0), MakeRGBA(255,143,135, 0), MakeRGBA(255,145,137, 0), MakeRGBA(255,148,140, 0),
+		MakeRGBA(255,150,142, 0), MakeRGBA(255,152,144, 0), MakeRGBA(255,155,147, 0), MakeRGBA(255,157,149, 0),
+		MakeRGBA(255,160,152, 0), MakeRGBA(255,162,154, 0), MakeRGBA(255,165,157, 0), MakeRGBA(255,167,159, 0),
+		MakeRGBA(255,169,161, 0), MakeRGBA(255,172,164, 0), MakeRGBA(255,174,167, 0), MakeRGBA(255,177,169, 0),
+		MakeRGBA(255,179,172, 0), MakeRGBA(255,182,175, 0), MakeRGBA(255,184,177, 0), MakeRGBA(255,187,180, 0),
+		MakeRGBA(255,189,182, 0), MakeRGBA(255,191,185, 0), MakeRGBA(255,194,188, 0), MakeRGBA(255,196,190, 0),
+		MakeRGBA(255,199,193, 0), MakeRGBA(255,201,196, 0), MakeRGBA(255,204,198, 0), MakeRGBA(255,206,201, 0),
+		MakeRGBA(255,208,204, 0), MakeRGBA(255,211,206, 0), MakeRGBA(255,213,209, 0), MakeRGBA(255,216,212, 0),
+		MakeRGBA(255,218,214, 0), MakeRGBA(255,220,216, 0), MakeRGBA(255,222,218, 0), MakeRGBA(255,224,220, 0),
+		MakeRGBA(255,226,222, 0), MakeRGBA(255,228,225, 0), MakeRGBA(255,229,227, 0), MakeRGBA(255,231,229, 0),
+		MakeRGBA(255,233,231, 0), MakeRGBA(255,235,233, 0), MakeRGBA(255,237,235, 0), MakeRGBA(255,239,237, 0),
+		MakeRGBA(255,240,239, 0), MakeRGBA(255,242,241, 0), MakeRGBA(255,244,243, 0), MakeRGBA(255,246,245, 0),
+		MakeRGBA(255,248,247, 0), MakeRGBA(255,250,249, 0), MakeRGBA(255,251,251, 0), MakeRGBA(255,253,253, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_SEA_GREEN. */
-static const uint32 _recolour15[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  0,  3,  2, 0), MakeRGBA(  0,  5,  5, 0), MakeRGBA(  0,  8,  7, 0),
-	MakeRGBA(  0, 10, 10, 0), MakeRGBA(  0, 13, 12, 0), MakeRGBA(  0, 16, 14, 0), MakeRGBA(  0, 18, 17, 0),
-	MakeRGBA(  0, 21, 19, 0), MakeRGBA(  0, 23, 21, 0), MakeRGBA(  0, 26, 24, 0), MakeRGBA(  0, 28, 26, 0),
-	MakeRGBA(  0, 31, 29, 0), MakeRGBA(  0, 34, 31, 0), MakeRGBA(  0, 36, 33, 0), MakeRGBA(  0, 39, 36, 0),
-	MakeRGBA(  0, 41, 38, 0), MakeRGBA(  0, 44, 41, 0), MakeRGBA(  0, 47, 43, 0), MakeRGBA(  0, 49, 45, 0),
-	MakeRGBA(  0, 51, 47, 0), MakeRGBA(  0, 52, 48, 0), MakeRGBA(  0, 52, 48, 0), MakeRGBA(  0, 53, 48, 0),
-	MakeRGBA(  0, 54, 49, 0), MakeRGBA(  0, 54, 49, 0), MakeRGBA(  0, 55, 50, 0), MakeRGBA(  0, 55, 50, 0),
-	MakeRGBA(  0, 56, 50, 0), MakeRGBA(  0, 57, 51, 0), MakeRGBA(  0, 57, 51, 0), MakeRGBA(  0, 58, 52, 0),
-	MakeRGBA(  0, 59, 52, 0), MakeRGBA(  0, 59, 52, 0), MakeRGBA(  0, 60, 53, 0), MakeRGBA(  0, 60, 53, 0),
-	MakeRGBA(  0, 61, 54, 0), MakeRGBA(  0, 62, 54, 0), MakeRGBA(  0, 62, 54, 0), MakeRGBA(  0, 63, 55, 0),
-	MakeRGBA(  0, 63, 55, 0), MakeRGBA(  0, 64, 56, 0), MakeRGBA(  0, 65, 57, 0), MakeRGBA(  0, 65, 57, 0),
-	MakeRGBA(  0, 66, 58, 0), MakeRGBA(  0, 66, 58, 0), MakeRGBA(  0, 67, 59, 0), MakeRGBA(  0, 68, 60, 0),
-	MakeRGBA(  0, 68, 60, 0), MakeRGBA(  0, 69, 61, 0), MakeRGBA(  0, 69, 61, 0), MakeRGBA(  0, 70, 62, 0),
-	MakeRGBA(  0, 71, 63, 0), MakeRGBA(  0, 71, 63, 0), MakeRGBA(  0, 72, 64, 0), MakeRGBA(  0, 73, 65, 0),
-	MakeRGBA(  0, 73, 65, 0), MakeRGBA(  0, 74, 66, 0), MakeRGBA(  0, 74, 66, 0), MakeRGBA(  0, 75, 67, 0),
-	MakeRGBA(  0, 76, 68, 0), MakeRGBA(  0, 76, 68, 0), MakeRGBA(  0, 77, 69, 0), MakeRGBA(  0, 77, 69, 0),
-	MakeRGBA(  0, 78, 70, 0), MakeRGBA(  0, 79, 71, 0), MakeRGBA(  0, 79, 71, 0), MakeRGBA(  0, 80, 72, 0),
-	MakeRGBA(  0, 80, 72, 0), MakeRGBA(  0, 81, 73, 0), MakeRGBA(  0, 82, 74, 0), MakeRGBA(  0, 82, 74, 0),
-	MakeRGBA(  0, 83, 75, 0), MakeRGBA(  0, 83, 75, 0), MakeRGBA(  0, 84, 76, 0), MakeRGBA(  0, 85, 77, 0),
-	MakeRGBA(  0, 85, 77, 0), MakeRGBA(  0, 86, 78, 0), MakeRGBA(  0, 87, 79, 0), MakeRGBA(  0, 87, 79, 0),
-	MakeRGBA(  0, 88, 80, 0), MakeRGBA(  1, 89, 81, 0), MakeRGBA(  1, 90, 82, 0), MakeRGBA(  2, 91, 83, 0),
-	MakeRGBA(  2, 92, 84, 0), MakeRGBA(  2, 93, 85, 0), MakeRGBA(  3, 94, 86, 0), MakeRGBA(  3, 95, 87, 0),
-	MakeRGBA(  3, 96, 88, 0), MakeRGBA(  4, 97, 89, 0), MakeRGBA(  4, 98, 90, 0), MakeRGBA(  4, 99, 91, 0),
-	MakeRGBA(  5,100, 92, 0), MakeRGBA(  5,101, 93, 0), MakeRGBA(  5,102, 94, 0), MakeRGBA(  6,103, 95, 0),
-	MakeRGBA(  6,105, 97, 0), MakeRGBA(  6,106, 98, 0), MakeRGBA(  7,107, 99, 0), MakeRGBA(  7,108,100, 0),
-	MakeRGBA(  8,109,101, 0), MakeRGBA(  9,110,102, 0), MakeRGBA( 10,111,103, 0), MakeRGBA( 11,112,104, 0),
-	MakeRGBA( 11,113,105, 0), MakeRGBA( 12,114,106, 0), MakeRGBA( 13,115,107, 0), MakeRGBA( 14,116,108, 0),
-	MakeRGBA( 15,117,109, 0), MakeRGBA( 16,118,110, 0), MakeRGBA( 16,119,111, 0), MakeRGBA( 17,120,112, 0),
-	MakeRGBA( 18,121,113, 0), MakeRGBA( 19,122,114, 0), MakeRGBA( 20,123,115, 0), MakeRGBA( 20,124,116, 0),
-	MakeRGBA( 21,125,117, 0), MakeRGBA( 22,126,118, 0), MakeRGBA( 23,127,119, 0), MakeRGBA( 24,128,120, 0),
-	MakeRGBA( 25,129,121, 0), MakeRGBA( 26,130,122, 0), MakeRGBA( 27,131,124, 0), MakeRGBA( 28,132,125, 0),
-	MakeRGBA( 29,133,126, 0), MakeRGBA( 30,134,127, 0), MakeRGBA( 31,135,129, 0), MakeRGBA( 32,136,130, 0),
-	MakeRGBA( 33,137,131, 0), MakeRGBA( 34,138,132, 0), MakeRGBA( 35,139,133, 0), MakeRGBA( 36,140,135, 0),
-	MakeRGBA( 37,141,136, 0), MakeRGBA( 38,142,137, 0), MakeRGBA( 39,143,138, 0), MakeRGBA( 40,144,140, 0),
-	MakeRGBA( 41,145,141, 0), MakeRGBA( 42,146,142, 0), MakeRGBA( 43,147,143, 0), MakeRGBA( 45,148,144, 0),
-	MakeRGBA( 46,149,145, 0), MakeRGBA( 47,150,146, 0), MakeRGBA( 49,151,147, 0), MakeRGBA( 50,152,148, 0),
-	MakeRGBA( 52,153,149, 0), MakeRGBA( 53,154,150, 0), MakeRGBA( 55,155,151, 0), MakeRGBA( 56,156,152, 0),
-	MakeRGBA( 57,157,153, 0), MakeRGBA( 59,158,154, 0), MakeRGBA( 60,159,155, 0), MakeRGBA( 62,160,156, 0),
-	MakeRGBA( 63,161,157, 0), MakeRGBA( 65,162,158, 0), MakeRGBA( 66,163,159, 0), MakeRGBA( 67,164,160, 0),
-	MakeRGBA( 69,165,161, 0), MakeRGBA( 70,166,162, 0), MakeRGBA( 72,167,164, 0), MakeRGBA( 73,168,165, 0),
-	MakeRGBA( 74,170,166, 0), MakeRGBA( 76,171,167, 0), MakeRGBA( 77,172,168, 0), MakeRGBA( 79,173,170, 0),
-	MakeRGBA( 80,174,171, 0), MakeRGBA( 82,175,172, 0), MakeRGBA( 83,176,173, 0), MakeRGBA( 84,177,175, 0),
-	MakeRGBA( 86,178,176, 0), MakeRGBA( 87,179,177, 0), MakeRGBA( 89,180,178, 0), MakeRGBA( 90,181,179, 0),
-	MakeRGBA( 92,182,181, 0), MakeRGBA( 93,183,182, 0), MakeRGBA( 94,184,183, 0), MakeRGBA( 96,185,184, 0),
-	MakeRGBA( 97,186,186, 0), MakeRGBA( 99,187,187, 0), MakeRGBA(100,188,188, 0), MakeRGBA(102,189,189, 0),
-	MakeRGBA(104,190,190, 0), MakeRGBA(105,191,191, 0), MakeRGBA(107,192,192, 0), MakeRGBA(108,193,193, 0),
-	MakeRGBA(110,194,194, 0), MakeRGBA(112,195,195, 0), MakeRGBA(113,196,196, 0), MakeRGBA(115,197,197, 0),
-	MakeRGBA(117,198,198, 0), MakeRGBA(118,199,199, 0), MakeRGBA(120,200,200, 0), MakeRGBA(121,201,201, 0),
-	MakeRGBA(123,202,202, 0), MakeRGBA(125,203,203, 0), MakeRGBA(126,204,204, 0), MakeRGBA(128,205,205, 0),
-	MakeRGBA(130,206,206, 0), MakeRGBA(131,207,207, 0), MakeRGBA(133,208,208, 0), MakeRGBA(135,210,210, 0),
-	MakeRGBA(137,211,211, 0), MakeRGBA(139,212,212, 0), MakeRGBA(141,213,213, 0), MakeRGBA(143,214,214, 0),
-	MakeRGBA(145,216,216, 0), MakeRGBA(147,217,217, 0), MakeRGBA(149,218,218, 0), MakeRGBA(151,219,219, 0),
-	MakeRGBA(153,221,221, 0), MakeRGBA(156,222,222, 0), MakeRGBA(158,223,223, 0), MakeRGBA(160,224,224, 0),
-	MakeRGBA(162,225,225, 0), MakeRGBA(164,227,227, 0), MakeRGBA(166,228,228, 0), MakeRGBA(168,229,229, 0),
-	MakeRGBA(170,230,230, 0), MakeRGBA(172,231,231, 0), MakeRGBA(174,233,233, 0), MakeRGBA(175,234,234, 0),
-	MakeRGBA(177,235,235, 0), MakeRGBA(179,236,236, 0), MakeRGBA(181,238,238, 0), MakeRGBA(183,239,239, 0),
-	MakeRGBA(184,240,240, 0), MakeRGBA(186,241,241, 0), MakeRGBA(188,242,242, 0), MakeRGBA(190,244,244, 0),
-	MakeRGBA(192,245,245, 0), MakeRGBA(194,246,246, 0), MakeRGBA(195,247,247, 0), MakeRGBA(197,249,249, 0),
-	MakeRGBA(199,250,250, 0), MakeRGBA(201,251,251, 0), MakeRGBA(203,252,252, 0), MakeRGBA(205,253,253, 0),
-	MakeRGBA(206,255,255, 0), MakeRGBA(209,255,255, 0), MakeRGBA(211,255,255, 0), MakeRGBA(214,255,255, 0),
-	MakeRGBA(216,255,255, 0), MakeRGBA(218,255,255, 0), MakeRGBA(221,255,255, 0), MakeRGBA(223,255,255, 0),
-	MakeRGBA(226,255,255, 0), MakeRGBA(228,255,255, 0), MakeRGBA(231,255,255, 0), MakeRGBA(233,255,255, 0),
-	MakeRGBA(235,255,255, 0), MakeRGBA(238,255,255, 0), MakeRGBA(240,255,255, 0), MakeRGBA(243,255,255, 0),
-	MakeRGBA(245,255,255, 0), MakeRGBA(248,255,255, 0), MakeRGBA(250,255,255, 0), MakeRGBA(253,255,255, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_ORANGE. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  4,  2,  0, 0), MakeRGBA(  8,  4,  0, 0), MakeRGBA( 12,  6,  0, 0),
+		MakeRGBA( 16,  8,  0, 0), MakeRGBA( 20, 10,  0, 0), MakeRGBA( 24, 12,  0, 0), MakeRGBA( 28, 14,  0, 0),
+		MakeRGBA( 32, 16,  0, 0), MakeRGBA( 36, 18,  0, 0), MakeRGBA( 40, 20,  0, 0), MakeRGBA( 44, 22,  0, 0),
+		MakeRGBA( 48, 24,  0, 0), MakeRGBA( 52, 26,  0, 0), MakeRGBA( 56, 28,  0, 0), MakeRGBA( 60, 30,  0, 0),
+		MakeRGBA( 64, 32,  0, 0), MakeRGBA( 68, 34,  0, 0), MakeRGBA( 72, 36,  0, 0), MakeRGBA( 76, 38,  0, 0),
+		MakeRGBA( 80, 39,  0, 0), MakeRGBA( 81, 40,  0, 0), MakeRGBA( 83, 40,  0, 0), MakeRGBA( 84, 41,  0, 0),
+		MakeRGBA( 86, 42,  0, 0), MakeRGBA( 88, 42,  0, 0), MakeRGBA( 89, 43,  0, 0), MakeRGBA( 91, 43,  0, 0),
+		MakeRGBA( 93, 44,  0, 0), MakeRGBA( 94, 45,  0, 0), MakeRGBA( 96, 45,  0, 0), MakeRGBA( 97, 46,  0, 0),
+		MakeRGBA( 99, 47,  0, 0), MakeRGBA(101, 47,  0, 0), MakeRGBA(102, 48,  0, 0), MakeRGBA(104, 48,  0, 0),
+		MakeRGBA(106, 49,  0, 0), MakeRGBA(107, 50,  0, 0), MakeRGBA(109, 50,  0, 0), MakeRGBA(110, 51,  0, 0),
+		MakeRGBA(112, 51,  0, 0), MakeRGBA(114, 52,  0, 0), MakeRGBA(116, 53,  0, 0), MakeRGBA(118, 53,  0, 0),
+		MakeRGBA(119, 54,  0, 0), MakeRGBA(121, 54,  0, 0), MakeRGBA(123, 55,  0, 0), MakeRGBA(125, 56,  0, 0),
+		MakeRGBA(127, 56,  0, 0), MakeRGBA(129, 57,  0, 0), MakeRGBA(130, 57,  0, 0), MakeRGBA(132, 58,  0, 0),
+		MakeRGBA(134, 59,  0, 0), MakeRGBA(136, 59,  0, 0), MakeRGBA(138, 60,  0, 0), MakeRGBA(140, 61,  0, 0),
+		MakeRGBA(141, 61,  0, 0), MakeRGBA(143, 62,  0, 0), MakeRGBA(145, 62,  0, 0), MakeRGBA(147, 63,  0, 0),
+		MakeRGBA(149, 63,  0, 0), MakeRGBA(151, 64,  0, 0), MakeRGBA(152, 64,  0, 0), MakeRGBA(154, 65,  0, 0),
+		MakeRGBA(156, 65,  0, 0), MakeRGBA(158, 65,  0, 0), MakeRGBA(160, 66,  0, 0), MakeRGBA(161, 66,  0, 0),
+		MakeRGBA(163, 67,  0, 0), MakeRGBA(165, 67,  0, 0), MakeRGBA(167, 67,  0, 0), MakeRGBA(169, 68,  0, 0),
+		MakeRGBA(171, 68,  0, 0), MakeRGBA(172, 69,  0, 0), MakeRGBA(174, 69,  0, 0), MakeRGBA(176, 69,  0, 0),
+		MakeRGBA(178, 70,  0, 0), MakeRGBA(180, 70,  0, 0), MakeRGBA(182, 71,  0, 0), MakeRGBA(183, 71,  0, 0),
+		MakeRGBA(185, 72,  0, 0), MakeRGBA(187, 72,  0, 0), MakeRGBA(189, 72,  0, 0), MakeRGBA(191, 73,  0, 0),
+		MakeRGBA(193, 73,  0, 0), MakeRGBA(194, 74,  0, 0), MakeRGBA(196, 74,  0, 0), MakeRGBA(198, 74,  0, 0),
+		MakeRGBA(200, 75,  0, 0), MakeRGBA(202, 75,  0, 0), MakeRGBA(204, 76,  0, 0), MakeRGBA(205, 76,  0, 0),
+		MakeRGBA(207, 76,  0, 0), MakeRGBA(209, 77,  0, 0), MakeRGBA(211, 77,  0, 0), MakeRGBA(213, 78,  0, 0),
+		MakeRGBA(215, 78,  0, 0), MakeRGBA(216, 78,  0, 0), MakeRGBA(218, 79,  0, 0), MakeRGBA(220, 79,  0, 0),
+		MakeRGBA(222, 79,  0, 0), MakeRGBA(224, 80,  0, 0), MakeRGBA(225, 80,  0, 0), MakeRGBA(227, 80,  0, 0),
+		MakeRGBA(229, 80,  0, 0), MakeRGBA(231, 80,  0, 0), MakeRGBA(233, 81,  0, 0), MakeRGBA(235, 81,  0, 0),
+		MakeRGBA(236, 81,  0, 0), MakeRGBA(238, 81,  0, 0), MakeRGBA(240, 81,  0, 0), MakeRGBA(242, 82,  0, 0),
+		MakeRGBA(244, 82,  0, 0), MakeRGBA(246, 82,  0, 0), MakeRGBA(247, 82,  0, 0), MakeRGBA(249, 82,  0, 0),
+		MakeRGBA(251, 83,  0, 0), MakeRGBA(253, 83,  0, 0), MakeRGBA(255, 83,  0, 0), MakeRGBA(255, 84,  1, 0),
+		MakeRGBA(255, 86,  2, 0), MakeRGBA(255, 87,  3, 0), MakeRGBA(255, 88,  4, 0), MakeRGBA(255, 90,  6, 0),
+		MakeRGBA(255, 91,  7, 0), MakeRGBA(255, 93,  8, 0), MakeRGBA(255, 94,  9, 0), MakeRGBA(255, 96, 10, 0),
+		MakeRGBA(255, 97, 11, 0), MakeRGBA(255, 98, 13, 0), MakeRGBA(255,100, 14, 0), MakeRGBA(255,101, 15, 0),
+		MakeRGBA(255,103, 16, 0), MakeRGBA(255,104, 17, 0), MakeRGBA(255,106, 19, 0), MakeRGBA(255,107, 20, 0),
+		MakeRGBA(255,108, 21, 0), MakeRGBA(255,110, 22, 0), MakeRGBA(255,111, 23, 0), MakeRGBA(255,113, 25, 0),
+		MakeRGBA(255,114, 26, 0), MakeRGBA(255,115, 27, 0), MakeRGBA(255,117, 29, 0), MakeRGBA(255,118, 30, 0),
+		MakeRGBA(255,120, 32, 0), MakeRGBA(255,121, 33, 0), MakeRGBA(255,123, 35, 0), MakeRGBA(255,124, 36, 0),
+		MakeRGBA(255,125, 37, 0), MakeRGBA(255,127, 39, 0), MakeRGBA(255,128, 40, 0), MakeRGBA(255,130, 42, 0),
+		MakeRGBA(255,131, 43, 0), MakeRGBA(255,133, 45, 0), MakeRGBA(255,134, 46, 0), MakeRGBA(255,135, 47, 0),
+		MakeRGBA(255,137, 49, 0), MakeRGBA(255,138, 50, 0), MakeRGBA(255,140, 52, 0), MakeRGBA(255,141, 53, 0),
+		MakeRGBA(255,142, 54, 0), MakeRGBA(255,143, 56, 0), MakeRGBA(255,144, 57, 0), MakeRGBA(255,146, 59, 0),
+		MakeRGBA(255,147, 60, 0), MakeRGBA(255,148, 62, 0), MakeRGBA(255,149, 63, 0), MakeRGBA(255,151, 64, 0),
+		MakeRGBA(255,152, 66, 0), MakeRGBA(255,153, 67, 0), MakeRGBA(255,154, 69, 0), MakeRGBA(255,155, 70, 0),
+		MakeRGBA(255,157, 72, 0), MakeRGBA(255,158, 73, 0), MakeRGBA(255,159, 74, 0), MakeRGBA(255,160, 76, 0),
+		MakeRGBA(255,162, 77, 0), MakeRGBA(255,163, 79, 0), MakeRGBA(255,164, 80, 0), MakeRGBA(255,165, 82, 0),
+		MakeRGBA(255,166, 83, 0), MakeRGBA(255,167, 84, 0), MakeRGBA(255,168, 86, 0), MakeRGBA(255,169, 87, 0),
+		MakeRGBA(255,170, 89, 0), MakeRGBA(255,171, 90, 0), MakeRGBA(255,172, 91, 0), MakeRGBA(255,173, 93, 0),
+		MakeRGBA(255,174, 94, 0), MakeRGBA(255,175, 96, 0), MakeRGBA(255,176, 97, 0), MakeRGBA(255,177, 99, 0),
+		MakeRGBA(255,178,100, 0), MakeRGBA(255,179,101, 0), MakeRGBA(255,180,103, 0), MakeRGBA(255,181,104, 0),
+		MakeRGBA(255,182,106, 0), MakeRGBA(255,183,107, 0), MakeRGBA(255,184,109, 0), MakeRGBA(255,185,110, 0),
+		MakeRGBA(255,186,111, 0), MakeRGBA(255,187,113, 0), MakeRGBA(255,188,114, 0), MakeRGBA(255,189,116, 0),
+		MakeRGBA(255,190,117, 0), MakeRGBA(255,191,118, 0), MakeRGBA(255,192,120, 0), MakeRGBA(255,193,121, 0),
+		MakeRGBA(255,194,123, 0), MakeRGBA(255,195,124, 0), MakeRGBA(255,196,126, 0), MakeRGBA(255,197,127, 0),
+		MakeRGBA(255,198,128, 0), MakeRGBA(255,199,130, 0), MakeRGBA(255,200,131, 0), MakeRGBA(255,201,133, 0),
+		MakeRGBA(255,202,134, 0), MakeRGBA(255,203,136, 0), MakeRGBA(255,204,137, 0), MakeRGBA(255,205,138, 0),
+		MakeRGBA(255,206,140, 0), MakeRGBA(255,207,141, 0), MakeRGBA(255,207,143, 0), MakeRGBA(255,208,144, 0),
+		MakeRGBA(255,209,145, 0), MakeRGBA(255,210,147, 0), MakeRGBA(255,211,148, 0), MakeRGBA(255,211,150, 0),
+		MakeRGBA(255,212,151, 0), MakeRGBA(255,213,153, 0), MakeRGBA(255,214,154, 0), MakeRGBA(255,215,155, 0),
+		MakeRGBA(255,215,157, 0), MakeRGBA(255,216,158, 0), MakeRGBA(255,217,160, 0), MakeRGBA(255,218,161, 0),
+		MakeRGBA(255,219,163, 0), MakeRGBA(255,220,166, 0), MakeRGBA(255,222,171, 0), MakeRGBA(255,224,176, 0),
+		MakeRGBA(255,226,180, 0), MakeRGBA(255,228,185, 0), MakeRGBA(255,229,190, 0), MakeRGBA(255,231,194, 0),
+		MakeRGBA(255,233,199, 0), MakeRGBA(255,235,204, 0), MakeRGBA(255,237,208, 0), MakeRGBA(255,239,213, 0),
+		MakeRGBA(255,240,218, 0), MakeRGBA(255,242,222, 0), MakeRGBA(255,244,227, 0), MakeRGBA(255,246,232, 0),
+		MakeRGBA(255,248,236, 0), MakeRGBA(255,250,241, 0), MakeRGBA(255,251,246, 0), MakeRGBA(255,253,250, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_PINK. */
-static const uint32 _recolour16[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  1, 0), MakeRGBA(  6,  0,  3, 0), MakeRGBA( 10,  0,  4, 0),
-	MakeRGBA( 13,  0,  5, 0), MakeRGBA( 16,  0,  7, 0), MakeRGBA( 19,  0,  8, 0), MakeRGBA( 22,  0, 10, 0),
-	MakeRGBA( 26,  0, 11, 0), MakeRGBA( 29,  0, 12, 0), MakeRGBA( 32,  0, 14, 0), MakeRGBA( 35,  0, 15, 0),
-	MakeRGBA( 38,  0, 16, 0), MakeRGBA( 42,  0, 18, 0), MakeRGBA( 45,  0, 19, 0), MakeRGBA( 48,  0, 21, 0),
-	MakeRGBA( 51,  0, 22, 0), MakeRGBA( 54,  0, 23, 0), MakeRGBA( 58,  0, 25, 0), MakeRGBA( 61,  0, 26, 0),
-	MakeRGBA( 63,  0, 27, 0), MakeRGBA( 65,  0, 28, 0), MakeRGBA( 66,  0, 28, 0), MakeRGBA( 68,  0, 29, 0),
-	MakeRGBA( 69,  0, 30, 0), MakeRGBA( 71,  0, 30, 0), MakeRGBA( 72,  0, 31, 0), MakeRGBA( 73,  0, 31, 0),
-	MakeRGBA( 75,  0, 32, 0), MakeRGBA( 76,  0, 33, 0), MakeRGBA( 78,  0, 33, 0), MakeRGBA( 79,  0, 34, 0),
-	MakeRGBA( 81,  0, 35, 0), MakeRGBA( 82,  0, 35, 0), MakeRGBA( 83,  0, 36, 0), MakeRGBA( 85,  0, 36, 0),
-	MakeRGBA( 86,  0, 37, 0), MakeRGBA( 88,  0, 38, 0), MakeRGBA( 89,  0, 38, 0), MakeRGBA( 90,  0, 39, 0),
-	MakeRGBA( 92,  0, 40, 0), MakeRGBA( 93,  0, 41, 0), MakeRGBA( 95,  0, 42, 0), MakeRGBA( 96,  0, 43, 0),
-	MakeRGBA( 98,  0, 44, 0), MakeRGBA( 99,  0, 45, 0), MakeRGBA(100,  0, 46, 0), MakeRGBA(102,  0, 47, 0),
-	MakeRGBA(103,  0, 48, 0), MakeRGBA(105,  0, 49, 0), MakeRGBA(106,  0, 50, 0), MakeRGBA(108,  0, 51, 0),
-	MakeRGBA(109,  0, 52, 0), MakeRGBA(110,  0, 53, 0), MakeRGBA(112,  0, 54, 0), MakeRGBA(113,  0, 55, 0),
-	MakeRGBA(115,  0, 56, 0), MakeRGBA(116,  0, 57, 0), MakeRGBA(117,  0, 58, 0), MakeRGBA(119,  0, 59, 0),
-	MakeRGBA(120,  0, 60, 0), MakeRGBA(122,  1, 61, 0), MakeRGBA(123,  1, 61, 0), MakeRGBA(125,  1, 62, 0),
-	MakeRGBA(126,  2, 63, 0), MakeRGBA(127,  2, 64, 0), MakeRGBA(129,  2, 65, 0), MakeRGBA(130,  3, 65, 0),
-	MakeRGBA(132,  3, 66, 0), MakeRGBA(133,  4, 67, 0), MakeRGBA(135,  4, 68, 0), MakeRGBA(136,  4, 69, 0),
-	MakeRGBA(137,  5, 70, 0), MakeRGBA(139,  5, 70, 0), MakeRGBA(140,  5, 71, 0), MakeRGBA(142,  6, 72, 0),
-	MakeRGBA(143,  6, 73, 0), MakeRGBA(144,  6, 74, 0), MakeRGBA(146,  7, 74, 0), MakeRGBA(147,  7, 75, 0),
-	MakeRGBA(149,  7, 77, 0), MakeRGBA(151,  7, 78, 0), MakeRGBA(152,  8, 79, 0), MakeRGBA(154,  8, 80, 0),
-	MakeRGBA(156,  8, 81, 0), MakeRGBA(157,  8, 83, 0), MakeRGBA(159,  8, 84, 0), MakeRGBA(160,  9, 85, 0),
-	MakeRGBA(162,  9, 86, 0), MakeRGBA(164,  9, 87, 0), MakeRGBA(165,  9, 89, 0), MakeRGBA(167,  9, 90, 0),
-	MakeRGBA(169, 10, 91, 0), MakeRGBA(170, 10, 92, 0), MakeRGBA(172, 10, 94, 0), MakeRGBA(173, 10, 95, 0),
-	MakeRGBA(175, 11, 96, 0), MakeRGBA(177, 11, 97, 0), MakeRGBA(178, 11, 98, 0), MakeRGBA(180, 12,100, 0),
-	MakeRGBA(181, 13,101, 0), MakeRGBA(182, 14,102, 0), MakeRGBA(183, 15,103, 0), MakeRGBA(184, 16,104, 0),
-	MakeRGBA(185, 17,105, 0), MakeRGBA(186, 18,106, 0), MakeRGBA(187, 19,107, 0), MakeRGBA(188, 20,108, 0),
-	MakeRGBA(189, 21,109, 0), MakeRGBA(190, 22,110, 0), MakeRGBA(191, 23,111, 0), MakeRGBA(192, 24,112, 0),
-	MakeRGBA(193, 25,113, 0), MakeRGBA(194, 26,114, 0), MakeRGBA(195, 27,115, 0), MakeRGBA(196, 28,116, 0),
-	MakeRGBA(197, 29,117, 0), MakeRGBA(198, 30,118, 0), MakeRGBA(199, 31,119, 0), MakeRGBA(200, 32,120, 0),
-	MakeRGBA(201, 34,121, 0), MakeRGBA(202, 35,122, 0), MakeRGBA(203, 36,124, 0), MakeRGBA(204, 38,125, 0),
-	MakeRGBA(205, 39,126, 0), MakeRGBA(206, 41,127, 0), MakeRGBA(207, 42,129, 0), MakeRGBA(208, 44,130, 0),
-	MakeRGBA(209, 45,131, 0), MakeRGBA(210, 46,132, 0), MakeRGBA(211, 48,133, 0), MakeRGBA(212, 49,135, 0),
-	MakeRGBA(213, 51,136, 0), MakeRGBA(214, 52,137, 0), MakeRGBA(215, 54,138, 0), MakeRGBA(216, 55,140, 0),
-	MakeRGBA(217, 56,141, 0), MakeRGBA(218, 58,142, 0), MakeRGBA(219, 59,143, 0), MakeRGBA(220, 61,145, 0),
-	MakeRGBA(221, 62,146, 0), MakeRGBA(222, 64,147, 0), MakeRGBA(223, 66,149, 0), MakeRGBA(224, 67,150, 0),
-	MakeRGBA(225, 69,152, 0), MakeRGBA(226, 71,153, 0), MakeRGBA(227, 72,155, 0), MakeRGBA(228, 74,156, 0),
-	MakeRGBA(229, 75,157, 0), MakeRGBA(230, 77,159, 0), MakeRGBA(231, 79,160, 0), MakeRGBA(232, 80,162, 0),
-	MakeRGBA(233, 82,163, 0), MakeRGBA(234, 84,165, 0), MakeRGBA(235, 85,166, 0), MakeRGBA(236, 87,167, 0),
-	MakeRGBA(237, 88,169, 0), MakeRGBA(238, 90,170, 0), MakeRGBA(239, 92,171, 0), MakeRGBA(239, 93,172, 0),
-	MakeRGBA(240, 94,173, 0), MakeRGBA(240, 96,174, 0), MakeRGBA(240, 97,175, 0), MakeRGBA(240, 99,175, 0),
-	MakeRGBA(240,100,176, 0), MakeRGBA(241,102,177, 0), MakeRGBA(241,103,178, 0), MakeRGBA(241,104,179, 0),
-	MakeRGBA(241,106,180, 0), MakeRGBA(241,107,180, 0), MakeRGBA(242,109,181, 0), MakeRGBA(242,110,182, 0),
-	MakeRGBA(242,112,183, 0), MakeRGBA(242,113,184, 0), MakeRGBA(242,114,184, 0), MakeRGBA(243,116,185, 0),
-	MakeRGBA(243,117,186, 0), MakeRGBA(243,119,187, 0), MakeRGBA(243,120,188, 0), MakeRGBA(243,122,188, 0),
-	MakeRGBA(244,124,189, 0), MakeRGBA(244,125,190, 0), MakeRGBA(244,127,191, 0), MakeRGBA(244,128,192, 0),
-	MakeRGBA(244,130,193, 0), MakeRGBA(245,132,193, 0), MakeRGBA(245,133,194, 0), MakeRGBA(245,135,195, 0),
-	MakeRGBA(245,137,196, 0), MakeRGBA(245,138,197, 0), MakeRGBA(246,140,197, 0), MakeRGBA(246,141,198, 0),
-	MakeRGBA(246,143,199, 0), MakeRGBA(246,145,200, 0), MakeRGBA(246,146,201, 0), MakeRGBA(247,148,201, 0),
-	MakeRGBA(247,150,202, 0), MakeRGBA(247,151,203, 0), MakeRGBA(247,153,204, 0), MakeRGBA(247,154,205, 0),
-	MakeRGBA(248,156,206, 0), MakeRGBA(248,158,207, 0), MakeRGBA(248,159,208, 0), MakeRGBA(248,161,209, 0),
-	MakeRGBA(248,162,210, 0), MakeRGBA(249,164,211, 0), MakeRGBA(249,166,212, 0), MakeRGBA(249,167,213, 0),
-	MakeRGBA(249,169,214, 0), MakeRGBA(249,171,215, 0), MakeRGBA(250,172,216, 0), MakeRGBA(250,174,217, 0),
-	MakeRGBA(250,175,218, 0), MakeRGBA(250,177,219, 0), MakeRGBA(250,179,220, 0), MakeRGBA(251,180,221, 0),
-	MakeRGBA(251,182,222, 0), MakeRGBA(251,184,223, 0), MakeRGBA(251,185,224, 0), MakeRGBA(251,187,225, 0),
-	MakeRGBA(252,188,226, 0), MakeRGBA(252,190,227, 0), MakeRGBA(252,192,227, 0), MakeRGBA(252,193,228, 0),
-	MakeRGBA(253,195,229, 0), MakeRGBA(253,197,230, 0), MakeRGBA(253,198,231, 0), MakeRGBA(253,200,231, 0),
-	MakeRGBA(253,201,232, 0), MakeRGBA(254,203,233, 0), MakeRGBA(254,205,234, 0), MakeRGBA(254,206,235, 0),
-	MakeRGBA(254,208,235, 0), MakeRGBA(254,210,236, 0), MakeRGBA(255,211,237, 0), MakeRGBA(255,213,238, 0),
-	MakeRGBA(255,214,239, 0), MakeRGBA(255,216,240, 0), MakeRGBA(255,218,240, 0), MakeRGBA(255,220,241, 0),
-	MakeRGBA(255,222,242, 0), MakeRGBA(255,225,243, 0), MakeRGBA(255,227,244, 0), MakeRGBA(255,229,244, 0),
-	MakeRGBA(255,231,245, 0), MakeRGBA(255,233,246, 0), MakeRGBA(255,235,247, 0), MakeRGBA(255,237,248, 0),
-	MakeRGBA(255,239,249, 0), MakeRGBA(255,241,249, 0), MakeRGBA(255,243,250, 0), MakeRGBA(255,245,251, 0),
-	MakeRGBA(255,247,252, 0), MakeRGBA(255,249,253, 0), MakeRGBA(255,251,253, 0), MakeRGBA(255,253,254, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_SEA_GREEN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  0,  3,  2, 0), MakeRGBA(  0,  5,  5, 0), MakeRGBA(  0,  8,  7, 0),
+		MakeRGBA(  0, 10, 10, 0), MakeRGBA(  0, 13, 12, 0), MakeRGBA(  0, 16, 14, 0), MakeRGBA(  0, 18, 17, 0),
+		MakeRGBA(  0, 21, 19, 0), MakeRGBA(  0, 23, 21, 0), MakeRGBA(  0, 26, 24, 0), MakeRGBA(  0, 28, 26, 0),
+		MakeRGBA(  0, 31, 29, 0), MakeRGBA(  0, 34, 31, 0), MakeRGBA(  0, 36, 33, 0), MakeRGBA(  0, 39, 36, 0),
+		MakeRGBA(  0, 41, 38, 0), MakeRGBA(  0, 44, 41, 0), MakeRGBA(  0, 47, 43, 0), MakeRGBA(  0, 49, 45, 0),
+		MakeRGBA(  0, 51, 47, 0), MakeRGBA(  0, 52, 48, 0), MakeRGBA(  0, 52, 48, 0), MakeRGBA(  0, 53, 48, 0),
+		MakeRGBA(  0, 54, 49, 0), MakeRGBA(  0, 54, 49, 0), MakeRGBA(  0, 55, 50, 0), MakeRGBA(  0, 55, 50, 0),
+		MakeRGBA(  0, 56, 50, 0), MakeRGBA(  0, 57, 51, 0), MakeRGBA(  0, 57, 51, 0), MakeRGBA(  0, 58, 52, 0),
+		MakeRGBA(  0, 59, 52, 0), MakeRGBA(  0, 59, 52, 0), MakeRGBA(  0, 60, 53, 0), MakeRGBA(  0, 60, 53, 0),
+		MakeRGBA(  0, 61, 54, 0), MakeRGBA(  0, 62, 54, 0), MakeRGBA(  0, 62, 54, 0), MakeRGBA(  0, 63, 55, 0),
+		MakeRGBA(  0, 63, 55, 0), MakeRGBA(  0, 64, 56, 0), MakeRGBA(  0, 65, 57, 0), MakeRGBA(  0, 65, 57, 0),
+		MakeRGBA(  0, 66, 58, 0), MakeRGBA(  0, 66, 58, 0), MakeRGBA(  0, 67, 59, 0), MakeRGBA(  0, 68, 60, 0),
+		MakeRGBA(  0, 68, 60, 0), MakeRGBA(  0, 69, 61, 0), MakeRGBA(  0, 69, 61, 0), MakeRGBA(  0, 70, 62, 0),
+		MakeRGBA(  0, 71, 63, 0), MakeRGBA(  0, 71, 63, 0), MakeRGBA(  0, 72, 64, 0), MakeRGBA(  0, 73, 65, 0),
+		MakeRGBA(  0, 73, 65, 0), MakeRGBA(  0, 74, 66, 0), MakeRGBA(  0, 74, 66, 0), MakeRGBA(  0, 75, 67, 0),
+		MakeRGBA(  0, 76, 68, 0), MakeRGBA(  0, 76, 68, 0), MakeRGBA(  0, 77, 69, 0), MakeRGBA(  0, 77, 69, 0),
+		MakeRGBA(  0, 78, 70, 0), MakeRGBA(  0, 79, 71, 0), MakeRGBA(  0, 79, 71, 0), MakeRGBA(  0, 80, 72, 0),
+		MakeRGBA(  0, 80, 72, 0), MakeRGBA(  0, 81, 73, 0), MakeRGBA(  0, 82, 74, 0), MakeRGBA(  0, 82, 74, 0),
+		MakeRGBA(  0, 83, 75, 0), MakeRGBA(  0, 83, 75, 0), MakeRGBA(  0, 84, 76, 0), MakeRGBA(  0, 85, 77, 0),
+		MakeRGBA(  0, 85, 77, 0), MakeRGBA(  0, 86, 78, 0), MakeRGBA(  0, 87, 79, 0), MakeRGBA(  0, 87, 79, 0),
+		MakeRGBA(  0, 88, 80, 0), MakeRGBA(  1, 89, 81, 0), MakeRGBA(  1, 90, 82, 0), MakeRGBA(  2, 91, 83, 0),
+		MakeRGBA(  2, 92, 84, 0), MakeRGBA(  2, 93, 85, 0), MakeRGBA(  3, 94, 86, 0), MakeRGBA(  3, 95, 87, 0),
+		MakeRGBA(  3, 96, 88, 0), MakeRGBA(  4, 97, 89, 0), MakeRGBA(  4, 98, 90, 0), MakeRGBA(  4, 99, 91, 0),
+		MakeRGBA(  5,100, 92, 0), MakeRGBA(  5,101, 93, 0), MakeRGBA(  5,102, 94, 0), MakeRGBA(  6,103, 95, 0),
+		MakeRGBA(  6,105, 97, 0), MakeRGBA(  6,106, 98, 0), MakeRGBA(  7,107, 99, 0), MakeRGBA(  7,108,100, 0),
+		MakeRGBA(  8,109,101, 0), MakeRGBA(  9,110,102, 0), MakeRGBA( 10,111,103, 0), MakeRGBA( 11,112,104, 0),
+		MakeRGBA( 11,113,105, 0), MakeRGBA( 12,114,106, 0), MakeRGBA( 13,115,107, 0), MakeRGBA( 14,116,108, 0),
+		MakeRGBA( 15,117,109, 0), MakeRGBA( 16,118,110, 0), MakeRGBA( 16,119,111, 0), MakeRGBA( 17,120,112, 0),
+		MakeRGBA( 18,121,113, 0), MakeRGBA( 19,122,114, 0), MakeRGBA( 20,123,115, 0), MakeRGBA( 20,124,116, 0),
+		MakeRGBA( 21,125,117, 0), MakeRGBA( 22,126,118, 0), MakeRGBA( 23,127,119, 0), MakeRGBA( 24,128,120, 0),
+		MakeRGBA( 25,129,121, 0), MakeRGBA( 26,130,122, 0), MakeRGBA( 27,131,124, 0), MakeRGBA( 28,132,125, 0),
+		MakeRGBA( 29,133,126, 0), MakeRGBA( 30,134,127, 0), MakeRGBA( 31,135,129, 0), MakeRGBA( 32,136,130, 0),
+		MakeRGBA( 33,137,131, 0), MakeRGBA( 34,138,132, 0), MakeRGBA( 35,139,133, 0), MakeRGBA( 36,140,135, 0),
+		MakeRGBA( 37,141,136, 0), MakeRGBA( 38,142,137, 0), MakeRGBA( 39,143,138, 0), MakeRGBA( 40,144,140, 0),
+		MakeRGBA( 41,145,141, 0), MakeRGBA( 42,146,142, 0), MakeRGBA( 43,147,143, 0), MakeRGBA( 45,148,144, 0),
+		MakeRGBA( 46,149,145, 0), MakeRGBA( 47,150,146, 0), MakeRGBA( 49,151,147, 0), MakeRGBA( 50,152,148, 0),
+		MakeRGBA( 52,153,149, 0), MakeRGBA( 53,154,150, 0), MakeRGBA( 55,155,151, 0), MakeRGBA( 56,156,152, 0),
+		MakeRGBA( 57,157,153, 0), MakeRGBA( 59,158,154, 0), MakeRGBA( 60,159,155, 0), MakeRGBA( 62,160,156, 0),
+		MakeRGBA( 63,161,157, 0), MakeRGBA( 65,162,158, 0), MakeRGBA( 66,163,159, 0), MakeRGBA( 67,164,160, 0),
+		MakeRGBA( 69,165,161, 0), MakeRGBA( 70,166,162, 0), MakeRGBA( 72,167,164, 0), MakeRGBA( 73,168,165, 0),
+		MakeRGBA( 74,170,166, 0), MakeRGBA( 76,171,167, 0), MakeRGBA( 77,172,168, 0), MakeRGBA( 79,173,170, 0),
+		MakeRGBA( 80,174,171, 0), MakeRGBA( 82,175,172, 0), MakeRGBA( 83,176,173, 0), MakeRGBA( 84,177,175, 0),
+		MakeRGBA( 86,178,176, 0), MakeRGBA( 87,179,177, 0), MakeRGBA( 89,180,178, 0), MakeRGBA( 90,181,179, 0),
+		MakeRGBA( 92,182,181, 0), MakeRGBA( 93,183,182, 0), MakeRGBA( 94,184,183, 0), MakeRGBA( 96,185,184, 0),
+		MakeRGBA( 97,186,186, 0), MakeRGBA( 99,187,187, 0), MakeRGBA(100,188,188, 0), MakeRGBA(102,189,189, 0),
+		MakeRGBA(104,190,190, 0), MakeRGBA(105,191,191, 0), MakeRGBA(107,192,192, 0), MakeRGBA(108,193,193, 0),
+		MakeRGBA(110,194,194, 0), MakeRGBA(112,195,195, 0), MakeRGBA(113,196,196, 0), MakeRGBA(115,197,197, 0),
+		MakeRGBA(117,198,198, 0), MakeRGBA(118,199,199, 0), MakeRGBA(120,200,200, 0), MakeRGBA(121,201,201, 0),
+		MakeRGBA(123,202,202, 0), MakeRGBA(125,203,203, 0), MakeRGBA(126,204,204, 0), MakeRGBA(128,205,205, 0),
+		MakeRGBA(130,206,206, 0), MakeRGBA(131,207,207, 0), MakeRGBA(133,208,208, 0), MakeRGBA(135,210,210, 0),
+		MakeRGBA(137,211,211, 0), MakeRGBA(139,212,212, 0), MakeRGBA(141,213,213, 0), MakeRGBA(143,214,214, 0),
+		MakeRGBA(145,216,216, 0), MakeRGBA(147,217,217, 0), MakeRGBA(149,218,218, 0), MakeRGBA(151,219,219, 0),
+		MakeRGBA(153,221,221, 0), MakeRGBA(156,222,222, 0), MakeRGBA(158,223,223, 0), MakeRGBA(160,224,224, 0),
+		MakeRGBA(162,225,225, 0), MakeRGBA(164,227,227, 0), MakeRGBA(166,228,228, 0), MakeRGBA(168,229,229, 0),
+		MakeRGBA(170,230,230, 0), MakeRGBA(172,231,231, 0), MakeRGBA(174,233,233, 0), MakeRGBA(175,234,234, 0),
+		MakeRGBA(177,235,235, 0), MakeRGBA(179,236,236, 0), MakeRGBA(181,238,238, 0), MakeRGBA(183,239,239, 0),
+		MakeRGBA(184,240,240, 0), MakeRGBA(186,241,241, 0), MakeRGBA(188,242,242, 0), MakeRGBA(190,244,244, 0),
+		MakeRGBA(192,245,245, 0), MakeRGBA(194,246,246, 0), MakeRGBA(195,247,247, 0), MakeRGBA(197,249,249, 0),
+		MakeRGBA(199,250,250, 0), MakeRGBA(201,251,251, 0), MakeRGBA(203,252,252, 0), MakeRGBA(205,253,253, 0),
+		MakeRGBA(206,255,255, 0), MakeRGBA(209,255,255, 0), MakeRGBA(211,255,255, 0), MakeRGBA(214,255,255, 0),
+		MakeRGBA(216,255,255, 0), MakeRGBA(218,255,255, 0), MakeRGBA(221,255,255, 0), MakeRGBA(223,255,255, 0),
+		MakeRGBA(226,255,255, 0), MakeRGBA(228,255,255, 0), MakeRGBA(231,255,255, 0), MakeRGBA(233,255,255, 0),
+		MakeRGBA(235,255,255, 0), MakeRGBA(238,255,255, 0), MakeRGBA(240,255,255, 0), MakeRGBA(243,255,255, 0),
+		MakeRGBA(245,255,255, 0), MakeRGBA(248,255,255, 0), MakeRGBA(250,255,255, 0), MakeRGBA(253,255,255, 0),
+	},
 
-/** Recolour table for ColourRange::COL_RANGE_BROWN. */
-static const uint32 _recolour17[256] = {
-	MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  1,  0, 0), MakeRGBA(  4,  2,  0, 0), MakeRGBA(  6,  3,  0, 0),
-	MakeRGBA(  8,  4,  0, 0), MakeRGBA( 10,  5,  0, 0), MakeRGBA( 12,  6,  0, 0), MakeRGBA( 14,  7,  0, 0),
-	MakeRGBA( 16,  8,  0, 0), MakeRGBA( 18,  9,  0, 0), MakeRGBA( 20, 10,  0, 0), MakeRGBA( 22, 11,  0, 0),
-	MakeRGBA( 24, 12,  0, 0), MakeRGBA( 26, 13,  0, 0), MakeRGBA( 28, 14,  0, 0), MakeRGBA( 30, 14,  0, 0),
-	MakeRGBA( 32, 15,  0, 0), MakeRGBA( 34, 16,  0, 0), MakeRGBA( 36, 17,  0, 0), MakeRGBA( 38, 18,  0, 0),
-	MakeRGBA( 39, 19,  0, 0), MakeRGBA( 40, 20,  0, 0), MakeRGBA( 41, 20,  1, 0), MakeRGBA( 42, 21,  1, 0),
-	MakeRGBA( 43, 22,  2, 0), MakeRGBA( 43, 22,  2, 0), MakeRGBA( 44, 23,  2, 0), MakeRGBA( 45, 23,  3, 0),
-	MakeRGBA( 46, 24,  3, 0), MakeRGBA( 47, 25,  3, 0), MakeRGBA( 47, 25,  4, 0), MakeRGBA( 48, 26,  4, 0),
-	MakeRGBA( 49, 27,  4, 0), MakeRGBA( 50, 27,  5, 0), MakeRGBA( 51, 28,  5, 0), MakeRGBA( 51, 28,  5, 0),
-	MakeRGBA( 52, 29,  6, 0), MakeRGBA( 53, 30,  6, 0), MakeRGBA( 54, 30,  7, 0), MakeRGBA( 55, 31,  7, 0),
-	MakeRGBA( 56, 32,  7, 0), MakeRGBA( 56, 32,  8, 0), MakeRGBA( 57, 33,  8, 0), MakeRGBA( 58, 34,  8, 0),
-	MakeRGBA( 59, 35,  9, 0), MakeRGBA( 60, 36,  9, 0), MakeRGBA( 60, 36, 10, 0), MakeRGBA( 61, 37, 10, 0),
-	MakeRGBA( 62, 38, 11, 0), MakeRGBA( 63, 39, 11, 0), MakeRGBA( 64, 40, 11, 0), MakeRGBA( 64, 40, 12, 0),
-	MakeRGBA( 65, 41, 12, 0), MakeRGBA( 66, 42, 13, 0), MakeRGBA( 67, 43, 13, 0), MakeRGBA( 68, 44, 13, 0),
-	MakeRGBA( 69, 45, 14, 0), MakeRGBA( 69, 45, 14, 0), MakeRGBA( 70, 46, 15, 0), MakeRGBA( 71, 47, 15, 0),
-	MakeRGBA( 72, 48, 16, 0), MakeRGBA( 73, 49, 17, 0), MakeRGBA( 74, 49, 17, 0), MakeRGBA( 75, 50, 18, 0),
-	MakeRGBA( 76, 51, 19, 0), MakeRGBA( 77, 52, 20, 0), MakeRGBA( 78, 53, 21, 0), MakeRGBA( 79, 53, 21, 0),
-	MakeRGBA( 80, 54, 22, 0), MakeRGBA( 81, 55, 23, 0), MakeRGBA( 82, 56, 24, 0), MakeRGBA( 83, 57, 25, 0),
-	MakeRGBA( 84, 58, 25, 0), MakeRGBA( 85, 58, 26, 0), MakeRGBA( 86, 59, 27, 0), MakeRGBA( 87, 60, 28, 0),
-	MakeRGBA( 88, 61, 29, 0), MakeRGBA( 89, 62, 30, 0), MakeRGBA( 90, 62, 30, 0), MakeRGBA( 91, 63, 31, 0),
-	MakeRGBA( 92, 64, 32, 0), MakeRGBA( 93, 65, 33, 0), MakeRGBA( 94, 66, 34, 0), MakeRGBA( 94, 67, 35, 0),
-	MakeRGBA( 95, 68, 36, 0), MakeRGBA( 96, 69, 37, 0), MakeRGBA( 97, 70, 38, 0), MakeRGBA( 98, 71, 39, 0),
-	MakeRGBA( 99, 72, 40, 0), MakeRGBA( 99, 73, 41, 0), MakeRGBA(100, 74, 42, 0), MakeRGBA(101, 75, 43, 0),
-	MakeRGBA(102, 76, 44, 0), MakeRGBA(103, 77, 45, 0), MakeRGBA(103, 78, 46, 0), MakeRGBA(104, 79, 47, 0),
-	MakeRGBA(105, 81, 49, 0), MakeRGBA(106, 82, 50, 0), MakeRGBA(107, 83, 51, 0), MakeRGBA(107, 84, 52, 0),
-	MakeRGBA(108, 85, 53, 0), MakeRGBA(109, 86, 54, 0), MakeRGBA(110, 87, 55, 0), MakeRGBA(111, 88, 57, 0),
-	MakeRGBA(112, 89, 58, 0), MakeRGBA(112, 90, 59, 0), MakeRGBA(113, 91, 60, 0), MakeRGBA(114, 92, 61, 0),
-	MakeRGBA(115, 93, 63, 0), MakeRGBA(116, 94, 64, 0), MakeRGBA(116, 95, 65, 0), MakeRGBA(117, 96, 66, 0),
-	MakeRGBA(118, 97, 68, 0), MakeRGBA(119, 98, 69, 0), MakeRGBA(120, 99, 70, 0), MakeRGBA(120,100, 71, 0),
-	MakeRGBA(121,101, 72, 0), MakeRGBA(122,102, 74, 0), MakeRGBA(123,103, 75, 0), MakeRGBA(124,104, 76, 0),
-	MakeRGBA(125,105, 78, 0), MakeRGBA(126,106, 80, 0), MakeRGBA(127,108, 81, 0), MakeRGBA(128,109, 83, 0),
-	MakeRGBA(129,110, 84, 0), MakeRGBA(130,111, 86, 0), MakeRGBA(131,113, 88, 0), MakeRGBA(132,114, 89, 0),
-	MakeRGBA(133,115, 91, 0), MakeRGBA(134,116, 93, 0), MakeRGBA(135,117, 94, 0), MakeRGBA(136,119, 96, 0),
-	MakeRGBA(137,120, 97, 0), MakeRGBA(138,121, 99, 0), MakeRGBA(139,122,101, 0), MakeRGBA(140,124,102, 0),
-	MakeRGBA(141,125,104, 0), MakeRGBA(142,126,106, 0), MakeRGBA(143,127,107, 0), MakeRGBA(144,128,108, 0),
-	MakeRGBA(145,129,109, 0), MakeRGBA(146,130,110, 0), MakeRGBA(147,131,111, 0), MakeRGBA(148,132,112, 0),
-	MakeRGBA(149,133,113, 0), MakeRGBA(150,134,114, 0), MakeRGBA(151,135,115, 0), MakeRGBA(152,136,116, 0),
-	MakeRGBA(153,137,117, 0), MakeRGBA(154,138,118, 0), MakeRGBA(155,139,119, 0), MakeRGBA(156,140,120, 0),
-	MakeRGBA(157,141,121, 0), MakeRGBA(158,142,122, 0), MakeRGBA(159,143,123, 0), MakeRGBA(160,144,124, 0),
-	MakeRGBA(161,145,125, 0), MakeRGBA(162,146,126, 0), MakeRGBA(164,148,127, 0), MakeRGBA(165,149,128, 0),
-	MakeRGBA(166,150,130, 0), MakeRGBA(167,151,131, 0), MakeRGBA(168,152,132, 0), MakeRGBA(170,154,133, 0),
-	MakeRGBA(171,155,134, 0), MakeRGBA(172,156,135, 0), MakeRGBA(173,157,136, 0), MakeRGBA(175,159,137, 0),
-	MakeRGBA(176,160,138, 0), MakeRGBA(177,161,139, 0), MakeRGBA(178,162,140, 0), MakeRGBA(179,163,141, 0),
-	MakeRGBA(181,165,142, 0), MakeRGBA(182,166,143, 0), MakeRGBA(183,167,144, 0), MakeRGBA(184,168,145, 0),
-	MakeRGBA(186,170,146, 0), MakeRGBA(187,171,147, 0), MakeRGBA(188,172,148, 0), MakeRGBA(189,173,149, 0),
-	MakeRGBA(190,174,150, 0), MakeRGBA(191,176,152, 0), MakeRGBA(192,177,153, 0), MakeRGBA(193,178,154, 0),
-	MakeRGBA(194,179,155, 0), MakeRGBA(195,180,156, 0), MakeRGBA(196,182,158, 0), MakeRGBA(197,183,159, 0),
-	MakeRGBA(198,184,160, 0), MakeRGBA(199,185,161, 0), MakeRGBA(200,187,163, 0), MakeRGBA(201,188,164, 0),
-	MakeRGBA(202,189,165, 0), MakeRGBA(203,190,166, 0), MakeRGBA(204,191,167, 0), MakeRGBA(205,193,169, 0),
-	MakeRGBA(206,194,170, 0), MakeRGBA(207,195,171, 0), MakeRGBA(208,196,172, 0), MakeRGBA(210,198,174, 0),
-	MakeRGBA(211,199,175, 0), MakeRGBA(212,200,176, 0), MakeRGBA(213,201,177, 0), MakeRGBA(214,202,178, 0),
-	MakeRGBA(216,204,180, 0), MakeRGBA(217,205,181, 0), MakeRGBA(218,206,182, 0), MakeRGBA(219,207,183, 0),
-	MakeRGBA(221,209,185, 0), MakeRGBA(222,210,186, 0), MakeRGBA(223,211,187, 0), MakeRGBA(224,212,188, 0),
-	MakeRGBA(225,213,189, 0), MakeRGBA(227,215,191, 0), MakeRGBA(228,216,192, 0), MakeRGBA(229,217,193, 0),
-	MakeRGBA(230,218,194, 0), MakeRGBA(231,219,196, 0), MakeRGBA(233,221,197, 0), MakeRGBA(234,222,198, 0),
-	MakeRGBA(235,223,200, 0), MakeRGBA(236,224,201, 0), MakeRGBA(238,226,203, 0), MakeRGBA(239,227,204, 0),
-	MakeRGBA(240,228,205, 0), MakeRGBA(241,229,207, 0), MakeRGBA(242,230,208, 0), MakeRGBA(244,232,210, 0),
-	MakeRGBA(245,233,211, 0), MakeRGBA(246,234,213, 0), MakeRGBA(247,235,214, 0), MakeRGBA(249,237,215, 0),
-	MakeRGBA(250,238,217, 0), MakeRGBA(251,239,218, 0), MakeRGBA(252,240,220, 0), MakeRGBA(253,241,221, 0),
-	MakeRGBA(255,243,223, 0), MakeRGBA(255,243,224, 0), MakeRGBA(255,244,226, 0), MakeRGBA(255,245,227, 0),
-	MakeRGBA(255,245,229, 0), MakeRGBA(255,246,231, 0), MakeRGBA(255,246,232, 0), MakeRGBA(255,247,234, 0),
-	MakeRGBA(255,248,235, 0), MakeRGBA(255,248,237, 0), MakeRGBA(255,249,239, 0), MakeRGBA(255,250,240, 0),
-	MakeRGBA(255,250,242, 0), MakeRGBA(255,251,244, 0), MakeRGBA(255,251,245, 0), MakeRGBA(255,252,247, 0),
-	MakeRGBA(255,253,248, 0), MakeRGBA(255,253,250, 0), MakeRGBA(255,254,252, 0), MakeRGBA(255,254,253, 0),
-};
+	/* Recolour table for ColourRange::COL_RANGE_PINK. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  3,  0,  1, 0), MakeRGBA(  6,  0,  3, 0), MakeRGBA( 10,  0,  4, 0),
+		MakeRGBA( 13,  0,  5, 0), MakeRGBA( 16,  0,  7, 0), MakeRGBA( 19,  0,  8, 0), MakeRGBA( 22,  0, 10, 0),
+		MakeRGBA( 26,  0, 11, 0), MakeRGBA( 29,  0, 12, 0), MakeRGBA( 32,  0, 14, 0), MakeRGBA( 35,  0, 15, 0),
+		MakeRGBA( 38,  0, 16, 0), MakeRGBA( 42,  0, 18, 0), MakeRGBA( 45,  0, 19, 0), MakeRGBA( 48,  0, 21, 0),
+		MakeRGBA( 51,  0, 22, 0), MakeRGBA( 54,  0, 23, 0), MakeRGBA( 58,  0, 25, 0), MakeRGBA( 61,  0, 26, 0),
+		MakeRGBA( 63,  0, 27, 0), MakeRGBA( 65,  0, 28, 0), MakeRGBA( 66,  0, 28, 0), MakeRGBA( 68,  0, 29, 0),
+		MakeRGBA( 69,  0, 30, 0), MakeRGBA( 71,  0, 30, 0), MakeRGBA( 72,  0, 31, 0), MakeRGBA( 73,  0, 31, 0),
+		MakeRGBA( 75,  0, 32, 0), MakeRGBA( 76,  0, 33, 0), MakeRGBA( 78,  0, 33, 0), MakeRGBA( 79,  0, 34, 0),
+		MakeRGBA( 81,  0, 35, 0), MakeRGBA( 82,  0, 35, 0), MakeRGBA( 83,  0, 36, 0), MakeRGBA( 85,  0, 36, 0),
+		MakeRGBA( 86,  0, 37, 0), MakeRGBA( 88,  0, 38, 0), MakeRGBA( 89,  0, 38, 0), MakeRGBA( 90,  0, 39, 0),
+		MakeRGBA( 92,  0, 40, 0), MakeRGBA( 93,  0, 41, 0), MakeRGBA( 95,  0, 42, 0), MakeRGBA( 96,  0, 43, 0),
+		MakeRGBA( 98,  0, 44, 0), MakeRGBA( 99,  0, 45, 0), MakeRGBA(100,  0, 46, 0), MakeRGBA(102,  0, 47, 0),
+		MakeRGBA(103,  0, 48, 0), MakeRGBA(105,  0, 49, 0), MakeRGBA(106,  0, 50, 0), MakeRGBA(108,  0, 51, 0),
+		MakeRGBA(109,  0, 52, 0), MakeRGBA(110,  0, 53, 0), MakeRGBA(112,  0, 54, 0), MakeRGBA(113,  0, 55, 0),
+		MakeRGBA(115,  0, 56, 0), MakeRGBA(116,  0, 57, 0), MakeRGBA(117,  0, 58, 0), MakeRGBA(119,  0, 59, 0),
+		MakeRGBA(120,  0, 60, 0), MakeRGBA(122,  1, 61, 0), MakeRGBA(123,  1, 61, 0), MakeRGBA(125,  1, 62, 0),
+		MakeRGBA(126,  2, 63, 0), MakeRGBA(127,  2, 64, 0), MakeRGBA(129,  2, 65, 0), MakeRGBA(130,  3, 65, 0),
+		MakeRGBA(132,  3, 66, 0), MakeRGBA(133,  4, 67, 0), MakeRGBA(135,  4, 68, 0), MakeRGBA(136,  4, 69, 0),
+		MakeRGBA(137,  5, 70, 0), MakeRGBA(139,  5, 70, 0), MakeRGBA(140,  5, 71, 0), MakeRGBA(142,  6, 72, 0),
+		MakeRGBA(143,  6, 73, 0), MakeRGBA(144,  6, 74, 0), MakeRGBA(146,  7, 74, 0), MakeRGBA(147,  7, 75, 0),
+		MakeRGBA(149,  7, 77, 0), MakeRGBA(151,  7, 78, 0), MakeRGBA(152,  8, 79, 0), MakeRGBA(154,  8, 80, 0),
+		MakeRGBA(156,  8, 81, 0), MakeRGBA(157,  8, 83, 0), MakeRGBA(159,  8, 84, 0), MakeRGBA(160,  9, 85, 0),
+		MakeRGBA(162,  9, 86, 0), MakeRGBA(164,  9, 87, 0), MakeRGBA(165,  9, 89, 0), MakeRGBA(167,  9, 90, 0),
+		MakeRGBA(169, 10, 91, 0), MakeRGBA(170, 10, 92, 0), MakeRGBA(172, 10, 94, 0), MakeRGBA(173, 10, 95, 0),
+		MakeRGBA(175, 11, 96, 0), MakeRGBA(177, 11, 97, 0), MakeRGBA(178, 11, 98, 0), MakeRGBA(180, 12,100, 0),
+		MakeRGBA(181, 13,101, 0), MakeRGBA(182, 14,102, 0), MakeRGBA(183, 15,103, 0), MakeRGBA(184, 16,104, 0),
+		MakeRGBA(185, 17,105, 0), MakeRGBA(186, 18,106, 0), MakeRGBA(187, 19,107, 0), MakeRGBA(188, 20,108, 0),
+		MakeRGBA(189, 21,109, 0), MakeRGBA(190, 22,110, 0), MakeRGBA(191, 23,111, 0), MakeRGBA(192, 24,112, 0),
+		MakeRGBA(193, 25,113, 0), MakeRGBA(194, 26,114, 0), MakeRGBA(195, 27,115, 0), MakeRGBA(196, 28,116, 0),
+		MakeRGBA(197, 29,117, 0), MakeRGBA(198, 30,118, 0), MakeRGBA(199, 31,119, 0), MakeRGBA(200, 32,120, 0),
+		MakeRGBA(201, 34,121, 0), MakeRGBA(202, 35,122, 0), MakeRGBA(203, 36,124, 0), MakeRGBA(204, 38,125, 0),
+		MakeRGBA(205, 39,126, 0), MakeRGBA(206, 41,127, 0), MakeRGBA(207, 42,129, 0), MakeRGBA(208, 44,130, 0),
+		MakeRGBA(209, 45,131, 0), MakeRGBA(210, 46,132, 0), MakeRGBA(211, 48,133, 0), MakeRGBA(212, 49,135, 0),
+		MakeRGBA(213, 51,136, 0), MakeRGBA(214, 52,137, 0), MakeRGBA(215, 54,138, 0), MakeRGBA(216, 55,140, 0),
+		MakeRGBA(217, 56,141, 0), MakeRGBA(218, 58,142, 0), MakeRGBA(219, 59,143, 0), MakeRGBA(220, 61,145, 0),
+		MakeRGBA(221, 62,146, 0), MakeRGBA(222, 64,147, 0), MakeRGBA(223, 66,149, 0), MakeRGBA(224, 67,150, 0),
+		MakeRGBA(225, 69,152, 0), MakeRGBA(226, 71,153, 0), MakeRGBA(227, 72,155, 0), MakeRGBA(228, 74,156, 0),
+		MakeRGBA(229, 75,157, 0), MakeRGBA(230, 77,159, 0), MakeRGBA(231, 79,160, 0), MakeRGBA(232, 80,162, 0),
+		MakeRGBA(233, 82,163, 0), MakeRGBA(234, 84,165, 0), MakeRGBA(235, 85,166, 0), MakeRGBA(236, 87,167, 0),
+		MakeRGBA(237, 88,169, 0), MakeRGBA(238, 90,170, 0), MakeRGBA(239, 92,171, 0), MakeRGBA(239, 93,172, 0),
+		MakeRGBA(240, 94,173, 0), MakeRGBA(240, 96,174, 0), MakeRGBA(240, 97,175, 0), MakeRGBA(240, 99,175, 0),
+		MakeRGBA(240,100,176, 0), MakeRGBA(241,102,177, 0), MakeRGBA(241,103,178, 0), MakeRGBA(241,104,179, 0),
+		MakeRGBA(241,106,180, 0), MakeRGBA(241,107,180, 0), MakeRGBA(242,109,181, 0), MakeRGBA(242,110,182, 0),
+		MakeRGBA(242,112,183, 0), MakeRGBA(242,113,184, 0), MakeRGBA(242,114,184, 0), MakeRGBA(243,116,185, 0),
+		MakeRGBA(243,117,186, 0), MakeRGBA(243,119,187, 0), MakeRGBA(243,120,188, 0), MakeRGBA(243,122,188, 0),
+		MakeRGBA(244,124,189, 0), MakeRGBA(244,125,190, 0), MakeRGBA(244,127,191, 0), MakeRGBA(244,128,192, 0),
+		MakeRGBA(244,130,193, 0), MakeRGBA(245,132,193, 0), MakeRGBA(245,133,194, 0), MakeRGBA(245,135,195, 0),
+		MakeRGBA(245,137,196, 0), MakeRGBA(245,138,197, 0), MakeRGBA(246,140,197, 0), MakeRGBA(246,141,198, 0),
+		MakeRGBA(246,143,199, 0), MakeRGBA(246,145,200, 0), MakeRGBA(246,146,201, 0), MakeRGBA(247,148,201, 0),
+		MakeRGBA(247,150,202, 0), MakeRGBA(247,151,203, 0), MakeRGBA(247,153,204, 0), MakeRGBA(247,154,205, 0),
+		MakeRGBA(248,156,206, 0), MakeRGBA(248,158,207, 0), MakeRGBA(248,159,208, 0), MakeRGBA(248,161,209, 0),
+		MakeRGBA(248,162,210, 0), MakeRGBA(249,164,211, 0), MakeRGBA(249,166,212, 0), MakeRGBA(249,167,213, 0),
+		MakeRGBA(249,169,214, 0), MakeRGBA(249,171,215, 0), MakeRGBA(250,172,216, 0), MakeRGBA(250,174,217, 0),
+		MakeRGBA(250,175,218, 0), MakeRGBA(250,177,219, 0), MakeRGBA(250,179,220, 0), MakeRGBA(251,180,221, 0),
+		MakeRGBA(251,182,222, 0), MakeRGBA(251,184,223, 0), MakeRGBA(251,185,224, 0), MakeRGBA(251,187,225, 0),
+		MakeRGBA(252,188,226, 0), MakeRGBA(252,190,227, 0), MakeRGBA(252,192,227, 0), MakeRGBA(252,193,228, 0),
+		MakeRGBA(253,195,229, 0), MakeRGBA(253,197,230, 0), MakeRGBA(253,198,231, 0), MakeRGBA(253,200,231, 0),
+		MakeRGBA(253,201,232, 0), MakeRGBA(254,203,233, 0), MakeRGBA(254,205,234, 0), MakeRGBA(254,206,235, 0),
+		MakeRGBA(254,208,235, 0), MakeRGBA(254,210,236, 0), MakeRGBA(255,211,237, 0), MakeRGBA(255,213,238, 0),
+		MakeRGBA(255,214,239, 0), MakeRGBA(255,216,240, 0), MakeRGBA(255,218,240, 0), MakeRGBA(255,220,241, 0),
+		MakeRGBA(255,222,242, 0), MakeRGBA(255,225,243, 0), MakeRGBA(255,227,244, 0), MakeRGBA(255,229,244, 0),
+		MakeRGBA(255,231,245, 0), MakeRGBA(255,233,246, 0), MakeRGBA(255,235,247, 0), MakeRGBA(255,237,248, 0),
+		MakeRGBA(255,239,249, 0), MakeRGBA(255,241,249, 0), MakeRGBA(255,243,250, 0), MakeRGBA(255,245,251, 0),
+		MakeRGBA(255,247,252, 0), MakeRGBA(255,249,253, 0), MakeRGBA(255,251,253, 0), MakeRGBA(255,253,254, 0),
+	},
 
-const uint32 * const _recolour_palettes[18] = {
-	_recolour00,
-	_recolour01,
-	_recolour02,
-	_recolour03,
-	_recolour04,
-	_recolour05,
-	_recolour06,
-	_recolour07,
-	_recolour08,
-	_recolour09,
-	_recolour10,
-	_recolour11,
-	_recolour12,
-	_recolour13,
-	_recolour14,
-	_recolour15,
-	_recolour16,
-	_recolour17,
+	/* Recolour table for ColourRange::COL_RANGE_BROWN. */
+	{
+		MakeRGBA(  0,  0,  0, 0), MakeRGBA(  2,  1,  0, 0), MakeRGBA(  4,  2,  0, 0), MakeRGBA(  6,  3,  0, 0),
+		MakeRGBA(  8,  4,  0, 0), MakeRGBA( 10,  5,  0, 0), MakeRGBA( 12,  6,  0, 0), MakeRGBA( 14,  7,  0, 0),
+		MakeRGBA( 16,  8,  0, 0), MakeRGBA( 18,  9,  0, 0), MakeRGBA( 20, 10,  0, 0), MakeRGBA( 22, 11,  0, 0),
+		MakeRGBA( 24, 12,  0, 0), MakeRGBA( 26, 13,  0, 0), MakeRGBA( 28, 14,  0, 0), MakeRGBA( 30, 14,  0, 0),
+		MakeRGBA( 32, 15,  0, 0), MakeRGBA( 34, 16,  0, 0), MakeRGBA( 36, 17,  0, 0), MakeRGBA( 38, 18,  0, 0),
+		MakeRGBA( 39, 19,  0, 0), MakeRGBA( 40, 20,  0, 0), MakeRGBA( 41, 20,  1, 0), MakeRGBA( 42, 21,  1, 0),
+		MakeRGBA( 43, 22,  2, 0), MakeRGBA( 43, 22,  2, 0), MakeRGBA( 44, 23,  2, 0), MakeRGBA( 45, 23,  3, 0),
+		MakeRGBA( 46, 24,  3, 0), MakeRGBA( 47, 25,  3, 0), MakeRGBA( 47, 25,  4, 0), MakeRGBA( 48, 26,  4, 0),
+		MakeRGBA( 49, 27,  4, 0), MakeRGBA( 50, 27,  5, 0), MakeRGBA( 51, 28,  5, 0), MakeRGBA( 51, 28,  5, 0),
+		MakeRGBA( 52, 29,  6, 0), MakeRGBA( 53, 30,  6, 0), MakeRGBA( 54, 30,  7, 0), MakeRGBA( 55, 31,  7, 0),
+		MakeRGBA( 56, 32,  7, 0), MakeRGBA( 56, 32,  8, 0), MakeRGBA( 57, 33,  8, 0), MakeRGBA( 58, 34,  8, 0),
+		MakeRGBA( 59, 35,  9, 0), MakeRGBA( 60, 36,  9, 0), MakeRGBA( 60, 36, 10, 0), MakeRGBA( 61, 37, 10, 0),
+		MakeRGBA( 62, 38, 11, 0), MakeRGBA( 63, 39, 11, 0), MakeRGBA( 64, 40, 11, 0), MakeRGBA( 64, 40, 12, 0),
+		MakeRGBA( 65, 41, 12, 0), MakeRGBA( 66, 42, 13, 0), MakeRGBA( 67, 43, 13, 0), MakeRGBA( 68, 44, 13, 0),
+		MakeRGBA( 69, 45, 14, 0), MakeRGBA( 69, 45, 14, 0), MakeRGBA( 70, 46, 15, 0), MakeRGBA( 71, 47, 15, 0),
+		MakeRGBA( 72, 48, 16, 0), MakeRGBA( 73, 49, 17, 0), MakeRGBA( 74, 49, 17, 0), MakeRGBA( 75, 50, 18, 0),
+		MakeRGBA( 76, 51, 19, 0), MakeRGBA( 77, 52, 20, 0), MakeRGBA( 78, 53, 21, 0), MakeRGBA( 79, 53, 21, 0),
+		MakeRGBA( 80, 54, 22, 0), MakeRGBA( 81, 55, 23, 0), MakeRGBA( 82, 56, 24, 0), MakeRGBA( 83, 57, 25, 0),
+		MakeRGBA( 84, 58, 25, 0), MakeRGBA( 85, 58, 26, 0), MakeRGBA( 86, 59, 27, 0), MakeRGBA( 87, 60, 28, 0),
+		MakeRGBA( 88, 61, 29, 0), MakeRGBA( 89, 62, 30, 0), MakeRGBA( 90, 62, 30, 0), MakeRGBA( 91, 63, 31, 0),
+		MakeRGBA( 92, 64, 32, 0), MakeRGBA( 93, 65, 33, 0), MakeRGBA( 94, 66, 34, 0), MakeRGBA( 94, 67, 35, 0),
+		MakeRGBA( 95, 68, 36, 0), MakeRGBA( 96, 69, 37, 0), MakeRGBA( 97, 70, 38, 0), MakeRGBA( 98, 71, 39, 0),
+		MakeRGBA( 99, 72, 40, 0), MakeRGBA( 99, 73, 41, 0), MakeRGBA(100, 74, 42, 0), MakeRGBA(101, 75, 43, 0),
+		MakeRGBA(102, 76, 44, 0), MakeRGBA(103, 77, 45, 0), MakeRGBA(103, 78, 46, 0), MakeRGBA(104, 79, 47, 0),
+		MakeRGBA(105, 81, 49, 0), MakeRGBA(106, 82, 50, 0), MakeRGBA(107, 83, 51, 0), MakeRGBA(107, 84, 52, 0),
+		MakeRGBA(108, 85, 53, 0), MakeRGBA(109, 86, 54, 0), MakeRGBA(110, 87, 55, 0), MakeRGBA(111, 88, 57, 0),
+		MakeRGBA(112, 89, 58, 0), MakeRGBA(112, 90, 59, 0), MakeRGBA(113, 91, 60, 0), MakeRGBA(114, 92, 61, 0),
+		MakeRGBA(115, 93, 63, 0), MakeRGBA(116, 94, 64, 0), MakeRGBA(116, 95, 65, 0), MakeRGBA(117, 96, 66, 0),
+		MakeRGBA(118, 97, 68, 0), MakeRGBA(119, 98, 69, 0), MakeRGBA(120, 99, 70, 0), MakeRGBA(120,100, 71, 0),
+		MakeRGBA(121,101, 72, 0), MakeRGBA(122,102, 74, 0), MakeRGBA(123,103, 75, 0), MakeRGBA(124,104, 76, 0),
+		MakeRGBA(125,105, 78, 0), MakeRGBA(126,106, 80, 0), MakeRGBA(127,108, 81, 0), MakeRGBA(128,109, 83, 0),
+		MakeRGBA(129,110, 84, 0), MakeRGBA(130,111, 86, 0), MakeRGBA(131,113, 88, 0), MakeRGBA(132,114, 89, 0),
+		MakeRGBA(133,115, 91, 0), MakeRGBA(134,116, 93, 0), MakeRGBA(135,117, 94, 0), MakeRGBA(136,119, 96, 0),
+		MakeRGBA(137,120, 97, 0), MakeRGBA(138,121, 99, 0), MakeRGBA(139,122,101, 0), MakeRGBA(140,124,102, 0),
+		MakeRGBA(141,125,104, 0), MakeRGBA(142,126,106, 0), MakeRGBA(143,127,107, 0), MakeRGBA(144,128,108, 0),
+		MakeRGBA(145,129,109, 0), MakeRGBA(146,130,110, 0), MakeRGBA(147,131,111, 0), MakeRGBA(148,132,112, 0),
+		MakeRGBA(149,133,113, 0), MakeRGBA(150,134,114, 0), MakeRGBA(151,135,115, 0), MakeRGBA(152,136,116, 0),
+		MakeRGBA(153,137,117, 0), MakeRGBA(154,138,118, 0), MakeRGBA(155,139,119, 0), MakeRGBA(156,140,120, 0),
+		MakeRGBA(157,141,121, 0), MakeRGBA(158,142,122, 0), MakeRGBA(159,143,123, 0), MakeRGBA(160,144,124, 0),
+		MakeRGBA(161,145,125, 0), MakeRGBA(162,146,126, 0), MakeRGBA(164,148,127, 0), MakeRGBA(165,149,128, 0),
+		MakeRGBA(166,150,130, 0), MakeRGBA(167,151,131, 0), MakeRGBA(168,152,132, 0), MakeRGBA(170,154,133, 0),
+		MakeRGBA(171,155,134, 0), MakeRGBA(172,156,135, 0), MakeRGBA(173,157,136, 0), MakeRGBA(175,159,137, 0),
+		MakeRGBA(176,160,138, 0), MakeRGBA(177,161,139, 0), MakeRGBA(178,162,140, 0), MakeRGBA(179,163,141, 0),
+		MakeRGBA(181,165,142, 0), MakeRGBA(182,166,143, 0), MakeRGBA(183,167,144, 0), MakeRGBA(184,168,145, 0),
+		MakeRGBA(186,170,146, 0), MakeRGBA(187,171,147, 0), MakeRGBA(188,172,148, 0), MakeRGBA(189,173,149, 0),
+		MakeRGBA(190,174,150, 0), MakeRGBA(191,176,152, 0), MakeRGBA(192,177,153, 0), MakeRGBA(193,178,154, 0),
+		MakeRGBA(194,179,155, 0), MakeRGBA(195,180,156, 0), MakeRGBA(196,182,158, 0), MakeRGBA(197,183,159, 0),
+		MakeRGBA(198,184,160, 0), MakeRGBA(199,185,161, 0), MakeRGBA(200,187,163, 0), MakeRGBA(201,188,164, 0),
+		MakeRGBA(202,189,165, 0), MakeRGBA(203,190,166, 0), MakeRGBA(204,191,167, 0), MakeRGBA(205,193,169, 0),
+		MakeRGBA(206,194,170, 0), MakeRGBA(207,195,171, 0), MakeRGBA(208,196,172, 0), MakeRGBA(210,198,174, 0),
+		MakeRGBA(211,199,175, 0), MakeRGBA(212,200,176, 0), MakeRGBA(213,201,177, 0), MakeRGBA(214,202,178, 0),
+		MakeRGBA(216,204,180, 0), MakeRGBA(217,205,181, 0), MakeRGBA(218,206,182, 0), MakeRGBA(219,207,183, 0),
+		MakeRGBA(221,209,185, 0), MakeRGBA(222,210,186, 0), MakeRGBA(223,211,187, 0), MakeRGBA(224,212,188, 0),
+		MakeRGBA(225,213,189, 0), MakeRGBA(227,215,191, 0), MakeRGBA(228,216,192, 0), MakeRGBA(229,217,193, 0),
+		MakeRGBA(230,218,194, 0), MakeRGBA(231,219,196, 0), MakeRGBA(233,221,197, 0), MakeRGBA(234,222,198, 0),
+		MakeRGBA(235,223,200, 0), MakeRGBA(236,224,201, 0), MakeRGBA(238,226,203, 0), MakeRGBA(239,227,204, 0),
+		MakeRGBA(240,228,205, 0), MakeRGBA(241,229,207, 0), MakeRGBA(242,230,208, 0), MakeRGBA(244,232,210, 0),
+		MakeRGBA(245,233,211, 0), MakeRGBA(246,234,213, 0), MakeRGBA(247,235,214, 0), MakeRGBA(249,237,215, 0),
+		MakeRGBA(250,238,217, 0), MakeRGBA(251,239,218, 0), MakeRGBA(252,240,220, 0), MakeRGBA(253,241,221, 0),
+		MakeRGBA(255,243,223, 0), MakeRGBA(255,243,224, 0), MakeRGBA(255,244,226, 0), MakeRGBA(255,245,227, 0),
+		MakeRGBA(255,245,229, 0), MakeRGBA(255,246,231, 0), MakeRGBA(255,246,232, 0), MakeRGBA(255,247,234, 0),
+		MakeRGBA(255,248,235, 0), MakeRGBA(255,248,237, 0), MakeRGBA(255,249,239, 0), MakeRGBA(255,250,240, 0),
+		MakeRGBA(255,250,242, 0), MakeRGBA(255,251,244, 0), MakeRGBA(255,251,245, 0), MakeRGBA(255,252,247, 0),
+		MakeRGBA(255,253,248, 0), MakeRGBA(255,253,250, 0), MakeRGBA(255,254,252, 0), MakeRGBA(255,254,253, 0),
+	},
 };
-
@@ -0,0 +1,137 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file replay.cpp Recording and replaying of game sessions.
+ *
+ * A replay file is a small text file referencing a savegame snapshot next to it:
+ * <pre>
+ *   seed NUMBER          random seed at the start of the session
+ *   save FILE            savegame with the start state (written as replay file + ".sav")
+ *   speed TICK VALUE     the user changed the game speed
+ *   action TICK VALUE    a game control action ran (see #GameControlAction)
+ *   end TICK             number of simulation ticks in the session
+ * </pre>
+ * Since the simulation advances in fixed ticks of #SIMULATION_TICK_MS and all game
+ * randomness flows through #Random, loading the snapshot, restoring the seed and
+ * running the recorded number of ticks reproduces the session tick-exactly.
+ */
+
+#include "stdafx.h"
+#include "replay.h"
+#include "loadsave.h"
+#include "random.h"
+
+#include <fstream>
+
+ReplayRecorder _replay_recorder;  ///< Recorder of the current session, if requested.
+
+ReplayRecorder::ReplayRecorder() : file(nullptr)
+{
+}
+
+/**
+ * Request recording of the next game session.
+ * Recording starts when a level starts running, see #Start.
+ * @param path File to record the session to.
+ */
+void ReplayRecorder::Arm(const std::string &path)
+{
+	this->path = path;
+}
+
+/**
+ * Start a recording if one was requested: snapshot the current game state and
+ * random seed, then log events until #Stop. Called when a level starts running.
+ */
+void ReplayRecorder::Start()
+{
+	if (this->path.empty() || this->file != nullptr) return;
+
+	const std::string save_path = this->path + ".sav";
+	if (!SaveGameFile(save_path.c_str())) {
+		fprintf(stderr, "Could not write replay snapshot '%s', recording disabled.\n", save_path.c_str());
+		this->path.clear();
+		return;
+	}
+
+	this->file = fopen(this->path.c_str(), "wt");
+	if (this->file == nullptr) {
+		fprintf(stderr, "Could not open replay file '%s' for writing, recording disabled.\n", this->path.c_str());
+		this->path.clear();
+		return;
+	}
+	fprintf(this->file, "seed %u\n", Random::GetSeed());
+	fprintf(this->file, "save %s\n", save_path.c_str());
+}
+
+/** Finish and close the recording, if one is running. */
+void ReplayRecorder::Stop()
+{
+	if (this->file == nullptr) return;
+	fprintf(this->file, "end %u\n", _simulation_tick);
+	fclose(this->file);
+	this->file = nullptr;
+	this->path.clear();
+}
+
+/**
+ * Log a game speed change of the user.
+ * @param speed The new speed.
+ */
+void ReplayRecorder::LogSpeed(GameSpeed speed)
+{
+	fprintf(this->file, "speed %u %d\n", _simulation_tick, static_cast<int>(speed));
+}
+
+/**
+ * Log an executed game control action.
+ * @param action The action that ran.
+ */
+void ReplayRecorder::LogAction(GameControlAction action)
+{
+	fprintf(this->file, "action %u %d\n", _simulation_tick, static_cast<int>(action));
+}
+
+/**
+ * Load and parse a recorded replay file.
+ * @param path File to load.
+ * @return Whether the file could be parsed.
+ */
+bool ReplayLog::Load(const std::string &path)
+{
+	this->seed = 0;
+	this->save.clear();
+	this->end_tick = 0;
+	this->events.clear();
+
+	std::ifstream stream(path);
+	if (!stream.is_open()) return false;
+
+	std::string line;
+	while (std::getline(stream, line)) {
+		if (line.empty()) continue;
+		uint32 tick;
+		int value;
+		if (sscanf(line.c_str(), "seed %u", &this->seed) == 1) continue;
+		if (line.compare(0, 5, "save ") == 0) {
+			this->save = line.substr(5);
+			continue;
+		}
+		if (sscanf(line.c_str(), "speed %u %d", &tick, &value) == 2) {
+			this->events.push_back({tick, 's', value});
+			continue;
+		}
+		if (sscanf(line.c_str(), "action %u %d", &tick, &value) == 2) {
+			this->events.push_back({tick, 'a', value});
+			continue;
+		}
+		if (sscanf(line.c_str(), "end %u", &this->end_tick) == 1) continue;
+		fprintf(stderr, "Skipping unrecognized replay line '%s'.\n", line.c_str());
+	}
+	return !this->save.empty() && this->end_tick > 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file replay.h Recording and replaying of game sessions for regression testing. */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "stdafx.h"
+#include "gamecontrol.h"
+
+#include <vector>
+
+/** One user-originated event in a replay. */
+struct ReplayEvent {
+	uint32 tick;  ///< Simulation tick the event happened at.
+	char type;    ///< Event type, \c 's' for a speed change, \c 'a' for a game control action.
+	int value;    ///< New speed (#GameSpeed) or executed action (#GameControlAction).
+};
+
+/**
+ * Recorder of a game session: the random seed, a savegame snapshot of the start
+ * state, and the stream of user-originated events with their tick stamps.
+ * The recording can be replayed tick-exactly by the headless benchmark.
+ */
+class ReplayRecorder {
+public:
+	ReplayRecorder();
+
+	void Arm(const std::string &path);
+	void Start();
+	void Stop();
+
+	/** @return Whether a recording is currently running. */
+	inline bool Active() const
+	{
+		return this->file != nullptr;
+	}
+
+	void LogSpeed(GameSpeed speed);
+	void LogAction(GameControlAction action);
+
+private:
+	std::string path;  ///< File to record to, empty when recording was not requested.
+	FILE *file;        ///< Open replay file, \c nullptr while not recording.
+};
+
+extern ReplayRecorder _replay_recorder;
+
+/** Parsed contents of a recorded replay file. */
+class ReplayLog {
+public:
+	bool Load(const std::string &path);
+
+	uint32 seed;                      ///< Random seed at the start of the session.
+	std::string save;                 ///< Savegame holding the start state of the session.
+	uint32 end_tick;                  ///< Number of simulation ticks in the session.
+	std::vector<ReplayEvent> events;  ///< Recorded events, ordered by tick.
+};
+
+#endif
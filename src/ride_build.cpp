@@ -84,6 +84,7 @@ private:
 	StringID str_titlebar;  ///< String to use for the titlebar of the window.
 	FixedRideInstance *instance; ///< Instance to build, set to \c nullptr after build to prevent deletion of the instance.
 	TileEdge orientation;   ///< Orientation of the simple ride.
+	int shown_zoom;         ///< Zoom scale the selector preview was built for, \c -1 if the selector is empty.
 	BestErrorMessageReason build_forbidden_reason;  ///< Reason why we may not place the instance at the given location, if any.
 
 	bool CanPlaceFixedRide(const FixedRideType *selected_ride, const XYZPoint16 &pos, uint8 ride_orient, ViewOrientation vp_orient);
@@ -99,6 +100,7 @@ RideBuildWindow::RideBuildWindow(FixedRideInstance *ri)
   ri->GetIndex()),
   instance(ri),
   orientation(EDGE_SE),
+  shown_zoom(-1),
   build_forbidden_reason(BestErrorMessageReason::ACT_BUILD)
 {
 	switch (ri->GetKind()) {
@@ -339,13 +341,18 @@ void RideBuildWindow::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 	Point32 wxy = vp->ComputeHorizontalTranslation(vp->rect.width / 2 - pos.x, vp->rect.height / 2 - pos.y);
 
 	/* Clean current display if needed. */
-	switch (this->ComputeFixedRideVoxel(XYZPoint32(wxy.x, wxy.y, vp->view_pos.z), vp->orientation)) {
+	const RidePlacementResult placement = this->ComputeFixedRideVoxel(XYZPoint32(wxy.x, wxy.y, vp->view_pos.z), vp->orientation);
+	switch (placement) {
 		case RPR_FAIL:
 			this->selector.SetSize(0, 0);
+			this->shown_zoom = -1; // The selector was cleared, rebuild it even for a same-position hit.
 			return;
 
 		case RPR_SAMEPOS:
 		case RPR_CHANGED: {
+			/* The selector still displays the correct preview, don't rebuild it every mouse move. */
+			if (placement == RPR_SAMEPOS && this->shown_zoom == vp->zoom) return;
+
 			/// \todo Let the ride do this.
 			assert(this->instance != nullptr);
 
@@ -379,6 +386,7 @@ void RideBuildWindow::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 							_sprite_manager.GetSprite(vp->zoom, &SpriteStorage::GetArrowSprite, this->instance->orientation, vp->orientation) : nullptr);
 				}
 			}
+			this->shown_zoom = vp->zoom;
 			return;
 		}
 
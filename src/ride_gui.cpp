@@ -114,6 +114,8 @@ static const WidgetPart _ride_select_gui_parts[] = {
 
 RideSelectGui::RideSelectGui() : GuiWindow(WC_RIDE_SELECT, ALL_WINDOWS_OF_TYPE)
 {
+	_rides_manager.RefreshDesigns(); // Pick up track design files that appeared or changed since they were loaded.
+
 	this->SetupWidgetTree(_ride_select_gui_parts, lengthof(_ride_select_gui_parts));
 	this->SetScrolledWidget(RSEL_LIST, RSEL_SCROLL_LIST);
 	this->SetScrolledWidget(RSEL_DESIGN, RSEL_SCROLL_DESIGN);
@@ -526,6 +526,7 @@ void RideInstance::BreakDown()
 {
 	if (this->broken) return;
 	this->broken = true;
+	InvalidateExitDesireCache();
 	_inbox.SendMessage(new Message(GUI_MESSAGE_BROKEN_DOWN, this->GetIndex()));
 	this->CallMechanic();
 }
@@ -533,7 +534,11 @@ void RideInstance::BreakDown()
 /** Request a mechanic to inspect or repair this ride. */
 void RideInstance::CallMechanic()
 {
-	if (this->mechanic_pending) return;
+	if (this->mechanic_pending) {
+		/* A breakdown outranks a routine inspection that is still waiting in the queue. */
+		if (this->broken) _staff.PromoteMechanicRequest(this);
+		return;
+	}
 	_staff.RequestMechanic(this);
 	this->mechanic_pending = true;
 }
@@ -544,6 +549,7 @@ void RideInstance::MechanicArrived()
 	assert(this->mechanic_pending);
 	if (this->broken) _inbox.SendMessage(new Message(GUI_MESSAGE_REPAIRED, this->GetIndex()));
 	this->broken = false;
+	InvalidateExitDesireCache();
 	this->time_since_last_maintenance = 0;
 	this->reliability = this->max_reliability;
 	this->mechanic_pending = false;
@@ -566,7 +572,9 @@ void RideInstance::OpenRide()
 {
 	assert(this->CanOpenRide());
 	this->state = RIS_OPEN;
+	_rides_manager.RideOpened();
 	this->time_since_last_long_queue_message = 0;
+	InvalidateExitDesireCache();
 
 	/* Perform payments if they have not been done this month. */
 	if (GB(this->flags, RIF_MONTHLY_PAID, 1) == 0) {
@@ -588,8 +596,10 @@ void RideInstance::OpenRide()
  */
 void RideInstance::CloseRide()
 {
+	if (this->state == RIS_OPEN) _rides_manager.RideClosed();
 	this->state = RIS_CLOSED;
 	this->RemoveAllPeople();
+	InvalidateExitDesireCache();
 }
 
 /**
@@ -600,6 +610,7 @@ void RideInstance::BuildRide()
 {
 	assert(this->state != RIS_OPEN);
 	this->state = RIS_BUILDING;
+	InvalidateExitDesireCache();
 }
 
 /** Inform this ride that the queue is very long. This might send a message to the player. */
@@ -704,6 +715,16 @@ void RidesManager::OnNewDay()
 	}
 }
 
+/**
+ * Count the number of rides that are currently open for the public.
+ * The count is kept in sync by ride state changes, so querying it is cheap.
+ * @return The number of open rides.
+ */
+uint16 RidesManager::CountOpenRides() const
+{
+	return this->open_ride_count;
+}
+
 static const uint32 CURRENT_VERSION_RIDS = 4;   ///< Currently supported version of the RIDS Pattern.
 
 void RidesManager::Load(Loader &ldr)
@@ -749,6 +770,13 @@ void RidesManager::Load(Loader &ldr)
 	} else if (version != 0) {
 		ldr.VersionMismatch(version, CURRENT_VERSION_RIDS);
 	}
+
+	/* Loading restored the ride states directly, rebuild the aggregate. */
+	this->open_ride_count = 0;
+	for (const auto &pair : this->instances) {
+		if (pair.second->state == RIS_OPEN) this->open_ride_count++;
+	}
+
 	ldr.ClosePattern();
 }
 
@@ -987,7 +1015,9 @@ void RidesManager::DeleteInstance(uint16 num)
 	_inbox.NotifyRideDeletion(num + SRI_FULL_RIDES);
 	_guests.NotifyRideDeletion(it->second.get());
 	_staff.NotifyRideDeletion(it->second.get());
+	InvalidateExitDesireCache();  // Cached exits may point at the deleted ride.
 
+	if (it->second->state == RIS_OPEN) this->RideClosed();  // Normally it is already closed, but be safe.
 	it->second->RemoveFromWorld();
 	this->instances.erase(it);  // Deletes the instance.
 }
@@ -1013,12 +1043,11 @@ void RidesManager::LoadDesigns()
 void RidesManager::LoadDesign(const std::string &file)
 {
 	try {
-		FILE *fp = fopen(file.c_str(), "rb");
-		if (fp == nullptr) throw LoadingError("Could not open file for reading");
+		FileContents contents(file);
+		if (contents.Data() == nullptr) throw LoadingError("Could not open file for reading");
 
-		Loader ldr(fp);
+		Loader ldr(contents.Data(), contents.Size());
 		TrackedRideDesign t(ldr);  // This loads the design.
-		fclose(fp);
 
 		if (t.name.empty()) throw LoadingError("Unnamed design");
 		if (t.pieces.empty()) throw LoadingError("No tracks in ride");
@@ -1027,11 +1056,48 @@ void RidesManager::LoadDesign(const std::string &file)
 		if (r == nullptr) throw LoadingError("Unknown ride type '%s'", t.ride.c_str());
 
 		r->designs.push_back(t);
+
+		uint64 fsize;
+		int64 mtime;
+		if (GetFileStats(file, &fsize, &mtime)) this->design_files[file] = DesignFileInfo{fsize, mtime, t.ride, t.name};
 	} catch (const LoadingError &e) {
 		fprintf(stderr, "WARNING: Error loading track design from '%s': %s\n", file.c_str(), e.what());
 	}
 }
 
+/**
+ * Pick up track design files in the user's track design directory that were added or changed
+ * on disk since they were loaded. Unchanged files are recognized by their size and modification
+ * time and are not re-read; a changed file replaces the design loaded from its previous contents.
+ */
+void RidesManager::RefreshDesigns()
+{
+	for (const std::string &file : GetAllEntries(TrackDesignDirectory())) {
+		if (!StrEndsWith(file.c_str(), ".ftk", false)) continue;
+
+		uint64 fsize;
+		int64 mtime;
+		if (!GetFileStats(file, &fsize, &mtime)) continue;
+		const auto iter = this->design_files.find(file);
+		if (iter != this->design_files.end()) {
+			if (iter->second.size == fsize && iter->second.mtime == mtime) continue; // Unchanged, keep the loaded design.
+
+			/* The file changed, drop the design loaded from its previous contents. */
+			const RideType *r = this->GetRideType(iter->second.ride);
+			if (r != nullptr) {
+				for (auto it = r->designs.begin(); it != r->designs.end(); ++it) {
+					if (it->name == iter->second.name) {
+						r->designs.erase(it);
+						break;
+					}
+				}
+			}
+			this->design_files.erase(iter);
+		}
+		this->LoadDesign(file);
+	}
+}
+
 /**
  * Load a track design.
  * @param rcd_file Rcd file being loaded.
@@ -274,11 +274,27 @@ public:
 	void OnNewMonth();
 	void OnNewDay();
 
+	uint16 CountOpenRides() const;
+
+	/** A ride was opened for the public. Keeps the park rating aggregate in sync. */
+	inline void RideOpened()
+	{
+		this->open_ride_count++;
+	}
+
+	/** An open ride was closed or deleted. Keeps the park rating aggregate in sync. */
+	inline void RideClosed()
+	{
+		assert(this->open_ride_count > 0);
+		this->open_ride_count--;
+	}
+
 	void Load(Loader &ldr);
 	void Save(Saver &svr);
 	void LoadDesigns();
 	void LoadDesign(const std::string &file);
 	void LoadDesign(RcdFileReader *rcd_file);
+	void RefreshDesigns();
 
 	/**
 	 * Get a ride type from the class.
@@ -298,6 +314,19 @@ public:
 	std::map<uint16, std::unique_ptr<RideInstance>> instances;           ///< Rides available in the park.
 	std::vector<std::unique_ptr<const RideEntranceExitType>> entrances;  ///< Available ride entrance types.
 	std::vector<std::unique_ptr<const RideEntranceExitType>> exits;      ///< Available ride exit types.
+
+private:
+	/** Remembered state of a loaded track design file, to recognize new and changed files. */
+	struct DesignFileInfo {
+		uint64 size;       ///< Size of the file when it was loaded.
+		int64 mtime;       ///< Modification time of the file when it was loaded.
+		std::string ride;  ///< Internal name of the ride type of the design.
+		std::string name;  ///< Name of the design.
+	};
+
+	std::map<std::string, DesignFileInfo> design_files;  ///< Track design files loaded from disk, by file path.
+
+	uint16 open_ride_count = 0;  ///< Number of rides in state #RIS_OPEN, kept in sync by ride state changes.
 };
 
 RideInstance *RideExistsAtBottom(XYZPoint16 pos, TileEdge edge);
@@ -9,6 +9,8 @@
 
 #include "scenery.h"
 
+#include "density_map.h"
+
 #include "fileio.h"
 #include "gamecontrol.h"
 #include "generated/scenery_strings.h"
@@ -613,8 +615,8 @@ void SceneryInstance::RemoveFromWorld()
 			for (int16 h = 0; h < height; h++) {
 				const XYZPoint16 p = this->vox_pos + XYZPoint16(unrotated_pos.x, unrotated_pos.y, h);
 				Voxel *voxel = _world.GetCreateVoxel(p, false);
-				if (voxel != nullptr && voxel->instance != SRI_FREE) {
-					assert(voxel->instance == SRI_SCENERY);
+				if (voxel != nullptr && voxel->GetInstance() != SRI_FREE) {
+					assert(voxel->GetInstance() == SRI_SCENERY);
 					assert(voxel->instance_data == (h == 0 ? voxel_data : INVALID_VOXEL_DATA));
 					voxel->ClearInstances();
 				}
@@ -623,6 +625,19 @@ void SceneryInstance::RemoveFromWorld()
 	}
 }
 
+/**
+ * Check whether a voxel belongs to this item's footprint.
+ * @param pos Absolute voxel in the world.
+ * @return The voxel is one of the base voxels occupied by this item.
+ */
+bool SceneryInstance::Occupies(const XYZPoint16 &pos) const
+{
+	if (pos.z != this->vox_pos.z) return false;
+	const XYZPoint16 corner = this->vox_pos + OrientatedOffset(this->orientation, this->type->width_x - 1, this->type->width_y - 1);
+	return pos.x >= std::min(this->vox_pos.x, corner.x) && pos.x <= std::max(this->vox_pos.x, corner.x) &&
+			pos.y >= std::min(this->vox_pos.y, corner.y) && pos.y <= std::max(this->vox_pos.y, corner.y);
+}
+
 /**
  * Get the sprites to display for the provided voxel number.
  * @param vox The voxel's absolute coordinates.
@@ -653,8 +668,19 @@ void SceneryInstance::OnAnimate(const int delay)
 {
 	if (this->type->watering_interval > 0) this->time_since_watered += delay;
 	const TimedAnimation *anim = (this->IsDry() ? this->type->dry_animation : this->type->main_animation);
+	const int old_frame = anim->GetFrame(this->animtime, true);
 	this->animtime += delay;
 	this->animtime %= anim->GetTotalDuration();
+
+	if (anim->GetFrame(this->animtime, true) != old_frame) {
+		/* The displayed frame changed, redraw the item's columns. */
+		for (int8 x = 0; x < this->type->width_x; x++) {
+			for (int8 y = 0; y < this->type->width_y; y++) {
+				const XYZPoint16 pos = this->vox_pos + OrientatedOffset(this->orientation, x, y);
+				_world_dirty.MarkColumn(pos.x, pos.y);
+			}
+		}
+	}
 }
 
 /**
@@ -782,15 +808,40 @@ void SceneryManager::Clear()
 	/* Do not use std::map::clear(), it may result in a heap-use-after-free. */
 	while (!this->litter_and_vomit.empty()) this->litter_and_vomit.erase(this->litter_and_vomit.begin());
 	while (!this->all_path_objects.empty()) this->all_path_objects.erase(this->all_path_objects.begin());
+	this->path_object_slots.clear();
+}
+
+/**
+ * Get the packed path-object slot of a voxel, creating it when not present yet.
+ * @param pos Position of the voxel.
+ * @return The slot of the voxel.
+ */
+SceneryManager::PathObjectSlot &SceneryManager::GetPathObjectSlot(const XYZPoint16 &pos)
+{
+	return this->path_object_slots[VoxelKey(pos)];
+}
+
+/**
+ * Drop the packed path-object slot of a voxel again when it became empty,
+ * keeping the slot table as small as the set of decorated voxels.
+ * @param pos Position of the voxel.
+ */
+void SceneryManager::PrunePathObjectSlot(const XYZPoint16 &pos)
+{
+	const auto it = this->path_object_slots.find(VoxelKey(pos));
+	if (it != this->path_object_slots.end() && it->second.object == nullptr && it->second.dirt_count == 0) {
+		this->path_object_slots.erase(it);
+	}
 }
 
 /**
  * Some time has passed, update the state of the scenery items.
+ * Only animated items change over time; the static majority is not visited.
  * @param delay Number of milliseconds that passed.
  */
 void SceneryManager::OnAnimate(const int delay)
 {
-	for (auto &pair : this->all_items) pair.second->OnAnimate(delay);
+	for (SceneryInstance *item : this->animated_items) item->OnAnimate(delay);
 }
 
 /**
@@ -803,9 +854,42 @@ void SceneryManager::AddItem(SceneryInstance *item)
 {
 	assert(this->all_items.count(item->vox_pos) == 0);
 	this->all_items[item->vox_pos] = std::unique_ptr<SceneryInstance>(item);
+	if (item->type->IsAnimated()) this->animated_items.push_back(item);
+	this->IndexItem(item);
 	item->InsertIntoWorld();
 }
 
+/**
+ * Register an item in the footprint index and the per-type counters.
+ * @param item Item being added to the world.
+ */
+void SceneryManager::IndexItem(SceneryInstance *item)
+{
+	for (int8 x = 0; x < item->type->width_x; x++) {
+		for (int8 y = 0; y < item->type->width_y; y++) {
+			const XYZPoint16 offset = OrientatedOffset(item->orientation, x, y);
+			this->item_owner_index[VoxelKey(item->vox_pos + XYZPoint16(offset.x, offset.y, 0))] = item;
+		}
+	}
+	this->type_counts[item->type]++;
+}
+
+/**
+ * Remove an item from the footprint index and the per-type counters.
+ * @param item Item being removed from the world.
+ */
+void SceneryManager::UnindexItem(SceneryInstance *item)
+{
+	for (int8 x = 0; x < item->type->width_x; x++) {
+		for (int8 y = 0; y < item->type->width_y; y++) {
+			const XYZPoint16 offset = OrientatedOffset(item->orientation, x, y);
+			this->item_owner_index.erase(VoxelKey(item->vox_pos + XYZPoint16(offset.x, offset.y, 0)));
+		}
+	}
+	assert(this->type_counts[item->type] > 0);
+	this->type_counts[item->type]--;
+}
+
 /**
  * Remove an item from the world.
  * @param pos Base position of the item to delete.
@@ -814,6 +898,10 @@ void SceneryManager::RemoveItem(const XYZPoint16 &pos)
 {
 	auto it = this->all_items.find(pos);
 	assert(it != this->all_items.end());
+	if (it->second->type->IsAnimated()) {
+		this->animated_items.erase(std::find(this->animated_items.begin(), this->animated_items.end(), it->second.get()));
+	}
+	this->UnindexItem(it->second.get());
 	this->all_items.erase(it);  // This deletes the instance.
 }
 
@@ -823,7 +911,8 @@ void SceneryManager::RemoveItem(const XYZPoint16 &pos)
  */
 uint SceneryManager::CountLitterAndVomit(const XYZPoint16 &pos) const
 {
-	return this->litter_and_vomit.count(pos);
+	const auto it = this->path_object_slots.find(VoxelKey(pos));
+	return it == this->path_object_slots.end() ? 0 : it->second.dirt_count;
 }
 
 /**
@@ -832,12 +921,12 @@ uint SceneryManager::CountLitterAndVomit(const XYZPoint16 &pos) const
  */
 uint8 SceneryManager::CountDemolishedItems(const XYZPoint16 &pos) const
 {
-	const auto it = this->all_path_objects.find(pos);
-	if (it == this->all_path_objects.end()) return 0;
+	const auto it = this->path_object_slots.find(VoxelKey(pos));
+	if (it == this->path_object_slots.end() || it->second.object == nullptr) return 0;
 
 	uint8 result = 0;
 	for (TileEdge e = EDGE_BEGIN; e != EDGE_COUNT; e++) {
-		if (it->second->GetExistsOnTileEdge(e) && it->second->GetDemolishedOnTileEdge(e)) {
+		if (it->second.object->GetExistsOnTileEdge(e) && it->second.object->GetDemolishedOnTileEdge(e)) {
 			result++;
 		}
 	}
@@ -853,8 +942,12 @@ void SceneryManager::SetPathObjectInstance(const XYZPoint16 &pos, const PathObje
 {
 	if (type == nullptr) {
 		this->all_path_objects.erase(pos);
+		this->GetPathObjectSlot(pos).object = nullptr;
+		this->PrunePathObjectSlot(pos);
 	} else {
-		this->all_path_objects[pos].reset(new PathObjectInstance(type, pos, XYZPoint16(/* Offset is ignored for user-placeable types. */)));
+		PathObjectInstance *obj = new PathObjectInstance(type, pos, XYZPoint16(/* Offset is ignored for user-placeable types. */));
+		this->all_path_objects[pos].reset(obj);
+		this->GetPathObjectSlot(pos).object = obj;
 	}
 }
 
@@ -865,8 +958,8 @@ void SceneryManager::SetPathObjectInstance(const XYZPoint16 &pos, const PathObje
  */
 PathObjectInstance *SceneryManager::GetPathObject(const XYZPoint16 &pos)
 {
-	auto it = this->all_path_objects.find(pos);
-	return it == this->all_path_objects.end() ? nullptr : it->second.get();
+	const auto it = this->path_object_slots.find(VoxelKey(pos));
+	return it == this->path_object_slots.end() ? nullptr : it->second.object;
 }
 
 /**
@@ -877,6 +970,9 @@ PathObjectInstance *SceneryManager::GetPathObject(const XYZPoint16 &pos)
 void SceneryManager::AddLitter(const XYZPoint16 &pos, const XYZPoint16 &offset)
 {
 	this->litter_and_vomit.emplace(pos, std::unique_ptr<PathObjectInstance>(new PathObjectInstance(&PathObjectType::LITTER, pos, offset)));
+	this->GetPathObjectSlot(pos).dirt_count++;
+	_density_map.AddLitter(pos);
+	_staff.QueueDirtyTile(pos);
 }
 
 /**
@@ -887,6 +983,9 @@ void SceneryManager::AddLitter(const XYZPoint16 &pos, const XYZPoint16 &offset)
 void SceneryManager::AddVomit(const XYZPoint16 &pos, const XYZPoint16 &offset)
 {
 	this->litter_and_vomit.emplace(pos, std::unique_ptr<PathObjectInstance>(new PathObjectInstance(&PathObjectType::VOMIT, pos, offset)));
+	this->GetPathObjectSlot(pos).dirt_count++;
+	_density_map.AddLitter(pos);
+	_staff.QueueDirtyTile(pos);
 }
 
 /**
@@ -895,7 +994,10 @@ void SceneryManager::AddVomit(const XYZPoint16 &pos, const XYZPoint16 &offset)
  */
 void SceneryManager::RemoveLitterAndVomit(const XYZPoint16 &pos)
 {
-	this->litter_and_vomit.erase(pos);
+	_density_map.RemoveLitter(pos, this->litter_and_vomit.erase(pos));
+	this->GetPathObjectSlot(pos).dirt_count = 0;
+	this->PrunePathObjectSlot(pos);
+	_staff.DirtyTileCleaned(pos);
 }
 
 /**
@@ -909,18 +1011,20 @@ std::vector<PathObjectInstance::PathObjectSprite> SceneryManager::DrawPathObject
 {
 	std::vector<PathObjectInstance::PathObjectSprite> result;
 
-	for (const auto &pair : this->litter_and_vomit) {
-		if (pair.first == pos) {
-			for (const PathObjectInstance::PathObjectSprite &image : pair.second->GetSprites(orientation, zoom)) {
-				result.push_back(image);
+	const auto slot = this->path_object_slots.find(VoxelKey(pos));
+	if (slot != this->path_object_slots.end()) {
+		if (slot->second.dirt_count > 0) {
+			const auto range = this->litter_and_vomit.equal_range(pos);
+			for (auto it = range.first; it != range.second; ++it) {
+				for (const PathObjectInstance::PathObjectSprite &image : it->second->GetSprites(orientation, zoom)) {
+					result.push_back(image);
+				}
 			}
 		}
-	}
-
-	auto it = this->all_path_objects.find(pos);
-	if (it != this->all_path_objects.end()) {
-		for (const PathObjectInstance::PathObjectSprite &image : it->second->GetSprites(orientation, zoom)) {
-			result.push_back(image);
+		if (slot->second.object != nullptr) {
+			for (const PathObjectInstance::PathObjectSprite &image : slot->second.object->GetSprites(orientation, zoom)) {
+				result.push_back(image);
+			}
 		}
 	}
 
@@ -941,46 +1045,23 @@ std::vector<PathObjectInstance::PathObjectSprite> SceneryManager::DrawPathObject
  */
 SceneryInstance *SceneryManager::GetItem(const XYZPoint16 &pos)
 {
-	auto it = this->all_items.find(pos);
-	if (it != this->all_items.end()) return it->second.get();
-	if (this->temp_item != nullptr && this->temp_item->vox_pos == pos) return this->temp_item;
-
-	const Voxel* voxel = _world.GetVoxel(pos);
-	if (voxel == nullptr || voxel->instance != SRI_SCENERY) return nullptr;
-	const uint16 instance_data = voxel->instance_data;
-	if (instance_data == INVALID_VOXEL_DATA) return nullptr;
-
-	const SceneryType *type = this->scenery_item_types[instance_data].get();
-	const int search_radius = std::max(type->width_x - 1, type->width_y - 1);
-	for (int x = -search_radius; x <= search_radius; x++) {
-		for (int y = -search_radius; y <= search_radius; y++) {
-			const XYZPoint16 p(pos.x + x, pos.y + y, pos.z);
-			it = this->all_items.find(p);
-			SceneryInstance *candidate;
-			if (it == this->all_items.end()) {
-				if (this->temp_item != nullptr && this->temp_item->vox_pos == p) {
-					candidate = this->temp_item;
-				} else {
-					continue;
-				}
-			} else {
-				candidate = it->second.get();
-			}
-			if (candidate->type != type) continue;
-
-			const XYZPoint16 corner = p + OrientatedOffset(candidate->orientation, type->width_x - 1, type->width_y - 1);
-			if (
-					pos.x >= std::min(p.x, corner.x) &&
-					pos.x <= std::max(p.x, corner.x) &&
-					pos.y >= std::min(p.y, corner.y) &&
-					pos.y <= std::max(p.y, corner.y)) {
-				return candidate;
-			}
-		}
-	}
+	const auto it = this->item_owner_index.find(VoxelKey(pos));
+	if (it != this->item_owner_index.end()) return it->second;
+	if (this->temp_item != nullptr && this->temp_item->Occupies(pos)) return this->temp_item;
 	return nullptr;
 }
 
+/**
+ * Count how many items of a type are placed in the world.
+ * @param type Type of scenery item to count.
+ * @return The number of placed items of the type.
+ */
+uint SceneryManager::CountItems(const SceneryType *type) const
+{
+	const auto it = this->type_counts.find(type);
+	return it == this->type_counts.end() ? 0 : it->second;
+}
+
 static const uint32 CURRENT_VERSION_SceneryInstance_SCNY = 3;   ///< Currently supported version of the SCNY Pattern.
 
 void SceneryManager::Load(Loader &ldr)
@@ -997,6 +1078,8 @@ void SceneryManager::Load(Loader &ldr)
 				SceneryInstance *i = new SceneryInstance(version >= 3 ? this->GetType(ldr.GetText()) : this->scenery_item_types[ldr.GetWord()].get());
 				i->Load(ldr);
 				this->all_items[i->vox_pos] = std::unique_ptr<SceneryInstance>(i);
+				if (i->type->IsAnimated()) this->animated_items.push_back(i);
+				this->IndexItem(i);
 			}
 			if (version > 1) {
 				for (long l = ldr.GetLong(); l > 0; l--) {
@@ -1007,6 +1090,7 @@ void SceneryManager::Load(Loader &ldr)
 					PathObjectInstance *i = new PathObjectInstance(PathObjectType::Get(ldr.GetByte()), pos, pos /* will be overwritten by #Load() */);
 					i->Load(ldr);
 					this->all_path_objects[pos] = std::unique_ptr<PathObjectInstance>(i);
+					this->GetPathObjectSlot(pos).object = i;
 				}
 				for (long l = ldr.GetLong(); l > 0; l--) {
 					XYZPoint16 pos;
@@ -1016,6 +1100,9 @@ void SceneryManager::Load(Loader &ldr)
 					PathObjectInstance *i = new PathObjectInstance(PathObjectType::Get(ldr.GetByte()), pos, pos);
 					i->Load(ldr);
 					this->litter_and_vomit.emplace(pos, std::unique_ptr<PathObjectInstance>(i));
+					this->GetPathObjectSlot(pos).dirt_count++;
+					_density_map.AddLitter(pos);
+					_staff.QueueDirtyTile(pos);  // The queue is not saved; rebuild it from the litter itself.
 				}
 			}
 			break;
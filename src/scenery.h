@@ -12,6 +12,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "stdafx.h"
@@ -67,6 +68,18 @@ public:
 	{
 		return heights[x * width_y + y];
 	}
+
+	/**
+	 * Whether items of this type change over time and need per-frame updates.
+	 * Static items (single-frame graphics, no watering) never change once placed.
+	 * @return Items of this type must be visited by #SceneryManager::OnAnimate.
+	 */
+	inline bool IsAnimated() const
+	{
+		if (this->watering_interval > 0) return true;
+		if (this->main_animation != nullptr && this->main_animation->frames > 1) return true;
+		return this->dry_animation != nullptr && this->dry_animation->frames > 1;
+	}
 };
 
 /** An actual scenery item in the world. */
@@ -80,6 +93,7 @@ public:
 	void OnAnimate(int delay);
 	bool IsDry() const;
 	bool ShouldBeWatered() const;
+	bool Occupies(const XYZPoint16 &pos) const;
 
 	void InsertIntoWorld();
 	void RemoveFromWorld();
@@ -205,6 +219,7 @@ public:
 	void AddItem(SceneryInstance* item);
 	void RemoveItem(const XYZPoint16 &pos);
 	SceneryInstance *GetItem(const XYZPoint16 &pos);
+	uint CountItems(const SceneryType *type) const;
 
 	void  SetPathObjectInstance(const XYZPoint16 &pos, const PathObjectType *type);
 	void  AddLitter(const XYZPoint16 &pos, const XYZPoint16 &offset);
@@ -223,11 +238,44 @@ public:
 	PathObjectInstance *temp_path_object;  ///< A path object type that is currently being placed (not owned).
 
 private:
+	/**
+	 * Packed path-object state of one voxel. Guests query benches, bins, litter and
+	 * vandalism on every step over a path; the slot answers all of it with one hash lookup
+	 * instead of searching the owning maps.
+	 */
+	struct PathObjectSlot {
+		PathObjectInstance *object;  ///< User-buyable path object on the voxel, \c nullptr if none.
+		uint8 dirt_count;            ///< Number of litter and vomit objects on the voxel.
+
+		PathObjectSlot() : object(nullptr), dirt_count(0) {}
+	};
+
+	/**
+	 * Pack a voxel position into a slot table key.
+	 * @param pos Position to pack.
+	 * @return The packed key.
+	 */
+	static inline uint64 VoxelKey(const XYZPoint16 &pos)
+	{
+		return (static_cast<uint64>(static_cast<uint16>(pos.x)) << 32)
+				| (static_cast<uint64>(static_cast<uint16>(pos.y)) << 16)
+				| static_cast<uint16>(pos.z);
+	}
+
+	PathObjectSlot &GetPathObjectSlot(const XYZPoint16 &pos);
+	void PrunePathObjectSlot(const XYZPoint16 &pos);
+	void IndexItem(SceneryInstance *item);
+	void UnindexItem(SceneryInstance *item);
+
 	std::vector<std::unique_ptr<SceneryType>> scenery_item_types;  ///< All available scenery types.
 
 	std::map     <XYZPoint16, std::unique_ptr<SceneryInstance   >> all_items       ;  ///< All scenery items                 in the world, with their base voxel as key.
+	std::vector<SceneryInstance *> animated_items;  ///< The few items of #all_items whose type #SceneryType::IsAnimated, so the per-frame pass skips the static majority.
 	std::map     <XYZPoint16, std::unique_ptr<PathObjectInstance>> all_path_objects;  ///< All     user-buyable path objects in the world, with their base voxel as key.
 	std::multimap<XYZPoint16, std::unique_ptr<PathObjectInstance>> litter_and_vomit;  ///< All non-user-buyable path objects in the world, with their base voxel as key.
+	std::unordered_map<uint64, PathObjectSlot> path_object_slots;  ///< Packed per-voxel path-object state, kept in sync with the owning maps above.
+	std::unordered_map<uint64, SceneryInstance *> item_owner_index;  ///< Owning item of every base voxel covered by an item's footprint, so #GetItem needs no neighbourhood search.
+	std::map<const SceneryType *, uint32> type_counts;  ///< Number of placed items of each type, maintained on add/remove.
 };
 
 extern SceneryManager _scenery;
@@ -44,6 +44,12 @@ private:
 	uint8 orientation;                          ///< Current orientation.
 	std::unique_ptr<SceneryInstance> instance;  ///< Instance being placed.
 	BestErrorMessageReason build_forbidden_reason;  ///< Reason why we may not place the instance at the given location, if any.
+
+	bool hover_valid;                   ///< Whether the \c hover_ fields below describe the current selector contents.
+	Point16 hover_tile;                 ///< Base tile the selector was last computed for.
+	int hover_view_z;                   ///< Viewport height the selector was last computed for.
+	uint8 hover_vp_orientation;         ///< Viewport orientation the selector was last computed for.
+	int hover_vp_zoom;                  ///< Viewport zoom scale the selector was last computed for.
 };
 
 /**
@@ -174,6 +180,7 @@ void SceneryGui::SetType(const SceneryType *t)
 	}
 	_scenery.temp_item = nullptr;
 	this->build_forbidden_reason.Reset();
+	this->hover_valid = false;
 	this->scenery_sel.SetSize(0, 0);
 }
 
@@ -186,6 +193,7 @@ void SceneryGui::OnClick(const WidgetNumber number, const Point16 &pos)
 			this->orientation %= 4;
 			_scenery.temp_item = nullptr;
 			this->build_forbidden_reason.Reset();
+			this->hover_valid = false;
 			this->scenery_sel.SetSize(0, 0);
 			break;
 
@@ -219,11 +227,22 @@ void SceneryGui::OnClick(const WidgetNumber number, const Point16 &pos)
 void SceneryGui::SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos)
 {
 	if (this->instance == nullptr) return;
+	const Point32 world_pos = vp->ComputeHorizontalTranslation(vp->rect.width / 2 - pos.x, vp->rect.height / 2 - pos.y);
+
+	/* Skip the placement probing and selector rebuild while the mouse stays above the same tile in an unchanged view. */
+	const Point16 hover_tile(world_pos.x / 256, world_pos.y / 256);
+	if (this->hover_valid && hover_tile == this->hover_tile && vp->view_pos.z / 256 == this->hover_view_z &&
+			vp->orientation == this->hover_vp_orientation && vp->zoom == this->hover_vp_zoom) return;
+	this->hover_valid = true;
+	this->hover_tile = hover_tile;
+	this->hover_view_z = vp->view_pos.z / 256;
+	this->hover_vp_orientation = vp->orientation;
+	this->hover_vp_zoom = vp->zoom;
+
 	this->instance->RemoveFromWorld();
 	_scenery.temp_item = nullptr;
 	this->build_forbidden_reason.Reset();
 	this->instance->orientation = this->orientation;
-	const Point32 world_pos = vp->ComputeHorizontalTranslation(vp->rect.width / 2 - pos.x, vp->rect.height / 2 - pos.y);
 	const int8 dx = _orientation_signum_dx[vp->orientation];
 	const int8 dy = _orientation_signum_dy[vp->orientation];
 	bool placed = false;
@@ -303,6 +322,7 @@ void SceneryGui::SelectorMouseButtonEvent(const MouseButtons state)
 						_finances_manager.PayLandscaping(cost);
 						_window_manager.GetViewport()->AddFloatawayMoneyAmount(cost, i->vox_pos);
 						_scenery.RemoveItem(i->vox_pos);
+						this->hover_valid = false;  // The world changed below the cursor, recompute the selector on the next mouse move.
 					}
 				}
 				return;
@@ -184,7 +184,7 @@ RideEntryResult ShopInstance::EnterRide(int guest, [[maybe_unused]] const XYZPoi
 	if (free_batch >= 0) {
 		GuestBatch &gb = this->onride_guests.GetBatch(free_batch);
 		if (gb.AddGuest(guest, entry)) {
-			gb.Start(TOILET_TIME);
+			this->onride_guests.StartBatch(free_batch, TOILET_TIME);
 			return RER_ENTERED;
 		}
 	}
@@ -13,14 +13,29 @@
 #include "fileio.h"
 #include "bitmath.h"
 #include "video.h"
+#include "rev.h"
 
 #include <cmath>
+#include <mutex>
 #include <vector>
+#include <zlib.h>
+
+static std::mutex _scale_mutex;    ///< Protects the scaled variant lists of all images.
+static std::mutex _decode_mutex;   ///< Protects lazy decoding of the pixel data of all images.
+static std::mutex _sprites_mutex;  ///< Protects the batch-allocated image storage during loading.
 
 constexpr uint32 IMAGE_BATCH_SIZE  = 1024;  ///< Number of images that are batch-preallocated (arbitrary number).
 constexpr uint32 MAX_CACHE_ENTRIES = 3000;  ///< Maximum number of cached sprites (arbitrary number).
 constexpr uint32 MAX_CACHE_SIZE    =  800;  ///< Maximum number of cache entries (arbitrary number).
 
+/**
+ * Byte budget for the re-faultable sprite caches (image textures and recoloured pixel
+ * buffers), \c 0 when unlimited. Low-memory machines set it with the sprite-budget-mb
+ * key in the [memory] section of freerct.cfg; the least recently used entries above
+ * the budget are evicted and recomputed on their next use.
+ */
+size_t _sprite_memory_budget = 0;
+
 ImageVariants::ImageVariants()
 {
 	this->cache.reserve(MAX_CACHE_SIZE);
@@ -31,54 +46,56 @@ ImageVariants::Variant::Variant(const ImageData *img) : sprite(img), last_access
 }
 
 /**
- * Get the scaled instance of an image, if present.
+ * Get the recoloured pixel buffer of an image, if present.
  * @param img Source image.
- * @param width Width of the scaled image.
- * @return The image's RGBA data or \c nullptr.
+ * @param key Recolouring and gradient shift that were applied.
+ * @return The recoloured RGBA data or \c nullptr.
  */
-ImageData *ImageVariants::GetScaled(const ImageData *img, uint16 width)
+const uint8 *ImageVariants::GetRecoloured(const ImageData *img, const RecolourData &key)
 {
 	for (Variant &v : this->cache) {
 		if (v.sprite == img) {
-			for (const auto &image : v.scaled) {
-				if (image->width == width) {
-					v.last_accessed = Time();
-					return image.get();
-				}
-			}
-			return nullptr;
+			const auto it = v.recoloured.find(key);
+			if (it == v.recoloured.end()) return nullptr;
+			v.last_accessed = Time();
+			return it->second.get();
 		}
 	}
 	return nullptr;
 }
 
 /**
- * Insert a scaled image into this cache.
+ * Insert a recoloured pixel buffer into this cache.
  * @param img Source image.
- * @param scale Scaling factor.
- * @param scaled Scaled image. Takes ownership.
+ * @param key Recolouring and gradient shift that were applied.
+ * @param rgba Recoloured RGBA data. Takes ownership.
  */
-void ImageVariants::Insert(const ImageData *img, ImageData *scaled)
+void ImageVariants::Insert(const ImageData *img, RecolourData key, uint8 *rgba)
 {
 	for (Variant &v : this->cache) {
 		if (v.sprite == img) {
-			v.scaled.emplace_back(scaled);
+			v.recoloured[std::move(key)].reset(rgba);
 			v.last_accessed = Time();
 			return;
 		}
 	}
 	this->cache.emplace_back(img);
-	this->cache.back().scaled.emplace_back(scaled);
+	this->cache.back().recoloured[std::move(key)].reset(rgba);
 }
 
-/** Delete images from the cache that haven't been accessed for some time. */
+/** Delete images from the cache that haven't been accessed for some time, or that exceed the memory budget. */
 void ImageVariants::DropStale()
 {
 	uint32 cache_size = this->cache.size();
 	uint32 entries = 0;
-	for (const Variant &v : this->cache) entries += v.Size();
+	size_t bytes = 0;
+	for (const Variant &v : this->cache) {
+		entries += v.Size();
+		bytes += v.Bytes();
+	}
+	const size_t byte_limit = SpriteVariantBudget();
 
-	while (entries > MAX_CACHE_ENTRIES || cache_size > MAX_CACHE_SIZE) {
+	while (entries > MAX_CACHE_ENTRIES || cache_size > MAX_CACHE_SIZE || bytes > byte_limit) {
 		uint32 oldest_index = 0;
 		for (uint32 i = 1; i < cache_size; ++i) {
 			if (this->cache.at(i).last_accessed < this->cache.at(oldest_index).last_accessed) {
@@ -87,23 +104,269 @@ void ImageVariants::DropStale()
 		}
 
 		entries -= this->cache.at(oldest_index).Size();
+		bytes -= this->cache.at(oldest_index).Bytes();
 		this->cache.at(oldest_index) = std::move(this->cache.back());
 		this->cache.pop_back();
 		--cache_size;
 	}
 }
 
+/**
+ * Get the total pixel buffer memory held by the cached variants.
+ * @return Number of bytes.
+ */
+size_t ImageVariants::CacheBytes() const
+{
+	size_t bytes = 0;
+	for (const Variant &v : this->cache) bytes += v.Bytes();
+	return bytes;
+}
+
 ImageVariants _image_variants;  ///< Singleton image variants tracker.
 
 static std::vector<std::unique_ptr<ImageData[]>> _sprites;  ///< Available sprites to the program.
 static uint32 _sprites_loaded;                              ///< Total number of sprites loaded.
 
-ImageData::ImageData() : is_8bpp(false), width(0), height(0)
+constexpr size_t PIXEL_SLAB_SIZE = 4 << 20;  ///< Size of one slab of the pixel plane arena (arbitrary number).
+
+/**
+ * Arena handing out pixel plane memory from large contiguous slabs.
+ * Sprites are decoded in the order they are first drawn, so the planes of
+ * sprites that are blitted together end up close together in memory.
+ */
+class PixelArena {
+public:
+	/**
+	 * Allocate pixel plane memory.
+	 * @param size Number of bytes needed.
+	 * @return Start of the memory; it stays valid until #Clear is called.
+	 */
+	uint8 *Allocate(size_t size)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (size > PIXEL_SLAB_SIZE) { // Does not fit in a slab, give it its own allocation.
+			this->slabs.emplace_back(new uint8[size]);
+			return this->slabs.back().get();
+		}
+		if (this->slabs.empty() || this->used + size > PIXEL_SLAB_SIZE) {
+			this->slabs.emplace_back(new uint8[PIXEL_SLAB_SIZE]);
+			this->used = 0;
+		}
+		uint8 *address = this->slabs.back().get() + this->used;
+		this->used += size;
+		return address;
+	}
+
+	/** Release all memory. All pixel plane views become invalid. */
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->slabs.clear();
+		this->used = 0;
+	}
+
+private:
+	std::mutex mutex;  ///< Protects the slab list against concurrent decoding threads.
+	std::vector<std::unique_ptr<uint8[]>> slabs;  ///< Allocated slabs; only the last one has free space.
+	size_t used = 0;   ///< Used bytes of the last slab.
+};
+
+static PixelArena _pixel_arena;  ///< Arena owning the pixel planes of all images.
+
+constexpr uint32 SPRITE_CACHE_VERSION = 1;  ///< Version of the on-disk sprite cache format.
+
+/** A decoded sprite found in the on-disk sprite cache. */
+struct SpriteCacheEntry {
+	uint16 height;         ///< Height of the image.
+	int16 xoffset;         ///< Horizontal offset of the image.
+	int16 yoffset;         ///< Vertical offset of the image.
+	bool is_8bpp;          ///< Whether the image is an 8bpp image.
+	bool is_recolourable;  ///< Whether any pixel of the image is subject to recolouring.
+	const uint8 *rgba;     ///< RGBA plane, a view into the cache file.
+	const uint8 *recol;    ///< Recolour plane, a view into the cache file.
+};
+
+/**
+ * On-disk cache of decoded sprite pixel planes, so work that is identical run
+ * to run (8bpp expansion, zoom scaling) is not redone at every launch.
+ * Entries are keyed by the hash of the source RCD file, the offset of the
+ * sprite block in it, and the (possibly scaled) width, so modified files miss
+ * the cache and their stale entries disappear at the next save.
+ * The cache file is memory-mapped; cached planes are used in place.
+ */
+class SpriteCache {
+public:
+	void Load();
+	const SpriteCacheEntry *Lookup(uint64 hash, size_t offset, uint16 width) const;
+	void Save() const;
+	void Clear();
+
+private:
+	static std::string CachePath();
+	static void SaveImage(FILE *fp, const ImageData &img, uint64 hash, size_t offset);
+
+	std::shared_ptr<FileContents> contents;  ///< Mapped contents of the cache file, kept alive while entries reference it.
+	std::map<std::tuple<uint64, size_t, uint16>, SpriteCacheEntry> entries;  ///< Cached sprites by source hash, block offset, and width.
+};
+
+static SpriteCache _sprite_cache;  ///< On-disk sprite cache.
+
+/**
+ * Get the path of the sprite cache file.
+ * @return The path.
+ */
+std::string SpriteCache::CachePath()
+{
+	std::string path = freerct_userdata_prefix();
+	path += DIR_SEP;
+	path += "sprite.cache";
+	return path;
+}
+
+/** Load the sprite cache from disk, discarding it entirely if it looks damaged. */
+void SpriteCache::Load()
+{
+	this->Clear();
+	std::shared_ptr<FileContents> file = std::make_shared<FileContents>(CachePath());
+	const uint8 *data = file->Data();
+	const size_t size = file->Size();
+	if (data == nullptr || size < 8 || memcmp(data, "FSCH", 4) != 0) return;
+	if ((uint32)(data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24)) != SPRITE_CACHE_VERSION) return;
+
+	size_t pos = 8;
+	while (pos < size) {
+		if (pos + 26 > size) { // Truncated entry, discard everything.
+			this->Clear();
+			return;
+		}
+		const uint8 *p = data + pos;
+		uint64 hash = 0;
+		for (int i = 7; i >= 0; i--) hash = (hash << 8) | p[i];
+		uint64 offset = 0;
+		for (int i = 7; i >= 0; i--) offset = (offset << 8) | p[8 + i];
+		uint16 width = p[16] | (p[17] << 8);
+		SpriteCacheEntry entry;
+		entry.height  = p[18] | (p[19] << 8);
+		entry.xoffset = p[20] | (p[21] << 8);
+		entry.yoffset = p[22] | (p[23] << 8);
+		entry.is_8bpp = p[24] != 0;
+		entry.is_recolourable = p[25] != 0;
+		pos += 26;
+
+		const size_t pixels = (size_t)width * entry.height;
+		const size_t plane_size = pixels * (4 + (entry.is_8bpp ? 1 : 2));
+		if (pos + plane_size > size) {
+			this->Clear();
+			return;
+		}
+		entry.rgba = data + pos;
+		entry.recol = data + pos + pixels * 4;
+		pos += plane_size;
+
+		this->entries[std::make_tuple(hash, (size_t)offset, width)] = entry;
+	}
+	this->contents = file;
+}
+
+/**
+ * Look up a cached sprite.
+ * @param hash Hash of the source RCD file.
+ * @param offset Offset of the sprite block in the source file.
+ * @param width Width of the wanted image (differs from the block's width for scaled variants).
+ * @return The cached sprite, or \c nullptr if not cached.
+ */
+const SpriteCacheEntry *SpriteCache::Lookup(uint64 hash, size_t offset, uint16 width) const
+{
+	const auto it = this->entries.find(std::make_tuple(hash, offset, width));
+	return (it != this->entries.end()) ? &it->second : nullptr;
+}
+
+/**
+ * Append one decoded image to the cache file being written.
+ * @param fp Cache file.
+ * @param img Image to save; must have its planes decoded.
+ * @param hash Hash of the source RCD file.
+ * @param offset Offset of the source sprite block.
+ */
+void SpriteCache::SaveImage(FILE *fp, const ImageData &img, uint64 hash, size_t offset)
+{
+	uint8 header[26];
+	for (int i = 0; i < 8; i++) header[i] = hash >> (8 * i);
+	for (int i = 0; i < 8; i++) header[8 + i] = (uint64)offset >> (8 * i);
+	header[16] = img.width;
+	header[17] = img.width >> 8;
+	header[18] = img.height;
+	header[19] = img.height >> 8;
+	header[20] = img.xoffset;
+	header[21] = img.xoffset >> 8;
+	header[22] = img.yoffset;
+	header[23] = img.yoffset >> 8;
+	header[24] = img.is_8bpp ? 1 : 0;
+	header[25] = img.is_recolourable ? 1 : 0;
+	fwrite(header, 1, 26, fp);
+
+	const size_t pixels = (size_t)img.width * img.height;
+	fwrite(img.rgba, 1, pixels * 4, fp);
+	fwrite(img.recol, 1, pixels * (img.is_8bpp ? 1 : 2), fp);
+}
+
+/**
+ * Write all sprites decoded this run (and their scaled variants) to the cache file.
+ * Entries of removed or modified RCD files are dropped since only live sprites are written.
+ */
+void SpriteCache::Save() const
+{
+	const std::string path = CachePath();
+	const std::string temp = path + ".tmp";
+	FILE *fp = fopen(temp.c_str(), "wb");
+	if (fp == nullptr) return;
+
+	const uint8 file_header[8] = {
+		'F', 'S', 'C', 'H',
+		(uint8)SPRITE_CACHE_VERSION, (uint8)(SPRITE_CACHE_VERSION >> 8), (uint8)(SPRITE_CACHE_VERSION >> 16), (uint8)(SPRITE_CACHE_VERSION >> 24),
+	};
+	fwrite(file_header, 1, 8, fp);
+
+	for (uint32 index = 0; index < _sprites_loaded; index++) {
+		const ImageData &img = _sprites[index / IMAGE_BATCH_SIZE][index % IMAGE_BATCH_SIZE];
+		if (img.rgba == nullptr || img.source_hash == 0) continue; // Never decoded, nothing to cache.
+		SaveImage(fp, img, img.source_hash, img.source_offset);
+		for (const auto &variant : img.scaled) SaveImage(fp, *variant, img.source_hash, img.source_offset);
+	}
+	fclose(fp);
+
+	/* Replace the cache atomically; the mapping of the old file stays valid. */
+	std::error_code ec;
+	std::filesystem::rename(temp, path, ec);
+}
+
+/** Drop all cache entries and the mapping of the cache file. */
+void SpriteCache::Clear()
+{
+	this->entries.clear();
+	this->contents.reset();
+}
+
+ImageData::ImageData() : is_8bpp(false), is_recolourable(false), width(0), height(0), rgba(nullptr), recol(nullptr), source_version(1), source_hash(0), source_offset(0), source_length(0)
 {
 }
 
+/**
+ * Allocate the RGBA and recolour planes of this image as one contiguous block.
+ * @pre #width, #height, and #is_8bpp are set.
+ */
+void ImageData::AllocatePlanes() const
+{
+	const size_t pixels = (size_t)this->width * this->height;
+	const size_t nrecol = this->is_8bpp ? 1 : 2;
+	uint8 *base = _pixel_arena.Allocate(pixels * (4 + nrecol));
+	this->rgba = base;
+	this->recol = base + pixels * 4;
+}
+
 /**
  * Load image data from the RCD file.
+ * Only the header is read; decoding the pixels is deferred until the image is first used.
  * @param rcd_file File to load from.
  * @param length Length of the image data block.
  * @pre File pointer is at first byte of the block.
@@ -121,34 +384,48 @@ void ImageData::Load8bpp(RcdFileReader *rcd_file, size_t length)
 
 	length -= 8;
 	if (length > 100 * 1024) rcd_file->Error("Data too long"); // Another arbitrary limit.
+	if (length <= 4u * this->height) rcd_file->Error("Jump table too short"); // You need at least place for the jump table.
+
+	this->source_version = rcd_file->version;
+	this->source_file = rcd_file->Contents();
+	this->source_offset = rcd_file->GetPosition();
+	this->source_length = length;
+	rcd_file->SkipBytes(length);
+}
 
+/**
+ * Decode the 8bpp pixel data of this image.
+ * @param source Encoded pixel data (jump table followed by pixel runs).
+ * @param length Length of the encoded data.
+ */
+void ImageData::Decode8bpp(const uint8 *source, size_t length) const
+{
 	size_t jmp_table = 4 * this->height;
-	if (length <= jmp_table) rcd_file->Error("Jump table too short"); // You need at least place for the jump table.
+	assert(length > jmp_table); // Checked when the image was loaded.
 	length -= jmp_table;
 
 	std::unique_ptr<uint32[]> table(new uint32[jmp_table / 4]);
-	std::unique_ptr<uint8[]> data(new uint8[length]);
-	if (table == nullptr || data == nullptr) rcd_file->Error("Out of memory");
+	if (table == nullptr) throw LoadingError("Out of memory");
 
 	/* Load jump table, adjusting the entries while loading. */
 	for (uint i = 0; i < this->height; i++) {
-		uint32 dest = rcd_file->GetUInt32();
+		const uint8 *entry = source + 4 * i;
+		uint32 dest = entry[0] | (entry[1] << 8) | (entry[2] << 16) | (entry[3] << 24);
 		if (dest == 0) {
 			table[i] = INVALID_JUMP;
 			continue;
 		}
 		dest -= jmp_table;
-		if (dest >= length) rcd_file->Error("Jump destination out of bounds");
+		if (dest >= length) throw LoadingError("Jump destination out of bounds");
 		table[i] = dest;
 	}
 
-	rcd_file->GetBlob(data.get(), length); // Load the image data.
+	const uint8 *data = source + jmp_table; // Image data is referenced in place.
 
 	/* Verify the image data. */
-	this->rgba.reset(new uint8[this->width * this->height * 4]);
-	this->recol.reset(new uint8[this->width * this->height]);
-	uint8 *rgba_ptr = this->rgba.get();
-	uint8 *recol_ptr = this->recol.get();
+	this->AllocatePlanes();
+	uint8 *rgba_ptr = this->rgba;
+	uint8 *recol_ptr = this->recol;
 	for (uint i = 0; i < this->height; i++) {
 		uint32 offset = table[i];
 		if (offset == INVALID_JUMP) {
@@ -165,7 +442,7 @@ void ImageData::Load8bpp(RcdFileReader *rcd_file, size_t length)
 
 		uint32 xpos = 0;
 		for (;;) {
-			if (offset + 2 >= length) rcd_file->Error("Offset out of bounds");
+			if (offset + 2 >= length) throw LoadingError("Offset out of bounds");
 			uint8 rel_pos = data[offset];
 			uint8 count = data[offset + 1];
 			for (int g = 0; g < (rel_pos & 127); ++g) {
@@ -178,6 +455,7 @@ void ImageData::Load8bpp(RcdFileReader *rcd_file, size_t length)
 			xpos += (rel_pos & 127) + count;
 			for (int dx = 0; dx < count; ++dx) {
 				uint8 pixel = data[offset + 2 + dx];
+				if (pixel >= COL_SERIES_START && pixel < COL_SERIES_END) this->is_recolourable = true;
 				*(recol_ptr++) = pixel;
 				uint32 rgba = _palette[pixel];
 				*(rgba_ptr++) = (rgba >> 24) & 0xff;
@@ -187,9 +465,9 @@ void ImageData::Load8bpp(RcdFileReader *rcd_file, size_t length)
 			}
 			offset += 2 + count;
 			if ((rel_pos & 128) == 0) {
-				if (xpos >= this->width || offset >= length) rcd_file->Error("X coordinate out of exclusive bounds");
+				if (xpos >= this->width || offset >= length) throw LoadingError("X coordinate out of exclusive bounds");
 			} else {
-				if (xpos > this->width || offset > length) rcd_file->Error("X coordinate out of inclusive bounds");
+				if (xpos > this->width || offset > length) throw LoadingError("X coordinate out of inclusive bounds");
 				break;
 			}
 		}
@@ -202,12 +480,13 @@ void ImageData::Load8bpp(RcdFileReader *rcd_file, size_t length)
 			*(recol_ptr++) = 0;
 		}
 	}
-	assert(recol_ptr - this->recol.get() == 1L * this->width * this->height);
-	assert(rgba_ptr - this->rgba.get() == 4L * this->width * this->height);
+	assert(recol_ptr - this->recol == 1L * this->width * this->height);
+	assert(rgba_ptr - this->rgba == 4L * this->width * this->height);
 }
 
 /**
  * Load a 32bpp image.
+ * Only the header is read; decoding the pixels is deferred until the image is first used.
  * @param rcd_file Input stream to read from.
  * @param length Length of the 32bpp block.
  */
@@ -225,19 +504,27 @@ void ImageData::Load32bpp(RcdFileReader *rcd_file, size_t length)
 	length -= 8;
 	if (length > 2000 * 1200) rcd_file->Error("Data too long"); // Another arbitrary limit.
 
-	/* Allocate and load the image data. */
-	std::unique_ptr<uint8[]> data(new uint8[length]);
-	if (data == nullptr) rcd_file->Error("Out of memory");
-	rcd_file->GetBlob(data.get(), length);
+	this->source_version = rcd_file->version;
+	this->source_file = rcd_file->Contents();
+	this->source_offset = rcd_file->GetPosition();
+	this->source_length = length;
+	rcd_file->SkipBytes(length);
+}
 
+/**
+ * Decode the 32bpp pixel data of this image.
+ * @param data Encoded pixel data, referenced in place.
+ * @param length Length of the encoded data.
+ */
+void ImageData::Decode32bpp(const uint8 *data, size_t length) const
+{
 	/* Verify the data. */
-	this->rgba.reset(new uint8[this->width * this->height * 4]);
-	this->recol.reset(new uint8[this->width * this->height * 2]);
-	uint8 *rgba_ptr = this->rgba.get();
-	uint8 *recol_ptr = this->recol.get();
-	uint8 *abs_end = data.get() + length;
+	this->AllocatePlanes();
+	uint8 *rgba_ptr = this->rgba;
+	uint8 *recol_ptr = this->recol;
+	const uint8 *abs_end = data + length;
 	int line_count = 0;
-	const uint8 *ptr = data.get();
+	const uint8 *ptr = data;
 	bool finished = false;
 	while (ptr < abs_end && !finished) {
 		line_count++;
@@ -250,7 +537,7 @@ void ImageData::Load32bpp(RcdFileReader *rcd_file, size_t length)
 			end = abs_end;
 		} else {
 			end = ptr + line_length;
-			if (end > abs_end) rcd_file->Error("End out of bounds");
+			if (end > abs_end) throw LoadingError("End out of bounds");
 		}
 		ptr += 2;
 
@@ -308,6 +595,7 @@ void ImageData::Load32bpp(RcdFileReader *rcd_file, size_t length)
 				case 3: {  // Recolour layer.
 					uint8 layer = *(ptr++);
 					uint8 alpha = *(ptr++);
+					if ((mode & 0x3F) != 0) this->is_recolourable = true;
 					for (int i = mode & 0x3F; i > 0; --i) {
 						*(rgba_ptr++) = 0;
 						*(rgba_ptr++) = 0;
@@ -320,14 +608,86 @@ void ImageData::Load32bpp(RcdFileReader *rcd_file, size_t length)
 				}
 			}
 		}
-		if (xpos > this->width) rcd_file->Error("X coordinate out of bounds");
-		if (!finished_line) rcd_file->Error("Incomplete line");
-		if (ptr != end) rcd_file->Error("Trailing bytes at end of line");
+		if (xpos > this->width) throw LoadingError("X coordinate out of bounds");
+		if (!finished_line) throw LoadingError("Incomplete line");
+		if (ptr != end) throw LoadingError("Trailing bytes at end of line");
+	}
+	assert(recol_ptr - this->recol == 2L * this->width * this->height);
+	assert(rgba_ptr - this->rgba == 4L * this->width * this->height);
+	if (line_count != this->height) throw LoadingError("Line count mismatch");
+	if (ptr != abs_end) throw LoadingError("Trailing bytes at end of file");
+}
+
+/**
+ * Decode the version 2 32bpp pixel data of this image.
+ * The encoded data is a single zlib stream holding the RGBA plane followed by the
+ * recolour plane, each row delta-filtered against the previous pixel.
+ * @param data Encoded pixel data.
+ * @param length Length of the encoded data.
+ */
+void ImageData::Decode32bppV2(const uint8 *data, size_t length) const
+{
+	this->AllocatePlanes();
+	const size_t pixels = (size_t)this->width * this->height;
+
+	/* #AllocatePlanes puts the recolour plane directly behind the RGBA plane,
+	 * so the stream inflates into both planes at once. */
+	uLongf output_size = pixels * 6;
+	if (uncompress(this->rgba, &output_size, data, length) != Z_OK || output_size != pixels * 6) {
+		throw LoadingError("Corrupt compressed pixel data");
+	}
+
+	/* Undo the delta filter of each row. */
+	for (int y = 0; y < this->height; y++) {
+		uint8 *row = this->rgba + (size_t)y * this->width * 4;
+		for (int i = 4; i < this->width * 4; i++) row[i] += row[i - 4];
+		row = this->recol + (size_t)y * this->width * 2;
+		for (int i = 2; i < this->width * 2; i++) row[i] += row[i - 2];
+	}
+
+	for (size_t i = 0; i < pixels; i++) {
+		if (this->recol[i * 2] != 0) {
+			this->is_recolourable = true;
+			break;
+		}
 	}
-	assert(recol_ptr - this->recol.get() == 2L * this->width * this->height);
-	assert(rgba_ptr - this->rgba.get() == 4L * this->width * this->height);
-	if (line_count != this->height) rcd_file->Error("Line count mismatch");
-	if (ptr != abs_end) rcd_file->Error("Trailing bytes at end of file");
+}
+
+/** Decode the pixel data of this image if that has not happened yet. */
+void ImageData::EnsureDecoded() const
+{
+	if (this->rgba != nullptr || this->source_file == nullptr) return;
+
+	/* Sprites may be used from several viewport collection threads, serialize decoding. */
+	std::lock_guard<std::mutex> lock(_decode_mutex);
+	if (this->rgba != nullptr) return;
+
+	this->source_hash = this->source_file->Hash();
+	const SpriteCacheEntry *cached = _sprite_cache.Lookup(this->source_hash, this->source_offset, this->width);
+	if (cached != nullptr && cached->height == this->height && cached->is_8bpp == this->is_8bpp) {
+		this->is_recolourable = cached->is_recolourable;
+		this->rgba = const_cast<uint8 *>(cached->rgba);
+		this->recol = const_cast<uint8 *>(cached->recol);
+		this->source_file.reset();
+		return;
+	}
+
+	const uint8 *source = this->source_file->Data() + this->source_offset;
+	try {
+		if (this->is_8bpp) {
+			this->Decode8bpp(source, this->source_length);
+		} else if (this->source_version >= 2) {
+			this->Decode32bppV2(source, this->source_length);
+		} else {
+			this->Decode32bpp(source, this->source_length);
+		}
+	} catch (const LoadingError &e) {
+		fprintf(stderr, "WARNING: Decoding a sprite failed (%s), using a blank image instead.\n", e.what());
+		if (this->rgba == nullptr) this->AllocatePlanes();
+		memset(this->rgba, 0, this->width * this->height * 4);
+		memset(this->recol, 0, this->width * this->height * (this->is_8bpp ? 1 : 2));
+	}
+	this->source_file.reset(); // The file mapping is released once all its sprites are decoded.
 }
 
 /**
@@ -341,6 +701,7 @@ void ImageData::Load32bpp(RcdFileReader *rcd_file, size_t length)
 uint32 ImageData::GetPixel(uint16 xoffset, uint16 yoffset, const Recolouring *recolour, GradientShift shift) const
 {
 	if (xoffset >= this->width || yoffset >= this->height) return 0;
+	this->EnsureDecoded();
 	if (this->is_8bpp) {
 		uint8 pixel = this->recol[yoffset * this->width + xoffset];
 		if (recolour != nullptr) pixel = recolour->GetPalette(shift)[pixel];
@@ -349,89 +710,191 @@ uint32 ImageData::GetPixel(uint16 xoffset, uint16 yoffset, const Recolouring *re
 
 	const uint8 *rgba_base = &this->rgba[4 * (yoffset * this->width + xoffset)];
 	const uint8 *recol_base = &this->recol[2 * (yoffset * this->width + xoffset)];
-	ShiftFunc sf = GetGradientShiftFunc(shift);
-	ShiftFunc af = GetAlphaShiftFunc(shift);
+	const uint8 *sf = GetGradientShiftTable(shift);
+	const uint8 *af = GetAlphaShiftTable(shift);
 
 	if (recol_base == nullptr || recolour == nullptr || recol_base[0] == 0) {
 		/* No recolouring, */
-		return sf(rgba_base[0] << 24) | sf(rgba_base[1] << 16) | sf(rgba_base[2] << 8) | af(rgba_base[3]);
+		return MakeRGBA(sf[rgba_base[0]], sf[rgba_base[1]], sf[rgba_base[2]], af[rgba_base[3]]);
 	}
 
 	const uint32 recoloured = recolour->GetRecolourTable(recol_base[0] - 1)[recol_base[1]];
-	return MakeRGBA(sf(GetR(recoloured)), sf(GetG(recoloured)), sf(GetB(recoloured)), af(rgba_base[3]));
+	return MakeRGBA(sf[GetR(recoloured)], sf[GetG(recoloured)], sf[GetB(recoloured)], af[rgba_base[3]]);
+}
+
+/**
+ * Rebuild kernel for the 32bpp path of #ImageData::GetRecoloured.
+ * Properties that are uniform for a whole sprite are compile-time parameters,
+ * so each instantiation only keeps the per-pixel branches it really needs and
+ * the plain-pixel loop of a non-recolourable image is straight-line code the
+ * compiler can vectorize.
+ * @tparam RECOLOURABLE The image contains recolour-layer pixels.
+ * @tparam SHIFTED A gradient shift other than #GS_NORMAL is applied.
+ * @param ptr Destination RGBA plane.
+ * @param rgba_ptr Source RGBA plane of the image.
+ * @param recol_ptr Source recolour plane of the image.
+ * @param count Number of pixels in the image.
+ * @param sf Gradient shift table for the colour channels.
+ * @param af Gradient shift table for the alpha channel.
+ * @param recolour Recolouring to apply.
+ */
+template <bool RECOLOURABLE, bool SHIFTED>
+static void Rebuild32bpp(uint8 *ptr, const uint8 *rgba_ptr, const uint8 *recol_ptr, int count, const uint8 *sf, const uint8 *af, const Recolouring &recolour)
+{
+	/* Fold recolour table and shifting into one RGB table per recolour layer,
+	 * built only for the layers the image actually uses, so recoloured pixels
+	 * need no unpacking and shifting of individual channels. */
+	uint8 folded[MAX_RECOLOUR + 1][256][3];
+	uint8 folded_built = 0;
+	for (int i = count; i > 0; --i) {
+		if (RECOLOURABLE && recol_ptr[0] != 0) {
+			const uint8 layer = std::min(recol_ptr[0] - 1, MAX_RECOLOUR);  // All layers beyond MAX_RECOLOUR share the fallback table.
+			if (GB(folded_built, layer, 1) == 0) {
+				const uint32 *table = recolour.GetRecolourTable(layer);
+				for (int j = 0; j < 256; ++j) {
+					folded[layer][j][0] = sf[GetR(table[j])];
+					folded[layer][j][1] = sf[GetG(table[j])];
+					folded[layer][j][2] = sf[GetB(table[j])];
+				}
+				folded_built |= 1 << layer;
+			}
+			const uint8 *entry = folded[layer][recol_ptr[1]];
+			*(ptr++) = entry[0];
+			*(ptr++) = entry[1];
+			*(ptr++) = entry[2];
+			*(ptr++) = af[rgba_ptr[3]];
+			rgba_ptr += 4;
+		} else if (SHIFTED) {
+			*(ptr++) = sf[*(rgba_ptr++)];
+			*(ptr++) = sf[*(rgba_ptr++)];
+			*(ptr++) = sf[*(rgba_ptr++)];
+			*(ptr++) = af[*(rgba_ptr++)];
+		} else {
+			/* #GS_NORMAL leaves plain pixels unchanged. */
+			memcpy(ptr, rgba_ptr, 4);
+			ptr += 4;
+			rgba_ptr += 4;
+		}
+		recol_ptr += 2;
+	}
 }
 
 /**
  * Get this image with a gradient shift and/or recolouring applied.
+ * Results are cached in #_image_variants, so repeated requests with the same
+ * recolouring are cheap.
  * @param shift Gradient shift to apply to the image.
  * @param recolour Recolouring to apply to the image.
- * @return The altered image's RGBA pixel values. Ownership is passed to the caller.
+ * @return The altered image's RGBA pixel values. Ownership remains with the cache or the image.
  */
-std::unique_ptr<uint8[]> ImageData::GetRecoloured(GradientShift shift, const Recolouring &recolour) const
+const uint8 *ImageData::GetRecoloured(GradientShift shift, const Recolouring &recolour) const
 {
-	ShiftFunc af = GetAlphaShiftFunc(shift);
+	this->EnsureDecoded();
+
+	/* The loaders already expand all pixels into the RGBA plane, with the recolour
+	 * information preserved in #recol. Without a gradient shift and effective
+	 * recolouring, that plane can be used as-is. For 32bpp images the plane lacks
+	 * the colours of recolour-layer pixels, so those always take the slow path.
+	 */
+	if (shift == GS_NORMAL && (!this->is_recolourable || (this->is_8bpp && !recolour.HasReplacements()))) {
+		return this->rgba;
+	}
+
+	RecolourData key(shift, recolour.ToCondensed());
+	const uint8 *cached = _image_variants.GetRecoloured(this, key);
+	if (cached != nullptr) return cached;
+
+	const uint8 *af = GetAlphaShiftTable(shift);
 	std::unique_ptr<uint8[]> result(new uint8[this->width * this->height * 4]);
 	uint8 *ptr = result.get();
-	const uint8 *recol_ptr = this->recol.get();
+	const uint8 *recol_ptr = this->recol;
 
 	if (this->is_8bpp) {
-		for (int y = 0; y < this->height; ++y) {
-			for (int x = 0; x < this->width; ++x) {
-				uint32 pixel = _palette[recolour.GetPalette(shift)[*(recol_ptr++)]];
-				*(ptr++) = GetR(pixel);
-				*(ptr++) = GetG(pixel);
-				*(ptr++) = GetB(pixel);
-				*(ptr++) = af(GetA(pixel));
-			}
+		/* Fold palette lookup, recolouring, and shifting into one 256-entry RGBA table,
+		 * so the per-pixel work is reduced to a single indexed load. */
+		const uint8 *palette_map = recolour.GetPalette(shift);
+		uint8 table[256][4];
+		for (int i = 0; i < 256; ++i) {
+			const uint32 pixel = _palette[palette_map[i]];
+			table[i][0] = GetR(pixel);
+			table[i][1] = GetG(pixel);
+			table[i][2] = GetB(pixel);
+			table[i][3] = af[GetA(pixel)];
+		}
+		for (int i = this->width * this->height; i > 0; --i) {
+			const uint8 *entry = table[*(recol_ptr++)];
+			*(ptr++) = entry[0];
+			*(ptr++) = entry[1];
+			*(ptr++) = entry[2];
+			*(ptr++) = entry[3];
 		}
 	} else {
-		const uint8 *rgba_ptr = this->rgba.get();
-		ShiftFunc sf = GetGradientShiftFunc(shift);
-		for (int y = 0; y < this->height; ++y) {
-			for (int x = 0; x < this->width; ++x) {
-				if (recol_ptr[0] == 0) {
-					*(ptr++) = sf(*(rgba_ptr++));
-					*(ptr++) = sf(*(rgba_ptr++));
-					*(ptr++) = sf(*(rgba_ptr++));
-					*(ptr++) = af(*(rgba_ptr++));
-				} else {
-					const uint32 recoloured = recolour.GetRecolourTable(recol_ptr[0] - 1)[recol_ptr[1]];
-					*(ptr++) = sf(GetR(recoloured));
-					*(ptr++) = sf(GetG(recoloured));
-					*(ptr++) = sf(GetB(recoloured));
-					*(ptr++) = af(rgba_ptr[3]);
-					rgba_ptr += 4;
-				}
-				recol_ptr += 2;
+		/* Select the kernel instantiation once per sprite; #Rebuild32bpp drops
+		 * the per-pixel branches that cannot apply to this image. */
+		const uint8 *sf = GetGradientShiftTable(shift);
+		const int count = this->width * this->height;
+		if (this->is_recolourable) {
+			if (shift != GS_NORMAL) {
+				Rebuild32bpp<true, true>(ptr, this->rgba, recol_ptr, count, sf, af, recolour);
+			} else {
+				Rebuild32bpp<true, false>(ptr, this->rgba, recol_ptr, count, sf, af, recolour);
 			}
+		} else {
+			/* Always shifted, the unshifted plain image was returned early above. */
+			Rebuild32bpp<false, true>(ptr, this->rgba, recol_ptr, count, sf, af, recolour);
 		}
 	}
 
-	return result;
+	uint8 *raw = result.release();
+	_image_variants.Insert(this, std::move(key), raw);
+	return raw;
 }
 
 /**
  * Scale this image to a different size.
+ * The scaled variant is owned by this image and computed at most once, so after the
+ * first use switching between zoom scales does not recompute any pixels.
  * @param factor Factor by which to scale.
  * @return The scaled instance.
  */
 const ImageData *ImageData::Scale(uint16 desired_width) const
 {
 	if (desired_width == this->width) return this;
+	this->EnsureDecoded();
 
-	ImageData *cached = _image_variants.GetScaled(this, desired_width);
-	if (cached != nullptr) return cached;
+	/* Viewport collection may run in several worker threads, serialize access to the variants. */
+	std::lock_guard<std::mutex> lock(_scale_mutex);
+	for (const auto &variant : this->scaled) {
+		if (variant->width == desired_width) return variant.get();
+	}
+
+	if (this->source_hash != 0) {
+		const SpriteCacheEntry *cached = _sprite_cache.Lookup(this->source_hash, this->source_offset, desired_width);
+		if (cached != nullptr && cached->is_8bpp == this->is_8bpp) {
+			ImageData *img = new ImageData;
+			img->is_8bpp = this->is_8bpp;
+			img->is_recolourable = cached->is_recolourable;
+			img->width   = desired_width;
+			img->height  = cached->height;
+			img->xoffset = cached->xoffset;
+			img->yoffset = cached->yoffset;
+			img->rgba  = const_cast<uint8 *>(cached->rgba);
+			img->recol = const_cast<uint8 *>(cached->recol);
+			this->scaled.emplace_back(img);
+			return img;
+		}
+	}
 
 	ImageData *img = new ImageData;
 	img->is_8bpp = this->is_8bpp;
+	img->is_recolourable = this->is_recolourable;
 	img->width   = desired_width;
 	img->height  = this->height  * desired_width / this->width;
 	img->xoffset = this->xoffset * desired_width / this->width;
 	img->yoffset = this->yoffset * desired_width / this->width;
 
 	const size_t nrecol = (img->is_8bpp ? 1 : 2);
-	img->recol.reset(new uint8[nrecol * img->width * img->height]);
-	img->rgba.reset(new uint8[img->width * img->height * 4]);
+	img->AllocatePlanes();
 
 	if (desired_width > this->width) {
 		/* Upscaling. Each old pixel is copied to multiple new pixels. */
@@ -474,37 +937,47 @@ const ImageData *ImageData::Scale(uint16 desired_width) const
 		}
 	}
 
-	_image_variants.Insert(this, img);
+	this->scaled.emplace_back(img);
 	return img;
 }
 
 /**
- * Load 8bpp or 32bpp sprite block from the \a rcd_file.
- * @param rcd_file File being loaded.
- * @return Loaded sprite, if loading was successful, else \c nullptr.
+ * Allocate a slot for a new image in the batch-preallocated storage.
+ * May be called from multiple loader threads concurrently.
+ * @return The image slot.
  */
-ImageData *LoadImage(RcdFileReader *rcd_file)
+static ImageData *AllocateImageSlot()
 {
+	std::lock_guard<std::mutex> lock(_sprites_mutex);
 	const uint32 batch_index = _sprites_loaded / IMAGE_BATCH_SIZE;
 	const uint32 index_in_batch = _sprites_loaded % IMAGE_BATCH_SIZE;
 	if (_sprites_loaded >= IMAGE_BATCH_SIZE * _sprites.size()) _sprites.emplace_back(new ImageData[IMAGE_BATCH_SIZE]);
+	_sprites_loaded++;
+	return &_sprites.at(batch_index)[index_in_batch];
+}
 
+/**
+ * Load 8bpp or 32bpp sprite block from the \a rcd_file.
+ * Thread-safe, so sprite blocks of independent files can be decoded concurrently.
+ * @param rcd_file File being loaded.
+ * @return Loaded sprite, if loading was successful, else \c nullptr.
+ */
+ImageData *LoadImage(RcdFileReader *rcd_file)
+{
 	bool is_8bpp = strcmp(rcd_file->name, "8PXL") == 0;
-	rcd_file->CheckVersion(is_8bpp ? 2 : 1);
+	if (is_8bpp) {
+		rcd_file->CheckVersion(2);
+	} else if (rcd_file->version != 1 && rcd_file->version != 2) {
+		rcd_file->Error("Version mismatch: Found version %u, supported versions are 1 and 2", rcd_file->version);
+	}
 
-	_sprites_loaded++;
-	ImageData *imd = &_sprites.at(batch_index)[index_in_batch];
-	try {
-		if (is_8bpp) {
-			imd->is_8bpp = true;
-			imd->Load8bpp(rcd_file, rcd_file->size);
-		} else {
-			imd->is_8bpp = false;
-			imd->Load32bpp(rcd_file, rcd_file->size);
-		}
-	} catch (...) {
-		_sprites_loaded--;
-		throw;
+	/* On failure the slot stays blank; loading of the file is aborted anyway. */
+	ImageData *imd = AllocateImageSlot();
+	imd->is_8bpp = is_8bpp;
+	if (is_8bpp) {
+		imd->Load8bpp(rcd_file, rcd_file->size);
+	} else {
+		imd->Load32bpp(rcd_file, rcd_file->size);
 	}
 	return imd;
 }
@@ -512,11 +985,14 @@ ImageData *LoadImage(RcdFileReader *rcd_file)
 /** Initialize image storage. */
 void InitImageStorage()
 {
-	/* Nothing to do currently. */
+	_sprite_cache.Load();
 }
 
 /** Clear all memory. */
 void DestroyImageStorage()
 {
+	_sprite_cache.Save(); // Keep the decoding work of this run for the next launch.
 	_sprites.clear();
+	_pixel_arena.Clear();
+	_sprite_cache.Clear();
 }
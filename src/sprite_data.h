@@ -12,11 +12,13 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 #include "palette.h"
 #include "time_func.h"
 
 static const uint32 INVALID_JUMP = UINT32_MAX; ///< Invalid jump destination in image data.
 
+class FileContents;
 class RcdFileReader;
 
 /**
@@ -31,7 +33,7 @@ public:
 	void Load32bpp(RcdFileReader *rcd_file, size_t length);
 
 	uint32 GetPixel(uint16 xoffset, uint16 yoffset, const Recolouring *recolour = nullptr, GradientShift shift = GS_NORMAL) const;
-	std::unique_ptr<uint8[]> GetRecoloured(GradientShift shift, const Recolouring &recolour) const;
+	const uint8 *GetRecoloured(GradientShift shift, const Recolouring &recolour) const;
 
 	const ImageData *Scale(uint16 desired_width) const;
 
@@ -44,26 +46,48 @@ public:
 		return this->width == 1 && this->height == 1;
 	}
 
-	bool is_8bpp;  ///< Whether this image is an 8bpp image.
+	bool is_8bpp;                   ///< Whether this image is an 8bpp image.
+	mutable bool is_recolourable;   ///< Whether any pixel of the image is subject to recolouring. Only known once decoded.
 	uint16 width;  ///< Width of the image.
 	uint16 height; ///< Height of the image.
 	int16 xoffset; ///< Horizontal offset of the image.
 	int16 yoffset; ///< Vertical offset of the image.
 
-	std::unique_ptr<uint8[]> rgba;   ///< All pixel values of the image in RGBA format.
-	std::unique_ptr<uint8[]> recol;  ///< The recolouring layer and table index of each pixel.
+	/* Decoding is deferred until the pixels are first needed, hence \c mutable.
+	 * Both planes are views into a shared pixel buffer owned by the image storage,
+	 * so sprites decoded together (and thus blitted together) are stored together. */
+	mutable uint8 *rgba;   ///< All pixel values of the image in RGBA format, \c nullptr while not decoded yet.
+	mutable uint8 *recol;  ///< The recolouring layer and table index of each pixel, \c nullptr while not decoded yet.
+
+private:
+	void EnsureDecoded() const;
+	void Decode8bpp(const uint8 *source, size_t length) const;
+	void Decode32bpp(const uint8 *source, size_t length) const;
+	void Decode32bppV2(const uint8 *source, size_t length) const;
+	void AllocatePlanes() const;
+
+	uint8 source_version;                              ///< Version of the sprite block the pixel data came from, selects the decoder.
+	mutable std::shared_ptr<FileContents> source_file; ///< File holding the encoded pixel data, kept alive for decoding on first use.
+	mutable uint64 source_hash;                        ///< Hash of the source file, \c 0 until the image is decoded. Cache key together with #source_offset.
+	size_t source_offset;                              ///< Offset of the encoded pixel data in #source_file.
+	size_t source_length;                              ///< Length of the encoded pixel data.
+
+	/** Scaled zoom variants of this image. Built at most once per zoom scale and kept for the lifetime of the image. */
+	mutable std::vector<std::unique_ptr<ImageData>> scaled;
+
+	friend class SpriteCache;
 };
 
-/** Keeps track of cached recolouring and scaling variants of images. */
+/** Keeps track of cached recolouring variants of images. */
 class ImageVariants {
 public:
 	ImageVariants();
 
-	ImageData *GetScaled(const ImageData *img, uint16 width);
+	const uint8 *GetRecoloured(const ImageData *img, const RecolourData &key);
 
 	void Insert(const ImageData *img, RecolourData key, uint8 *rgba);
-	void Insert(const ImageData *img, ImageData *scaled);
 	void DropStale();
+	size_t CacheBytes() const;
 
 	/** Frequent maintenance tasks. */
 	void Tick()
@@ -76,9 +100,9 @@ private:
 	struct Variant {
 		explicit Variant(const ImageData *img);
 
-		const ImageData *sprite;                         ///< The source image.
-		std::vector<std::unique_ptr<ImageData>> scaled;  ///< Scaled copies of this image and their scaling factor.
-		Realtime last_accessed;                          ///< When this variant was last fetched from the cache.
+		const ImageData *sprite;                                      ///< The source image.
+		std::map<RecolourData, std::unique_ptr<uint8[]>> recoloured;  ///< Recoloured RGBA pixel buffers of this image.
+		Realtime last_accessed;                                       ///< When this variant was last fetched from the cache.
 
 		/**
 		 * Get the number of data entries in this Variant.
@@ -86,7 +110,16 @@ private:
 		 */
 		uint32 Size() const
 		{
-			return this->scaled.size();
+			return this->recoloured.size();
+		}
+
+		/**
+		 * Get the pixel buffer memory held by this Variant.
+		 * @return Number of bytes.
+		 */
+		size_t Bytes() const
+		{
+			return this->recoloured.size() * 4u * this->sprite->width * this->sprite->height;
 		}
 	};
 
@@ -99,4 +132,24 @@ ImageData *LoadImage(RcdFileReader *rcd_file);
 void InitImageStorage();
 void DestroyImageStorage();
 
+extern size_t _sprite_memory_budget;
+
+/**
+ * Share of the sprite memory budget available to the image textures of the video system.
+ * @return Byte limit, \c SIZE_MAX when no budget is set.
+ */
+inline size_t SpriteTextureBudget()
+{
+	return _sprite_memory_budget == 0 ? SIZE_MAX : _sprite_memory_budget / 4 * 3;
+}
+
+/**
+ * Share of the sprite memory budget available to the CPU-side recoloured pixel buffers.
+ * @return Byte limit, \c SIZE_MAX when no budget is set.
+ */
+inline size_t SpriteVariantBudget()
+{
+	return _sprite_memory_budget == 0 ? SIZE_MAX : _sprite_memory_budget / 4;
+}
+
 #endif
@@ -17,6 +17,7 @@
  */
 
 #include "stdafx.h"
+#include "alloc_tracking.h"
 #include "sprite_store.h"
 #include "sprite_data.h"
 #include "rcdfile.h"
@@ -28,6 +29,8 @@
 #include "gamelevel.h"
 #include "scenery.h"
 #include "string_func.h"
+#include "task_system.h"
+#include "time_func.h"
 
 SpriteManager _sprite_manager; ///< Sprite manager.
 GuiSprites _gui_sprites;       ///< GUI sprites.
@@ -85,6 +88,11 @@ static void ReadUtf8Text(RcdFileReader *rcd_file, size_t expected_length, char *
 	char *start = buffer + *used_size;
 
 	for (;;) {
+		/* Runs of plain ASCII are valid without per-character decoding. */
+		const size_t run = AsciiRunLength(start, real_size);
+		real_size -= run;
+		start += run;
+
 		uint32 code_point;
 		int sz = DecodeUtf8Char(start, real_size, &code_point);
 		if (sz == 0 || sz > real_size) rcd_file->Error("UTF8: Invalid character bounds");
@@ -160,14 +168,15 @@ void TextData::Load(RcdFileReader *rcd_file)
 			if (lang_idx >= 0) {
 				const char *split = buffer + used_size;
 				ReadUtf8Text(rcd_file, text_length, buffer, lengthof(buffer), plural_forms - 1, &used_size);
-				/* Split the string into plural forms. */
-				std::vector<const char*> &vector = strings[used_strings].languages[lang_idx];
-				vector.resize(plural_forms, nullptr);
-				vector.at(0) = split;
+				/* Split the string into plural forms, appended consecutively to the flattened table. */
+				PluralizedString &ref = strings[used_strings].languages[lang_idx];
+				ref.first = this->texts.size();
+				ref.count = plural_forms;
+				this->texts.push_back(split);
 				for (int i = 1; i < plural_forms; ++i) {
 					int substring_length = strlen(split);
 					split += substring_length + 1;
-					vector.at(i) = split;
+					this->texts.push_back(split);
 				}
 			} else {
 				/* Illegal language, read into a dummy buffer. */
@@ -192,13 +201,12 @@ void TextData::Load(RcdFileReader *rcd_file)
 	for (uint i = 0; i < used_strings; i++) {
 		this->strings[i].name = (strings[i].name == nullptr) ? nullptr : (this->text_data.get() + (strings[i].name - buffer));
 		for (uint lng = 0; lng < LANGUAGE_COUNT; lng++) {
-			this->strings[i].languages[lng].resize(strings[i].languages[lng].size());
-			for (uint s = 0; s < strings[i].languages[lng].size(); ++s) {
-				this->strings[i].languages[lng].at(s) = (strings[i].languages[lng].at(s) == nullptr) ?
-						nullptr : (this->text_data.get() + (strings[i].languages[lng].at(s) - buffer));
-			}
+			this->strings[i].languages[lng] = strings[i].languages[lng];
 		}
 	}
+	/* Rebase the flattened table from the temporary buffer to the owned text data. */
+	for (const char *&text : this->texts) text = this->text_data.get() + (text - buffer);
+	this->texts.shrink_to_fit();
 }
 
 /**
@@ -390,23 +398,13 @@ const ImageData* FrameSet::GetSprite(uint16 x, uint16 y, uint8 orientation, int
 	return img_to_scale->Scale(img_to_scale->width * desired_tile_w / this->width[index]);
 }
 
-TimedAnimation::TimedAnimation() : frames(0)
+TimedAnimation::TimedAnimation() : frames(0), total_duration(0)
 {
 }
 
 TimedAnimation::~TimedAnimation()
 = default;
 
-/**
- * How long this animation needs to play once.
- * @return The duration in milliseconds.
- */
-int TimedAnimation::GetTotalDuration() const {
-	int total = 0;
-	for (int i = 0; i < frames; ++i) total += durations[i];
-	return total;
-}
-
 /**
  * The frame to display at the given time.
  * @param time The time in milliseconds relative to the animation's begin.
@@ -414,14 +412,15 @@ int TimedAnimation::GetTotalDuration() const {
  * @return The current frame, or -1 if the result is invalid.
  */
 int TimedAnimation::GetFrame(int time, const bool loop_around) const {
-	const int total_length = GetTotalDuration();
+	const int total_length = this->total_duration;
 	if (total_length <= 0 || (!loop_around && time > total_length)) return -1;
 	if (loop_around) time %= total_length;
-	for (int i = 0; i < frames; ++i) {
-		time -= durations[i];
-		if (time <= 0) return i;
-	}
-	NOT_REACHED();
+	/* Find the first frame that ends at or after the given time. */
+	const int *begin = this->frame_ends.get();
+	const int *end = begin + this->frames;
+	const int *found = std::lower_bound(begin, end, time);
+	assert(found != end);
+	return found - begin;
 }
 
 /**
@@ -437,8 +436,14 @@ void TimedAnimation::Load(RcdFileReader *rcd_file, [[maybe_unused]] const ImageM
 	this->frames = rcd_file->GetUInt32();
 	rcd_file->CheckExactLength(rcd_file->size, 4 + 8 * this->frames, "timed animation");
 	this->durations.reset(new int[this->frames]);
+	this->frame_ends.reset(new int[this->frames]);
 	this->views.reset(new const FrameSet*[this->frames]);
-	for (int f = 0; f < this->frames; ++f) this->durations[f] = rcd_file->GetUInt32();
+	this->total_duration = 0;
+	for (int f = 0; f < this->frames; ++f) {
+		this->durations[f] = rcd_file->GetUInt32();
+		this->total_duration += this->durations[f];
+		this->frame_ends[f] = this->total_duration;
+	}
 	for (int f = 0; f < this->frames; ++f) {
 		this->views[f] = _sprite_manager.GetFrameSet(ImageSetKey(rcd_file->filename, rcd_file->GetUInt32()));
 	}
@@ -1328,6 +1333,7 @@ SpriteStorage::SpriteStorage(uint16 _size) : size(_size)
 {
 	for (uint8 i = 0; i < FENCE_TYPE_COUNT; i++) this->fence[i] = nullptr;
 	for (ImageData *& img : this->path_sprites) img = nullptr;
+	std::fill_n(&this->animations[0][0], ANIMATION_TYPE_COUNT * PERSON_TYPE_COUNT, nullptr);
 }
 
 /**
@@ -1337,18 +1343,9 @@ SpriteStorage::SpriteStorage(uint16 _size) : size(_size)
  */
 void SpriteStorage::RemoveAnimations(AnimationType anim_type, PersonType pers_type)
 {
-	for (auto iter = this->animations.find(anim_type); iter != this->animations.end(); ) {
-		AnimationSprites *an_spr = iter->second;
-		if (an_spr->anim_type != anim_type) return;
-		if (an_spr->person_type == pers_type) {
-			auto iter2 = iter;
-			++iter2;
-			this->animations.erase(iter);
-			iter = iter2;
-		} else {
-			++iter;
-		}
-	}
+	assert(anim_type >= ANIM_BEGIN && anim_type <= ANIM_LAST);
+	assert(pers_type < PERSON_TYPE_COUNT);
+	this->animations[anim_type - ANIM_BEGIN][pers_type] = nullptr;
 }
 
 /**
@@ -1358,7 +1355,9 @@ void SpriteStorage::RemoveAnimations(AnimationType anim_type, PersonType pers_ty
 void SpriteStorage::AddAnimationSprites(AnimationSprites *an_spr)
 {
 	assert(an_spr->width == this->size);
-	this->animations.insert(std::make_pair(an_spr->anim_type, an_spr));
+	assert(an_spr->anim_type >= ANIM_BEGIN && an_spr->anim_type <= ANIM_LAST);
+	assert(an_spr->person_type < PERSON_TYPE_COUNT);
+	this->animations[an_spr->anim_type - ANIM_BEGIN][an_spr->person_type] = an_spr;
 }
 
 /**
@@ -1377,6 +1376,7 @@ void SpriteStorage::AddFence(Fence *fnc)
 SpriteManager::SpriteManager()
 {
 	_gui_sprites.Clear();
+	std::fill_n(&this->animations[0][0], ANIMATION_TYPE_COUNT * PERSON_TYPE_COUNT, nullptr);
 
 	this->store.reserve(ZOOM_SCALES_COUNT);
 	for (int z = 0; z < ZOOM_SCALES_COUNT; ++z) this->store.emplace_back(TileWidth(z));
@@ -1393,10 +1393,11 @@ SpriteManager::~SpriteManager()
 /**
  * Load sprites from the disk.
  * @param filename Name of the RCD file to load.
+ * @param pre_decoded Sprite blocks of this file that were already decoded by a loader thread, \c nullptr if none.
  * @todo Try to re-use already loaded blocks.
  * @todo Code will use last loaded surface as grass.
  */
-void SpriteManager::Load(const char *filename)
+void SpriteManager::Load(const char *filename, const ImageMap *pre_decoded)
 {
 	RcdFileReader rcd_file(filename);
 	if (!rcd_file.CheckFileHeader("RCDF", 2)) throw LoadingError("Bad header");
@@ -1416,6 +1417,14 @@ void SpriteManager::Load(const char *filename)
 		}
 
 		if (strcmp(rcd_file.name, "8PXL") == 0 || strcmp(rcd_file.name, "32PX") == 0) {
+			if (pre_decoded != nullptr) {
+				const auto it = pre_decoded->find(blk_num);
+				if (it != pre_decoded->end()) {
+					if (!rcd_file.SkipBytes(rcd_file.size)) throw LoadingError("Invalid sprite block.");
+					sprites.insert(*it);
+					continue;
+				}
+			}
 			ImageData *imd = LoadImage(&rcd_file);
 			if (imd == nullptr) {
 				throw LoadingError("Image data loading failed.");
@@ -1652,19 +1661,113 @@ SpriteStorage *SpriteManager::GetSpriteStore(int width)
 	return &this->store[width];
 }
 
+/**
+ * Read the sprite blocks of an RCD file ahead of registration.
+ * Runs on a loader thread; it only touches the file and the thread-safe image storage.
+ * @param path Path of the RCD file.
+ * @param images [out] Loaded sprite blocks, by block number.
+ */
+static void PreDecodeRcdFile(const std::string &path, ImageMap *images)
+{
+	RcdFileReader rcd_file(path);
+	if (!rcd_file.CheckFileHeader("RCDF", 2)) return; // The registration phase reports the error.
+
+	const std::vector<RcdTocEntry> &toc = rcd_file.BlockToc();
+	if (!toc.empty()) {
+		/* The file has a table of contents, seek straight to the sprite blocks. */
+		for (uint index = 0; index < toc.size(); index++) {
+			const RcdTocEntry &entry = toc[index];
+			if (strcmp(entry.name, "8PXL") != 0 && strcmp(entry.name, "32PX") != 0) continue;
+			if (!rcd_file.SeekToBlock(entry) || !rcd_file.ReadBlockHeader()) return;
+			try {
+				(*images)[index + 1] = LoadImage(&rcd_file); // Block numbers are 1-based.
+			} catch (const LoadingError &) {
+				return; // Leave the broken block to the registration phase.
+			}
+		}
+		return;
+	}
+
+	for (uint blk_num = 1;; blk_num++) {
+		if (!rcd_file.ReadBlockHeader()) return;
+		if (strcmp(rcd_file.name, "8PXL") == 0 || strcmp(rcd_file.name, "32PX") == 0) {
+			try {
+				(*images)[blk_num] = LoadImage(&rcd_file);
+			} catch (const LoadingError &) {
+				/* Leave the broken block to the registration phase, which re-decodes it and reports the error. */
+				return;
+			}
+			continue;
+		}
+		if (!rcd_file.SkipBytes(rcd_file.size)) return;
+	}
+}
+
 /** Load all useful RCD files found by #_rcd_collection, into the program. */
 void SpriteManager::LoadRcdFiles()
 {
-	for (auto &entry : _rcd_collection.rcdfiles) {
-		const char *fname = entry.second.path.c_str();
+	const AllocationTagScope alloc_tag(ALT_SPRITES);
+	std::vector<const std::string *> files;
+	files.reserve(_rcd_collection.rcdfiles.size());
+	for (auto &entry : _rcd_collection.rcdfiles) files.push_back(&entry.second.path);
+
+	/* The files are independent until their blocks are registered, so read the
+	 * sprite blocks of all files on the task system first. */
+	std::vector<ImageMap> pre_decoded(files.size());
+	if (_task_system.ThreadCount() > 0 && files.size() > 1) {
+		StartupPhaseTimer timer("rcd-preread");
+		_task_system.ParallelFor(files.size(), [&files, &pre_decoded](uint index) {
+			const AllocationTagScope alloc_tag(ALT_SPRITES);  // The tag is thread-local, set it in each worker.
+			PreDecodeRcdFile(*files[index], &pre_decoded[index]);
+		});
+	}
+
+	/* Registration into the stores is serial and in file order. */
+	for (size_t index = 0; index < files.size(); index++) {
+		const char *fname = files[index]->c_str();
+		StartupPhaseTimer timer("rcd-file", fname);
 		try {
-			this->Load(fname);
+			this->Load(fname, &pre_decoded[index]);
 		} catch (const LoadingError &e) {
 			fprintf(stderr, "Error while reading \"%s\": %s\n", fname, e.what());
 		}
 	}
 }
 
+/**
+ * Re-load RCD files that changed on disk since they were loaded, without restarting the game.
+ * Registration overwrites the table slots in the sprite stores, while the previously loaded blocks
+ * stay alive in #blocks, so sprite pointers cached elsewhere remain valid until they are refreshed.
+ * Frame sets and timed animations of a changed file are retired rather than freed, as loaded ride
+ * and scenery types keep pointers into them.
+ * Intended for iterating on graphics; re-loading a file that defines ride or scenery types
+ * registers those types again.
+ * @return Number of files that were re-loaded.
+ */
+int SpriteManager::ReloadChangedRcdFiles()
+{
+	const AllocationTagScope alloc_tag(ALT_SPRITES);
+	int count = 0;
+	for (const std::string &fname : _rcd_collection.FindChangedFiles()) {
+		/* Retire the frame sets and timed animations of the file, loading inserts fresh ones under the same keys. */
+		for (auto &entry : this->frame_sets) {
+			if (entry.first.first == fname && entry.second != nullptr) this->retired_frame_sets.push_back(std::move(entry.second));
+		}
+		for (auto &entry : this->timed_animations) {
+			if (entry.first.first == fname && entry.second != nullptr) this->retired_timed_animations.push_back(std::move(entry.second));
+		}
+
+		try {
+			this->Load(fname.c_str(), nullptr);
+			count++;
+			printf("Re-loaded \"%s\"\n", fname.c_str());
+		} catch (const LoadingError &e) {
+			fprintf(stderr, "Error while reading \"%s\": %s\n", fname.c_str(), e.what());
+		}
+	}
+	return count;
+}
+
 /**
  * Add a RCD data block to the list of managed blocks.
  * @param block New block to add.
@@ -1681,7 +1784,9 @@ inline void SpriteManager::AddBlock(std::unique_ptr<RcdBlock> block)
  */
 void SpriteManager::AddAnimation(Animation *anim)
 {
-	this->animations.insert(std::make_pair(anim->anim_type, anim));
+	assert(anim->anim_type >= ANIM_BEGIN && anim->anim_type <= ANIM_LAST);
+	assert(anim->person_type < PERSON_TYPE_COUNT);
+	this->animations[anim->anim_type - ANIM_BEGIN][anim->person_type] = anim;
 }
 
 /**
@@ -1848,16 +1953,12 @@ const ImageData *SpriteManager::GetTableSprite(uint16 number) const
  * @param anim_type %Animation to retrieve.
  * @param per_type %Animation should feature this type of person.
  * @return The requested animation if it is available, else \c nullptr is returned.
- * @todo Put this in a static array to make rendering people much cheaper.
  */
 const Animation *SpriteManager::GetAnimation(AnimationType anim_type, PersonType per_type) const
 {
-	for (auto iter = this->animations.find(anim_type); iter != this->animations.end(); ++iter) {
-		const Animation *anim = iter->second;
-		if (anim->anim_type != anim_type) break;
-		if (anim->person_type == per_type) return anim;
-	}
-	return nullptr;
+	assert(anim_type >= ANIM_BEGIN && anim_type <= ANIM_LAST);
+	assert(per_type < PERSON_TYPE_COUNT);
+	return this->animations[anim_type - ANIM_BEGIN][per_type];
 }
 
 /**
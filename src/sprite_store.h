@@ -45,14 +45,15 @@ class TextData : public RcdBlock {
 public:
 	/** Groups translations of one string in all languages. Memory is not owned. */
 	struct TextString {
-		std::vector<const char*> languages[LANGUAGE_COUNT];  ///< The string in all languages.
-		const char *name;                                    ///< Name of this string.
+		PluralizedString languages[LANGUAGE_COUNT];  ///< The string in all languages, references into TextData::texts.
+		const char *name;                            ///< Name of this string.
 	};
 
 	void Load(RcdFileReader *rcd_file);
 
 	uint string_count;   ///< Number of strings in #strings.
 	std::unique_ptr<TextString[]> strings; ///< Strings of the text.
+	std::vector<const char*> texts;        ///< Flattened table of the plural forms of all strings, pointing into #text_data.
 	std::unique_ptr<char[]> text_data;     ///< Text data (UTF-8) itself.
 };
 
@@ -192,11 +193,21 @@ public:
 
 	void Load(RcdFileReader *rcd_file, const ImageMap &sprites);
 
-	int GetTotalDuration() const;
+	/**
+	 * How long this animation needs to play once.
+	 * @return The duration in milliseconds.
+	 */
+	inline int GetTotalDuration() const
+	{
+		return this->total_duration;
+	}
+
 	int GetFrame(int time, bool loop_around) const;
 
 	int frames;   ///< Number of frames
+	int total_duration;                 ///< Total duration of all frames in milliseconds.
 	std::unique_ptr<int[]> durations;   ///< Duration of each frame in milliseconds.
+	std::unique_ptr<int[]> frame_ends;  ///< Cumulative end time of each frame in milliseconds.
 	std::unique_ptr<const FrameSet*[]> views; ///< Each frame's set of sprites.
 };
 typedef std::map<ImageSetKey, std::unique_ptr<TimedAnimation>> TimedAnimationsMap;  ///< Map of available timed animations.
@@ -258,6 +269,8 @@ enum AnimationType {
 };
 DECLARE_POSTFIX_INCREMENT(AnimationType)
 
+static const uint ANIMATION_TYPE_COUNT = ANIM_LAST - ANIM_BEGIN + 1;  ///< Number of animation types.
+
 /** Data structure holding a single animation. */
 class Animation : public RcdBlock {
 public:
@@ -272,8 +285,6 @@ public:
 	std::unique_ptr<AnimationFrame[]> frames;  ///< Frames of the animation.
 };
 
-typedef std::multimap<AnimationType, Animation *> AnimationsMap; ///< Multi-map of available animations.
-
 /** Data structure holding sprite of an animation. */
 class AnimationSprites: public RcdBlock {
 public:
@@ -289,8 +300,6 @@ public:
 	std::unique_ptr<ImageData*[]> sprites;     ///< Sprites of the animation.
 };
 
-typedef std::multimap<AnimationType, AnimationSprites *> AnimationSpritesMap; ///< Multi-map of available animation sprites.
-
 /**
  * Sprites of a border.
  * @ingroup gui_sprites_group
@@ -667,7 +676,6 @@ public:
 	 * @param frame_index Index of the frame to display.
 	 * @param view Orientation of the view.
 	 * @return The sprite, if it is available.
-	 * @todo [high] Pulling animations from a map for drawing sprites is too expensive.
 	 */
 	const ImageData *GetAnimationSprite(AnimationType anim_type, uint16 frame_index, PersonType pers_type, ViewOrientation view) const
 	{
@@ -679,13 +687,8 @@ public:
 		anim_type = AnimationType(anim_type_base + anim_type_off);
 		assert(anim_type >= ANIM_BEGIN && anim_type <= ANIM_LAST);
 
-		for (auto iter = this->animations.find(anim_type); iter != this->animations.end(); ++iter) {
-			const AnimationSprites *asp = iter->second;
-
-			if (asp->anim_type != anim_type) return nullptr;
-			if (asp->person_type == pers_type) return asp->sprites[frame_index];
-		}
-		return nullptr;
+		const AnimationSprites *asp = this->animations[anim_type - ANIM_BEGIN][pers_type];
+		return (asp != nullptr) ? asp->sprites[frame_index] : nullptr;
 	}
 
 	/**
@@ -833,7 +836,7 @@ public:
 	ImageData *path_sprites[PAT_COUNT * PAS_COUNT * PATH_COUNT];  ///< Path sprites.
 	PathDecoration path_decoration;   ///< %Path decoration sprites.
 	DisplayedObject build_arrows;     ///< Arrows displaying build direction of paths and tracks.
-	AnimationSpritesMap animations;   ///< %Animation sprites ordered by animation type.
+	const AnimationSprites *animations[ANIMATION_TYPE_COUNT][PERSON_TYPE_COUNT];  ///< %Animation sprites by animation type and person type.
 };
 
 /**
@@ -846,6 +849,7 @@ public:
 	~SpriteManager();
 
 	void LoadRcdFiles();
+	int ReloadChangedRcdFiles();
 	void AddBlock(std::unique_ptr<RcdBlock> block);
 
 	void AddAnimation(Animation *anim);
@@ -888,17 +892,20 @@ public:
 	}
 
 protected:
-	void Load(const char *fname);
+	void Load(const char *fname, const ImageMap *pre_decoded);
 
 	std::vector<std::unique_ptr<RcdBlock>> blocks;  ///< List of loaded RCD data blocks.
 
 	SpriteStorage *GetSpriteStore(int width);
 
 	std::vector<SpriteStorage> store;        ///< Sprite storage for each zoom scale.
-	AnimationsMap animations;                ///< Available animations.
+	const Animation *animations[ANIMATION_TYPE_COUNT][PERSON_TYPE_COUNT];  ///< Available animations by animation type and person type.
 	FrameSetsMap frame_sets;                 ///< Available frame sets.
 	TimedAnimationsMap timed_animations;     ///< Available timed animations.
 
+	std::vector<std::unique_ptr<FrameSet>> retired_frame_sets;              ///< Frame sets replaced by #ReloadChangedRcdFiles, kept alive as loaded ride and scenery types still point at them.
+	std::vector<std::unique_ptr<TimedAnimation>> retired_timed_animations;  ///< Timed animations replaced by #ReloadChangedRcdFiles, kept alive for the same reason.
+
 private:
 	void LoadSURF(RcdFileReader *rcd_file, const ImageMap &sprites);
 	void LoadTSEL(RcdFileReader *rcd_file, const ImageMap &sprites);
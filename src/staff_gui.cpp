@@ -70,6 +70,15 @@ public:
 	void OnClick(WidgetNumber wid, const Point16 &pos) override;
 	void SetWidgetStringParameters(WidgetNumber wid_num) const override;
 
+	/**
+	 * Staff members publish a #CHG_PERSON_CHANGED event whenever their displayed state changes.
+	 * @return The window needs no per-frame repaint.
+	 */
+	bool DisplaysGameState() const override
+	{
+		return false;
+	}
+
 	PersonType selected;   ///< Currently selected tab.
 };
 
@@ -81,6 +90,7 @@ StaffManagementGui::StaffManagementGui() : GuiWindow(WC_STAFF, ALL_WINDOWS_OF_TY
 {
 	this->SetupWidgetTree(_staff_select_gui_parts, lengthof(_staff_select_gui_parts));
 	this->SetScrolledWidget(STAFF_GUI_LIST, STAFF_GUI_SCROLL_LIST);
+	this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST)->SetItemSize(GetTextHeight());
 	this->SelectTab(PERSON_HANDYMAN);
 }
 
@@ -91,7 +101,9 @@ StaffManagementGui::StaffManagementGui() : GuiWindow(WC_STAFF, ALL_WINDOWS_OF_TY
 void StaffManagementGui::SelectTab(const PersonType p)
 {
 	this->selected = p;
-	this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST)->SetItemCount(std::min<uint16>(1u, _staff.Count(this->selected)));
+	ScrollbarWidget *scrollbar = this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST);
+	scrollbar->SetItemCount(_staff.Count(this->selected));
+	scrollbar->SetStart(0);
 
 	this->SetWidgetPressed(STAFF_CATEGORY_MECHANICS,    p == PERSON_MECHANIC);
 	this->SetWidgetPressed(STAFF_CATEGORY_HANDYMEN,     p == PERSON_HANDYMAN);
@@ -135,6 +147,7 @@ void StaffManagementGui::OnClick(const WidgetNumber number, const Point16 &pos)
 				default:
 					NOT_REACHED();
 			}
+			this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST)->SetItemCount(_staff.Count(this->selected));
 			break;
 
 		case STAFF_CATEGORY_MECHANICS:    this->SelectTab(PERSON_MECHANIC);    break;
@@ -143,14 +156,16 @@ void StaffManagementGui::OnClick(const WidgetNumber number, const Point16 &pos)
 		case STAFF_CATEGORY_ENTERTAINERS: this->SelectTab(PERSON_ENTERTAINER); break;
 
 		case STAFF_GUI_LIST: {
-			const int index = pos.y / GetTextHeight() - 1;
-			if (index < 0) break;
-			const int first_index = this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST)->GetStart();
-			if (index < first_index || index + first_index >= _staff.Count(this->selected)) break;
+			const int row = pos.y / GetTextHeight() - 1; // The first row holds the column headers.
+			if (row < 0) break;
+			ScrollbarWidget *scrollbar = this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST);
+			const uint index = scrollbar->GetStart() + row;
+			if (index >= _staff.Count(this->selected)) break;
 
-			StaffMember *m = _staff.Get(this->selected, index - first_index);
+			StaffMember *m = _staff.Get(this->selected, index);
 			if (pos.x > this->GetWidget<BaseWidget>(STAFF_GUI_LIST)->pos.width * 4 / 5) {
 				_staff.Dismiss(m);
+				scrollbar->SetItemCount(_staff.Count(this->selected));
 			} else {
 				ShowPersonInfoGui(m);
 			}
@@ -168,8 +183,7 @@ void StaffManagementGui::DrawWidget(const WidgetNumber wid_num, const BaseWidget
 
 	int x = this->GetWidgetScreenX(wid);
 	int y = this->GetWidgetScreenY(wid);
-	const uint first_index = this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST)->GetStart();
-	const uint last_index  = std::min<uint>(_staff.Count(this->selected), first_index + wid->pos.height / GetTextHeight() - 1);
+	const ScrollbarWidget *scrollbar = this->GetWidget<ScrollbarWidget>(STAFF_GUI_SCROLL_LIST);
 
 	const int w = wid->pos.width;
 	const int column1x = x + 2;
@@ -180,17 +194,22 @@ void StaffManagementGui::DrawWidget(const WidgetNumber wid_num, const BaseWidget
 	DrawString(GUI_STAFF_TITLE_STATUS, TEXT_WHITE, column2x, y, column3x  - column2x, ALG_LEFT, true);
 	DrawString(GUI_STAFF_DISMISS,      TEXT_WHITE, column3x, y, x + w - 2 - column3x, ALG_RIGHT, true);
 
-	for (uint i = first_index; i < last_index; i++) {
-		y += GetTextHeight();
-		StaffMember *person = _staff.Get(this->selected, i);
+	/* Fetch the members of the visible rows with a single scan over the staff lists. */
+	std::vector<StaffMember *> members;
+	_staff.VisitMembers(this->selected, scrollbar->GetStart(), scrollbar->GetVisibleCount(),
+			[&members](StaffMember *person, uint) { members.push_back(person); });
+
+	scrollbar->ForVisibleRows(1, [&](uint, uint row) {
+		StaffMember *person = members[row];
+		const int ry = y + (row + 1) * GetTextHeight();
 
 		_str_params.SetText(1, person->GetName());
-		DrawString(STR_ARG1, TEXT_BLACK, column1x + 2, y, w, ALG_LEFT);
+		DrawString(STR_ARG1, TEXT_BLACK, column1x + 2, ry, w, ALG_LEFT);
 		_str_params.SetText(1, person->GetStatus());
-		DrawString(STR_ARG1, TEXT_BLACK, column2x + 2, y, w, ALG_LEFT);
+		DrawString(STR_ARG1, TEXT_BLACK, column2x + 2, ry, w, ALG_LEFT);
 
-		_video.BlitImage({x + w - _gui_sprites.close_sprite->width - 2, y}, _gui_sprites.close_sprite);
-	}
+		_video.BlitImage({x + w - _gui_sprites.close_sprite->width - 2, ry}, _gui_sprites.close_sprite);
+	});
 }
 
 /** Open a window to view and manage the park's staff. */
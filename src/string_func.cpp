@@ -88,6 +88,31 @@ size_t StrBytesLength(const uint8 *str)
 	return strlen((const char *)str);
 }
 
+/**
+ * Get the length of the longest prefix of \a data consisting only of plain ASCII characters (no \c NUL bytes, no multi-byte characters).
+ * Such a prefix needs no per-character decoding or validation, so callers can process it in bulk.
+ * The text is scanned one machine word at a time; the final partial word is handled byte-wise.
+ * @param data Pointer to the start of the data.
+ * @param length Length of the \a data buffer.
+ * @return Number of leading bytes that are non-<tt>NUL</tt> ASCII characters.
+ */
+size_t AsciiRunLength(const char *data, size_t length)
+{
+	static const uint64 LOW_BITS  = 0x0101010101010101ull;  ///< The lowest bit of every byte.
+	static const uint64 HIGH_BITS = 0x8080808080808080ull;  ///< The highest bit of every byte.
+
+	size_t pos = 0;
+	while (pos + sizeof(uint64) <= length) {
+		uint64 chunk;
+		std::memcpy(&chunk, data + pos, sizeof(chunk));
+		/* The test sets the high bit of every byte that is a NUL byte or the start or tail of a multi-byte character. */
+		if (((chunk | ((chunk - LOW_BITS) & ~chunk)) & HIGH_BITS) != 0) break;
+		pos += sizeof(uint64);
+	}
+	while (pos < length && data[pos] != '\0' && (data[pos] & 0x80) == 0) pos++;
+	return pos;
+}
+
 /**
  * Decode an UTF-8 character.
  * @param data Pointer to the start of the data.
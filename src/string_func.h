@@ -20,6 +20,7 @@ uint8 *StrECpy(uint8 *dest, uint8 *end, const uint8 *src);
 
 size_t StrBytesLength(const uint8 *txt);
 
+size_t AsciiRunLength(const char *data, size_t length);
 int DecodeUtf8Char(const char *data, size_t length, uint32 *codepoint);
 int EncodeUtf8Char(uint32 codepoint, char *dest = nullptr);
 size_t GetPrevChar(const std::string &data, size_t pos);
@@ -0,0 +1,292 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file task_system.cpp Implementation of the shared work-stealing task system. */
+
+#include "stdafx.h"
+#include "task_system.h"
+
+TaskSystem _task_system;  ///< The task system of the program.
+
+/** Index of the worker queue owned by this thread, or a sentinel for non-worker threads. */
+static thread_local uint _task_worker_index = UINT32_MAX;
+
+TaskGroup::TaskGroup() : pending(0)
+{
+}
+
+/**
+ * Is all work of the group finished?
+ * @return All submitted tasks of the group have run to completion.
+ */
+bool TaskGroup::Done() const
+{
+	return this->pending.load() == 0;
+}
+
+TaskSystem::TaskSystem() : queued_count(0), submit_cursor(0), stop(false)
+{
+}
+
+TaskSystem::~TaskSystem()
+{
+	this->Shutdown();
+}
+
+/** Start the worker threads, scaled to the core count of the machine. Idempotent. */
+void TaskSystem::Start()
+{
+	if (!this->workers.empty()) return;
+	/* One core stays reserved for the main thread; it joins in through #Wait and #ParallelFor. */
+	const uint thread_count = std::max<uint>(1, std::thread::hardware_concurrency()) - 1;
+	if (thread_count == 0) return;  // Single-core machine, everything runs inline.
+
+	this->stop = false;
+	for (uint i = 0; i < thread_count; i++) this->queues.emplace_back(new WorkerQueue);
+	for (uint i = 0; i < thread_count; i++) this->workers.emplace_back(&TaskSystem::WorkerLoop, this, i);
+}
+
+/**
+ * Stop the worker threads. Tasks that were queued but not started yet run inline
+ * in the calling thread, as do the pending main-thread tasks. Safe to call more than once.
+ */
+void TaskSystem::Shutdown()
+{
+	if (!this->workers.empty()) {
+		{
+			std::lock_guard<std::mutex> lock(this->sleep_mutex);
+			this->stop = true;
+		}
+		this->sleep_condition.notify_all();
+		for (std::thread &worker : this->workers) worker.join();
+		this->workers.clear();
+
+		Task task;
+		while (this->FindTask(0, &task)) this->Execute(task);
+		this->queues.clear();
+	}
+	this->ProcessMainThreadTasks();
+}
+
+/**
+ * Get the number of worker threads.
+ * @return The number of workers, \c 0 when all work runs inline in the calling thread.
+ */
+uint TaskSystem::ThreadCount() const
+{
+	return this->workers.size();
+}
+
+/**
+ * Submit a task to the pool.
+ * @param task The work to run.
+ * @param priority Priority class of the task.
+ * @param group Group to track completion in, \c nullptr for none.
+ */
+void TaskSystem::Submit(std::function<void()> task, TaskPriority priority, TaskGroup *group)
+{
+	if (group != nullptr) group->pending.fetch_add(1);
+	if (this->workers.empty()) {
+		/* Not started (or already shut down): run inline, keeping the group accounting intact. */
+		Task inline_task = {std::move(task), group};
+		this->Execute(inline_task);
+		return;
+	}
+
+	/* Workers push to their own queue for locality, other threads round-robin over the queues. */
+	uint index = _task_worker_index;
+	if (index >= this->queues.size()) index = this->submit_cursor.fetch_add(1) % this->queues.size();
+	{
+		std::lock_guard<std::mutex> lock(this->queues[index]->mutex);
+		this->queues[index]->tasks[priority].push_back({std::move(task), group});
+	}
+	this->queued_count.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> lock(this->sleep_mutex);  // Pair with the queued-count check of a worker about to sleep.
+	}
+	this->sleep_condition.notify_one();
+}
+
+/**
+ * Submit a task that may only start after all current work of a group has finished,
+ * forming an edge in a task graph. Submits immediately when the group is already done.
+ * @param after Group that must complete first.
+ * @param task The work to run.
+ * @param priority Priority class of the task.
+ * @param group Group to track the new task's completion in, \c nullptr for none.
+ */
+void TaskSystem::RunAfter(TaskGroup &after, std::function<void()> task, TaskPriority priority, TaskGroup *group)
+{
+	{
+		std::lock_guard<std::mutex> lock(after.mutex);
+		if (!after.Done()) {
+			if (group != nullptr) group->pending.fetch_add(1);
+			TaskGroup *grp = group;
+			after.continuations.emplace_back([this, task = std::move(task), grp]() mutable {
+				Task continued = {std::move(task), grp};
+				this->Execute(continued);
+			}, priority);
+			return;
+		}
+	}
+	this->Submit(std::move(task), priority, group);
+}
+
+/**
+ * Wait until all tasks of a group have finished.
+ * The calling thread helps executing queued tasks while it waits.
+ * @param group Group to wait for.
+ */
+void TaskSystem::Wait(TaskGroup &group)
+{
+	const uint home = (_task_worker_index < this->queues.size()) ? _task_worker_index : 0;
+	while (!group.Done()) {
+		Task task;
+		if (this->FindTask(home, &task)) {
+			this->Execute(task);
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(group.mutex);
+		if (group.Done()) break;
+		group.condition.wait(lock);
+	}
+}
+
+/**
+ * Run a loop body for every index in \c 0 .. \c count-1, distributed over the pool.
+ * The indices are handed out dynamically, so uneven bodies balance automatically.
+ * Blocks until all iterations have finished; the calling thread executes its share.
+ * @param count Number of iterations.
+ * @param body The loop body, receiving the iteration index. It must be safe to run concurrently.
+ */
+void TaskSystem::ParallelFor(uint count, const std::function<void(uint)> &body)
+{
+	if (count == 0) return;
+	const uint task_count = std::min(this->ThreadCount(), count - 1);  // The caller runs iterations too.
+	if (task_count == 0) {
+		for (uint i = 0; i < count; i++) body(i);
+		return;
+	}
+
+	std::atomic<uint> next(0);
+	const auto run = [&body, &next, count]() {
+		for (;;) {
+			const uint index = next.fetch_add(1);
+			if (index >= count) return;
+			body(index);
+		}
+	};
+	TaskGroup group;
+	for (uint i = 0; i < task_count; i++) this->Submit(run, TKP_HIGH, &group);
+	run();
+	this->Wait(group);
+}
+
+/**
+ * Queue a task to run on the main thread, at the next #ProcessMainThreadTasks call.
+ * Use this for work that must touch thread-affine state, such as the GUI or the inbox.
+ * @param task The work to run.
+ */
+void TaskSystem::RunOnMainThread(std::function<void()> task)
+{
+	std::lock_guard<std::mutex> lock(this->main_mutex);
+	this->main_tasks.push_back(std::move(task));
+}
+
+/** Run all queued main-thread tasks. Called once per frame by the main loop. */
+void TaskSystem::ProcessMainThreadTasks()
+{
+	for (;;) {
+		std::function<void()> task;
+		{
+			std::lock_guard<std::mutex> lock(this->main_mutex);
+			if (this->main_tasks.empty()) return;
+			task = std::move(this->main_tasks.front());
+			this->main_tasks.pop_front();
+		}
+		task();
+	}
+}
+
+/**
+ * Main loop of a worker thread.
+ * @param index Index of the queue owned by this worker.
+ */
+void TaskSystem::WorkerLoop(uint index)
+{
+	_task_worker_index = index;
+	for (;;) {
+		Task task;
+		if (this->FindTask(index, &task)) {
+			this->Execute(task);
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(this->sleep_mutex);
+		if (this->stop) return;
+		if (this->queued_count.load() == 0) this->sleep_condition.wait(lock);
+	}
+}
+
+/**
+ * Take a queued task, preferring the own queue and stealing from the others otherwise.
+ * Higher priorities are exhausted before lower ones. The own queue pops newest-first
+ * for cache locality, stolen work is taken oldest-first.
+ * @param home Index of the queue owned by the calling thread.
+ * @param task [out] The task that was taken.
+ * @return A task was found.
+ */
+bool TaskSystem::FindTask(uint home, Task *task)
+{
+	const uint count = this->queues.size();
+	if (count == 0) return false;
+	for (uint priority = 0; priority < TKP_COUNT; priority++) {
+		for (uint attempt = 0; attempt < count; attempt++) {
+			const uint index = (home + attempt) % count;
+			WorkerQueue &queue = *this->queues[index];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.tasks[priority].empty()) continue;
+			if (index == home) {
+				*task = std::move(queue.tasks[priority].back());
+				queue.tasks[priority].pop_back();
+			} else {
+				*task = std::move(queue.tasks[priority].front());
+				queue.tasks[priority].pop_front();
+			}
+			this->queued_count.fetch_sub(1);
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Run a task and update its group accounting.
+ * @param task Task to run.
+ */
+void TaskSystem::Execute(Task &task)
+{
+	task.work();
+	if (task.group != nullptr) this->FinishGroupTask(task.group);
+}
+
+/**
+ * A task of a group finished: wake waiters and submit the queued continuations
+ * when it was the last one.
+ * @param group The group the finished task belonged to.
+ */
+void TaskSystem::FinishGroupTask(TaskGroup *group)
+{
+	if (group->pending.fetch_sub(1) != 1) return;
+
+	std::vector<std::pair<std::function<void()>, TaskPriority>> continuations;
+	{
+		std::lock_guard<std::mutex> lock(group->mutex);
+		continuations.swap(group->continuations);
+		group->condition.notify_all();
+	}
+	for (auto &continuation : continuations) this->Submit(std::move(continuation.first), continuation.second);
+}
@@ -0,0 +1,114 @@
+/*
+ * This file is part of FreeRCT.
+ * FreeRCT is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * FreeRCT is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with FreeRCT. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file task_system.h The shared task system used by all subsystems that run work on threads. */
+
+#ifndef TASK_SYSTEM_H
+#define TASK_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Priority classes of submitted tasks. */
+enum TaskPriority {
+	TKP_HIGH,    ///< Latency-sensitive work the current frame is waiting for.
+	TKP_NORMAL,  ///< Regular parallel work.
+	TKP_LOW,     ///< Background work that may be delayed by several frames.
+
+	TKP_COUNT    ///< Number of priority classes.
+};
+
+/**
+ * Completion tracker for a set of related tasks.
+ * Submit tasks against a group to wait for all of them with #TaskSystem::Wait, or to chain
+ * follow-up work with #TaskSystem::RunAfter. A group may be reused once it is done.
+ */
+class TaskGroup {
+public:
+	TaskGroup();
+
+	bool Done() const;
+
+private:
+	friend class TaskSystem;
+
+	std::atomic<uint32> pending;        ///< Number of submitted but unfinished tasks.
+	std::mutex mutex;                   ///< Protects #continuations and waiting on #condition.
+	std::condition_variable condition;  ///< Signalled when the last task of the group finishes.
+
+	std::vector<std::pair<std::function<void()>, TaskPriority>> continuations;  ///< Tasks to submit when the group becomes done.
+};
+
+/**
+ * Work-stealing thread pool shared by all subsystems.
+ *
+ * Every worker owns a queue; it pops its own work newest-first and steals oldest-first from
+ * the other workers when its queue runs dry. Tasks must not touch the world or other mutable
+ * game state unless the submitter guarantees the game thread is waiting on them. Work that
+ * must run on the game thread (GUI updates, inbox messages) goes through #RunOnMainThread
+ * and is drained once per frame by the main loop.
+ *
+ * Before #Start or after #Shutdown all submitted tasks execute inline in the calling thread,
+ * so single-threaded builds and the headless tools need no special cases.
+ */
+class TaskSystem {
+public:
+	TaskSystem();
+	~TaskSystem();
+
+	void Start();
+	void Shutdown();
+
+	uint ThreadCount() const;
+
+	void Submit(std::function<void()> task, TaskPriority priority = TKP_NORMAL, TaskGroup *group = nullptr);
+	void RunAfter(TaskGroup &after, std::function<void()> task, TaskPriority priority = TKP_NORMAL, TaskGroup *group = nullptr);
+	void Wait(TaskGroup &group);
+	void ParallelFor(uint count, const std::function<void(uint)> &body);
+
+	void RunOnMainThread(std::function<void()> task);
+	void ProcessMainThreadTasks();
+
+private:
+	/** A unit of queued work. */
+	struct Task {
+		std::function<void()> work;  ///< The work to run.
+		TaskGroup *group;            ///< Group the task belongs to, \c nullptr for none.
+	};
+
+	/** Task queue of one worker thread. */
+	struct WorkerQueue {
+		std::mutex mutex;                   ///< Protects #tasks.
+		std::deque<Task> tasks[TKP_COUNT];  ///< Queued tasks, one deque per priority class.
+	};
+
+	void WorkerLoop(uint index);
+	bool FindTask(uint home, Task *task);
+	void Execute(Task &task);
+	void FinishGroupTask(TaskGroup *group);
+
+	std::vector<std::unique_ptr<WorkerQueue>> queues;  ///< Task queues, one per worker thread.
+	std::vector<std::thread> workers;                  ///< The worker threads.
+	std::atomic<uint32> queued_count;                  ///< Total number of queued tasks, to decide when workers may sleep.
+	std::atomic<uint32> submit_cursor;                 ///< Round-robin cursor distributing external submissions over the queues.
+	std::mutex sleep_mutex;                            ///< Protects sleeping on #sleep_condition and #stop.
+	std::condition_variable sleep_condition;           ///< Signals sleeping workers that a task arrived or the pool stops.
+	bool stop;                                         ///< The workers should exit.
+
+	std::mutex main_mutex;                             ///< Protects #main_tasks.
+	std::deque<std::function<void()>> main_tasks;      ///< Tasks that must run on the main thread.
+};
+
+extern TaskSystem _task_system;
+
+#endif
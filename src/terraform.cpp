@@ -60,6 +60,16 @@ static const CornerNeighbours neighbours[4] = {
 	{TC_SOUTH, TC_NORTH, { {{ 0, -1}, TC_SOUTH}, {{ 1, -1}, TC_EAST }, {{ 1,  0}, TC_NORTH}} }, // TC_WEST
 };
 
+static const uint8 UNUSED_GROUND_HEIGHT = 0xFF;  ///< #GroundData::height value of an entry that was never loaded from the world.
+
+/** Default constructor, makes an entry that is not loaded from the world yet. */
+GroundData::GroundData()
+{
+	this->height = UNUSED_GROUND_HEIGHT;
+	this->orig_slope = 0;
+	this->modified = 0;
+}
+
 /**
  * Construct a #GroundData structure.
  * @param height Height of the voxel containing the surface (for steep slopes, the base height).
@@ -72,6 +82,15 @@ GroundData::GroundData(uint8 height, uint8 orig_slope)
 	this->modified = 0;
 }
 
+/**
+ * Whether ground data was loaded from the world into this entry.
+ * @return The entry is in use.
+ */
+bool GroundData::IsLoaded() const
+{
+	return this->height != UNUSED_GROUND_HEIGHT;
+}
+
 /**
  * Get original height (before changing).
  * @param corner Corner to get height.
@@ -124,6 +143,7 @@ TerrainChanges::TerrainChanges(const Point16 &init_base, uint16 init_xsize, uint
 {
 	assert(this->base.x >= 0 && this->base.y >= 0 && this->xsize > 0 && this->ysize > 0
 			&& this->base.x + this->xsize <= _world.GetXSize() && this->base.y + this->ysize <= _world.GetYSize());
+	this->changes.resize(static_cast<size_t>(this->xsize) * this->ysize);
 }
 
 /** Destructor. */
@@ -131,24 +151,63 @@ TerrainChanges::~TerrainChanges()
 = default;
 
 /**
- * Get ground data of a voxel stack.
+ * Compute the index in #changes of a voxel stack position.
  * @param pos Voxel stack position.
- * @return Pointer to the ground data, or \c nullptr if outside the world.
+ * @return Index of the ground data of the position.
+ * @pre The position must be inside the area.
+ */
+size_t TerrainChanges::GetIndex(const Point16 &pos) const
+{
+	return (pos.x - this->base.x) + (pos.y - this->base.y) * static_cast<size_t>(this->xsize);
+}
+
+/**
+ * Get ground data of a voxel stack, loading it from the world on first use.
+ * @param pos Voxel stack position.
+ * @return Pointer to the ground data, or \c nullptr if outside the area.
  */
 GroundData *TerrainChanges::GetGroundData(const Point16 &pos)
 {
 	if (pos.x < this->base.x || pos.x >= this->base.x + this->xsize) return nullptr;
 	if (pos.y < this->base.y || pos.y >= this->base.y + this->ysize) return nullptr;
 
-	auto iter = this->changes.find(pos);
-	if (iter == this->changes.end()) {
+	GroundData &gd = this->changes[this->GetIndex(pos)];
+	if (!gd.IsLoaded()) {
 		uint8 height = _world.GetBaseGroundHeight(pos.x, pos.y);
 		const Voxel *v = _world.GetVoxel(XYZPoint16(pos.x, pos.y, height));
 		assert(v != nullptr && v->GetGroundType() != GTP_INVALID);
-		std::pair<Point16, GroundData> p(pos, GroundData(height, ExpandTileSlope(v->GetGroundSlope())));
-		iter = this->changes.insert(p).first;
+		gd = GroundData(height, ExpandTileSlope(v->GetGroundSlope()));
+		this->used.AddPoint(pos);
 	}
-	return &(*iter).second;
+	return &gd;
+}
+
+/**
+ * Get previously loaded ground data of a voxel stack, without loading it.
+ * @param pos Voxel stack position.
+ * @return Pointer to the ground data, or \c nullptr if outside the area or never examined.
+ */
+const GroundData *TerrainChanges::GetLoadedGroundData(const Point16 &pos) const
+{
+	if (pos.x < this->base.x || pos.x >= this->base.x + this->xsize) return nullptr;
+	if (pos.y < this->base.y || pos.y >= this->base.y + this->ysize) return nullptr;
+
+	const GroundData &gd = this->changes[this->GetIndex(pos)];
+	return gd.IsLoaded() ? &gd : nullptr;
+}
+
+/**
+ * Get the height of a tile corner as currently stored in the world.
+ * @param pos Voxel stack position.
+ * @param corner Corner to query.
+ * @return Height of the corner.
+ * @pre The position must be inside the area.
+ */
+uint8 TerrainChanges::GetCornerHeight(const Point16 &pos, TileCorner corner)
+{
+	const GroundData *gd = this->GetGroundData(pos);
+	assert(gd != nullptr);
+	return gd->GetOrigHeight(corner);
 }
 
 /**
@@ -382,7 +441,7 @@ static void SetXFoundations(int xpos, int ypos)
 	uint8 first_west  = 0;
 	if (first != nullptr) {
 		for (uint i = 0; i < first->height; i++) {
-			const Voxel *v = first->voxels[i].get();
+			const Voxel *v = &first->voxels[i];
 			if (v->GetGroundType() == GTP_INVALID) continue;
 			uint8 heights[4];
 			ComputeCornerHeight(ExpandTileSlope(v->GetGroundSlope()), first->base + i, heights);
@@ -396,7 +455,7 @@ static void SetXFoundations(int xpos, int ypos)
 	uint8 second_east  = 0;
 	if (second != nullptr) {
 		for (uint i = 0; i < second->height; i++) {
-			const Voxel *v = second->voxels[i].get();
+			const Voxel *v = &second->voxels[i];
 			if (v->GetGroundType() == GTP_INVALID) continue;
 			uint8 heights[4];
 			ComputeCornerHeight(ExpandTileSlope(v->GetGroundSlope()), second->base + i, heights);
@@ -427,7 +486,7 @@ static void SetYFoundations(int xpos, int ypos)
 	uint8 first_east  = 0;
 	if (first != nullptr) {
 		for (uint i = 0; i < first->height; i++) {
-			const Voxel *v = first->voxels[i].get();
+			const Voxel *v = &first->voxels[i];
 			if (v->GetGroundType() == GTP_INVALID) continue;
 			uint8 heights[4];
 			ComputeCornerHeight(ExpandTileSlope(v->GetGroundSlope()), first->base + i, heights);
@@ -441,7 +500,7 @@ static void SetYFoundations(int xpos, int ypos)
 	uint8 second_west  = 0;
 	if (second != nullptr) {
 		for (uint i = 0; i < second->height; i++) {
-			const Voxel *v = second->voxels[i].get();
+			const Voxel *v = &second->voxels[i];
 			if (v->GetGroundType() == GTP_INVALID) continue;
 			uint8 heights[4];
 			ComputeCornerHeight(ExpandTileSlope(v->GetGroundSlope()), second->base + i, heights);
@@ -464,48 +523,56 @@ bool TerrainChanges::ModifyWorld(const int direction)
 {
 	/* First iteration: Check that the world can be safely changed (no collisions with other game elements.) */
 	Money total_cost(0);
-	for (auto &iter : this->changes) {
-		const Point16 &pos = iter.first;
-		const GroundData &gd = iter.second;
-		if (gd.modified == 0) continue;
-
-		uint8 current[4]; // Height of each corner after applying modification.
-		ComputeCornerHeight(static_cast<TileSlope>(gd.orig_slope), gd.height, current);
-
-		/* Apply modification. */
-		for (uint8 i = TC_NORTH; i < TC_END; i++) {
-			if ((gd.modified & (1 << i)) == 0) continue; // Corner was not changed.
-			current[i] += direction;
-			total_cost += GetTerraformUnitCost();
-		}
+	Point16 cost_pos(this->used.base); // Representative changed position, for displaying the cost.
+	uint8 cost_height = 0;
+	for (uint16 ypos = this->used.base.y; ypos < this->used.base.y + this->used.height; ypos++) {
+		for (uint16 xpos = this->used.base.x; xpos < this->used.base.x + this->used.width; xpos++) {
+			const Point16 pos(xpos, ypos);
+			const GroundData &gd = this->changes[this->GetIndex(pos)];
+			if (gd.modified == 0) continue;
+			if (total_cost == 0) {
+				cost_pos = pos;
+				cost_height = gd.height;
+			}
 
-		if (direction > 0) {
-			/* Moving upwards, compute upper bound on corner heights. */
-			uint8 max_above[4];
-			std::fill_n(max_above, lengthof(max_above), std::min(gd.height + 3, WORLD_Z_SIZE - 1));
+			uint8 current[4]; // Height of each corner after applying modification.
+			ComputeCornerHeight(static_cast<TileSlope>(gd.orig_slope), gd.height, current);
 
-			const VoxelStack *vs = _world.GetStack(pos.x, pos.y);
-			for (int i = 2; i >= 0; i--) {
-				SetUpperBoundary(vs->Get(gd.height + i), gd.height + i, max_above);
+			/* Apply modification. */
+			for (uint8 i = TC_NORTH; i < TC_END; i++) {
+				if ((gd.modified & (1 << i)) == 0) continue; // Corner was not changed.
+				current[i] += direction;
+				total_cost += GetTerraformUnitCost();
 			}
 
-			/* Check boundaries. */
-			for (uint i = 0; i < 4; i++) {
-				if (current[i] > max_above[i]) return false;
-			}
-		} else if (direction < 0) {
-			/* Moving downwards, compute lower bound on corner heights. */
-			uint8 max_below[4];
-			std::fill_n(max_below, lengthof(max_below), gd.height >= 3 ? gd.height - 3 : 0);
-
-			const VoxelStack *vs = _world.GetStack(pos.x, pos.y);
-			for (int i = std::min<int>(2, gd.height); i >= 0; i--) {
-				SetLowerBoundary(vs->Get(gd.height - i), gd.height - i, max_below);
-			}
+			if (direction > 0) {
+				/* Moving upwards, compute upper bound on corner heights. */
+				uint8 max_above[4];
+				std::fill_n(max_above, lengthof(max_above), std::min(gd.height + 3, WORLD_Z_SIZE - 1));
+
+				const VoxelStack *vs = _world.GetStack(pos.x, pos.y);
+				for (int i = 2; i >= 0; i--) {
+					SetUpperBoundary(vs->Get(gd.height + i), gd.height + i, max_above);
+				}
 
-			/* Check boundaries. */
-			for (uint i = 0; i < 4; i++) {
-				if (current[i] < max_below[i]) return false;
+				/* Check boundaries. */
+				for (uint i = 0; i < 4; i++) {
+					if (current[i] > max_above[i]) return false;
+				}
+			} else if (direction < 0) {
+				/* Moving downwards, compute lower bound on corner heights. */
+				uint8 max_below[4];
+				std::fill_n(max_below, lengthof(max_below), gd.height >= 3 ? gd.height - 3 : 0);
+
+				const VoxelStack *vs = _world.GetStack(pos.x, pos.y);
+				for (int i = std::min<int>(2, gd.height); i >= 0; i--) {
+					SetLowerBoundary(vs->Get(gd.height - i), gd.height - i, max_below);
+				}
+
+				/* Check boundaries. */
+				for (uint i = 0; i < 4; i++) {
+					if (current[i] < max_below[i]) return false;
+				}
 			}
 		}
 	}
@@ -516,68 +583,69 @@ bool TerrainChanges::ModifyWorld(const int direction)
 		return true;
 	}
 	_finances_manager.PayLandscaping(total_cost);
-	_window_manager.GetViewport()->AddFloatawayMoneyAmount(total_cost, XYZPoint16(
-			this->changes.begin()->first.x, this->changes.begin()->first.y, this->changes.begin()->second.height));
+	_window_manager.GetViewport()->AddFloatawayMoneyAmount(total_cost, XYZPoint16(cost_pos.x, cost_pos.y, cost_height));
 
 	/* Second iteration: Change the ground of the tiles. */
-	for (auto &iter : this->changes) {
-		const Point16 &pos = iter.first;
-		const GroundData &gd = iter.second;
-		if (gd.modified == 0) continue;
-
-		uint8 current[4]; // Height of each corner after applying modification.
-		ComputeCornerHeight(static_cast<TileSlope>(gd.orig_slope), gd.height, current);
-
-		/* Apply modification. */
-		for (uint8 i = TC_NORTH; i < TC_END; i++) {
-			if ((gd.modified & (1 << i)) == 0) continue; // Corner was not changed.
-			current[i] += direction;
-		}
+	for (uint16 ypos = this->used.base.y; ypos < this->used.base.y + this->used.height; ypos++) {
+		for (uint16 xpos = this->used.base.x; xpos < this->used.base.x + this->used.width; xpos++) {
+			const Point16 pos(xpos, ypos);
+			const GroundData &gd = this->changes[this->GetIndex(pos)];
+			if (gd.modified == 0) continue;
+
+			uint8 current[4]; // Height of each corner after applying modification.
+			ComputeCornerHeight(static_cast<TileSlope>(gd.orig_slope), gd.height, current);
+
+			/* Apply modification. */
+			for (uint8 i = TC_NORTH; i < TC_END; i++) {
+				if ((gd.modified & (1 << i)) == 0) continue; // Corner was not changed.
+				current[i] += direction;
+			}
 
-		/* Clear the current ground from the stack. */
-		VoxelStack *vs = _world.GetModifyStack(pos.x, pos.y);
-		Voxel *v = vs->GetCreate(gd.height, false); // Should always exist.
-		GroundType gt = v->GetGroundType();
-		assert(gt != GTP_INVALID);
-		FoundationType ft = v->GetFoundationType();
-		uint16 fences = GetGroundFencesFromMap(vs, gd.height);
-
-		uint8 slope = v->GetGroundSlope();
-		assert(!IsImplodedSteepSlopeTop(slope));
-		AddGroundFencesToMap(ALL_INVALID_FENCES, vs, gd.height);
-		v->SetGroundType(GTP_INVALID);
-		v->SetFoundationType(FDT_INVALID);
-		v->SetGroundSlope(0);
-		v->SetFoundationSlope(0);
-		if (IsImplodedSteepSlope(slope)) {
-			Voxel *w = vs->GetCreate(gd.height + 1, false);
-			assert(w->GetGroundType() == gt); // Should be the same type of ground as the base voxel.
-			w->SetFoundationType(FDT_INVALID);
-			w->SetGroundType(GTP_INVALID);
-			w->SetGroundSlope(0);
-			w->SetFoundationSlope(0);
-		}
+			/* Clear the current ground from the stack. */
+			VoxelStack *vs = _world.GetModifyStack(pos.x, pos.y);
+			Voxel *v = vs->GetCreate(gd.height, false); // Should always exist.
+			GroundType gt = v->GetGroundType();
+			assert(gt != GTP_INVALID);
+			FoundationType ft = v->GetFoundationType();
+			uint16 fences = GetGroundFencesFromMap(vs, gd.height);
+
+			uint8 slope = v->GetGroundSlope();
+			assert(!IsImplodedSteepSlopeTop(slope));
+			AddGroundFencesToMap(ALL_INVALID_FENCES, vs, gd.height);
+			v->SetGroundType(GTP_INVALID);
+			v->SetFoundationType(FDT_INVALID);
+			v->SetGroundSlope(0);
+			v->SetFoundationSlope(0);
+			if (IsImplodedSteepSlope(slope)) {
+				Voxel *w = vs->GetCreate(gd.height + 1, false);
+				assert(w->GetGroundType() == gt); // Should be the same type of ground as the base voxel.
+				w->SetFoundationType(FDT_INVALID);
+				w->SetGroundType(GTP_INVALID);
+				w->SetGroundSlope(0);
+				w->SetFoundationSlope(0);
+			}
 
-		/* Add new ground to the stack. */
-		TileSlope new_slope;
-		uint8 height;
-		ComputeSlopeAndHeight(current, &new_slope, &height);
-		assert(height < WORLD_Z_SIZE);
-
-		v = vs->GetCreate(height, true);
-		v->SetGroundSlope(new_slope);
-		v->SetGroundType(gt);
-		v->SetFoundationType(ft);
-		v->SetFoundationSlope(0);
-		if (IsImplodedSteepSlope(new_slope)) {
-			v = vs->GetCreate(height + 1, true);
-			/* Only for steep slopes, the upper voxel will have actual ground. */
+			/* Add new ground to the stack. */
+			TileSlope new_slope;
+			uint8 height;
+			ComputeSlopeAndHeight(current, &new_slope, &height);
+			assert(height < WORLD_Z_SIZE);
+
+			v = vs->GetCreate(height, true);
+			v->SetGroundSlope(new_slope);
 			v->SetGroundType(gt);
-			v->SetGroundSlope(new_slope + TS_TOP_OFFSET); // Set top-part as well for steep slopes.
 			v->SetFoundationType(ft);
 			v->SetFoundationSlope(0);
+			if (IsImplodedSteepSlope(new_slope)) {
+				v = vs->GetCreate(height + 1, true);
+				/* Only for steep slopes, the upper voxel will have actual ground. */
+				v->SetGroundType(gt);
+				v->SetGroundSlope(new_slope + TS_TOP_OFFSET); // Set top-part as well for steep slopes.
+				v->SetFoundationType(ft);
+				v->SetFoundationSlope(0);
+			}
+			AddGroundFencesToMap(fences, vs, height); // Add fences last, as it assumes ground has been fully set.
 		}
-		AddGroundFencesToMap(fences, vs, height); // Add fences last, as it assumes ground has been fully set.
 	}
 
 	/* Third iteration: Add foundations to every changed tile edge.
@@ -585,31 +653,23 @@ bool TerrainChanges::ModifyWorld(const int direction)
 	 * of foundation to its SE and SW edge. If the NE or NW voxel is not
 	 * modified, the voxel will have to perform adding of foundations
 	 * there as well. */
-	for (auto &iter : this->changes) {
-		const Point16 &pos = iter.first;
-		const GroundData &gd = iter.second;
-		if (gd.modified == 0) continue;
-
-		SetXFoundations(pos.x, pos.y);
-		SetYFoundations(pos.x, pos.y);
-
-		Point16 pt(pos.x - 1, pos.y);
-		auto iter2 = this->changes.find(pt);
-		if (iter2 == this->changes.end()) {
-			SetXFoundations(pt.x, pt.y);
-		} else {
-			const GroundData &gd = iter2->second;
-			if (gd.modified == 0) SetXFoundations(pt.x, pt.y);
-		}
-
-		pt.x = pos.x;
-		pt.y = pos.y - 1;
-		iter2 = this->changes.find(pt);
-		if (iter2 == this->changes.end()) {
-			SetYFoundations(pt.x, pt.y);
-		} else {
-			const GroundData &gd = (*iter2).second;
-			if (gd.modified == 0) SetYFoundations(pt.x, pt.y);
+	for (uint16 ypos = this->used.base.y; ypos < this->used.base.y + this->used.height; ypos++) {
+		for (uint16 xpos = this->used.base.x; xpos < this->used.base.x + this->used.width; xpos++) {
+			const Point16 pos(xpos, ypos);
+			const GroundData &gd = this->changes[this->GetIndex(pos)];
+			if (gd.modified == 0) continue;
+
+			SetXFoundations(pos.x, pos.y);
+			SetYFoundations(pos.x, pos.y);
+
+			Point16 pt(pos.x - 1, pos.y);
+			const GroundData *gd2 = this->GetLoadedGroundData(pt);
+			if (gd2 == nullptr || gd2->modified == 0) SetXFoundations(pt.x, pt.y);
+
+			pt.x = pos.x;
+			pt.y = pos.y - 1;
+			gd2 = this->GetLoadedGroundData(pt);
+			if (gd2 == nullptr || gd2->modified == 0) SetYFoundations(pt.x, pt.y);
 		}
 	}
 
@@ -709,3 +769,134 @@ void ChangeAreaCursorMode(const Rectangle16 &orig_area, bool levelling, int dire
 
 	changes.ModifyWorld(direction);
 }
+
+/**
+ * Read the corner height grid of an area from the world.
+ * Grid node (i, j) is the north corner of tile (base.x + i, base.y + j); the grid is one node
+ * wider and higher than the area, so the south-east border corners are included.
+ * @param area Area to examine (must be entirely on-world).
+ * @param heights [out] Height of every grid node, in row-major order with \c area.width+1 nodes per row.
+ */
+static void LoadCornerHeights(const Rectangle16 &area, std::vector<uint8> *heights)
+{
+	TerrainChanges reader(area.base, area.width, area.height);
+	const int gw = area.width + 1;
+	const int gh = area.height + 1;
+	heights->resize(static_cast<size_t>(gw) * gh);
+	for (int j = 0; j < gh; j++) {
+		for (int i = 0; i < gw; i++) {
+			/* Border nodes belong to the last tile row/column of the area. */
+			const Point16 pos(area.base.x + std::min(i, gw - 2), area.base.y + std::min(j, gh - 2));
+			TileCorner corner;
+			if (i < gw - 1) {
+				corner = (j < gh - 1) ? TC_NORTH : TC_EAST;
+			} else {
+				corner = (j < gh - 1) ? TC_WEST : TC_SOUTH;
+			}
+			(*heights)[i + j * static_cast<size_t>(gw)] = reader.GetCornerHeight(pos, corner);
+		}
+	}
+}
+
+/**
+ * Move the corners of an area step-wise towards target heights.
+ * Every step is one validated world transaction that moves each corner at most one height unit,
+ * exactly like a manual terraform operation; the number of steps is bounded by the tallest height
+ * difference, not by the area size. Stops when a corner cannot be changed or the money runs out.
+ * @param area Area to change (must be entirely on-world).
+ * @param targets Target height of every corner grid node, as filled by #LoadCornerHeights.
+ * @param direction Direction of change; only corners on the wrong side of their target in this direction are moved.
+ */
+static void ApplyCornerTargets(const Rectangle16 &area, const std::vector<uint8> &targets, int direction)
+{
+	const size_t gw = area.width + 1;
+	static const TileCorner corner_order[4] = {TC_NORTH, TC_EAST, TC_WEST, TC_SOUTH};
+	for (uint step = 0; step < WORLD_Z_SIZE; step++) {
+		TerrainChanges changes(area.base, area.width, area.height);
+		bool any_change = false;
+		for (uint dy = 0; dy < area.height; dy++) {
+			for (uint dx = 0; dx < area.width; dx++) {
+				const Point16 pos(area.base.x + dx, area.base.y + dy);
+				if (_game_mode_mgr.InPlayMode() && _world.GetTileOwner(pos.x, pos.y) != OWN_PARK) continue;
+				/* Grid node of each corner of this tile. */
+				const size_t nodes[4] = {dx + dy * gw, dx + (dy + 1) * gw, (dx + 1) + dy * gw, (dx + 1) + (dy + 1) * gw};
+				for (uint i = 0; i < 4; i++) {
+					const uint8 current = changes.GetCornerHeight(pos, corner_order[i]);
+					const uint8 target = targets[nodes[i]];
+					if ((direction > 0 && current < target) || (direction < 0 && current > target)) {
+						if (!changes.ChangeCorner(pos, corner_order[i], direction)) return;
+						any_change = true;
+					}
+				}
+			}
+		}
+		if (!any_change) return;
+		if (!changes.ModifyWorld(direction)) return;
+		if (_game_control.action_test_mode) return; // The estimate was shown, the world did not change.
+	}
+}
+
+/**
+ * Smooth the terrain of an area with a single-pass averaging filter.
+ * Each corner moves towards the average height of its 3x3 corner neighbourhood.
+ * @param orig_area Affected area (maybe partly off-world).
+ * @param direction Wheel direction; decides whether low corners are raised before high ones are lowered.
+ */
+void SmoothAreaCursorMode(const Rectangle16 &orig_area, int direction)
+{
+	Rectangle16 area(orig_area); // Restrict area to on-world.
+	area.RestrictTo(0, 0, _world.GetXSize(), _world.GetYSize());
+	if (area.width == 0 || area.height == 0) return;
+
+	std::vector<uint8> heights;
+	LoadCornerHeights(area, &heights);
+
+	const int gw = area.width + 1;
+	const int gh = area.height + 1;
+	std::vector<uint8> targets(heights.size());
+	for (int j = 0; j < gh; j++) {
+		for (int i = 0; i < gw; i++) {
+			int sum = 0;
+			int count = 0;
+			for (int dj = std::max(0, j - 1); dj <= std::min(gh - 1, j + 1); dj++) {
+				for (int di = std::max(0, i - 1); di <= std::min(gw - 1, i + 1); di++) {
+					sum += heights[di + dj * static_cast<size_t>(gw)];
+					count++;
+				}
+			}
+			targets[i + j * static_cast<size_t>(gw)] = (2 * sum + count) / (2 * count); // Round half up.
+		}
+	}
+
+	if (direction >= 0) {
+		ApplyCornerTargets(area, targets, 1);
+		ApplyCornerTargets(area, targets, -1);
+	} else {
+		ApplyCornerTargets(area, targets, -1);
+		ApplyCornerTargets(area, targets, 1);
+	}
+}
+
+/**
+ * Flatten the terrain of an area to a single height in one gesture.
+ * The area is flattened to its average corner height; the wheel direction decides the rounding.
+ * @param orig_area Affected area (maybe partly off-world).
+ * @param direction Wheel direction; positive rounds the target height up, negative rounds it down.
+ */
+void FlattenAreaCursorMode(const Rectangle16 &orig_area, int direction)
+{
+	Rectangle16 area(orig_area); // Restrict area to on-world.
+	area.RestrictTo(0, 0, _world.GetXSize(), _world.GetYSize());
+	if (area.width == 0 || area.height == 0) return;
+
+	std::vector<uint8> heights;
+	LoadCornerHeights(area, &heights);
+
+	size_t sum = 0;
+	for (const uint8 h : heights) sum += h;
+	const uint8 target = (direction >= 0) ? (sum + heights.size() - 1) / heights.size() : sum / heights.size();
+	std::fill(heights.begin(), heights.end(), target);
+
+	ApplyCornerTargets(area, heights, 1);
+	ApplyCornerTargets(area, heights, -1);
+}
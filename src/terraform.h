@@ -10,7 +10,7 @@
 #ifndef TERRAFORM_H
 #define TERRAFORM_H
 
-#include <map>
+#include <vector>
 
 const Money &GetTerraformUnitCost();
 
@@ -23,21 +23,19 @@ struct GroundData {
 	uint8 orig_slope; ///< Original slope data.
 	uint8 modified;   ///< Raised or lowered corners.
 
+	GroundData();
 	GroundData(uint8 height, uint8 orig_slope);
 
+	bool IsLoaded() const;
 	uint8 GetOrigHeight(TileCorner corner) const;
 	bool GetCornerModified(TileCorner corner) const;
 	void SetCornerModified(TileCorner corner);
 };
 
-/**
- * Map of voxels to ground modification data.
- * @ingroup map_group
- */
-typedef std::map<Point16, GroundData> GroundModificationMap;
-
 /**
  * Store and manage terrain changes.
+ * The object collects and validates all modifications first, the world is only touched in
+ * the single #ModifyWorld commit pass.
  * @todo Enable pulling the screen min/max coordinates from it, so we can give a good estimate of the area to redraw.
  * @ingroup map_group
  */
@@ -49,19 +47,24 @@ public:
 	void UpdatelevellingHeight(const Point16 &pos, int direction, uint8 *height);
 	bool ChangeVoxel(const Point16 &pos, uint8 height, int direction);
 	bool ChangeCorner(const Point16 &pos, TileCorner corner, int direction);
+	uint8 GetCornerHeight(const Point16 &pos, TileCorner corner);
 	bool ModifyWorld(int direction);
 
-	GroundModificationMap changes; ///< Registered changes.
-
 private:
 	Point16 base; ///< Base position of the smooth changing world.
 	uint16 xsize; ///< Horizontal size of the smooth changing world.
 	uint16 ysize; ///< Vertical size of the smooth changing world.
+	std::vector<GroundData> changes; ///< Ground data of every tile of the area, loaded on first use.
+	Rectangle16 used;                ///< Bounding rectangle of the loaded entries of #changes.
 
+	size_t GetIndex(const Point16 &pos) const;
 	GroundData *GetGroundData(const Point16 &pos);
+	const GroundData *GetLoadedGroundData(const Point16 &pos) const;
 };
 
 void ChangeTileCursorMode(const Point16 &voxel_pos, CursorType ctype, bool levelling, int direction, bool dot_mode);
 void ChangeAreaCursorMode(const Rectangle16 &area, bool levelling, int direction);
+void SmoothAreaCursorMode(const Rectangle16 &area, int direction);
+void FlattenAreaCursorMode(const Rectangle16 &area, int direction);
 
 #endif
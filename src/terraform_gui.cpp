@@ -17,9 +17,17 @@
 #include "gui_sprites.h"
 #include "mouse_mode.h"
 
-static const int TERRAFORM_MAX_SIZE = 9;      ///< Maximum length of tiles for terraforming (both X and Y).
+static const int TERRAFORM_MAX_SIZE = 32;     ///< Maximum length of tiles for terraforming (both X and Y).
 static const int TERRAFORM_ELEMENT_SIZE = 16; ///< Horizontal size of a tile in the display (pixels).
 
+/** Operation that the terraform brush applies to the selected area. */
+enum TerraformBrush {
+	TB_LEVEL,    ///< Raise the lowest (or lower the highest) corners of the area.
+	TB_MOVE,     ///< Move the entire area up or down as-is.
+	TB_SMOOTH,   ///< Smooth the area with an averaging filter.
+	TB_FLATTEN,  ///< Flatten the entire area to a single height.
+};
+
 /** GUI for setting properties for terraforming. */
 class TerraformGui : public GuiWindow {
 public:
@@ -33,13 +41,13 @@ public:
 	void SelectorMouseMoveEvent(Viewport *vp, const Point16 &pos) override;
 	void SelectorMouseButtonEvent(MouseButtons state) override;
 
-	bool level; ///< If true, level the area, else move it up/down as-is.
+	TerraformBrush brush; ///< Operation to apply to the area.
 	int xsize;  ///< Size of the terraform area in horizontal direction.
 	int ysize;  ///< Size of the terraform area in vertical direction.
 	std::optional<TileOwner> change_owner;  ///< Ownership to apply to the selected area.
 
 private:
-	void SetLevelling(bool level);
+	void SetBrush(TerraformBrush brush);
 	void SetChangeOwner(std::optional<TileOwner> owner);
 	void SetTerraformSize(int xs = -1, int ys = -1);
 	void IncreaseSize();
@@ -58,6 +66,10 @@ enum TerraformWidgets {
 	TERR_LEVEL_TEXT, ///< Text of the 'level' radio button.
 	TERR_MOVE,       ///< Move the terraform area.
 	TERR_MOVE_TEXT,  ///< Textof the 'move' radio button.
+	TERR_SMOOTH,       ///< Smooth the terraform area.
+	TERR_SMOOTH_TEXT,  ///< Text of the 'smooth' radio button.
+	TERR_FLATTEN,      ///< Flatten the terraform area.
+	TERR_FLATTEN_TEXT, ///< Text of the 'flatten' radio button.
 	TERR_OWNER_PANEL,           ///< Land ownership panel.
 	TERR_OWNER_UNCHANGED,       ///< Do not change land ownership radio button.
 	TERR_OWNER_UNCHANGED_TEXT,  ///< Do not change land ownership label.
@@ -85,11 +97,15 @@ static const WidgetPart _terraform_gui_parts[] = {
 					Widget(WT_TEXT_PUSHBUTTON, TERR_SUB, COL_RANGE_DARK_GREEN),
 							SetData(GUI_TERRAFORM_SUB_TEXT, GUI_TERRAFORM_SUB_TOOLTIP),
 		Widget(WT_PANEL, INVALID_WIDGET_INDEX, COL_RANGE_DARK_GREEN),
-			Intermediate(2, 2),
+			Intermediate(4, 2),
 				Widget(WT_RADIOBUTTON, TERR_LEVEL, COL_RANGE_DARK_GREEN), SetPadding(0, 2, 0, 0),
 				Widget(WT_LEFT_TEXT, TERR_LEVEL_TEXT, COL_RANGE_DARK_GREEN), SetData(GUI_TERRAFORM_LEVEL_TEXT, STR_NULL),
 				Widget(WT_RADIOBUTTON, TERR_MOVE, COL_RANGE_DARK_GREEN), SetPadding(0, 2, 0, 0),
 				Widget(WT_LEFT_TEXT, TERR_MOVE_TEXT, COL_RANGE_DARK_GREEN), SetData(GUI_TERRAFORM_MOVE_TEXT, STR_NULL),
+				Widget(WT_RADIOBUTTON, TERR_SMOOTH, COL_RANGE_DARK_GREEN), SetPadding(0, 2, 0, 0),
+				Widget(WT_LEFT_TEXT, TERR_SMOOTH_TEXT, COL_RANGE_DARK_GREEN), SetData(GUI_TERRAFORM_SMOOTH_TEXT, STR_NULL),
+				Widget(WT_RADIOBUTTON, TERR_FLATTEN, COL_RANGE_DARK_GREEN), SetPadding(0, 2, 0, 0),
+				Widget(WT_LEFT_TEXT, TERR_FLATTEN_TEXT, COL_RANGE_DARK_GREEN), SetData(GUI_TERRAFORM_FLATTEN_TEXT, STR_NULL),
 		Widget(WT_PANEL, TERR_OWNER_PANEL, COL_RANGE_DARK_GREEN),
 			Intermediate(4, 2),
 				Widget(WT_RADIOBUTTON, TERR_OWNER_UNCHANGED, COL_RANGE_DARK_GREEN), SetPadding(0, 2, 0, 0),
@@ -107,7 +123,7 @@ TerraformGui::TerraformGui() : GuiWindow(WC_TERRAFORM, ALL_WINDOWS_OF_TYPE)
 {
 	this->SetupWidgetTree(_terraform_gui_parts, lengthof(_terraform_gui_parts));
 	this->tiles_selector.default_enable_cursors = true;
-	this->SetLevelling(true);
+	this->SetBrush(TB_LEVEL);
 	this->SetChangeOwner(std::nullopt);
 	this->SetTerraformSize(1, 1);
 }
@@ -121,10 +137,22 @@ void TerraformGui::SelectorMouseWheelEvent(int direction)
 {
 	if (this->selector == nullptr) return;
 
-	if (this->xsize <= 1 && this->ysize <= 1) { // 'dot' mode, or single tile mode..
-		ChangeTileCursorMode(this->tiles_selector.area.base, this->tiles_selector.cur_cursor, this->level, direction, (this->xsize == 0 && this->ysize == 0));
-	} else {
-		ChangeAreaCursorMode(this->tiles_selector.area, this->level, direction);
+	switch (this->brush) {
+		case TB_SMOOTH:
+			SmoothAreaCursorMode(this->tiles_selector.area, direction);
+			break;
+
+		case TB_FLATTEN:
+			FlattenAreaCursorMode(this->tiles_selector.area, direction);
+			break;
+
+		default:
+			if (this->xsize <= 1 && this->ysize <= 1) { // 'dot' mode, or single tile mode..
+				ChangeTileCursorMode(this->tiles_selector.area.base, this->tiles_selector.cur_cursor, this->brush == TB_LEVEL, direction, (this->xsize == 0 && this->ysize == 0));
+			} else {
+				ChangeAreaCursorMode(this->tiles_selector.area, this->brush == TB_LEVEL, direction);
+			}
+			break;
 	}
 	this->tiles_selector.InitTileData();
 }
@@ -183,22 +211,28 @@ void TerraformGui::DrawWidget(WidgetNumber wid_num, const BaseWidget *wid) const
 
 	/* Draw area with >= 1 tile.
 	 * Here, size == xsize, but also (size / 2)  == ysize, since xsize == ysize * 2 in a flat tile world.
+	 * Large brushes are drawn at a smaller scale, so the preview keeps fitting in the widget.
 	 */
-	int size = this->xsize * TERRAFORM_ELEMENT_SIZE / 2 + this->ysize * TERRAFORM_ELEMENT_SIZE / 2;
+	int elem = TERRAFORM_ELEMENT_SIZE;
+	int size = this->xsize * elem / 2 + this->ysize * elem / 2;
+	while (elem > 4 && size > wid->pos.width) {
+		elem /= 2;
+		size = this->xsize * elem / 2 + this->ysize * elem / 2;
+	}
 	base.x = this->GetWidgetScreenX(wid) + (wid->pos.width - size) / 2; // Left position of the drawn tiles.
 	base.y = this->GetWidgetScreenY(wid) + (wid->pos.height - size / 2) / 2; // Top position of the drawn tiles.
-	base.y += this->xsize * TERRAFORM_ELEMENT_SIZE / 4; // Lower to (0, 0) of the drawn tiles (left-most position).
+	base.y += this->xsize * elem / 4; // Lower to (0, 0) of the drawn tiles (left-most position).
 
 	for (int x = 0; x < this->xsize; x++) {
 		for (int y = 0; y < this->ysize; y++) {
-			Point16 left(base.x + (x + y) * TERRAFORM_ELEMENT_SIZE / 2, base.y + (y - x) * TERRAFORM_ELEMENT_SIZE / 4);
+			Point16 left(base.x + (x + y) * elem / 2, base.y + (y - x) * elem / 4);
 
-			Point16 top(left.x + TERRAFORM_ELEMENT_SIZE / 2, left.y - TERRAFORM_ELEMENT_SIZE / 4);
+			Point16 top(left.x + elem / 2, left.y - elem / 4);
 			_video.DrawLine(left, top, MakeRGBA(255, 255, 255, OPAQUE));
 
-			Point16 bottom(top.x, left.y + TERRAFORM_ELEMENT_SIZE / 4);
+			Point16 bottom(top.x, left.y + elem / 4);
 			_video.DrawLine(left, bottom, MakeRGBA(255, 255, 255, OPAQUE));
-			left.x += TERRAFORM_ELEMENT_SIZE; // Move 'left' to the right.
+			left.x += elem; // Move 'left' to the right.
 			_video.DrawLine(top, left, MakeRGBA(255, 255, 255, OPAQUE));
 			_video.DrawLine(bottom, left, MakeRGBA(255, 255, 255, OPAQUE));
 		}
@@ -218,12 +252,22 @@ void TerraformGui::OnClick(WidgetNumber wid, [[maybe_unused]] const Point16 &pos
 
 		case TERR_LEVEL_TEXT:
 		case TERR_LEVEL:
-			if (!this->level) this->SetLevelling(true);
+			this->SetBrush(TB_LEVEL);
 			break;
 
 		case TERR_MOVE_TEXT:
 		case TERR_MOVE:
-			if (this->level) this->SetLevelling(false);
+			this->SetBrush(TB_MOVE);
+			break;
+
+		case TERR_SMOOTH_TEXT:
+		case TERR_SMOOTH:
+			this->SetBrush(TB_SMOOTH);
+			break;
+
+		case TERR_FLATTEN_TEXT:
+		case TERR_FLATTEN:
+			this->SetBrush(TB_FLATTEN);
 			break;
 
 		case TERR_OWNER_UNCHANGED_TEXT:
@@ -249,17 +293,21 @@ void TerraformGui::OnClick(WidgetNumber wid, [[maybe_unused]] const Point16 &pos
 }
 
 /**
- * Set mode of terraforming:
+ * Set the operation of the terraform brush:
  * - 'levelling': Lowest part up, or highest part up.
  * - 'moving':    Move entire area up or down.
- * @param level If \c true, set levelling mode, else set moving mode.
+ * - 'smoothing': Average out the height differences in the area.
+ * - 'flatten':   Flatten the entire area to one height.
+ * @param brush Brush operation to use.
  */
-void TerraformGui::SetLevelling(bool level)
+void TerraformGui::SetBrush(TerraformBrush brush)
 {
-	this->level = level;
+	this->brush = brush;
 
-	this->SetWidgetCheckedAndPressed(TERR_LEVEL, this->level);
-	this->SetWidgetCheckedAndPressed(TERR_MOVE, !this->level);
+	this->SetWidgetCheckedAndPressed(TERR_LEVEL, brush == TB_LEVEL);
+	this->SetWidgetCheckedAndPressed(TERR_MOVE, brush == TB_MOVE);
+	this->SetWidgetCheckedAndPressed(TERR_SMOOTH, brush == TB_SMOOTH);
+	this->SetWidgetCheckedAndPressed(TERR_FLATTEN, brush == TB_FLATTEN);
 }
 
 void TerraformGui::SetChangeOwner(std::optional<TileOwner> owner)
@@ -180,6 +180,39 @@ static inline bool IsImplodedSteepSlopeTop(uint8 ts)
 	return ts >= ISL_TOP_STEEP_NORTH;
 }
 
+/**
+ * Expanded form of every imploded slope sprite number.
+ * The first fifteen sprite numbers equal their corner bits; the steep sprites get their
+ * #TSB_STEEP (and #TSB_TOP) bits and top corner bit set.
+ * @see ExpandTileSlope
+ * @ingroup map_group
+ */
+static constexpr TileSlope _expanded_tile_slope[NUM_SLOPE_SPRITES] = {
+	static_cast<TileSlope>(ISL_FLAT),
+	static_cast<TileSlope>(ISL_NORTH),
+	static_cast<TileSlope>(ISL_EAST),
+	static_cast<TileSlope>(ISL_NORTH_EAST),
+	static_cast<TileSlope>(ISL_SOUTH),
+	static_cast<TileSlope>(ISL_NORTH_SOUTH),
+	static_cast<TileSlope>(ISL_EAST_SOUTH),
+	static_cast<TileSlope>(ISL_NORTH_EAST_SOUTH),
+	static_cast<TileSlope>(ISL_WEST),
+	static_cast<TileSlope>(ISL_NORTH_WEST),
+	static_cast<TileSlope>(ISL_EAST_WEST),
+	static_cast<TileSlope>(ISL_NORTH_EAST_WEST),
+	static_cast<TileSlope>(ISL_SOUTH_WEST),
+	static_cast<TileSlope>(ISL_NORTH_SOUTH_WEST),
+	static_cast<TileSlope>(ISL_EAST_SOUTH_WEST),
+	static_cast<TileSlope>(TSB_STEEP + TSB_NORTH),
+	static_cast<TileSlope>(TSB_STEEP + TSB_EAST),
+	static_cast<TileSlope>(TSB_STEEP + TSB_SOUTH),
+	static_cast<TileSlope>(TSB_STEEP + TSB_WEST),
+	static_cast<TileSlope>(TSB_STEEP + TSB_TOP + TSB_NORTH),
+	static_cast<TileSlope>(TSB_STEEP + TSB_TOP + TSB_EAST),
+	static_cast<TileSlope>(TSB_STEEP + TSB_TOP + TSB_SOUTH),
+	static_cast<TileSlope>(TSB_STEEP + TSB_TOP + TSB_WEST),
+};
+
 /**
  * Expand a slope sprite number to its bit-encoded form for easier manipulating.
  * @param v %Sprite slope number.
@@ -188,9 +221,8 @@ static inline bool IsImplodedSteepSlopeTop(uint8 ts)
  */
 static inline TileSlope ExpandTileSlope(uint8 v)
 {
-	if (v < ISL_BOTTOM_STEEP_NORTH) return static_cast<TileSlope>(v);
-	if (v < ISL_TOP_STEEP_NORTH) return static_cast<TileSlope>(TSB_STEEP | (1 << (v - ISL_BOTTOM_STEEP_NORTH)));
-	return static_cast<TileSlope>(TSB_STEEP | TSB_TOP | (1 << (v - ISL_TOP_STEEP_NORTH)));
+	assert(v < NUM_SLOPE_SPRITES);
+	return _expanded_tile_slope[v];
 }
 
 /**
@@ -7,6 +7,8 @@
 
 /** @file tile_func.cpp Tile functions. */
 
+#include <array>
+
 #include "stdafx.h"
 #include "tile.h"
 
@@ -54,6 +56,36 @@ const Point16 _exit_dxy[EDGE_COUNT] = {
 	{128,  -1}, ///< EDGE_NW
 };
 
+/**
+ * Build the table with corner height offsets of every expanded slope.
+ * @return Offsets of the four corners relative to the base voxel, for every expanded slope value.
+ */
+static constexpr std::array<std::array<int8, TC_END>, 1 << (TS_TOP + 1)> BuildCornerHeightOffsets()
+{
+	std::array<std::array<int8, TC_END>, 1 << (TS_TOP + 1)> table{};
+	for (uint slope = 0; slope < table.size(); slope++) {
+		if ((slope & TSB_STEEP) != 0) {
+			uint i = TC_NORTH;
+			while (i < TC_END && (slope & (1 << i)) == 0) i++;
+			if (i == TC_END) continue; // Not a valid steep slope, leave the entry flat.
+
+			const int8 base = ((slope & TSB_TOP) != 0) ? -1 : 0; // Top sprites are one voxel above the base.
+			table[slope][i] = base + 2;
+			table[slope][(i + 2) % 4] = base;
+			table[slope][(i + 1) % 4] = base + 1;
+			table[slope][(i + 3) % 4] = base + 1;
+		} else {
+			for (uint i = TC_NORTH; i < TC_END; i++) {
+				table[slope][i] = ((slope & (1 << i)) == 0) ? 0 : 1;
+			}
+		}
+	}
+	return table;
+}
+
+/** Corner height offsets relative to the base voxel, indexed by expanded slope. */
+static constexpr std::array<std::array<int8, TC_END>, 1 << (TS_TOP + 1)> _corner_height_offset = BuildCornerHeightOffsets();
+
 /**
  * Compute the height of the corners of an expanded ground tile.
  * @param slope Expanded slope.
@@ -62,23 +94,10 @@ const Point16 _exit_dxy[EDGE_COUNT] = {
  */
 void ComputeCornerHeight(TileSlope slope, uint8 base_height, uint8 *output)
 {
-	if ((slope & TSB_STEEP) != 0) {
-		uint i;
-		for (i = TC_NORTH; i < TC_END; i++) {
-			if ((slope & (1 << i)) != 0) break;
-		}
-		assert(i < TC_END);
-
-		if ((slope & TSB_TOP) != 0) base_height--; // Move to the base height.
-
-		output[i] = base_height + 2;
-		output[(i + 2) % 4] = base_height;
-		output[(i + 1) % 4] = base_height + 1;
-		output[(i + 3) % 4] = base_height + 1;
-		return;
-	}
+	assert(static_cast<uint>(slope) < _corner_height_offset.size());
+	const std::array<int8, TC_END> &offsets = _corner_height_offset[slope];
 	for (uint i = TC_NORTH; i < TC_END; i++) {
-		output[i] = ((slope & (1 << i)) == 0) ? base_height : base_height + 1;
+		output[i] = base_height + offsets[i];
 	}
 }
 
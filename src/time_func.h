@@ -11,6 +11,7 @@
 #define TIME_H
 
 #include <chrono>
+#include <cstdio>
 
 using Realtime = std::chrono::high_resolution_clock::time_point;  ///< Represents a time point in real time.
 using Duration = std::chrono::duration<double, std::milli>;       ///< Difference between two time points with millisecond precision.
@@ -34,4 +35,37 @@ inline double Delta(const Realtime &start, const Realtime &end = Time())
 	return d.count();
 }
 
+/**
+ * Scoped timer that logs how long a named startup phase took.
+ * Each phase prints one machine-readable line of the form
+ * <tt>[startup] phase=NAME detail=DETAIL ms=DURATION</tt>
+ * (the \c detail field is omitted when not provided).
+ */
+class StartupPhaseTimer {
+public:
+	/**
+	 * Start timing a phase.
+	 * @param name Name of the phase.
+	 * @param detail Optional detail of the phase, e.g. a file name. May be \c nullptr.
+	 */
+	explicit StartupPhaseTimer(const char *name, const char *detail = nullptr)
+	: name(name), detail(detail), start(Time())
+	{
+	}
+
+	~StartupPhaseTimer()
+	{
+		if (this->detail != nullptr) {
+			printf("[startup] phase=%s detail=%s ms=%.3f\n", this->name, this->detail, Delta(this->start));
+		} else {
+			printf("[startup] phase=%s ms=%.3f\n", this->name, Delta(this->start));
+		}
+	}
+
+private:
+	const char *name;   ///< Name of the phase.
+	const char *detail; ///< Optional detail of the phase, \c nullptr if none.
+	Realtime start;     ///< When the phase started.
+};
+
 #endif
@@ -151,7 +151,7 @@ void ToolbarWindow::OnDraw(MouseModeSelector *selector)
 	this->SetWidgetPressed(TB_SPEED_1, _game_control.speed == GSP_1);
 	this->SetWidgetPressed(TB_SPEED_2, _game_control.speed == GSP_2);
 	this->SetWidgetPressed(TB_SPEED_4, _game_control.speed == GSP_4);
-	this->SetWidgetPressed(TB_SPEED_8, _game_control.speed == GSP_8);
+	this->SetWidgetPressed(TB_SPEED_8, _game_control.speed == GSP_8 || _game_control.speed == GSP_TURBO);
 
 	GuiWindow::OnDraw(selector);
 }
@@ -232,7 +232,8 @@ void ToolbarWindow::OnClick(WidgetNumber number, [[maybe_unused]] const Point16
 			_game_control.speed = GSP_4;
 			break;
 		case TB_SPEED_8:
-			_game_control.speed = GSP_8;
+			/* Clicking the fastest speed again engages turbo: batch as many ticks per frame as the budget allows. */
+			_game_control.speed = (_game_control.speed == GSP_8) ? GSP_TURBO : GSP_8;
 			break;
 
 		case TB_GUI_PATHS:
@@ -506,6 +507,7 @@ void BottomToolbarWindow::OnChange(ChangeCode code, [[maybe_unused]] uint32 para
 {
 	switch (code) {
 		case CHG_RESOLUTION_CHANGED:
+			this->InvalidateWidgets(); // The toolbar is sized after the screen width.
 			this->ResetSize();
 			break;
 
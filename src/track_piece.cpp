@@ -7,6 +7,8 @@
 
 /** @file track_piece.cpp Functions of the track pieces. */
 
+#include <cmath>
+
 #include "stdafx.h"
 #include "sprite_store.h"
 #include "fileio.h"
@@ -143,9 +145,166 @@ static void LoadTrackCurve(RcdFileReader *rcd_file, std::unique_ptr<TrackCurve>
 #undef ENSURE_LENGTH
 }
 
+/** Combined sin/cos table for 16 roll positions. sin table starts at 0, cos table start at 4. */
+static const float _sin_cos_table[20] = {
+	0.00, 0.38, 0.71, 0.92,
+	1.00, 0.92, 0.71, 0.38, 0.00, -0.38, -0.71, -0.92, -1.00, -0.92, -0.71, -0.38,
+	0.00, 0.38, 0.71, 0.92
+};
+
+/**
+ * Revert the roll of the coaster car in the direction vector.
+ * @param roll Amount of roll of the car.
+ * @param dy [inout] Derivative of Y position.
+ * @param dz [inout] Derivative of Z position.
+ */
+static void inline Unroll(uint roll, int32 *dy, int32 *dz)
+{
+	/* Rotates around X axis, thus dx does not change. */
+	int32 new_dy = *dy * _sin_cos_table[roll + 4] - *dz * _sin_cos_table[roll];
+	int32 new_dz = *dy * _sin_cos_table[roll]     + *dz * _sin_cos_table[roll + 4];
+	*dy = new_dy;
+	*dz = new_dz;
+}
+
+static const double TAN11_25 = 0.198912367379658;  // tan(11.25 degrees).
+static const double TAN33_75 = 0.6681786379192989; // tan(3*11.25 degrees).
+
+/**
+ * Quantize an unrolled track tangent to one of the 16 pitch indices.
+ * @param horizontal_speed Length of the tangent projected on the horizontal plane.
+ * @param zder Derivative of Z position.
+ * @return Pitch index of a car with the given tangent.
+ */
+static uint8 ComputePitch(float horizontal_speed, int32 zder)
+{
+	bool swap_dz = false;
+	if (zder < 0) {
+		swap_dz = true;
+		zder = -zder;
+	}
+
+	uint pitch;
+	if (horizontal_speed < zder) {
+		if (horizontal_speed < zder * TAN11_25) {
+			pitch = 4;
+		} else if (horizontal_speed < zder * TAN33_75) {
+			pitch = 3;
+		} else {
+			pitch = 2;
+		}
+	} else {
+		if (zder < horizontal_speed * TAN11_25) {
+			pitch = 0;
+		} else if (zder < horizontal_speed * TAN33_75) {
+			pitch = 1;
+		} else {
+			pitch = 2;
+		}
+	}
+	if (swap_dz) pitch = (16 - pitch) & 0xf;
+	return pitch;
+}
+
+/**
+ * Quantize an unrolled track tangent to one of the 16 yaw indices.
+ * @param xder Derivative of X position.
+ * @param yder Derivative of Y position.
+ * @return Yaw index of a car with the given tangent.
+ */
+static uint8 ComputeYaw(int32 xder, int32 yder)
+{
+	bool swap_dx = false;
+	if (xder > 0) {
+		swap_dx = true;
+		xder = -xder;
+	}
+	bool swap_dy = false;
+	if (yder > 0) {
+		swap_dy = true;
+		yder = -yder;
+	}
+	uint yaw;
+	/* There are 16 yaw directions, the 360 degrees needs to be split in 16 pieces.
+	 * However the x and y axes are in the middle of a piece, so 360 degrees is split
+	 * in 32 parts, and 2 parts form one piece. */
+	if (xder < yder) {
+		/* In the first 45 degrees. It is split in 4 parts (4*11.25 degrees)
+		 * where the 1st part is for direction 0. The 2nd and 3rd part are for direction 1,
+		 * and the 4th part is for direction 2. */
+		if (xder * TAN11_25 < yder) {
+			yaw = 0;
+		} else if (xder * TAN33_75 < yder) {
+			yaw = 1;
+		} else {
+			yaw = 2;
+		}
+	} else {
+		/* In the second 45 degrees. It is also split in 4 parts (4*11.25 degrees)
+		 * where the 1st part is for direction 2. The 2nd and 3rd part are for direction 3,
+		 * and the 4th part is for direction 4.
+		 *
+		 * Rather than re-inventing a solution, re-use the same checks as
+		 * above with swapped xder and yder. */
+		if (yder * TAN11_25 < xder) {
+			yaw = 4;
+		} else if (yder * TAN33_75 < xder) {
+			yaw = 3;
+		} else {
+			yaw = 2;
+		}
+	}
+	if (swap_dx) yaw = 8 - yaw;
+	if (swap_dy) yaw = (16 - yaw) & 0xf;
+	return yaw;
+}
+
+/** Arc-length step aimed for between the samples of a track piece, in 1/256 pixel (1/32 of a tile). */
+static const uint32 TRACK_SAMPLE_STEP = 2048;
+
+/**
+ * Precompute the sampled car states along the piece.
+ * The track geometry is static once loaded, so the position, orientation and gravity
+ * response of cars are sampled here at fixed arc-length steps, leaving only table
+ * interpolation in the per-frame train update.
+ */
+void TrackPiece::BuildSampleTable()
+{
+	const uint32 steps = std::max<uint32>(2, (this->piece_length + TRACK_SAMPLE_STEP - 1) / TRACK_SAMPLE_STEP);
+	this->sample_step = (this->piece_length + steps - 1) / steps;
+	this->samples.resize(steps + 1);
+
+	for (uint32 i = 0; i <= steps; i++) {
+		const uint32 d = std::min(i * this->sample_step, this->piece_length);
+		TrackSample &ts = this->samples[i];
+		ts.xpos = this->car_xpos->GetValue(d);
+		ts.ypos = this->car_ypos->GetValue(d);
+		ts.zpos = this->car_zpos->GetValue(d) * 2; // Tile height is half the width.
+		ts.roll = static_cast<uint>(this->car_roll->GetValue(d) + 0.5) & 0xf;
+	}
+
+	for (uint32 i = 0; i <= steps; i++) {
+		/* Tangent of the track from the neighbouring samples. */
+		const TrackSample &sp = this->samples[i > 0 ? i - 1 : 0];
+		const TrackSample &sn = this->samples[i < steps ? i + 1 : steps];
+		int32 xder = sn.xpos - sp.xpos;
+		int32 yder = sn.ypos - sp.ypos;
+		int32 zder = (sn.zpos - sp.zpos) / 2; // Tile height is half the width.
+
+		TrackSample &ts = this->samples[i];
+		const float total_speed = sqrt(xder * xder + yder * yder + zder * zder);
+		ts.gravity = (total_speed == 0) ? 0.0f : zder / total_speed;
+
+		Unroll(ts.roll, &yder, &zder);
+		ts.pitch = ComputePitch(std::hypot(xder, yder), zder);
+		ts.yaw = ComputeYaw(xder, yder);
+	}
+}
+
 TrackPiece::TrackPiece()
 {
 	this->piece_length = 0;
+	this->sample_step = 0;
 	this->car_xpos = nullptr;
 	this->car_ypos = nullptr;
 	this->car_zpos = nullptr;
@@ -163,8 +322,8 @@ void TrackPiece::RemoveFromWorld([[maybe_unused]] const uint16 ride_index, const
 	for (const auto &subpiece : this->track_voxels) {
 		Voxel *voxel = _world.GetCreateVoxel(base_voxel + subpiece->dxyz, false);
 		assert(voxel);
-		if (voxel->instance != SRI_FREE) {
-			assert(voxel->instance == ride_index);
+		if (voxel->GetInstance() != SRI_FREE) {
+			assert(voxel->GetInstance() == ride_index);
 			voxel->ClearInstances();
 		}
 	}
@@ -211,6 +370,7 @@ void TrackPiece::Load(RcdFileReader *rcd_file)
 	if (this->car_xpos == nullptr || this->car_ypos == nullptr || this->car_zpos == nullptr || this->car_roll == nullptr) {
 		rcd_file->Error("Car sprites missing");
 	}
+	this->BuildSampleTable();
 
 	this->internal_name = rcd_file->GetText();
 	length -= this->internal_name.size();
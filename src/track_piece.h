@@ -155,12 +155,24 @@ public:
 	std::vector<CubicBezier> curve; ///< Curve describing the track piece.
 };
 
+/** Sampled car state at one arc-length step of a track piece (see #TrackPiece::BuildSampleTable). */
+struct TrackSample {
+	int32 xpos;    ///< X position of a car relative to the piece base voxel, in 1/256 pixel.
+	int32 ypos;    ///< Y position of a car relative to the piece base voxel, in 1/256 pixel.
+	int32 zpos;    ///< Z position of a car relative to the piece base voxel, doubled since tile height is half the width.
+	float gravity; ///< Downhill fraction of the track tangent, feeding the gravity response of trains.
+	uint8 pitch;   ///< Vertical orientation index of a car at the sample.
+	uint8 roll;    ///< Roll orientation index of a car at the sample.
+	uint8 yaw;     ///< Horizontal orientation index of a car at the sample.
+};
+
 /** One track piece (type) of a roller coaster track. */
 class TrackPiece {
 public:
 	TrackPiece();
 
 	void Load(RcdFileReader *rcd_file);
+	void BuildSampleTable();
 	Rectangle16 GetArea() const;
 
 	uint8 entry_connect;      ///< Entry connection code
@@ -180,6 +192,38 @@ public:
 	std::unique_ptr<TrackCurve> car_yaw;      ///< Yaw of cars over this track piece, may be \c null.
 	std::string internal_name;                ///< Internal name of the piece.
 
+	uint32 sample_step;               ///< Arc-length step between the entries of #samples, in 1/256 pixel.
+	std::vector<TrackSample> samples; ///< Sampled car states along the piece, every #sample_step of arc-length.
+
+	/**
+	 * Get the position of a car at a distance along the piece by interpolating the sample table.
+	 * @param distance Distance of the car at the piece, in 1/256 pixel.
+	 * @param xpos [out] X position of the car relative to the piece base voxel.
+	 * @param ypos [out] Y position of the car relative to the piece base voxel.
+	 * @param zpos [out] Doubled Z position of the car relative to the piece base voxel.
+	 */
+	inline void SamplePosition(uint32 distance, int32 *xpos, int32 *ypos, int32 *zpos) const
+	{
+		const uint32 index = std::min<uint32>(distance / this->sample_step, this->samples.size() - 2);
+		const TrackSample &s0 = this->samples[index];
+		const TrackSample &s1 = this->samples[index + 1];
+		const int32 frac = distance - index * this->sample_step;
+		const int32 step = this->sample_step;
+		*xpos = s0.xpos + (s1.xpos - s0.xpos) * frac / step;
+		*ypos = s0.ypos + (s1.ypos - s0.ypos) * frac / step;
+		*zpos = s0.zpos + (s1.zpos - s0.zpos) * frac / step;
+	}
+
+	/**
+	 * Get the sampled car state nearest to a distance along the piece.
+	 * @param distance Distance of the car at the piece, in 1/256 pixel.
+	 * @return The nearest sample.
+	 */
+	inline const TrackSample &SampleAt(uint32 distance) const
+	{
+		return this->samples[std::min<uint32>((distance + this->sample_step / 2) / this->sample_step, this->samples.size() - 1)];
+	}
+
 	void RemoveFromWorld(uint16 ride_index, XYZPoint16 base_voxel) const;
 
 	/**
@@ -10,19 +10,26 @@
 #include <GL/glew.h>  // This include must come first!
 
 #include "video.h"
+#include "fileio.h"
 #include "gamecontrol.h"
+#include "profiler.h"
 #include "rev.h"
 #include "sprite_data.h"
 #include "sprite_store.h"
 #include "string_func.h"
+#include "task_system.h"
 #include "window.h"
 
 #include <cmath>
+#include <cstring>
+#include <ctime>
 #include <fstream>
 #include <sstream>
 #include <thread>
 #include <vector>
 
+#include <png.h>
+
 #ifdef WEBASSEMBLY
 #include <emscripten.h>
 #endif
@@ -53,6 +60,10 @@ void TextRenderer::Initialize()
 {
 	this->shader = _video.ConfigureShader("text");
 	glUniform1i(glGetUniformLocation(this->shader, "text"), 0);
+	this->colour_uniform[0] = glGetUniformLocation(this->shader, "text_colour_r");
+	this->colour_uniform[1] = glGetUniformLocation(this->shader, "text_colour_g");
+	this->colour_uniform[2] = glGetUniformLocation(this->shader, "text_colour_b");
+	this->colour_uniform[3] = glGetUniformLocation(this->shader, "text_colour_a");
 	glGenVertexArrays(1, &this->vao);
 	glGenBuffers(1, &this->vbo);
 	glBindVertexArray(this->vao);
@@ -101,7 +112,12 @@ void TextRenderer::LoadFont(const std::string &font_path, GLuint font_size)
 	FT_Set_Pixel_Sizes(face, 0, font_size);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	/* Load all characters we may need. */
+	/* Load all characters we may need, keeping their bitmaps until the glyph atlas is assembled. */
+	struct LoadedGlyph {
+		uint32 codepoint;           ///< Unicode codepoint of the glyph.
+		std::vector<uint8> bitmap;  ///< Greyscale pixel values of the glyph.
+	};
+	std::vector<LoadedGlyph> loaded;
 	for (uint32 codepoint = 1; codepoint <= MAX_CODEPOINT; codepoint = NextCodepointToLoad(codepoint)) {
 		if (FT_Load_Char(face, codepoint, FT_LOAD_RENDER) != 0) {
 			this->characters[codepoint].valid = false;
@@ -111,38 +127,68 @@ void TextRenderer::LoadFont(const std::string &font_path, GLuint font_size)
 			continue;
 		}
 
-		GLuint texture;
-		glGenTextures(1, &texture);
-		glBindTexture(GL_TEXTURE_2D, texture);
-		glTexImage2D(
-				GL_TEXTURE_2D,
-				0,
-				GL_R8,
-				face->glyph->bitmap.width,
-				face->glyph->bitmap.rows,
-				0,
-				GL_RED,
-				GL_UNSIGNED_BYTE,
-				face->glyph->bitmap.buffer
-		);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
 		this->characters[codepoint] = {
-			texture,
+			WXYZPointF(0.0f, 0.0f, 0.0f, 0.0f),
 			Point16(face->glyph->bitmap.width, face->glyph->bitmap.rows),
 			Point16(face->glyph->bitmap_left, face->glyph->bitmap_top),
 			static_cast<GLuint>(face->glyph->advance.x),
 			true
 		};
+		LoadedGlyph lg;
+		lg.codepoint = codepoint;
+		const uint8 *src = face->glyph->bitmap.buffer;
+		lg.bitmap.assign(src, src + face->glyph->bitmap.width * face->glyph->bitmap.rows);
+		loaded.push_back(std::move(lg));
 	}
 
-	glBindTexture(GL_TEXTURE_2D, 0);
 	FT_Done_Face(face);
 	FT_Done_FreeType(ft);
 
+	/* Pack the glyphs into rows of a single atlas texture, with a pixel of spacing
+	 * between them to prevent bleeding when glyphs are rendered scaled. */
+	constexpr const int ATLAS_WIDTH = 1024;
+	int pen_x = 0;
+	int pen_y = 0;
+	int row_height = 0;
+	std::vector<Point16> positions;
+	positions.reserve(loaded.size());
+	for (const LoadedGlyph &lg : loaded) {
+		const FontGlyph &fg = this->characters[lg.codepoint];
+		if (pen_x + fg.size.x > ATLAS_WIDTH) {
+			pen_x = 0;
+			pen_y += row_height + 1;
+			row_height = 0;
+		}
+		positions.emplace_back(pen_x, pen_y);
+		pen_x += fg.size.x + 1;
+		row_height = std::max<int>(row_height, fg.size.y);
+	}
+	const int atlas_height = pen_y + row_height;
+
+	std::unique_ptr<uint8[]> pixels(new uint8[ATLAS_WIDTH * atlas_height]());
+	for (uint i = 0; i < loaded.size(); ++i) {
+		FontGlyph &fg = this->characters[loaded[i].codepoint];
+		const Point16 &pos = positions[i];
+		for (int row = 0; row < fg.size.y; ++row) {
+			std::copy_n(&loaded[i].bitmap[row * fg.size.x], fg.size.x, &pixels[(pos.y + row) * ATLAS_WIDTH + pos.x]);
+		}
+		fg.tex = WXYZPointF(
+				static_cast<float>(pos.x) / ATLAS_WIDTH,
+				static_cast<float>(pos.y) / atlas_height,
+				static_cast<float>(pos.x + fg.size.x) / ATLAS_WIDTH,
+				static_cast<float>(pos.y + fg.size.y) / atlas_height);
+	}
+
+	if (this->atlas != 0) glDeleteTextures(1, &this->atlas);
+	glGenTextures(1, &this->atlas);
+	glBindTexture(GL_TEXTURE_2D, this->atlas);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, ATLAS_WIDTH, atlas_height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.get());
+	glBindTexture(GL_TEXTURE_2D, 0);
+
 	/* Check that we have at least a bearing character and a glyph for invalid characters. */
 	std::string sample_text = {BEARING_CHARACTER};
 	const char *c = sample_text.c_str();
@@ -203,13 +249,56 @@ void TextRenderer::Draw(const std::string &text, float x, float y, float max_wid
 	if (text.empty()) return;
 
 	glUseProgram(this->shader);
-	glUniform1f(glGetUniformLocation(this->shader, "text_colour_r"), FGetR(colour));
-	glUniform1f(glGetUniformLocation(this->shader, "text_colour_g"), FGetG(colour));
-	glUniform1f(glGetUniformLocation(this->shader, "text_colour_b"), FGetB(colour));
-	glUniform1f(glGetUniformLocation(this->shader, "text_colour_a"), FGetA(colour));
+	glActiveTexture(GL_TEXTURE0);
+	glBindVertexArray(this->vao);
+	glBindTexture(GL_TEXTURE_2D, this->atlas);
+
+	this->DrawString(text, x, y, max_width, colour, scale);
+
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/**
+ * Render several strings in one pass.
+ * The shader, vertex array, and atlas texture are bound only once for the entire batch.
+ * @param requests Texts to draw, with their screen positions and colours.
+ * @param scale Scaling factor for the text size.
+ */
+void TextRenderer::DrawAll(const std::vector<TextRequest> &requests, float scale)
+{
+	if (requests.empty()) return;
 
+	glUseProgram(this->shader);
 	glActiveTexture(GL_TEXTURE0);
 	glBindVertexArray(this->vao);
+	glBindTexture(GL_TEXTURE_2D, this->atlas);
+
+	for (const TextRequest &tr : requests) {
+		if (tr.text->empty()) continue;
+		this->DrawString(*tr.text, tr.x, tr.y, 0x7FFF, tr.colour, scale);
+	}
+
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/**
+ * Upload and draw the glyph quads of a single string.
+ * The text shader, vertex array, and atlas texture must have been bound by the caller.
+ * @param text Text to draw.
+ * @param x Horizontal screen position where to draw the text.
+ * @param y Vertical screen position where to draw the text.
+ * @param max_width Maximum available width.
+ * @param colour Colour in which to draw the text.
+ * @param scale Scaling factor for the text size.
+ */
+void TextRenderer::DrawString(const std::string &text, float x, float y, float max_width, uint32 colour, float scale)
+{
+	glUniform1f(this->colour_uniform[0], FGetR(colour));
+	glUniform1f(this->colour_uniform[1], FGetG(colour));
+	glUniform1f(this->colour_uniform[2], FGetB(colour));
+	glUniform1f(this->colour_uniform[3], FGetA(colour));
 
 	/* Insert some padding around the text.
 	 * Horizontal spacing is distributed equally on both sides of the text,
@@ -219,6 +308,9 @@ void TextRenderer::Draw(const std::string &text, float x, float y, float max_wid
 	x += FONT_PADDING_H * 0.5f;
 	max_width -= FONT_PADDING_H;
 
+	/* All glyphs live in one atlas texture, so the whole string becomes a single draw call. */
+	std::vector<GLfloat> vertices;
+	vertices.reserve(text.size() * 6 * 4);
 	size_t text_length = text.size();
 	for (const char *c = text.c_str(); *c != '\0';) {
 		const FontGlyph &fg = this->GetFontGlyph(&c, text_length);
@@ -237,24 +329,23 @@ void TextRenderer::Draw(const std::string &text, float x, float y, float max_wid
 		_video.CoordsToGL(&x1, &y1);
 		_video.CoordsToGL(&x2, &y2);
 
-		GLfloat vertices[6][4] = {
-			{ x1, y2,   0.f, 1.f },
-			{ x2, y1,   1.f, 0.f },
-			{ x1, y1,   0.f, 0.f },
+		const GLfloat quad[6][4] = {
+			{ x1, y2,   fg.tex.x, fg.tex.w },
+			{ x2, y1,   fg.tex.z, fg.tex.y },
+			{ x1, y1,   fg.tex.x, fg.tex.y },
 
-			{ x1, y2,   0.f, 1.f },
-			{ x2, y2,   1.f, 1.f },
-			{ x2, y1,   1.f, 0.f }
+			{ x1, y2,   fg.tex.x, fg.tex.w },
+			{ x2, y2,   fg.tex.z, fg.tex.w },
+			{ x2, y1,   fg.tex.z, fg.tex.y }
 		};
-		glBindTexture(GL_TEXTURE_2D, fg.texture_id);
-		glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		vertices.insert(vertices.end(), &quad[0][0], &quad[0][0] + 6 * 4);
 		x += (fg.advance >> 6) * scale;
 	}
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat), vertices.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glDrawArrays(GL_TRIANGLES, 0, vertices.size() / 4);
 }
 
 /**
@@ -531,6 +622,7 @@ void VideoSystem::SetMouseDragging(MouseButtons button, bool dragging, bool hide
 /** Shut down the video system. */
 void VideoSystem::Shutdown()
 {
+	this->HarvestCaptures();  // Hand still pending captures to the encoder before the GL context goes away.
 	glfwTerminate();
 }
 
@@ -643,15 +735,27 @@ bool VideoSystem::MainLoopDoCycle()
 	/* Handle input events. */
 	glfwPollEvents();
 
+	/* Run work that background tasks posted back to the main thread. */
+	_task_system.ProcessMainThreadTasks();
+
 	/* Prepare for the next rendering step. */
 	glClear(GL_COLOR_BUFFER_BIT);
 
 	/* Progress the game. */
-	OnNewFrame(FRAME_DELAY);
+	OnNewFrame(FRAME_DELAY, static_cast<uint32>(Delta(this->last_frame, this->cur_frame)));
 	_game_control.DoNextAction();
 	if (!_game_control.running || glfwWindowShouldClose(this->window)) return false;
 
 	/* Cap the FPS rate. */
+	constexpr double IDLE_EVENT_TIMEOUT = 0.25;  ///< While quiescent, seconds to sleep before checking for work again.
+#ifndef WEBASSEMBLY
+	if (_window_manager.RepaintWasSkipped()) {
+		/* Nothing was rendered and nothing will change on its own: instead of spinning at
+		 * full frame rate, sleep until an input event arrives or a coarse timer expires. */
+		glfwWaitEventsTimeout(IDLE_EVENT_TIMEOUT);
+		return true;
+	}
+#endif
 	double time = Delta(this->cur_frame);
 	if (time < FRAME_DELAY) std::this_thread::sleep_for(Duration(FRAME_DELAY - time));
 
@@ -661,9 +765,156 @@ bool VideoSystem::MainLoopDoCycle()
 /** Finish repainting, perform the final steps. */
 void VideoSystem::FinishRepaint()
 {
+	const ZoneTimer timer(PFZ_PRESENT);
+	this->FlushBlitBatch();
+	this->EvictImageTextures();
+	this->frame_number++;
+
+	this->HarvestCaptures();
+	bool capture = this->screenshot_requested;
+	this->screenshot_requested = false;
+	if (this->timelapse_active && ++this->frames_since_capture >= this->timelapse_interval) {
+		this->frames_since_capture = 0;
+		capture = true;
+	}
+	if (capture) this->StartCapture();
+
 	glfwSwapBuffers(this->window);
 }
 
+/**
+ * Encode an RGBA pixel buffer as a PNG file. Runs on a worker thread.
+ * @param filename File to write.
+ * @param rgba Pixel data, in bottom-up row order as OpenGL reads the framebuffer.
+ * @param width Width of the image in pixels.
+ * @param height Height of the image in pixels.
+ */
+static void WriteCapturePng(const std::string &filename, const uint8 *rgba, uint32 width, uint32 height)
+{
+	FILE *fp = fopen(filename.c_str(), "wb");
+	if (fp == nullptr) {
+		fprintf(stderr, "Failed to open screen capture file \"%s\" for writing.\n", filename.c_str());
+		return;
+	}
+	png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+	png_infop info = (png == nullptr) ? nullptr : png_create_info_struct(png);
+	if (png == nullptr || info == nullptr || setjmp(png_jmpbuf(png))) {
+		fprintf(stderr, "Failed to write screen capture \"%s\".\n", filename.c_str());
+		if (png != nullptr) png_destroy_write_struct(&png, &info);
+		fclose(fp);
+		return;
+	}
+	png_init_io(png, fp);
+	png_set_IHDR(png, info, width, height, 8, PNG_COLOR_TYPE_RGBA,
+			PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(png, info);
+	for (uint32 y = 0; y < height; y++) {
+		png_write_row(png, const_cast<png_bytep>(rgba + static_cast<size_t>(height - 1 - y) * width * 4));
+	}
+	png_write_end(png, nullptr);
+	png_destroy_write_struct(&png, &info);
+	fclose(fp);
+}
+
+/**
+ * Compute the file path for a new screen capture.
+ * @return The path of the PNG file to write.
+ */
+static std::string CaptureFilename()
+{
+	static uint32 sequence_number = 0;  ///< Distinguishes timelapse captures taken within the same second.
+	std::string path = freerct_userdata_prefix();
+	path += DIR_SEP;
+	path += "screenshots";
+	MakeDirectory(path);
+	path += DIR_SEP;
+
+	const time_t now = time(nullptr);
+	char stamp[32];
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", localtime(&now));
+	path += "freerct_";
+	path += stamp;
+	path += "_";
+	path += std::to_string(sequence_number++);
+	path += ".png";
+	return path;
+}
+
+/**
+ * Capture the next presented frame as a screenshot.
+ * The pixels are read back from the GPU asynchronously and encoded on a worker
+ * thread; the render thread only issues the copy.
+ */
+void VideoSystem::RequestScreenshot()
+{
+	this->screenshot_requested = true;
+}
+
+/**
+ * Set the number of presented frames between two timelapse captures.
+ * @param frames Frame interval; \c 0 keeps the current value.
+ */
+void VideoSystem::SetTimelapseInterval(uint32 frames)
+{
+	if (frames > 0) this->timelapse_interval = frames;
+}
+
+/** Switch timelapse mode (a capture every #timelapse_interval presented frames) on or off. */
+void VideoSystem::ToggleTimelapse()
+{
+	this->timelapse_active = !this->timelapse_active;
+	this->frames_since_capture = 0;
+	printf("Timelapse capturing %s.\n", this->timelapse_active ? "started" : "stopped");
+}
+
+/** Issue an asynchronous read-back of the frame just rendered into a capture slot. */
+void VideoSystem::StartCapture()
+{
+	FrameCapture &cap = this->captures[this->capture_cursor];
+	if (cap.in_flight) return;  // All slots are still busy, skip this capture rather than stall.
+	this->capture_cursor = (this->capture_cursor + 1) % lengthof(this->captures);
+
+	if (cap.pbo == 0) glGenBuffers(1, &cap.pbo);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, cap.pbo);
+	if (cap.width != this->width || cap.height != this->height) {
+		cap.width = this->width;
+		cap.height = this->height;
+		glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(cap.width) * cap.height * 4, nullptr, GL_STREAM_READ);
+	}
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, cap.width, cap.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);  // Into the bound pixel buffer, without waiting.
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	cap.filename = CaptureFilename();
+	cap.in_flight = true;
+}
+
+/**
+ * Collect finished capture read-backs and hand them to a worker thread for PNG encoding.
+ * Runs at least one frame after the read-back was issued, so mapping the buffer
+ * normally does not have to wait for the GPU.
+ */
+void VideoSystem::HarvestCaptures()
+{
+	for (FrameCapture &cap : this->captures) {
+		if (!cap.in_flight) continue;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, cap.pbo);
+		const uint8 *pixels = static_cast<const uint8 *>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+		if (pixels != nullptr) {
+			const size_t size = static_cast<size_t>(cap.width) * cap.height * 4;
+			std::shared_ptr<uint8[]> copy(new uint8[size]);
+			std::memcpy(copy.get(), pixels, size);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+			const std::string filename = cap.filename;
+			const uint32 w = cap.width;
+			const uint32 h = cap.height;
+			_task_system.Submit([copy, filename, w, h] { WriteCapturePng(filename, copy.get(), w, h); }, TKP_LOW);
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		cap.in_flight = false;
+	}
+}
+
 /**
  * Calculate the current framerate.
  * @return Frames per second.
@@ -718,21 +969,113 @@ void VideoSystem::PopClip()
 /** Update the current clipping area. */
 void VideoSystem::UpdateClip()
 {
+	this->FlushBlitBatch();  // Batched quads were positioned relative to the old clipping area.
+
+	const Rectangle32 target = this->backing_active ? this->backing_rect : Rectangle32(0, 0, this->width, this->height);
 	float x, y, w, h;
 	if (this->clip.empty()) {
 		x = 0;
 		y = 0;
-		w = this->width;
-		h = this->height;
+		w = target.width;
+		h = target.height;
 	} else {
 		w = this->clip.back().width;
 		h = this->clip.back().height;
-		x = this->clip.back().base.x;
-		y = this->height - h - this->clip.back().base.y;
+		x = this->clip.back().base.x - target.base.x;
+		y = static_cast<float>(target.height) - h - (this->clip.back().base.y - target.base.y);
 	}
 	glViewport(x, y, w, h);
 }
 
+/**
+ * Redirect all drawing to an offscreen backing surface until #FinishBackingSurface is called.
+ * Drawing continues to use absolute screen coordinates; only the area within \a rect is stored.
+ * @param texture [inout] Texture to render to, created or resized as needed. Pass \c 0 to create a new texture.
+ * @param rect Screen area covered by the backing surface.
+ * @see FinishBackingSurface, BlitBackingSurface
+ */
+void VideoSystem::StartBackingSurface(GLuint *texture, const Rectangle32 &rect)
+{
+	assert(!this->backing_active && this->clip.empty());
+	assert(rect.width > 0 && rect.height > 0);
+	this->FlushBlitBatch();
+
+	if (this->backing_fbo == 0) glGenFramebuffers(1, &this->backing_fbo);
+	if (*texture == 0) {
+		glGenTextures(1, texture);
+		glBindTexture(GL_TEXTURE_2D, *texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	} else {
+		glBindTexture(GL_TEXTURE_2D, *texture);
+	}
+
+	/* Only (re)allocate the texture storage when the surface size actually changed;
+	 * redrawing a window of unchanged size renders into the existing allocation. */
+	Point32 &size = this->backing_sizes[*texture];
+	if (size.x != static_cast<int32>(rect.width) || size.y != static_cast<int32>(rect.height)) {
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, rect.width, rect.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		size.x = rect.width;
+		size.y = rect.height;
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, this->backing_fbo);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, *texture, 0);
+
+	this->backing_active = true;
+	this->backing_rect = rect;
+	this->UpdateClip();
+
+	/* Clear to fully transparent, and accumulate coverage in the alpha channel so
+	 * the surface composites correctly over whatever is behind the window.
+	 */
+	glClearColor(0.f, 0.f, 0.f, 0.f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+/**
+ * Stop drawing to a backing surface and resume drawing to the screen.
+ * @see StartBackingSurface
+ */
+void VideoSystem::FinishBackingSurface()
+{
+	assert(this->backing_active && this->clip.empty());
+	this->FlushBlitBatch();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glClearColor(0.f, 0.f, 0.f, 1.0f);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	this->backing_active = false;
+	this->UpdateClip();
+}
+
+/**
+ * Draw a previously rendered backing surface to the screen.
+ * @param texture Texture holding the surface contents.
+ * @param rect Screen area to cover, must have the size the surface was rendered with.
+ */
+void VideoSystem::BlitBackingSurface(GLuint texture, const Rectangle32 &rect)
+{
+	/* Framebuffer textures store the bottom row of the surface first,
+	 * so the vertical texture coordinates are mirrored. */
+	this->DoDrawImage(texture, rect.base.x, rect.base.y,
+			rect.base.x + static_cast<float>(rect.width), rect.base.y + static_cast<float>(rect.height),
+			0xffffffff, WXYZPointF(1.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/**
+ * Delete a backing surface texture.
+ * @param texture Texture to delete, \c 0 is silently ignored.
+ */
+void VideoSystem::FreeBackingSurface(GLuint texture)
+{
+	if (texture == 0) return;
+	if (this->blit_texture == texture) this->FlushBlitBatch();
+	this->backing_sizes.erase(texture);
+	glDeleteTextures(1, &texture);
+}
+
 /**
  * Convert a coordinate from the window coordinate system to OpenGL's coordinate system.
  * @param x [inout] X coordinate.
@@ -741,8 +1084,15 @@ void VideoSystem::UpdateClip()
 void VideoSystem::CoordsToGL(float *x, float *y) const {
 	float w, h;
 	if (this->clip.empty()) {
-		w = this->width;
-		h = this->height;
+		if (this->backing_active) {
+			w = this->backing_rect.width;
+			h = this->backing_rect.height;
+			*x -= this->backing_rect.base.x;
+			*y -= this->backing_rect.base.y;
+		} else {
+			w = this->width;
+			h = this->height;
+		}
 	} else {
 		w = this->clip.back().width;
 		h = this->clip.back().height;
@@ -875,8 +1225,53 @@ GLuint VideoSystem::LoadShaders(const char *vp, const char *fp)
 GLuint VideoSystem::GetImageTexture(const ImageData *img, const Recolouring &recolour, GradientShift shift) {
 	std::pair<const ImageData*, RecolourData> map_key(img, RecolourData(shift, recolour.ToCondensed()));
 	const auto it = this->image_textures.find(map_key);
-	if (it != this->image_textures.end()) return it->second;
+	if (it != this->image_textures.end()) {
+		it->second.last_used = this->frame_number;
+		return it->second.texture;
+	}
+
+	GLuint t = this->UploadRGBATexture(img->GetRecoloured(shift, recolour), img->width, img->height);
+	const size_t bytes = static_cast<size_t>(img->width) * img->height * 4;
+	this->image_textures.emplace(map_key, CachedTexture{t, this->frame_number, bytes});
+	this->texture_cache_bytes += bytes;
+	return t;
+}
+
+/**
+ * Evict least-recently-blitted image textures until the texture cache fits its share
+ * of the sprite memory budget. An evicted texture is simply re-uploaded from the
+ * (cached or recomputed) pixels the next time its image is blitted.
+ */
+void VideoSystem::EvictImageTextures()
+{
+	const size_t limit = SpriteTextureBudget();
+	if (this->texture_cache_bytes <= limit) return;
+
+	/* Gather eviction candidates, oldest blit first; textures used for this frame stay. */
+	std::vector<std::map<std::pair<const ImageData*, RecolourData>, CachedTexture>::iterator> candidates;
+	for (auto it = this->image_textures.begin(); it != this->image_textures.end(); ++it) {
+		if (it->second.last_used != this->frame_number) candidates.push_back(it);
+	}
+	std::sort(candidates.begin(), candidates.end(),
+			[](const auto &a, const auto &b) { return a->second.last_used < b->second.last_used; });
+
+	for (const auto &it : candidates) {
+		if (this->texture_cache_bytes <= limit) break;
+		glDeleteTextures(1, &it->second.texture);
+		this->texture_cache_bytes -= it->second.bytes;
+		this->image_textures.erase(it);
+	}
+}
 
+/**
+ * Upload an RGBA pixel buffer to a new OpenGL texture.
+ * @param rgba Pixel data, rows from top to bottom.
+ * @param width Width of the image in pixels.
+ * @param height Height of the image in pixels.
+ * @return Handle of the created texture.
+ */
+GLuint VideoSystem::UploadRGBATexture(const uint8 *rgba, int width, int height)
+{
 	GLuint t = 0;
 	glGenTextures(1, &t);
 	glBindTexture(GL_TEXTURE_2D, t);
@@ -884,12 +1279,21 @@ GLuint VideoSystem::GetImageTexture(const ImageData *img, const Recolouring &rec
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	std::unique_ptr<uint8[]> rgba = img->GetRecoloured(shift, recolour);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, img->width, img->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba.get());
-	this->image_textures.emplace(map_key, t);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
 	return t;
 }
 
+/**
+ * Draw a previously uploaded texture to the screen.
+ * @param texture Texture to draw.
+ * @param rect Screen area to cover.
+ */
+void VideoSystem::BlitTexture(GLuint texture, const Rectangle32 &rect)
+{
+	this->DoDrawImage(texture, rect.base.x, rect.base.y,
+			rect.base.x + static_cast<float>(rect.width), rect.base.y + static_cast<float>(rect.height));
+}
+
 /**
  * Draw an image to the screen.
  * @param pos Where to draw the image's centre.
@@ -939,17 +1343,50 @@ void VideoSystem::GetNumberRangeSize(int64 smallest, int64 biggest, int *width,
 	if (width == nullptr && height == nullptr) return;
 	assert(smallest <= biggest);
 
+	/* Find the widest digit of the current font. */
+	char widest_digit = '0';
+	float widest_digit_width = 0.0f;
+	for (char digit = '0'; digit <= '9'; ++digit) {
+		PointF vec = _text_renderer.EstimateBounds(std::string(1, digit));
+		if (vec.x > widest_digit_width) {
+			widest_digit_width = vec.x;
+			widest_digit = digit;
+		}
+	}
+
+	/* Glyph advances do not depend on neighbouring characters, so the widest number of a
+	 * given length is the widest digit repeated. Measuring one candidate per digit count
+	 * thus suffices instead of every number in the range. This may reserve a few pixels
+	 * more than the widest number actually in the range, which is harmless for layout.
+	 */
+	std::set<std::string> candidates;
+	candidates.insert(std::to_string(smallest));
+	candidates.insert(std::to_string(biggest));
+	if (biggest > 0) {
+		for (size_t count = std::to_string(biggest).size(); count > 0; --count) {
+			candidates.insert(std::string(count, widest_digit));
+		}
+	}
+	if (smallest < 0) {
+		for (size_t count = std::to_string(smallest).size() - 1; count > 0; --count) {
+			candidates.insert("-" + std::string(count, widest_digit));
+		}
+	}
+
 	if (width != nullptr) *width = 0;
 	if (height != nullptr) *height = 0;
-	for (; smallest <= biggest; ++smallest) {
-		PointF vec = _text_renderer.EstimateBounds(std::to_string(smallest));
+	for (const std::string &candidate : candidates) {
+		PointF vec = _text_renderer.EstimateBounds(candidate);
 		if (width != nullptr) *width = std::max<int>(*width, vec.x);
 		if (height != nullptr) *height = std::max<int>(*height, vec.y);
 	}
 }
 
+static const size_t MAX_CACHED_TEXT_SIZES = 4096;  ///< Number of cached text measurements above which the cache is emptied.
+
 /**
  * Get the text-size of a string.
+ * Results are cached, as widget layout measures the same strings over and over.
  * @param text Text to calculate.
  * @param width [out] Resulting width.
  * @param height [out] Resulting height.
@@ -958,9 +1395,19 @@ void VideoSystem::GetNumberRangeSize(int64 smallest, int64 biggest, int *width,
 void VideoSystem::GetTextSize(const std::string &text, int *width, int *height, bool add_padding)
 {
 	if (width == nullptr && height == nullptr) return;
-	PointF vec = _text_renderer.EstimateBounds(text, add_padding);
-	if (width != nullptr) *width = vec.x;
-	if (height != nullptr) *height = vec.y;
+	auto it = this->text_sizes.find(std::make_pair(text, add_padding));
+	if (it == this->text_sizes.end()) {
+		if (this->text_sizes.size() >= MAX_CACHED_TEXT_SIZES) this->text_sizes.clear();
+		it = this->text_sizes.emplace(std::make_pair(text, add_padding), _text_renderer.EstimateBounds(text, add_padding)).first;
+	}
+	if (width != nullptr) *width = it->second.x;
+	if (height != nullptr) *height = it->second.y;
+}
+
+/** Forget all cached text measurements, e.g. because the language changed. */
+void VideoSystem::ClearTextSizeCache()
+{
+	this->text_sizes.clear();
 }
 
 /**
@@ -984,9 +1431,22 @@ void VideoSystem::BlitText(const std::string &text, uint32 colour, int xpos, int
 		}
 	}
 
+	this->FlushBlitBatch();  // Text rendering binds its own shader and textures.
 	_text_renderer.Draw(text, x, ypos, width, colour);
 }
 
+/**
+ * Draw several texts to the screen in one batched pass.
+ * All texts are drawn left-aligned without a width limit.
+ * @param texts Texts to draw, with their screen positions and colours.
+ */
+void VideoSystem::BlitTexts(const std::vector<TextRequest> &texts)
+{
+	if (texts.empty()) return;
+	this->FlushBlitBatch();  // Text rendering binds its own shader and textures.
+	_text_renderer.DrawAll(texts);
+}
+
 /**
  * Draw an image on the screen.
  * @param texture Texture ID to draw.
@@ -999,35 +1459,58 @@ void VideoSystem::BlitText(const std::string &text, uint32 colour, int xpos, int
  */
 void VideoSystem::DoDrawImage(GLuint texture, float x1, float y1, float x2, float y2, uint32 col, const WXYZPointF &tex)
 {
+	if (texture != this->blit_texture) {
+		this->FlushBlitBatch();
+		this->blit_texture = texture;
+	}
+
 	this->CoordsToGL(&x1, &y1);
 	this->CoordsToGL(&x2, &y2);
-	float vertices[] = {
+	const float vertices[] = {
 		// positions  // colours                                      // texture coords
 		x2, y1, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col), tex.z, tex.w, // top right
 		x2, y2, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col), tex.z, tex.y, // bottom right
 		x1, y2, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col), tex.x, tex.y, // bottom left
 		x1, y1, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col), tex.x, tex.w  // top left
 	};
-	GLuint indices[] = {
-		0, 1, 3, // first triangle
-		1, 2, 3  // second triangle
+	const GLuint base = this->blit_vertices.size() / 9;
+	const GLuint indices[] = {
+		base, base + 1, base + 3, // first triangle
+		base + 1, base + 2, base + 3  // second triangle
 	};
+	this->blit_vertices.insert(this->blit_vertices.end(), std::begin(vertices), std::end(vertices));
+	this->blit_indices.insert(this->blit_indices.end(), std::begin(indices), std::end(indices));
+}
+
+/**
+ * Draw all image quads collected so far in a single draw call.
+ * Quads are batched in #DoDrawImage as long as they share a texture, and
+ * must be flushed before any state they depend on (texture binding, clipping
+ * area, draw order with respect to other primitives) changes.
+ */
+void VideoSystem::FlushBlitBatch()
+{
+	if (this->blit_indices.empty()) return;
 
 	glBindVertexArray(this->vao);
 	glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glBufferData(GL_ARRAY_BUFFER, this->blit_vertices.size() * sizeof(float), this->blit_vertices.data(), GL_STREAM_DRAW);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ebo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->blit_indices.size() * sizeof(GLuint), this->blit_indices.data(), GL_STREAM_DRAW);
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)nullptr);
 	glEnableVertexAttribArray(0);
 	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(3 * sizeof(float)));
 	glEnableVertexAttribArray(1);
 	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(7 * sizeof(float)));
 	glEnableVertexAttribArray(2);
-	glBindTexture(GL_TEXTURE_2D, texture);
+	glBindTexture(GL_TEXTURE_2D, this->blit_texture);
 	glUseProgram(this->image_shader);
 	glBindVertexArray(this->vao);
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+	glDrawElements(GL_TRIANGLES, this->blit_indices.size(), GL_UNSIGNED_INT, nullptr);
+
+	this->blit_vertices.clear();
+	this->blit_indices.clear();
+	this->blit_texture = 0;
 }
 
 /**
@@ -1036,6 +1519,8 @@ void VideoSystem::DoDrawImage(GLuint texture, float x1, float y1, float x2, floa
  * @param col RGBA colour to use.
  */
 void VideoSystem::DoDrawPlainColours(const std::vector<Point<float>> &points, uint32 col) {
+	this->FlushBlitBatch();
+
 	struct PerVertexData {
 		float gl_x;
 		float gl_y;
@@ -1079,6 +1564,8 @@ void VideoSystem::DoDrawPlainColours(const std::vector<Point<float>> &points, ui
  * @param col RGBA colour to use.
  */
 void VideoSystem::DoDrawLine(float x1, float y1, float x2, float y2, uint32 col) {
+	this->FlushBlitBatch();
+
 	this->CoordsToGL(&x1, &y1);
 	this->CoordsToGL(&x2, &y2);
 	float vertices[] = {
@@ -1106,6 +1593,8 @@ void VideoSystem::DoDrawLine(float x1, float y1, float x2, float y2, uint32 col)
  * @param col RGBA colour to use.
  */
 void VideoSystem::DoFillPlainColour(float x1, float y1, float x2, float y2, uint32 col) {
+	this->FlushBlitBatch();
+
 	this->CoordsToGL(&x1, &y1);
 	this->CoordsToGL(&x2, &y2);
 	float vertices[] = {
@@ -1132,3 +1621,55 @@ void VideoSystem::DoFillPlainColour(float x1, float y1, float x2, float y2, uint
 	glBindVertexArray(this->vao);
 	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
 }
+
+/**
+ * Fill many rectangles in solid colours with a single draw call.
+ * Later rectangles are drawn over earlier ones.
+ * @param rects Rectangles to fill, each with its own RGBA colour.
+ */
+void VideoSystem::FillRectangles(const std::vector<std::pair<Rectangle32, uint32>> &rects)
+{
+	if (rects.empty()) return;
+	this->FlushBlitBatch();
+
+	std::vector<float> vertices;
+	std::vector<GLuint> indices;
+	vertices.reserve(rects.size() * 4 * 7);
+	indices.reserve(rects.size() * 6);
+	for (const auto &iter : rects) {
+		float x1 = iter.first.base.x;
+		float y1 = iter.first.base.y;
+		float x2 = iter.first.base.x + static_cast<float>(iter.first.width);
+		float y2 = iter.first.base.y + static_cast<float>(iter.first.height);
+		this->CoordsToGL(&x1, &y1);
+		this->CoordsToGL(&x2, &y2);
+		const uint32 col = iter.second;
+		const float quad[] = {
+			// positions  // colours
+			x2, y1, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col),
+			x2, y2, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col),
+			x1, y1, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col),
+			x1, y2, 0.0f, FGetR(col), FGetG(col), FGetB(col), FGetA(col),
+		};
+		const GLuint base = vertices.size() / 7;
+		const GLuint quad_indices[] = {
+			base, base + 1, base + 2,
+			base + 1, base + 2, base + 3,
+		};
+		vertices.insert(vertices.end(), std::begin(quad), std::end(quad));
+		indices.insert(indices.end(), std::begin(quad_indices), std::end(quad_indices));
+	}
+
+	glBindVertexArray(this->vao);
+	glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STREAM_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)nullptr);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+	glUseProgram(this->colour_shader);
+	glBindVertexArray(this->vao);
+	glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, nullptr);
+}
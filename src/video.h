@@ -26,6 +26,14 @@
 struct FontGlyph;
 class ImageData;
 
+/** One text string with screen position and colour, for drawing several texts in one batched pass. */
+struct TextRequest {
+	const std::string *text;  ///< Text to draw (not owned by the request).
+	float x;                  ///< Horizontal screen position.
+	float y;                  ///< Vertical screen position.
+	uint32 colour;            ///< Colour in which to draw the text.
+};
+
 /** Class responsible for rendering text. */
 class TextRenderer {
 public:
@@ -38,11 +46,12 @@ public:
 	PointF EstimateBounds(const std::string &text, bool add_padding = true, float scale = 1.0f) const;
 
 	void Draw(const std::string &text, float x, float y, float max_width, uint32 colour, float scale = 1.0f);
+	void DrawAll(const std::vector<TextRequest> &requests, float scale = 1.0f);
 
 private:
 	/** Helper struct representing a font glyph. */
 	struct FontGlyph {
-		GLuint texture_id;   ///< The OpenGL texture used to render this glyph.
+		WXYZPointF tex;      ///< Texture coordinates of this glyph in the glyph atlas.
 		Point16 size;        ///< Size of this glyph in pixels.
 		Point16 bearing;     ///< Alignment offset from the baseline.
 		GLuint advance;      ///< Horizontal spacing.
@@ -50,10 +59,13 @@ private:
 	};
 
 	const FontGlyph &GetFontGlyph(const char **text, size_t &length) const;
+	void DrawString(const std::string &text, float x, float y, float max_width, uint32 colour, float scale);
 
 	FontGlyph characters[MAX_CODEPOINT + 1];  ///< All character glyphs in the current font indexed by their unicode codepoint.
+	GLuint atlas = 0;                         ///< The OpenGL texture holding the bitmaps of all glyphs.
 	GLuint font_size;                         ///< Current font size.
 	GLuint shader;                            ///< The font shader.
+	GLint colour_uniform[4];                  ///< Cached locations of the RGBA text colour uniforms of #shader.
 	GLuint vao;                               ///< The OpenGL vertex array.
 	GLuint vbo;                               ///< The OpenGL vertex buffer.
 };
@@ -156,8 +168,10 @@ public:
 	}
 
 	void BlitText(const std::string &text, uint32 colour, int xpos, int ypos, int width = 0x7FFF, Alignment align = ALG_LEFT);
+	void BlitTexts(const std::vector<TextRequest> &texts);
 	void GetTextSize(const std::string &text, int *width, int *height, bool add_padding = true);
 	void GetNumberRangeSize(int64 smallest, int64 biggest, int *width, int *height);
+	void ClearTextSizeCache();
 
 	/**
 	 * Draw a line from \a start to \a end using the specified \a colour.
@@ -197,6 +211,11 @@ public:
 		this->DoFillPlainColour(rect.base.x, rect.base.y, rect.base.x + static_cast<float>(rect.width), rect.base.y + static_cast<float>(rect.height), colour);
 	}
 
+	void FillRectangles(const std::vector<std::pair<Rectangle32, uint32>> &rects);
+
+	GLuint UploadRGBATexture(const uint8 *rgba, int width, int height);
+	void BlitTexture(GLuint texture, const Rectangle32 &rect);
+
 	void TileImage(const ImageData *img, const Rectangle32 &rect, bool tile_hor, bool tile_vert,
 			const Recolouring &recolour = _no_recolour,
 			GradientShift shift = GS_NORMAL, uint32 col = 0xffffffff);
@@ -206,8 +225,26 @@ public:
 	void PushClip(const Rectangle32 &rect);
 	void PopClip();
 
+	void StartBackingSurface(GLuint *texture, const Rectangle32 &rect);
+	void FinishBackingSurface();
+	void BlitBackingSurface(GLuint texture, const Rectangle32 &rect);
+	void FreeBackingSurface(GLuint texture);
+
 	void FinishRepaint();
 
+	void RequestScreenshot();
+	void SetTimelapseInterval(uint32 frames);
+	void ToggleTimelapse();
+
+	/**
+	 * Get the estimated pixel memory held by the cached image textures.
+	 * @return Number of bytes.
+	 */
+	size_t TextureCacheBytes() const
+	{
+		return this->texture_cache_bytes;
+	}
+
 private:
 	bool MainLoopDoCycle();
 
@@ -217,11 +254,16 @@ private:
 	GLuint GetImageTexture(const ImageData *img, const Recolouring &recolour, GradientShift shift);
 	void DoDrawImage(GLuint texture, float x1, float y1, float x2, float y2,
 			uint32 col = 0xffffffff, const WXYZPointF &tex = WXYZPointF(0.0f, 0.0f, 1.0f, 1.0f));
+	void FlushBlitBatch();
 
 	void DoDrawPlainColours(const std::vector<Point<float>> &points, uint32 colour);
 	void DoDrawLine(float x1, float y1, float x2, float y2, uint32 colour);
 	void DoFillPlainColour(float x1, float y1, float x2, float y2, uint32 colour);
 
+	void StartCapture();
+	void HarvestCaptures();
+	void EvictImageTextures();
+
 	static void FramebufferSizeCallback(GLFWwindow *window, int new_w, int new_h);
 	static void MouseClickCallback(GLFWwindow *window, int button, int action, int mods);
 	static void MouseMoveCallback(GLFWwindow *window, double x, double y);
@@ -241,7 +283,21 @@ private:
 	Realtime cur_frame;        ///< Time when the current frame started.
 	double average_frametime;  ///< Long-term average framerate in milliseconds per frame.
 
-	std::map<std::pair<const ImageData*, RecolourData>, GLuint> image_textures;  ///< Textures for all loaded images.
+	/** A cached texture of one image and recolouring combination. */
+	struct CachedTexture {
+		GLuint texture;    ///< The uploaded OpenGL texture.
+		uint32 last_used;  ///< Frame number of the last blit with this texture, for least-recently-used eviction.
+		size_t bytes;      ///< Pixel memory of the texture.
+	};
+	std::map<std::pair<const ImageData*, RecolourData>, CachedTexture> image_textures;  ///< Textures for all loaded images.
+	size_t texture_cache_bytes = 0;  ///< Estimated pixel memory of all cached image textures.
+	uint32 frame_number = 0;         ///< Presented frame counter, for texture cache bookkeeping.
+
+	std::map<std::pair<std::string, bool>, PointF> text_sizes;  ///< Cached text measurement results, keyed by string and padding flag.
+
+	std::vector<float> blit_vertices;   ///< Vertex data of image quads collected for the current batch.
+	std::vector<GLuint> blit_indices;   ///< Index data of image quads collected for the current batch.
+	GLuint blit_texture = 0;            ///< Texture shared by all quads in the current batch.
 
 	GLuint image_shader;   ///< Shader for images.
 	GLuint colour_shader;  ///< Shader for plain colours.
@@ -251,6 +307,26 @@ private:
 
 	std::vector<Rectangle32> clip;  ///< Current clipping area stack.
 
+	/** One in-flight screen capture, read back from the framebuffer asynchronously through a pixel buffer. */
+	struct FrameCapture {
+		GLuint pbo = 0;          ///< Pixel pack buffer the GPU copies the frame into.
+		uint32 width = 0;        ///< Width of the captured frame in pixels.
+		uint32 height = 0;       ///< Height of the captured frame in pixels.
+		std::string filename;    ///< Destination file of the capture.
+		bool in_flight = false;  ///< A read-back was issued and not yet collected.
+	};
+	FrameCapture captures[2];             ///< Capture slots; the read-back of one frame completes while the next frame renders.
+	uint capture_cursor = 0;              ///< Next capture slot to use.
+	bool screenshot_requested = false;    ///< Capture the next presented frame as a single screenshot.
+	bool timelapse_active = false;        ///< Whether a capture is taken every #timelapse_interval frames.
+	uint32 timelapse_interval = 60;       ///< Number of presented frames between two timelapse captures.
+	uint32 frames_since_capture = 0;      ///< Presented frames since the last timelapse capture.
+
+	GLuint backing_fbo = 0;       ///< Framebuffer for rendering windows to backing surfaces.
+	Rectangle32 backing_rect;     ///< Screen area of the backing surface currently being rendered.
+	bool backing_active = false;  ///< Whether drawing is currently redirected to a backing surface.
+	std::map<GLuint, Point32> backing_sizes;  ///< Allocated pixel size of each backing surface texture, to reuse storage across redraws.
+
 	GLFWwindow *window;  ///< The GLFW window.
 };
 
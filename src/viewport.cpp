@@ -26,7 +26,10 @@
 #include "fence.h"
 #include "gamecontrol.h"
 #include "scenery.h"
+#include "profiler.h"
+#include "task_system.h"
 
+#include <algorithm>
 #include <set>
 
 /**
@@ -108,6 +111,7 @@ public:
 	void SetWindowSize(int16 xpos, int16 ypos, uint16 width, uint16 height);
 
 	void Collect();
+	void CollectRange(uint first_x, uint last_x);
 	void SetSelector(MouseModeSelector *selector);
 
 	/**
@@ -188,6 +192,7 @@ struct DrawData {
 		this->base = base;
 		this->recolour = recolour;
 		this->gs = gs;
+		this->person = nullptr;
 		assert(this->sprite != nullptr);
 	}
 
@@ -196,6 +201,9 @@ struct DrawData {
 	int32 level;                 ///< Slice of this sprite (vertical row).
 	SpriteOrder order;           ///< Selection when to draw this sprite (sorts sprites within a voxel). @see SpriteOrder
 	Point32 base;                ///< Base coordinate of the image, relative to top-left of the window.
+	Point32 north;               ///< Window coordinate of the north corner of the voxel this sprite was collected from, for incremental invalidation.
+	XYZPoint16 voxel_pos;        ///< World position of the voxel this sprite was collected from, for hit testing.
+	const Person *person;        ///< %Person drawn by this sprite, if any, for hit testing.
 	uint16 z_height;             ///< Height of the voxel being drawn.
 	GradientShift gs;            ///< Gradient shift of the sprite.
 };
@@ -218,7 +226,7 @@ inline bool operator<(const DrawData &dd1, const DrawData &dd2)
  * Collection of sprites to render to the screen.
  * @ingroup viewport_group
  */
-typedef std::multiset<DrawData> DrawImages;
+typedef std::vector<DrawData> DrawImages;
 
 /**
  * Collect sprites to draw in a viewport.
@@ -231,15 +239,42 @@ public:
 
 	void SetXYOffset(int16 xoffset, int16 yoffset);
 
-	DrawImages draw_images; ///< Sprites to draw ordered by viewing distance.
+	/**
+	 * Restrict collection to the sprites of voxel objects (persons and ride cars).
+	 * The static geometry (terrain, foundations, fences, paths, rides, scenery) is skipped.
+	 * @param objects_only Whether to collect voxel object sprites only.
+	 */
+	inline void SetObjectsOnly(bool objects_only)
+	{
+		this->objects_only = objects_only;
+	}
+
+	DrawImages draw_images; ///< Collected sprites to draw, depth-sorted after the collection pass.
 	int16 xoffset; ///< Horizontal offset of the top-left coordinate to the top-left of the display.
 	int16 yoffset; ///< Vertical offset of the top-left coordinate to the top-left of the display.
+	bool objects_only; ///< Collect only the sprites of voxel objects.
 
 protected:
 	void CollectVoxel(const Voxel *vx, const XYZPoint16 &voxel_pos, int32 xnorth, int32 ynorth) override;
+	void CollectStaticSprites(const Voxel *voxel, const XYZPoint16 &voxel_pos, const Point32 &north_point, int32 slice);
+	void CollectObjectSprites(const Voxel *voxel, const XYZPoint16 &voxel_pos, const Point32 &north_point, int32 slice);
 	void SetupSupports(const VoxelStack *stack, uint xpos, uint ypos) override;
 	const ImageData *GetCursorSpriteAtPos(CursorType ctype, const XYZPoint16 &voxel_pos, uint8 tslope);
 
+	/**
+	 * Add a draw data entry to the collected sprites, stamping it with the voxel position being collected.
+	 * @param dd Entry to add.
+	 */
+	inline void Submit(DrawData &dd)
+	{
+		dd.north = this->cur_north;
+		dd.voxel_pos = this->cur_voxel;
+		this->draw_images.push_back(dd);
+	}
+
+	Point32 cur_north;    ///< Window coordinate of the north corner of the voxel currently being collected.
+	XYZPoint16 cur_voxel; ///< World position of the voxel currently being collected.
+
 	/** For each orientation the location of the real northern corner of a tile relative to the northern displayed corner. */
 	Point16 north_offsets[4];
 
@@ -316,7 +351,17 @@ void VoxelCollector::SetSelector(MouseModeSelector *selector)
  */
 void VoxelCollector::Collect()
 {
-	for (uint xpos = 0; xpos < _world.GetXSize(); xpos++) {
+	this->CollectRange(0, _world.GetXSize());
+}
+
+/**
+ * Perform the collecting cycle for a range of voxel stacks.
+ * @param first_x First x coordinate of the voxel stacks to visit.
+ * @param last_x First x coordinate of the voxel stacks not to visit any more.
+ */
+void VoxelCollector::CollectRange(uint first_x, uint last_x)
+{
+	for (uint xpos = first_x; xpos < last_x; xpos++) {
 		int32 world_x = (xpos + ((this->orient == VOR_SOUTH || this->orient == VOR_WEST) ? 1 : 0)) * 256;
 		for (uint ypos = 0; ypos < _world.GetYSize(); ypos++) {
 			int32 world_y = (ypos + ((this->orient == VOR_SOUTH || this->orient == VOR_EAST) ? 1 : 0)) * 256;
@@ -345,7 +390,11 @@ void VoxelCollector::Collect()
 				if (north_y + TileWidth(this->zoom) / 2 + TileHeight(this->zoom) <= static_cast<int32>(this->rect.base.y)) break;  // Above the window and rising!
 
 				int count = zpos - stack->base;
-				const Voxel *voxel = (count >= 0 && count < stack->height) ? stack->voxels[count].get() : nullptr;
+				const Voxel *voxel = (count >= 0 && count < stack->height) ? &stack->voxels[count] : nullptr;
+				/* Without a selector there is nothing to draw for voxels outside the precomputed
+				 * drawable range of the stack, unless a voxel object is passing through. */
+				if (this->selector == nullptr && voxel != nullptr &&
+						!stack->IsVoxelDrawable(count) && !voxel->HasVoxelObjects()) continue;
 				this->CollectVoxel(voxel, XYZPoint16(xpos, ypos, zpos), north_x, north_y);
 			}
 		}
@@ -361,6 +410,7 @@ SpriteCollector::SpriteCollector(Viewport *vp) : VoxelCollector(vp)
 	this->draw_images.clear();
 	this->xoffset = 0;
 	this->yoffset = 0;
+	this->objects_only = false;
 
 	this->north_offsets[VOR_NORTH].x = 0;                     this->north_offsets[VOR_NORTH].y = 0;
 	this->north_offsets[VOR_EAST].x  = -TileWidth(this->zoom) / 2; this->north_offsets[VOR_EAST].y  = TileWidth(this->zoom) / 4;
@@ -417,7 +467,7 @@ const ImageData *SpriteCollector::GetCursorSpriteAtPos(CursorType ctype, [[maybe
 void SpriteCollector::SetupSupports(const VoxelStack *stack, [[maybe_unused]] uint xpos, [[maybe_unused]] uint ypos)
 {
 	for (uint i = 0; i < stack->height; i++) {
-		const Voxel *v = stack->voxels[i].get();
+		const Voxel *v = &stack->voxels[i];
 		if (v->GetGroundType() == GTP_INVALID) continue;
 		if (v->GetInstance() == SRI_FREE) {
 			this->ground_height = stack->base + i;
@@ -473,26 +523,15 @@ static int DrawRideOrScenery(int32 slice, const XYZPoint16 & pos, const Point32
 }
 
 /**
- * Add all sprites of the voxel to the set of sprites to draw.
+ * Add the static sprites of the voxel (ground, foundations, fences, paths, rides, scenery,
+ * platforms, supports and cursors) to the set of sprites to draw.
  * @param voxel %Voxel to add, \c nullptr means 'cursor above stack'.
  * @param voxel_pos World position.
- * @param xnorth X coordinate of the north corner at the display.
- * @param ynorth y coordinate of the north corner at the display.
- * @todo Can we gain time by checking for cursors once at every voxel stack, and only test every \a zpos when there is one in a stack?
+ * @param north_point Top-left coordinate of the voxel at the display.
+ * @param slice Depth of the voxel.
  */
-void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_pos, int32 xnorth, int32 ynorth)
+void SpriteCollector::CollectStaticSprites(const Voxel *voxel, const XYZPoint16 &voxel_pos, const Point32 &north_point, int32 slice)
 {
-	int32 slice;
-	switch (this->orient) {
-		case 0: slice =  voxel_pos.x + voxel_pos.y; break;
-		case 1: slice =  voxel_pos.x - voxel_pos.y; break;
-		case 2: slice = -voxel_pos.x - voxel_pos.y; break;
-		case 3: slice = -voxel_pos.x + voxel_pos.y; break;
-		default: NOT_REACHED();
-	}
-
-	Point32 north_point(this->xoffset + xnorth - this->rect.base.x, this->yoffset + ynorth - this->rect.base.y);
-
 	uint8 platform_shape = PATH_INVALID;
 	SmallRideInstance sri = (voxel == nullptr) ? SRI_FREE : voxel->GetInstance();
 	uint16 instance_data = (voxel == nullptr) ? 0 : voxel->GetInstanceData();
@@ -506,7 +545,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 		dd.Set(slice, voxel_pos.z, SO_PATH, _sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetPathSprite,
 				GetPathType(instance_data), GetPathStatus(instance_data), GetImplodedPathSlope(instance_data), this->orient),
 				north_point, nullptr, highlight ? GS_SEMI_TRANSPARENT : GS_INVALID);
-		this->draw_images.insert(dd);
+		this->Submit(dd);
 
 		for (const PathObjectInstance::PathObjectSprite &image : _scenery.DrawPathObjects(voxel_pos, this->orient, this->zoom)) {
 			const int x_off = ComputeX(image.offset.x, image.offset.y);
@@ -516,7 +555,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 
 			dd.Set(slice, voxel_pos.z, SO_PATH_OBJECTS, image.sprite, pos, nullptr,
 					image.semi_transparent ? GS_SEMI_TRANSPARENT : this->vp->GetDisplayFlag(DF_WIREFRAME_SCENERY) ? GS_WIREFRAME : GS_INVALID);
-			this->draw_images.insert(dd);
+			this->Submit(dd);
 		}
 	} else if (sri >= SRI_FULL_RIDES || sri == SRI_SCENERY) { // A normal ride, or a scenery item.
 		DrawData dd[4];
@@ -528,13 +567,13 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 					(this->vp->GetDisplayFlag(DF_WIREFRAME_SCENERY) && sri == SRI_SCENERY)) {
 				dd[i].gs = GS_WIREFRAME;
 			}
-			this->draw_images.insert(dd[i]);
+			this->Submit(dd[i]);
 		}
 	}
 	if (background_sprite != nullptr) {
 		DrawData dd;
 		dd.Set(slice, voxel_pos.z, SO_CURSOR, background_sprite, north_point);
-		this->draw_images.insert(dd);
+		this->Submit(dd);
 	}
 
 	/* Foundations. */
@@ -553,7 +592,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 			if (img != nullptr) {
 				DrawData dd;
 				dd.Set(slice, voxel_pos.z, SO_FOUNDATION, img, north_point);
-				this->draw_images.insert(dd);
+				this->Submit(dd);
 			}
 		}
 		if (se != 0) {
@@ -561,7 +600,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 			if (img != nullptr) {
 				DrawData dd;
 				dd.Set(slice, voxel_pos.z, SO_FOUNDATION, img, north_point);
-				this->draw_images.insert(dd);
+				this->Submit(dd);
 			}
 		}
 	}
@@ -573,12 +612,12 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 		uint8 type = (this->vp->GetDisplayFlag(DF_UNDERGROUND_MODE)) ? GTP_UNDERGROUND : voxel->GetGroundType();
 		DrawData dd;
 		dd.Set(slice, voxel_pos.z, SO_GROUND, _sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetSurfaceSprite, type, slope, this->orient), north_point);
-		this->draw_images.insert(dd);
+		this->Submit(dd);
 
 		if (this->vp->GetDisplayFlag(DF_GRID)) {
 			dd.Set(slice, voxel_pos.z, SO_GROUND, _sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetCursorSprite, slope, this->orient),
 					north_point, nullptr, GS_SEMI_TRANSPARENT);
-			this->draw_images.insert(dd);
+			this->Submit(dd);
 		}
 
 		switch (slope) {
@@ -623,7 +662,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 						_sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetFenceSprite, fence_type, edge, gslope, this->orient), north_point);
 				if (IsImplodedSteepSlope(gslope) && !IsImplodedSteepSlopeTop(gslope)) dd.z_height++;
 				if (GB(fences, 16 + edge, 1) != 0) dd.gs = GS_SEMI_TRANSPARENT;
-				this->draw_images.insert(dd);
+				this->Submit(dd);
 			}
 		}
 	}
@@ -637,7 +676,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 				DrawData dd;
 				dd.Set(slice, voxel_pos.z, SO_CURSOR, mspr, north_point);
 				if (ctype >= CUR_TYPE_EDGE_NE && ctype <= CUR_TYPE_EDGE_NW && IsImplodedSteepSlope(gslope) && !IsImplodedSteepSlopeTop(gslope)) dd.z_height++;
-				this->draw_images.insert(dd);
+				this->Submit(dd);
 			}
 		}
 	}
@@ -656,7 +695,7 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 		if (pl_spr != nullptr) {
 			DrawData dd;
 			dd.Set(slice, voxel_pos.z, SO_PLATFORM, pl_spr, north_point);
-			this->draw_images.insert(dd);
+			this->Submit(dd);
 		}
 
 		/* XXX Use the shape to draw handle bars. */
@@ -690,11 +729,21 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 			if (img != nullptr) {
 				DrawData dd;
 				dd.Set(slice, height, SO_SUPPORT, img, Point32(north_point.x, north_point.y + yoffset));
-				this->draw_images.insert(dd);
+				this->Submit(dd);
 			}
 		}
 	}
+}
 
+/**
+ * Add the sprites of the voxel objects (persons, ride cars) in the voxel to the set of sprites to draw.
+ * @param voxel %Voxel to add, \c nullptr means 'cursor above stack'.
+ * @param voxel_pos World position.
+ * @param north_point Top-left coordinate of the voxel at the display.
+ * @param slice Depth of the voxel.
+ */
+void SpriteCollector::CollectObjectSprites(const Voxel *voxel, const XYZPoint16 &voxel_pos, const Point32 &north_point, int32 slice)
+{
 	/* Add voxel objects (persons, ride cars, etc). */
 	/* Sprites on the bottom part of a steep slope need to be drawn at a higher Z layer to prevent the top slope part obscuring them. */
 	const VoxelObject *vo = (voxel == nullptr) ? nullptr : voxel->voxel_objects;
@@ -703,7 +752,8 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 	while (vo != nullptr) {
 		const Recolouring *recolour;
 		const ImageData *anim_spr = vo->GetSprite(this->orient, this->zoom, &recolour);
-		if (anim_spr != nullptr && (!this->vp->GetDisplayFlag(DF_HIDE_PEOPLE) || dynamic_cast<const Person*>(vo) == nullptr)) {
+		const Person *pers = dynamic_cast<const Person *>(vo);
+		if (anim_spr != nullptr && (!this->vp->GetDisplayFlag(DF_HIDE_PEOPLE) || pers == nullptr)) {
 			int x_off = ComputeX(vo->pix_pos.x, vo->pix_pos.y);
 			int y_off = ComputeY(vo->pix_pos.x, vo->pix_pos.y, vo->pix_pos.z);
 			Point32 pos(north_point.x + this->north_offsets[this->orient].x + x_off,
@@ -711,13 +761,15 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 
 			DrawData dd;
 			dd.Set(slice, people_z_pos, SO_PERSON, anim_spr, pos, recolour);
-			this->draw_images.insert(dd);
+			dd.person = pers;
+			this->Submit(dd);
 
 			if (!this->vp->GetDisplayFlag(DF_HIDE_PEOPLE)) {
 				for (const VoxelObject::Overlay &overlay : vo->GetOverlays(this->orient, this->zoom)) {
 					if (overlay.sprite != nullptr) {
 						dd.Set(slice, people_z_pos, SO_PERSON_OVERLAY, overlay.sprite, pos, overlay.recolour);
-						this->draw_images.insert(dd);
+						dd.person = pers;
+						this->Submit(dd);
 					}
 				}
 			}
@@ -726,6 +778,32 @@ void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_p
 	}
 }
 
+/**
+ * Add all sprites of the voxel to the set of sprites to draw.
+ * @param voxel %Voxel to add, \c nullptr means 'cursor above stack'.
+ * @param voxel_pos World position.
+ * @param xnorth X coordinate of the north corner at the display.
+ * @param ynorth y coordinate of the north corner at the display.
+ */
+void SpriteCollector::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_pos, int32 xnorth, int32 ynorth)
+{
+	int32 slice;
+	switch (this->orient) {
+		case 0: slice =  voxel_pos.x + voxel_pos.y; break;
+		case 1: slice =  voxel_pos.x - voxel_pos.y; break;
+		case 2: slice = -voxel_pos.x - voxel_pos.y; break;
+		case 3: slice = -voxel_pos.x + voxel_pos.y; break;
+		default: NOT_REACHED();
+	}
+
+	Point32 north_point(this->xoffset + xnorth - this->rect.base.x, this->yoffset + ynorth - this->rect.base.y);
+	this->cur_north = north_point;
+	this->cur_voxel = voxel_pos;
+
+	if (!this->objects_only) this->CollectStaticSprites(voxel, voxel_pos, north_point, slice);
+	this->CollectObjectSprites(voxel, voxel_pos, north_point, slice);
+}
+
 /**
  * Constructor of the finder data class.
  * @param init_allowed Bit-set of sprite types to look for. @see #ClickableSprite
@@ -879,8 +957,15 @@ void PixelFinder::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_pos,
 			AnimationType anim_type = pers->walk->anim_type;
 			const ImageData *anim_spr = _sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetAnimationSprite,
 					anim_type, pers->frame_index, pers->type, this->orient);
-			int x_off = ComputeX(pers->pix_pos.x, pers->pix_pos.y);
-			int y_off = ComputeY(pers->pix_pos.x, pers->pix_pos.y, pers->pix_pos.z);
+			XYZPoint16 pix = pers->pix_pos;
+			if (pers->prev_vox_pos == pers->vox_pos) {
+				/* Interpolate the in-voxel position between the last two simulation ticks for smooth motion. */
+				pix.x = pers->prev_pix_pos.x + static_cast<int16>((pix.x - pers->prev_pix_pos.x) * _simulation_render_alpha);
+				pix.y = pers->prev_pix_pos.y + static_cast<int16>((pix.y - pers->prev_pix_pos.y) * _simulation_render_alpha);
+				pix.z = pers->prev_pix_pos.z + static_cast<int16>((pix.z - pers->prev_pix_pos.z) * _simulation_render_alpha);
+			}
+			int x_off = ComputeX(pix.x, pix.y);
+			int y_off = ComputeY(pix.x, pix.y, pix.z);
 			DrawData dd;
 			dd.Set(slice, voxel_pos.z, SO_PERSON, anim_spr, Point32(this->rect.base.x - xnorth - x_off, this->rect.base.y - ynorth - y_off));
 			if (anim_spr != nullptr && (!this->found || this->data < dd)) {
@@ -904,15 +989,213 @@ void PixelFinder::CollectVoxel(const Voxel *voxel, const XYZPoint16 &voxel_pos,
  * @param col RGB colour of the text.
  */
 FloatawayText::FloatawayText(std::string text, XYZPoint32 pos, uint32 col)
-: FloatawayText(text, pos, XYZPoint32(3, -6, 0), col | 0xff, 3)
+: FloatawayText(std::move(text), pos, XYZPoint32(3, -6, 0), col | 0xff, 3)
+{
+}
+
+/**
+ * Cached sprite collection of a viewport, together with the camera state it was collected for.
+ * While the camera does not change and no world changes were reported through #_world_dirty,
+ * the previous draw list is re-blitted as-is. When only a few columns changed, just the affected
+ * screen region is re-collected and spliced into the cached list.
+ * @ingroup viewport_group
+ */
+class ViewportDrawCache {
+public:
+	ViewportDrawCache() : valid(false), queryable(false)
+	{
+	}
+
+	/**
+	 * Does the cached draw list match the current camera state of the viewport?
+	 * @param vp %Viewport to compare with.
+	 * @return The cache may be reused for this viewport state.
+	 */
+	bool MatchesCamera(const Viewport *vp) const
+	{
+		return this->valid && this->CameraEquals(vp);
+	}
+
+	/**
+	 * May the cached draw list be used to answer cursor position queries?
+	 * This holds also for a list collected with an active mouse mode selector,
+	 * which is never reused for drawing but does match what is on the screen.
+	 * @param vp %Viewport to compare with.
+	 * @return The cache describes the sprites currently displayed by the viewport.
+	 */
+	bool UsableForHitTest(const Viewport *vp) const
+	{
+		return this->queryable && this->CameraEquals(vp);
+	}
+
+	/**
+	 * Store the camera state the draw list was collected for.
+	 * @param vp %Viewport the sprites were collected for.
+	 */
+	void StoreCamera(const Viewport *vp)
+	{
+		this->valid = true;
+		this->queryable = true;
+		this->view_pos = vp->view_pos;
+		this->zoom = vp->zoom;
+		this->orientation = vp->orientation;
+		this->display_flags = vp->display_flags;
+		this->width = vp->rect.width;
+		this->height = vp->rect.height;
+	}
+
+	DrawImages draw_images;      ///< Cached sprites to draw.
+	bool valid;                  ///< Whether the cached draw list may be reused for drawing.
+	bool queryable;              ///< Whether the cached draw list matches the displayed frame at all.
+	XYZPoint32 view_pos;         ///< Camera position the sprites were collected for.
+	int zoom;                    ///< Zoom scale the sprites were collected for.
+	ViewOrientation orientation; ///< View direction the sprites were collected for.
+	DisplayFlags display_flags;  ///< Display flags the sprites were collected for.
+	uint32 width;                ///< Window width the sprites were collected for.
+	uint32 height;               ///< Window height the sprites were collected for.
+
+private:
+	/**
+	 * Compare the stored camera state with the current state of the viewport.
+	 * @param vp %Viewport to compare with.
+	 * @return The camera states are equal.
+	 */
+	bool CameraEquals(const Viewport *vp) const
+	{
+		return this->view_pos == vp->view_pos && this->zoom == vp->zoom &&
+				this->orientation == vp->orientation && this->display_flags == vp->display_flags &&
+				this->width == vp->rect.width && this->height == vp->rect.height;
+	}
+};
+
+/**
+ * Re-collect the screen region covered by the given changed voxel columns, and splice the
+ * result into the cached draw list of the viewport.
+ * @param vp %Viewport being drawn.
+ * @param cache Draw list cached from the previous frame, updated in-place.
+ * @param columns Voxel columns that changed (may contain duplicates).
+ * @param objects_only Only the voxel objects of the columns changed, keep the cached static geometry.
+ */
+static void RecollectColumns(Viewport *vp, ViewportDrawCache &cache, const std::vector<Point16> &columns, bool objects_only)
 {
+	if (columns.empty()) return;
+	const int32 tw = TileWidth(vp->zoom);
+	const int32 th = TileHeight(vp->zoom);
+
+	/* Compute the window-space bounding rectangle of the changed columns.
+	 * The margins are generous, correctness only requires that the rectangle covers all changed pixels. */
+	int32 x_min = INT32_MAX, x_max = INT32_MIN, y_min = INT32_MAX, y_max = INT32_MIN;
+	for (const Point16 &col : columns) {
+		if (!IsVoxelstackInsideWorld(col.x, col.y)) continue;
+		const VoxelStack *stack = _world.GetStack(col.x, col.y);
+		Point32 bottom = vp->ComputeScreenCoordinate(VoxelToPixel(XYZPoint16(col.x, col.y, stack->base)));
+		Point32 top = vp->ComputeScreenCoordinate(VoxelToPixel(XYZPoint16(col.x, col.y, stack->base + stack->height)));
+		bottom.x -= vp->rect.base.x; bottom.y -= vp->rect.base.y; // Make window-relative.
+		top.x -= vp->rect.base.x; top.y -= vp->rect.base.y;
+
+		x_min = std::min(x_min, top.x - tw);
+		x_max = std::max(x_max, top.x + tw);
+		y_min = std::min(y_min, top.y - tw - th);
+		y_max = std::max(y_max, bottom.y + tw + th);
+	}
+
+	/* Trim to the visible area (plus the margin a voxel column may stick out of its tile). */
+	x_min = std::max(x_min, -tw);
+	x_max = std::min(x_max, static_cast<int32>(vp->rect.width) + tw);
+	y_min = std::max(y_min, -tw - th);
+	y_max = std::min(y_max, static_cast<int32>(vp->rect.height) + tw + th);
+	if (x_min >= x_max || y_min >= y_max) return; // Nothing visible changed.
+
+	/* Drop the cached sprites of the region. The test mirrors the column and voxel inclusion
+	 * tests of VoxelCollector::Collect, so the re-collection below exactly replaces them. */
+	cache.draw_images.erase(std::remove_if(cache.draw_images.begin(), cache.draw_images.end(),
+			[objects_only, tw, th, x_min, x_max, y_min, y_max](const DrawData &dd) {
+				if (objects_only && dd.order != SO_PERSON && dd.order != SO_PERSON_OVERLAY) return false; // Static geometry is unchanged, keep it.
+				const Point32 &n = dd.north;
+				return n.x + tw / 2 > x_min && n.x - tw / 2 < x_max && n.y - th < y_max && n.y + tw / 2 + th > y_min;
+			}), cache.draw_images.end());
+
+	SpriteCollector collector(vp);
+	collector.SetWindowSize(x_min - static_cast<int32>(vp->rect.width / 2), y_min - static_cast<int32>(vp->rect.height / 2), x_max - x_min, y_max - y_min);
+	collector.SetXYOffset(x_min, y_min);
+	collector.SetObjectsOnly(objects_only);
+	collector.Collect();
+
+	/* Splice the fresh sprites into the still sorted cached list. */
+	std::stable_sort(collector.draw_images.begin(), collector.draw_images.end());
+	const size_t middle = cache.draw_images.size();
+	cache.draw_images.insert(cache.draw_images.end(), collector.draw_images.begin(), collector.draw_images.end());
+	std::inplace_merge(cache.draw_images.begin(), cache.draw_images.begin() + middle, cache.draw_images.end());
+}
+
+/** Number of voxel stacks a worker thread should at least get before spawning more threads is worthwhile. */
+static const uint MIN_COLUMNS_PER_THREAD = 32;
+
+/**
+ * Collect the sprites for a viewport, partitioning the stack range over the task system when
+ * the world is large enough. The visible columns are independent of each other; every worker
+ * collects into its own draw list, and the concatenated result is depth-sorted once at the end.
+ * @param collector Configured collector to fill.
+ */
+static void CollectWithThreads(SpriteCollector &collector)
+{
+	const uint xsize = _world.GetXSize();
+	uint num_threads = _task_system.ThreadCount() + 1;  // The render thread collects a range as well.
+	if (num_threads > 1) num_threads = std::min(num_threads, xsize / MIN_COLUMNS_PER_THREAD);
+	if (num_threads <= 1 || collector.selector != nullptr) {
+		/* Not worth going parallel, or a selector is active (they are not safe to query concurrently). */
+		collector.Collect();
+		std::stable_sort(collector.draw_images.begin(), collector.draw_images.end());
+		return;
+	}
+
+	std::vector<std::unique_ptr<SpriteCollector>> workers;
+	TaskGroup group;
+	for (uint i = 1; i < num_threads; i++) {
+		workers.emplace_back(new SpriteCollector(collector.vp));
+		SpriteCollector *worker = workers.back().get();
+		worker->rect = collector.rect;
+		worker->xoffset = collector.xoffset;
+		worker->yoffset = collector.yoffset;
+		worker->objects_only = collector.objects_only;
+		const uint first_x = xsize * i / num_threads;
+		const uint last_x = xsize * (i + 1) / num_threads;
+		_task_system.Submit([worker, first_x, last_x]() { worker->CollectRange(first_x, last_x); }, TKP_HIGH, &group);
+	}
+	collector.CollectRange(0, xsize / num_threads);  // The render thread takes the first range itself.
+	_task_system.Wait(group);
+
+	size_t total = collector.draw_images.size();
+	for (const auto &worker : workers) total += worker->draw_images.size();
+	collector.draw_images.reserve(total);
+	for (auto &worker : workers) {
+		collector.draw_images.insert(collector.draw_images.end(), worker->draw_images.begin(), worker->draw_images.end());
+	}
+	std::stable_sort(collector.draw_images.begin(), collector.draw_images.end());
 }
 
 /**
  * %Viewport constructor.
  * @param init_view_pos Pixel position of the center viewpoint of the main display.
  */
-Viewport::Viewport(const XYZPoint32 &init_view_pos) : Window(WC_MAINDISPLAY, ALL_WINDOWS_OF_TYPE),
+Viewport::Viewport(const XYZPoint32 &init_view_pos) : Viewport(WC_MAINDISPLAY, init_view_pos)
+{
+	uint16 width  = _video.Width();
+	uint16 height = _video.Height();
+
+	assert(width >= 120 && height >= 120); // Arbitrary lower limit as sanity check.
+
+	this->SetSize(width, height);
+	this->SetPosition(0, 0);
+}
+
+/**
+ * Construct a world display window of the given window type.
+ * The caller decides the size and position of the window.
+ * @param wtype %Window type of the view.
+ * @param init_view_pos Pixel position of the center viewpoint.
+ */
+Viewport::Viewport(WindowTypes wtype, const XYZPoint32 &init_view_pos) : Window(wtype, ALL_WINDOWS_OF_TYPE),
 	view_pos(init_view_pos),
 	zoom(DEFAULT_ZOOM),
 	orientation(VOR_NORTH),
@@ -923,13 +1206,6 @@ Viewport::Viewport(const XYZPoint32 &init_view_pos) : Window(WC_MAINDISPLAY, ALL
 	display_flags(DF_NONE)
 #endif
 {
-	uint16 width  = _video.Width();
-	uint16 height = _video.Height();
-
-	assert(width >= 120 && height >= 120); // Arbitrary lower limit as sanity check.
-
-	this->SetSize(width, height);
-	this->SetPosition(0, 0);
 }
 
 Viewport::~Viewport()
@@ -1026,10 +1302,29 @@ Point32 Viewport::ComputeScreenCoordinate(const XYZPoint32 &pixel) const
 
 void Viewport::OnDraw(MouseModeSelector *selector)
 {
-	SpriteCollector collector(this);
-	collector.SetWindowSize(-static_cast<int>(this->rect.width / 2), -static_cast<int>(this->rect.height / 2), this->rect.width, this->rect.height);
-	collector.SetSelector(selector);
-	collector.Collect();
+	if (this->draw_cache == nullptr) this->draw_cache.reset(new ViewportDrawCache);
+	ViewportDrawCache &cache = *this->draw_cache;
+
+	{
+		const ZoneTimer timer(PFZ_VOXEL_COLLECT);
+		/* An active selector draws mouse-dependent overlays, bypass the cache entirely while one is in use. */
+		const bool cachable = (selector == nullptr);
+		if (!cachable || !cache.MatchesCamera(this) || _world_dirty.all_dirty) {
+			SpriteCollector collector(this);
+			collector.SetWindowSize(-static_cast<int>(this->rect.width / 2), -static_cast<int>(this->rect.height / 2), this->rect.width, this->rect.height);
+			collector.SetSelector(selector);
+			CollectWithThreads(collector);
+			cache.draw_images.swap(collector.draw_images);
+			cache.StoreCamera(this);
+			cache.valid = cachable;  // Selector overlays may not be reused for drawing, but hit tests remain possible.
+		} else if (!_world_dirty.IsEmpty()) {
+			/* Structural edits invalidate everything in their region, moving persons
+			 * and ride cars only the dynamic layer of theirs. */
+			RecollectColumns(this, cache, _world_dirty.columns, false);
+			RecollectColumns(this, cache, _world_dirty.object_columns, true);
+		}
+		/* #_world_dirty is reset by the window manager after all windows have drawn. */
+	}
 
 	_video.FillRectangle(this->rect, MakeRGBA(0, 0, 0, OPAQUE)); // Black background.
 
@@ -1037,30 +1332,34 @@ void Viewport::OnDraw(MouseModeSelector *selector)
 	_video.PushClip(this->rect);
 
 	GradientShift gs = static_cast<GradientShift>(GS_LIGHT - _weather.GetWeatherType());
-	for (const DrawData &dd : collector.draw_images) {
-		const Recolouring &rec = (dd.recolour == nullptr) ? _no_recolour : *dd.recolour;
-		_video.BlitImage(dd.base, dd.sprite, rec, dd.gs != GS_INVALID ? dd.gs : gs);
-
-		/* Draw height markers if applicable. */
-		GuiTextColours marker_colour;
-		if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_RIDES) && dd.order == SO_RIDE) {
-			marker_colour = HEIGHT_MARKER_RIDES;
-		} else if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_PATHS) && dd.order == SO_PATH) {
-			marker_colour = HEIGHT_MARKER_PATHS;
-		} else if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_TERRAIN) && dd.order == SO_GROUND) {
-			marker_colour = HEIGHT_MARKER_TERRAIN;
-		} else {
-			continue;
-		}
+	{
+		const ZoneTimer timer(PFZ_BLIT);
+		for (const DrawData &dd : cache.draw_images) {
+			const Recolouring &rec = (dd.recolour == nullptr) ? _no_recolour : *dd.recolour;
+			_video.BlitImage(dd.base, dd.sprite, rec, dd.gs != GS_INVALID ? dd.gs : gs);
+
+			/* Draw height markers if applicable. */
+			GuiTextColours marker_colour;
+			if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_RIDES) && dd.order == SO_RIDE) {
+				marker_colour = HEIGHT_MARKER_RIDES;
+			} else if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_PATHS) && dd.order == SO_PATH) {
+				marker_colour = HEIGHT_MARKER_PATHS;
+			} else if (this->GetDisplayFlag(DF_HEIGHT_MARKERS_TERRAIN) && dd.order == SO_GROUND) {
+				marker_colour = HEIGHT_MARKER_TERRAIN;
+			} else {
+				continue;
+			}
 
-		std::string text = std::to_string(dd.z_height);
-		int w, h;
-		_video.GetTextSize(text, &w, &h);
-		Rectangle32 r(dd.base.x + dd.sprite->xoffset + (dd.sprite->width - w) / 2, dd.base.y + dd.sprite->yoffset + (dd.sprite->height - h) / 2, w, h);
-		_video.FillRectangle(r, SetA(_palette[marker_colour], OPACITY_SEMI_TRANSPARENT));
-		_video.BlitText(text, _palette[TEXT_BLACK], r.base.x, r.base.y, r.width, ALG_CENTER);
+			std::string text = std::to_string(dd.z_height);
+			int w, h;
+			_video.GetTextSize(text, &w, &h);
+			Rectangle32 r(dd.base.x + dd.sprite->xoffset + (dd.sprite->width - w) / 2, dd.base.y + dd.sprite->yoffset + (dd.sprite->height - h) / 2, w, h);
+			_video.FillRectangle(r, SetA(_palette[marker_colour], OPACITY_SEMI_TRANSPARENT));
+			_video.BlitText(text, _palette[TEXT_BLACK], r.base.x, r.base.y, r.width, ALG_CENTER);
+		}
 	}
 
+	/* Update all floataway texts, dropping the ones that have fully faded out. */
 	for (uint i = 0; i < this->floataway_texts.size();) {
 		FloatawayText &f = this->floataway_texts.at(i);
 		int a = GetA(f.colour);
@@ -1068,14 +1367,23 @@ void Viewport::OnDraw(MouseModeSelector *selector)
 		if (a > 0) {
 			f.colour = SetA(f.colour, a);
 			f.pos += f.speed;
-			Point32 pos = ComputeScreenCoordinate(f.pos);
-			_video.BlitText(f.text, f.colour, pos.x, pos.y);
 			++i;
 		} else {
-			this->floataway_texts.at(i) = this->floataway_texts.back();
+			this->floataway_texts.at(i) = std::move(this->floataway_texts.back());
 			this->floataway_texts.pop_back();
 		}
 	}
+	if (!this->floataway_texts.empty()) {
+		/* All texts share the font atlas, draw them in one batched pass. The request buffer is reused across frames. */
+		static std::vector<TextRequest> requests;
+		requests.clear();
+		requests.reserve(this->floataway_texts.size());
+		for (const FloatawayText &f : this->floataway_texts) {
+			const Point32 pos = ComputeScreenCoordinate(f.pos);
+			requests.push_back({&f.text, static_cast<float>(pos.x), static_cast<float>(pos.y), f.colour});
+		}
+		_video.BlitTexts(requests);
+	}
 
 	if (this->GetDisplayFlag(DF_FPS)) {
 		constexpr const int SPACING = 4;
@@ -1087,6 +1395,94 @@ void Viewport::OnDraw(MouseModeSelector *selector)
 	_video.PopClip();
 }
 
+/**
+ * Try to answer a cursor position query from the cached draw list of the last frame.
+ * The cached sprites are exactly what is shown at the screen, so walking them from front
+ * to back until one covers the cursor pixel replaces a scan over the entire world.
+ * @param fdata [inout] Parameters and results of the finding process.
+ * @param result [out] Found type of sprite, set when the query was answered.
+ * @param pixel [out] Pixel colour of the sprite found under the cursor.
+ * @return The query could be answered from the cache (finding nothing is an answer as well).
+ */
+bool Viewport::SearchDrawCache(FinderData *fdata, ClickableSprite *result, uint32 *pixel)
+{
+	if (this->draw_cache == nullptr || !this->draw_cache->UsableForHitTest(this) || !_world_dirty.IsEmpty()) return false;
+	if ((fdata->allowed & CS_GROUND_EDGE) != 0) return false;  // Edge test sprites are never part of the draw list.
+	if ((fdata->allowed & CS_GROUND) != 0 && this->GetDisplayFlag(DF_HIDE_SURFACES)) return false;
+
+	const Point32 cursor(this->rect.base.x + this->mouse_pos.x, this->rect.base.y + this->mouse_pos.y);
+	const DrawImages &images = this->draw_cache->draw_images;
+	for (auto it = images.rbegin(); it != images.rend(); ++it) {
+		const DrawData &dd = *it;
+		const int group = dd.order & ~CS_MASK;
+		const Voxel *voxel = _world.GetVoxel(dd.voxel_pos);
+		ClickableSprite cs = static_cast<ClickableSprite>(dd.order & CS_MASK);
+		if (cs == CS_NONE) {
+			/* Scenery items are drawn without clickable category; scenario scenery acts as park border. */
+			if ((fdata->allowed & CS_PARK_BORDER) != 0 && group >= (SO_PLATFORM_BACK & ~CS_MASK) && group <= (SO_PLATFORM_FRONT & ~CS_MASK) &&
+					voxel != nullptr && voxel->GetInstance() == SRI_SCENERY && voxel->instance_data != INVALID_VOXEL_DATA &&
+					_scenery.GetType(voxel->instance_data)->category == SCC_SCENARIO) {
+				cs = CS_PARK_BORDER;
+			} else {
+				continue;
+			}
+		}
+		if ((cs & fdata->allowed) == 0) continue;
+
+		const ImageData *img = dd.sprite;
+		const int32 px = cursor.x - dd.base.x - img->xoffset;
+		const int32 py = cursor.y - dd.base.y - img->yoffset;
+		if (px < 0 || py < 0 || px >= img->width || py >= img->height) continue;
+		uint32 pix = img->GetPixel(px, py);
+		if (GetA(pix) == TRANSPARENT) continue;
+
+		/* Re-derive what a click at this sprite means, mirroring PixelFinder::CollectVoxel. */
+		switch (cs) {
+			case CS_PERSON:
+				if (dd.person == nullptr) continue;  // Ride cars are drawn like persons but are not clickable as such.
+				fdata->person = dd.person;
+				break;
+
+			case CS_RIDE:
+				if (voxel == nullptr || voxel->GetInstance() < SRI_FULL_RIDES) continue;  // E.g. a ghost ride of a selector.
+				fdata->ride = voxel->GetInstance();
+				break;
+
+			case CS_PARK_BORDER:
+				if (voxel == nullptr) continue;
+				if (group == (SO_FENCE_BACK & ~CS_MASK) || group == (SO_FENCE_FRONT & ~CS_MASK)) {
+					bool border = false;
+					for (TileEdge t = EDGE_BEGIN; t < EDGE_COUNT; t++) {
+						border |= GetFenceType(voxel->GetFences(), t) == FENCE_TYPE_LAND_BORDER;
+					}
+					if (!border) continue;  // Only land border fences are clickable.
+				} else {
+					fdata->ride = voxel->GetInstance();
+				}
+				break;
+
+			case CS_GROUND:
+				if (voxel == nullptr || voxel->GetGroundType() == GTP_INVALID) continue;
+				if (fdata->select == FW_CORNER) {
+					/* Sample the corner test sprite to learn which tile corner was hit. */
+					const ImageData *test = _sprite_manager.GetSprite(this->zoom, &SpriteStorage::GetSurfaceSprite,
+							GTP_CURSOR_TEST, voxel->GetGroundSlope(), this->orientation);
+					if (test != nullptr) pix = test->GetPixel(cursor.x - dd.base.x - test->xoffset, cursor.y - dd.base.y - test->yoffset);
+				}
+				break;
+
+			default:
+				continue;
+		}
+		fdata->voxel_pos = dd.voxel_pos;
+		*result = cs;
+		*pixel = pix;
+		return true;
+	}
+	*result = CS_NONE;
+	return true;
+}
+
 /**
  * Compute position of the mouse cursor, and return the result.
  * @param fdata [inout] Parameters and results of the finding process.
@@ -1094,41 +1490,48 @@ void Viewport::OnDraw(MouseModeSelector *selector)
  */
 ClickableSprite Viewport::ComputeCursorPosition(FinderData *fdata)
 {
-	int16 xp = this->mouse_pos.x - this->rect.width / 2;
-	int16 yp = this->mouse_pos.y - this->rect.height / 2;
-	PixelFinder collector(this, fdata);
-	collector.SetWindowSize(xp, yp, 1, 1);
-	collector.Collect();
-	if (!collector.found) return CS_NONE;
+	ClickableSprite result;
+	uint32 pixel;
+	if (!this->SearchDrawCache(fdata, &result, &pixel)) {
+		int16 xp = this->mouse_pos.x - this->rect.width / 2;
+		int16 yp = this->mouse_pos.y - this->rect.height / 2;
+		PixelFinder collector(this, fdata);
+		collector.SetWindowSize(xp, yp, 1, 1);
+		collector.Collect();
+		if (!collector.found) return CS_NONE;
+		result = (ClickableSprite)(collector.data.order & CS_MASK);
+		pixel = collector.pixel;
+	}
+	if (result == CS_NONE) return CS_NONE;
 
 	fdata->cursor = fdata->select == FW_EDGE ? CUR_TYPE_EDGE_NE : CUR_TYPE_TILE;
-	if (fdata->select == FW_CORNER && (collector.data.order & CS_MASK) == CS_GROUND) {
-		if (collector.pixel == _palette[181]) {
+	if (fdata->select == FW_CORNER && result == CS_GROUND) {
+		if (pixel == _palette[181]) {
 			fdata->cursor = (CursorType)AddOrientations(VOR_NORTH, this->orientation);
-		} else if (collector.pixel == _palette[182]) {
+		} else if (pixel == _palette[182]) {
 			fdata->cursor = (CursorType)AddOrientations(VOR_EAST,  this->orientation);
-		} else if (collector.pixel == _palette[184]) {
+		} else if (pixel == _palette[184]) {
 			fdata->cursor = (CursorType)AddOrientations(VOR_WEST,  this->orientation);
-		} else if (collector.pixel == _palette[185]) {
+		} else if (pixel == _palette[185]) {
 			fdata->cursor = (CursorType)AddOrientations(VOR_SOUTH, this->orientation);
 		}
 	}
-	else if (fdata->select == FW_EDGE && (collector.data.order & CS_MASK) == CS_GROUND_EDGE) {
+	else if (fdata->select == FW_EDGE && result == CS_GROUND_EDGE) {
 		uint8 base_edge = EDGE_COUNT;
-		if (collector.pixel == _palette[181]) {
+		if (pixel == _palette[181]) {
 			base_edge = (uint8)EDGE_NE;
-		} else if (collector.pixel == _palette[182]) {
+		} else if (pixel == _palette[182]) {
 			base_edge = (uint8)EDGE_SE;
-		} else if (collector.pixel == _palette[184]) {
+		} else if (pixel == _palette[184]) {
 			base_edge = (uint8)EDGE_NW;
-		} else if (collector.pixel == _palette[185]) {
+		} else if (pixel == _palette[185]) {
 			base_edge = (uint8)EDGE_SW;
 		}
 		if (base_edge < EDGE_COUNT) {
 			fdata->cursor = (CursorType)((base_edge + (uint8)this->orientation) % 4 + (uint8)CUR_TYPE_EDGE_NE);
 		}
 	}
-	return (ClickableSprite)(collector.data.order & CS_MASK);
+	return result;
 }
 
 /**
@@ -1254,6 +1657,9 @@ bool Viewport::OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &s
 		case KS_INGAME_SPEED_8:
 			_game_control.speed = GSP_8;
 			return true;
+		case KS_INGAME_SPEED_TURBO:
+			_game_control.speed = GSP_TURBO;
+			return true;
 		case KS_INGAME_SPEED_UP:
 			if (_game_control.speed + 1 < GSP_COUNT) {
 				_game_control.speed++;
@@ -1334,6 +1740,22 @@ bool Viewport::OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &s
 		case KS_INGAME_MINIMAP:
 			ShowMinimap();
 			return true;
+		case KS_INGAME_PROFILER:
+			ShowProfilerWindow();
+			return true;
+		case KS_INGAME_RELOAD_RCD:
+			if (_sprite_manager.ReloadChangedRcdFiles() > 0) _world_dirty.MarkAll();
+			return true;
+		case KS_INGAME_PIP_VIEW:
+			new PipViewport(this->view_pos);
+			return true;
+		case KS_SCREENSHOT:
+			_video.RequestScreenshot();
+			_window_manager.ForceRepaint();  // The capture needs a presented frame, even while the game is paused.
+			return true;
+		case KS_TIMELAPSE:
+			_video.ToggleTimelapse();
+			return true;
 		case KS_FPS:
 			this->ToggleDisplayFlag(DF_FPS);
 			return true;
@@ -1442,3 +1864,68 @@ void ShowMainDisplay(const XYZPoint32 &view_pos)
 {
 	new Viewport(view_pos);
 }
+
+/** Denominator of the fraction of the display size that a new picture-in-picture view takes. */
+static const uint PIP_SIZE_DIVISOR = 3;
+
+/**
+ * Construct a picture-in-picture view.
+ * @param init_view_pos Pixel position of the center viewpoint of the view.
+ */
+PipViewport::PipViewport(const XYZPoint32 &init_view_pos) : Viewport(WC_PIP_VIEWPORT, init_view_pos)
+{
+	this->SetSize(_video.Width() / PIP_SIZE_DIVISOR, _video.Height() / PIP_SIZE_DIVISOR);
+	this->SetPosition(this->OnInitialPosition());
+	this->SetDisplayFlag(DF_FPS, false); // The FPS overlay belongs to the main display.
+}
+
+void PipViewport::OnDraw([[maybe_unused]] MouseModeSelector *selector)
+{
+	/* The view may have been dragged partially off the display, pull it back in. */
+	const int32 max_x = std::max<int32>(0, _video.Width() - this->rect.width);
+	const int32 max_y = std::max<int32>(0, _video.Height() - this->rect.height);
+	this->SetPosition(Clamp<int32>(this->rect.base.x, 0, max_x), Clamp<int32>(this->rect.base.y, 0, max_y));
+
+	this->Viewport::OnDraw(nullptr); // Mouse mode overlays are shown in the main display only.
+}
+
+bool PipViewport::OnKeyEvent(WmKeyCode key_code, [[maybe_unused]] WmKeyMod mod, [[maybe_unused]] const std::string &symbol)
+{
+	if (key_code == WMKC_DELETE || key_code == WMKC_BACKSPACE || key_code == WMKC_CANCEL) {
+		delete this;
+		return true;
+	}
+	return false; // Game-wide shortcuts are handled by the main display.
+}
+
+void PipViewport::OnMouseMoveEvent(const Point16 &pos)
+{
+	Point16 old_mouse_pos = this->mouse_pos;
+	this->mouse_pos = pos;
+
+	/* Intercept RMB drag for moving the camera of the view, like in the main display. */
+	if ((_video.GetMouseDragging() & MB_RIGHT) != 0) {
+		this->MoveViewport(pos.x - old_mouse_pos.x, pos.y - old_mouse_pos.y);
+	}
+}
+
+WmMouseEvent PipViewport::OnMouseButtonEvent(MouseButtons state, WmMouseEventMode mode)
+{
+	if (mode != WMEM_PRESS) return WMME_NONE;
+
+	if (state == MB_RIGHT) {
+		_video.SetMouseDragging(MB_RIGHT, true, true);
+		return WMME_NONE;
+	}
+	if (state == MB_LEFT) return WMME_MOVE_WINDOW; // The view has no title bar, drag it anywhere.
+	return WMME_NONE;
+}
+
+void PipViewport::OnMouseWheelEvent(int direction)
+{
+	if (direction > 0) {
+		if (this->CanZoomIn()) this->ZoomIn();
+	} else {
+		if (this->CanZoomOut()) this->ZoomOut();
+	}
+}
@@ -14,6 +14,7 @@
 #include "mouse_mode.h"
 
 class Viewport;
+class ViewportDrawCache;
 class Person;
 class RideInstance;
 
@@ -112,7 +113,7 @@ struct FloatawayText {
 	 * @param fade Alpha decrease per tick.
 	 */
 	FloatawayText(std::string text, XYZPoint32 pos, XYZPoint32 speed, uint32 colour, int fade)
-	: text(text), pos(pos), speed(speed), colour(colour), fade(fade)
+	: text(std::move(text)), pos(pos), speed(speed), colour(colour), fade(fade)
 	{
 	}
 	FloatawayText(std::string text, XYZPoint32 pos, uint32 col);
@@ -191,6 +192,32 @@ public:
 	Point16 mouse_pos;           ///< Last known position of the mouse.
 	DisplayFlags display_flags;  ///< Currently active display flags.
 	std::vector<FloatawayText> floataway_texts;  ///< Currently active floataway texts.
+	std::unique_ptr<ViewportDrawCache> draw_cache;  ///< Sprites collected for the previous frame, reused while the view is unchanged.
+
+protected:
+	Viewport(WindowTypes wtype, const XYZPoint32 &view_pos);
+
+	bool SearchDrawCache(FinderData *fdata, ClickableSprite *result, uint32 *pixel);
+
+	bool OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &symbol) override;
+	void OnMouseMoveEvent(const Point16 &pos) override;
+	WmMouseEvent OnMouseButtonEvent(MouseButtons state, WmMouseEventMode mode) override;
+	void OnMouseWheelEvent(int direction) override;
+};
+
+/**
+ * A small secondary world view floating above the main display, with its own camera.
+ * Every view owns its own cached draw list and consumes #_world_dirty independently, so an
+ * extra view only pays for re-collecting changed columns and blitting its cached sprites,
+ * never for a full collection while its camera is unchanged.
+ * Drag the view with the left mouse button, scroll its camera with the right one,
+ * zoom with the mouse wheel, and close the view with Delete.
+ */
+class PipViewport : public Viewport {
+public:
+	PipViewport(const XYZPoint32 &view_pos);
+
+	void OnDraw(MouseModeSelector *selector) override;
 
 protected:
 	bool OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &symbol) override;
@@ -35,10 +35,14 @@ BaseWidget::BaseWidget(WidgetType wtype)
 	wtype(wtype),
 	number(INVALID_WIDGET_INDEX),
 	visible(true),
+	pending_relayout(true),
 	smallest_x(0),
 	smallest_y(0),
 	min_x(0),
 	min_y(0),
+	cached_min_x(0),
+	cached_min_y(0),
+	parent(nullptr),
 	pos(0, 0, 0, 0),
 	fill_x(0),
 	fill_y(0),
@@ -133,12 +137,48 @@ void BaseWidget::SetWidget(BaseWidget **wid_array)
 /**
  * Set up minimal size (#min_x and #min_y), fill step (#fill_x and #fill_y) and resize step (#resize_x and #resize_y) of the widget.
  * In addition, if the widget has a non-negative widget number, add the widget to the \a wid_array after verifying the position is still empty.
+ * Widgets that did not change since the last layout (see #MarkLayoutDirty) reuse their cached minimal size instead of recomputing it.
  * @param w %Window owning the widget.
  * @param wid_array [out] Array of widget pointers.
  */
 void BaseWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
 {
 	if (!w->initialized) this->SetWidget(wid_array);
+	if (w->initialized && !this->pending_relayout) {
+		/* Neither this widget nor any widget below it changed, reuse the previously
+		 * computed minimal size (#min_x and #min_y get overwritten while layouting). */
+		this->min_x = this->cached_min_x;
+		this->min_y = this->cached_min_y;
+		return;
+	}
+	this->ComputeMinimalSize(w, wid_array); // Polymorphic function call.
+	this->cached_min_x = this->min_x;
+	this->cached_min_y = this->min_y;
+	this->pending_relayout = false;
+}
+
+/**
+ * Mark this widget as changed, so the next #GuiWindow::ResetSize recomputes its minimal size.
+ * All widgets above it are marked as well, as their sizes derive from this widget.
+ */
+void BaseWidget::MarkLayoutDirty()
+{
+	for (BaseWidget *wid = this; wid != nullptr; wid = wid->parent) wid->pending_relayout = true;
+}
+
+/** Mark this widget and all widgets below it as changed, forcing a full re-layout of the subtree. */
+void BaseWidget::InvalidateLayout()
+{
+	this->pending_relayout = true;
+}
+
+/**
+ * Compute the minimal size, fill step, and resize step of the widget.
+ * @param w %Window owning the widget.
+ * @param wid_array [out] Array of widget pointers.
+ */
+void BaseWidget::ComputeMinimalSize(GuiWindow *w, [[maybe_unused]] BaseWidget **wid_array)
+{
 	if (this->visible) {
 		this->min_x = this->smallest_x;
 		this->min_y = this->smallest_y;
@@ -243,6 +283,7 @@ void BaseWidget::DoDraw(const GuiWindow *w)
 void BaseWidget::SetVisible(GuiWindow *w, const bool v)
 {
 	this->visible = v;
+	this->MarkLayoutDirty();
 	w->ResetSize();
 }
 
@@ -312,9 +353,8 @@ LeafWidget::LeafWidget(WidgetType wtype) : BaseWidget(wtype), flags(0), colour(C
  * @param wid_array [out] Array of widget pointers.
  * @todo Add support for #WT_RESIZEBOX.
  */
-void LeafWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void LeafWidget::ComputeMinimalSize([[maybe_unused]] GuiWindow *w, [[maybe_unused]] BaseWidget **wid_array)
 {
-	if (!w->initialized) this->SetWidget(wid_array);
 	if (!this->visible) {
 		this->min_x = 0;
 		this->min_y = 0;
@@ -445,10 +485,9 @@ DataWidget::DataWidget(WidgetType wtype) : LeafWidget(wtype), value(0), value_wi
  * @param w %Window owning the widget.
  * @param wid_array [out] Array of widget pointers.
  */
-void DataWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void DataWidget::ComputeMinimalSize(GuiWindow *w, [[maybe_unused]] BaseWidget **wid_array)
 {
 	_str_params.Clear();
-	if (!w->initialized) this->SetWidget(wid_array);
 	if (this->visible) {
 		this->min_x = this->smallest_x;
 		this->min_y = this->smallest_y;
@@ -713,6 +752,7 @@ void TextInputWidget::SetText(const std::string &text)
 {
 	this->buffer = text;
 	this->cursor_pos = std::min(this->cursor_pos, this->buffer.size());
+	this->MarkLayoutDirty();
 	if (this->text_changed) this->text_changed();
 }
 
@@ -841,9 +881,8 @@ void TextInputWidget::DoDraw(const GuiWindow *w)
 	}
 }
 
-void TextInputWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void TextInputWidget::ComputeMinimalSize(GuiWindow *w, [[maybe_unused]] BaseWidget **wid_array)
 {
-	if (!w->initialized) this->SetWidget(wid_array);
 	if (this->visible) {
 		this->min_x = this->smallest_x;
 		this->min_y = this->smallest_y;
@@ -880,15 +919,29 @@ void ScrollbarWidget::SetScrolled(const BaseWidget *canvas)
 	this->canvas = canvas;
 }
 
+/**
+ * Invoke a row provider callback for every list item currently scrolled into view.
+ * Items outside the visible range are not touched at all, which keeps drawing of long lists cheap.
+ * @param reserved_rows Number of visible rows taken by headers, not available for items.
+ * @param provider Row provider; called with the index of the item and the visible row number (\c 0 is the first item row).
+ */
+void ScrollbarWidget::ForVisibleRows(uint reserved_rows, const std::function<void(uint index, uint row)> &provider) const
+{
+	uint visible = this->GetVisibleCount();
+	if (visible <= reserved_rows) return;
+	visible -= reserved_rows;
+
+	const uint last = std::min(this->item_count, this->start + visible);
+	for (uint index = this->start; index < last; index++) provider(index, index - this->start);
+}
+
 /**
  * Compute smallest size of the widget.
  * @param w %Window owning the widget.
  * @param wid_array [out] Array of widget pointers.
  */
-void ScrollbarWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void ScrollbarWidget::ComputeMinimalSize([[maybe_unused]] GuiWindow *w, [[maybe_unused]] BaseWidget **wid_array)
 {
-	if (!w->initialized) this->SetWidget(wid_array);
-
 	if (!this->visible) {
 		this->min_x = 0;
 		this->min_y = 0;
@@ -1243,9 +1296,8 @@ BackgroundWidget::BackgroundWidget(WidgetType wtype) : LeafWidget(wtype), child(
  * @param w %Window owning the widget.
  * @param wid_array [out] Array of widget pointers.
  */
-void BackgroundWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void BackgroundWidget::ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array)
 {
-	if (!w->initialized) this->SetWidget(wid_array);
 	if (this->visible) {
 		this->min_x = this->smallest_x;
 		this->min_y = this->smallest_y;
@@ -1272,6 +1324,12 @@ void BackgroundWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
 	if (this->child == nullptr && this->number >= 0) w->UpdateWidgetSize(this->number, this);
 }
 
+void BackgroundWidget::InvalidateLayout()
+{
+	this->pending_relayout = true;
+	if (this->child != nullptr) this->child->InvalidateLayout();
+}
+
 void BackgroundWidget::SetSmallestSizePosition(const Rectangle16 &rect)
 {
 	this->pos = rect;
@@ -1417,6 +1475,7 @@ void IntermediateWidget::AddChild(uint8 x, uint8 y, BaseWidget *w)
 	assert(x < this->num_cols && y < this->num_rows);
 	assert(this->childs[y * (uint16)this->num_cols + x] == nullptr);
 	this->childs[y * (uint16)this->num_cols + x].reset(w);
+	w->parent = this;
 }
 
 /**
@@ -1424,9 +1483,8 @@ void IntermediateWidget::AddChild(uint8 x, uint8 y, BaseWidget *w)
  * @param w %Window owning the widget.
  * @param wid_array [out] Array of widget pointers.
  */
-void IntermediateWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
+void IntermediateWidget::ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array)
 {
-	if (!w->initialized) this->SetWidget(wid_array);
 	if (!this->visible) {
 		this->min_x = 0;
 		this->min_y = 0;
@@ -1580,6 +1638,14 @@ void IntermediateWidget::SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array)
 	}
 }
 
+void IntermediateWidget::InvalidateLayout()
+{
+	this->pending_relayout = true;
+	for (uint16 idx = 0; idx < static_cast<uint16>(this->num_rows * this->num_cols); idx++) {
+		this->childs[idx]->InvalidateLayout();
+	}
+}
+
 /**
  * Set the smallest size of the intermediate widget (and all widgets under it).
  * @param rect Smallest size to set.
@@ -1589,6 +1655,15 @@ void IntermediateWidget::SetSmallestSizePosition(const Rectangle16 &rect)
 {
 	this->pos = rect;
 
+	/* Distribute additional size over local copies of the row and column sizes, so the
+	 * minimal sizes cached in #rows and #columns stay valid for incremental re-layouts. */
+	uint16 row_size[50]; // Allocated size of each row and column. Size is arbitrary.
+	uint16 col_size[50];
+	assert(this->num_rows < lengthof(row_size));
+	assert(this->num_cols < lengthof(col_size));
+	for (uint8 y = 0; y < this->num_rows; y++) row_size[y] = this->rows[y].min_size;
+	for (uint8 x = 0; x < this->num_cols; x++) col_size[x] = this->columns[x].min_size;
+
 	/* Distribute additional vertical size over fillable children. */
 	uint16 diff = this->paddings[PAD_BOTTOM];
 	uint8 count = 0;
@@ -1609,7 +1684,7 @@ void IntermediateWidget::SetSmallestSizePosition(const Rectangle16 &rect)
 			if (this->rows[y].fill == max_step) {
 				uint16 increment = diff / count;
 				increment -= increment % max_step;
-				this->rows[y].min_size += increment;
+				row_size[y] += increment;
 				diff -= increment;
 				count--;
 				continue;
@@ -1639,7 +1714,7 @@ void IntermediateWidget::SetSmallestSizePosition(const Rectangle16 &rect)
 			if (this->columns[x].fill == max_step) {
 				uint16 increment = diff / count;
 				increment -= increment % max_step;
-				this->columns[x].min_size += increment;
+				col_size[x] += increment;
 				diff -= increment;
 				count--;
 				continue;
@@ -1657,12 +1732,12 @@ void IntermediateWidget::SetSmallestSizePosition(const Rectangle16 &rect)
 		for (uint8 x = 0; x < this->num_cols; x++) {
 			left += (x == 0) ? this->paddings[PAD_LEFT] : this->paddings[PAD_HORIZONTAL];
 			BaseWidget *bw = this->childs[y * (uint16)this->num_cols + x].get();
-			Rectangle16 rect2(left, top, this->columns[x].min_size, this->rows[y].min_size);
+			Rectangle16 rect2(left, top, col_size[x], row_size[y]);
 			bw->SetSmallestSizePosition(rect2);
 
-			left += this->columns[x].min_size;
+			left += col_size[x];
 		}
-		top += this->rows[y].min_size;
+		top += row_size[y];
 	}
 }
 
@@ -2209,6 +2284,7 @@ static int MakeWidgetSubTree(const WidgetPart *parts, int remaining, BaseWidget
 			BaseWidget *pointer;
 			used = MakeWidgetSubTree(parts, remaining, &pointer, biggest);
 			bg->child.reset(pointer);
+			if (pointer != nullptr) pointer->parent = bg;
 		}
 		total_used += used;
 	} else if ((*dest)->wtype == WT_GRID) {
@@ -81,7 +81,9 @@ public:
 	BaseWidget(WidgetType wtype);
 	virtual ~BaseWidget();
 
-	virtual void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array);
+	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array);
+	void MarkLayoutDirty();
+	virtual void InvalidateLayout();
 	virtual void SetSmallestSizePosition(const Rectangle16 &rect);
 	void Draw(const GuiWindow *w);
 	virtual void DoDraw(const GuiWindow *w);
@@ -96,10 +98,14 @@ public:
 	WidgetNumber number; ///< Widget number.
 
 	bool visible;              ///< Whether this panel is visible.
+	bool pending_relayout;     ///< Whether this widget or a widget below it changed, and its minimal size must be recomputed.
 	uint16 smallest_x;         ///< Original horizontal size.
 	uint16 smallest_y;         ///< Original vertical size.
 	uint16 min_x;              ///< Minimal horizontal size.
 	uint16 min_y;              ///< Minimal vertical size.
+	uint16 cached_min_x;       ///< Minimal horizontal size computed by the last #ComputeMinimalSize call (#min_x is overwritten while layouting).
+	uint16 cached_min_y;       ///< Minimal vertical size computed by the last #ComputeMinimalSize call.
+	BaseWidget *parent;        ///< Parent widget in the tree (\c nullptr for the root widget).
 	Rectangle16 pos;           ///< Current position and size (relative to window top-left edge).
 	Point32 cached_window_base; ///< This widget's last window base position.
 	uint16 fill_x;             ///< Horizontal fill step.
@@ -116,6 +122,8 @@ public:
 protected:
 	void SetWidget(BaseWidget **wid_array);
 
+	virtual void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array);
+
 	void InitMinimalSize(uint16 content_width, uint16 content_height, uint16 border_hor, uint16 border_vert);
 	void InitMinimalSize(const BorderSpriteData *bsd, uint16 content_width, uint16 content_height);
 };
@@ -140,7 +148,7 @@ class LeafWidget : public BaseWidget {
 public:
 	LeafWidget(WidgetType wtype);
 
-	virtual void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	virtual void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
 	virtual void DoDraw(const GuiWindow *w) override;
 	virtual void AutoRaiseButtons(const Point32 &base) override;
 
@@ -213,7 +221,7 @@ class DataWidget : public LeafWidget {
 public:
 	DataWidget(WidgetType wtype);
 
-	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
 	void DoDraw(const GuiWindow *w) override;
 
 	uint16 value;     ///< String number or sprite id.
@@ -237,7 +245,7 @@ public:
 
 	bool OnClick(const Point32 &base, const Point16 &pos) override;
 	bool OnKeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &symbol) override;
-	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
 	void DoDraw(const GuiWindow *w) override;
 
 	std::function<void()> text_changed;  ///< Called when the text has been modified.
@@ -272,7 +280,7 @@ public:
 	ScrollbarWidget(WidgetType wtype);
 	void SetScrolled(const BaseWidget *canvas);
 
-	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
 	void DoDraw(const GuiWindow *w) override;
 
 	bool OnClick(const Point32 &base, const Point16 &pos) override;
@@ -281,6 +289,7 @@ public:
 	void SetItemSize(uint size);
 	void SetItemCount(uint count);
 	void SetStart(uint offset);
+	void ForVisibleRows(uint reserved_rows, const std::function<void(uint index, uint row)> &provider) const;
 	uint GetItemSize() const;
 	uint GetVisibleCount() const;
 	uint GetStart() const;
@@ -308,7 +317,8 @@ class BackgroundWidget : public LeafWidget {
 public:
 	BackgroundWidget(WidgetType wtype);
 
-	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void InvalidateLayout() override;
 	void SetSmallestSizePosition(const Rectangle16 &rect) override;
 	void DoDraw(const GuiWindow *w) override;
 	BaseWidget *GetWidgetByPosition(const Point16 &pt) override;
@@ -349,7 +359,8 @@ class IntermediateWidget : public BaseWidget {
 public:
 	IntermediateWidget(uint8 num_rows, uint8 num_cols);
 
-	void SetupMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void ComputeMinimalSize(GuiWindow *w, BaseWidget **wid_array) override;
+	void InvalidateLayout() override;
 	void SetSmallestSizePosition(const Rectangle16 &rect) override;
 	void DoDraw(const GuiWindow *w) override;
 	BaseWidget *GetWidgetByPosition(const Point16 &pt) override;
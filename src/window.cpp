@@ -29,6 +29,7 @@
 #include "viewport.h"
 #include "mouse_mode.h"
 #include "config_reader.h"
+#include "gamecontrol.h"
 #include <cmath>
 
 /**
@@ -48,7 +49,7 @@ static uint GetWindowZPriority(WindowTypes wt);
  * @param wnumber Number of the window within the \a wtype.
  */
 Window::Window(WindowTypes wtype, WindowNumber wnumber)
-: rect(0, 0, 0, 0), wtype(wtype), wnumber(wnumber), timeout(0), flags(0), higher(nullptr), lower(nullptr)
+: rect(0, 0, 0, 0), wtype(wtype), wnumber(wnumber), timeout(0), flags(0), higher(nullptr), lower(nullptr), backing(0), dirty(true)
 {
 	_window_manager.AddToStack(this); // Add to window stack.
 }
@@ -56,6 +57,7 @@ Window::Window(WindowTypes wtype, WindowNumber wnumber)
 /** Destructor. */
 Window::~Window()
 {
+	_video.FreeBackingSurface(this->backing);
 	_window_manager.PreDelete(this);
 }
 
@@ -68,6 +70,7 @@ void Window::SetSize(uint width, uint height)
 {
 	this->rect.width = width;
 	this->rect.height = height;
+	this->MarkDirty();
 }
 
 /**
@@ -298,6 +301,14 @@ void Window::ResetSize()
 {
 }
 
+/**
+ * Mark all widgets of the window as changed, forcing the next #ResetSize to re-layout everything.
+ * @note Only if the window is a #GuiWindow.
+ */
+void Window::InvalidateWidgets()
+{
+}
+
 /**
  * Find the widget for which a tooltip should be shown.
  * @param pt Mouse cursor position.
@@ -374,6 +385,8 @@ StringID GuiWindow::TranslateStringNumber(StringID str_id) const
 
 void GuiWindow::ResetSize()
 {
+	if (this->initialized && !this->tree->pending_relayout) return; // No widget changed since the last layout.
+
 	this->tree->SetupMinimalSize(this, this->widgets.get());
 	this->rect = Rectangle32(this->rect.base.x, this->rect.base.y, this->tree->min_x, this->tree->min_y);
 
@@ -381,6 +394,11 @@ void GuiWindow::ResetSize()
 	this->tree->SetSmallestSizePosition(min_rect);
 }
 
+void GuiWindow::InvalidateWidgets()
+{
+	this->tree->InvalidateLayout();
+}
+
 /**
  * Construct the widget tree of the window, and initialize the window with it.
  * @param parts %Widget parts describing the window.
@@ -653,6 +671,7 @@ WidgetNumber GuiWindow::GetSelectedRadioButton(const WidgetNumber *wids)
 
 void GuiWindow::TimeoutCallback()
 {
+	this->MarkDirty();
 	this->tree->AutoRaiseButtons(this->rect.base);
 	if ((this->flags & WF_HIGHLIGHT) != 0) this->SetHighlight(false);
 }
@@ -686,7 +705,9 @@ WindowManager::WindowManager()
 	select_window(nullptr),
 	select_valid(true),
 	held_mouse_buttons(MB_NONE),
-	mouse_buttons_repeat_counter(0)
+	mouse_buttons_repeat_counter(0),
+	repaint_skipped(false),
+	force_repaint(false)
 {
 }
 
@@ -700,6 +721,7 @@ void WindowManager::CloseAllWindows()
 void WindowManager::ResetAllWindows()
 {
 	for (Window *w = this->top; w != nullptr; w = w->lower) {
+		w->InvalidateWidgets(); // Sprites and fonts may have changed, all cached widget sizes are stale.
 		w->ResetSize(); /// \todo This call should preserve the window size as much as possible.
 	}
 }
@@ -739,6 +761,7 @@ static uint GetWindowZPriority(WindowTypes wt)
 		case WC_TOOLBAR:        return 1;  // Top toolbar.
 		case WC_BOTTOM_TOOLBAR: return 1;  // Bottom toolbar.
 		case WC_MAINDISPLAY:    return 0;  // Main display at the bottom of the stack.
+		case WC_PIP_VIEWPORT:   return 1;  // Picture-in-picture views just above the main display.
 		case WC_MAIN_MENU:      return 2;  // Main menu at the bottom of the stack but above the viewport.
 	}
 	NOT_REACHED();
@@ -805,6 +828,7 @@ void WindowManager::RemoveFromStack(Window *w)
 	if (w == this->viewport) this->viewport = nullptr;
 
 	this->select_valid = false;
+	this->force_repaint = true;  // The area behind the window must be repainted, even when everything else is clean.
 
 	if (w->higher == nullptr) {
 		this->top = w->lower;
@@ -932,6 +956,7 @@ void WindowManager::MouseMoveEvent()
 		if ((_video.GetMouseDragging() & MB_LEFT) != 0 && this->current_window->wtype != WC_MAINDISPLAY) {
 			this->current_window->SetPosition(_video.MouseX() - this->move_offset.x, _video.MouseY() - this->move_offset.y);
 		} else {
+			this->current_window->MarkDirty();
 			this->current_window->OnMouseMoveEvent(Point16(this->current_window->GetRelativeMouseX(), this->current_window->GetRelativeMouseY()));
 		}
 		return;
@@ -940,6 +965,7 @@ void WindowManager::MouseMoveEvent()
 	this->UpdateCurrentWindow();
 
 	if (this->current_window != nullptr) {
+		this->current_window->MarkDirty();
 		this->current_window->OnMouseMoveEvent(Point16(this->current_window->GetRelativeMouseX(), this->current_window->GetRelativeMouseY()));
 	}
 }
@@ -955,10 +981,16 @@ void WindowManager::UpdateCurrentWindow()
 	if (w == this->current_window) return;
 
 	/* Windows are different, send mouse leave/enter events. */
-	if (this->current_window != nullptr && this->HasWindow(this->current_window)) this->current_window->OnMouseLeaveEvent();
+	if (this->current_window != nullptr && this->HasWindow(this->current_window)) {
+		this->current_window->MarkDirty();
+		this->current_window->OnMouseLeaveEvent();
+	}
 
 	this->current_window = w;
-	if (this->current_window != nullptr) this->current_window->OnMouseEnterEvent();
+	if (this->current_window != nullptr) {
+		this->current_window->MarkDirty();
+		this->current_window->OnMouseEnterEvent();
+	}
 }
 
 /**
@@ -993,6 +1025,7 @@ void WindowManager::MouseButtonEvent(MouseButtons button, WmMouseEventMode mode)
 	if ((_video.GetMouseDragging() & button) != MB_NONE) {
 		if (mode == WMEM_RELEASE) _video.SetMouseDragging(button, false, false);
 	} else if (this->current_window != nullptr) {
+		this->current_window->MarkDirty();
 		WmMouseEvent me = this->current_window->OnMouseButtonEvent(button, mode);
 		switch (me) {
 			case WMME_NONE:
@@ -1023,7 +1056,10 @@ void WindowManager::MouseButtonEvent(MouseButtons button, WmMouseEventMode mode)
 void WindowManager::MouseWheelEvent(int direction)
 {
 	this->UpdateCurrentWindow();
-	if (this->current_window != nullptr) this->current_window->OnMouseWheelEvent(direction);
+	if (this->current_window != nullptr) {
+		this->current_window->MarkDirty();
+		this->current_window->OnMouseWheelEvent(direction);
+	}
 }
 
 /**
@@ -1036,7 +1072,10 @@ void WindowManager::MouseWheelEvent(int direction)
 bool WindowManager::KeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string &symbol)
 {
 	for (Window *w = this->top; w != nullptr; w = w->lower) {
-		if (w->OnKeyEvent(key_code, mod, symbol)) return true;
+		if (w->OnKeyEvent(key_code, mod, symbol)) {
+			w->MarkDirty();
+			return true;
+		}
 	}
 	return false;
 }
@@ -1046,8 +1085,34 @@ bool WindowManager::KeyEvent(WmKeyCode key_code, WmKeyMod mod, const std::string
  * @todo [medium/difficult] Do this much less stupid.
  * @ingroup window_group
  */
+/**
+ * Check whether nothing visible can have changed since the last repaint.
+ * Holds while the game is paused, the world is unchanged, no window needs redrawing and
+ * no mouse interaction is in progress, so the previously presented frame is still valid.
+ * @return The repaint can be skipped entirely.
+ */
+bool WindowManager::IsQuiescent()
+{
+	if (this->force_repaint) return false;
+	if (_game_control.main_menu || _game_control.speed != GSP_PAUSE) return false;
+	if (!_world_dirty.IsEmpty()) return false;
+	if (this->GetSelector() != nullptr) return false;  // Selectors render below the mouse cursor.
+	if (this->held_mouse_buttons != MB_NONE || _video.GetMouseDragging() != MB_NONE) return false;
+	if (this->current_window != nullptr && this->current_window->FindTooltipWidget(_video.GetMousePosition()) != nullptr) return false;
+	for (const Window *w = this->top; w != nullptr; w = w->lower) {
+		if (w->dirty || w->timeout > 0) return false;
+	}
+	return true;
+}
+
 void WindowManager::UpdateWindows()
 {
+	/* While the game is paused and nothing visible changed, the previously presented
+	 * frame is still valid; skip collecting, blitting and presenting a new one. */
+	this->repaint_skipped = this->IsQuiescent();
+	if (this->repaint_skipped) return;
+	this->force_repaint = false;
+
 	BaseWidget *tooltip_widget = nullptr;
 	Window *tooltip_window = nullptr;
 	if (_video.GetMouseDragging() == MB_NONE && this->current_window != nullptr) {
@@ -1063,7 +1128,24 @@ void WindowManager::UpdateWindows()
 
 	GuiWindow *sel_window = this->GetSelector();
 	MouseModeSelector *selector = (sel_window == nullptr) ? nullptr : sel_window->selector;
-	for (Window *w = this->bottom; w != nullptr; w = w->higher) w->OnDraw(selector);
+	for (Window *w = this->bottom; w != nullptr; w = w->higher) {
+		if (w == this->viewport || w->wtype == WC_PIP_VIEWPORT || w->rect.width == 0 || w->rect.height == 0) {
+			/* World views have their own draw cache and change nearly every frame, draw them directly. */
+			w->OnDraw(selector);
+			w->dirty = false;  // Tracked anyway, so #IsQuiescent can tell whether a redraw is pending.
+			continue;
+		}
+		if (w->dirty || w->backing == 0) {
+			_video.StartBackingSurface(&w->backing, w->rect);
+			w->OnDraw(selector);
+			_video.FinishBackingSurface();
+			w->dirty = false;
+		}
+		_video.BlitBackingSurface(w->backing, w->rect);
+	}
+
+	/* All windows (viewport draw cache, minimap) had their chance to process the pending world changes. */
+	_world_dirty.Reset();
 
 	_str_params.Clear();
 	if (tooltip_widget != nullptr) {
@@ -1077,13 +1159,26 @@ void WindowManager::UpdateWindows()
 /** A tick has passed, update whatever must be updated. */
 void WindowManager::Tick()
 {
+	/* Windows display game state that changes without notifying them, so their contents
+	 * must be assumed stale whenever game time progresses or the world was edited.
+	 * Only while the game is paused can backing surfaces be reused until an event
+	 * invalidates them.
+	 */
+	if (_game_control.main_menu || _game_control.speed != GSP_PAUSE || !_world_dirty.IsEmpty()) {
+		for (Window *w = this->top; w != nullptr; w = w->lower) {
+			if (w->DisplaysGameState()) w->MarkDirty();
+		}
+	}
+
 	/* Decrease timeout timers. */
 	Window *w = _window_manager.top;
 	while (w != nullptr) {
 		Window *next = w->lower;
 		if (w->timeout > 0) {
 			w->timeout--;
-			if (w->timeout == 0) w->TimeoutCallback();  // This might delete the window, do not use hereafter.
+			if (w->timeout == 0) {
+				w->TimeoutCallback();  // This might delete the window, do not use hereafter.
+			}
 		}
 		w = next;
 	}
@@ -1131,7 +1226,10 @@ Window *GetWindowByType(WindowTypes wtype, WindowNumber wnumber)
 void NotifyChange(WindowTypes wtype, WindowNumber wnumber, ChangeCode code, uint32 parameter)
 {
 	Window *w = GetWindowByType(wtype, wnumber);
-	if (w != nullptr) w->OnChange(code, parameter);
+	if (w != nullptr) {
+		w->MarkDirty();
+		w->OnChange(code, parameter);
+	}
 }
 
 /**
@@ -1143,6 +1241,7 @@ void NotifyChange(ChangeCode code, uint32 parameter)
 {
 	for (Window *w = _window_manager.top; w != nullptr;) {
 		Window *next = w->lower;  // Make a copy in case the window deletes itself.
+		w->MarkDirty();
 		w->OnChange(code, parameter);
 		w = next;
 	}
@@ -1160,6 +1259,7 @@ Window *HighlightWindowByType(WindowTypes wtype, WindowNumber wnumber)
 	Window *w = GetWindowByType(wtype, wnumber);
 	if (w != nullptr) {
 		_window_manager.RaiseWindow(w);
+		w->MarkDirty();
 		w->SetHighlight(true);
 	}
 	return w;
@@ -1202,16 +1302,26 @@ bool ShowRideManagementGui(const uint16 ride)
  */
 std::optional<KeyboardShortcut> Shortcuts::GetShortcut(Keybinding binding, Scope scope) const
 {
-	for (KeyboardShortcut ks = KS_BEGIN; ks < KS_COUNT; ks++) {
-		if (this->values[ks].scope != Scope::GLOBAL && this->values[ks].scope != scope) continue;
-		if (this->values[ks].current_binding.key != binding.key) continue;
-		if (this->values[ks].current_binding.mod != binding.mod) continue;
-		if (binding.key == WMKC_SYMBOL && this->values[ks].current_binding.symbol != binding.symbol) continue;
-		return ks;
+	if (binding.key != WMKC_SYMBOL) binding.symbol.clear();  // Non-textual bindings ignore the symbol when matching.
+	for (Scope s : {scope, Scope::GLOBAL}) {
+		const auto iter = this->dispatch_table.find(DispatchKey(binding.key, binding.mod, binding.symbol, s));
+		if (iter != this->dispatch_table.end()) return iter->second;
 	}
 	return std::nullopt;
 }
 
+/** Rebuild #dispatch_table from the current (possibly user-overridden) keybindings. */
+void Shortcuts::RebuildDispatchTable()
+{
+	this->dispatch_table.clear();
+	for (KeyboardShortcut ks = KS_BEGIN; ks < KS_COUNT; ks++) {
+		const Keybinding &binding = this->values[ks].current_binding;
+		const std::string symbol = (binding.key == WMKC_SYMBOL) ? binding.symbol : std::string();
+		/* Like the old linear scan, the first shortcut with a keystroke wins on conflicts. */
+		this->dispatch_table.emplace(DispatchKey(binding.key, binding.mod, symbol, this->values[ks].scope), ks);
+	}
+}
+
 /**
  * Read the keybinding configurations from a config file.
  * @param cfg_file File to read from.
@@ -1291,6 +1401,7 @@ void Shortcuts::ReadConfig(ConfigFile &cfg_file)
 
 		this->values[ks].current_binding = Keybinding(code, modifiers);
 	}
+	this->RebuildDispatchTable();
 }
 
 /** Constructor. */
@@ -1316,6 +1427,7 @@ Shortcuts::Shortcuts()
 	this->values[KS_INGAME_SPEED_2] = ShortcutInfo("speed_2", Keybinding("2", WMKM_ALT), Scope::INGAME);
 	this->values[KS_INGAME_SPEED_4] = ShortcutInfo("speed_4", Keybinding("3", WMKM_ALT), Scope::INGAME);
 	this->values[KS_INGAME_SPEED_8] = ShortcutInfo("speed_8", Keybinding("4", WMKM_ALT), Scope::INGAME);
+	this->values[KS_INGAME_SPEED_TURBO] = ShortcutInfo("speed_turbo", Keybinding("5", WMKM_ALT), Scope::INGAME);
 	this->values[KS_INGAME_SPEED_UP] = ShortcutInfo("speed_up", Keybinding(WMKC_CURSOR_PAGEUP, WMKM_ALT), Scope::INGAME);
 	this->values[KS_INGAME_SPEED_DOWN] = ShortcutInfo("speed_down", Keybinding(WMKC_CURSOR_PAGEDOWN, WMKM_ALT), Scope::INGAME);
 
@@ -1355,8 +1467,17 @@ Shortcuts::Shortcuts()
 	this->values[KS_INGAME_HEIGHT_PATHS] = ShortcutInfo("heightmarkers_paths", Keybinding(FunctionKeyCode(11)), Scope::INGAME);
 	this->values[KS_INGAME_HEIGHT_TERRAIN] = ShortcutInfo("heightmarkers_terrain", Keybinding(FunctionKeyCode(12)), Scope::INGAME);
 
+	this->values[KS_INGAME_PROFILER] = ShortcutInfo("profiler", Keybinding("p", WMKM_CTRL), Scope::INGAME);
+	this->values[KS_INGAME_RELOAD_RCD] = ShortcutInfo("reload_rcd", Keybinding("r", WMKM_CTRL), Scope::INGAME);
+	this->values[KS_INGAME_PIP_VIEW] = ShortcutInfo("pip_view", Keybinding("v", WMKM_CTRL), Scope::INGAME);
+
+	this->values[KS_SCREENSHOT] = ShortcutInfo("screenshot", Keybinding("c", WMKM_CTRL), Scope::GLOBAL);
+	this->values[KS_TIMELAPSE] = ShortcutInfo("timelapse", Keybinding("t", WMKM_CTRL), Scope::GLOBAL);
+
 #ifndef NDEBUG
 	/* In debug builds, sanity-check that we didn't forget to initialize any shortcuts. */
 	for (KeyboardShortcut ks = KS_BEGIN; ks < KS_COUNT; ks++) assert(this->values[ks].Valid());
 #endif
+
+	this->RebuildDispatchTable();
 }
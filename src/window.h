@@ -17,7 +17,9 @@
 
 #include <array>
 #include <functional>
+#include <map>
 #include <optional>
+#include <tuple>
 #include <vector>
 
 class ConfigFile;
@@ -36,13 +38,20 @@ enum DropdownItemFlags {
 };
 DECLARE_ENUM_AS_BIT_SET(DropdownItemFlags)
 
-/** An item in a dropdown list. */
+/** An item in a dropdown list. The item text is formatted lazily, when the item first becomes visible. */
 class DropdownItem {
 public:
 	explicit DropdownItem(StringID strid, DropdownItemFlags flags = DDIF_NONE);
 
-	const std::string str;    ///< Item, as a string.
+	const std::string &GetString() const;
+
 	DropdownItemFlags flags;  ///< Properties of the item.
+
+private:
+	StringID strid;                  ///< String to display.
+	mutable StringParameters params; ///< Captured parameter values of the string, used when the text is formatted.
+	mutable std::string str;         ///< Item, as a string; empty until the first #GetString call.
+	mutable bool materialized;       ///< Whether #str has been formatted already.
 };
 
 /** A dropdown list is a collection of #DropdownItem items. */
@@ -70,6 +79,26 @@ public:
 	Window *higher; ///< %Window above this window (managed by #WindowManager).
 	Window *lower;  ///< %Window below this window (managed by #WindowManager).
 
+	GLuint backing; ///< Backing surface holding the last rendered window contents, \c 0 if none (managed by #WindowManager).
+	bool dirty;     ///< The window contents changed since #backing was last rendered.
+
+	/** Mark the window contents as changed, forcing a redraw instead of reusing the backing surface. */
+	inline void MarkDirty()
+	{
+		this->dirty = true;
+	}
+
+	/**
+	 * Whether the window displays game state that changes as game time passes.
+	 * Such windows are marked dirty every tick while the game is running; windows
+	 * returning \c false keep their backing surface until an event invalidates it.
+	 * @return Whether the window contents depend on the progressing game state.
+	 */
+	virtual bool DisplaysGameState() const
+	{
+		return true;
+	}
+
 	/**
 	 * Get the current mouse position relative to this window's top-left corner.
 	 * @return The relative mouse X coordinate.
@@ -105,6 +134,7 @@ public:
 	virtual void SetHighlight(bool value);
 	virtual void OnChange(ChangeCode code, uint32 parameter);
 	virtual void ResetSize();
+	virtual void InvalidateWidgets();
 
 	virtual BaseWidget *FindTooltipWidget(Point16 pt);
 	virtual void SetTooltipStringParameters(BaseWidget *tooltip_widget) const;
@@ -126,6 +156,7 @@ public:
 	virtual void SetSize(uint width, uint height) override;
 	StringID TranslateStringNumber(StringID str_id) const;
 	virtual void ResetSize() override;
+	virtual void InvalidateWidgets() override;
 
 	virtual WmMouseEvent OnMouseButtonEvent(MouseButtons state, WmMouseEventMode mode) override;
 	virtual void OnMouseWheelEvent(int direction) override;
@@ -337,6 +368,21 @@ public:
 
 	void UpdateWindows();
 
+	/**
+	 * Did the last #UpdateWindows call skip the repaint because nothing visible changed?
+	 * @return The previously presented frame is still valid and nothing was rendered.
+	 */
+	inline bool RepaintWasSkipped() const
+	{
+		return this->repaint_skipped;
+	}
+
+	/** The next repaint may not be skipped, e.g. because a screen capture needs a newly presented frame. */
+	inline void ForceRepaint()
+	{
+		this->force_repaint = true;
+	}
+
 	Window *top;    ///< Top-most window in the window stack.
 	Window *bottom; ///< Lowest window in the window stack.
 
@@ -344,6 +390,7 @@ private:
 	Window *FindWindowByPosition(const Point16 &pos) const;
 	void UpdateCurrentWindow();
 	GuiWindow *GetSelector();
+	bool IsQuiescent();
 
 	Window *current_window;   ///< 'Current' window under the mouse.
 	GuiWindow *select_window; ///< Cache containing the highest window with active GuiWindow::selector field
@@ -355,6 +402,8 @@ private:
 
 	MouseButtons held_mouse_buttons;   ///< Mouse buttons currently held down.
 	int mouse_buttons_repeat_counter;  ///< Ticks since last repeated mouse button event.
+	bool repaint_skipped;              ///< The last #UpdateWindows call skipped the repaint. @see RepaintWasSkipped
+	bool force_repaint;                ///< The next repaint may not be skipped, e.g. because a window was removed.
 };
 
 extern WindowManager _window_manager;
@@ -436,11 +485,24 @@ public:
 	void SetShortcut(KeyboardShortcut ks, Keybinding binding)
 	{
 		this->values[ks].current_binding = binding;
+		this->RebuildDispatchTable();
 	}
 
 	void ReadConfig(ConfigFile &cfg_file);
 
 	std::array<ShortcutInfo, KS_COUNT> values;  ///< All configured keyboard shortcuts.
+
+private:
+	/** Key of the dispatch table: key code, modifiers, symbol, and scope of a keybinding. */
+	using DispatchKey = std::tuple<WmKeyCode, WmKeyMod, std::string, Scope>;
+
+	void RebuildDispatchTable();
+
+	/**
+	 * Dispatch table resolving a keystroke to its shortcut with a single lookup.
+	 * Rebuilt from #values whenever a binding changes, so user overrides are always layered in.
+	 */
+	std::map<DispatchKey, KeyboardShortcut> dispatch_table;
 };
 extern Shortcuts _shortcuts;
 
@@ -489,6 +551,7 @@ void ShowRideBuildGui(FixedRideInstance *instance);
 void ShowSettingGui();
 void ShowInboxGui();
 void ShowMinimap();
+void ShowProfilerWindow();
 void DrawMessage(const Message *msg, const Rectangle32 &rect, bool narrow, float obscure_fraction = 0.f);
 
 static const uint32 DEFAULT_ERROR_MESSAGE_TIMEOUT = 8000;   ///< Number of ticks after which an error message auto-closes by default.
@@ -20,6 +20,7 @@
 enum WindowTypes {
 	WC_MAIN_MENU,       ///< Main menu screen.
 	WC_MAINDISPLAY,     ///< Main display of the world.
+	WC_PIP_VIEWPORT,    ///< Picture-in-picture world view.
 	WC_TOOLBAR,         ///< Main toolbar.
 	WC_BOTTOM_TOOLBAR,  ///< Bottom toolbar.
 	WC_QUIT,            ///< Quit program window.
@@ -49,6 +50,7 @@ enum WindowTypes {
 	WC_SCENARIO_SELECT, ///< Scenario select window.
 	WC_CONFIRM,         ///< Confirmation prompt.
 	WC_DROPDOWN,        ///< Dropdown window.
+	WC_PROFILER,        ///< Profiler window.
 
 	WC_NONE,            ///< Invalid window type.
 };
@@ -59,6 +61,7 @@ enum ChangeCode {
 	CHG_DROPDOWN_RESULT,     ///< The selection of a dropdown window.
 	CHG_RESOLUTION_CHANGED,  ///< The size of the FreeRCT window was changed.
 	CHG_PERSON_DELETED,      ///< A person has been deleted from the world.
+	CHG_PERSON_CHANGED,      ///< The displayed state of a person changed.
 };
 
 /** Various state flags of the %Window. */
@@ -167,6 +170,7 @@ enum KeyboardShortcut {
 	KS_INGAME_SPEED_2,      ///< Set speed to 2x.
 	KS_INGAME_SPEED_4,      ///< Set speed to 4x.
 	KS_INGAME_SPEED_8,      ///< Set speed to 8x.
+	KS_INGAME_SPEED_TURBO,  ///< Set speed to turbo (as fast as the frame budget allows).
 	KS_INGAME_SPEED_UP,     ///< Set speed one level faster.
 	KS_INGAME_SPEED_DOWN,   ///< Set speed one level slower.
 
@@ -206,6 +210,13 @@ enum KeyboardShortcut {
 	KS_INGAME_HEIGHT_PATHS,      ///< Toggle height markers on paths.
 	KS_INGAME_HEIGHT_TERRAIN,    ///< Toggle height markers on terrain.
 
+	KS_INGAME_PROFILER,          ///< Open the profiler window.
+	KS_INGAME_RELOAD_RCD,        ///< Re-load changed RCD files.
+	KS_INGAME_PIP_VIEW,          ///< Open a picture-in-picture world view.
+
+	KS_SCREENSHOT,               ///< Write a screenshot of the next presented frame.
+	KS_TIMELAPSE,                ///< Toggle capturing a timelapse screenshot every few frames.
+
 	KS_COUNT  ///< Number of keyboard shortcuts.
 };
 DECLARE_POSTFIX_INCREMENT(KeyboardShortcut)